@@ -19,25 +19,68 @@
 
 include_guard()
 
+include(FindPackageHandleStandardArgs)
+
+# Reference LAPACK built with 64-bit integers (lapacke64, lapack64, cblas64, blas64)
 find_library(LAPACKE64_file NAMES lapacke64.dll.lib lapacke64.lib lapacke64 HINTS ${REF_LAPACK_ROOT} PATH_SUFFIXES lib lib64)
-find_package_handle_standard_args(LAPACKE64 REQUIRED_VARS LAPACKE64_file)
 find_library(LAPACK64_file NAMES lapack64.dll.lib lapack64.lib lapack64 HINTS ${REF_LAPACK_ROOT} PATH_SUFFIXES lib lib64)
-find_package_handle_standard_args(LAPACK64 REQUIRED_VARS LAPACK64_file)
 find_library(CBLAS64_file NAMES cblas64.dll.lib cblas64.lib cblas64 HINTS ${REF_LAPACK_ROOT} PATH_SUFFIXES lib lib64)
-find_package_handle_standard_args(CBLAS64 REQUIRED_VARS CBLAS64_file)
 find_library(BLAS64_file NAMES blas64.dll.lib blas64.lib blas64 HINTS ${REF_LAPACK_ROOT} PATH_SUFFIXES lib lib64)
-find_package_handle_standard_args(BLAS64 REQUIRED_VARS BLAS64_file)
 
-get_filename_component(LAPACKE64_LIB_DIR ${LAPACKE64_file} DIRECTORY)
-find_path(LAPACKE_INCLUDE lapacke.h HINTS ${REF_LAPACK_ROOT} PATH_SUFFIXES include)
+if(LAPACKE64_file AND LAPACK64_file AND CBLAS64_file AND BLAS64_file)
+  get_filename_component(LAPACKE64_LIB_DIR ${LAPACKE64_file} DIRECTORY)
+  find_path(LAPACKE_INCLUDE lapacke.h HINTS ${REF_LAPACK_ROOT} PATH_SUFFIXES include)
+  set(LAPACKE_LIBS ${LAPACKE64_file} ${LAPACK64_file} ${CBLAS64_file} ${BLAS64_file})
+else()
+  # OpenBLAS built with 64-bit integers, which bundles LAPACKE, LAPACK and
+  # CBLAS in one library: openblas64_ with suffixed symbols, as built with
+  # INTERFACE64=1 SYMBOLSUFFIX=64_, or openblas64 as shipped by distributions.
+  # LP64 builds of OpenBLAS do not match the 64-bit integers of the backend.
+  find_library(OPENBLAS64_file NAMES openblas64_ openblas64 HINTS ${OPENBLAS_ROOT} ${REF_LAPACK_ROOT} PATH_SUFFIXES lib lib64 lib/x86_64-linux-gnu)
+  find_package_handle_standard_args(OPENBLAS64 REQUIRED_VARS OPENBLAS64_file)
+  if(OPENBLAS64_file)
+    get_filename_component(LAPACKE64_LIB_DIR ${OPENBLAS64_file} DIRECTORY)
+    find_path(LAPACKE_INCLUDE lapacke.h
+      HINTS ${OPENBLAS_ROOT} ${REF_LAPACK_ROOT} ${LAPACKE64_LIB_DIR}/..
+      PATH_SUFFIXES include include/openblas64 include/openblas include/x86_64-linux-gnu/openblas64-pthread include/x86_64-linux-gnu/openblas64-openmp
+    )
+    set(LAPACKE_LIBS ${OPENBLAS64_file})
+    find_path(CBLAS_INCLUDE cblas.h HINTS ${LAPACKE_INCLUDE} NO_DEFAULT_PATH)
+    get_filename_component(OPENBLAS64_name ${OPENBLAS64_file} NAME_WE)
+    if(LAPACKE_INCLUDE AND OPENBLAS64_name MATCHES "64_$")
+      # The headers declare the unsuffixed names: wrap them in headers of the
+      # same names that map every LAPACKE_ and cblas_ function to its suffixed
+      # symbol, and put those first on the include path.
+      set(LAPACKE_WRAPPER_DIR ${CMAKE_BINARY_DIR}/lapacke_symbol_suffix)
+      foreach(header lapacke cblas)
+        if(header STREQUAL "lapacke")
+          set(header_path ${LAPACKE_INCLUDE}/lapacke.h)
+          set(prefix LAPACKE_)
+        elseif(CBLAS_INCLUDE)
+          set(header_path ${CBLAS_INCLUDE}/cblas.h)
+          set(prefix cblas_)
+        else()
+          continue()
+        endif()
+        file(STRINGS ${header_path} declarations REGEX "^[^#]*${prefix}[a-z0-9_]+[ ]*\\(")
+        string(REGEX MATCHALL "${prefix}[a-z0-9_]+[ ]*\\(" names "${declarations}")
+        string(REGEX REPLACE "[ ]*\\(" "" names "${names}")
+        list(REMOVE_DUPLICATES names)
+        set(content "// Generated by FindLAPACKE.cmake for ${OPENBLAS64_file}\n#pragma once\n")
+        foreach(name ${names})
+          string(APPEND content "#define ${name} ${name}64_\n")
+        endforeach()
+        string(APPEND content "#include \"${header_path}\"\n")
+        file(WRITE ${LAPACKE_WRAPPER_DIR}/${header}.h "${content}")
+      endforeach()
+      set(LAPACKE_INCLUDE ${LAPACKE_WRAPPER_DIR} ${LAPACKE_INCLUDE})
+    endif()
+  endif()
+endif()
 
-if(UNIX)
+if(UNIX AND LAPACKE64_LIB_DIR)
     list(APPEND LAPACKE_LINK "-Wl,-rpath,${LAPACKE64_LIB_DIR}")
 endif()
-list(APPEND LAPACKE_LINK ${LAPACKE64_file})
-list(APPEND LAPACKE_LINK ${LAPACK64_file})
-list(APPEND LAPACKE_LINK ${CBLAS64_file})
-list(APPEND LAPACKE_LINK ${BLAS64_file})
+list(APPEND LAPACKE_LINK ${LAPACKE_LIBS})
 
-include(FindPackageHandleStandardArgs)
 find_package_handle_standard_args(LAPACKE64 REQUIRED_VARS LAPACKE_INCLUDE LAPACKE_LINK)
@@ -23,6 +23,7 @@ set(MKL_IFACE mkl_intel_ilp64)
 set(MKL_SEQ mkl_sequential)
 set(MKL_TBB mkl_tbb_thread)
 set(MKL_CORE mkl_core)
+set(MKL_RT mkl_rt)
 
 set(MKL_C ${MKL_IFACE})
 
@@ -46,6 +47,12 @@ if (ENABLE_MKLCPU_BACKEND OR ENABLE_MKLGPU_BACKEND)
   list(APPEND MKL_LIBRARIES ${MKL_C})
 endif()
 
+# The MKL CPU backends link the single dynamic library instead, which loads the
+# threading layer selected at run time
+if(ENABLE_MKLCPU_BACKEND AND ENABLE_MKLCPU_THREAD_RUNTIME)
+  list(APPEND MKL_LIBRARIES ${MKL_RT})
+endif()
+
 include(FindPackageHandleStandardArgs)
 foreach(lib ${MKL_LIBRARIES})
   find_library(${lib}_file NAMES ${lib}
@@ -91,6 +98,16 @@ if (ENABLE_MKLCPU_BACKEND OR ENABLE_MKLGPU_BACKEND)
   endif()
 endif()
 
+if(ENABLE_MKLCPU_BACKEND)
+  if(ENABLE_MKLCPU_THREAD_RUNTIME)
+    set(MKL_LINK_CPU ${MKL_LINK_PREFIX} ${LIB_PREFIX}${MKL_RT}${LIB_SUFFIX})
+    set(MKL_CPU_COPT "-DONEMKL_MKLCPU_THREAD_RUNTIME")
+  else()
+    set(MKL_LINK_CPU ${MKL_LINK_C})
+    set(MKL_CPU_COPT "")
+  endif()
+endif()
+
 if (USE_DPCPP_API)
   find_package_handle_standard_args(MKL REQUIRED_VARS MKL_INCLUDE MKL_COPT MKL_LINK_SYCL)
 else(ENABLE_MKLCPU_BACKEND)
@@ -53,6 +53,7 @@ THIRD-PARTY-PROGRAMS file and in the README.md file included with the Software P
 
         # Threading for mklcpu_backend
         "enable_mklcpu_thread_tbb": [True, False],
+        "enable_mklcpu_thread_runtime": [True, False],
 
         # Testing
         "build_functional_tests"  : [True, False],
@@ -68,6 +69,7 @@ THIRD-PARTY-PROGRAMS file and in the README.md file included with the Software P
         "enable_mklgpu_backend"   : True,
 
         "enable_mklcpu_thread_tbb": True,
+        "enable_mklcpu_thread_runtime": False,
 
         "build_functional_tests" : True,
 
@@ -88,7 +90,7 @@ THIRD-PARTY-PROGRAMS file and in the README.md file included with the Software P
         if self.options.enable_mklcpu_backend or self.options.enable_mklgpu_backend:
             installer.add_repository("\"deb https://apt.repos.intel.com/oneapi all main\"")
             installer.install("intel-oneapi-mkl-devel")  # User must apt-key add GPG key before they can download oneMKL
-            if self.options.enable_mklcpu_thread_tbb:
+            if self.options.enable_mklcpu_thread_tbb or self.options.enable_mklcpu_thread_runtime:
                 installer.install("intel-oneapi-tbb-devel")  # For libtbb.so used during link-time
 
 
@@ -130,6 +132,7 @@ THIRD-PARTY-PROGRAMS file and in the README.md file included with the Software P
             "ENABLE_MKLCPU_BACKEND"    : self.options.enable_mklcpu_backend,
             "ENABLE_MKLGPU_BACKEND"    : self.options.enable_mklgpu_backend,
             "ENABLE_MKLCPU_THREAD_TBB" : self.options.enable_mklcpu_thread_tbb,
+            "ENABLE_MKLCPU_THREAD_RUNTIME" : self.options.enable_mklcpu_thread_runtime,
             "BUILD_FUNCTIONAL_TESTS"   : self.options.build_functional_tests,
             "BUILD_DOC"                : self.options.build_doc,
 
@@ -25,5 +25,14 @@
 #include "oneapi/mkl/blas.hpp"
 #include "oneapi/mkl/lapack.hpp"
 #include "oneapi/mkl/rng.hpp"
+#include "oneapi/mkl/autotune.hpp"
+#include "oneapi/mkl/capture.hpp"
+#include "oneapi/mkl/execution_policy.hpp"
+#include "oneapi/mkl/graph.hpp"
+#include "oneapi/mkl/inline_calls.hpp"
+#include "oneapi/mkl/numa.hpp"
+#include "oneapi/mkl/stats.hpp"
+#include "oneapi/mkl/threading_layer.hpp"
+#include "oneapi/mkl/verbose.hpp"
 
 #endif //_ONEMKL_HPP_
@@ -0,0 +1,80 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_AUTOTUNE_HPP_
+#define _ONEMKL_AUTOTUNE_HPP_
+
+#include <string>
+
+#include "oneapi/mkl/detail/export.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace autotune {
+
+// Routing of x86cpu calls between the CPU backends built into the run-time
+// dispatcher, such as MKL and Netlib. While autotuning is enabled, every
+// backend listed for x86cpu is loaded. The first calls of a routine in each
+// size class (the log2 bucket of the largest of m, n and k) are calibration
+// calls: they are spread over the backends and timed from the profiling
+// information of their event. Once every backend has run
+// ONEMKL_AUTOTUNE_SAMPLES calls of the class (3 by default), the fastest one
+// is used for all later calls of that class. A single CPU backend goes
+// through the same calibration, which records it as the winner.
+//
+// Calibration never waits on a call or its queue: the events of calibration
+// calls are checked for completion by later calls and by save(). Only USM
+// calls on queues created with sycl::property::queue::enable_profiling are
+// timed. Other calls of a class without a winner run on the first backend,
+// and use the winner once one is known.
+//
+// The winners are kept in a text table that is read when autotuning is
+// enabled and written by save() and at process exit, so that a tuning run
+// can be reused by later runs without calibrating again.
+//
+// The backends other than the first are loaded without adding their symbols
+// to the global scope and bind their own dependencies first (RTLD_DEEPBIND),
+// since their dependencies may export the same symbols, such as MKL and Netlib
+// CBLAS. This does not work under sanitizers: setting ONEMKL_ISOLATE_BACKENDS=0
+// turns it off, and autotuning then only has the first backend to choose from.
+//
+// Setting ONEMKL_AUTOTUNE=1 enables autotuning from startup. The table is
+// ONEMKL_AUTOTUNE_FILE, or onemkl_autotune.txt if it is not set. LAPACK
+// scratchpad sizes queried while autotuning is enabled cover every CPU backend,
+// so scratchpads should be sized after enable().
+
+// Starts autotuning with the table in path, or in the default file if path is
+// empty.
+ONEMKL_EXPORT void enable(const std::string &path = "");
+
+// Saves the table and routes every later call to the first backend again.
+// Calibration calls still running are dropped.
+ONEMKL_EXPORT void disable();
+
+// Writes the winners found so far, including those of calibration calls that
+// completed since the last call, to the table.
+ONEMKL_EXPORT void save();
+
+ONEMKL_EXPORT bool is_enabled();
+
+} // namespace autotune
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_AUTOTUNE_HPP_
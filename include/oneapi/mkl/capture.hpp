@@ -0,0 +1,63 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_CAPTURE_HPP_
+#define _ONEMKL_CAPTURE_HPP_
+
+#include <string>
+
+#include "oneapi/mkl/detail/export.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace capture {
+
+// Compact binary record of the BLAS, LAPACK and RNG calls that go through the
+// run-time dispatcher, for replay with onemkl_replay. Each call is stored with
+// its routine, backend, scalar dimensions and host-side start time and
+// duration; array contents are not recorded.
+//
+// Setting ONEMKL_CAPTURE=<path> starts a capture into path at startup.
+//
+// The file starts with the 8 bytes "OMKLCAP1", followed by records. Integers
+// are LEB128 varints, signed ones zigzag encoded first, and strings are a
+// varint length followed by their bytes.
+//   'R' id domain layout name dims  Declares routine id, before its first call.
+//                                   domain is a byte (0 blas, 1 lapack, 2 rng),
+//                                   dims names the values of its calls.
+//   'C' id device count values...   A call of routine id on a device (0 x86cpu,
+//       start duration              1 intelgpu, 2 nvidiagpu, 3 amdgpu). values
+//                                   and start are signed, start being the time
+//                                   in nanoseconds since the previous call
+//                                   started and duration that of the call.
+constexpr char format_magic[] = "OMKLCAP1";
+
+// Starts capturing into path, truncating it.
+ONEMKL_EXPORT void start(const std::string &path);
+
+// Writes pending records and stops capturing.
+ONEMKL_EXPORT void stop();
+
+ONEMKL_EXPORT bool is_active();
+
+} // namespace capture
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_CAPTURE_HPP_
@@ -0,0 +1,70 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_EXECUTION_POLICY_HPP_
+#define _ONEMKL_EXECUTION_POLICY_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl/detail/export.hpp"
+
+namespace oneapi {
+namespace mkl {
+
+// Host resources of the BLAS and LAPACK calls made on a CPU queue through the
+// run-time dispatcher. Host tasks of different queues otherwise each use every
+// core, so concurrent pipelines oversubscribe the machine; giving each queue
+// its own threads and CPUs partitions it instead.
+//
+// The host tasks of the calls made on a queue with a policy run pinned to its
+// CPUs, and the MKL CPU backend limits MKL to its threads with the thread-local
+// MKL setting, for OpenMP and TBB threading alike. The batched paths of the
+// Netlib LAPACK backend start at most that many threads, which inherit the
+// CPUs. Calls keep the policy the queue had when they were made. Pinning is
+// only supported on Linux; elsewhere only the thread count applies. Calls the
+// backends do not run as host tasks, such as the calls of the MKL CPU LAPACK
+// backend and the generate calls of RNG engines, do not use the policy.
+struct execution_policy {
+    // Threads a call may use, 0 for the backend default.
+    std::int64_t threads = 0;
+
+    // NUMA node whose CPUs the calls run on, -1 for any. Ignored if cpus is
+    // not empty.
+    std::int64_t numa_node = -1;
+
+    // CPUs the calls run on, empty for any.
+    std::vector<int> cpus;
+};
+
+// Sets the policy of the calls made on queue from now on, replacing the
+// previous one. The queue is kept until its policy is cleared.
+ONEMKL_EXPORT void set_execution_policy(sycl::queue &queue, const execution_policy &policy);
+
+// Policy of queue, the default one if none is set.
+ONEMKL_EXPORT execution_policy get_execution_policy(const sycl::queue &queue);
+
+ONEMKL_EXPORT void clear_execution_policy(sycl::queue &queue);
+
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_EXECUTION_POLICY_HPP_
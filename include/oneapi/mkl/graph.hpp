@@ -0,0 +1,95 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_GRAPH_HPP_
+#define _ONEMKL_GRAPH_HPP_
+
+#include <cstddef>
+#include <memory>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl/detail/export.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace detail {
+namespace graph {
+struct state;
+} // namespace graph
+} // namespace detail
+
+// Replay of a fixed sequence of BLAS and LAPACK calls made on a CPU queue
+// through the run-time dispatcher. Between begin() and end(), the USM calls
+// made on the queue are not submitted: the CPU backends hand their host tasks
+// to the graph. run() then submits the whole list as a single host task that
+// runs the calls in the order they were made, so a sequence of small calls
+// pays one scheduler round-trip instead of one per call.
+//
+// A graph replays its calls exactly as recorded. The recorded calls read and
+// write their arrays when the graph runs, so iterations that update data in
+// place reuse it as is, but every scalar argument (sizes, alpha, beta,
+// pointers) is the value it had at recording time and cannot be updated: a
+// graph is recorded again, without any submission, to change them. Arrays,
+// including scratchpads, must stay allocated until the last run completes.
+//
+// Recorded calls return an already complete event, which orders nothing:
+// recorded calls run in order anyway, and work outside the graph that uses
+// their results must depend on the event returned by run(). Events from
+// outside the graph that recorded calls depend on become dependencies of
+// every run.
+//
+// Only calls the backends run as host tasks can be recorded, since any other
+// call would run ahead of the calls recorded before it. Calls on buffers throw
+// invalid_argument without running. USM calls of backends that submit their
+// own kernels, such as the MKL CPU LAPACK backend, are submitted as usual and
+// then throw unimplemented. If a recorded call throws while the graph runs,
+// the rest of the run is skipped and the exception is reported as an
+// asynchronous error of the queue.
+class ONEMKL_EXPORT graph {
+public:
+    graph();
+    ~graph();
+
+    graph(const graph &) = delete;
+    graph &operator=(const graph &) = delete;
+
+    // Starts recording the calls made on queue, which must be a CPU queue not
+    // recorded by another graph, and drops the calls recorded before.
+    void begin(sycl::queue &queue);
+
+    // Stops recording.
+    void end();
+
+    // Submits the recorded calls as one host task, after dependencies.
+    sycl::event run(const sycl::vector_class<sycl::event> &dependencies = {});
+
+    // Number of recorded calls.
+    std::size_t size() const;
+
+    bool is_recording() const;
+
+private:
+    std::shared_ptr<detail::graph::state> state_;
+};
+
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_GRAPH_HPP_
@@ -0,0 +1,61 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_INLINE_CALLS_HPP_
+#define _ONEMKL_INLINE_CALLS_HPP_
+
+#include <cstdint>
+
+#include "oneapi/mkl/detail/export.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace inline_calls {
+
+// Inline execution of tiny calls on CPU queues. Submitting a host task costs
+// far more than a level-1 call on a few dozen elements or a small gemm. While
+// inline calls are enabled, a USM call of the host-task CPU backends whose
+// largest dimension (m, n or k) is below the threshold, on an out-of-order
+// queue, runs on the calling thread if the events it depends on are complete.
+// It then returns an already complete event. Errors it raises are reported
+// as for a submitted call, through the asynchronous handler of the queue:
+// the call returns the event of a host task that rethrows them. Batched calls,
+// calls with pending dependencies, and calls of backends that submit their
+// own kernels are submitted as usual.
+//
+// Setting ONEMKL_INLINE=1 enables inline calls from startup, with the
+// threshold in ONEMKL_INLINE_THRESHOLD if it is set.
+
+constexpr std::int64_t default_threshold = 64;
+
+// Runs the calls smaller than threshold inline from now on.
+ONEMKL_EXPORT void enable(std::int64_t threshold = default_threshold);
+
+ONEMKL_EXPORT void disable();
+
+ONEMKL_EXPORT bool is_enabled();
+
+// Threshold of the enabled mode, 0 while disabled.
+ONEMKL_EXPORT std::int64_t get_threshold();
+
+} // namespace inline_calls
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_INLINE_CALLS_HPP_
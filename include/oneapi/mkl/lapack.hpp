@@ -27,5 +27,10 @@
 #ifdef ENABLE_MKLGPU_BACKEND
 #include "oneapi/mkl/lapack/detail/mklgpu/lapack_ct.hpp"
 #endif
+#ifdef ENABLE_NETLIB_BACKEND
+#include "oneapi/mkl/lapack/detail/netlib/lapack_ct.hpp"
+#endif
 
 #include "oneapi/mkl/lapack/detail/lapack_rt.hpp"
+#include "oneapi/mkl/lapack/detail/lapack_rt_workspace.hpp"
+#include "oneapi/mkl/lapack/detail/lapack_rt_mixed.hpp"
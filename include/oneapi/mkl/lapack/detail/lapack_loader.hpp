@@ -58,6 +58,50 @@ ONEMKL_EXPORT void gebrd(oneapi::mkl::device libkey, sycl::queue &queue, std::in
                          sycl::buffer<std::complex<double>> &taup,
                          sycl::buffer<std::complex<double>> &scratchpad,
                          std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gels(oneapi::mkl::device libkey, sycl::queue &queue,
+                        oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                        sycl::buffer<float> &b, std::int64_t ldb, sycl::buffer<float> &scratchpad,
+                        std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gels(oneapi::mkl::device libkey, sycl::queue &queue,
+                        oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                        sycl::buffer<double> &b, std::int64_t ldb, sycl::buffer<double> &scratchpad,
+                        std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gels(oneapi::mkl::device libkey, sycl::queue &queue,
+                        oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                        sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                        sycl::buffer<std::complex<float>> &scratchpad,
+                        std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gels(oneapi::mkl::device libkey, sycl::queue &queue,
+                        oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                        sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                        sycl::buffer<std::complex<double>> &scratchpad,
+                        std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gelsd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                         std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a,
+                         std::int64_t lda, sycl::buffer<float> &b, std::int64_t ldb,
+                         sycl::buffer<float> &s, float rcond, sycl::buffer<std::int64_t> &rank,
+                         sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gelsd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                         std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a,
+                         std::int64_t lda, sycl::buffer<double> &b, std::int64_t ldb,
+                         sycl::buffer<double> &s, double rcond, sycl::buffer<std::int64_t> &rank,
+                         sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gelsd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                         std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<float>> &a,
+                         std::int64_t lda, sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                         sycl::buffer<float> &s, float rcond, sycl::buffer<std::int64_t> &rank,
+                         sycl::buffer<std::complex<float>> &scratchpad,
+                         std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gelsd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                         std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
+                         std::int64_t lda, sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                         sycl::buffer<double> &s, double rcond, sycl::buffer<std::int64_t> &rank,
+                         sycl::buffer<std::complex<double>> &scratchpad,
+                         std::int64_t scratchpad_size);
 ONEMKL_EXPORT void gerqf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
                          std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
                          sycl::buffer<float> &tau, sycl::buffer<float> &scratchpad,
@@ -152,6 +196,24 @@ ONEMKL_EXPORT void getrs(oneapi::mkl::device libkey, sycl::queue &queue,
                          sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<double>> &b,
                          std::int64_t ldb, sycl::buffer<std::complex<double>> &scratchpad,
                          std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gesv(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<float> &b, std::int64_t ldb,
+                        sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gesv(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<double> &b, std::int64_t ldb,
+                        sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gesv(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<float>> &b,
+                        std::int64_t ldb, sycl::buffer<std::complex<float>> &scratchpad,
+                        std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gesv(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<double>> &b,
+                        std::int64_t ldb, sycl::buffer<std::complex<double>> &scratchpad,
+                        std::int64_t scratchpad_size);
 ONEMKL_EXPORT void gesvd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
                          oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n,
                          sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &s,
@@ -188,6 +250,38 @@ ONEMKL_EXPORT void heevd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi:
                          sycl::buffer<std::complex<double>> &a, std::int64_t lda,
                          sycl::buffer<double> &w, sycl::buffer<std::complex<double>> &scratchpad,
                          std::int64_t scratchpad_size);
+ONEMKL_EXPORT void heevr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                         oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda, float vl, float vu,
+                         std::int64_t il, std::int64_t iu, float abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                         sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+                         sycl::buffer<std::complex<float>> &scratchpad,
+                         std::int64_t scratchpad_size);
+ONEMKL_EXPORT void heevr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                         oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda, double vl,
+                         double vu, std::int64_t il, std::int64_t iu, double abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                         sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+                         sycl::buffer<std::complex<double>> &scratchpad,
+                         std::int64_t scratchpad_size);
+ONEMKL_EXPORT void heevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                         oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda, float vl, float vu,
+                         std::int64_t il, std::int64_t iu, float abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                         sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+                         sycl::buffer<std::complex<float>> &scratchpad,
+                         std::int64_t scratchpad_size);
+ONEMKL_EXPORT void heevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                         oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda, double vl,
+                         double vu, std::int64_t il, std::int64_t iu, double abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                         sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+                         sycl::buffer<std::complex<double>> &scratchpad,
+                         std::int64_t scratchpad_size);
 ONEMKL_EXPORT void hegvd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t itype,
                          oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
                          sycl::buffer<std::complex<float>> &a, std::int64_t lda,
@@ -322,6 +416,24 @@ ONEMKL_EXPORT void potrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi:
                          std::int64_t lda, sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
                          sycl::buffer<std::complex<double>> &scratchpad,
                          std::int64_t scratchpad_size);
+ONEMKL_EXPORT void posv(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                        sycl::buffer<float> &b, std::int64_t ldb, sycl::buffer<float> &scratchpad,
+                        std::int64_t scratchpad_size);
+ONEMKL_EXPORT void posv(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a,
+                        std::int64_t lda, sycl::buffer<double> &b, std::int64_t ldb,
+                        sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void posv(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<float>> &a,
+                        std::int64_t lda, sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                        sycl::buffer<std::complex<float>> &scratchpad,
+                        std::int64_t scratchpad_size);
+ONEMKL_EXPORT void posv(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
+                        std::int64_t lda, sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                        sycl::buffer<std::complex<double>> &scratchpad,
+                        std::int64_t scratchpad_size);
 ONEMKL_EXPORT void syevd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
                          oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
                          std::int64_t lda, sycl::buffer<double> &w,
@@ -330,6 +442,34 @@ ONEMKL_EXPORT void syevd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi:
                          oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
                          std::int64_t lda, sycl::buffer<float> &w, sycl::buffer<float> &scratchpad,
                          std::int64_t scratchpad_size);
+ONEMKL_EXPORT void syevr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                         oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<float> &a, std::int64_t lda, float vl, float vu,
+                         std::int64_t il, std::int64_t iu, float abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                         sycl::buffer<float> &z, std::int64_t ldz, sycl::buffer<float> &scratchpad,
+                         std::int64_t scratchpad_size);
+ONEMKL_EXPORT void syevr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                         oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<double> &a, std::int64_t lda, double vl, double vu,
+                         std::int64_t il, std::int64_t iu, double abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                         sycl::buffer<double> &z, std::int64_t ldz,
+                         sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void syevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                         oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<float> &a, std::int64_t lda, float vl, float vu,
+                         std::int64_t il, std::int64_t iu, float abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                         sycl::buffer<float> &z, std::int64_t ldz, sycl::buffer<float> &scratchpad,
+                         std::int64_t scratchpad_size);
+ONEMKL_EXPORT void syevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                         oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<double> &a, std::int64_t lda, double vl, double vu,
+                         std::int64_t il, std::int64_t iu, double abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                         sycl::buffer<double> &z, std::int64_t ldz,
+                         sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
 ONEMKL_EXPORT void sygvd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t itype,
                          oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
                          sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b,
@@ -367,6 +507,27 @@ ONEMKL_EXPORT void sytrf(oneapi::mkl::device libkey, sycl::queue &queue, oneapi:
                          sycl::buffer<std::int64_t> &ipiv,
                          sycl::buffer<std::complex<double>> &scratchpad,
                          std::int64_t scratchpad_size);
+ONEMKL_EXPORT void sysv(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<float> &b, std::int64_t ldb,
+                        sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void sysv(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a,
+                        std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, sycl::buffer<double> &b,
+                        std::int64_t ldb, sycl::buffer<double> &scratchpad,
+                        std::int64_t scratchpad_size);
+ONEMKL_EXPORT void sysv(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<float>> &a,
+                        std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+                        sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                        sycl::buffer<std::complex<float>> &scratchpad,
+                        std::int64_t scratchpad_size);
+ONEMKL_EXPORT void sysv(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
+                        std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+                        sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                        sycl::buffer<std::complex<double>> &scratchpad,
+                        std::int64_t scratchpad_size);
 ONEMKL_EXPORT void trtrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                          oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t n,
                          std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
@@ -539,6 +700,68 @@ ONEMKL_EXPORT void getrs_batch(oneapi::mkl::device libkey, sycl::queue &queue,
                                std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
                                sycl::buffer<std::complex<double>> &scratchpad,
                                std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gesv_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+                              std::int64_t stride_ipiv, sycl::buffer<float> &b, std::int64_t ldb,
+                              std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gesv_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+                              std::int64_t stride_ipiv, sycl::buffer<double> &b, std::int64_t ldb,
+                              std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gesv_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<std::complex<float>> &a,
+                              std::int64_t lda, std::int64_t stride_a,
+                              sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                              sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                              std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<std::complex<float>> &scratchpad,
+                              std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gesv_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
+                              std::int64_t lda, std::int64_t stride_a,
+                              sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                              sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                              std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<std::complex<double>> &scratchpad,
+                              std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gels_batch(oneapi::mkl::device libkey, sycl::queue &queue,
+                              oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<float> &b, std::int64_t ldb,
+                              std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gels_batch(oneapi::mkl::device libkey, sycl::queue &queue,
+                              oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<double> &b, std::int64_t ldb,
+                              std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gels_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+    std::int64_t stride_a, sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
+    std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gels_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+    std::int64_t stride_a, sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size, sycl::buffer<std::complex<double>> &scratchpad,
+    std::int64_t scratchpad_size);
+ONEMKL_EXPORT void heevd_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
+    sycl::buffer<float> &w, std::int64_t stride_w, std::int64_t batch_size,
+    sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void heevd_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+    sycl::buffer<double> &w, std::int64_t stride_w, std::int64_t batch_size,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size);
 ONEMKL_EXPORT void getrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
                                std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
                                std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
@@ -619,6 +842,44 @@ ONEMKL_EXPORT void potrs_batch(oneapi::mkl::device libkey, sycl::queue &queue,
                                std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
                                sycl::buffer<std::complex<double>> &scratchpad,
                                std::int64_t scratchpad_size);
+ONEMKL_EXPORT void posv_batch(oneapi::mkl::device libkey, sycl::queue &queue,
+                              oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                              sycl::buffer<float> &b, std::int64_t ldb, std::int64_t stride_b,
+                              std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                              std::int64_t scratchpad_size);
+ONEMKL_EXPORT void posv_batch(oneapi::mkl::device libkey, sycl::queue &queue,
+                              oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                              sycl::buffer<double> &b, std::int64_t ldb, std::int64_t stride_b,
+                              std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                              std::int64_t scratchpad_size);
+ONEMKL_EXPORT void posv_batch(oneapi::mkl::device libkey, sycl::queue &queue,
+                              oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<std::complex<float>> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<std::complex<float>> &scratchpad,
+                              std::int64_t scratchpad_size);
+ONEMKL_EXPORT void posv_batch(oneapi::mkl::device libkey, sycl::queue &queue,
+                              oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<std::complex<double>> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<std::complex<double>> &scratchpad,
+                              std::int64_t scratchpad_size);
+ONEMKL_EXPORT void syevd_batch(oneapi::mkl::device libkey, sycl::queue &queue,
+                               oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                               sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                               sycl::buffer<float> &w, std::int64_t stride_w,
+                               std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                               std::int64_t scratchpad_size);
+ONEMKL_EXPORT void syevd_batch(oneapi::mkl::device libkey, sycl::queue &queue,
+                               oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                               sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                               sycl::buffer<double> &w, std::int64_t stride_w,
+                               std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                               std::int64_t scratchpad_size);
 ONEMKL_EXPORT void ungqr_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
                                std::int64_t n, std::int64_t k, sycl::buffer<std::complex<float>> &a,
                                std::int64_t lda, std::int64_t stride_a,
@@ -654,6 +915,51 @@ ONEMKL_EXPORT sycl::event gebrd(oneapi::mkl::device libkey, sycl::queue &queue,
                                 std::complex<double> *taup, std::complex<double> *scratchpad,
                                 std::int64_t scratchpad_size,
                                 const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gels(oneapi::mkl::device libkey, sycl::queue &queue,
+                               oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                               std::int64_t nrhs, float *a, std::int64_t lda, float *b,
+                               std::int64_t ldb, float *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gels(oneapi::mkl::device libkey, sycl::queue &queue,
+                               oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                               std::int64_t nrhs, double *a, std::int64_t lda, double *b,
+                               std::int64_t ldb, double *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gels(oneapi::mkl::device libkey, sycl::queue &queue,
+                               oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                               std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                               std::complex<float> *b, std::int64_t ldb,
+                               std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gels(oneapi::mkl::device libkey, sycl::queue &queue,
+                               oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                               std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                               std::complex<double> *b, std::int64_t ldb,
+                               std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gelsd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                                std::int64_t n, std::int64_t nrhs, float *a, std::int64_t lda,
+                                float *b, std::int64_t ldb, float *s, float rcond,
+                                std::int64_t *rank, float *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gelsd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                                std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda,
+                                double *b, std::int64_t ldb, double *s, double rcond,
+                                std::int64_t *rank, double *scratchpad,
+                                std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gelsd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                                std::int64_t n, std::int64_t nrhs, std::complex<float> *a,
+                                std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
+                                float *s, float rcond, std::int64_t *rank,
+                                std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gelsd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                                std::int64_t n, std::int64_t nrhs, std::complex<double> *a,
+                                std::int64_t lda, std::complex<double> *b, std::int64_t ldb,
+                                double *s, double rcond, std::int64_t *rank,
+                                std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {});
 ONEMKL_EXPORT sycl::event gerqf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
                                 std::int64_t n, float *a, std::int64_t lda, float *tau,
                                 float *scratchpad, std::int64_t scratchpad_size,
@@ -746,6 +1052,26 @@ ONEMKL_EXPORT sycl::event getrs(oneapi::mkl::device libkey, sycl::queue &queue,
                                 std::complex<double> *b, std::int64_t ldb,
                                 std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                                 const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gesv(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                               std::int64_t nrhs, float *a, std::int64_t lda, std::int64_t *ipiv,
+                               float *b, std::int64_t ldb, float *scratchpad,
+                               std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gesv(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                               std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t *ipiv,
+                               double *b, std::int64_t ldb, double *scratchpad,
+                               std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gesv(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                               std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                               std::int64_t *ipiv, std::complex<float> *b, std::int64_t ldb,
+                               std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gesv(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                               std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                               std::int64_t *ipiv, std::complex<double> *b, std::int64_t ldb,
+                               std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
 ONEMKL_EXPORT sycl::event gesvd(oneapi::mkl::device libkey, sycl::queue &queue,
                                 oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
                                 std::int64_t n, double *a, std::int64_t lda, double *s, double *u,
@@ -782,6 +1108,38 @@ ONEMKL_EXPORT sycl::event heevd(oneapi::mkl::device libkey, sycl::queue &queue,
                                 std::complex<double> *a, std::int64_t lda, double *w,
                                 std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                                 const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event heevr(oneapi::mkl::device libkey, sycl::queue &queue,
+                                oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a,
+                                std::int64_t lda, float vl, float vu, std::int64_t il,
+                                std::int64_t iu, float abstol, std::int64_t *m, float *w,
+                                std::complex<float> *z, std::int64_t ldz,
+                                std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event heevr(oneapi::mkl::device libkey, sycl::queue &queue,
+                                oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a,
+                                std::int64_t lda, double vl, double vu, std::int64_t il,
+                                std::int64_t iu, double abstol, std::int64_t *m, double *w,
+                                std::complex<double> *z, std::int64_t ldz,
+                                std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event heevx(oneapi::mkl::device libkey, sycl::queue &queue,
+                                oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a,
+                                std::int64_t lda, float vl, float vu, std::int64_t il,
+                                std::int64_t iu, float abstol, std::int64_t *m, float *w,
+                                std::complex<float> *z, std::int64_t ldz,
+                                std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event heevx(oneapi::mkl::device libkey, sycl::queue &queue,
+                                oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a,
+                                std::int64_t lda, double vl, double vu, std::int64_t il,
+                                std::int64_t iu, double abstol, std::int64_t *m, double *w,
+                                std::complex<double> *z, std::int64_t ldz,
+                                std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {});
 ONEMKL_EXPORT sycl::event hegvd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t itype,
                                 oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
                                 std::complex<float> *a, std::int64_t lda, std::complex<float> *b,
@@ -934,6 +1292,28 @@ ONEMKL_EXPORT sycl::event potrs(oneapi::mkl::device libkey, sycl::queue &queue,
                                 std::int64_t ldb, std::complex<double> *scratchpad,
                                 std::int64_t scratchpad_size,
                                 const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event posv(oneapi::mkl::device libkey, sycl::queue &queue,
+                               oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, float *a,
+                               std::int64_t lda, float *b, std::int64_t ldb, float *scratchpad,
+                               std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event posv(oneapi::mkl::device libkey, sycl::queue &queue,
+                               oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, double *a,
+                               std::int64_t lda, double *b, std::int64_t ldb, double *scratchpad,
+                               std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event posv(oneapi::mkl::device libkey, sycl::queue &queue,
+                               oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                               std::complex<float> *a, std::int64_t lda, std::complex<float> *b,
+                               std::int64_t ldb, std::complex<float> *scratchpad,
+                               std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event posv(oneapi::mkl::device libkey, sycl::queue &queue,
+                               oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                               std::complex<double> *a, std::int64_t lda, std::complex<double> *b,
+                               std::int64_t ldb, std::complex<double> *scratchpad,
+                               std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
 ONEMKL_EXPORT sycl::event syevd(oneapi::mkl::device libkey, sycl::queue &queue,
                                 oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
                                 double *a, std::int64_t lda, double *w, double *scratchpad,
@@ -944,6 +1324,34 @@ ONEMKL_EXPORT sycl::event syevd(oneapi::mkl::device libkey, sycl::queue &queue,
                                 float *a, std::int64_t lda, float *w, float *scratchpad,
                                 std::int64_t scratchpad_size,
                                 const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event syevr(oneapi::mkl::device libkey, sycl::queue &queue,
+                                oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda,
+                                float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+                                std::int64_t *m, float *w, float *z, std::int64_t ldz,
+                                float *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event syevr(oneapi::mkl::device libkey, sycl::queue &queue,
+                                oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda,
+                                double vl, double vu, std::int64_t il, std::int64_t iu,
+                                double abstol, std::int64_t *m, double *w, double *z,
+                                std::int64_t ldz, double *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event syevx(oneapi::mkl::device libkey, sycl::queue &queue,
+                                oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda,
+                                float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+                                std::int64_t *m, float *w, float *z, std::int64_t ldz,
+                                float *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event syevx(oneapi::mkl::device libkey, sycl::queue &queue,
+                                oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda,
+                                double vl, double vu, std::int64_t il, std::int64_t iu,
+                                double abstol, std::int64_t *m, double *w, double *z,
+                                std::int64_t ldz, double *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {});
 ONEMKL_EXPORT sycl::event sygvd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t itype,
                                 oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
                                 double *a, std::int64_t lda, double *b, std::int64_t ldb, double *w,
@@ -983,6 +1391,28 @@ ONEMKL_EXPORT sycl::event sytrf(oneapi::mkl::device libkey, sycl::queue &queue,
                                 std::int64_t lda, std::int64_t *ipiv,
                                 std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                                 const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event sysv(oneapi::mkl::device libkey, sycl::queue &queue,
+                               oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, float *a,
+                               std::int64_t lda, std::int64_t *ipiv, float *b, std::int64_t ldb,
+                               float *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event sysv(oneapi::mkl::device libkey, sycl::queue &queue,
+                               oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, double *a,
+                               std::int64_t lda, std::int64_t *ipiv, double *b, std::int64_t ldb,
+                               double *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event sysv(oneapi::mkl::device libkey, sycl::queue &queue,
+                               oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                               std::complex<float> *a, std::int64_t lda, std::int64_t *ipiv,
+                               std::complex<float> *b, std::int64_t ldb,
+                               std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event sysv(oneapi::mkl::device libkey, sycl::queue &queue,
+                               oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                               std::complex<double> *a, std::int64_t lda, std::int64_t *ipiv,
+                               std::complex<double> *b, std::int64_t ldb,
+                               std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
 ONEMKL_EXPORT sycl::event trtrs(oneapi::mkl::device libkey, sycl::queue &queue,
                                 oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans,
                                 oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs,
@@ -1264,6 +1694,60 @@ ONEMKL_EXPORT sycl::event getrs_batch(
     std::int64_t *ipiv, std::int64_t stride_ipiv, std::complex<double> *b, std::int64_t ldb,
     std::int64_t stride_b, std::int64_t batch_size, std::complex<double> *scratchpad,
     std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gesv_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs, float *a,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv, float *b,
+    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, float *scratchpad,
+    std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gesv_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs, double *a,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv,
+    double *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, double *scratchpad,
+    std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gesv_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+    std::complex<float> *a, std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
+    std::int64_t stride_ipiv, std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gesv_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+    std::complex<double> *a, std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
+    std::int64_t stride_ipiv, std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gels_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, float *a, std::int64_t lda, std::int64_t stride_a, float *b,
+    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, float *scratchpad,
+    std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gels_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t stride_a,
+    double *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, double *scratchpad,
+    std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gels_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gels_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event heevd_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::complex<float> *a, std::int64_t lda, std::int64_t stride_a, float *w,
+    std::int64_t stride_w, std::int64_t batch_size, std::complex<float> *scratchpad,
+    std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event heevd_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::complex<double> *a, std::int64_t lda, std::int64_t stride_a, double *w,
+    std::int64_t stride_w, std::int64_t batch_size, std::complex<double> *scratchpad,
+    std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies = {});
 ONEMKL_EXPORT sycl::event getrs_batch(oneapi::mkl::device libkey, sycl::queue &queue,
                                       oneapi::mkl::transpose *trans, std::int64_t *n,
                                       std::int64_t *nrhs, float **a, std::int64_t *lda,
@@ -1396,6 +1880,40 @@ ONEMKL_EXPORT sycl::event potrs_batch(oneapi::mkl::device libkey, sycl::queue &q
                                       std::int64_t batch_size, std::complex<double> *scratchpad,
                                       std::int64_t scratchpad_size,
                                       const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event posv_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, float *a, std::int64_t lda, std::int64_t stride_a, float *b,
+    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, float *scratchpad,
+    std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event posv_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t stride_a, double *b,
+    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, double *scratchpad,
+    std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event posv_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, std::complex<float> *a, std::int64_t lda, std::int64_t stride_a,
+    std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+    std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event posv_batch(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, std::complex<double> *a, std::int64_t lda, std::int64_t stride_a,
+    std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+    std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event syevd_batch(oneapi::mkl::device libkey, sycl::queue &queue,
+                                      oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                                      float *a, std::int64_t lda, std::int64_t stride_a, float *w,
+                                      std::int64_t stride_w, std::int64_t batch_size,
+                                      float *scratchpad, std::int64_t scratchpad_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event syevd_batch(oneapi::mkl::device libkey, sycl::queue &queue,
+                                      oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                                      double *a, std::int64_t lda, std::int64_t stride_a, double *w,
+                                      std::int64_t stride_w, std::int64_t batch_size,
+                                      double *scratchpad, std::int64_t scratchpad_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {});
 ONEMKL_EXPORT sycl::event potrs_batch(oneapi::mkl::device libkey, sycl::queue &queue,
                                       oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *nrhs,
                                       float **a, std::int64_t *lda, float **b, std::int64_t *ldb,
@@ -1454,6 +1972,14 @@ template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_
 std::int64_t gebrd_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
                                    std::int64_t n, std::int64_t lda);
 template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gels_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                  oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                  std::int64_t nrhs, std::int64_t lda, std::int64_t ldb);
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gelsd_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
+                                   std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                   std::int64_t ldb);
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
 std::int64_t gerqf_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
                                    std::int64_t n, std::int64_t lda);
 template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
@@ -1481,6 +2007,9 @@ template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_
 std::int64_t getrs_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
                                    oneapi::mkl::transpose trans, std::int64_t n, std::int64_t nrhs,
                                    std::int64_t lda, std::int64_t ldb);
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gesv_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                                  std::int64_t nrhs, std::int64_t lda, std::int64_t ldb);
 template <typename fp_type,
           oneapi::mkl::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
 std::int64_t heevd_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
@@ -1488,6 +2017,18 @@ std::int64_t heevd_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queu
                                    std::int64_t lda);
 template <typename fp_type,
           oneapi::mkl::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevr_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                   oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                   oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                   std::int64_t ldz);
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevx_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                   oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                   oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                   std::int64_t ldz);
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
 std::int64_t hegvd_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
                                    std::int64_t itype, oneapi::mkl::job jobz,
                                    oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
@@ -1539,11 +2080,19 @@ std::int64_t potrs_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queu
                                    oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
                                    std::int64_t lda, std::int64_t ldb);
 template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t posv_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                  oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                                  std::int64_t lda, std::int64_t ldb);
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
 std::int64_t potri_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
                                    oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda);
 template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
 std::int64_t sytrf_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
                                    oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda);
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t sysv_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                  oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                                  std::int64_t lda, std::int64_t ldb);
 template <typename fp_type,
           oneapi::mkl::lapack::internal::is_real_floating_point<fp_type> = nullptr>
 std::int64_t syevd_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
@@ -1551,6 +2100,18 @@ std::int64_t syevd_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queu
                                    std::int64_t lda);
 template <typename fp_type,
           oneapi::mkl::lapack::internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevr_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                   oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                   oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                   std::int64_t ldz);
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevx_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                   oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                   oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                   std::int64_t ldz);
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_real_floating_point<fp_type> = nullptr>
 std::int64_t sygvd_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
                                    std::int64_t itype, oneapi::mkl::job jobz,
                                    oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
@@ -1611,6 +2172,24 @@ std::int64_t getrs_batch_scratchpad_size(oneapi::mkl::device libkey, sycl::queue
                                          std::int64_t stride_ipiv, std::int64_t ldb,
                                          std::int64_t stride_b, std::int64_t batch_size);
 template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gesv_batch_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                        std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                        std::int64_t stride_a, std::int64_t stride_ipiv,
+                                        std::int64_t ldb, std::int64_t stride_b,
+                                        std::int64_t batch_size);
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gels_batch_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                        oneapi::mkl::transpose trans, std::int64_t m,
+                                        std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                        std::int64_t stride_a, std::int64_t ldb,
+                                        std::int64_t stride_b, std::int64_t batch_size);
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevd_batch_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                         oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                                         std::int64_t n, std::int64_t lda, std::int64_t stride_a,
+                                         std::int64_t stride_w, std::int64_t batch_size);
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
 std::int64_t geqrf_batch_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
                                          std::int64_t m, std::int64_t n, std::int64_t lda,
                                          std::int64_t stride_a, std::int64_t stride_tau,
@@ -1624,6 +2203,17 @@ std::int64_t potrs_batch_scratchpad_size(oneapi::mkl::device libkey, sycl::queue
                                          oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
                                          std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
                                          std::int64_t stride_b, std::int64_t batch_size);
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t posv_batch_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                        oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                                        std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+                                        std::int64_t stride_b, std::int64_t batch_size);
+template <typename fp_type,
+          oneapi::mkl::lapack::internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevd_batch_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
+                                         oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                                         std::int64_t n, std::int64_t lda, std::int64_t stride_a,
+                                         std::int64_t stride_w, std::int64_t batch_size);
 template <typename fp_type,
           oneapi::mkl::lapack::internal::is_real_floating_point<fp_type> = nullptr>
 std::int64_t orgqr_batch_scratchpad_size(oneapi::mkl::device libkey, sycl::queue &queue,
@@ -1697,6 +2287,40 @@ ONEMKL_EXPORT std::int64_t gebrd_scratchpad_size<std::complex<double>>(oneapi::m
                                                                        std::int64_t n,
                                                                        std::int64_t lda);
 template <>
+ONEMKL_EXPORT std::int64_t gels_scratchpad_size<float>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t gels_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t gels_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t gels_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t gelsd_scratchpad_size<float>(oneapi::mkl::device libkey,
+                                                        sycl::queue &queue, std::int64_t m,
+                                                        std::int64_t n, std::int64_t nrhs,
+                                                        std::int64_t lda, std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t gelsd_scratchpad_size<double>(oneapi::mkl::device libkey,
+                                                         sycl::queue &queue, std::int64_t m,
+                                                         std::int64_t n, std::int64_t nrhs,
+                                                         std::int64_t lda, std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t gelsd_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t gelsd_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t ldb);
+template <>
 ONEMKL_EXPORT std::int64_t gerqf_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                         sycl::queue &queue, std::int64_t m,
                                                         std::int64_t n, std::int64_t lda);
@@ -1819,6 +2443,24 @@ ONEMKL_EXPORT std::int64_t getrs_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
     std::int64_t nrhs, std::int64_t lda, std::int64_t ldb);
 template <>
+ONEMKL_EXPORT std::int64_t gesv_scratchpad_size<float>(oneapi::mkl::device libkey,
+                                                       sycl::queue &queue, std::int64_t n,
+                                                       std::int64_t nrhs, std::int64_t lda,
+                                                       std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t gesv_scratchpad_size<double>(oneapi::mkl::device libkey,
+                                                        sycl::queue &queue, std::int64_t n,
+                                                        std::int64_t nrhs, std::int64_t lda,
+                                                        std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t gesv_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+    std::int64_t lda, std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t gesv_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+    std::int64_t lda, std::int64_t ldb);
+template <>
 ONEMKL_EXPORT std::int64_t heevd_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
     std::int64_t n, std::int64_t lda);
@@ -1827,6 +2469,26 @@ ONEMKL_EXPORT std::int64_t heevd_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
     std::int64_t n, std::int64_t lda);
 template <>
+ONEMKL_EXPORT std::int64_t heevr_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t ldz);
+template <>
+ONEMKL_EXPORT std::int64_t heevr_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t ldz);
+template <>
+ONEMKL_EXPORT std::int64_t heevx_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t ldz);
+template <>
+ONEMKL_EXPORT std::int64_t heevx_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+    oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+    std::int64_t ldz);
+template <>
 ONEMKL_EXPORT std::int64_t hegvd_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
     oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda, std::int64_t ldb);
@@ -1969,6 +2631,24 @@ ONEMKL_EXPORT std::int64_t potrs_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
     std::int64_t nrhs, std::int64_t lda, std::int64_t ldb);
 template <>
+ONEMKL_EXPORT std::int64_t posv_scratchpad_size<float>(oneapi::mkl::device libkey,
+                                                       sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                       std::int64_t n, std::int64_t nrhs,
+                                                       std::int64_t lda, std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t posv_scratchpad_size<double>(oneapi::mkl::device libkey,
+                                                        sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                        std::int64_t n, std::int64_t nrhs,
+                                                        std::int64_t lda, std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t posv_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t posv_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t ldb);
+template <>
 ONEMKL_EXPORT std::int64_t potri_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                         sycl::queue &queue, oneapi::mkl::uplo uplo,
                                                         std::int64_t n, std::int64_t lda);
@@ -2009,6 +2689,24 @@ ONEMKL_EXPORT std::int64_t sytrf_scratchpad_size<std::complex<double>>(oneapi::m
                                                                        std::int64_t n,
                                                                        std::int64_t lda);
 template <>
+ONEMKL_EXPORT std::int64_t sysv_scratchpad_size<float>(oneapi::mkl::device libkey,
+                                                       sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                       std::int64_t n, std::int64_t nrhs,
+                                                       std::int64_t lda, std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t sysv_scratchpad_size<double>(oneapi::mkl::device libkey,
+                                                        sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                        std::int64_t n, std::int64_t nrhs,
+                                                        std::int64_t lda, std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t sysv_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t sysv_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t ldb);
+template <>
 ONEMKL_EXPORT std::int64_t syevd_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                         sycl::queue &queue, oneapi::mkl::job jobz,
                                                         oneapi::mkl::uplo uplo, std::int64_t n,
@@ -2019,6 +2717,30 @@ ONEMKL_EXPORT std::int64_t syevd_scratchpad_size<double>(oneapi::mkl::device lib
                                                          oneapi::mkl::uplo uplo, std::int64_t n,
                                                          std::int64_t lda);
 template <>
+ONEMKL_EXPORT std::int64_t syevr_scratchpad_size<float>(oneapi::mkl::device libkey,
+                                                        sycl::queue &queue, oneapi::mkl::job jobz,
+                                                        oneapi::mkl::rangev range,
+                                                        oneapi::mkl::uplo uplo, std::int64_t n,
+                                                        std::int64_t lda, std::int64_t ldz);
+template <>
+ONEMKL_EXPORT std::int64_t syevr_scratchpad_size<double>(oneapi::mkl::device libkey,
+                                                         sycl::queue &queue, oneapi::mkl::job jobz,
+                                                         oneapi::mkl::rangev range,
+                                                         oneapi::mkl::uplo uplo, std::int64_t n,
+                                                         std::int64_t lda, std::int64_t ldz);
+template <>
+ONEMKL_EXPORT std::int64_t syevx_scratchpad_size<float>(oneapi::mkl::device libkey,
+                                                        sycl::queue &queue, oneapi::mkl::job jobz,
+                                                        oneapi::mkl::rangev range,
+                                                        oneapi::mkl::uplo uplo, std::int64_t n,
+                                                        std::int64_t lda, std::int64_t ldz);
+template <>
+ONEMKL_EXPORT std::int64_t syevx_scratchpad_size<double>(oneapi::mkl::device libkey,
+                                                         sycl::queue &queue, oneapi::mkl::job jobz,
+                                                         oneapi::mkl::rangev range,
+                                                         oneapi::mkl::uplo uplo, std::int64_t n,
+                                                         std::int64_t lda, std::int64_t ldz);
+template <>
 ONEMKL_EXPORT std::int64_t sygvd_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                         sycl::queue &queue, std::int64_t itype,
                                                         oneapi::mkl::job jobz,
@@ -2173,6 +2895,56 @@ ONEMKL_EXPORT std::int64_t getrs_batch_scratchpad_size<std::complex<double>>(
     std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_ipiv,
     std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size);
 template <>
+ONEMKL_EXPORT std::int64_t gesv_batch_scratchpad_size<float>(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t gesv_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t gesv_batch_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t gesv_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t gels_batch_scratchpad_size<float>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t gels_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t gels_batch_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t gels_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t heevd_batch_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t heevd_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t batch_size);
+template <>
 ONEMKL_EXPORT std::int64_t geqrf_batch_scratchpad_size<float>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
     std::int64_t lda, std::int64_t stride_a, std::int64_t stride_tau, std::int64_t batch_size);
@@ -2225,6 +2997,36 @@ ONEMKL_EXPORT std::int64_t potrs_batch_scratchpad_size<std::complex<double>>(
     std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
     std::int64_t stride_b, std::int64_t batch_size);
 template <>
+ONEMKL_EXPORT std::int64_t posv_batch_scratchpad_size<float>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t posv_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t posv_batch_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t posv_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t syevd_batch_scratchpad_size<float>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t syevd_batch_scratchpad_size<double>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t batch_size);
+template <>
 ONEMKL_EXPORT std::int64_t orgqr_batch_scratchpad_size<float>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
     std::int64_t lda, std::int64_t stride_a, std::int64_t stride_tau, std::int64_t batch_size);
@@ -2373,6 +3175,24 @@ ONEMKL_EXPORT std::int64_t ungqr_batch_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *m, std::int64_t *n,
     std::int64_t *k, std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes);
 } //namespace detail
+
+// Counters of the process-wide memo of scratchpad size queries.
+struct scratchpad_cache_stats {
+    std::int64_t hits;
+    std::int64_t misses;
+    std::int64_t entries;
+};
+
+// Number of sizes the memo keeps by default; the least recently used sizes are
+// evicted beyond its capacity.
+constexpr std::int64_t default_scratchpad_cache_capacity = 4096;
+
+ONEMKL_EXPORT scratchpad_cache_stats get_scratchpad_cache_stats();
+// Sets the capacity of the memo, 0 disables it.
+ONEMKL_EXPORT void set_scratchpad_cache_capacity(std::int64_t entries);
+// Empties the memo and resets its counters; the capacity is kept.
+ONEMKL_EXPORT void clear_scratchpad_cache();
+
 } //namespace lapack
 } //namespace mkl
 } //namespace oneapi
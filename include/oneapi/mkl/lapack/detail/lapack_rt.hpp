@@ -69,6 +69,70 @@ static inline void gebrd(sycl::queue &queue, std::int64_t m, std::int64_t n,
     detail::gebrd(get_device_id(queue), queue, m, n, a, lda, d, e, tauq, taup, scratchpad,
                   scratchpad_size);
 }
+static inline void gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                        sycl::buffer<float> &b, std::int64_t ldb, sycl::buffer<float> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    detail::gels(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, b, ldb, scratchpad,
+                 scratchpad_size);
+}
+static inline void gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a,
+                        std::int64_t lda, sycl::buffer<double> &b, std::int64_t ldb,
+                        sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    detail::gels(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, b, ldb, scratchpad,
+                 scratchpad_size);
+}
+static inline void gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<float>> &a,
+                        std::int64_t lda, sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                        sycl::buffer<std::complex<float>> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    detail::gels(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, b, ldb, scratchpad,
+                 scratchpad_size);
+}
+static inline void gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
+                        std::int64_t lda, sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                        sycl::buffer<std::complex<double>> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    detail::gels(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, b, ldb, scratchpad,
+                 scratchpad_size);
+}
+static inline void gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                         sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &b,
+                         std::int64_t ldb, sycl::buffer<float> &s, float rcond,
+                         sycl::buffer<std::int64_t> &rank, sycl::buffer<float> &scratchpad,
+                         std::int64_t scratchpad_size) {
+    detail::gelsd(get_device_id(queue), queue, m, n, nrhs, a, lda, b, ldb, s, rcond, rank,
+                  scratchpad, scratchpad_size);
+}
+static inline void gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                         sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b,
+                         std::int64_t ldb, sycl::buffer<double> &s, double rcond,
+                         sycl::buffer<std::int64_t> &rank, sycl::buffer<double> &scratchpad,
+                         std::int64_t scratchpad_size) {
+    detail::gelsd(get_device_id(queue), queue, m, n, nrhs, a, lda, b, ldb, s, rcond, rank,
+                  scratchpad, scratchpad_size);
+}
+static inline void gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                         sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                         sycl::buffer<float> &s, float rcond, sycl::buffer<std::int64_t> &rank,
+                         sycl::buffer<std::complex<float>> &scratchpad,
+                         std::int64_t scratchpad_size) {
+    detail::gelsd(get_device_id(queue), queue, m, n, nrhs, a, lda, b, ldb, s, rcond, rank,
+                  scratchpad, scratchpad_size);
+}
+static inline void gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                         sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                         sycl::buffer<double> &s, double rcond, sycl::buffer<std::int64_t> &rank,
+                         sycl::buffer<std::complex<double>> &scratchpad,
+                         std::int64_t scratchpad_size) {
+    detail::gelsd(get_device_id(queue), queue, m, n, nrhs, a, lda, b, ldb, s, rcond, rank,
+                  scratchpad, scratchpad_size);
+}
 static inline void gerqf(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<float> &a,
                          std::int64_t lda, sycl::buffer<float> &tau,
                          sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
@@ -195,6 +259,36 @@ static inline void getrs(sycl::queue &queue, oneapi::mkl::transpose trans, std::
     detail::getrs(get_device_id(queue), queue, trans, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
                   scratchpad_size);
 }
+static inline void gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                        sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+                        sycl::buffer<float> &b, std::int64_t ldb, sycl::buffer<float> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    detail::gesv(get_device_id(queue), queue, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                 scratchpad_size);
+}
+static inline void gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                        sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+                        sycl::buffer<double> &b, std::int64_t ldb, sycl::buffer<double> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    detail::gesv(get_device_id(queue), queue, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                 scratchpad_size);
+}
+static inline void gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                        sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<float>> &b,
+                        std::int64_t ldb, sycl::buffer<std::complex<float>> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    detail::gesv(get_device_id(queue), queue, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                 scratchpad_size);
+}
+static inline void gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                        sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<double>> &b,
+                        std::int64_t ldb, sycl::buffer<std::complex<double>> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    detail::gesv(get_device_id(queue), queue, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                 scratchpad_size);
+}
 static inline void gesvd(sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt,
                          std::int64_t m, std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
                          sycl::buffer<double> &s, sycl::buffer<double> &u, std::int64_t ldu,
@@ -245,6 +339,42 @@ static inline void heevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl:
     detail::heevd(get_device_id(queue), queue, jobz, uplo, n, a, lda, w, scratchpad,
                   scratchpad_size);
 }
+static inline void heevr(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, sycl::buffer<std::complex<float>> &a, std::int64_t lda, float vl, float vu,
+    std::int64_t il, std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m,
+    sycl::buffer<float> &w, sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+    sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    detail::heevr(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                  m, w, z, ldz, scratchpad, scratchpad_size);
+}
+static inline void heevr(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, sycl::buffer<std::complex<double>> &a, std::int64_t lda, double vl, double vu,
+    std::int64_t il, std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m,
+    sycl::buffer<double> &w, sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    detail::heevr(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                  m, w, z, ldz, scratchpad, scratchpad_size);
+}
+static inline void heevx(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, sycl::buffer<std::complex<float>> &a, std::int64_t lda, float vl, float vu,
+    std::int64_t il, std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m,
+    sycl::buffer<float> &w, sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+    sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    detail::heevx(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                  m, w, z, ldz, scratchpad, scratchpad_size);
+}
+static inline void heevx(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, sycl::buffer<std::complex<double>> &a, std::int64_t lda, double vl, double vu,
+    std::int64_t il, std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m,
+    sycl::buffer<double> &w, sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    detail::heevx(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                  m, w, z, ldz, scratchpad, scratchpad_size);
+}
 static inline void hegvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                          oneapi::mkl::uplo uplo, std::int64_t n,
                          sycl::buffer<std::complex<float>> &a, std::int64_t lda,
@@ -451,6 +581,36 @@ static inline void potrs(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_
     detail::potrs(get_device_id(queue), queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
                   scratchpad_size);
 }
+static inline void posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                        sycl::buffer<float> &b, std::int64_t ldb, sycl::buffer<float> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    detail::posv(get_device_id(queue), queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
+                 scratchpad_size);
+}
+static inline void posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                        sycl::buffer<double> &b, std::int64_t ldb, sycl::buffer<double> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    detail::posv(get_device_id(queue), queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
+                 scratchpad_size);
+}
+static inline void posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                        sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                        sycl::buffer<std::complex<float>> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    detail::posv(get_device_id(queue), queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
+                 scratchpad_size);
+}
+static inline void posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                        sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                        sycl::buffer<std::complex<double>> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    detail::posv(get_device_id(queue), queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
+                 scratchpad_size);
+}
 static inline void syevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
                          std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
                          sycl::buffer<double> &w, sycl::buffer<double> &scratchpad,
@@ -465,6 +625,42 @@ static inline void syevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl:
     detail::syevd(get_device_id(queue), queue, jobz, uplo, n, a, lda, w, scratchpad,
                   scratchpad_size);
 }
+static inline void syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+                         std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu,
+                         float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                         sycl::buffer<float> &z, std::int64_t ldz, sycl::buffer<float> &scratchpad,
+                         std::int64_t scratchpad_size) {
+    detail::syevr(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                  m, w, z, ldz, scratchpad, scratchpad_size);
+}
+static inline void syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
+                         std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu,
+                         double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                         sycl::buffer<double> &z, std::int64_t ldz,
+                         sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    detail::syevr(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                  m, w, z, ldz, scratchpad, scratchpad_size);
+}
+static inline void syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+                         std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu,
+                         float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                         sycl::buffer<float> &z, std::int64_t ldz, sycl::buffer<float> &scratchpad,
+                         std::int64_t scratchpad_size) {
+    detail::syevx(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                  m, w, z, ldz, scratchpad, scratchpad_size);
+}
+static inline void syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
+                         std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu,
+                         double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                         sycl::buffer<double> &z, std::int64_t ldz,
+                         sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    detail::syevx(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+                  m, w, z, ldz, scratchpad, scratchpad_size);
+}
 static inline void sygvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                          oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
                          std::int64_t lda, sycl::buffer<double> &b, std::int64_t ldb,
@@ -520,6 +716,36 @@ static inline void sytrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_
                          std::int64_t scratchpad_size) {
     detail::sytrf(get_device_id(queue), queue, uplo, n, a, lda, ipiv, scratchpad, scratchpad_size);
 }
+static inline void sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<float> &b, std::int64_t ldb,
+                        sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    detail::sysv(get_device_id(queue), queue, uplo, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                 scratchpad_size);
+}
+static inline void sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<double> &b, std::int64_t ldb,
+                        sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    detail::sysv(get_device_id(queue), queue, uplo, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                 scratchpad_size);
+}
+static inline void sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<float>> &b,
+                        std::int64_t ldb, sycl::buffer<std::complex<float>> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    detail::sysv(get_device_id(queue), queue, uplo, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                 scratchpad_size);
+}
+static inline void sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<double>> &b,
+                        std::int64_t ldb, sycl::buffer<std::complex<double>> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    detail::sysv(get_device_id(queue), queue, uplo, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                 scratchpad_size);
+}
 static inline void trtrs(sycl::queue &queue, oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans,
                          oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs,
                          sycl::buffer<std::complex<float>> &a, std::int64_t lda,
@@ -766,6 +992,98 @@ static inline void getrs_batch(sycl::queue &queue, oneapi::mkl::transpose trans,
     detail::getrs_batch(get_device_id(queue), queue, trans, n, nrhs, a, lda, stride_a, ipiv,
                         stride_ipiv, b, ldb, stride_b, batch_size, scratchpad, scratchpad_size);
 }
+static inline void gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                              sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                              sycl::buffer<float> &b, std::int64_t ldb, std::int64_t stride_b,
+                              std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                              std::int64_t scratchpad_size) {
+    detail::gesv_batch(get_device_id(queue), queue, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b,
+                       ldb, stride_b, batch_size, scratchpad, scratchpad_size);
+}
+static inline void gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                              sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                              sycl::buffer<double> &b, std::int64_t ldb, std::int64_t stride_b,
+                              std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                              std::int64_t scratchpad_size) {
+    detail::gesv_batch(get_device_id(queue), queue, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b,
+                       ldb, stride_b, batch_size, scratchpad, scratchpad_size);
+}
+static inline void gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+                              std::int64_t stride_ipiv, sycl::buffer<std::complex<float>> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<std::complex<float>> &scratchpad,
+                              std::int64_t scratchpad_size) {
+    detail::gesv_batch(get_device_id(queue), queue, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b,
+                       ldb, stride_b, batch_size, scratchpad, scratchpad_size);
+}
+static inline void gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+                              std::int64_t stride_ipiv, sycl::buffer<std::complex<double>> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<std::complex<double>> &scratchpad,
+                              std::int64_t scratchpad_size) {
+    detail::gesv_batch(get_device_id(queue), queue, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b,
+                       ldb, stride_b, batch_size, scratchpad, scratchpad_size);
+}
+static inline void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                              std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a,
+                              std::int64_t lda, std::int64_t stride_a, sycl::buffer<float> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    detail::gels_batch(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb,
+                       stride_b, batch_size, scratchpad, scratchpad_size);
+}
+static inline void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                              std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a,
+                              std::int64_t lda, std::int64_t stride_a, sycl::buffer<double> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    detail::gels_batch(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb,
+                       stride_b, batch_size, scratchpad, scratchpad_size);
+}
+static inline void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                              std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<std::complex<float>> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<std::complex<float>> &scratchpad,
+                              std::int64_t scratchpad_size) {
+    detail::gels_batch(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb,
+                       stride_b, batch_size, scratchpad, scratchpad_size);
+}
+static inline void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                              std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<std::complex<double>> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<std::complex<double>> &scratchpad,
+                              std::int64_t scratchpad_size) {
+    detail::gels_batch(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb,
+                       stride_b, batch_size, scratchpad, scratchpad_size);
+}
+static inline void heevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                               std::int64_t n, sycl::buffer<std::complex<float>> &a,
+                               std::int64_t lda, std::int64_t stride_a, sycl::buffer<float> &w,
+                               std::int64_t stride_w, std::int64_t batch_size,
+                               sycl::buffer<std::complex<float>> &scratchpad,
+                               std::int64_t scratchpad_size) {
+    detail::heevd_batch(get_device_id(queue), queue, jobz, uplo, n, a, lda, stride_a, w, stride_w,
+                        batch_size, scratchpad, scratchpad_size);
+}
+static inline void heevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                               std::int64_t n, sycl::buffer<std::complex<double>> &a,
+                               std::int64_t lda, std::int64_t stride_a, sycl::buffer<double> &w,
+                               std::int64_t stride_w, std::int64_t batch_size,
+                               sycl::buffer<std::complex<double>> &scratchpad,
+                               std::int64_t scratchpad_size) {
+    detail::heevd_batch(get_device_id(queue), queue, jobz, uplo, n, a, lda, stride_a, w, stride_w,
+                        batch_size, scratchpad, scratchpad_size);
+}
 static inline void getrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n,
                                sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
                                sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
@@ -882,6 +1200,58 @@ static inline void potrs_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::
     detail::potrs_batch(get_device_id(queue), queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
                         stride_b, batch_size, scratchpad, scratchpad_size);
 }
+static inline void posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<float> &b, std::int64_t ldb,
+                              std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    detail::posv_batch(get_device_id(queue), queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                       stride_b, batch_size, scratchpad, scratchpad_size);
+}
+static inline void posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<double> &b, std::int64_t ldb,
+                              std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    detail::posv_batch(get_device_id(queue), queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                       stride_b, batch_size, scratchpad, scratchpad_size);
+}
+static inline void posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<std::complex<float>> &a,
+                              std::int64_t lda, std::int64_t stride_a,
+                              sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                              std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<std::complex<float>> &scratchpad,
+                              std::int64_t scratchpad_size) {
+    detail::posv_batch(get_device_id(queue), queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                       stride_b, batch_size, scratchpad, scratchpad_size);
+}
+static inline void posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
+                              std::int64_t lda, std::int64_t stride_a,
+                              sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                              std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<std::complex<double>> &scratchpad,
+                              std::int64_t scratchpad_size) {
+    detail::posv_batch(get_device_id(queue), queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                       stride_b, batch_size, scratchpad, scratchpad_size);
+}
+static inline void syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                               std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+                               std::int64_t stride_a, sycl::buffer<float> &w, std::int64_t stride_w,
+                               std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                               std::int64_t scratchpad_size) {
+    detail::syevd_batch(get_device_id(queue), queue, jobz, uplo, n, a, lda, stride_a, w, stride_w,
+                        batch_size, scratchpad, scratchpad_size);
+}
+static inline void syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                               std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+                               std::int64_t stride_a, sycl::buffer<double> &w,
+                               std::int64_t stride_w, std::int64_t batch_size,
+                               sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    detail::syevd_batch(get_device_id(queue), queue, jobz, uplo, n, a, lda, stride_a, w, stride_w,
+                        batch_size, scratchpad, scratchpad_size);
+}
 static inline void ungqr_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
                                sycl::buffer<std::complex<float>> &a, std::int64_t lda,
                                std::int64_t stride_a, sycl::buffer<std::complex<float>> &tau,
@@ -930,6 +1300,72 @@ static inline sycl::event gebrd(sycl::queue &queue, std::int64_t m, std::int64_t
     return detail::gebrd(get_device_id(queue), queue, m, n, a, lda, d, e, tauq, taup, scratchpad,
                          scratchpad_size, dependencies);
 }
+static inline sycl::event gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                               std::int64_t n, std::int64_t nrhs, float *a, std::int64_t lda,
+                               float *b, std::int64_t ldb, float *scratchpad,
+                               std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::gels(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, b, ldb, scratchpad,
+                        scratchpad_size, dependencies);
+}
+static inline sycl::event gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                               std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda,
+                               double *b, std::int64_t ldb, double *scratchpad,
+                               std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::gels(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, b, ldb, scratchpad,
+                        scratchpad_size, dependencies);
+}
+static inline sycl::event gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                               std::int64_t n, std::int64_t nrhs, std::complex<float> *a,
+                               std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
+                               std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::gels(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, b, ldb, scratchpad,
+                        scratchpad_size, dependencies);
+}
+static inline sycl::event gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                               std::int64_t n, std::int64_t nrhs, std::complex<double> *a,
+                               std::int64_t lda, std::complex<double> *b, std::int64_t ldb,
+                               std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::gels(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, b, ldb, scratchpad,
+                        scratchpad_size, dependencies);
+}
+static inline sycl::event gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t nrhs, float *a, std::int64_t lda, float *b,
+                                std::int64_t ldb, float *s, float rcond, std::int64_t *rank,
+                                float *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::gelsd(get_device_id(queue), queue, m, n, nrhs, a, lda, b, ldb, s, rcond, rank,
+                         scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t nrhs, double *a, std::int64_t lda, double *b,
+                                std::int64_t ldb, double *s, double rcond, std::int64_t *rank,
+                                double *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::gelsd(get_device_id(queue), queue, m, n, nrhs, a, lda, b, ldb, s, rcond, rank,
+                         scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                                std::complex<float> *b, std::int64_t ldb, float *s, float rcond,
+                                std::int64_t *rank, std::complex<float> *scratchpad,
+                                std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::gelsd(get_device_id(queue), queue, m, n, nrhs, a, lda, b, ldb, s, rcond, rank,
+                         scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                                std::complex<double> *b, std::int64_t ldb, double *s, double rcond,
+                                std::int64_t *rank, std::complex<double> *scratchpad,
+                                std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::gelsd(get_device_id(queue), queue, m, n, nrhs, a, lda, b, ldb, s, rcond, rank,
+                         scratchpad, scratchpad_size, dependencies);
+}
 static inline sycl::event gerqf(sycl::queue &queue, std::int64_t m, std::int64_t n, float *a,
                                 std::int64_t lda, float *tau, float *scratchpad,
                                 std::int64_t scratchpad_size,
@@ -1075,6 +1511,36 @@ static inline sycl::event getrs(sycl::queue &queue, oneapi::mkl::transpose trans
     return detail::getrs(get_device_id(queue), queue, trans, n, nrhs, a, lda, ipiv, b, ldb,
                          scratchpad, scratchpad_size, dependencies);
 }
+static inline sycl::event gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, float *a,
+                               std::int64_t lda, std::int64_t *ipiv, float *b, std::int64_t ldb,
+                               float *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::gesv(get_device_id(queue), queue, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                        scratchpad_size, dependencies);
+}
+static inline sycl::event gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, double *a,
+                               std::int64_t lda, std::int64_t *ipiv, double *b, std::int64_t ldb,
+                               double *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::gesv(get_device_id(queue), queue, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                        scratchpad_size, dependencies);
+}
+static inline sycl::event gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                               std::complex<float> *a, std::int64_t lda, std::int64_t *ipiv,
+                               std::complex<float> *b, std::int64_t ldb,
+                               std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::gesv(get_device_id(queue), queue, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                        scratchpad_size, dependencies);
+}
+static inline sycl::event gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                               std::complex<double> *a, std::int64_t lda, std::int64_t *ipiv,
+                               std::complex<double> *b, std::int64_t ldb,
+                               std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::gesv(get_device_id(queue), queue, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                        scratchpad_size, dependencies);
+}
 static inline sycl::event gesvd(sycl::queue &queue, oneapi::mkl::jobsvd jobu,
                                 oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n,
                                 double *a, std::int64_t lda, double *s, double *u, std::int64_t ldu,
@@ -1127,6 +1593,46 @@ static inline sycl::event heevd(sycl::queue &queue, oneapi::mkl::job jobz, oneap
     return detail::heevd(get_device_id(queue), queue, jobz, uplo, n, a, lda, w, scratchpad,
                          scratchpad_size, dependencies);
 }
+static inline sycl::event heevr(sycl::queue &queue, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<float> *a, std::int64_t lda, float vl, float vu,
+                                std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m,
+                                float *w, std::complex<float> *z, std::int64_t ldz,
+                                std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::heevr(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                         abstol, m, w, z, ldz, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event heevr(sycl::queue &queue, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<double> *a, std::int64_t lda, double vl, double vu,
+                                std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+                                double *w, std::complex<double> *z, std::int64_t ldz,
+                                std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::heevr(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                         abstol, m, w, z, ldz, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event heevx(sycl::queue &queue, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<float> *a, std::int64_t lda, float vl, float vu,
+                                std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m,
+                                float *w, std::complex<float> *z, std::int64_t ldz,
+                                std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::heevx(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                         abstol, m, w, z, ldz, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event heevx(sycl::queue &queue, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<double> *a, std::int64_t lda, double vl, double vu,
+                                std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+                                double *w, std::complex<double> *z, std::int64_t ldz,
+                                std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::heevx(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                         abstol, m, w, z, ldz, scratchpad, scratchpad_size, dependencies);
+}
 static inline sycl::event hegvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                                 oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a,
                                 std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
@@ -1351,6 +1857,36 @@ static inline sycl::event potrs(sycl::queue &queue, oneapi::mkl::uplo uplo, std:
     return detail::potrs(get_device_id(queue), queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
                          scratchpad_size, dependencies);
 }
+static inline sycl::event posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, float *a, std::int64_t lda, float *b,
+                               std::int64_t ldb, float *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::posv(get_device_id(queue), queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
+                        scratchpad_size, dependencies);
+}
+static inline sycl::event posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, double *a, std::int64_t lda, double *b,
+                               std::int64_t ldb, double *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::posv(get_device_id(queue), queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
+                        scratchpad_size, dependencies);
+}
+static inline sycl::event posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                               std::complex<float> *b, std::int64_t ldb,
+                               std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::posv(get_device_id(queue), queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
+                        scratchpad_size, dependencies);
+}
+static inline sycl::event posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                               std::complex<double> *b, std::int64_t ldb,
+                               std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::posv(get_device_id(queue), queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
+                        scratchpad_size, dependencies);
+}
 static inline sycl::event syevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
                                 std::int64_t n, double *a, std::int64_t lda, double *w,
                                 double *scratchpad, std::int64_t scratchpad_size,
@@ -1365,6 +1901,44 @@ static inline sycl::event syevd(sycl::queue &queue, oneapi::mkl::job jobz, oneap
     return detail::syevd(get_device_id(queue), queue, jobz, uplo, n, a, lda, w, scratchpad,
                          scratchpad_size, dependencies);
 }
+static inline sycl::event syevr(sycl::queue &queue, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                float *a, std::int64_t lda, float vl, float vu, std::int64_t il,
+                                std::int64_t iu, float abstol, std::int64_t *m, float *w, float *z,
+                                std::int64_t ldz, float *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::syevr(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                         abstol, m, w, z, ldz, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event syevr(sycl::queue &queue, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                double *a, std::int64_t lda, double vl, double vu, std::int64_t il,
+                                std::int64_t iu, double abstol, std::int64_t *m, double *w,
+                                double *z, std::int64_t ldz, double *scratchpad,
+                                std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::syevr(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                         abstol, m, w, z, ldz, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event syevx(sycl::queue &queue, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                float *a, std::int64_t lda, float vl, float vu, std::int64_t il,
+                                std::int64_t iu, float abstol, std::int64_t *m, float *w, float *z,
+                                std::int64_t ldz, float *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::syevx(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                         abstol, m, w, z, ldz, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event syevx(sycl::queue &queue, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                double *a, std::int64_t lda, double vl, double vu, std::int64_t il,
+                                std::int64_t iu, double abstol, std::int64_t *m, double *w,
+                                double *z, std::int64_t ldz, double *scratchpad,
+                                std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::syevx(get_device_id(queue), queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                         abstol, m, w, z, ldz, scratchpad, scratchpad_size, dependencies);
+}
 static inline sycl::event sygvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                                 oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda,
                                 double *b, std::int64_t ldb, double *w, double *scratchpad,
@@ -1423,6 +1997,38 @@ static inline sycl::event sytrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std:
     return detail::sytrf(get_device_id(queue), queue, uplo, n, a, lda, ipiv, scratchpad,
                          scratchpad_size, dependencies);
 }
+static inline sycl::event sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, float *a, std::int64_t lda, std::int64_t *ipiv,
+                               float *b, std::int64_t ldb, float *scratchpad,
+                               std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::sysv(get_device_id(queue), queue, uplo, n, nrhs, a, lda, ipiv, b, ldb,
+                        scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t *ipiv,
+                               double *b, std::int64_t ldb, double *scratchpad,
+                               std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::sysv(get_device_id(queue), queue, uplo, n, nrhs, a, lda, ipiv, b, ldb,
+                        scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                               std::int64_t *ipiv, std::complex<float> *b, std::int64_t ldb,
+                               std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::sysv(get_device_id(queue), queue, uplo, n, nrhs, a, lda, ipiv, b, ldb,
+                        scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                               std::int64_t *ipiv, std::complex<double> *b, std::int64_t ldb,
+                               std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::sysv(get_device_id(queue), queue, uplo, n, nrhs, a, lda, ipiv, b, ldb,
+                        scratchpad, scratchpad_size, dependencies);
+}
 static inline sycl::event trtrs(sycl::queue &queue, oneapi::mkl::uplo uplo,
                                 oneapi::mkl::transpose trans, oneapi::mkl::diag diag,
                                 std::int64_t n, std::int64_t nrhs, std::complex<float> *a,
@@ -1812,6 +2418,94 @@ static inline sycl::event getrs_batch(sycl::queue &queue, oneapi::mkl::transpose
                                stride_ipiv, b, ldb, stride_b, batch_size, scratchpad,
                                scratchpad_size, dependencies);
 }
+static inline sycl::event gesv_batch(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, float *a, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv, float *b, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size, float *scratchpad, std::int64_t scratchpad_size,
+    const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::gesv_batch(get_device_id(queue), queue, n, nrhs, a, lda, stride_a, ipiv,
+                              stride_ipiv, b, ldb, stride_b, batch_size, scratchpad,
+                              scratchpad_size, dependencies);
+}
+static inline sycl::event gesv_batch(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv, double *b,
+    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, double *scratchpad,
+    std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::gesv_batch(get_device_id(queue), queue, n, nrhs, a, lda, stride_a, ipiv,
+                              stride_ipiv, b, ldb, stride_b, batch_size, scratchpad,
+                              scratchpad_size, dependencies);
+}
+static inline sycl::event gesv_batch(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv, std::complex<float> *b,
+    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+    std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::gesv_batch(get_device_id(queue), queue, n, nrhs, a, lda, stride_a, ipiv,
+                              stride_ipiv, b, ldb, stride_b, batch_size, scratchpad,
+                              scratchpad_size, dependencies);
+}
+static inline sycl::event gesv_batch(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::complex<double> *a,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv,
+    std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+    std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::gesv_batch(get_device_id(queue), queue, n, nrhs, a, lda, stride_a, ipiv,
+                              stride_ipiv, b, ldb, stride_b, batch_size, scratchpad,
+                              scratchpad_size, dependencies);
+}
+static inline sycl::event gels_batch(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, float *a, std::int64_t lda, std::int64_t stride_a, float *b,
+    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, float *scratchpad,
+    std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::gels_batch(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, stride_a, b,
+                              ldb, stride_b, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event gels_batch(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t stride_a, double *b,
+    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, double *scratchpad,
+    std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::gels_batch(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, stride_a, b,
+                              ldb, stride_b, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event gels_batch(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::complex<float> *a, std::int64_t lda, std::int64_t stride_a,
+    std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+    std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::gels_batch(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, stride_a, b,
+                              ldb, stride_b, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event gels_batch(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::complex<double> *a, std::int64_t lda, std::int64_t stride_a,
+    std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+    std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::gels_batch(get_device_id(queue), queue, trans, m, n, nrhs, a, lda, stride_a, b,
+                              ldb, stride_b, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event heevd_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::complex<float> *a, std::int64_t lda, std::int64_t stride_a, float *w,
+    std::int64_t stride_w, std::int64_t batch_size, std::complex<float> *scratchpad,
+    std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::heevd_batch(get_device_id(queue), queue, jobz, uplo, n, a, lda, stride_a, w,
+                               stride_w, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event heevd_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::complex<double> *a, std::int64_t lda, std::int64_t stride_a, double *w,
+    std::int64_t stride_w, std::int64_t batch_size, std::complex<double> *scratchpad,
+    std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::heevd_batch(get_device_id(queue), queue, jobz, uplo, n, a, lda, stride_a, w,
+                               stride_w, batch_size, scratchpad, scratchpad_size, dependencies);
+}
 static inline sycl::event getrs_batch(sycl::queue &queue, oneapi::mkl::transpose *trans,
                                       std::int64_t *n, std::int64_t *nrhs, float **a,
                                       std::int64_t *lda, std::int64_t **ipiv, float **b,
@@ -1991,6 +2685,62 @@ static inline sycl::event potrs_batch(sycl::queue &queue, oneapi::mkl::uplo uplo
     return detail::potrs_batch(get_device_id(queue), queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
                                stride_b, batch_size, scratchpad, scratchpad_size, dependencies);
 }
+static inline sycl::event posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                     std::int64_t nrhs, float *a, std::int64_t lda,
+                                     std::int64_t stride_a, float *b, std::int64_t ldb,
+                                     std::int64_t stride_b, std::int64_t batch_size,
+                                     float *scratchpad, std::int64_t scratchpad_size,
+                                     const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::posv_batch(get_device_id(queue), queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                              stride_b, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                     std::int64_t nrhs, double *a, std::int64_t lda,
+                                     std::int64_t stride_a, double *b, std::int64_t ldb,
+                                     std::int64_t stride_b, std::int64_t batch_size,
+                                     double *scratchpad, std::int64_t scratchpad_size,
+                                     const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::posv_batch(get_device_id(queue), queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                              stride_b, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                     std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                                     std::int64_t stride_a, std::complex<float> *b,
+                                     std::int64_t ldb, std::int64_t stride_b,
+                                     std::int64_t batch_size, std::complex<float> *scratchpad,
+                                     std::int64_t scratchpad_size,
+                                     const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::posv_batch(get_device_id(queue), queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                              stride_b, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                     std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                                     std::int64_t stride_a, std::complex<double> *b,
+                                     std::int64_t ldb, std::int64_t stride_b,
+                                     std::int64_t batch_size, std::complex<double> *scratchpad,
+                                     std::int64_t scratchpad_size,
+                                     const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::posv_batch(get_device_id(queue), queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                              stride_b, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz,
+                                      oneapi::mkl::uplo uplo, std::int64_t n, float *a,
+                                      std::int64_t lda, std::int64_t stride_a, float *w,
+                                      std::int64_t stride_w, std::int64_t batch_size,
+                                      float *scratchpad, std::int64_t scratchpad_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::syevd_batch(get_device_id(queue), queue, jobz, uplo, n, a, lda, stride_a, w,
+                               stride_w, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz,
+                                      oneapi::mkl::uplo uplo, std::int64_t n, double *a,
+                                      std::int64_t lda, std::int64_t stride_a, double *w,
+                                      std::int64_t stride_w, std::int64_t batch_size,
+                                      double *scratchpad, std::int64_t scratchpad_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return detail::syevd_batch(get_device_id(queue), queue, jobz, uplo, n, a, lda, stride_a, w,
+                               stride_w, batch_size, scratchpad, scratchpad_size, dependencies);
+}
 static inline sycl::event potrs_batch(sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
                                       std::int64_t *nrhs, float **a, std::int64_t *lda, float **b,
                                       std::int64_t *ldb, std::int64_t group_count,
@@ -2071,6 +2821,19 @@ std::int64_t gebrd_scratchpad_size(sycl::queue &queue, std::int64_t m, std::int6
                                    std::int64_t lda) {
     return detail::gebrd_scratchpad_size<fp_type>(get_device_id(queue), queue, m, n, lda);
 }
+template <typename fp_type, internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gels_scratchpad_size(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                                  std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                  std::int64_t ldb) {
+    return detail::gels_scratchpad_size<fp_type>(get_device_id(queue), queue, trans, m, n, nrhs,
+                                                 lda, ldb);
+}
+template <typename fp_type, internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gelsd_scratchpad_size(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                   std::int64_t nrhs, std::int64_t lda, std::int64_t ldb) {
+    return detail::gelsd_scratchpad_size<fp_type>(get_device_id(queue), queue, m, n, nrhs, lda,
+                                                  ldb);
+}
 template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
 std::int64_t gerqf_scratchpad_size(sycl::queue &queue, std::int64_t m, std::int64_t n,
                                    std::int64_t lda) {
@@ -2110,12 +2873,31 @@ std::int64_t getrs_scratchpad_size(sycl::queue &queue, oneapi::mkl::transpose tr
     return detail::getrs_scratchpad_size<fp_type>(get_device_id(queue), queue, trans, n, nrhs, lda,
                                                   ldb);
 }
+template <typename fp_type, internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gesv_scratchpad_size(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                                  std::int64_t lda, std::int64_t ldb) {
+    return detail::gesv_scratchpad_size<fp_type>(get_device_id(queue), queue, n, nrhs, lda, ldb);
+}
 template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullptr>
 std::int64_t heevd_scratchpad_size(sycl::queue &queue, oneapi::mkl::job jobz,
                                    oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda) {
     return detail::heevd_scratchpad_size<fp_type>(get_device_id(queue), queue, jobz, uplo, n, lda);
 }
 template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevr_scratchpad_size(sycl::queue &queue, oneapi::mkl::job jobz,
+                                   oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                   std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    return detail::heevr_scratchpad_size<fp_type>(get_device_id(queue), queue, jobz, range, uplo, n,
+                                                  lda, ldz);
+}
+template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevx_scratchpad_size(sycl::queue &queue, oneapi::mkl::job jobz,
+                                   oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                   std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    return detail::heevx_scratchpad_size<fp_type>(get_device_id(queue), queue, jobz, range, uplo, n,
+                                                  lda, ldz);
+}
+template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullptr>
 std::int64_t hegvd_scratchpad_size(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                                    oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
                                    std::int64_t ldb) {
@@ -2185,6 +2967,12 @@ std::int64_t potrs_scratchpad_size(sycl::queue &queue, oneapi::mkl::uplo uplo, s
     return detail::potrs_scratchpad_size<fp_type>(get_device_id(queue), queue, uplo, n, nrhs, lda,
                                                   ldb);
 }
+template <typename fp_type, internal::is_floating_point<fp_type> = nullptr>
+std::int64_t posv_scratchpad_size(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                  std::int64_t nrhs, std::int64_t lda, std::int64_t ldb) {
+    return detail::posv_scratchpad_size<fp_type>(get_device_id(queue), queue, uplo, n, nrhs, lda,
+                                                 ldb);
+}
 template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
 std::int64_t potri_scratchpad_size(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
                                    std::int64_t lda) {
@@ -2195,12 +2983,32 @@ std::int64_t sytrf_scratchpad_size(sycl::queue &queue, oneapi::mkl::uplo uplo, s
                                    std::int64_t lda) {
     return detail::sytrf_scratchpad_size<fp_type>(get_device_id(queue), queue, uplo, n, lda);
 }
+template <typename fp_type, internal::is_floating_point<fp_type> = nullptr>
+std::int64_t sysv_scratchpad_size(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                  std::int64_t nrhs, std::int64_t lda, std::int64_t ldb) {
+    return detail::sysv_scratchpad_size<fp_type>(get_device_id(queue), queue, uplo, n, nrhs, lda,
+                                                 ldb);
+}
 template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
 std::int64_t syevd_scratchpad_size(sycl::queue &queue, oneapi::mkl::job jobz,
                                    oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda) {
     return detail::syevd_scratchpad_size<fp_type>(get_device_id(queue), queue, jobz, uplo, n, lda);
 }
 template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevr_scratchpad_size(sycl::queue &queue, oneapi::mkl::job jobz,
+                                   oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                   std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    return detail::syevr_scratchpad_size<fp_type>(get_device_id(queue), queue, jobz, range, uplo, n,
+                                                  lda, ldz);
+}
+template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevx_scratchpad_size(sycl::queue &queue, oneapi::mkl::job jobz,
+                                   oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                   std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    return detail::syevx_scratchpad_size<fp_type>(get_device_id(queue), queue, jobz, range, uplo, n,
+                                                  lda, ldz);
+}
+template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
 std::int64_t sygvd_scratchpad_size(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                                    oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
                                    std::int64_t ldb) {
@@ -2285,6 +3093,32 @@ std::int64_t getrs_batch_scratchpad_size(sycl::queue &queue, oneapi::mkl::transp
                                                         lda, stride_a, stride_ipiv, ldb, stride_b,
                                                         batch_size);
 }
+template <typename fp_type, internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gesv_batch_scratchpad_size(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                                        std::int64_t lda, std::int64_t stride_a,
+                                        std::int64_t stride_ipiv, std::int64_t ldb,
+                                        std::int64_t stride_b, std::int64_t batch_size) {
+    return detail::gesv_batch_scratchpad_size<fp_type>(get_device_id(queue), queue, n, nrhs, lda,
+                                                       stride_a, stride_ipiv, ldb, stride_b,
+                                                       batch_size);
+}
+template <typename fp_type, internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gels_batch_scratchpad_size(sycl::queue &queue, oneapi::mkl::transpose trans,
+                                        std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                                        std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+                                        std::int64_t stride_b, std::int64_t batch_size) {
+    return detail::gels_batch_scratchpad_size<fp_type>(get_device_id(queue), queue, trans, m, n,
+                                                       nrhs, lda, stride_a, ldb, stride_b,
+                                                       batch_size);
+}
+template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevd_batch_scratchpad_size(sycl::queue &queue, oneapi::mkl::job jobz,
+                                         oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                         std::int64_t stride_a, std::int64_t stride_w,
+                                         std::int64_t batch_size) {
+    return detail::heevd_batch_scratchpad_size<fp_type>(get_device_id(queue), queue, jobz, uplo, n,
+                                                        lda, stride_a, stride_w, batch_size);
+}
 template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
 std::int64_t geqrf_batch_scratchpad_size(sycl::queue &queue, std::int64_t m, std::int64_t n,
                                          std::int64_t lda, std::int64_t stride_a,
@@ -2307,6 +3141,22 @@ std::int64_t potrs_batch_scratchpad_size(sycl::queue &queue, oneapi::mkl::uplo u
     return detail::potrs_batch_scratchpad_size<fp_type>(get_device_id(queue), queue, uplo, n, nrhs,
                                                         lda, stride_a, ldb, stride_b, batch_size);
 }
+template <typename fp_type, internal::is_floating_point<fp_type> = nullptr>
+std::int64_t posv_batch_scratchpad_size(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                        std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a,
+                                        std::int64_t ldb, std::int64_t stride_b,
+                                        std::int64_t batch_size) {
+    return detail::posv_batch_scratchpad_size<fp_type>(get_device_id(queue), queue, uplo, n, nrhs,
+                                                       lda, stride_a, ldb, stride_b, batch_size);
+}
+template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevd_batch_scratchpad_size(sycl::queue &queue, oneapi::mkl::job jobz,
+                                         oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                         std::int64_t stride_a, std::int64_t stride_w,
+                                         std::int64_t batch_size) {
+    return detail::syevd_batch_scratchpad_size<fp_type>(get_device_id(queue), queue, jobz, uplo, n,
+                                                        lda, stride_a, stride_w, batch_size);
+}
 template <typename fp_type,
           oneapi::mkl::lapack::internal::is_real_floating_point<fp_type> = nullptr>
 std::int64_t orgqr_batch_scratchpad_size(sycl::queue &queue, std::int64_t m, std::int64_t n,
@@ -0,0 +1,533 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <exception>
+#include <initializer_list>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl/types.hpp"
+#include "oneapi/mkl/blas.hpp"
+#include "oneapi/mkl/lapack/types.hpp"
+#include "oneapi/mkl/lapack/exceptions.hpp"
+#include "oneapi/mkl/lapack/detail/lapack_rt.hpp"
+#include "oneapi/mkl/lapack/detail/lapack_rt_workspace.hpp"
+#include "oneapi/mkl/lapack/detail/workspace_pool.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace lapack {
+namespace detail {
+
+// Mixed-precision solvers in the style of LAPACK ?sgesv/?sposv: A is factored
+// in single precision and the solution is refined with double-precision
+// residuals. The returned iteration count follows LAPACK:
+//   >= 0   refinement converged after that many iterations,
+//   -2     A or B does not fit in single precision,
+//   -3     the single-precision factorization failed,
+//   -31    refinement did not converge within 30 iterations.
+// In every negative case X is recomputed by a full double-precision solve,
+// which overwrites A with its factorization.
+
+template <typename T>
+struct mixed_precision;
+template <>
+struct mixed_precision<double> {
+    using low = float;
+};
+template <>
+struct mixed_precision<std::complex<double>> {
+    using low = std::complex<float>;
+};
+
+template <typename T>
+using mixed_low_t = typename mixed_precision<T>::low;
+
+constexpr std::int64_t mixed_max_iterations = 30;
+
+template <typename From, typename To>
+class mixed_convert_kernel;
+template <typename T>
+class mixed_accumulate_kernel;
+template <typename T>
+class mixed_row_norm_kernel;
+template <typename T>
+class mixed_diagonal_kernel;
+
+inline double mixed_abs(double value) {
+    return sycl::fabs(value);
+}
+inline double mixed_abs(std::complex<double> value) {
+    return sycl::fabs(value.real()) + sycl::fabs(value.imag());
+}
+inline double mixed_real(double value) {
+    return value;
+}
+inline double mixed_real(std::complex<double> value) {
+    return value.real();
+}
+
+// dst(0:m, 0:n) = src(0:m, 0:n), converting the element type.
+template <typename From, typename To>
+sycl::event mixed_convert(sycl::queue &queue, std::int64_t m, std::int64_t n, const From *src,
+                          std::int64_t ld_src, To *dst, std::int64_t ld_dst,
+                          const sycl::vector_class<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        cgh.parallel_for<mixed_convert_kernel<From, To>>(
+            sycl::range<2>(n, m), [=](sycl::item<2> it) {
+                const std::int64_t col = it.get_id(0), row = it.get_id(1);
+                dst[row + col * ld_dst] = static_cast<To>(src[row + col * ld_src]);
+            });
+    });
+}
+
+// x(0:n, 0:nrhs) += dx(0:n, 0:nrhs), with dx in single precision.
+template <typename T>
+sycl::event mixed_accumulate(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                             const mixed_low_t<T> *dx, std::int64_t lddx, T *x, std::int64_t ldx,
+                             const sycl::vector_class<sycl::event> &dependencies) {
+    return queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        cgh.parallel_for<mixed_accumulate_kernel<T>>(
+            sycl::range<2>(nrhs, n), [=](sycl::item<2> it) {
+                const std::int64_t col = it.get_id(0), row = it.get_id(1);
+                x[row + col * ldx] += static_cast<T>(dx[row + col * lddx]);
+            });
+    });
+}
+
+// Infinity norm of A. With symmetric set only the uplo triangle is read.
+template <typename T>
+double mixed_norm_inf(sycl::queue &queue, std::int64_t n, const T *a, std::int64_t lda,
+                      bool symmetric, oneapi::mkl::uplo uplo, double *row_norms,
+                      const sycl::vector_class<sycl::event> &dependencies) {
+    const bool upper = uplo == oneapi::mkl::uplo::upper;
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        cgh.parallel_for<mixed_row_norm_kernel<T>>(sycl::range<1>(n), [=](sycl::item<1> it) {
+            const std::int64_t row = it.get_id(0);
+            double sum = 0.0;
+            for (std::int64_t col = 0; col < n; col++) {
+                const bool stored = !symmetric || (upper ? row <= col : row >= col);
+                sum += mixed_abs(stored ? a[row + col * lda] : a[col + row * lda]);
+            }
+            row_norms[row] = sum;
+        });
+    });
+    std::vector<double> host(n);
+    queue.memcpy(host.data(), row_norms, n * sizeof(double), done).wait_and_throw();
+    return *std::max_element(host.begin(), host.end());
+}
+
+// Largest magnitude in each column of the m x n matrix a, computed on the host.
+template <typename T>
+std::vector<double> mixed_column_max(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                     const T *a, std::int64_t lda,
+                                     const sycl::vector_class<sycl::event> &dependencies) {
+    std::vector<T> host(lda * (n - 1) + m);
+    queue
+        .submit([&](sycl::handler &cgh) {
+            int64_t num_events = dependencies.size();
+            for (int64_t i = 0; i < num_events; i++) {
+                cgh.depends_on(dependencies[i]);
+            }
+            cgh.memcpy(host.data(), a, host.size() * sizeof(T));
+        })
+        .wait_and_throw();
+    std::vector<double> result(n, 0.0);
+    for (std::int64_t col = 0; col < n; col++)
+        for (std::int64_t row = 0; row < m; row++)
+            result[col] = std::max(result[col], mixed_abs(host[row + col * lda]));
+    return result;
+}
+
+inline sycl::event mixed_hermitian_multiply(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                            std::int64_t n, std::int64_t nrhs, const double *a,
+                                            std::int64_t lda, const double *x, std::int64_t ldx,
+                                            double *r, std::int64_t ldr,
+                                            const sycl::vector_class<sycl::event> &dependencies) {
+    return oneapi::mkl::blas::column_major::symm(queue, oneapi::mkl::side::left, uplo, n, nrhs,
+                                                 -1.0, a, lda, x, ldx, 1.0, r, ldr, dependencies);
+}
+inline sycl::event mixed_hermitian_multiply(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                            std::int64_t n, std::int64_t nrhs,
+                                            const std::complex<double> *a, std::int64_t lda,
+                                            const std::complex<double> *x, std::int64_t ldx,
+                                            std::complex<double> *r, std::int64_t ldr,
+                                            const sycl::vector_class<sycl::event> &dependencies) {
+    return oneapi::mkl::blas::column_major::hemm(queue, oneapi::mkl::side::left, uplo, n, nrhs,
+                                                 -1.0, a, lda, x, ldx, 1.0, r, ldr, dependencies);
+}
+
+// Factors the single-precision copy of A with factor(queue, sa, deps) and
+// returns whether the factor is nonsingular. Backends that run as host tasks
+// raise computation_error asynchronously, so the factorization runs on a queue
+// of its own whose handler records it; backends that only report the failure
+// through info are caught by checking the diagonal of the factor on the host:
+// it must be finite and nonzero, and positive for a Cholesky factor.
+template <typename T, typename Factor>
+bool mixed_factor(sycl::queue &queue, std::int64_t n, mixed_low_t<T> *sa, bool symmetric,
+                  double *diagonal, Factor factor,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    bool failed = false;
+    std::exception_ptr error;
+    sycl::queue own(queue.get_context(), queue.get_device(), [&](sycl::exception_list list) {
+        for (auto &e : list) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (oneapi::mkl::lapack::computation_error &) {
+                failed = true;
+            }
+            catch (...) {
+                if (!error)
+                    error = std::current_exception();
+            }
+        }
+    });
+    sycl::event factored;
+    try {
+        factored = factor(own, sa, dependencies);
+        factored.wait_and_throw();
+    }
+    catch (oneapi::mkl::lapack::computation_error &) {
+        failed = true;
+    }
+    if (error)
+        std::rethrow_exception(error);
+    if (failed)
+        return false;
+
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(factored);
+        cgh.parallel_for<mixed_diagonal_kernel<T>>(sycl::range<1>(n), [=](sycl::item<1> it) {
+            const std::int64_t i = it.get_id(0);
+            const T value = static_cast<T>(sa[i + i * n]);
+            diagonal[i] = symmetric ? mixed_real(value) : mixed_abs(value);
+        });
+    });
+    std::vector<double> host(n);
+    queue.memcpy(host.data(), diagonal, n * sizeof(double), done).wait_and_throw();
+    return std::all_of(host.begin(), host.end(),
+                       [](double value) { return std::isfinite(value) && value > 0.0; });
+}
+
+// Shared refinement loop. factor(queue, sa, deps) factors the single-precision
+// copy of A in place on the given queue, solve(sa, sx, deps) overwrites sx with inv(A) * sx,
+// residual(r, deps) computes r = B - A * X in double precision and
+// fallback(deps) solves the system in double precision into X.
+template <typename T, typename Factor, typename Solve, typename Residual, typename Fallback>
+std::int64_t mixed_refine(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, const T *a,
+                          std::int64_t lda, bool symmetric, oneapi::mkl::uplo uplo, const T *b,
+                          std::int64_t ldb, T *x, std::int64_t ldx,
+                          const sycl::vector_class<sycl::event> &dependencies, Factor factor,
+                          Solve solve, Residual residual, Fallback fallback) {
+    using low = mixed_low_t<T>;
+    if (n == 0 || nrhs == 0) {
+        sycl::event::wait_and_throw(dependencies);
+        return 0;
+    }
+
+    workspace_usm<low> sa(queue, n * n, dependencies);
+    workspace_usm<low> sx(queue, n * nrhs, sa.dependencies());
+    workspace_usm<T> r(queue, n * nrhs, sx.dependencies());
+    workspace_usm<double> row_norms(queue, n, r.dependencies());
+    const sycl::vector_class<sycl::event> &deps = row_norms.dependencies();
+
+    const double anrm = mixed_norm_inf(queue, n, a, lda, symmetric, uplo, row_norms.get(), deps);
+    const double cte = anrm * std::numeric_limits<double>::epsilon() / 2 * std::sqrt(double(n));
+    const double limit = std::numeric_limits<float>::max();
+
+    std::int64_t iter = -2;
+    sycl::event done;
+    const auto bmax = mixed_column_max(queue, n, nrhs, b, ldb, deps);
+    if (anrm <= limit && *std::max_element(bmax.begin(), bmax.end()) <= limit) {
+        auto converted_a = mixed_convert(queue, n, n, a, lda, sa.get(), n, deps);
+        auto converted_b = mixed_convert(queue, n, nrhs, b, ldb, sx.get(), n, deps);
+        iter = mixed_factor<T>(queue, n, sa.get(), symmetric, row_norms.get(), factor,
+                               { converted_a })
+                   ? 0
+                   : -3;
+        if (iter == 0) {
+            done = solve(sa.get(), sx.get(), { converted_b });
+            done = mixed_convert(queue, n, nrhs, sx.get(), n, x, ldx, { done });
+            done = residual(r.get(), { done });
+        }
+        for (; iter >= 0; iter++) {
+            const auto xmax = mixed_column_max(queue, n, nrhs, x, ldx, { done });
+            const auto rmax = mixed_column_max(queue, n, nrhs, r.get(), n, { done });
+            bool converged = true;
+            for (std::int64_t col = 0; col < nrhs; col++)
+                converged = converged && rmax[col] <= xmax[col] * cte;
+            if (converged)
+                break;
+            if (iter == mixed_max_iterations) {
+                iter = -mixed_max_iterations - 1;
+                break;
+            }
+            done = mixed_convert(queue, n, nrhs, r.get(), n, sx.get(), n, { done });
+            done = solve(sa.get(), sx.get(), { done });
+            done = mixed_accumulate<T>(queue, n, nrhs, sx.get(), n, x, ldx, { done });
+            done = residual(r.get(), { done });
+        }
+    }
+    if (iter < 0) {
+        done = fallback({ done });
+    }
+    done.wait_and_throw();
+
+    sa.release(done);
+    sx.release(done);
+    r.release(done);
+    row_norms.release(done);
+    return iter;
+}
+
+template <typename T>
+std::int64_t gesv_mixed(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, T *a,
+                        std::int64_t lda, std::int64_t *ipiv, const T *b, std::int64_t ldb, T *x,
+                        std::int64_t ldx, const sycl::vector_class<sycl::event> &dependencies) {
+    using low = mixed_low_t<T>;
+    using events = sycl::vector_class<sycl::event>;
+    auto factor = [&](sycl::queue &on, low *sa, const events &deps) {
+        return oneapi::mkl::lapack::getrf(on, n, n, sa, n, ipiv, deps);
+    };
+    auto solve = [&](low *sa, low *sx, const events &deps) {
+        return oneapi::mkl::lapack::getrs(queue, oneapi::mkl::transpose::nontrans, n, nrhs, sa, n,
+                                          ipiv, sx, n, deps);
+    };
+    auto residual = [&](T *r, const events &deps) {
+        auto copied = mixed_convert(queue, n, nrhs, b, ldb, r, n, deps);
+        return oneapi::mkl::blas::column_major::gemm(
+            queue, oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::nontrans, n, nrhs, n,
+            T(-1.0), a, lda, x, ldx, T(1.0), r, n, { copied });
+    };
+    auto fallback = [&](const events &deps) {
+        auto copied = mixed_convert(queue, n, nrhs, b, ldb, x, ldx, deps);
+        auto factored = oneapi::mkl::lapack::getrf(queue, n, n, a, lda, ipiv, deps);
+        return oneapi::mkl::lapack::getrs(queue, oneapi::mkl::transpose::nontrans, n, nrhs, a, lda,
+                                          ipiv, x, ldx, { copied, factored });
+    };
+    return mixed_refine(queue, n, nrhs, a, lda, false, oneapi::mkl::uplo::upper, b, ldb, x, ldx,
+                        dependencies, factor, solve, residual, fallback);
+}
+
+template <typename T>
+std::int64_t posv_mixed(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, T *a, std::int64_t lda, const T *b, std::int64_t ldb,
+                        T *x, std::int64_t ldx,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    using low = mixed_low_t<T>;
+    using events = sycl::vector_class<sycl::event>;
+    auto factor = [&](sycl::queue &on, low *sa, const events &deps) {
+        return oneapi::mkl::lapack::potrf(on, uplo, n, sa, n, deps);
+    };
+    auto solve = [&](low *sa, low *sx, const events &deps) {
+        return oneapi::mkl::lapack::potrs(queue, uplo, n, nrhs, sa, n, sx, n, deps);
+    };
+    auto residual = [&](T *r, const events &deps) {
+        auto copied = mixed_convert(queue, n, nrhs, b, ldb, r, n, deps);
+        return mixed_hermitian_multiply(queue, uplo, n, nrhs, a, lda, x, ldx, r, n, { copied });
+    };
+    auto fallback = [&](const events &deps) {
+        auto copied = mixed_convert(queue, n, nrhs, b, ldb, x, ldx, deps);
+        auto factored = oneapi::mkl::lapack::potrf(queue, uplo, n, a, lda, deps);
+        return oneapi::mkl::lapack::potrs(queue, uplo, n, nrhs, a, lda, x, ldx,
+                                          { copied, factored });
+    };
+    return mixed_refine(queue, n, nrhs, a, lda, true, uplo, b, ldb, x, ldx, dependencies, factor,
+                        solve, residual, fallback);
+}
+
+// Buffer arguments are staged through pooled USM blocks so that the buffer and
+// USM entry points share one implementation. Every buffer is copied in, even
+// those the solver only writes, since copy_out() writes the whole block back:
+// the padding of x past n rows and the entries the solver does not touch keep
+// the values of the caller.
+template <typename T>
+class mixed_staging {
+public:
+    mixed_staging(sycl::queue &queue, sycl::buffer<T> &buffer)
+            : queue_(queue),
+              buffer_(buffer),
+              usm_(queue, buffer.get_count(), {}),
+              ready_(usm_.dependencies()) {
+        ready_ = { queue_.submit([&](sycl::handler &cgh) {
+            int64_t num_events = ready_.size();
+            for (int64_t i = 0; i < num_events; i++) {
+                cgh.depends_on(ready_[i]);
+            }
+            auto accessor = buffer_.template get_access<sycl::access::mode::read>(cgh);
+            cgh.copy(accessor, usm_.get());
+        }) };
+    }
+    mixed_staging(const mixed_staging &) = delete;
+    mixed_staging &operator=(const mixed_staging &) = delete;
+
+    T *get() const {
+        return usm_.get();
+    }
+    const sycl::vector_class<sycl::event> &ready() const {
+        return ready_;
+    }
+    void copy_out() {
+        usm_.release(queue_.submit([&](sycl::handler &cgh) {
+            auto accessor = buffer_.template get_access<sycl::access::mode::write>(cgh);
+            cgh.copy(static_cast<const T *>(usm_.get()), accessor);
+        }));
+    }
+
+private:
+    sycl::queue queue_;
+    sycl::buffer<T> &buffer_;
+    workspace_usm<T> usm_;
+    sycl::vector_class<sycl::event> ready_;
+};
+
+inline sycl::vector_class<sycl::event> mixed_join(
+    std::initializer_list<sycl::vector_class<sycl::event>> lists) {
+    sycl::vector_class<sycl::event> joined;
+    for (auto &list : lists)
+        joined.insert(joined.end(), list.begin(), list.end());
+    return joined;
+}
+
+template <typename T>
+void gesv_mixed(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, sycl::buffer<T> &a,
+                std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, sycl::buffer<T> &b,
+                std::int64_t ldb, sycl::buffer<T> &x, std::int64_t ldx,
+                sycl::buffer<std::int64_t> &iter) {
+    mixed_staging<T> a_usm(queue, a);
+    mixed_staging<T> b_usm(queue, b);
+    mixed_staging<T> x_usm(queue, x);
+    mixed_staging<std::int64_t> ipiv_usm(queue, ipiv);
+    auto dependencies =
+        mixed_join({ a_usm.ready(), b_usm.ready(), x_usm.ready(), ipiv_usm.ready() });
+    auto result = gesv_mixed(queue, n, nrhs, a_usm.get(), lda, ipiv_usm.get(), b_usm.get(), ldb,
+                             x_usm.get(), ldx, dependencies);
+    a_usm.copy_out();
+    ipiv_usm.copy_out();
+    x_usm.copy_out();
+    iter.template get_access<sycl::access::mode::write>()[0] = result;
+}
+
+template <typename T>
+void posv_mixed(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<T> &a, std::int64_t lda, sycl::buffer<T> &b, std::int64_t ldb,
+                sycl::buffer<T> &x, std::int64_t ldx, sycl::buffer<std::int64_t> &iter) {
+    mixed_staging<T> a_usm(queue, a);
+    mixed_staging<T> b_usm(queue, b);
+    mixed_staging<T> x_usm(queue, x);
+    auto dependencies = mixed_join({ a_usm.ready(), b_usm.ready(), x_usm.ready() });
+    auto result = posv_mixed(queue, uplo, n, nrhs, a_usm.get(), lda, b_usm.get(), ldb,
+                             x_usm.get(), ldx, dependencies);
+    a_usm.copy_out();
+    x_usm.copy_out();
+    iter.template get_access<sycl::access::mode::write>()[0] = result;
+}
+
+} // namespace detail
+
+// The USM overloads block the calling thread: convergence is decided on the host.
+static inline void gesv_mixed(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<double> &a, std::int64_t lda,
+                              sycl::buffer<std::int64_t> &ipiv, sycl::buffer<double> &b,
+                              std::int64_t ldb, sycl::buffer<double> &x, std::int64_t ldx,
+                              sycl::buffer<std::int64_t> &iter) {
+    detail::gesv_mixed(queue, n, nrhs, a, lda, ipiv, b, ldb, x, ldx, iter);
+}
+static inline void gesv_mixed(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                              sycl::buffer<std::int64_t> &ipiv,
+                              sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                              sycl::buffer<std::complex<double>> &x, std::int64_t ldx,
+                              sycl::buffer<std::int64_t> &iter) {
+    detail::gesv_mixed(queue, n, nrhs, a, lda, ipiv, b, ldb, x, ldx, iter);
+}
+static inline sycl::event gesv_mixed(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                                     double *a, std::int64_t lda, std::int64_t *ipiv,
+                                     const double *b, std::int64_t ldb, double *x, std::int64_t ldx,
+                                     std::int64_t *iter,
+                                     const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t result =
+        detail::gesv_mixed(queue, n, nrhs, a, lda, ipiv, b, ldb, x, ldx, dependencies);
+    return queue.fill(iter, result, 1);
+}
+static inline sycl::event gesv_mixed(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                                     std::complex<double> *a, std::int64_t lda, std::int64_t *ipiv,
+                                     const std::complex<double> *b, std::int64_t ldb,
+                                     std::complex<double> *x, std::int64_t ldx, std::int64_t *iter,
+                                     const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t result =
+        detail::gesv_mixed(queue, n, nrhs, a, lda, ipiv, b, ldb, x, ldx, dependencies);
+    return queue.fill(iter, result, 1);
+}
+static inline void posv_mixed(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                              sycl::buffer<double> &b, std::int64_t ldb, sycl::buffer<double> &x,
+                              std::int64_t ldx, sycl::buffer<std::int64_t> &iter) {
+    detail::posv_mixed(queue, uplo, n, nrhs, a, lda, b, ldb, x, ldx, iter);
+}
+static inline void posv_mixed(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
+                              std::int64_t lda, sycl::buffer<std::complex<double>> &b,
+                              std::int64_t ldb, sycl::buffer<std::complex<double>> &x,
+                              std::int64_t ldx, sycl::buffer<std::int64_t> &iter) {
+    detail::posv_mixed(queue, uplo, n, nrhs, a, lda, b, ldb, x, ldx, iter);
+}
+static inline sycl::event posv_mixed(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                     std::int64_t nrhs, double *a, std::int64_t lda,
+                                     const double *b, std::int64_t ldb, double *x, std::int64_t ldx,
+                                     std::int64_t *iter,
+                                     const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t result =
+        detail::posv_mixed(queue, uplo, n, nrhs, a, lda, b, ldb, x, ldx, dependencies);
+    return queue.fill(iter, result, 1);
+}
+static inline sycl::event posv_mixed(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                     std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                                     const std::complex<double> *b, std::int64_t ldb,
+                                     std::complex<double> *x, std::int64_t ldx, std::int64_t *iter,
+                                     const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t result =
+        detail::posv_mixed(queue, uplo, n, nrhs, a, lda, b, ldb, x, ldx, dependencies);
+    return queue.fill(iter, result, 1);
+}
+
+} // namespace lapack
+} // namespace mkl
+} // namespace oneapi
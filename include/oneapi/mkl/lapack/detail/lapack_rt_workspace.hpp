@@ -0,0 +1,3480 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#pragma once
+
+#include <complex>
+#include <cstdint>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl/types.hpp"
+#include "oneapi/mkl/lapack/types.hpp"
+#include "oneapi/mkl/lapack/detail/lapack_rt.hpp"
+#include "oneapi/mkl/lapack/detail/workspace_pool.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace lapack {
+
+// Overloads without scratchpad arguments. The scratchpad is taken from the
+// per-queue workspace pool, so repeated calls of the same shape do not
+// allocate once the pool is warm.
+
+static inline void gebrd(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                         sycl::buffer<float> &d, sycl::buffer<float> &e,
+                         sycl::buffer<std::complex<float>> &tauq,
+                         sycl::buffer<std::complex<float>> &taup) {
+    std::int64_t scratchpad_size = gebrd_scratchpad_size<std::complex<float>>(queue, m, n, lda);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    gebrd(queue, m, n, a, lda, d, e, tauq, taup, scratchpad.get(), scratchpad_size);
+}
+static inline void gebrd(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                         sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &d,
+                         sycl::buffer<double> &e, sycl::buffer<double> &tauq,
+                         sycl::buffer<double> &taup) {
+    std::int64_t scratchpad_size = gebrd_scratchpad_size<double>(queue, m, n, lda);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    gebrd(queue, m, n, a, lda, d, e, tauq, taup, scratchpad.get(), scratchpad_size);
+}
+static inline void gebrd(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<float> &a,
+                         std::int64_t lda, sycl::buffer<float> &d, sycl::buffer<float> &e,
+                         sycl::buffer<float> &tauq, sycl::buffer<float> &taup) {
+    std::int64_t scratchpad_size = gebrd_scratchpad_size<float>(queue, m, n, lda);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    gebrd(queue, m, n, a, lda, d, e, tauq, taup, scratchpad.get(), scratchpad_size);
+}
+static inline void gebrd(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                         sycl::buffer<double> &d, sycl::buffer<double> &e,
+                         sycl::buffer<std::complex<double>> &tauq,
+                         sycl::buffer<std::complex<double>> &taup) {
+    std::int64_t scratchpad_size = gebrd_scratchpad_size<std::complex<double>>(queue, m, n, lda);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    gebrd(queue, m, n, a, lda, d, e, tauq, taup, scratchpad.get(), scratchpad_size);
+}
+static inline void gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                        sycl::buffer<float> &b, std::int64_t ldb) {
+    std::int64_t scratchpad_size = gels_scratchpad_size<float>(queue, trans, m, n, nrhs, lda, ldb);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    gels(queue, trans, m, n, nrhs, a, lda, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a,
+                        std::int64_t lda, sycl::buffer<double> &b, std::int64_t ldb) {
+    std::int64_t scratchpad_size = gels_scratchpad_size<double>(queue, trans, m, n, nrhs, lda, ldb);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    gels(queue, trans, m, n, nrhs, a, lda, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<float>> &a,
+                        std::int64_t lda, sycl::buffer<std::complex<float>> &b, std::int64_t ldb) {
+    std::int64_t scratchpad_size = gels_scratchpad_size<std::complex<float>>(queue, trans, m, n,
+                                                                             nrhs, lda, ldb);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    gels(queue, trans, m, n, nrhs, a, lda, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
+                        std::int64_t lda, sycl::buffer<std::complex<double>> &b, std::int64_t ldb) {
+    std::int64_t scratchpad_size = gels_scratchpad_size<std::complex<double>>(queue, trans, m, n,
+                                                                              nrhs, lda, ldb);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    gels(queue, trans, m, n, nrhs, a, lda, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                         sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &b,
+                         std::int64_t ldb, sycl::buffer<float> &s, float rcond,
+                         sycl::buffer<std::int64_t> &rank) {
+    std::int64_t scratchpad_size = gelsd_scratchpad_size<float>(queue, m, n, nrhs, lda, ldb);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    gelsd(queue, m, n, nrhs, a, lda, b, ldb, s, rcond, rank, scratchpad.get(), scratchpad_size);
+}
+static inline void gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                         sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b,
+                         std::int64_t ldb, sycl::buffer<double> &s, double rcond,
+                         sycl::buffer<std::int64_t> &rank) {
+    std::int64_t scratchpad_size = gelsd_scratchpad_size<double>(queue, m, n, nrhs, lda, ldb);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    gelsd(queue, m, n, nrhs, a, lda, b, ldb, s, rcond, rank, scratchpad.get(), scratchpad_size);
+}
+static inline void gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                         sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                         sycl::buffer<float> &s, float rcond, sycl::buffer<std::int64_t> &rank) {
+    std::int64_t scratchpad_size = gelsd_scratchpad_size<std::complex<float>>(queue, m, n, nrhs,
+                                                                              lda, ldb);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    gelsd(queue, m, n, nrhs, a, lda, b, ldb, s, rcond, rank, scratchpad.get(), scratchpad_size);
+}
+static inline void gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                         sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                         sycl::buffer<double> &s, double rcond, sycl::buffer<std::int64_t> &rank) {
+    std::int64_t scratchpad_size = gelsd_scratchpad_size<std::complex<double>>(queue, m, n, nrhs,
+                                                                               lda, ldb);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    gelsd(queue, m, n, nrhs, a, lda, b, ldb, s, rcond, rank, scratchpad.get(), scratchpad_size);
+}
+static inline void gerqf(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<float> &a,
+                         std::int64_t lda, sycl::buffer<float> &tau) {
+    std::int64_t scratchpad_size = gerqf_scratchpad_size<float>(queue, m, n, lda);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    gerqf(queue, m, n, a, lda, tau, scratchpad.get(), scratchpad_size);
+}
+static inline void gerqf(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                         sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &tau) {
+    std::int64_t scratchpad_size = gerqf_scratchpad_size<double>(queue, m, n, lda);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    gerqf(queue, m, n, a, lda, tau, scratchpad.get(), scratchpad_size);
+}
+static inline void gerqf(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                         sycl::buffer<std::complex<float>> &tau) {
+    std::int64_t scratchpad_size = gerqf_scratchpad_size<std::complex<float>>(queue, m, n, lda);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    gerqf(queue, m, n, a, lda, tau, scratchpad.get(), scratchpad_size);
+}
+static inline void gerqf(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                         sycl::buffer<std::complex<double>> &tau) {
+    std::int64_t scratchpad_size = gerqf_scratchpad_size<std::complex<double>>(queue, m, n, lda);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    gerqf(queue, m, n, a, lda, tau, scratchpad.get(), scratchpad_size);
+}
+static inline void geqrf(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                         sycl::buffer<std::complex<float>> &tau) {
+    std::int64_t scratchpad_size = geqrf_scratchpad_size<std::complex<float>>(queue, m, n, lda);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    geqrf(queue, m, n, a, lda, tau, scratchpad.get(), scratchpad_size);
+}
+static inline void geqrf(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                         sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &tau) {
+    std::int64_t scratchpad_size = geqrf_scratchpad_size<double>(queue, m, n, lda);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    geqrf(queue, m, n, a, lda, tau, scratchpad.get(), scratchpad_size);
+}
+static inline void geqrf(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<float> &a,
+                         std::int64_t lda, sycl::buffer<float> &tau) {
+    std::int64_t scratchpad_size = geqrf_scratchpad_size<float>(queue, m, n, lda);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    geqrf(queue, m, n, a, lda, tau, scratchpad.get(), scratchpad_size);
+}
+static inline void geqrf(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                         sycl::buffer<std::complex<double>> &tau) {
+    std::int64_t scratchpad_size = geqrf_scratchpad_size<std::complex<double>>(queue, m, n, lda);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    geqrf(queue, m, n, a, lda, tau, scratchpad.get(), scratchpad_size);
+}
+static inline void getrf(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                         sycl::buffer<std::int64_t> &ipiv) {
+    std::int64_t scratchpad_size = getrf_scratchpad_size<std::complex<float>>(queue, m, n, lda);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    getrf(queue, m, n, a, lda, ipiv, scratchpad.get(), scratchpad_size);
+}
+static inline void getrf(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                         sycl::buffer<double> &a, std::int64_t lda,
+                         sycl::buffer<std::int64_t> &ipiv) {
+    std::int64_t scratchpad_size = getrf_scratchpad_size<double>(queue, m, n, lda);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    getrf(queue, m, n, a, lda, ipiv, scratchpad.get(), scratchpad_size);
+}
+static inline void getrf(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<float> &a,
+                         std::int64_t lda, sycl::buffer<std::int64_t> &ipiv) {
+    std::int64_t scratchpad_size = getrf_scratchpad_size<float>(queue, m, n, lda);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    getrf(queue, m, n, a, lda, ipiv, scratchpad.get(), scratchpad_size);
+}
+static inline void getrf(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                         sycl::buffer<std::int64_t> &ipiv) {
+    std::int64_t scratchpad_size = getrf_scratchpad_size<std::complex<double>>(queue, m, n, lda);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    getrf(queue, m, n, a, lda, ipiv, scratchpad.get(), scratchpad_size);
+}
+static inline void getri(sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+                         std::int64_t lda, sycl::buffer<std::int64_t> &ipiv) {
+    std::int64_t scratchpad_size = getri_scratchpad_size<std::complex<float>>(queue, n, lda);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    getri(queue, n, a, lda, ipiv, scratchpad.get(), scratchpad_size);
+}
+static inline void getri(sycl::queue &queue, std::int64_t n, sycl::buffer<double> &a,
+                         std::int64_t lda, sycl::buffer<std::int64_t> &ipiv) {
+    std::int64_t scratchpad_size = getri_scratchpad_size<double>(queue, n, lda);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    getri(queue, n, a, lda, ipiv, scratchpad.get(), scratchpad_size);
+}
+static inline void getri(sycl::queue &queue, std::int64_t n, sycl::buffer<float> &a,
+                         std::int64_t lda, sycl::buffer<std::int64_t> &ipiv) {
+    std::int64_t scratchpad_size = getri_scratchpad_size<float>(queue, n, lda);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    getri(queue, n, a, lda, ipiv, scratchpad.get(), scratchpad_size);
+}
+static inline void getri(sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<double>> &a,
+                         std::int64_t lda, sycl::buffer<std::int64_t> &ipiv) {
+    std::int64_t scratchpad_size = getri_scratchpad_size<std::complex<double>>(queue, n, lda);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    getri(queue, n, a, lda, ipiv, scratchpad.get(), scratchpad_size);
+}
+static inline void getrs(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                         std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                         sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<float>> &b,
+                         std::int64_t ldb) {
+    std::int64_t scratchpad_size = getrs_scratchpad_size<std::complex<float>>(queue, trans, n, nrhs,
+                                                                              lda, ldb);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    getrs(queue, trans, n, nrhs, a, lda, ipiv, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void getrs(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                         std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                         sycl::buffer<std::int64_t> &ipiv, sycl::buffer<double> &b,
+                         std::int64_t ldb) {
+    std::int64_t scratchpad_size = getrs_scratchpad_size<double>(queue, trans, n, nrhs, lda, ldb);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    getrs(queue, trans, n, nrhs, a, lda, ipiv, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void getrs(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                         std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                         sycl::buffer<std::int64_t> &ipiv, sycl::buffer<float> &b,
+                         std::int64_t ldb) {
+    std::int64_t scratchpad_size = getrs_scratchpad_size<float>(queue, trans, n, nrhs, lda, ldb);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    getrs(queue, trans, n, nrhs, a, lda, ipiv, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void getrs(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                         std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                         sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<double>> &b,
+                         std::int64_t ldb) {
+    std::int64_t scratchpad_size = getrs_scratchpad_size<std::complex<double>>(queue, trans, n,
+                                                                               nrhs, lda, ldb);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    getrs(queue, trans, n, nrhs, a, lda, ipiv, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                        sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+                        sycl::buffer<float> &b, std::int64_t ldb) {
+    std::int64_t scratchpad_size = gesv_scratchpad_size<float>(queue, n, nrhs, lda, ldb);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    gesv(queue, n, nrhs, a, lda, ipiv, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                        sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+                        sycl::buffer<double> &b, std::int64_t ldb) {
+    std::int64_t scratchpad_size = gesv_scratchpad_size<double>(queue, n, nrhs, lda, ldb);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    gesv(queue, n, nrhs, a, lda, ipiv, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                        sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<float>> &b,
+                        std::int64_t ldb) {
+    std::int64_t scratchpad_size = gesv_scratchpad_size<std::complex<float>>(queue, n, nrhs, lda,
+                                                                             ldb);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    gesv(queue, n, nrhs, a, lda, ipiv, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                        sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<double>> &b,
+                        std::int64_t ldb) {
+    std::int64_t scratchpad_size = gesv_scratchpad_size<std::complex<double>>(queue, n, nrhs, lda,
+                                                                              ldb);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    gesv(queue, n, nrhs, a, lda, ipiv, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void gesvd(sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt,
+                         std::int64_t m, std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+                         sycl::buffer<double> &s, sycl::buffer<double> &u, std::int64_t ldu,
+                         sycl::buffer<double> &vt, std::int64_t ldvt) {
+    std::int64_t scratchpad_size = gesvd_scratchpad_size<double>(queue, jobu, jobvt, m, n, lda, ldu,
+                                                                 ldvt);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    gesvd(queue, jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt, scratchpad.get(), scratchpad_size);
+}
+static inline void gesvd(sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt,
+                         std::int64_t m, std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+                         sycl::buffer<float> &s, sycl::buffer<float> &u, std::int64_t ldu,
+                         sycl::buffer<float> &vt, std::int64_t ldvt) {
+    std::int64_t scratchpad_size = gesvd_scratchpad_size<float>(queue, jobu, jobvt, m, n, lda, ldu,
+                                                                ldvt);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    gesvd(queue, jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt, scratchpad.get(), scratchpad_size);
+}
+static inline void gesvd(sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt,
+                         std::int64_t m, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+                         std::int64_t lda, sycl::buffer<float> &s,
+                         sycl::buffer<std::complex<float>> &u, std::int64_t ldu,
+                         sycl::buffer<std::complex<float>> &vt, std::int64_t ldvt) {
+    std::int64_t scratchpad_size = gesvd_scratchpad_size<std::complex<float>>(queue, jobu, jobvt, m,
+                                                                              n, lda, ldu, ldvt);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    gesvd(queue, jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt, scratchpad.get(), scratchpad_size);
+}
+static inline void gesvd(sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt,
+                         std::int64_t m, std::int64_t n, sycl::buffer<std::complex<double>> &a,
+                         std::int64_t lda, sycl::buffer<double> &s,
+                         sycl::buffer<std::complex<double>> &u, std::int64_t ldu,
+                         sycl::buffer<std::complex<double>> &vt, std::int64_t ldvt) {
+    std::int64_t scratchpad_size = gesvd_scratchpad_size<std::complex<double>>(queue, jobu, jobvt,
+                                                                               m, n, lda, ldu,
+                                                                               ldvt);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    gesvd(queue, jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt, scratchpad.get(), scratchpad_size);
+}
+static inline void heevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                         std::int64_t n, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                         sycl::buffer<float> &w) {
+    std::int64_t scratchpad_size = heevd_scratchpad_size<std::complex<float>>(queue, jobz, uplo, n,
+                                                                              lda);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    heevd(queue, jobz, uplo, n, a, lda, w, scratchpad.get(), scratchpad_size);
+}
+static inline void heevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                         std::int64_t n, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                         sycl::buffer<double> &w) {
+    std::int64_t scratchpad_size = heevd_scratchpad_size<std::complex<double>>(queue, jobz, uplo, n,
+                                                                               lda);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    heevd(queue, jobz, uplo, n, a, lda, w, scratchpad.get(), scratchpad_size);
+}
+static inline void heevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda, float vl, float vu,
+                         std::int64_t il, std::int64_t iu, float abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                         sycl::buffer<std::complex<float>> &z, std::int64_t ldz) {
+    std::int64_t scratchpad_size = heevr_scratchpad_size<std::complex<float>>(queue, jobz, range,
+                                                                              uplo, n, lda, ldz);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    heevr(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m, w, z, ldz,
+          scratchpad.get(), scratchpad_size);
+}
+static inline void heevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda, double vl,
+                         double vu, std::int64_t il, std::int64_t iu, double abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                         sycl::buffer<std::complex<double>> &z, std::int64_t ldz) {
+    std::int64_t scratchpad_size = heevr_scratchpad_size<std::complex<double>>(queue, jobz, range,
+                                                                               uplo, n, lda, ldz);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    heevr(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m, w, z, ldz,
+          scratchpad.get(), scratchpad_size);
+}
+static inline void heevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda, float vl, float vu,
+                         std::int64_t il, std::int64_t iu, float abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                         sycl::buffer<std::complex<float>> &z, std::int64_t ldz) {
+    std::int64_t scratchpad_size = heevx_scratchpad_size<std::complex<float>>(queue, jobz, range,
+                                                                              uplo, n, lda, ldz);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    heevx(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m, w, z, ldz,
+          scratchpad.get(), scratchpad_size);
+}
+static inline void heevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda, double vl,
+                         double vu, std::int64_t il, std::int64_t iu, double abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                         sycl::buffer<std::complex<double>> &z, std::int64_t ldz) {
+    std::int64_t scratchpad_size = heevx_scratchpad_size<std::complex<double>>(queue, jobz, range,
+                                                                               uplo, n, lda, ldz);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    heevx(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m, w, z, ldz,
+          scratchpad.get(), scratchpad_size);
+}
+static inline void hegvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
+                         oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                         sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                         sycl::buffer<float> &w) {
+    std::int64_t scratchpad_size = hegvd_scratchpad_size<std::complex<float>>(queue, itype, jobz,
+                                                                              uplo, n, lda, ldb);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    hegvd(queue, itype, jobz, uplo, n, a, lda, b, ldb, w, scratchpad.get(), scratchpad_size);
+}
+static inline void hegvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
+                         oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                         sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                         sycl::buffer<double> &w) {
+    std::int64_t scratchpad_size = hegvd_scratchpad_size<std::complex<double>>(queue, itype, jobz,
+                                                                               uplo, n, lda, ldb);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    hegvd(queue, itype, jobz, uplo, n, a, lda, b, ldb, w, scratchpad.get(), scratchpad_size);
+}
+static inline void hetrd(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                         sycl::buffer<float> &d, sycl::buffer<float> &e,
+                         sycl::buffer<std::complex<float>> &tau) {
+    std::int64_t scratchpad_size = hetrd_scratchpad_size<std::complex<float>>(queue, uplo, n, lda);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    hetrd(queue, uplo, n, a, lda, d, e, tau, scratchpad.get(), scratchpad_size);
+}
+static inline void hetrd(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                         sycl::buffer<double> &d, sycl::buffer<double> &e,
+                         sycl::buffer<std::complex<double>> &tau) {
+    std::int64_t scratchpad_size = hetrd_scratchpad_size<std::complex<double>>(queue, uplo, n, lda);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    hetrd(queue, uplo, n, a, lda, d, e, tau, scratchpad.get(), scratchpad_size);
+}
+static inline void hetrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                         sycl::buffer<std::int64_t> &ipiv) {
+    std::int64_t scratchpad_size = hetrf_scratchpad_size<std::complex<float>>(queue, uplo, n, lda);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    hetrf(queue, uplo, n, a, lda, ipiv, scratchpad.get(), scratchpad_size);
+}
+static inline void hetrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                         sycl::buffer<std::int64_t> &ipiv) {
+    std::int64_t scratchpad_size = hetrf_scratchpad_size<std::complex<double>>(queue, uplo, n, lda);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    hetrf(queue, uplo, n, a, lda, ipiv, scratchpad.get(), scratchpad_size);
+}
+static inline void orgbr(sycl::queue &queue, oneapi::mkl::generate vec, std::int64_t m,
+                         std::int64_t n, std::int64_t k, sycl::buffer<float> &a, std::int64_t lda,
+                         sycl::buffer<float> &tau) {
+    std::int64_t scratchpad_size = orgbr_scratchpad_size<float>(queue, vec, m, n, k, lda);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    orgbr(queue, vec, m, n, k, a, lda, tau, scratchpad.get(), scratchpad_size);
+}
+static inline void orgbr(sycl::queue &queue, oneapi::mkl::generate vec, std::int64_t m,
+                         std::int64_t n, std::int64_t k, sycl::buffer<double> &a, std::int64_t lda,
+                         sycl::buffer<double> &tau) {
+    std::int64_t scratchpad_size = orgbr_scratchpad_size<double>(queue, vec, m, n, k, lda);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    orgbr(queue, vec, m, n, k, a, lda, tau, scratchpad.get(), scratchpad_size);
+}
+static inline void orgqr(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
+                         sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &tau) {
+    std::int64_t scratchpad_size = orgqr_scratchpad_size<double>(queue, m, n, k, lda);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    orgqr(queue, m, n, k, a, lda, tau, scratchpad.get(), scratchpad_size);
+}
+static inline void orgqr(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
+                         sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &tau) {
+    std::int64_t scratchpad_size = orgqr_scratchpad_size<float>(queue, m, n, k, lda);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    orgqr(queue, m, n, k, a, lda, tau, scratchpad.get(), scratchpad_size);
+}
+static inline void orgtr(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &tau) {
+    std::int64_t scratchpad_size = orgtr_scratchpad_size<float>(queue, uplo, n, lda);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    orgtr(queue, uplo, n, a, lda, tau, scratchpad.get(), scratchpad_size);
+}
+static inline void orgtr(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &tau) {
+    std::int64_t scratchpad_size = orgtr_scratchpad_size<double>(queue, uplo, n, lda);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    orgtr(queue, uplo, n, a, lda, tau, scratchpad.get(), scratchpad_size);
+}
+static inline void ormtr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+                         oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                         sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &tau,
+                         sycl::buffer<float> &c, std::int64_t ldc) {
+    std::int64_t scratchpad_size = ormtr_scratchpad_size<float>(queue, side, uplo, trans, m, n, lda,
+                                                                ldc);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    ormtr(queue, side, uplo, trans, m, n, a, lda, tau, c, ldc, scratchpad.get(), scratchpad_size);
+}
+static inline void ormtr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+                         oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                         sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &tau,
+                         sycl::buffer<double> &c, std::int64_t ldc) {
+    std::int64_t scratchpad_size = ormtr_scratchpad_size<double>(queue, side, uplo, trans, m, n,
+                                                                 lda, ldc);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    ormtr(queue, side, uplo, trans, m, n, a, lda, tau, c, ldc, scratchpad.get(), scratchpad_size);
+}
+static inline void ormrq(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+                         std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<float> &a,
+                         std::int64_t lda, sycl::buffer<float> &tau, sycl::buffer<float> &c,
+                         std::int64_t ldc) {
+    std::int64_t scratchpad_size = ormrq_scratchpad_size<float>(queue, side, trans, m, n, k, lda,
+                                                                ldc);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    ormrq(queue, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad.get(), scratchpad_size);
+}
+static inline void ormrq(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+                         std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<double> &a,
+                         std::int64_t lda, sycl::buffer<double> &tau, sycl::buffer<double> &c,
+                         std::int64_t ldc) {
+    std::int64_t scratchpad_size = ormrq_scratchpad_size<double>(queue, side, trans, m, n, k, lda,
+                                                                 ldc);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    ormrq(queue, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad.get(), scratchpad_size);
+}
+static inline void ormqr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+                         std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<double> &a,
+                         std::int64_t lda, sycl::buffer<double> &tau, sycl::buffer<double> &c,
+                         std::int64_t ldc) {
+    std::int64_t scratchpad_size = ormqr_scratchpad_size<double>(queue, side, trans, m, n, k, lda,
+                                                                 ldc);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    ormqr(queue, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad.get(), scratchpad_size);
+}
+static inline void ormqr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+                         std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<float> &a,
+                         std::int64_t lda, sycl::buffer<float> &tau, sycl::buffer<float> &c,
+                         std::int64_t ldc) {
+    std::int64_t scratchpad_size = ormqr_scratchpad_size<float>(queue, side, trans, m, n, k, lda,
+                                                                ldc);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    ormqr(queue, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad.get(), scratchpad_size);
+}
+static inline void potrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<float> &a, std::int64_t lda) {
+    std::int64_t scratchpad_size = potrf_scratchpad_size<float>(queue, uplo, n, lda);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    potrf(queue, uplo, n, a, lda, scratchpad.get(), scratchpad_size);
+}
+static inline void potrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<double> &a, std::int64_t lda) {
+    std::int64_t scratchpad_size = potrf_scratchpad_size<double>(queue, uplo, n, lda);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    potrf(queue, uplo, n, a, lda, scratchpad.get(), scratchpad_size);
+}
+static inline void potrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda) {
+    std::int64_t scratchpad_size = potrf_scratchpad_size<std::complex<float>>(queue, uplo, n, lda);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    potrf(queue, uplo, n, a, lda, scratchpad.get(), scratchpad_size);
+}
+static inline void potrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda) {
+    std::int64_t scratchpad_size = potrf_scratchpad_size<std::complex<double>>(queue, uplo, n, lda);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    potrf(queue, uplo, n, a, lda, scratchpad.get(), scratchpad_size);
+}
+static inline void potri(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<float> &a, std::int64_t lda) {
+    std::int64_t scratchpad_size = potri_scratchpad_size<float>(queue, uplo, n, lda);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    potri(queue, uplo, n, a, lda, scratchpad.get(), scratchpad_size);
+}
+static inline void potri(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<double> &a, std::int64_t lda) {
+    std::int64_t scratchpad_size = potri_scratchpad_size<double>(queue, uplo, n, lda);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    potri(queue, uplo, n, a, lda, scratchpad.get(), scratchpad_size);
+}
+static inline void potri(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda) {
+    std::int64_t scratchpad_size = potri_scratchpad_size<std::complex<float>>(queue, uplo, n, lda);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    potri(queue, uplo, n, a, lda, scratchpad.get(), scratchpad_size);
+}
+static inline void potri(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda) {
+    std::int64_t scratchpad_size = potri_scratchpad_size<std::complex<double>>(queue, uplo, n, lda);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    potri(queue, uplo, n, a, lda, scratchpad.get(), scratchpad_size);
+}
+static inline void potrs(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                         std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                         sycl::buffer<float> &b, std::int64_t ldb) {
+    std::int64_t scratchpad_size = potrs_scratchpad_size<float>(queue, uplo, n, nrhs, lda, ldb);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    potrs(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void potrs(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                         std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                         sycl::buffer<double> &b, std::int64_t ldb) {
+    std::int64_t scratchpad_size = potrs_scratchpad_size<double>(queue, uplo, n, nrhs, lda, ldb);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    potrs(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void potrs(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                         std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                         sycl::buffer<std::complex<float>> &b, std::int64_t ldb) {
+    std::int64_t scratchpad_size = potrs_scratchpad_size<std::complex<float>>(queue, uplo, n, nrhs,
+                                                                              lda, ldb);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    potrs(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void potrs(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                         std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                         sycl::buffer<std::complex<double>> &b, std::int64_t ldb) {
+    std::int64_t scratchpad_size = potrs_scratchpad_size<std::complex<double>>(queue, uplo, n, nrhs,
+                                                                               lda, ldb);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    potrs(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                        sycl::buffer<float> &b, std::int64_t ldb) {
+    std::int64_t scratchpad_size = posv_scratchpad_size<float>(queue, uplo, n, nrhs, lda, ldb);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    posv(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                        sycl::buffer<double> &b, std::int64_t ldb) {
+    std::int64_t scratchpad_size = posv_scratchpad_size<double>(queue, uplo, n, nrhs, lda, ldb);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    posv(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                        sycl::buffer<std::complex<float>> &b, std::int64_t ldb) {
+    std::int64_t scratchpad_size = posv_scratchpad_size<std::complex<float>>(queue, uplo, n, nrhs,
+                                                                             lda, ldb);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    posv(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                        sycl::buffer<std::complex<double>> &b, std::int64_t ldb) {
+    std::int64_t scratchpad_size = posv_scratchpad_size<std::complex<double>>(queue, uplo, n, nrhs,
+                                                                              lda, ldb);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    posv(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void syevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                         std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+                         sycl::buffer<double> &w) {
+    std::int64_t scratchpad_size = syevd_scratchpad_size<double>(queue, jobz, uplo, n, lda);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    syevd(queue, jobz, uplo, n, a, lda, w, scratchpad.get(), scratchpad_size);
+}
+static inline void syevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                         std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+                         sycl::buffer<float> &w) {
+    std::int64_t scratchpad_size = syevd_scratchpad_size<float>(queue, jobz, uplo, n, lda);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    syevd(queue, jobz, uplo, n, a, lda, w, scratchpad.get(), scratchpad_size);
+}
+static inline void syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+                         std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu,
+                         float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                         sycl::buffer<float> &z, std::int64_t ldz) {
+    std::int64_t scratchpad_size = syevr_scratchpad_size<float>(queue, jobz, range, uplo, n, lda,
+                                                                ldz);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    syevr(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m, w, z, ldz,
+          scratchpad.get(), scratchpad_size);
+}
+static inline void syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
+                         std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu,
+                         double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                         sycl::buffer<double> &z, std::int64_t ldz) {
+    std::int64_t scratchpad_size = syevr_scratchpad_size<double>(queue, jobz, range, uplo, n, lda,
+                                                                 ldz);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    syevr(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m, w, z, ldz,
+          scratchpad.get(), scratchpad_size);
+}
+static inline void syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+                         std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu,
+                         float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                         sycl::buffer<float> &z, std::int64_t ldz) {
+    std::int64_t scratchpad_size = syevx_scratchpad_size<float>(queue, jobz, range, uplo, n, lda,
+                                                                ldz);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    syevx(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m, w, z, ldz,
+          scratchpad.get(), scratchpad_size);
+}
+static inline void syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
+                         std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu,
+                         double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                         sycl::buffer<double> &z, std::int64_t ldz) {
+    std::int64_t scratchpad_size = syevx_scratchpad_size<double>(queue, jobz, range, uplo, n, lda,
+                                                                 ldz);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    syevx(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m, w, z, ldz,
+          scratchpad.get(), scratchpad_size);
+}
+static inline void sygvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
+                         oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
+                         std::int64_t lda, sycl::buffer<double> &b, std::int64_t ldb,
+                         sycl::buffer<double> &w) {
+    std::int64_t scratchpad_size = sygvd_scratchpad_size<double>(queue, itype, jobz, uplo, n, lda,
+                                                                 ldb);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    sygvd(queue, itype, jobz, uplo, n, a, lda, b, ldb, w, scratchpad.get(), scratchpad_size);
+}
+static inline void sygvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
+                         oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+                         std::int64_t lda, sycl::buffer<float> &b, std::int64_t ldb,
+                         sycl::buffer<float> &w) {
+    std::int64_t scratchpad_size = sygvd_scratchpad_size<float>(queue, itype, jobz, uplo, n, lda,
+                                                                ldb);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    sygvd(queue, itype, jobz, uplo, n, a, lda, b, ldb, w, scratchpad.get(), scratchpad_size);
+}
+static inline void sytrd(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &d,
+                         sycl::buffer<double> &e, sycl::buffer<double> &tau) {
+    std::int64_t scratchpad_size = sytrd_scratchpad_size<double>(queue, uplo, n, lda);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    sytrd(queue, uplo, n, a, lda, d, e, tau, scratchpad.get(), scratchpad_size);
+}
+static inline void sytrd(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &d,
+                         sycl::buffer<float> &e, sycl::buffer<float> &tau) {
+    std::int64_t scratchpad_size = sytrd_scratchpad_size<float>(queue, uplo, n, lda);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    sytrd(queue, uplo, n, a, lda, d, e, tau, scratchpad.get(), scratchpad_size);
+}
+static inline void sytrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<float> &a, std::int64_t lda,
+                         sycl::buffer<std::int64_t> &ipiv) {
+    std::int64_t scratchpad_size = sytrf_scratchpad_size<float>(queue, uplo, n, lda);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    sytrf(queue, uplo, n, a, lda, ipiv, scratchpad.get(), scratchpad_size);
+}
+static inline void sytrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<double> &a, std::int64_t lda,
+                         sycl::buffer<std::int64_t> &ipiv) {
+    std::int64_t scratchpad_size = sytrf_scratchpad_size<double>(queue, uplo, n, lda);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    sytrf(queue, uplo, n, a, lda, ipiv, scratchpad.get(), scratchpad_size);
+}
+static inline void sytrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                         sycl::buffer<std::int64_t> &ipiv) {
+    std::int64_t scratchpad_size = sytrf_scratchpad_size<std::complex<float>>(queue, uplo, n, lda);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    sytrf(queue, uplo, n, a, lda, ipiv, scratchpad.get(), scratchpad_size);
+}
+static inline void sytrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                         sycl::buffer<std::int64_t> &ipiv) {
+    std::int64_t scratchpad_size = sytrf_scratchpad_size<std::complex<double>>(queue, uplo, n, lda);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    sytrf(queue, uplo, n, a, lda, ipiv, scratchpad.get(), scratchpad_size);
+}
+static inline void sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<float> &b,
+                        std::int64_t ldb) {
+    std::int64_t scratchpad_size = sysv_scratchpad_size<float>(queue, uplo, n, nrhs, lda, ldb);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    sysv(queue, uplo, n, nrhs, a, lda, ipiv, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<double> &b,
+                        std::int64_t ldb) {
+    std::int64_t scratchpad_size = sysv_scratchpad_size<double>(queue, uplo, n, nrhs, lda, ldb);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    sysv(queue, uplo, n, nrhs, a, lda, ipiv, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<float>> &b,
+                        std::int64_t ldb) {
+    std::int64_t scratchpad_size = sysv_scratchpad_size<std::complex<float>>(queue, uplo, n, nrhs,
+                                                                             lda, ldb);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    sysv(queue, uplo, n, nrhs, a, lda, ipiv, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<double>> &b,
+                        std::int64_t ldb) {
+    std::int64_t scratchpad_size = sysv_scratchpad_size<std::complex<double>>(queue, uplo, n, nrhs,
+                                                                              lda, ldb);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    sysv(queue, uplo, n, nrhs, a, lda, ipiv, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void trtrs(sycl::queue &queue, oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans,
+                         oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                         sycl::buffer<std::complex<float>> &b, std::int64_t ldb) {
+    std::int64_t scratchpad_size = trtrs_scratchpad_size<std::complex<float>>(queue, uplo, trans,
+                                                                              diag, n, nrhs, lda,
+                                                                              ldb);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    trtrs(queue, uplo, trans, diag, n, nrhs, a, lda, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void trtrs(sycl::queue &queue, oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans,
+                         oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs,
+                         sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b,
+                         std::int64_t ldb) {
+    std::int64_t scratchpad_size = trtrs_scratchpad_size<double>(queue, uplo, trans, diag, n, nrhs,
+                                                                 lda, ldb);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    trtrs(queue, uplo, trans, diag, n, nrhs, a, lda, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void trtrs(sycl::queue &queue, oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans,
+                         oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs,
+                         sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &b,
+                         std::int64_t ldb) {
+    std::int64_t scratchpad_size = trtrs_scratchpad_size<float>(queue, uplo, trans, diag, n, nrhs,
+                                                                lda, ldb);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    trtrs(queue, uplo, trans, diag, n, nrhs, a, lda, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void trtrs(sycl::queue &queue, oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans,
+                         oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                         sycl::buffer<std::complex<double>> &b, std::int64_t ldb) {
+    std::int64_t scratchpad_size = trtrs_scratchpad_size<std::complex<double>>(queue, uplo, trans,
+                                                                               diag, n, nrhs, lda,
+                                                                               ldb);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    trtrs(queue, uplo, trans, diag, n, nrhs, a, lda, b, ldb, scratchpad.get(), scratchpad_size);
+}
+static inline void ungbr(sycl::queue &queue, oneapi::mkl::generate vec, std::int64_t m,
+                         std::int64_t n, std::int64_t k, sycl::buffer<std::complex<float>> &a,
+                         std::int64_t lda, sycl::buffer<std::complex<float>> &tau) {
+    std::int64_t scratchpad_size = ungbr_scratchpad_size<std::complex<float>>(queue, vec, m, n, k,
+                                                                              lda);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    ungbr(queue, vec, m, n, k, a, lda, tau, scratchpad.get(), scratchpad_size);
+}
+static inline void ungbr(sycl::queue &queue, oneapi::mkl::generate vec, std::int64_t m,
+                         std::int64_t n, std::int64_t k, sycl::buffer<std::complex<double>> &a,
+                         std::int64_t lda, sycl::buffer<std::complex<double>> &tau) {
+    std::int64_t scratchpad_size = ungbr_scratchpad_size<std::complex<double>>(queue, vec, m, n, k,
+                                                                               lda);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    ungbr(queue, vec, m, n, k, a, lda, tau, scratchpad.get(), scratchpad_size);
+}
+static inline void ungqr(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                         sycl::buffer<std::complex<float>> &tau) {
+    std::int64_t scratchpad_size = ungqr_scratchpad_size<std::complex<float>>(queue, m, n, k, lda);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    ungqr(queue, m, n, k, a, lda, tau, scratchpad.get(), scratchpad_size);
+}
+static inline void ungqr(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                         sycl::buffer<std::complex<double>> &tau) {
+    std::int64_t scratchpad_size = ungqr_scratchpad_size<std::complex<double>>(queue, m, n, k, lda);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    ungqr(queue, m, n, k, a, lda, tau, scratchpad.get(), scratchpad_size);
+}
+static inline void ungtr(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                         sycl::buffer<std::complex<float>> &tau) {
+    std::int64_t scratchpad_size = ungtr_scratchpad_size<std::complex<float>>(queue, uplo, n, lda);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    ungtr(queue, uplo, n, a, lda, tau, scratchpad.get(), scratchpad_size);
+}
+static inline void ungtr(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                         sycl::buffer<std::complex<double>> &tau) {
+    std::int64_t scratchpad_size = ungtr_scratchpad_size<std::complex<double>>(queue, uplo, n, lda);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    ungtr(queue, uplo, n, a, lda, tau, scratchpad.get(), scratchpad_size);
+}
+static inline void unmrq(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+                         std::int64_t m, std::int64_t n, std::int64_t k,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                         sycl::buffer<std::complex<float>> &tau,
+                         sycl::buffer<std::complex<float>> &c, std::int64_t ldc) {
+    std::int64_t scratchpad_size = unmrq_scratchpad_size<std::complex<float>>(queue, side, trans, m,
+                                                                              n, k, lda, ldc);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    unmrq(queue, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad.get(), scratchpad_size);
+}
+static inline void unmrq(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+                         std::int64_t m, std::int64_t n, std::int64_t k,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                         sycl::buffer<std::complex<double>> &tau,
+                         sycl::buffer<std::complex<double>> &c, std::int64_t ldc) {
+    std::int64_t scratchpad_size = unmrq_scratchpad_size<std::complex<double>>(queue, side, trans,
+                                                                               m, n, k, lda, ldc);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    unmrq(queue, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad.get(), scratchpad_size);
+}
+static inline void unmqr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+                         std::int64_t m, std::int64_t n, std::int64_t k,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                         sycl::buffer<std::complex<float>> &tau,
+                         sycl::buffer<std::complex<float>> &c, std::int64_t ldc) {
+    std::int64_t scratchpad_size = unmqr_scratchpad_size<std::complex<float>>(queue, side, trans, m,
+                                                                              n, k, lda, ldc);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    unmqr(queue, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad.get(), scratchpad_size);
+}
+static inline void unmqr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+                         std::int64_t m, std::int64_t n, std::int64_t k,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                         sycl::buffer<std::complex<double>> &tau,
+                         sycl::buffer<std::complex<double>> &c, std::int64_t ldc) {
+    std::int64_t scratchpad_size = unmqr_scratchpad_size<std::complex<double>>(queue, side, trans,
+                                                                               m, n, k, lda, ldc);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    unmqr(queue, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad.get(), scratchpad_size);
+}
+static inline void unmtr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+                         oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                         sycl::buffer<std::complex<float>> &tau,
+                         sycl::buffer<std::complex<float>> &c, std::int64_t ldc) {
+    std::int64_t scratchpad_size = unmtr_scratchpad_size<std::complex<float>>(queue, side, uplo,
+                                                                              trans, m, n, lda,
+                                                                              ldc);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    unmtr(queue, side, uplo, trans, m, n, a, lda, tau, c, ldc, scratchpad.get(), scratchpad_size);
+}
+static inline void unmtr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+                         oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                         sycl::buffer<std::complex<double>> &tau,
+                         sycl::buffer<std::complex<double>> &c, std::int64_t ldc) {
+    std::int64_t scratchpad_size = unmtr_scratchpad_size<std::complex<double>>(queue, side, uplo,
+                                                                               trans, m, n, lda,
+                                                                               ldc);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    unmtr(queue, side, uplo, trans, m, n, a, lda, tau, c, ldc, scratchpad.get(), scratchpad_size);
+}
+static inline void geqrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                               sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                               sycl::buffer<float> &tau, std::int64_t stride_tau,
+                               std::int64_t batch_size) {
+    std::int64_t scratchpad_size = geqrf_batch_scratchpad_size<float>(queue, m, n, lda, stride_a,
+                                                                      stride_tau, batch_size);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    geqrf_batch(queue, m, n, a, lda, stride_a, tau, stride_tau, batch_size, scratchpad.get(),
+                scratchpad_size);
+}
+static inline void geqrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                               sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                               sycl::buffer<double> &tau, std::int64_t stride_tau,
+                               std::int64_t batch_size) {
+    std::int64_t scratchpad_size = geqrf_batch_scratchpad_size<double>(queue, m, n, lda, stride_a,
+                                                                       stride_tau, batch_size);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    geqrf_batch(queue, m, n, a, lda, stride_a, tau, stride_tau, batch_size, scratchpad.get(),
+                scratchpad_size);
+}
+static inline void geqrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                               sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                               std::int64_t stride_a, sycl::buffer<std::complex<float>> &tau,
+                               std::int64_t stride_tau, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = geqrf_batch_scratchpad_size<std::complex<float>>(queue, m, n,
+                                                                                    lda, stride_a,
+                                                                                    stride_tau,
+                                                                                    batch_size);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    geqrf_batch(queue, m, n, a, lda, stride_a, tau, stride_tau, batch_size, scratchpad.get(),
+                scratchpad_size);
+}
+static inline void geqrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                               sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                               std::int64_t stride_a, sycl::buffer<std::complex<double>> &tau,
+                               std::int64_t stride_tau, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = geqrf_batch_scratchpad_size<std::complex<double>>(queue, m, n,
+                                                                                     lda, stride_a,
+                                                                                     stride_tau,
+                                                                                     batch_size);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    geqrf_batch(queue, m, n, a, lda, stride_a, tau, stride_tau, batch_size, scratchpad.get(),
+                scratchpad_size);
+}
+static inline void getri_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<float> &a,
+                               std::int64_t lda, std::int64_t stride_a,
+                               sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                               std::int64_t batch_size) {
+    std::int64_t scratchpad_size = getri_batch_scratchpad_size<float>(queue, n, lda, stride_a,
+                                                                      stride_ipiv, batch_size);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    getri_batch(queue, n, a, lda, stride_a, ipiv, stride_ipiv, batch_size, scratchpad.get(),
+                scratchpad_size);
+}
+static inline void getri_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<double> &a,
+                               std::int64_t lda, std::int64_t stride_a,
+                               sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                               std::int64_t batch_size) {
+    std::int64_t scratchpad_size = getri_batch_scratchpad_size<double>(queue, n, lda, stride_a,
+                                                                       stride_ipiv, batch_size);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    getri_batch(queue, n, a, lda, stride_a, ipiv, stride_ipiv, batch_size, scratchpad.get(),
+                scratchpad_size);
+}
+static inline void getri_batch(sycl::queue &queue, std::int64_t n,
+                               sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                               std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+                               std::int64_t stride_ipiv, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = getri_batch_scratchpad_size<std::complex<float>>(queue, n, lda,
+                                                                                    stride_a,
+                                                                                    stride_ipiv,
+                                                                                    batch_size);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    getri_batch(queue, n, a, lda, stride_a, ipiv, stride_ipiv, batch_size, scratchpad.get(),
+                scratchpad_size);
+}
+static inline void getri_batch(sycl::queue &queue, std::int64_t n,
+                               sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                               std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+                               std::int64_t stride_ipiv, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = getri_batch_scratchpad_size<std::complex<double>>(queue, n, lda,
+                                                                                     stride_a,
+                                                                                     stride_ipiv,
+                                                                                     batch_size);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    getri_batch(queue, n, a, lda, stride_a, ipiv, stride_ipiv, batch_size, scratchpad.get(),
+                scratchpad_size);
+}
+static inline void getrs_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                               std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                               std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+                               std::int64_t stride_ipiv, sycl::buffer<float> &b, std::int64_t ldb,
+                               std::int64_t stride_b, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = getrs_batch_scratchpad_size<float>(queue, trans, n, nrhs, lda,
+                                                                      stride_a, stride_ipiv, ldb,
+                                                                      stride_b, batch_size);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    getrs_batch(queue, trans, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b, ldb, stride_b,
+                batch_size, scratchpad.get(), scratchpad_size);
+}
+static inline void getrs_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                               std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                               std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+                               std::int64_t stride_ipiv, sycl::buffer<double> &b, std::int64_t ldb,
+                               std::int64_t stride_b, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = getrs_batch_scratchpad_size<double>(queue, trans, n, nrhs, lda,
+                                                                       stride_a, stride_ipiv, ldb,
+                                                                       stride_b, batch_size);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    getrs_batch(queue, trans, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b, ldb, stride_b,
+                batch_size, scratchpad.get(), scratchpad_size);
+}
+static inline void getrs_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                               std::int64_t nrhs, sycl::buffer<std::complex<float>> &a,
+                               std::int64_t lda, std::int64_t stride_a,
+                               sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                               sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                               std::int64_t stride_b, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = getrs_batch_scratchpad_size<std::complex<float>>(queue, trans, n,
+                                                                                    nrhs, lda,
+                                                                                    stride_a,
+                                                                                    stride_ipiv,
+                                                                                    ldb, stride_b,
+                                                                                    batch_size);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    getrs_batch(queue, trans, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b, ldb, stride_b,
+                batch_size, scratchpad.get(), scratchpad_size);
+}
+static inline void getrs_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                               std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
+                               std::int64_t lda, std::int64_t stride_a,
+                               sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                               sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                               std::int64_t stride_b, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = getrs_batch_scratchpad_size<std::complex<double>>(queue, trans,
+                                                                                     n, nrhs, lda,
+                                                                                     stride_a,
+                                                                                     stride_ipiv,
+                                                                                     ldb, stride_b,
+                                                                                     batch_size);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    getrs_batch(queue, trans, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b, ldb, stride_b,
+                batch_size, scratchpad.get(), scratchpad_size);
+}
+static inline void gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                              sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                              sycl::buffer<float> &b, std::int64_t ldb, std::int64_t stride_b,
+                              std::int64_t batch_size) {
+    std::int64_t scratchpad_size = gesv_batch_scratchpad_size<float>(queue, n, nrhs, lda, stride_a,
+                                                                     stride_ipiv, ldb, stride_b,
+                                                                     batch_size);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    gesv_batch(queue, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b, ldb, stride_b, batch_size,
+               scratchpad.get(), scratchpad_size);
+}
+static inline void gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                              sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                              sycl::buffer<double> &b, std::int64_t ldb, std::int64_t stride_b,
+                              std::int64_t batch_size) {
+    std::int64_t scratchpad_size = gesv_batch_scratchpad_size<double>(queue, n, nrhs, lda, stride_a,
+                                                                      stride_ipiv, ldb, stride_b,
+                                                                      batch_size);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    gesv_batch(queue, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b, ldb, stride_b, batch_size,
+               scratchpad.get(), scratchpad_size);
+}
+static inline void gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+                              std::int64_t stride_ipiv, sycl::buffer<std::complex<float>> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = gesv_batch_scratchpad_size<std::complex<float>>(
+        queue, n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, batch_size);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    gesv_batch(queue, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b, ldb, stride_b, batch_size,
+               scratchpad.get(), scratchpad_size);
+}
+static inline void gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+                              std::int64_t stride_ipiv, sycl::buffer<std::complex<double>> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = gesv_batch_scratchpad_size<std::complex<double>>(
+        queue, n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, batch_size);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    gesv_batch(queue, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b, ldb, stride_b, batch_size,
+               scratchpad.get(), scratchpad_size);
+}
+static inline void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                              std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a,
+                              std::int64_t lda, std::int64_t stride_a, sycl::buffer<float> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = gels_batch_scratchpad_size<float>(queue, trans, m, n, nrhs, lda,
+                                                                     stride_a, ldb, stride_b,
+                                                                     batch_size);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    gels_batch(queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb, stride_b, batch_size,
+               scratchpad.get(), scratchpad_size);
+}
+static inline void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                              std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a,
+                              std::int64_t lda, std::int64_t stride_a, sycl::buffer<double> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = gels_batch_scratchpad_size<double>(queue, trans, m, n, nrhs, lda,
+                                                                      stride_a, ldb, stride_b,
+                                                                      batch_size);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    gels_batch(queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb, stride_b, batch_size,
+               scratchpad.get(), scratchpad_size);
+}
+static inline void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                              std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<std::complex<float>> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = gels_batch_scratchpad_size<std::complex<float>>(
+        queue, trans, m, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    gels_batch(queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb, stride_b, batch_size,
+               scratchpad.get(), scratchpad_size);
+}
+static inline void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                              std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<std::complex<double>> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = gels_batch_scratchpad_size<std::complex<double>>(
+        queue, trans, m, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    gels_batch(queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb, stride_b, batch_size,
+               scratchpad.get(), scratchpad_size);
+}
+static inline void heevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                               std::int64_t n, sycl::buffer<std::complex<float>> &a,
+                               std::int64_t lda, std::int64_t stride_a, sycl::buffer<float> &w,
+                               std::int64_t stride_w, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = heevd_batch_scratchpad_size<std::complex<float>>(
+        queue, jobz, uplo, n, lda, stride_a, stride_w, batch_size);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    heevd_batch(queue, jobz, uplo, n, a, lda, stride_a, w, stride_w, batch_size, scratchpad.get(),
+                scratchpad_size);
+}
+static inline void heevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                               std::int64_t n, sycl::buffer<std::complex<double>> &a,
+                               std::int64_t lda, std::int64_t stride_a, sycl::buffer<double> &w,
+                               std::int64_t stride_w, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = heevd_batch_scratchpad_size<std::complex<double>>(
+        queue, jobz, uplo, n, lda, stride_a, stride_w, batch_size);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    heevd_batch(queue, jobz, uplo, n, a, lda, stride_a, w, stride_w, batch_size, scratchpad.get(),
+                scratchpad_size);
+}
+static inline void getrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                               sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                               sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                               std::int64_t batch_size) {
+    std::int64_t scratchpad_size = getrf_batch_scratchpad_size<float>(queue, m, n, lda, stride_a,
+                                                                      stride_ipiv, batch_size);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    getrf_batch(queue, m, n, a, lda, stride_a, ipiv, stride_ipiv, batch_size, scratchpad.get(),
+                scratchpad_size);
+}
+static inline void getrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                               sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                               sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                               std::int64_t batch_size) {
+    std::int64_t scratchpad_size = getrf_batch_scratchpad_size<double>(queue, m, n, lda, stride_a,
+                                                                       stride_ipiv, batch_size);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    getrf_batch(queue, m, n, a, lda, stride_a, ipiv, stride_ipiv, batch_size, scratchpad.get(),
+                scratchpad_size);
+}
+static inline void getrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                               sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                               std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+                               std::int64_t stride_ipiv, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = getrf_batch_scratchpad_size<std::complex<float>>(queue, m, n,
+                                                                                    lda, stride_a,
+                                                                                    stride_ipiv,
+                                                                                    batch_size);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    getrf_batch(queue, m, n, a, lda, stride_a, ipiv, stride_ipiv, batch_size, scratchpad.get(),
+                scratchpad_size);
+}
+static inline void getrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                               sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                               std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+                               std::int64_t stride_ipiv, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = getrf_batch_scratchpad_size<std::complex<double>>(queue, m, n,
+                                                                                     lda, stride_a,
+                                                                                     stride_ipiv,
+                                                                                     batch_size);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    getrf_batch(queue, m, n, a, lda, stride_a, ipiv, stride_ipiv, batch_size, scratchpad.get(),
+                scratchpad_size);
+}
+static inline void orgqr_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
+                               sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                               sycl::buffer<float> &tau, std::int64_t stride_tau,
+                               std::int64_t batch_size) {
+    std::int64_t scratchpad_size = orgqr_batch_scratchpad_size<float>(queue, m, n, k, lda, stride_a,
+                                                                      stride_tau, batch_size);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    orgqr_batch(queue, m, n, k, a, lda, stride_a, tau, stride_tau, batch_size, scratchpad.get(),
+                scratchpad_size);
+}
+static inline void orgqr_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
+                               sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                               sycl::buffer<double> &tau, std::int64_t stride_tau,
+                               std::int64_t batch_size) {
+    std::int64_t scratchpad_size = orgqr_batch_scratchpad_size<double>(queue, m, n, k, lda,
+                                                                       stride_a, stride_tau,
+                                                                       batch_size);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    orgqr_batch(queue, m, n, k, a, lda, stride_a, tau, stride_tau, batch_size, scratchpad.get(),
+                scratchpad_size);
+}
+static inline void potrf_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                               std::int64_t batch_size) {
+    std::int64_t scratchpad_size = potrf_batch_scratchpad_size<float>(queue, uplo, n, lda, stride_a,
+                                                                      batch_size);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    potrf_batch(queue, uplo, n, a, lda, stride_a, batch_size, scratchpad.get(), scratchpad_size);
+}
+static inline void potrf_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                               std::int64_t batch_size) {
+    std::int64_t scratchpad_size = potrf_batch_scratchpad_size<double>(queue, uplo, n, lda,
+                                                                       stride_a, batch_size);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    potrf_batch(queue, uplo, n, a, lda, stride_a, batch_size, scratchpad.get(), scratchpad_size);
+}
+static inline void potrf_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                               std::int64_t stride_a, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = potrf_batch_scratchpad_size<std::complex<float>>(queue, uplo, n,
+                                                                                    lda, stride_a,
+                                                                                    batch_size);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    potrf_batch(queue, uplo, n, a, lda, stride_a, batch_size, scratchpad.get(), scratchpad_size);
+}
+static inline void potrf_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                               std::int64_t stride_a, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = potrf_batch_scratchpad_size<std::complex<double>>(queue, uplo, n,
+                                                                                     lda, stride_a,
+                                                                                     batch_size);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    potrf_batch(queue, uplo, n, a, lda, stride_a, batch_size, scratchpad.get(), scratchpad_size);
+}
+static inline void potrs_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                               std::int64_t stride_a, sycl::buffer<float> &b, std::int64_t ldb,
+                               std::int64_t stride_b, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = potrs_batch_scratchpad_size<float>(queue, uplo, n, nrhs, lda,
+                                                                      stride_a, ldb, stride_b,
+                                                                      batch_size);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    potrs_batch(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b, batch_size,
+                scratchpad.get(), scratchpad_size);
+}
+static inline void potrs_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                               std::int64_t stride_a, sycl::buffer<double> &b, std::int64_t ldb,
+                               std::int64_t stride_b, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = potrs_batch_scratchpad_size<double>(queue, uplo, n, nrhs, lda,
+                                                                       stride_a, ldb, stride_b,
+                                                                       batch_size);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    potrs_batch(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b, batch_size,
+                scratchpad.get(), scratchpad_size);
+}
+static inline void potrs_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, sycl::buffer<std::complex<float>> &a,
+                               std::int64_t lda, std::int64_t stride_a,
+                               sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                               std::int64_t stride_b, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = potrs_batch_scratchpad_size<std::complex<float>>(queue, uplo, n,
+                                                                                    nrhs, lda,
+                                                                                    stride_a, ldb,
+                                                                                    stride_b,
+                                                                                    batch_size);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    potrs_batch(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b, batch_size,
+                scratchpad.get(), scratchpad_size);
+}
+static inline void potrs_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
+                               std::int64_t lda, std::int64_t stride_a,
+                               sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                               std::int64_t stride_b, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = potrs_batch_scratchpad_size<std::complex<double>>(queue, uplo, n,
+                                                                                     nrhs, lda,
+                                                                                     stride_a, ldb,
+                                                                                     stride_b,
+                                                                                     batch_size);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    potrs_batch(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b, batch_size,
+                scratchpad.get(), scratchpad_size);
+}
+static inline void posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<float> &b, std::int64_t ldb,
+                              std::int64_t stride_b, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = posv_batch_scratchpad_size<float>(queue, uplo, n, nrhs, lda,
+                                                                     stride_a, ldb, stride_b,
+                                                                     batch_size);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    posv_batch(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b, batch_size,
+               scratchpad.get(), scratchpad_size);
+}
+static inline void posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<double> &b, std::int64_t ldb,
+                              std::int64_t stride_b, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = posv_batch_scratchpad_size<double>(queue, uplo, n, nrhs, lda,
+                                                                      stride_a, ldb, stride_b,
+                                                                      batch_size);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    posv_batch(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b, batch_size,
+               scratchpad.get(), scratchpad_size);
+}
+static inline void posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<std::complex<float>> &a,
+                              std::int64_t lda, std::int64_t stride_a,
+                              sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                              std::int64_t stride_b, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = posv_batch_scratchpad_size<std::complex<float>>(
+        queue, uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    posv_batch(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b, batch_size,
+               scratchpad.get(), scratchpad_size);
+}
+static inline void posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
+                              std::int64_t lda, std::int64_t stride_a,
+                              sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                              std::int64_t stride_b, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = posv_batch_scratchpad_size<std::complex<double>>(
+        queue, uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    posv_batch(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b, batch_size,
+               scratchpad.get(), scratchpad_size);
+}
+static inline void syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                               std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+                               std::int64_t stride_a, sycl::buffer<float> &w, std::int64_t stride_w,
+                               std::int64_t batch_size) {
+    std::int64_t scratchpad_size = syevd_batch_scratchpad_size<float>(queue, jobz, uplo, n, lda,
+                                                                      stride_a, stride_w,
+                                                                      batch_size);
+    detail::workspace_buffer<float> scratchpad(queue, scratchpad_size);
+    syevd_batch(queue, jobz, uplo, n, a, lda, stride_a, w, stride_w, batch_size, scratchpad.get(),
+                scratchpad_size);
+}
+static inline void syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                               std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+                               std::int64_t stride_a, sycl::buffer<double> &w,
+                               std::int64_t stride_w, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = syevd_batch_scratchpad_size<double>(queue, jobz, uplo, n, lda,
+                                                                       stride_a, stride_w,
+                                                                       batch_size);
+    detail::workspace_buffer<double> scratchpad(queue, scratchpad_size);
+    syevd_batch(queue, jobz, uplo, n, a, lda, stride_a, w, stride_w, batch_size, scratchpad.get(),
+                scratchpad_size);
+}
+static inline void ungqr_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
+                               sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                               std::int64_t stride_a, sycl::buffer<std::complex<float>> &tau,
+                               std::int64_t stride_tau, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = ungqr_batch_scratchpad_size<std::complex<float>>(queue, m, n, k,
+                                                                                    lda, stride_a,
+                                                                                    stride_tau,
+                                                                                    batch_size);
+    detail::workspace_buffer<std::complex<float>> scratchpad(queue, scratchpad_size);
+    ungqr_batch(queue, m, n, k, a, lda, stride_a, tau, stride_tau, batch_size, scratchpad.get(),
+                scratchpad_size);
+}
+static inline void ungqr_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
+                               sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                               std::int64_t stride_a, sycl::buffer<std::complex<double>> &tau,
+                               std::int64_t stride_tau, std::int64_t batch_size) {
+    std::int64_t scratchpad_size = ungqr_batch_scratchpad_size<std::complex<double>>(queue, m, n, k,
+                                                                                     lda, stride_a,
+                                                                                     stride_tau,
+                                                                                     batch_size);
+    detail::workspace_buffer<std::complex<double>> scratchpad(queue, scratchpad_size);
+    ungqr_batch(queue, m, n, k, a, lda, stride_a, tau, stride_tau, batch_size, scratchpad.get(),
+                scratchpad_size);
+}
+static inline sycl::event gebrd(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::complex<float> *a, std::int64_t lda, float *d, float *e,
+                                std::complex<float> *tauq, std::complex<float> *taup,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gebrd_scratchpad_size<std::complex<float>>(queue, m, n, lda);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gebrd(queue, m, n, a, lda, d, e, tauq, taup, scratchpad.get(),
+                                    scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event gebrd(sycl::queue &queue, std::int64_t m, std::int64_t n, double *a,
+                                std::int64_t lda, double *d, double *e, double *tauq, double *taup,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gebrd_scratchpad_size<double>(queue, m, n, lda);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gebrd(queue, m, n, a, lda, d, e, tauq, taup, scratchpad.get(),
+                                    scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event gebrd(sycl::queue &queue, std::int64_t m, std::int64_t n, float *a,
+                                std::int64_t lda, float *d, float *e, float *tauq, float *taup,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gebrd_scratchpad_size<float>(queue, m, n, lda);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gebrd(queue, m, n, a, lda, d, e, tauq, taup, scratchpad.get(),
+                                    scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event gebrd(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::complex<double> *a, std::int64_t lda, double *d, double *e,
+                                std::complex<double> *tauq, std::complex<double> *taup,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gebrd_scratchpad_size<std::complex<double>>(queue, m, n, lda);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gebrd(queue, m, n, a, lda, d, e, tauq, taup, scratchpad.get(),
+                                    scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                               std::int64_t n, std::int64_t nrhs, float *a, std::int64_t lda,
+                               float *b, std::int64_t ldb,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gels_scratchpad_size<float>(queue, trans, m, n, nrhs, lda, ldb);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gels(queue, trans, m, n, nrhs, a, lda, b, ldb, scratchpad.get(),
+                                   scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                               std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda,
+                               double *b, std::int64_t ldb,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gels_scratchpad_size<double>(queue, trans, m, n, nrhs, lda, ldb);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gels(queue, trans, m, n, nrhs, a, lda, b, ldb, scratchpad.get(),
+                                   scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                               std::int64_t n, std::int64_t nrhs, std::complex<float> *a,
+                               std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gels_scratchpad_size<std::complex<float>>(queue, trans, m, n,
+                                                                             nrhs, lda, ldb);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gels(queue, trans, m, n, nrhs, a, lda, b, ldb, scratchpad.get(),
+                                   scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                               std::int64_t n, std::int64_t nrhs, std::complex<double> *a,
+                               std::int64_t lda, std::complex<double> *b, std::int64_t ldb,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gels_scratchpad_size<std::complex<double>>(queue, trans, m, n,
+                                                                              nrhs, lda, ldb);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gels(queue, trans, m, n, nrhs, a, lda, b, ldb, scratchpad.get(),
+                                   scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t nrhs, float *a, std::int64_t lda, float *b,
+                                std::int64_t ldb, float *s, float rcond, std::int64_t *rank,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gelsd_scratchpad_size<float>(queue, m, n, nrhs, lda, ldb);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gelsd(queue, m, n, nrhs, a, lda, b, ldb, s, rcond, rank,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t nrhs, double *a, std::int64_t lda, double *b,
+                                std::int64_t ldb, double *s, double rcond, std::int64_t *rank,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gelsd_scratchpad_size<double>(queue, m, n, nrhs, lda, ldb);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gelsd(queue, m, n, nrhs, a, lda, b, ldb, s, rcond, rank,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                                std::complex<float> *b, std::int64_t ldb, float *s, float rcond,
+                                std::int64_t *rank,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gelsd_scratchpad_size<std::complex<float>>(queue, m, n, nrhs,
+                                                                              lda, ldb);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gelsd(queue, m, n, nrhs, a, lda, b, ldb, s, rcond, rank,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                                std::complex<double> *b, std::int64_t ldb, double *s, double rcond,
+                                std::int64_t *rank,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gelsd_scratchpad_size<std::complex<double>>(queue, m, n, nrhs,
+                                                                               lda, ldb);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gelsd(queue, m, n, nrhs, a, lda, b, ldb, s, rcond, rank,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event gerqf(sycl::queue &queue, std::int64_t m, std::int64_t n, float *a,
+                                std::int64_t lda, float *tau,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gerqf_scratchpad_size<float>(queue, m, n, lda);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gerqf(queue, m, n, a, lda, tau, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event gerqf(sycl::queue &queue, std::int64_t m, std::int64_t n, double *a,
+                                std::int64_t lda, double *tau,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gerqf_scratchpad_size<double>(queue, m, n, lda);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gerqf(queue, m, n, a, lda, tau, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event gerqf(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::complex<float> *a, std::int64_t lda, std::complex<float> *tau,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gerqf_scratchpad_size<std::complex<float>>(queue, m, n, lda);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gerqf(queue, m, n, a, lda, tau, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event gerqf(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::complex<double> *a, std::int64_t lda,
+                                std::complex<double> *tau,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gerqf_scratchpad_size<std::complex<double>>(queue, m, n, lda);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gerqf(queue, m, n, a, lda, tau, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event geqrf(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::complex<float> *a, std::int64_t lda, std::complex<float> *tau,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = geqrf_scratchpad_size<std::complex<float>>(queue, m, n, lda);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(geqrf(queue, m, n, a, lda, tau, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event geqrf(sycl::queue &queue, std::int64_t m, std::int64_t n, double *a,
+                                std::int64_t lda, double *tau,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = geqrf_scratchpad_size<double>(queue, m, n, lda);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(geqrf(queue, m, n, a, lda, tau, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event geqrf(sycl::queue &queue, std::int64_t m, std::int64_t n, float *a,
+                                std::int64_t lda, float *tau,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = geqrf_scratchpad_size<float>(queue, m, n, lda);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(geqrf(queue, m, n, a, lda, tau, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event geqrf(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::complex<double> *a, std::int64_t lda,
+                                std::complex<double> *tau,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = geqrf_scratchpad_size<std::complex<double>>(queue, m, n, lda);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(geqrf(queue, m, n, a, lda, tau, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event getrf(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::complex<float> *a, std::int64_t lda, std::int64_t *ipiv,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getrf_scratchpad_size<std::complex<float>>(queue, m, n, lda);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getrf(queue, m, n, a, lda, ipiv, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event getrf(sycl::queue &queue, std::int64_t m, std::int64_t n, double *a,
+                                std::int64_t lda, std::int64_t *ipiv,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getrf_scratchpad_size<double>(queue, m, n, lda);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getrf(queue, m, n, a, lda, ipiv, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event getrf(sycl::queue &queue, std::int64_t m, std::int64_t n, float *a,
+                                std::int64_t lda, std::int64_t *ipiv,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getrf_scratchpad_size<float>(queue, m, n, lda);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getrf(queue, m, n, a, lda, ipiv, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event getrf(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::complex<double> *a, std::int64_t lda, std::int64_t *ipiv,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getrf_scratchpad_size<std::complex<double>>(queue, m, n, lda);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getrf(queue, m, n, a, lda, ipiv, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event getri(sycl::queue &queue, std::int64_t n, std::complex<float> *a,
+                                std::int64_t lda, std::int64_t *ipiv,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getri_scratchpad_size<std::complex<float>>(queue, n, lda);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getri(queue, n, a, lda, ipiv, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event getri(sycl::queue &queue, std::int64_t n, double *a, std::int64_t lda,
+                                std::int64_t *ipiv,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getri_scratchpad_size<double>(queue, n, lda);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getri(queue, n, a, lda, ipiv, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event getri(sycl::queue &queue, std::int64_t n, float *a, std::int64_t lda,
+                                std::int64_t *ipiv,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getri_scratchpad_size<float>(queue, n, lda);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getri(queue, n, a, lda, ipiv, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event getri(sycl::queue &queue, std::int64_t n, std::complex<double> *a,
+                                std::int64_t lda, std::int64_t *ipiv,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getri_scratchpad_size<std::complex<double>>(queue, n, lda);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getri(queue, n, a, lda, ipiv, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event getrs(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                                std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                                std::int64_t *ipiv, std::complex<float> *b, std::int64_t ldb,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getrs_scratchpad_size<std::complex<float>>(queue, trans, n, nrhs,
+                                                                              lda, ldb);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getrs(queue, trans, n, nrhs, a, lda, ipiv, b, ldb, scratchpad.get(),
+                                    scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event getrs(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                                std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t *ipiv,
+                                double *b, std::int64_t ldb,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getrs_scratchpad_size<double>(queue, trans, n, nrhs, lda, ldb);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getrs(queue, trans, n, nrhs, a, lda, ipiv, b, ldb, scratchpad.get(),
+                                    scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event getrs(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                                std::int64_t nrhs, float *a, std::int64_t lda, std::int64_t *ipiv,
+                                float *b, std::int64_t ldb,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getrs_scratchpad_size<float>(queue, trans, n, nrhs, lda, ldb);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getrs(queue, trans, n, nrhs, a, lda, ipiv, b, ldb, scratchpad.get(),
+                                    scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event getrs(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                                std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                                std::int64_t *ipiv, std::complex<double> *b, std::int64_t ldb,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getrs_scratchpad_size<std::complex<double>>(queue, trans, n,
+                                                                               nrhs, lda, ldb);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getrs(queue, trans, n, nrhs, a, lda, ipiv, b, ldb, scratchpad.get(),
+                                    scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, float *a,
+                               std::int64_t lda, std::int64_t *ipiv, float *b, std::int64_t ldb,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gesv_scratchpad_size<float>(queue, n, nrhs, lda, ldb);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gesv(queue, n, nrhs, a, lda, ipiv, b, ldb, scratchpad.get(),
+                                   scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, double *a,
+                               std::int64_t lda, std::int64_t *ipiv, double *b, std::int64_t ldb,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gesv_scratchpad_size<double>(queue, n, nrhs, lda, ldb);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gesv(queue, n, nrhs, a, lda, ipiv, b, ldb, scratchpad.get(),
+                                   scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                               std::complex<float> *a, std::int64_t lda, std::int64_t *ipiv,
+                               std::complex<float> *b, std::int64_t ldb,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gesv_scratchpad_size<std::complex<float>>(queue, n, nrhs, lda,
+                                                                             ldb);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gesv(queue, n, nrhs, a, lda, ipiv, b, ldb, scratchpad.get(),
+                                   scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                               std::complex<double> *a, std::int64_t lda, std::int64_t *ipiv,
+                               std::complex<double> *b, std::int64_t ldb,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gesv_scratchpad_size<std::complex<double>>(queue, n, nrhs, lda,
+                                                                              ldb);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gesv(queue, n, nrhs, a, lda, ipiv, b, ldb, scratchpad.get(),
+                                   scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event gesvd(sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+                                oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n,
+                                double *a, std::int64_t lda, double *s, double *u, std::int64_t ldu,
+                                double *vt, std::int64_t ldvt,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gesvd_scratchpad_size<double>(queue, jobu, jobvt, m, n, lda, ldu,
+                                                                 ldvt);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gesvd(queue, jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event gesvd(sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+                                oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, float *a,
+                                std::int64_t lda, float *s, float *u, std::int64_t ldu, float *vt,
+                                std::int64_t ldvt,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gesvd_scratchpad_size<float>(queue, jobu, jobvt, m, n, lda, ldu,
+                                                                ldvt);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gesvd(queue, jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event gesvd(sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+                                oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n,
+                                std::complex<float> *a, std::int64_t lda, float *s,
+                                std::complex<float> *u, std::int64_t ldu, std::complex<float> *vt,
+                                std::int64_t ldvt,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gesvd_scratchpad_size<std::complex<float>>(queue, jobu, jobvt, m,
+                                                                              n, lda, ldu, ldvt);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gesvd(queue, jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event gesvd(sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+                                oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n,
+                                std::complex<double> *a, std::int64_t lda, double *s,
+                                std::complex<double> *u, std::int64_t ldu, std::complex<double> *vt,
+                                std::int64_t ldvt,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gesvd_scratchpad_size<std::complex<double>>(queue, jobu, jobvt,
+                                                                               m, n, lda, ldu,
+                                                                               ldvt);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gesvd(queue, jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event heevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                                std::int64_t n, std::complex<float> *a, std::int64_t lda, float *w,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = heevd_scratchpad_size<std::complex<float>>(queue, jobz, uplo, n,
+                                                                              lda);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(heevd(queue, jobz, uplo, n, a, lda, w, scratchpad.get(),
+                                    scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event heevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                                std::int64_t n, std::complex<double> *a, std::int64_t lda,
+                                double *w,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = heevd_scratchpad_size<std::complex<double>>(queue, jobz, uplo, n,
+                                                                               lda);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(heevd(queue, jobz, uplo, n, a, lda, w, scratchpad.get(),
+                                    scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event heevr(sycl::queue &queue, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<float> *a, std::int64_t lda, float vl, float vu,
+                                std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m,
+                                float *w, std::complex<float> *z, std::int64_t ldz,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = heevr_scratchpad_size<std::complex<float>>(queue, jobz, range,
+                                                                              uplo, n, lda, ldz);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(heevr(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m,
+                                    w, z, ldz, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event heevr(sycl::queue &queue, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<double> *a, std::int64_t lda, double vl, double vu,
+                                std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+                                double *w, std::complex<double> *z, std::int64_t ldz,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = heevr_scratchpad_size<std::complex<double>>(queue, jobz, range,
+                                                                               uplo, n, lda, ldz);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(heevr(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m,
+                                    w, z, ldz, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event heevx(sycl::queue &queue, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<float> *a, std::int64_t lda, float vl, float vu,
+                                std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m,
+                                float *w, std::complex<float> *z, std::int64_t ldz,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = heevx_scratchpad_size<std::complex<float>>(queue, jobz, range,
+                                                                              uplo, n, lda, ldz);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(heevx(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m,
+                                    w, z, ldz, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event heevx(sycl::queue &queue, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<double> *a, std::int64_t lda, double vl, double vu,
+                                std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+                                double *w, std::complex<double> *z, std::int64_t ldz,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = heevx_scratchpad_size<std::complex<double>>(queue, jobz, range,
+                                                                               uplo, n, lda, ldz);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(heevx(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m,
+                                    w, z, ldz, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event hegvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
+                                oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a,
+                                std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
+                                float *w,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = hegvd_scratchpad_size<std::complex<float>>(queue, itype, jobz,
+                                                                              uplo, n, lda, ldb);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(hegvd(queue, itype, jobz, uplo, n, a, lda, b, ldb, w,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event hegvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
+                                oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a,
+                                std::int64_t lda, std::complex<double> *b, std::int64_t ldb,
+                                double *w,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = hegvd_scratchpad_size<std::complex<double>>(queue, itype, jobz,
+                                                                               uplo, n, lda, ldb);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(hegvd(queue, itype, jobz, uplo, n, a, lda, b, ldb, w,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event hetrd(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<float> *a, std::int64_t lda, float *d, float *e,
+                                std::complex<float> *tau,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = hetrd_scratchpad_size<std::complex<float>>(queue, uplo, n, lda);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(hetrd(queue, uplo, n, a, lda, d, e, tau, scratchpad.get(),
+                                    scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event hetrd(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<double> *a, std::int64_t lda, double *d, double *e,
+                                std::complex<double> *tau,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = hetrd_scratchpad_size<std::complex<double>>(queue, uplo, n, lda);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(hetrd(queue, uplo, n, a, lda, d, e, tau, scratchpad.get(),
+                                    scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event hetrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<float> *a, std::int64_t lda, std::int64_t *ipiv,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = hetrf_scratchpad_size<std::complex<float>>(queue, uplo, n, lda);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(hetrf(queue, uplo, n, a, lda, ipiv, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event hetrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<double> *a, std::int64_t lda, std::int64_t *ipiv,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = hetrf_scratchpad_size<std::complex<double>>(queue, uplo, n, lda);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(hetrf(queue, uplo, n, a, lda, ipiv, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event orgbr(sycl::queue &queue, oneapi::mkl::generate vec, std::int64_t m,
+                                std::int64_t n, std::int64_t k, float *a, std::int64_t lda,
+                                float *tau,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = orgbr_scratchpad_size<float>(queue, vec, m, n, k, lda);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(orgbr(queue, vec, m, n, k, a, lda, tau, scratchpad.get(),
+                                    scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event orgbr(sycl::queue &queue, oneapi::mkl::generate vec, std::int64_t m,
+                                std::int64_t n, std::int64_t k, double *a, std::int64_t lda,
+                                double *tau,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = orgbr_scratchpad_size<double>(queue, vec, m, n, k, lda);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(orgbr(queue, vec, m, n, k, a, lda, tau, scratchpad.get(),
+                                    scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event orgqr(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
+                                double *a, std::int64_t lda, double *tau,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = orgqr_scratchpad_size<double>(queue, m, n, k, lda);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(orgqr(queue, m, n, k, a, lda, tau, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event orgqr(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
+                                float *a, std::int64_t lda, float *tau,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = orgqr_scratchpad_size<float>(queue, m, n, k, lda);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(orgqr(queue, m, n, k, a, lda, tau, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event orgtr(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                float *a, std::int64_t lda, float *tau,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = orgtr_scratchpad_size<float>(queue, uplo, n, lda);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(orgtr(queue, uplo, n, a, lda, tau, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event orgtr(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                double *a, std::int64_t lda, double *tau,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = orgtr_scratchpad_size<double>(queue, uplo, n, lda);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(orgtr(queue, uplo, n, a, lda, tau, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event ormtr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+                                oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                float *a, std::int64_t lda, float *tau, float *c, std::int64_t ldc,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = ormtr_scratchpad_size<float>(queue, side, uplo, trans, m, n, lda,
+                                                                ldc);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(ormtr(queue, side, uplo, trans, m, n, a, lda, tau, c, ldc,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event ormtr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+                                oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                double *a, std::int64_t lda, double *tau, double *c,
+                                std::int64_t ldc,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = ormtr_scratchpad_size<double>(queue, side, uplo, trans, m, n,
+                                                                 lda, ldc);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(ormtr(queue, side, uplo, trans, m, n, a, lda, tau, c, ldc,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event ormrq(sycl::queue &queue, oneapi::mkl::side side,
+                                oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                std::int64_t k, float *a, std::int64_t lda, float *tau, float *c,
+                                std::int64_t ldc,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = ormrq_scratchpad_size<float>(queue, side, trans, m, n, k, lda,
+                                                                ldc);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(ormrq(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event ormrq(sycl::queue &queue, oneapi::mkl::side side,
+                                oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                std::int64_t k, double *a, std::int64_t lda, double *tau, double *c,
+                                std::int64_t ldc,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = ormrq_scratchpad_size<double>(queue, side, trans, m, n, k, lda,
+                                                                 ldc);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(ormrq(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event ormqr(sycl::queue &queue, oneapi::mkl::side side,
+                                oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                std::int64_t k, double *a, std::int64_t lda, double *tau, double *c,
+                                std::int64_t ldc,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = ormqr_scratchpad_size<double>(queue, side, trans, m, n, k, lda,
+                                                                 ldc);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(ormqr(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event ormqr(sycl::queue &queue, oneapi::mkl::side side,
+                                oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                std::int64_t k, float *a, std::int64_t lda, float *tau, float *c,
+                                std::int64_t ldc,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = ormqr_scratchpad_size<float>(queue, side, trans, m, n, k, lda,
+                                                                ldc);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(ormqr(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event potrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                float *a, std::int64_t lda,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potrf_scratchpad_size<float>(queue, uplo, n, lda);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potrf(queue, uplo, n, a, lda, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event potrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                double *a, std::int64_t lda,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potrf_scratchpad_size<double>(queue, uplo, n, lda);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potrf(queue, uplo, n, a, lda, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event potrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<float> *a, std::int64_t lda,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potrf_scratchpad_size<std::complex<float>>(queue, uplo, n, lda);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potrf(queue, uplo, n, a, lda, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event potrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<double> *a, std::int64_t lda,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potrf_scratchpad_size<std::complex<double>>(queue, uplo, n, lda);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potrf(queue, uplo, n, a, lda, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event potri(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                float *a, std::int64_t lda,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potri_scratchpad_size<float>(queue, uplo, n, lda);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potri(queue, uplo, n, a, lda, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event potri(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                double *a, std::int64_t lda,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potri_scratchpad_size<double>(queue, uplo, n, lda);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potri(queue, uplo, n, a, lda, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event potri(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<float> *a, std::int64_t lda,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potri_scratchpad_size<std::complex<float>>(queue, uplo, n, lda);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potri(queue, uplo, n, a, lda, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event potri(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<double> *a, std::int64_t lda,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potri_scratchpad_size<std::complex<double>>(queue, uplo, n, lda);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potri(queue, uplo, n, a, lda, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event potrs(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::int64_t nrhs, float *a, std::int64_t lda, float *b,
+                                std::int64_t ldb,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potrs_scratchpad_size<float>(queue, uplo, n, nrhs, lda, ldb);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potrs(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad.get(),
+                                    scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event potrs(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::int64_t nrhs, double *a, std::int64_t lda, double *b,
+                                std::int64_t ldb,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potrs_scratchpad_size<double>(queue, uplo, n, nrhs, lda, ldb);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potrs(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad.get(),
+                                    scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event potrs(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                                std::complex<float> *b, std::int64_t ldb,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potrs_scratchpad_size<std::complex<float>>(queue, uplo, n, nrhs,
+                                                                              lda, ldb);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potrs(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad.get(),
+                                    scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event potrs(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                                std::complex<double> *b, std::int64_t ldb,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potrs_scratchpad_size<std::complex<double>>(queue, uplo, n, nrhs,
+                                                                               lda, ldb);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potrs(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad.get(),
+                                    scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, float *a, std::int64_t lda, float *b,
+                               std::int64_t ldb,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = posv_scratchpad_size<float>(queue, uplo, n, nrhs, lda, ldb);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(posv(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad.get(),
+                                   scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, double *a, std::int64_t lda, double *b,
+                               std::int64_t ldb,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = posv_scratchpad_size<double>(queue, uplo, n, nrhs, lda, ldb);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(posv(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad.get(),
+                                   scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                               std::complex<float> *b, std::int64_t ldb,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = posv_scratchpad_size<std::complex<float>>(queue, uplo, n, nrhs,
+                                                                             lda, ldb);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(posv(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad.get(),
+                                   scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                               std::complex<double> *b, std::int64_t ldb,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = posv_scratchpad_size<std::complex<double>>(queue, uplo, n, nrhs,
+                                                                              lda, ldb);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(posv(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad.get(),
+                                   scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event syevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                                std::int64_t n, double *a, std::int64_t lda, double *w,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = syevd_scratchpad_size<double>(queue, jobz, uplo, n, lda);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(syevd(queue, jobz, uplo, n, a, lda, w, scratchpad.get(),
+                                    scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event syevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                                std::int64_t n, float *a, std::int64_t lda, float *w,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = syevd_scratchpad_size<float>(queue, jobz, uplo, n, lda);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(syevd(queue, jobz, uplo, n, a, lda, w, scratchpad.get(),
+                                    scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event syevr(sycl::queue &queue, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                float *a, std::int64_t lda, float vl, float vu, std::int64_t il,
+                                std::int64_t iu, float abstol, std::int64_t *m, float *w, float *z,
+                                std::int64_t ldz,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = syevr_scratchpad_size<float>(queue, jobz, range, uplo, n, lda,
+                                                                ldz);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(syevr(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m,
+                                    w, z, ldz, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event syevr(sycl::queue &queue, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                double *a, std::int64_t lda, double vl, double vu, std::int64_t il,
+                                std::int64_t iu, double abstol, std::int64_t *m, double *w,
+                                double *z, std::int64_t ldz,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = syevr_scratchpad_size<double>(queue, jobz, range, uplo, n, lda,
+                                                                 ldz);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(syevr(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m,
+                                    w, z, ldz, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event syevx(sycl::queue &queue, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                float *a, std::int64_t lda, float vl, float vu, std::int64_t il,
+                                std::int64_t iu, float abstol, std::int64_t *m, float *w, float *z,
+                                std::int64_t ldz,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = syevx_scratchpad_size<float>(queue, jobz, range, uplo, n, lda,
+                                                                ldz);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(syevx(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m,
+                                    w, z, ldz, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event syevx(sycl::queue &queue, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                double *a, std::int64_t lda, double vl, double vu, std::int64_t il,
+                                std::int64_t iu, double abstol, std::int64_t *m, double *w,
+                                double *z, std::int64_t ldz,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = syevx_scratchpad_size<double>(queue, jobz, range, uplo, n, lda,
+                                                                 ldz);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(syevx(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m,
+                                    w, z, ldz, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event sygvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
+                                oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda,
+                                double *b, std::int64_t ldb, double *w,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = sygvd_scratchpad_size<double>(queue, itype, jobz, uplo, n, lda,
+                                                                 ldb);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(sygvd(queue, itype, jobz, uplo, n, a, lda, b, ldb, w,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event sygvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
+                                oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda,
+                                float *b, std::int64_t ldb, float *w,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = sygvd_scratchpad_size<float>(queue, itype, jobz, uplo, n, lda,
+                                                                ldb);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(sygvd(queue, itype, jobz, uplo, n, a, lda, b, ldb, w,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event sytrd(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                double *a, std::int64_t lda, double *d, double *e, double *tau,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = sytrd_scratchpad_size<double>(queue, uplo, n, lda);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(sytrd(queue, uplo, n, a, lda, d, e, tau, scratchpad.get(),
+                                    scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event sytrd(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                float *a, std::int64_t lda, float *d, float *e, float *tau,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = sytrd_scratchpad_size<float>(queue, uplo, n, lda);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(sytrd(queue, uplo, n, a, lda, d, e, tau, scratchpad.get(),
+                                    scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event sytrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                float *a, std::int64_t lda, std::int64_t *ipiv,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = sytrf_scratchpad_size<float>(queue, uplo, n, lda);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(sytrf(queue, uplo, n, a, lda, ipiv, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event sytrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                double *a, std::int64_t lda, std::int64_t *ipiv,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = sytrf_scratchpad_size<double>(queue, uplo, n, lda);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(sytrf(queue, uplo, n, a, lda, ipiv, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event sytrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<float> *a, std::int64_t lda, std::int64_t *ipiv,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = sytrf_scratchpad_size<std::complex<float>>(queue, uplo, n, lda);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(sytrf(queue, uplo, n, a, lda, ipiv, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event sytrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<double> *a, std::int64_t lda, std::int64_t *ipiv,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = sytrf_scratchpad_size<std::complex<double>>(queue, uplo, n, lda);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(sytrf(queue, uplo, n, a, lda, ipiv, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, float *a, std::int64_t lda, std::int64_t *ipiv,
+                               float *b, std::int64_t ldb,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = sysv_scratchpad_size<float>(queue, uplo, n, nrhs, lda, ldb);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(sysv(queue, uplo, n, nrhs, a, lda, ipiv, b, ldb, scratchpad.get(),
+                                   scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t *ipiv,
+                               double *b, std::int64_t ldb,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = sysv_scratchpad_size<double>(queue, uplo, n, nrhs, lda, ldb);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(sysv(queue, uplo, n, nrhs, a, lda, ipiv, b, ldb, scratchpad.get(),
+                                   scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                               std::int64_t *ipiv, std::complex<float> *b, std::int64_t ldb,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = sysv_scratchpad_size<std::complex<float>>(queue, uplo, n, nrhs,
+                                                                             lda, ldb);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(sysv(queue, uplo, n, nrhs, a, lda, ipiv, b, ldb, scratchpad.get(),
+                                   scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                               std::int64_t *ipiv, std::complex<double> *b, std::int64_t ldb,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = sysv_scratchpad_size<std::complex<double>>(queue, uplo, n, nrhs,
+                                                                              lda, ldb);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(sysv(queue, uplo, n, nrhs, a, lda, ipiv, b, ldb, scratchpad.get(),
+                                   scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event trtrs(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                oneapi::mkl::transpose trans, oneapi::mkl::diag diag,
+                                std::int64_t n, std::int64_t nrhs, std::complex<float> *a,
+                                std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = trtrs_scratchpad_size<std::complex<float>>(queue, uplo, trans,
+                                                                              diag, n, nrhs, lda,
+                                                                              ldb);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(trtrs(queue, uplo, trans, diag, n, nrhs, a, lda, b, ldb,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event trtrs(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                oneapi::mkl::transpose trans, oneapi::mkl::diag diag,
+                                std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda,
+                                double *b, std::int64_t ldb,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = trtrs_scratchpad_size<double>(queue, uplo, trans, diag, n, nrhs,
+                                                                 lda, ldb);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(trtrs(queue, uplo, trans, diag, n, nrhs, a, lda, b, ldb,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event trtrs(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                oneapi::mkl::transpose trans, oneapi::mkl::diag diag,
+                                std::int64_t n, std::int64_t nrhs, float *a, std::int64_t lda,
+                                float *b, std::int64_t ldb,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = trtrs_scratchpad_size<float>(queue, uplo, trans, diag, n, nrhs,
+                                                                lda, ldb);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(trtrs(queue, uplo, trans, diag, n, nrhs, a, lda, b, ldb,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event trtrs(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                oneapi::mkl::transpose trans, oneapi::mkl::diag diag,
+                                std::int64_t n, std::int64_t nrhs, std::complex<double> *a,
+                                std::int64_t lda, std::complex<double> *b, std::int64_t ldb,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = trtrs_scratchpad_size<std::complex<double>>(queue, uplo, trans,
+                                                                               diag, n, nrhs, lda,
+                                                                               ldb);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(trtrs(queue, uplo, trans, diag, n, nrhs, a, lda, b, ldb,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event ungbr(sycl::queue &queue, oneapi::mkl::generate vec, std::int64_t m,
+                                std::int64_t n, std::int64_t k, std::complex<float> *a,
+                                std::int64_t lda, std::complex<float> *tau,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = ungbr_scratchpad_size<std::complex<float>>(queue, vec, m, n, k,
+                                                                              lda);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(ungbr(queue, vec, m, n, k, a, lda, tau, scratchpad.get(),
+                                    scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event ungbr(sycl::queue &queue, oneapi::mkl::generate vec, std::int64_t m,
+                                std::int64_t n, std::int64_t k, std::complex<double> *a,
+                                std::int64_t lda, std::complex<double> *tau,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = ungbr_scratchpad_size<std::complex<double>>(queue, vec, m, n, k,
+                                                                               lda);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(ungbr(queue, vec, m, n, k, a, lda, tau, scratchpad.get(),
+                                    scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event ungqr(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
+                                std::complex<float> *a, std::int64_t lda, std::complex<float> *tau,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = ungqr_scratchpad_size<std::complex<float>>(queue, m, n, k, lda);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(ungqr(queue, m, n, k, a, lda, tau, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event ungqr(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
+                                std::complex<double> *a, std::int64_t lda,
+                                std::complex<double> *tau,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = ungqr_scratchpad_size<std::complex<double>>(queue, m, n, k, lda);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(ungqr(queue, m, n, k, a, lda, tau, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event ungtr(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<float> *a, std::int64_t lda, std::complex<float> *tau,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = ungtr_scratchpad_size<std::complex<float>>(queue, uplo, n, lda);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(ungtr(queue, uplo, n, a, lda, tau, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event ungtr(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<double> *a, std::int64_t lda,
+                                std::complex<double> *tau,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = ungtr_scratchpad_size<std::complex<double>>(queue, uplo, n, lda);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(ungtr(queue, uplo, n, a, lda, tau, scratchpad.get(), scratchpad_size,
+                                    scratchpad.dependencies()));
+}
+static inline sycl::event unmrq(sycl::queue &queue, oneapi::mkl::side side,
+                                oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                std::int64_t k, std::complex<float> *a, std::int64_t lda,
+                                std::complex<float> *tau, std::complex<float> *c, std::int64_t ldc,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = unmrq_scratchpad_size<std::complex<float>>(queue, side, trans, m,
+                                                                              n, k, lda, ldc);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(unmrq(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event unmrq(sycl::queue &queue, oneapi::mkl::side side,
+                                oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                std::int64_t k, std::complex<double> *a, std::int64_t lda,
+                                std::complex<double> *tau, std::complex<double> *c,
+                                std::int64_t ldc,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = unmrq_scratchpad_size<std::complex<double>>(queue, side, trans,
+                                                                               m, n, k, lda, ldc);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(unmrq(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event unmqr(sycl::queue &queue, oneapi::mkl::side side,
+                                oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                std::int64_t k, std::complex<float> *a, std::int64_t lda,
+                                std::complex<float> *tau, std::complex<float> *c, std::int64_t ldc,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = unmqr_scratchpad_size<std::complex<float>>(queue, side, trans, m,
+                                                                              n, k, lda, ldc);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(unmqr(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event unmqr(sycl::queue &queue, oneapi::mkl::side side,
+                                oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                std::int64_t k, std::complex<double> *a, std::int64_t lda,
+                                std::complex<double> *tau, std::complex<double> *c,
+                                std::int64_t ldc,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = unmqr_scratchpad_size<std::complex<double>>(queue, side, trans,
+                                                                               m, n, k, lda, ldc);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(unmqr(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event unmtr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+                                oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                std::complex<float> *a, std::int64_t lda, std::complex<float> *tau,
+                                std::complex<float> *c, std::int64_t ldc,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = unmtr_scratchpad_size<std::complex<float>>(queue, side, uplo,
+                                                                              trans, m, n, lda,
+                                                                              ldc);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(unmtr(queue, side, uplo, trans, m, n, a, lda, tau, c, ldc,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event unmtr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+                                oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                std::complex<double> *a, std::int64_t lda,
+                                std::complex<double> *tau, std::complex<double> *c,
+                                std::int64_t ldc,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = unmtr_scratchpad_size<std::complex<double>>(queue, side, uplo,
+                                                                               trans, m, n, lda,
+                                                                               ldc);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(unmtr(queue, side, uplo, trans, m, n, a, lda, tau, c, ldc,
+                                    scratchpad.get(), scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event geqrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, float *a,
+                                      std::int64_t lda, std::int64_t stride_a, float *tau,
+                                      std::int64_t stride_tau, std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = geqrf_batch_scratchpad_size<float>(queue, m, n, lda, stride_a,
+                                                                      stride_tau, batch_size);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(geqrf_batch(queue, m, n, a, lda, stride_a, tau, stride_tau,
+                                          batch_size, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event geqrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, double *a,
+                                      std::int64_t lda, std::int64_t stride_a, double *tau,
+                                      std::int64_t stride_tau, std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = geqrf_batch_scratchpad_size<double>(queue, m, n, lda, stride_a,
+                                                                       stride_tau, batch_size);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(geqrf_batch(queue, m, n, a, lda, stride_a, tau, stride_tau,
+                                          batch_size, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event geqrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                      std::complex<float> *a, std::int64_t lda,
+                                      std::int64_t stride_a, std::complex<float> *tau,
+                                      std::int64_t stride_tau, std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = geqrf_batch_scratchpad_size<std::complex<float>>(queue, m, n,
+                                                                                    lda, stride_a,
+                                                                                    stride_tau,
+                                                                                    batch_size);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(geqrf_batch(queue, m, n, a, lda, stride_a, tau, stride_tau,
+                                          batch_size, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event geqrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                      std::complex<double> *a, std::int64_t lda,
+                                      std::int64_t stride_a, std::complex<double> *tau,
+                                      std::int64_t stride_tau, std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = geqrf_batch_scratchpad_size<std::complex<double>>(queue, m, n,
+                                                                                     lda, stride_a,
+                                                                                     stride_tau,
+                                                                                     batch_size);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(geqrf_batch(queue, m, n, a, lda, stride_a, tau, stride_tau,
+                                          batch_size, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event geqrf_batch(sycl::queue &queue, std::int64_t *m, std::int64_t *n,
+                                      float **a, std::int64_t *lda, float **tau,
+                                      std::int64_t group_count, std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = geqrf_batch_scratchpad_size<float>(queue, m, n, lda, group_count,
+                                                                      group_sizes);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(geqrf_batch(queue, m, n, a, lda, tau, group_count, group_sizes,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event geqrf_batch(sycl::queue &queue, std::int64_t *m, std::int64_t *n,
+                                      double **a, std::int64_t *lda, double **tau,
+                                      std::int64_t group_count, std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = geqrf_batch_scratchpad_size<double>(queue, m, n, lda,
+                                                                       group_count, group_sizes);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(geqrf_batch(queue, m, n, a, lda, tau, group_count, group_sizes,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event geqrf_batch(sycl::queue &queue, std::int64_t *m, std::int64_t *n,
+                                      std::complex<float> **a, std::int64_t *lda,
+                                      std::complex<float> **tau, std::int64_t group_count,
+                                      std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = geqrf_batch_scratchpad_size<std::complex<float>>(queue, m, n,
+                                                                                    lda,
+                                                                                    group_count,
+                                                                                    group_sizes);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(geqrf_batch(queue, m, n, a, lda, tau, group_count, group_sizes,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event geqrf_batch(sycl::queue &queue, std::int64_t *m, std::int64_t *n,
+                                      std::complex<double> **a, std::int64_t *lda,
+                                      std::complex<double> **tau, std::int64_t group_count,
+                                      std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = geqrf_batch_scratchpad_size<std::complex<double>>(queue, m, n,
+                                                                                     lda,
+                                                                                     group_count,
+                                                                                     group_sizes);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(geqrf_batch(queue, m, n, a, lda, tau, group_count, group_sizes,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event getrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, float *a,
+                                      std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
+                                      std::int64_t stride_ipiv, std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getrf_batch_scratchpad_size<float>(queue, m, n, lda, stride_a,
+                                                                      stride_ipiv, batch_size);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getrf_batch(queue, m, n, a, lda, stride_a, ipiv, stride_ipiv,
+                                          batch_size, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event getrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, double *a,
+                                      std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
+                                      std::int64_t stride_ipiv, std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getrf_batch_scratchpad_size<double>(queue, m, n, lda, stride_a,
+                                                                       stride_ipiv, batch_size);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getrf_batch(queue, m, n, a, lda, stride_a, ipiv, stride_ipiv,
+                                          batch_size, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event getrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                      std::complex<float> *a, std::int64_t lda,
+                                      std::int64_t stride_a, std::int64_t *ipiv,
+                                      std::int64_t stride_ipiv, std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getrf_batch_scratchpad_size<std::complex<float>>(queue, m, n,
+                                                                                    lda, stride_a,
+                                                                                    stride_ipiv,
+                                                                                    batch_size);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getrf_batch(queue, m, n, a, lda, stride_a, ipiv, stride_ipiv,
+                                          batch_size, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event getrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                      std::complex<double> *a, std::int64_t lda,
+                                      std::int64_t stride_a, std::int64_t *ipiv,
+                                      std::int64_t stride_ipiv, std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getrf_batch_scratchpad_size<std::complex<double>>(queue, m, n,
+                                                                                     lda, stride_a,
+                                                                                     stride_ipiv,
+                                                                                     batch_size);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getrf_batch(queue, m, n, a, lda, stride_a, ipiv, stride_ipiv,
+                                          batch_size, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event getrf_batch(sycl::queue &queue, std::int64_t *m, std::int64_t *n,
+                                      float **a, std::int64_t *lda, std::int64_t **ipiv,
+                                      std::int64_t group_count, std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getrf_batch_scratchpad_size<float>(queue, m, n, lda, group_count,
+                                                                      group_sizes);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getrf_batch(queue, m, n, a, lda, ipiv, group_count, group_sizes,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event getrf_batch(sycl::queue &queue, std::int64_t *m, std::int64_t *n,
+                                      double **a, std::int64_t *lda, std::int64_t **ipiv,
+                                      std::int64_t group_count, std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getrf_batch_scratchpad_size<double>(queue, m, n, lda,
+                                                                       group_count, group_sizes);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getrf_batch(queue, m, n, a, lda, ipiv, group_count, group_sizes,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event getrf_batch(sycl::queue &queue, std::int64_t *m, std::int64_t *n,
+                                      std::complex<float> **a, std::int64_t *lda,
+                                      std::int64_t **ipiv, std::int64_t group_count,
+                                      std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getrf_batch_scratchpad_size<std::complex<float>>(queue, m, n,
+                                                                                    lda,
+                                                                                    group_count,
+                                                                                    group_sizes);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getrf_batch(queue, m, n, a, lda, ipiv, group_count, group_sizes,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event getrf_batch(sycl::queue &queue, std::int64_t *m, std::int64_t *n,
+                                      std::complex<double> **a, std::int64_t *lda,
+                                      std::int64_t **ipiv, std::int64_t group_count,
+                                      std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getrf_batch_scratchpad_size<std::complex<double>>(queue, m, n,
+                                                                                     lda,
+                                                                                     group_count,
+                                                                                     group_sizes);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getrf_batch(queue, m, n, a, lda, ipiv, group_count, group_sizes,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event getri_batch(sycl::queue &queue, std::int64_t n, float *a,
+                                      std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
+                                      std::int64_t stride_ipiv, std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getri_batch_scratchpad_size<float>(queue, n, lda, stride_a,
+                                                                      stride_ipiv, batch_size);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getri_batch(queue, n, a, lda, stride_a, ipiv, stride_ipiv, batch_size,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event getri_batch(sycl::queue &queue, std::int64_t n, double *a,
+                                      std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
+                                      std::int64_t stride_ipiv, std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getri_batch_scratchpad_size<double>(queue, n, lda, stride_a,
+                                                                       stride_ipiv, batch_size);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getri_batch(queue, n, a, lda, stride_a, ipiv, stride_ipiv, batch_size,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event getri_batch(sycl::queue &queue, std::int64_t n, std::complex<float> *a,
+                                      std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
+                                      std::int64_t stride_ipiv, std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getri_batch_scratchpad_size<std::complex<float>>(queue, n, lda,
+                                                                                    stride_a,
+                                                                                    stride_ipiv,
+                                                                                    batch_size);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getri_batch(queue, n, a, lda, stride_a, ipiv, stride_ipiv, batch_size,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event getri_batch(sycl::queue &queue, std::int64_t n, std::complex<double> *a,
+                                      std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
+                                      std::int64_t stride_ipiv, std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getri_batch_scratchpad_size<std::complex<double>>(queue, n, lda,
+                                                                                     stride_a,
+                                                                                     stride_ipiv,
+                                                                                     batch_size);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getri_batch(queue, n, a, lda, stride_a, ipiv, stride_ipiv, batch_size,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event getri_batch(sycl::queue &queue, std::int64_t *n, float **a,
+                                      std::int64_t *lda, std::int64_t **ipiv,
+                                      std::int64_t group_count, std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getri_batch_scratchpad_size<float>(queue, n, lda, group_count,
+                                                                      group_sizes);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getri_batch(queue, n, a, lda, ipiv, group_count, group_sizes,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event getri_batch(sycl::queue &queue, std::int64_t *n, double **a,
+                                      std::int64_t *lda, std::int64_t **ipiv,
+                                      std::int64_t group_count, std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getri_batch_scratchpad_size<double>(queue, n, lda, group_count,
+                                                                       group_sizes);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getri_batch(queue, n, a, lda, ipiv, group_count, group_sizes,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event getri_batch(sycl::queue &queue, std::int64_t *n, std::complex<float> **a,
+                                      std::int64_t *lda, std::int64_t **ipiv,
+                                      std::int64_t group_count, std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getri_batch_scratchpad_size<std::complex<float>>(queue, n, lda,
+                                                                                    group_count,
+                                                                                    group_sizes);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getri_batch(queue, n, a, lda, ipiv, group_count, group_sizes,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event getri_batch(sycl::queue &queue, std::int64_t *n, std::complex<double> **a,
+                                      std::int64_t *lda, std::int64_t **ipiv,
+                                      std::int64_t group_count, std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getri_batch_scratchpad_size<std::complex<double>>(queue, n, lda,
+                                                                                     group_count,
+                                                                                     group_sizes);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getri_batch(queue, n, a, lda, ipiv, group_count, group_sizes,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event getrs_batch(sycl::queue &queue, oneapi::mkl::transpose trans,
+                                      std::int64_t n, std::int64_t nrhs, float *a, std::int64_t lda,
+                                      std::int64_t stride_a, std::int64_t *ipiv,
+                                      std::int64_t stride_ipiv, float *b, std::int64_t ldb,
+                                      std::int64_t stride_b, std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getrs_batch_scratchpad_size<float>(queue, trans, n, nrhs, lda,
+                                                                      stride_a, stride_ipiv, ldb,
+                                                                      stride_b, batch_size);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getrs_batch(queue, trans, n, nrhs, a, lda, stride_a, ipiv,
+                                          stride_ipiv, b, ldb, stride_b, batch_size,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event getrs_batch(sycl::queue &queue, oneapi::mkl::transpose trans,
+                                      std::int64_t n, std::int64_t nrhs, double *a,
+                                      std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
+                                      std::int64_t stride_ipiv, double *b, std::int64_t ldb,
+                                      std::int64_t stride_b, std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getrs_batch_scratchpad_size<double>(queue, trans, n, nrhs, lda,
+                                                                       stride_a, stride_ipiv, ldb,
+                                                                       stride_b, batch_size);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getrs_batch(queue, trans, n, nrhs, a, lda, stride_a, ipiv,
+                                          stride_ipiv, b, ldb, stride_b, batch_size,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event getrs_batch(sycl::queue &queue, oneapi::mkl::transpose trans,
+                                      std::int64_t n, std::int64_t nrhs, std::complex<float> *a,
+                                      std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
+                                      std::int64_t stride_ipiv, std::complex<float> *b,
+                                      std::int64_t ldb, std::int64_t stride_b,
+                                      std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getrs_batch_scratchpad_size<std::complex<float>>(queue, trans, n,
+                                                                                    nrhs, lda,
+                                                                                    stride_a,
+                                                                                    stride_ipiv,
+                                                                                    ldb, stride_b,
+                                                                                    batch_size);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getrs_batch(queue, trans, n, nrhs, a, lda, stride_a, ipiv,
+                                          stride_ipiv, b, ldb, stride_b, batch_size,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event getrs_batch(sycl::queue &queue, oneapi::mkl::transpose trans,
+                                      std::int64_t n, std::int64_t nrhs, std::complex<double> *a,
+                                      std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
+                                      std::int64_t stride_ipiv, std::complex<double> *b,
+                                      std::int64_t ldb, std::int64_t stride_b,
+                                      std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getrs_batch_scratchpad_size<std::complex<double>>(queue, trans,
+                                                                                     n, nrhs, lda,
+                                                                                     stride_a,
+                                                                                     stride_ipiv,
+                                                                                     ldb, stride_b,
+                                                                                     batch_size);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getrs_batch(queue, trans, n, nrhs, a, lda, stride_a, ipiv,
+                                          stride_ipiv, b, ldb, stride_b, batch_size,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                                     float *a, std::int64_t lda, std::int64_t stride_a,
+                                     std::int64_t *ipiv, std::int64_t stride_ipiv, float *b,
+                                     std::int64_t ldb, std::int64_t stride_b,
+                                     std::int64_t batch_size,
+                                     const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gesv_batch_scratchpad_size<float>(queue, n, nrhs, lda, stride_a,
+                                                                     stride_ipiv, ldb, stride_b,
+                                                                     batch_size);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gesv_batch(queue, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b,
+                                         ldb, stride_b, batch_size, scratchpad.get(),
+                                         scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                                     double *a, std::int64_t lda, std::int64_t stride_a,
+                                     std::int64_t *ipiv, std::int64_t stride_ipiv, double *b,
+                                     std::int64_t ldb, std::int64_t stride_b,
+                                     std::int64_t batch_size,
+                                     const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gesv_batch_scratchpad_size<double>(queue, n, nrhs, lda, stride_a,
+                                                                      stride_ipiv, ldb, stride_b,
+                                                                      batch_size);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gesv_batch(queue, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b,
+                                         ldb, stride_b, batch_size, scratchpad.get(),
+                                         scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event gesv_batch(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv, std::complex<float> *b,
+    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+    const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gesv_batch_scratchpad_size<std::complex<float>>(
+        queue, n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, batch_size);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gesv_batch(queue, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b,
+                                         ldb, stride_b, batch_size, scratchpad.get(),
+                                         scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event gesv_batch(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::complex<double> *a,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv,
+    std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+    const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gesv_batch_scratchpad_size<std::complex<double>>(
+        queue, n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, batch_size);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gesv_batch(queue, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b,
+                                         ldb, stride_b, batch_size, scratchpad.get(),
+                                         scratchpad_size, scratchpad.dependencies()));
+}
+static inline sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans,
+                                     std::int64_t m, std::int64_t n, std::int64_t nrhs, float *a,
+                                     std::int64_t lda, std::int64_t stride_a, float *b,
+                                     std::int64_t ldb, std::int64_t stride_b,
+                                     std::int64_t batch_size,
+                                     const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gels_batch_scratchpad_size<float>(queue, trans, m, n, nrhs, lda,
+                                                                     stride_a, ldb, stride_b,
+                                                                     batch_size);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gels_batch(queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb,
+                                         stride_b, batch_size, scratchpad.get(), scratchpad_size,
+                                         scratchpad.dependencies()));
+}
+static inline sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans,
+                                     std::int64_t m, std::int64_t n, std::int64_t nrhs, double *a,
+                                     std::int64_t lda, std::int64_t stride_a, double *b,
+                                     std::int64_t ldb, std::int64_t stride_b,
+                                     std::int64_t batch_size,
+                                     const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gels_batch_scratchpad_size<double>(queue, trans, m, n, nrhs, lda,
+                                                                      stride_a, ldb, stride_b,
+                                                                      batch_size);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gels_batch(queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb,
+                                         stride_b, batch_size, scratchpad.get(), scratchpad_size,
+                                         scratchpad.dependencies()));
+}
+static inline sycl::event gels_batch(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::complex<float> *a, std::int64_t lda, std::int64_t stride_a,
+    std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+    const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gels_batch_scratchpad_size<std::complex<float>>(
+        queue, trans, m, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gels_batch(queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb,
+                                         stride_b, batch_size, scratchpad.get(), scratchpad_size,
+                                         scratchpad.dependencies()));
+}
+static inline sycl::event gels_batch(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::complex<double> *a, std::int64_t lda, std::int64_t stride_a,
+    std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+    const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = gels_batch_scratchpad_size<std::complex<double>>(
+        queue, trans, m, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(gels_batch(queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb,
+                                         stride_b, batch_size, scratchpad.get(), scratchpad_size,
+                                         scratchpad.dependencies()));
+}
+static inline sycl::event heevd_batch(sycl::queue &queue, oneapi::mkl::job jobz,
+                                      oneapi::mkl::uplo uplo, std::int64_t n,
+                                      std::complex<float> *a, std::int64_t lda,
+                                      std::int64_t stride_a, float *w, std::int64_t stride_w,
+                                      std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = heevd_batch_scratchpad_size<std::complex<float>>(
+        queue, jobz, uplo, n, lda, stride_a, stride_w, batch_size);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(heevd_batch(queue, jobz, uplo, n, a, lda, stride_a, w, stride_w,
+                                          batch_size, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event heevd_batch(sycl::queue &queue, oneapi::mkl::job jobz,
+                                      oneapi::mkl::uplo uplo, std::int64_t n,
+                                      std::complex<double> *a, std::int64_t lda,
+                                      std::int64_t stride_a, double *w, std::int64_t stride_w,
+                                      std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = heevd_batch_scratchpad_size<std::complex<double>>(
+        queue, jobz, uplo, n, lda, stride_a, stride_w, batch_size);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(heevd_batch(queue, jobz, uplo, n, a, lda, stride_a, w, stride_w,
+                                          batch_size, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event getrs_batch(sycl::queue &queue, oneapi::mkl::transpose *trans,
+                                      std::int64_t *n, std::int64_t *nrhs, float **a,
+                                      std::int64_t *lda, std::int64_t **ipiv, float **b,
+                                      std::int64_t *ldb, std::int64_t group_count,
+                                      std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getrs_batch_scratchpad_size<float>(queue, trans, n, nrhs, lda,
+                                                                      ldb, group_count,
+                                                                      group_sizes);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getrs_batch(queue, trans, n, nrhs, a, lda, ipiv, b, ldb, group_count,
+                                          group_sizes, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event getrs_batch(sycl::queue &queue, oneapi::mkl::transpose *trans,
+                                      std::int64_t *n, std::int64_t *nrhs, double **a,
+                                      std::int64_t *lda, std::int64_t **ipiv, double **b,
+                                      std::int64_t *ldb, std::int64_t group_count,
+                                      std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getrs_batch_scratchpad_size<double>(queue, trans, n, nrhs, lda,
+                                                                       ldb, group_count,
+                                                                       group_sizes);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getrs_batch(queue, trans, n, nrhs, a, lda, ipiv, b, ldb, group_count,
+                                          group_sizes, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event getrs_batch(sycl::queue &queue, oneapi::mkl::transpose *trans,
+                                      std::int64_t *n, std::int64_t *nrhs, std::complex<float> **a,
+                                      std::int64_t *lda, std::int64_t **ipiv,
+                                      std::complex<float> **b, std::int64_t *ldb,
+                                      std::int64_t group_count, std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getrs_batch_scratchpad_size<std::complex<float>>(queue, trans, n,
+                                                                                    nrhs, lda, ldb,
+                                                                                    group_count,
+                                                                                    group_sizes);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getrs_batch(queue, trans, n, nrhs, a, lda, ipiv, b, ldb, group_count,
+                                          group_sizes, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event getrs_batch(sycl::queue &queue, oneapi::mkl::transpose *trans,
+                                      std::int64_t *n, std::int64_t *nrhs, std::complex<double> **a,
+                                      std::int64_t *lda, std::int64_t **ipiv,
+                                      std::complex<double> **b, std::int64_t *ldb,
+                                      std::int64_t group_count, std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = getrs_batch_scratchpad_size<std::complex<double>>(queue, trans,
+                                                                                     n, nrhs, lda,
+                                                                                     ldb,
+                                                                                     group_count,
+                                                                                     group_sizes);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(getrs_batch(queue, trans, n, nrhs, a, lda, ipiv, b, ldb, group_count,
+                                          group_sizes, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event orgqr_batch(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                      std::int64_t k, float *a, std::int64_t lda,
+                                      std::int64_t stride_a, float *tau, std::int64_t stride_tau,
+                                      std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = orgqr_batch_scratchpad_size<float>(queue, m, n, k, lda, stride_a,
+                                                                      stride_tau, batch_size);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(orgqr_batch(queue, m, n, k, a, lda, stride_a, tau, stride_tau,
+                                          batch_size, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event orgqr_batch(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                      std::int64_t k, double *a, std::int64_t lda,
+                                      std::int64_t stride_a, double *tau, std::int64_t stride_tau,
+                                      std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = orgqr_batch_scratchpad_size<double>(queue, m, n, k, lda,
+                                                                       stride_a, stride_tau,
+                                                                       batch_size);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(orgqr_batch(queue, m, n, k, a, lda, stride_a, tau, stride_tau,
+                                          batch_size, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event orgqr_batch(sycl::queue &queue, std::int64_t *m, std::int64_t *n,
+                                      std::int64_t *k, float **a, std::int64_t *lda, float **tau,
+                                      std::int64_t group_count, std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = orgqr_batch_scratchpad_size<float>(queue, m, n, k, lda,
+                                                                      group_count, group_sizes);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(orgqr_batch(queue, m, n, k, a, lda, tau, group_count, group_sizes,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event orgqr_batch(sycl::queue &queue, std::int64_t *m, std::int64_t *n,
+                                      std::int64_t *k, double **a, std::int64_t *lda, double **tau,
+                                      std::int64_t group_count, std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = orgqr_batch_scratchpad_size<double>(queue, m, n, k, lda,
+                                                                       group_count, group_sizes);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(orgqr_batch(queue, m, n, k, a, lda, tau, group_count, group_sizes,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event potrf_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                      float *a, std::int64_t lda, std::int64_t stride_a,
+                                      std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potrf_batch_scratchpad_size<float>(queue, uplo, n, lda, stride_a,
+                                                                      batch_size);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potrf_batch(queue, uplo, n, a, lda, stride_a, batch_size,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event potrf_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                      double *a, std::int64_t lda, std::int64_t stride_a,
+                                      std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potrf_batch_scratchpad_size<double>(queue, uplo, n, lda,
+                                                                       stride_a, batch_size);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potrf_batch(queue, uplo, n, a, lda, stride_a, batch_size,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event potrf_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                      std::complex<float> *a, std::int64_t lda,
+                                      std::int64_t stride_a, std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potrf_batch_scratchpad_size<std::complex<float>>(queue, uplo, n,
+                                                                                    lda, stride_a,
+                                                                                    batch_size);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potrf_batch(queue, uplo, n, a, lda, stride_a, batch_size,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event potrf_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                      std::complex<double> *a, std::int64_t lda,
+                                      std::int64_t stride_a, std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potrf_batch_scratchpad_size<std::complex<double>>(queue, uplo, n,
+                                                                                     lda, stride_a,
+                                                                                     batch_size);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potrf_batch(queue, uplo, n, a, lda, stride_a, batch_size,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event potrf_batch(sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
+                                      float **a, std::int64_t *lda, std::int64_t group_count,
+                                      std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potrf_batch_scratchpad_size<float>(queue, uplo, n, lda,
+                                                                      group_count, group_sizes);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potrf_batch(queue, uplo, n, a, lda, group_count, group_sizes,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event potrf_batch(sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
+                                      double **a, std::int64_t *lda, std::int64_t group_count,
+                                      std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potrf_batch_scratchpad_size<double>(queue, uplo, n, lda,
+                                                                       group_count, group_sizes);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potrf_batch(queue, uplo, n, a, lda, group_count, group_sizes,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event potrf_batch(sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
+                                      std::complex<float> **a, std::int64_t *lda,
+                                      std::int64_t group_count, std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potrf_batch_scratchpad_size<std::complex<float>>(queue, uplo, n,
+                                                                                    lda,
+                                                                                    group_count,
+                                                                                    group_sizes);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potrf_batch(queue, uplo, n, a, lda, group_count, group_sizes,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event potrf_batch(sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
+                                      std::complex<double> **a, std::int64_t *lda,
+                                      std::int64_t group_count, std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potrf_batch_scratchpad_size<std::complex<double>>(queue, uplo, n,
+                                                                                     lda,
+                                                                                     group_count,
+                                                                                     group_sizes);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potrf_batch(queue, uplo, n, a, lda, group_count, group_sizes,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event potrs_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                      std::int64_t nrhs, float *a, std::int64_t lda,
+                                      std::int64_t stride_a, float *b, std::int64_t ldb,
+                                      std::int64_t stride_b, std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potrs_batch_scratchpad_size<float>(queue, uplo, n, nrhs, lda,
+                                                                      stride_a, ldb, stride_b,
+                                                                      batch_size);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potrs_batch(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b,
+                                          batch_size, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event potrs_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                      std::int64_t nrhs, double *a, std::int64_t lda,
+                                      std::int64_t stride_a, double *b, std::int64_t ldb,
+                                      std::int64_t stride_b, std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potrs_batch_scratchpad_size<double>(queue, uplo, n, nrhs, lda,
+                                                                       stride_a, ldb, stride_b,
+                                                                       batch_size);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potrs_batch(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b,
+                                          batch_size, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event potrs_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                      std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                                      std::int64_t stride_a, std::complex<float> *b,
+                                      std::int64_t ldb, std::int64_t stride_b,
+                                      std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potrs_batch_scratchpad_size<std::complex<float>>(queue, uplo, n,
+                                                                                    nrhs, lda,
+                                                                                    stride_a, ldb,
+                                                                                    stride_b,
+                                                                                    batch_size);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potrs_batch(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b,
+                                          batch_size, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event potrs_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                      std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                                      std::int64_t stride_a, std::complex<double> *b,
+                                      std::int64_t ldb, std::int64_t stride_b,
+                                      std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potrs_batch_scratchpad_size<std::complex<double>>(queue, uplo, n,
+                                                                                     nrhs, lda,
+                                                                                     stride_a, ldb,
+                                                                                     stride_b,
+                                                                                     batch_size);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potrs_batch(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b,
+                                          batch_size, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                     std::int64_t nrhs, float *a, std::int64_t lda,
+                                     std::int64_t stride_a, float *b, std::int64_t ldb,
+                                     std::int64_t stride_b, std::int64_t batch_size,
+                                     const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = posv_batch_scratchpad_size<float>(queue, uplo, n, nrhs, lda,
+                                                                     stride_a, ldb, stride_b,
+                                                                     batch_size);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(posv_batch(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b,
+                                         batch_size, scratchpad.get(), scratchpad_size,
+                                         scratchpad.dependencies()));
+}
+static inline sycl::event posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                     std::int64_t nrhs, double *a, std::int64_t lda,
+                                     std::int64_t stride_a, double *b, std::int64_t ldb,
+                                     std::int64_t stride_b, std::int64_t batch_size,
+                                     const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = posv_batch_scratchpad_size<double>(queue, uplo, n, nrhs, lda,
+                                                                      stride_a, ldb, stride_b,
+                                                                      batch_size);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(posv_batch(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b,
+                                         batch_size, scratchpad.get(), scratchpad_size,
+                                         scratchpad.dependencies()));
+}
+static inline sycl::event posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                     std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                                     std::int64_t stride_a, std::complex<float> *b,
+                                     std::int64_t ldb, std::int64_t stride_b,
+                                     std::int64_t batch_size,
+                                     const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = posv_batch_scratchpad_size<std::complex<float>>(
+        queue, uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(posv_batch(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b,
+                                         batch_size, scratchpad.get(), scratchpad_size,
+                                         scratchpad.dependencies()));
+}
+static inline sycl::event posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                     std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                                     std::int64_t stride_a, std::complex<double> *b,
+                                     std::int64_t ldb, std::int64_t stride_b,
+                                     std::int64_t batch_size,
+                                     const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = posv_batch_scratchpad_size<std::complex<double>>(
+        queue, uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(posv_batch(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b,
+                                         batch_size, scratchpad.get(), scratchpad_size,
+                                         scratchpad.dependencies()));
+}
+static inline sycl::event syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz,
+                                      oneapi::mkl::uplo uplo, std::int64_t n, float *a,
+                                      std::int64_t lda, std::int64_t stride_a, float *w,
+                                      std::int64_t stride_w, std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = syevd_batch_scratchpad_size<float>(queue, jobz, uplo, n, lda,
+                                                                      stride_a, stride_w,
+                                                                      batch_size);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(syevd_batch(queue, jobz, uplo, n, a, lda, stride_a, w, stride_w,
+                                          batch_size, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz,
+                                      oneapi::mkl::uplo uplo, std::int64_t n, double *a,
+                                      std::int64_t lda, std::int64_t stride_a, double *w,
+                                      std::int64_t stride_w, std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = syevd_batch_scratchpad_size<double>(queue, jobz, uplo, n, lda,
+                                                                       stride_a, stride_w,
+                                                                       batch_size);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(syevd_batch(queue, jobz, uplo, n, a, lda, stride_a, w, stride_w,
+                                          batch_size, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event potrs_batch(sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
+                                      std::int64_t *nrhs, float **a, std::int64_t *lda, float **b,
+                                      std::int64_t *ldb, std::int64_t group_count,
+                                      std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potrs_batch_scratchpad_size<float>(queue, uplo, n, nrhs, lda,
+                                                                      ldb, group_count,
+                                                                      group_sizes);
+    detail::workspace_usm<float> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potrs_batch(queue, uplo, n, nrhs, a, lda, b, ldb, group_count,
+                                          group_sizes, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event potrs_batch(sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
+                                      std::int64_t *nrhs, double **a, std::int64_t *lda, double **b,
+                                      std::int64_t *ldb, std::int64_t group_count,
+                                      std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potrs_batch_scratchpad_size<double>(queue, uplo, n, nrhs, lda,
+                                                                       ldb, group_count,
+                                                                       group_sizes);
+    detail::workspace_usm<double> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potrs_batch(queue, uplo, n, nrhs, a, lda, b, ldb, group_count,
+                                          group_sizes, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event potrs_batch(sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
+                                      std::int64_t *nrhs, std::complex<float> **a,
+                                      std::int64_t *lda, std::complex<float> **b, std::int64_t *ldb,
+                                      std::int64_t group_count, std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potrs_batch_scratchpad_size<std::complex<float>>(queue, uplo, n,
+                                                                                    nrhs, lda, ldb,
+                                                                                    group_count,
+                                                                                    group_sizes);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potrs_batch(queue, uplo, n, nrhs, a, lda, b, ldb, group_count,
+                                          group_sizes, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event potrs_batch(sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
+                                      std::int64_t *nrhs, std::complex<double> **a,
+                                      std::int64_t *lda, std::complex<double> **b,
+                                      std::int64_t *ldb, std::int64_t group_count,
+                                      std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = potrs_batch_scratchpad_size<std::complex<double>>(queue, uplo, n,
+                                                                                     nrhs, lda, ldb,
+                                                                                     group_count,
+                                                                                     group_sizes);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(potrs_batch(queue, uplo, n, nrhs, a, lda, b, ldb, group_count,
+                                          group_sizes, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event ungqr_batch(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                      std::int64_t k, std::complex<float> *a, std::int64_t lda,
+                                      std::int64_t stride_a, std::complex<float> *tau,
+                                      std::int64_t stride_tau, std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = ungqr_batch_scratchpad_size<std::complex<float>>(queue, m, n, k,
+                                                                                    lda, stride_a,
+                                                                                    stride_tau,
+                                                                                    batch_size);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(ungqr_batch(queue, m, n, k, a, lda, stride_a, tau, stride_tau,
+                                          batch_size, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event ungqr_batch(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                      std::int64_t k, std::complex<double> *a, std::int64_t lda,
+                                      std::int64_t stride_a, std::complex<double> *tau,
+                                      std::int64_t stride_tau, std::int64_t batch_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = ungqr_batch_scratchpad_size<std::complex<double>>(queue, m, n, k,
+                                                                                     lda, stride_a,
+                                                                                     stride_tau,
+                                                                                     batch_size);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(ungqr_batch(queue, m, n, k, a, lda, stride_a, tau, stride_tau,
+                                          batch_size, scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event ungqr_batch(sycl::queue &queue, std::int64_t *m, std::int64_t *n,
+                                      std::int64_t *k, std::complex<float> **a, std::int64_t *lda,
+                                      std::complex<float> **tau, std::int64_t group_count,
+                                      std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = ungqr_batch_scratchpad_size<std::complex<float>>(queue, m, n, k,
+                                                                                    lda,
+                                                                                    group_count,
+                                                                                    group_sizes);
+    detail::workspace_usm<std::complex<float>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(ungqr_batch(queue, m, n, k, a, lda, tau, group_count, group_sizes,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+static inline sycl::event ungqr_batch(sycl::queue &queue, std::int64_t *m, std::int64_t *n,
+                                      std::int64_t *k, std::complex<double> **a, std::int64_t *lda,
+                                      std::complex<double> **tau, std::int64_t group_count,
+                                      std::int64_t *group_sizes,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    std::int64_t scratchpad_size = ungqr_batch_scratchpad_size<std::complex<double>>(queue, m, n, k,
+                                                                                     lda,
+                                                                                     group_count,
+                                                                                     group_sizes);
+    detail::workspace_usm<std::complex<double>> scratchpad(queue, scratchpad_size, dependencies);
+    return scratchpad.release(ungqr_batch(queue, m, n, k, a, lda, tau, group_count, group_sizes,
+                                          scratchpad.get(), scratchpad_size,
+                                          scratchpad.dependencies()));
+}
+
+} // namespace lapack
+} // namespace mkl
+} // namespace oneapi
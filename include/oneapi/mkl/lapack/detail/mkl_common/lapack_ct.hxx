@@ -53,6 +53,74 @@ static inline void gebrd(backend_selector<backend::LAPACK_BACKEND> selector, std
     oneapi::mkl::lapack::LAPACK_BACKEND::gebrd(selector.get_queue(), m, n, a, lda, d, e, tauq, taup,
                                                scratchpad, scratchpad_size);
 }
+static inline void gels(backend_selector<backend::LAPACK_BACKEND> selector,
+                        oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                        sycl::buffer<float> &b, std::int64_t ldb, sycl::buffer<float> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels(selector.get_queue(), trans, m, n, nrhs, a, lda, b,
+                                              ldb, scratchpad, scratchpad_size);
+}
+static inline void gels(backend_selector<backend::LAPACK_BACKEND> selector,
+                        oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                        sycl::buffer<double> &b, std::int64_t ldb, sycl::buffer<double> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels(selector.get_queue(), trans, m, n, nrhs, a, lda, b,
+                                              ldb, scratchpad, scratchpad_size);
+}
+static inline void gels(backend_selector<backend::LAPACK_BACKEND> selector,
+                        oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                        sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                        sycl::buffer<std::complex<float>> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels(selector.get_queue(), trans, m, n, nrhs, a, lda, b,
+                                              ldb, scratchpad, scratchpad_size);
+}
+static inline void gels(backend_selector<backend::LAPACK_BACKEND> selector,
+                        oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                        sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                        sycl::buffer<std::complex<double>> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels(selector.get_queue(), trans, m, n, nrhs, a, lda, b,
+                                              ldb, scratchpad, scratchpad_size);
+}
+static inline void gelsd(backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t m,
+                         std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a,
+                         std::int64_t lda, sycl::buffer<float> &b, std::int64_t ldb,
+                         sycl::buffer<float> &s, float rcond, sycl::buffer<std::int64_t> &rank,
+                         sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::gelsd(selector.get_queue(), m, n, nrhs, a, lda, b, ldb, s,
+                                               rcond, rank, scratchpad, scratchpad_size);
+}
+static inline void gelsd(backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t m,
+                         std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a,
+                         std::int64_t lda, sycl::buffer<double> &b, std::int64_t ldb,
+                         sycl::buffer<double> &s, double rcond, sycl::buffer<std::int64_t> &rank,
+                         sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::gelsd(selector.get_queue(), m, n, nrhs, a, lda, b, ldb, s,
+                                               rcond, rank, scratchpad, scratchpad_size);
+}
+static inline void gelsd(backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t m,
+                         std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<float>> &a,
+                         std::int64_t lda, sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                         sycl::buffer<float> &s, float rcond, sycl::buffer<std::int64_t> &rank,
+                         sycl::buffer<std::complex<float>> &scratchpad,
+                         std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::gelsd(selector.get_queue(), m, n, nrhs, a, lda, b, ldb, s,
+                                               rcond, rank, scratchpad, scratchpad_size);
+}
+static inline void gelsd(backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t m,
+                         std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
+                         std::int64_t lda, sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                         sycl::buffer<double> &s, double rcond, sycl::buffer<std::int64_t> &rank,
+                         sycl::buffer<std::complex<double>> &scratchpad,
+                         std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::gelsd(selector.get_queue(), m, n, nrhs, a, lda, b, ldb, s,
+                                               rcond, rank, scratchpad, scratchpad_size);
+}
 static inline void gerqf(backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t m,
                          std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
                          sycl::buffer<float> &tau, sycl::buffer<float> &scratchpad,
@@ -207,6 +275,36 @@ static inline void getrs(backend_selector<backend::LAPACK_BACKEND> selector,
     oneapi::mkl::lapack::LAPACK_BACKEND::getrs(selector.get_queue(), trans, n, nrhs, a, lda, ipiv,
                                                b, ldb, scratchpad, scratchpad_size);
 }
+static inline void gesv(backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<float> &b, std::int64_t ldb,
+                        sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv(selector.get_queue(), n, nrhs, a, lda, ipiv, b, ldb,
+                                              scratchpad, scratchpad_size);
+}
+static inline void gesv(backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<double> &b, std::int64_t ldb,
+                        sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv(selector.get_queue(), n, nrhs, a, lda, ipiv, b, ldb,
+                                              scratchpad, scratchpad_size);
+}
+static inline void gesv(backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<float>> &b,
+                        std::int64_t ldb, sycl::buffer<std::complex<float>> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv(selector.get_queue(), n, nrhs, a, lda, ipiv, b, ldb,
+                                              scratchpad, scratchpad_size);
+}
+static inline void gesv(backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<double>> &b,
+                        std::int64_t ldb, sycl::buffer<std::complex<double>> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv(selector.get_queue(), n, nrhs, a, lda, ipiv, b, ldb,
+                                              scratchpad, scratchpad_size);
+}
 static inline void gesvd(backend_selector<backend::LAPACK_BACKEND> selector,
                          oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
                          std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
@@ -261,6 +359,54 @@ static inline void heevd(backend_selector<backend::LAPACK_BACKEND> selector, one
     oneapi::mkl::lapack::LAPACK_BACKEND::heevd(selector.get_queue(), jobz, uplo, n, a, lda, w,
                                                scratchpad, scratchpad_size);
 }
+static inline void heevr(backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::job jobz,
+                         oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda, float vl, float vu,
+                         std::int64_t il, std::int64_t iu, float abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                         sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+                         sycl::buffer<std::complex<float>> &scratchpad,
+                         std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevr(selector.get_queue(), jobz, range, uplo, n, a, lda,
+                                               vl, vu, il, iu, abstol, m, w, z, ldz, scratchpad,
+                                               scratchpad_size);
+}
+static inline void heevr(backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::job jobz,
+                         oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda, double vl,
+                         double vu, std::int64_t il, std::int64_t iu, double abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                         sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+                         sycl::buffer<std::complex<double>> &scratchpad,
+                         std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevr(selector.get_queue(), jobz, range, uplo, n, a, lda,
+                                               vl, vu, il, iu, abstol, m, w, z, ldz, scratchpad,
+                                               scratchpad_size);
+}
+static inline void heevx(backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::job jobz,
+                         oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda, float vl, float vu,
+                         std::int64_t il, std::int64_t iu, float abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                         sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+                         sycl::buffer<std::complex<float>> &scratchpad,
+                         std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevx(selector.get_queue(), jobz, range, uplo, n, a, lda,
+                                               vl, vu, il, iu, abstol, m, w, z, ldz, scratchpad,
+                                               scratchpad_size);
+}
+static inline void heevx(backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::job jobz,
+                         oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda, double vl,
+                         double vu, std::int64_t il, std::int64_t iu, double abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                         sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+                         sycl::buffer<std::complex<double>> &scratchpad,
+                         std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevx(selector.get_queue(), jobz, range, uplo, n, a, lda,
+                                               vl, vu, il, iu, abstol, m, w, z, ldz, scratchpad,
+                                               scratchpad_size);
+}
 static inline void hegvd(backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t itype,
                          oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
                          sycl::buffer<std::complex<float>> &a, std::int64_t lda,
@@ -485,6 +631,36 @@ static inline void potrs(backend_selector<backend::LAPACK_BACKEND> selector, one
     oneapi::mkl::lapack::LAPACK_BACKEND::potrs(selector.get_queue(), uplo, n, nrhs, a, lda, b, ldb,
                                                scratchpad, scratchpad_size);
 }
+static inline void posv(backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::uplo uplo,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                        sycl::buffer<float> &b, std::int64_t ldb, sycl::buffer<float> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv(selector.get_queue(), uplo, n, nrhs, a, lda, b, ldb,
+                                              scratchpad, scratchpad_size);
+}
+static inline void posv(backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::uplo uplo,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a,
+                        std::int64_t lda, sycl::buffer<double> &b, std::int64_t ldb,
+                        sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv(selector.get_queue(), uplo, n, nrhs, a, lda, b, ldb,
+                                              scratchpad, scratchpad_size);
+}
+static inline void posv(backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::uplo uplo,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<float>> &a,
+                        std::int64_t lda, sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                        sycl::buffer<std::complex<float>> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv(selector.get_queue(), uplo, n, nrhs, a, lda, b, ldb,
+                                              scratchpad, scratchpad_size);
+}
+static inline void posv(backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::uplo uplo,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
+                        std::int64_t lda, sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                        sycl::buffer<std::complex<double>> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv(selector.get_queue(), uplo, n, nrhs, a, lda, b, ldb,
+                                              scratchpad, scratchpad_size);
+}
 static inline void syevd(backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::job jobz,
                          oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
                          std::int64_t lda, sycl::buffer<double> &w,
@@ -499,6 +675,50 @@ static inline void syevd(backend_selector<backend::LAPACK_BACKEND> selector, one
     oneapi::mkl::lapack::LAPACK_BACKEND::syevd(selector.get_queue(), jobz, uplo, n, a, lda, w,
                                                scratchpad, scratchpad_size);
 }
+static inline void syevr(backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::job jobz,
+                         oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<float> &a, std::int64_t lda, float vl, float vu,
+                         std::int64_t il, std::int64_t iu, float abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                         sycl::buffer<float> &z, std::int64_t ldz, sycl::buffer<float> &scratchpad,
+                         std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevr(selector.get_queue(), jobz, range, uplo, n, a, lda,
+                                               vl, vu, il, iu, abstol, m, w, z, ldz, scratchpad,
+                                               scratchpad_size);
+}
+static inline void syevr(backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::job jobz,
+                         oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<double> &a, std::int64_t lda, double vl, double vu,
+                         std::int64_t il, std::int64_t iu, double abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                         sycl::buffer<double> &z, std::int64_t ldz,
+                         sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevr(selector.get_queue(), jobz, range, uplo, n, a, lda,
+                                               vl, vu, il, iu, abstol, m, w, z, ldz, scratchpad,
+                                               scratchpad_size);
+}
+static inline void syevx(backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::job jobz,
+                         oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<float> &a, std::int64_t lda, float vl, float vu,
+                         std::int64_t il, std::int64_t iu, float abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                         sycl::buffer<float> &z, std::int64_t ldz, sycl::buffer<float> &scratchpad,
+                         std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevx(selector.get_queue(), jobz, range, uplo, n, a, lda,
+                                               vl, vu, il, iu, abstol, m, w, z, ldz, scratchpad,
+                                               scratchpad_size);
+}
+static inline void syevx(backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::job jobz,
+                         oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                         sycl::buffer<double> &a, std::int64_t lda, double vl, double vu,
+                         std::int64_t il, std::int64_t iu, double abstol,
+                         sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                         sycl::buffer<double> &z, std::int64_t ldz,
+                         sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevx(selector.get_queue(), jobz, range, uplo, n, a, lda,
+                                               vl, vu, il, iu, abstol, m, w, z, ldz, scratchpad,
+                                               scratchpad_size);
+}
 static inline void sygvd(backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t itype,
                          oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
                          sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b,
@@ -560,6 +780,39 @@ static inline void sytrf(backend_selector<backend::LAPACK_BACKEND> selector, one
     oneapi::mkl::lapack::LAPACK_BACKEND::sytrf(selector.get_queue(), uplo, n, a, lda, ipiv,
                                                scratchpad, scratchpad_size);
 }
+static inline void sysv(backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::uplo uplo,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<float> &b, std::int64_t ldb,
+                        sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::sysv(selector.get_queue(), uplo, n, nrhs, a, lda, ipiv, b,
+                                              ldb, scratchpad, scratchpad_size);
+}
+static inline void sysv(backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::uplo uplo,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a,
+                        std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, sycl::buffer<double> &b,
+                        std::int64_t ldb, sycl::buffer<double> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::sysv(selector.get_queue(), uplo, n, nrhs, a, lda, ipiv, b,
+                                              ldb, scratchpad, scratchpad_size);
+}
+static inline void sysv(backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::uplo uplo,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<float>> &a,
+                        std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+                        sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                        sycl::buffer<std::complex<float>> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::sysv(selector.get_queue(), uplo, n, nrhs, a, lda, ipiv, b,
+                                              ldb, scratchpad, scratchpad_size);
+}
+static inline void sysv(backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::uplo uplo,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
+                        std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+                        sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                        sycl::buffer<std::complex<double>> &scratchpad,
+                        std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::sysv(selector.get_queue(), uplo, n, nrhs, a, lda, ipiv, b,
+                                              ldb, scratchpad, scratchpad_size);
+}
 static inline void trtrs(backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::uplo uplo,
                          oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t n,
                          std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
@@ -828,6 +1081,108 @@ static inline void getrs_batch(backend_selector<backend::LAPACK_BACKEND> selecto
                                                      stride_a, ipiv, stride_ipiv, b, ldb, stride_b,
                                                      batch_size, scratchpad, scratchpad_size);
 }
+static inline void gesv_batch(backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+                              std::int64_t stride_ipiv, sycl::buffer<float> &b, std::int64_t ldb,
+                              std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_batch(selector.get_queue(), n, nrhs, a, lda, stride_a,
+                                                    ipiv, stride_ipiv, b, ldb, stride_b, batch_size,
+                                                    scratchpad, scratchpad_size);
+}
+static inline void gesv_batch(backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+                              std::int64_t stride_ipiv, sycl::buffer<double> &b, std::int64_t ldb,
+                              std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_batch(selector.get_queue(), n, nrhs, a, lda, stride_a,
+                                                    ipiv, stride_ipiv, b, ldb, stride_b, batch_size,
+                                                    scratchpad, scratchpad_size);
+}
+static inline void gesv_batch(backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<std::complex<float>> &a,
+                              std::int64_t lda, std::int64_t stride_a,
+                              sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                              sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                              std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<std::complex<float>> &scratchpad,
+                              std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_batch(selector.get_queue(), n, nrhs, a, lda, stride_a,
+                                                    ipiv, stride_ipiv, b, ldb, stride_b, batch_size,
+                                                    scratchpad, scratchpad_size);
+}
+static inline void gesv_batch(backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
+                              std::int64_t lda, std::int64_t stride_a,
+                              sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                              sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                              std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<std::complex<double>> &scratchpad,
+                              std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_batch(selector.get_queue(), n, nrhs, a, lda, stride_a,
+                                                    ipiv, stride_ipiv, b, ldb, stride_b, batch_size,
+                                                    scratchpad, scratchpad_size);
+}
+static inline void gels_batch(backend_selector<backend::LAPACK_BACKEND> selector,
+                              oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<float> &b, std::int64_t ldb,
+                              std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch(selector.get_queue(), trans, m, n, nrhs, a, lda,
+                                                    stride_a, b, ldb, stride_b, batch_size,
+                                                    scratchpad, scratchpad_size);
+}
+static inline void gels_batch(backend_selector<backend::LAPACK_BACKEND> selector,
+                              oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<double> &b, std::int64_t ldb,
+                              std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch(selector.get_queue(), trans, m, n, nrhs, a, lda,
+                                                    stride_a, b, ldb, stride_b, batch_size,
+                                                    scratchpad, scratchpad_size);
+}
+static inline void gels_batch(
+    backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::transpose trans,
+    std::int64_t m, std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<float>> &a,
+    std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
+    std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch(selector.get_queue(), trans, m, n, nrhs, a, lda,
+                                                    stride_a, b, ldb, stride_b, batch_size,
+                                                    scratchpad, scratchpad_size);
+}
+static inline void gels_batch(
+    backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::transpose trans,
+    std::int64_t m, std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
+    std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::complex<double>> &b,
+    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch(selector.get_queue(), trans, m, n, nrhs, a, lda,
+                                                    stride_a, b, ldb, stride_b, batch_size,
+                                                    scratchpad, scratchpad_size);
+}
+static inline void heevd_batch(
+    backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::job jobz,
+    oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+    std::int64_t stride_a, sycl::buffer<float> &w, std::int64_t stride_w, std::int64_t batch_size,
+    sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevd_batch(selector.get_queue(), jobz, uplo, n, a, lda,
+                                                     stride_a, w, stride_w, batch_size, scratchpad,
+                                                     scratchpad_size);
+}
+static inline void heevd_batch(
+    backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::job jobz,
+    oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+    std::int64_t stride_a, sycl::buffer<double> &w, std::int64_t stride_w, std::int64_t batch_size,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevd_batch(selector.get_queue(), jobz, uplo, n, a, lda,
+                                                     stride_a, w, stride_w, batch_size, scratchpad,
+                                                     scratchpad_size);
+}
 static inline void getrf_batch(backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t m,
                                std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
                                std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
@@ -960,6 +1315,68 @@ static inline void potrs_batch(backend_selector<backend::LAPACK_BACKEND> selecto
                                                      stride_a, b, ldb, stride_b, batch_size,
                                                      scratchpad, scratchpad_size);
 }
+static inline void posv_batch(backend_selector<backend::LAPACK_BACKEND> selector,
+                              oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                              sycl::buffer<float> &b, std::int64_t ldb, std::int64_t stride_b,
+                              std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                              std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_batch(selector.get_queue(), uplo, n, nrhs, a, lda,
+                                                    stride_a, b, ldb, stride_b, batch_size,
+                                                    scratchpad, scratchpad_size);
+}
+static inline void posv_batch(backend_selector<backend::LAPACK_BACKEND> selector,
+                              oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                              sycl::buffer<double> &b, std::int64_t ldb, std::int64_t stride_b,
+                              std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                              std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_batch(selector.get_queue(), uplo, n, nrhs, a, lda,
+                                                    stride_a, b, ldb, stride_b, batch_size,
+                                                    scratchpad, scratchpad_size);
+}
+static inline void posv_batch(backend_selector<backend::LAPACK_BACKEND> selector,
+                              oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<std::complex<float>> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<std::complex<float>> &scratchpad,
+                              std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_batch(selector.get_queue(), uplo, n, nrhs, a, lda,
+                                                    stride_a, b, ldb, stride_b, batch_size,
+                                                    scratchpad, scratchpad_size);
+}
+static inline void posv_batch(backend_selector<backend::LAPACK_BACKEND> selector,
+                              oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<std::complex<double>> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<std::complex<double>> &scratchpad,
+                              std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_batch(selector.get_queue(), uplo, n, nrhs, a, lda,
+                                                    stride_a, b, ldb, stride_b, batch_size,
+                                                    scratchpad, scratchpad_size);
+}
+static inline void syevd_batch(backend_selector<backend::LAPACK_BACKEND> selector,
+                               oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                               sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                               sycl::buffer<float> &w, std::int64_t stride_w,
+                               std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                               std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevd_batch(selector.get_queue(), jobz, uplo, n, a, lda,
+                                                     stride_a, w, stride_w, batch_size, scratchpad,
+                                                     scratchpad_size);
+}
+static inline void syevd_batch(backend_selector<backend::LAPACK_BACKEND> selector,
+                               oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                               sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                               sycl::buffer<double> &w, std::int64_t stride_w,
+                               std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                               std::int64_t scratchpad_size) {
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevd_batch(selector.get_queue(), jobz, uplo, n, a, lda,
+                                                     stride_a, w, stride_w, batch_size, scratchpad,
+                                                     scratchpad_size);
+}
 static inline void ungqr_batch(backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t m,
                                std::int64_t n, std::int64_t k, sycl::buffer<std::complex<float>> &a,
                                std::int64_t lda, std::int64_t stride_a,
@@ -1019,6 +1436,83 @@ static inline sycl::event gebrd(backend_selector<backend::LAPACK_BACKEND> select
                                                       tauq, taup, scratchpad, scratchpad_size,
                                                       dependencies);
 }
+static inline sycl::event gels(backend_selector<backend::LAPACK_BACKEND> selector,
+                               oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                               std::int64_t nrhs, float *a, std::int64_t lda, float *b,
+                               std::int64_t ldb, float *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::gels(selector.get_queue(), trans, m, n, nrhs, a,
+                                                     lda, b, ldb, scratchpad, scratchpad_size,
+                                                     dependencies);
+}
+static inline sycl::event gels(backend_selector<backend::LAPACK_BACKEND> selector,
+                               oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                               std::int64_t nrhs, double *a, std::int64_t lda, double *b,
+                               std::int64_t ldb, double *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::gels(selector.get_queue(), trans, m, n, nrhs, a,
+                                                     lda, b, ldb, scratchpad, scratchpad_size,
+                                                     dependencies);
+}
+static inline sycl::event gels(backend_selector<backend::LAPACK_BACKEND> selector,
+                               oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                               std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                               std::complex<float> *b, std::int64_t ldb,
+                               std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::gels(selector.get_queue(), trans, m, n, nrhs, a,
+                                                     lda, b, ldb, scratchpad, scratchpad_size,
+                                                     dependencies);
+}
+static inline sycl::event gels(backend_selector<backend::LAPACK_BACKEND> selector,
+                               oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                               std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                               std::complex<double> *b, std::int64_t ldb,
+                               std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::gels(selector.get_queue(), trans, m, n, nrhs, a,
+                                                     lda, b, ldb, scratchpad, scratchpad_size,
+                                                     dependencies);
+}
+static inline sycl::event gelsd(backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t m,
+                                std::int64_t n, std::int64_t nrhs, float *a, std::int64_t lda,
+                                float *b, std::int64_t ldb, float *s, float rcond,
+                                std::int64_t *rank, float *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::gelsd(selector.get_queue(), m, n, nrhs, a, lda, b,
+                                                      ldb, s, rcond, rank, scratchpad,
+                                                      scratchpad_size, dependencies);
+}
+static inline sycl::event gelsd(backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t m,
+                                std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda,
+                                double *b, std::int64_t ldb, double *s, double rcond,
+                                std::int64_t *rank, double *scratchpad,
+                                std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::gelsd(selector.get_queue(), m, n, nrhs, a, lda, b,
+                                                      ldb, s, rcond, rank, scratchpad,
+                                                      scratchpad_size, dependencies);
+}
+static inline sycl::event gelsd(backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t m,
+                                std::int64_t n, std::int64_t nrhs, std::complex<float> *a,
+                                std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
+                                float *s, float rcond, std::int64_t *rank,
+                                std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::gelsd(selector.get_queue(), m, n, nrhs, a, lda, b,
+                                                      ldb, s, rcond, rank, scratchpad,
+                                                      scratchpad_size, dependencies);
+}
+static inline sycl::event gelsd(backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t m,
+                                std::int64_t n, std::int64_t nrhs, std::complex<double> *a,
+                                std::int64_t lda, std::complex<double> *b, std::int64_t ldb,
+                                double *s, double rcond, std::int64_t *rank,
+                                std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::gelsd(selector.get_queue(), m, n, nrhs, a, lda, b,
+                                                      ldb, s, rcond, rank, scratchpad,
+                                                      scratchpad_size, dependencies);
+}
 static inline sycl::event gerqf(backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t m,
                                 std::int64_t n, float *a, std::int64_t lda, float *tau,
                                 float *scratchpad, std::int64_t scratchpad_size,
@@ -1175,6 +1669,42 @@ static inline sycl::event getrs(backend_selector<backend::LAPACK_BACKEND> select
                                                       ipiv, b, ldb, scratchpad, scratchpad_size,
                                                       dependencies);
 }
+static inline sycl::event gesv(backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t n,
+                               std::int64_t nrhs, float *a, std::int64_t lda, std::int64_t *ipiv,
+                               float *b, std::int64_t ldb, float *scratchpad,
+                               std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::gesv(selector.get_queue(), n, nrhs, a, lda, ipiv, b,
+                                                     ldb, scratchpad, scratchpad_size,
+                                                     dependencies);
+}
+static inline sycl::event gesv(backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t n,
+                               std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t *ipiv,
+                               double *b, std::int64_t ldb, double *scratchpad,
+                               std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::gesv(selector.get_queue(), n, nrhs, a, lda, ipiv, b,
+                                                     ldb, scratchpad, scratchpad_size,
+                                                     dependencies);
+}
+static inline sycl::event gesv(backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t n,
+                               std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                               std::int64_t *ipiv, std::complex<float> *b, std::int64_t ldb,
+                               std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::gesv(selector.get_queue(), n, nrhs, a, lda, ipiv, b,
+                                                     ldb, scratchpad, scratchpad_size,
+                                                     dependencies);
+}
+static inline sycl::event gesv(backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t n,
+                               std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                               std::int64_t *ipiv, std::complex<double> *b, std::int64_t ldb,
+                               std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::gesv(selector.get_queue(), n, nrhs, a, lda, ipiv, b,
+                                                     ldb, scratchpad, scratchpad_size,
+                                                     dependencies);
+}
 static inline sycl::event gesvd(backend_selector<backend::LAPACK_BACKEND> selector,
                                 oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
                                 std::int64_t n, double *a, std::int64_t lda, double *s, double *u,
@@ -1233,6 +1763,54 @@ static inline sycl::event heevd(backend_selector<backend::LAPACK_BACKEND> select
     return oneapi::mkl::lapack::LAPACK_BACKEND::heevd(selector.get_queue(), jobz, uplo, n, a, lda,
                                                       w, scratchpad, scratchpad_size, dependencies);
 }
+static inline sycl::event heevr(backend_selector<backend::LAPACK_BACKEND> selector,
+                                oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a,
+                                std::int64_t lda, float vl, float vu, std::int64_t il,
+                                std::int64_t iu, float abstol, std::int64_t *m, float *w,
+                                std::complex<float> *z, std::int64_t ldz,
+                                std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::heevr(selector.get_queue(), jobz, range, uplo, n, a,
+                                                      lda, vl, vu, il, iu, abstol, m, w, z, ldz,
+                                                      scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event heevr(backend_selector<backend::LAPACK_BACKEND> selector,
+                                oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a,
+                                std::int64_t lda, double vl, double vu, std::int64_t il,
+                                std::int64_t iu, double abstol, std::int64_t *m, double *w,
+                                std::complex<double> *z, std::int64_t ldz,
+                                std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::heevr(selector.get_queue(), jobz, range, uplo, n, a,
+                                                      lda, vl, vu, il, iu, abstol, m, w, z, ldz,
+                                                      scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event heevx(backend_selector<backend::LAPACK_BACKEND> selector,
+                                oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a,
+                                std::int64_t lda, float vl, float vu, std::int64_t il,
+                                std::int64_t iu, float abstol, std::int64_t *m, float *w,
+                                std::complex<float> *z, std::int64_t ldz,
+                                std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::heevx(selector.get_queue(), jobz, range, uplo, n, a,
+                                                      lda, vl, vu, il, iu, abstol, m, w, z, ldz,
+                                                      scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event heevx(backend_selector<backend::LAPACK_BACKEND> selector,
+                                oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a,
+                                std::int64_t lda, double vl, double vu, std::int64_t il,
+                                std::int64_t iu, double abstol, std::int64_t *m, double *w,
+                                std::complex<double> *z, std::int64_t ldz,
+                                std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::heevx(selector.get_queue(), jobz, range, uplo, n, a,
+                                                      lda, vl, vu, il, iu, abstol, m, w, z, ldz,
+                                                      scratchpad, scratchpad_size, dependencies);
+}
 static inline sycl::event hegvd(backend_selector<backend::LAPACK_BACKEND> selector,
                                 std::int64_t itype, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
                                 std::int64_t n, std::complex<float> *a, std::int64_t lda,
@@ -1489,6 +2067,44 @@ static inline sycl::event potrs(backend_selector<backend::LAPACK_BACKEND> select
                                                       b, ldb, scratchpad, scratchpad_size,
                                                       dependencies);
 }
+static inline sycl::event posv(backend_selector<backend::LAPACK_BACKEND> selector,
+                               oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, float *a,
+                               std::int64_t lda, float *b, std::int64_t ldb, float *scratchpad,
+                               std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::posv(selector.get_queue(), uplo, n, nrhs, a, lda, b,
+                                                     ldb, scratchpad, scratchpad_size,
+                                                     dependencies);
+}
+static inline sycl::event posv(backend_selector<backend::LAPACK_BACKEND> selector,
+                               oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, double *a,
+                               std::int64_t lda, double *b, std::int64_t ldb, double *scratchpad,
+                               std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::posv(selector.get_queue(), uplo, n, nrhs, a, lda, b,
+                                                     ldb, scratchpad, scratchpad_size,
+                                                     dependencies);
+}
+static inline sycl::event posv(backend_selector<backend::LAPACK_BACKEND> selector,
+                               oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                               std::complex<float> *a, std::int64_t lda, std::complex<float> *b,
+                               std::int64_t ldb, std::complex<float> *scratchpad,
+                               std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::posv(selector.get_queue(), uplo, n, nrhs, a, lda, b,
+                                                     ldb, scratchpad, scratchpad_size,
+                                                     dependencies);
+}
+static inline sycl::event posv(backend_selector<backend::LAPACK_BACKEND> selector,
+                               oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                               std::complex<double> *a, std::int64_t lda, std::complex<double> *b,
+                               std::int64_t ldb, std::complex<double> *scratchpad,
+                               std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::posv(selector.get_queue(), uplo, n, nrhs, a, lda, b,
+                                                     ldb, scratchpad, scratchpad_size,
+                                                     dependencies);
+}
 static inline sycl::event syevd(backend_selector<backend::LAPACK_BACKEND> selector,
                                 oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
                                 double *a, std::int64_t lda, double *w, double *scratchpad,
@@ -1505,6 +2121,50 @@ static inline sycl::event syevd(backend_selector<backend::LAPACK_BACKEND> select
     return oneapi::mkl::lapack::LAPACK_BACKEND::syevd(selector.get_queue(), jobz, uplo, n, a, lda,
                                                       w, scratchpad, scratchpad_size, dependencies);
 }
+static inline sycl::event syevr(backend_selector<backend::LAPACK_BACKEND> selector,
+                                oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda,
+                                float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+                                std::int64_t *m, float *w, float *z, std::int64_t ldz,
+                                float *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::syevr(selector.get_queue(), jobz, range, uplo, n, a,
+                                                      lda, vl, vu, il, iu, abstol, m, w, z, ldz,
+                                                      scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event syevr(backend_selector<backend::LAPACK_BACKEND> selector,
+                                oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda,
+                                double vl, double vu, std::int64_t il, std::int64_t iu,
+                                double abstol, std::int64_t *m, double *w, double *z,
+                                std::int64_t ldz, double *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::syevr(selector.get_queue(), jobz, range, uplo, n, a,
+                                                      lda, vl, vu, il, iu, abstol, m, w, z, ldz,
+                                                      scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event syevx(backend_selector<backend::LAPACK_BACKEND> selector,
+                                oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda,
+                                float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+                                std::int64_t *m, float *w, float *z, std::int64_t ldz,
+                                float *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::syevx(selector.get_queue(), jobz, range, uplo, n, a,
+                                                      lda, vl, vu, il, iu, abstol, m, w, z, ldz,
+                                                      scratchpad, scratchpad_size, dependencies);
+}
+static inline sycl::event syevx(backend_selector<backend::LAPACK_BACKEND> selector,
+                                oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda,
+                                double vl, double vu, std::int64_t il, std::int64_t iu,
+                                double abstol, std::int64_t *m, double *w, double *z,
+                                std::int64_t ldz, double *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::syevx(selector.get_queue(), jobz, range, uplo, n, a,
+                                                      lda, vl, vu, il, iu, abstol, m, w, z, ldz,
+                                                      scratchpad, scratchpad_size, dependencies);
+}
 static inline sycl::event sygvd(backend_selector<backend::LAPACK_BACKEND> selector,
                                 std::int64_t itype, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
                                 std::int64_t n, double *a, std::int64_t lda, double *b,
@@ -1574,6 +2234,44 @@ static inline sycl::event sytrf(backend_selector<backend::LAPACK_BACKEND> select
     return oneapi::mkl::lapack::LAPACK_BACKEND::sytrf(selector.get_queue(), uplo, n, a, lda, ipiv,
                                                       scratchpad, scratchpad_size, dependencies);
 }
+static inline sycl::event sysv(backend_selector<backend::LAPACK_BACKEND> selector,
+                               oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, float *a,
+                               std::int64_t lda, std::int64_t *ipiv, float *b, std::int64_t ldb,
+                               float *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::sysv(selector.get_queue(), uplo, n, nrhs, a, lda,
+                                                     ipiv, b, ldb, scratchpad, scratchpad_size,
+                                                     dependencies);
+}
+static inline sycl::event sysv(backend_selector<backend::LAPACK_BACKEND> selector,
+                               oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, double *a,
+                               std::int64_t lda, std::int64_t *ipiv, double *b, std::int64_t ldb,
+                               double *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::sysv(selector.get_queue(), uplo, n, nrhs, a, lda,
+                                                     ipiv, b, ldb, scratchpad, scratchpad_size,
+                                                     dependencies);
+}
+static inline sycl::event sysv(backend_selector<backend::LAPACK_BACKEND> selector,
+                               oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                               std::complex<float> *a, std::int64_t lda, std::int64_t *ipiv,
+                               std::complex<float> *b, std::int64_t ldb,
+                               std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::sysv(selector.get_queue(), uplo, n, nrhs, a, lda,
+                                                     ipiv, b, ldb, scratchpad, scratchpad_size,
+                                                     dependencies);
+}
+static inline sycl::event sysv(backend_selector<backend::LAPACK_BACKEND> selector,
+                               oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                               std::complex<double> *a, std::int64_t lda, std::int64_t *ipiv,
+                               std::complex<double> *b, std::int64_t ldb,
+                               std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::sysv(selector.get_queue(), uplo, n, nrhs, a, lda,
+                                                     ipiv, b, ldb, scratchpad, scratchpad_size,
+                                                     dependencies);
+}
 static inline sycl::event trtrs(backend_selector<backend::LAPACK_BACKEND> selector,
                                 oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans,
                                 oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs,
@@ -2031,6 +2729,120 @@ static inline sycl::event getrs_batch(backend_selector<backend::LAPACK_BACKEND>
         selector.get_queue(), trans, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b, ldb, stride_b,
         batch_size, scratchpad, scratchpad_size, dependencies);
 }
+static inline sycl::event gesv_batch(
+    backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t n, std::int64_t nrhs, float *a,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv, float *b,
+    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, float *scratchpad,
+    std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::gesv_batch(selector.get_queue(), n, nrhs, a, lda,
+                                                           stride_a, ipiv, stride_ipiv, b, ldb,
+                                                           stride_b, batch_size, scratchpad,
+                                                           scratchpad_size, dependencies);
+}
+static inline sycl::event gesv_batch(backend_selector<backend::LAPACK_BACKEND> selector,
+                                     std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda,
+                                     std::int64_t stride_a, std::int64_t *ipiv,
+                                     std::int64_t stride_ipiv, double *b, std::int64_t ldb,
+                                     std::int64_t stride_b, std::int64_t batch_size,
+                                     double *scratchpad, std::int64_t scratchpad_size,
+                                     const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::gesv_batch(selector.get_queue(), n, nrhs, a, lda,
+                                                           stride_a, ipiv, stride_ipiv, b, ldb,
+                                                           stride_b, batch_size, scratchpad,
+                                                           scratchpad_size, dependencies);
+}
+static inline sycl::event gesv_batch(
+    backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t n, std::int64_t nrhs,
+    std::complex<float> *a, std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
+    std::int64_t stride_ipiv, std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::gesv_batch(selector.get_queue(), n, nrhs, a, lda,
+                                                           stride_a, ipiv, stride_ipiv, b, ldb,
+                                                           stride_b, batch_size, scratchpad,
+                                                           scratchpad_size, dependencies);
+}
+static inline sycl::event gesv_batch(
+    backend_selector<backend::LAPACK_BACKEND> selector, std::int64_t n, std::int64_t nrhs,
+    std::complex<double> *a, std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
+    std::int64_t stride_ipiv, std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::gesv_batch(selector.get_queue(), n, nrhs, a, lda,
+                                                           stride_a, ipiv, stride_ipiv, b, ldb,
+                                                           stride_b, batch_size, scratchpad,
+                                                           scratchpad_size, dependencies);
+}
+static inline sycl::event gels_batch(backend_selector<backend::LAPACK_BACKEND> selector,
+                                     oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                     std::int64_t nrhs, float *a, std::int64_t lda,
+                                     std::int64_t stride_a, float *b, std::int64_t ldb,
+                                     std::int64_t stride_b, std::int64_t batch_size,
+                                     float *scratchpad, std::int64_t scratchpad_size,
+                                     const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch(selector.get_queue(), trans, m, n, nrhs,
+                                                           a, lda, stride_a, b, ldb, stride_b,
+                                                           batch_size, scratchpad, scratchpad_size,
+                                                           dependencies);
+}
+static inline sycl::event gels_batch(backend_selector<backend::LAPACK_BACKEND> selector,
+                                     oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                     std::int64_t nrhs, double *a, std::int64_t lda,
+                                     std::int64_t stride_a, double *b, std::int64_t ldb,
+                                     std::int64_t stride_b, std::int64_t batch_size,
+                                     double *scratchpad, std::int64_t scratchpad_size,
+                                     const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch(selector.get_queue(), trans, m, n, nrhs,
+                                                           a, lda, stride_a, b, ldb, stride_b,
+                                                           batch_size, scratchpad, scratchpad_size,
+                                                           dependencies);
+}
+static inline sycl::event gels_batch(
+    backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::transpose trans,
+    std::int64_t m, std::int64_t n, std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch(selector.get_queue(), trans, m, n, nrhs,
+                                                           a, lda, stride_a, b, ldb, stride_b,
+                                                           batch_size, scratchpad, scratchpad_size,
+                                                           dependencies);
+}
+static inline sycl::event gels_batch(
+    backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::transpose trans,
+    std::int64_t m, std::int64_t n, std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+    std::int64_t stride_a, std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch(selector.get_queue(), trans, m, n, nrhs,
+                                                           a, lda, stride_a, b, ldb, stride_b,
+                                                           batch_size, scratchpad, scratchpad_size,
+                                                           dependencies);
+}
+static inline sycl::event heevd_batch(backend_selector<backend::LAPACK_BACKEND> selector,
+                                      oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                                      std::complex<float> *a, std::int64_t lda,
+                                      std::int64_t stride_a, float *w, std::int64_t stride_w,
+                                      std::int64_t batch_size, std::complex<float> *scratchpad,
+                                      std::int64_t scratchpad_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::heevd_batch(selector.get_queue(), jobz, uplo, n, a,
+                                                            lda, stride_a, w, stride_w, batch_size,
+                                                            scratchpad, scratchpad_size,
+                                                            dependencies);
+}
+static inline sycl::event heevd_batch(backend_selector<backend::LAPACK_BACKEND> selector,
+                                      oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                                      std::complex<double> *a, std::int64_t lda,
+                                      std::int64_t stride_a, double *w, std::int64_t stride_w,
+                                      std::int64_t batch_size, std::complex<double> *scratchpad,
+                                      std::int64_t scratchpad_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::heevd_batch(selector.get_queue(), jobz, uplo, n, a,
+                                                            lda, stride_a, w, stride_w, batch_size,
+                                                            scratchpad, scratchpad_size,
+                                                            dependencies);
+}
 static inline sycl::event getrs_batch(backend_selector<backend::LAPACK_BACKEND> selector,
                                       oneapi::mkl::transpose *trans, std::int64_t *n,
                                       std::int64_t *nrhs, float **a, std::int64_t *lda,
@@ -2243,6 +3055,70 @@ static inline sycl::event potrs_batch(backend_selector<backend::LAPACK_BACKEND>
         selector.get_queue(), uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b, batch_size,
         scratchpad, scratchpad_size, dependencies);
 }
+static inline sycl::event posv_batch(
+    backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, float *a, std::int64_t lda, std::int64_t stride_a, float *b,
+    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, float *scratchpad,
+    std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::posv_batch(selector.get_queue(), uplo, n, nrhs, a,
+                                                           lda, stride_a, b, ldb, stride_b,
+                                                           batch_size, scratchpad, scratchpad_size,
+                                                           dependencies);
+}
+static inline sycl::event posv_batch(
+    backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t stride_a, double *b,
+    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, double *scratchpad,
+    std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::posv_batch(selector.get_queue(), uplo, n, nrhs, a,
+                                                           lda, stride_a, b, ldb, stride_b,
+                                                           batch_size, scratchpad, scratchpad_size,
+                                                           dependencies);
+}
+static inline sycl::event posv_batch(
+    backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, std::complex<float> *a, std::int64_t lda, std::int64_t stride_a,
+    std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+    std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::posv_batch(selector.get_queue(), uplo, n, nrhs, a,
+                                                           lda, stride_a, b, ldb, stride_b,
+                                                           batch_size, scratchpad, scratchpad_size,
+                                                           dependencies);
+}
+static inline sycl::event posv_batch(
+    backend_selector<backend::LAPACK_BACKEND> selector, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, std::complex<double> *a, std::int64_t lda, std::int64_t stride_a,
+    std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+    std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::posv_batch(selector.get_queue(), uplo, n, nrhs, a,
+                                                           lda, stride_a, b, ldb, stride_b,
+                                                           batch_size, scratchpad, scratchpad_size,
+                                                           dependencies);
+}
+static inline sycl::event syevd_batch(backend_selector<backend::LAPACK_BACKEND> selector,
+                                      oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                                      float *a, std::int64_t lda, std::int64_t stride_a, float *w,
+                                      std::int64_t stride_w, std::int64_t batch_size,
+                                      float *scratchpad, std::int64_t scratchpad_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::syevd_batch(selector.get_queue(), jobz, uplo, n, a,
+                                                            lda, stride_a, w, stride_w, batch_size,
+                                                            scratchpad, scratchpad_size,
+                                                            dependencies);
+}
+static inline sycl::event syevd_batch(backend_selector<backend::LAPACK_BACKEND> selector,
+                                      oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                                      double *a, std::int64_t lda, std::int64_t stride_a, double *w,
+                                      std::int64_t stride_w, std::int64_t batch_size,
+                                      double *scratchpad, std::int64_t scratchpad_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {}) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::syevd_batch(selector.get_queue(), jobz, uplo, n, a,
+                                                            lda, stride_a, w, stride_w, batch_size,
+                                                            scratchpad, scratchpad_size,
+                                                            dependencies);
+}
 static inline sycl::event potrs_batch(backend_selector<backend::LAPACK_BACKEND> selector,
                                       oneapi::mkl::uplo *uplo, std::int64_t *n, std::int64_t *nrhs,
                                       float **a, std::int64_t *lda, float **b, std::int64_t *ldb,
@@ -2339,6 +3215,22 @@ std::int64_t gebrd_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> sel
                                                                                m, n, lda);
 }
 template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gels_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> selector,
+                                  oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                  std::int64_t nrhs, std::int64_t lda, std::int64_t ldb) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::gels_scratchpad_size<fp_type>(selector.get_queue(),
+                                                                              trans, m, n, nrhs,
+                                                                              lda, ldb);
+}
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gelsd_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> selector,
+                                   std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                                   std::int64_t lda, std::int64_t ldb) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::gelsd_scratchpad_size<fp_type>(selector.get_queue(),
+                                                                               m, n, nrhs, lda,
+                                                                               ldb);
+}
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
 std::int64_t gerqf_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> selector,
                                    std::int64_t m, std::int64_t n, std::int64_t lda) {
     return oneapi::mkl::lapack::LAPACK_BACKEND::gerqf_scratchpad_size<fp_type>(selector.get_queue(),
@@ -2385,6 +3277,13 @@ std::int64_t getrs_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> sel
     return oneapi::mkl::lapack::LAPACK_BACKEND::getrs_scratchpad_size<fp_type>(
         selector.get_queue(), trans, n, nrhs, lda, ldb);
 }
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gesv_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> selector,
+                                  std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                  std::int64_t ldb) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::gesv_scratchpad_size<fp_type>(selector.get_queue(),
+                                                                              n, nrhs, lda, ldb);
+}
 template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullptr>
 std::int64_t heevd_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> selector,
                                    oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
@@ -2393,6 +3292,24 @@ std::int64_t heevd_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> sel
                                                                                jobz, uplo, n, lda);
 }
 template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevr_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> selector,
+                                   oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                   oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                   std::int64_t ldz) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::heevr_scratchpad_size<fp_type>(selector.get_queue(),
+                                                                               jobz, range, uplo, n,
+                                                                               lda, ldz);
+}
+template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevx_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> selector,
+                                   oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                   oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                   std::int64_t ldz) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::heevx_scratchpad_size<fp_type>(selector.get_queue(),
+                                                                               jobz, range, uplo, n,
+                                                                               lda, ldz);
+}
+template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullptr>
 std::int64_t hegvd_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> selector,
                                    std::int64_t itype, oneapi::mkl::job jobz,
                                    oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
@@ -2475,6 +3392,14 @@ std::int64_t potrs_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> sel
         selector.get_queue(), uplo, n, nrhs, lda, ldb);
 }
 template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t posv_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> selector,
+                                  oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                                  std::int64_t lda, std::int64_t ldb) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::posv_scratchpad_size<fp_type>(selector.get_queue(),
+                                                                              uplo, n, nrhs, lda,
+                                                                              ldb);
+}
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
 std::int64_t potri_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> selector,
                                    oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda) {
     return oneapi::mkl::lapack::LAPACK_BACKEND::potri_scratchpad_size<fp_type>(selector.get_queue(),
@@ -2486,6 +3411,14 @@ std::int64_t sytrf_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> sel
     return oneapi::mkl::lapack::LAPACK_BACKEND::sytrf_scratchpad_size<fp_type>(selector.get_queue(),
                                                                                uplo, n, lda);
 }
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t sysv_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> selector,
+                                  oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                                  std::int64_t lda, std::int64_t ldb) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::sysv_scratchpad_size<fp_type>(selector.get_queue(),
+                                                                              uplo, n, nrhs, lda,
+                                                                              ldb);
+}
 template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
 std::int64_t syevd_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> selector,
                                    oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
@@ -2494,6 +3427,24 @@ std::int64_t syevd_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> sel
                                                                                jobz, uplo, n, lda);
 }
 template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevr_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> selector,
+                                   oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                   oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                   std::int64_t ldz) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::syevr_scratchpad_size<fp_type>(selector.get_queue(),
+                                                                               jobz, range, uplo, n,
+                                                                               lda, ldz);
+}
+template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevx_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> selector,
+                                   oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                   oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                   std::int64_t ldz) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::syevx_scratchpad_size<fp_type>(selector.get_queue(),
+                                                                               jobz, range, uplo, n,
+                                                                               lda, ldz);
+}
+template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
 std::int64_t sygvd_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> selector,
                                    std::int64_t itype, oneapi::mkl::job jobz,
                                    oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
@@ -2589,6 +3540,32 @@ std::int64_t getrs_batch_scratchpad_size(backend_selector<backend::LAPACK_BACKEN
         batch_size);
 }
 template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gesv_batch_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> selector,
+                                        std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                        std::int64_t stride_a, std::int64_t stride_ipiv,
+                                        std::int64_t ldb, std::int64_t stride_b,
+                                        std::int64_t batch_size) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::gesv_batch_scratchpad_size<fp_type>(
+        selector.get_queue(), n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, batch_size);
+}
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gels_batch_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> selector,
+                                        oneapi::mkl::transpose trans, std::int64_t m,
+                                        std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                        std::int64_t stride_a, std::int64_t ldb,
+                                        std::int64_t stride_b, std::int64_t batch_size) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch_scratchpad_size<fp_type>(
+        selector.get_queue(), trans, m, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+}
+template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevd_batch_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> selector,
+                                         oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                                         std::int64_t n, std::int64_t lda, std::int64_t stride_a,
+                                         std::int64_t stride_w, std::int64_t batch_size) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::heevd_batch_scratchpad_size<fp_type>(
+        selector.get_queue(), jobz, uplo, n, lda, stride_a, stride_w, batch_size);
+}
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
 std::int64_t geqrf_batch_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> selector,
                                          std::int64_t m, std::int64_t n, std::int64_t lda,
                                          std::int64_t stride_a, std::int64_t stride_tau,
@@ -2611,6 +3588,22 @@ std::int64_t potrs_batch_scratchpad_size(backend_selector<backend::LAPACK_BACKEN
     return oneapi::mkl::lapack::LAPACK_BACKEND::potrs_batch_scratchpad_size<fp_type>(
         selector.get_queue(), uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
 }
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t posv_batch_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> selector,
+                                        oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                                        std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+                                        std::int64_t stride_b, std::int64_t batch_size) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::posv_batch_scratchpad_size<fp_type>(
+        selector.get_queue(), uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+}
+template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevd_batch_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> selector,
+                                         oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                                         std::int64_t n, std::int64_t lda, std::int64_t stride_a,
+                                         std::int64_t stride_w, std::int64_t batch_size) {
+    return oneapi::mkl::lapack::LAPACK_BACKEND::syevd_batch_scratchpad_size<fp_type>(
+        selector.get_queue(), jobz, uplo, n, lda, stride_a, stride_w, batch_size);
+}
 template <typename fp_type,
           oneapi::mkl::lapack::internal::is_real_floating_point<fp_type> = nullptr>
 std::int64_t orgqr_batch_scratchpad_size(backend_selector<backend::LAPACK_BACKEND> selector,
@@ -40,6 +40,46 @@ ONEMKL_EXPORT void gebrd(sycl::queue &queue, std::int64_t m, std::int64_t n,
                          sycl::buffer<std::complex<double>> &taup,
                          sycl::buffer<std::complex<double>> &scratchpad,
                          std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                        sycl::buffer<float> &b, std::int64_t ldb, sycl::buffer<float> &scratchpad,
+                        std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a,
+                        std::int64_t lda, sycl::buffer<double> &b, std::int64_t ldb,
+                        sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<float>> &a,
+                        std::int64_t lda, sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                        sycl::buffer<std::complex<float>> &scratchpad,
+                        std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                        std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
+                        std::int64_t lda, sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                        sycl::buffer<std::complex<double>> &scratchpad,
+                        std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                         sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &b,
+                         std::int64_t ldb, sycl::buffer<float> &s, float rcond,
+                         sycl::buffer<std::int64_t> &rank, sycl::buffer<float> &scratchpad,
+                         std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                         sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b,
+                         std::int64_t ldb, sycl::buffer<double> &s, double rcond,
+                         sycl::buffer<std::int64_t> &rank, sycl::buffer<double> &scratchpad,
+                         std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                         sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                         sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                         sycl::buffer<float> &s, float rcond, sycl::buffer<std::int64_t> &rank,
+                         sycl::buffer<std::complex<float>> &scratchpad,
+                         std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                         sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                         sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                         sycl::buffer<double> &s, double rcond, sycl::buffer<std::int64_t> &rank,
+                         sycl::buffer<std::complex<double>> &scratchpad,
+                         std::int64_t scratchpad_size);
 ONEMKL_EXPORT void gerqf(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<float> &a,
                          std::int64_t lda, sycl::buffer<float> &tau,
                          sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size);
@@ -122,6 +162,24 @@ ONEMKL_EXPORT void getrs(sycl::queue &queue, oneapi::mkl::transpose trans, std::
                          sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<double>> &b,
                          std::int64_t ldb, sycl::buffer<std::complex<double>> &scratchpad,
                          std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                        sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+                        sycl::buffer<float> &b, std::int64_t ldb, sycl::buffer<float> &scratchpad,
+                        std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                        sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+                        sycl::buffer<double> &b, std::int64_t ldb, sycl::buffer<double> &scratchpad,
+                        std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                        sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<float>> &b,
+                        std::int64_t ldb, sycl::buffer<std::complex<float>> &scratchpad,
+                        std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                        sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<double>> &b,
+                        std::int64_t ldb, sycl::buffer<std::complex<double>> &scratchpad,
+                        std::int64_t scratchpad_size);
 ONEMKL_EXPORT void gesvd(sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt,
                          std::int64_t m, std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
                          sycl::buffer<double> &s, sycl::buffer<double> &u, std::int64_t ldu,
@@ -154,6 +212,30 @@ ONEMKL_EXPORT void heevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl:
                          std::int64_t n, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
                          sycl::buffer<double> &w, sycl::buffer<std::complex<double>> &scratchpad,
                          std::int64_t scratchpad_size);
+ONEMKL_EXPORT void heevr(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, sycl::buffer<std::complex<float>> &a, std::int64_t lda, float vl, float vu,
+    std::int64_t il, std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m,
+    sycl::buffer<float> &w, sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+    sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void heevr(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, sycl::buffer<std::complex<double>> &a, std::int64_t lda, double vl, double vu,
+    std::int64_t il, std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m,
+    sycl::buffer<double> &w, sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void heevx(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, sycl::buffer<std::complex<float>> &a, std::int64_t lda, float vl, float vu,
+    std::int64_t il, std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m,
+    sycl::buffer<float> &w, sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+    sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void heevx(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, sycl::buffer<std::complex<double>> &a, std::int64_t lda, double vl, double vu,
+    std::int64_t il, std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m,
+    sycl::buffer<double> &w, sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+    sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size);
 ONEMKL_EXPORT void hegvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                          oneapi::mkl::uplo uplo, std::int64_t n,
                          sycl::buffer<std::complex<float>> &a, std::int64_t lda,
@@ -284,6 +366,24 @@ ONEMKL_EXPORT void potrs(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_
                          sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
                          sycl::buffer<std::complex<double>> &scratchpad,
                          std::int64_t scratchpad_size);
+ONEMKL_EXPORT void posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                        sycl::buffer<float> &b, std::int64_t ldb, sycl::buffer<float> &scratchpad,
+                        std::int64_t scratchpad_size);
+ONEMKL_EXPORT void posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                        sycl::buffer<double> &b, std::int64_t ldb, sycl::buffer<double> &scratchpad,
+                        std::int64_t scratchpad_size);
+ONEMKL_EXPORT void posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                        sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                        sycl::buffer<std::complex<float>> &scratchpad,
+                        std::int64_t scratchpad_size);
+ONEMKL_EXPORT void posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                        sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                        sycl::buffer<std::complex<double>> &scratchpad,
+                        std::int64_t scratchpad_size);
 ONEMKL_EXPORT void syevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
                          std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
                          sycl::buffer<double> &w, sycl::buffer<double> &scratchpad,
@@ -292,6 +392,30 @@ ONEMKL_EXPORT void syevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl:
                          std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
                          sycl::buffer<float> &w, sycl::buffer<float> &scratchpad,
                          std::int64_t scratchpad_size);
+ONEMKL_EXPORT void syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+                         std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu,
+                         float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                         sycl::buffer<float> &z, std::int64_t ldz, sycl::buffer<float> &scratchpad,
+                         std::int64_t scratchpad_size);
+ONEMKL_EXPORT void syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
+                         std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu,
+                         double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                         sycl::buffer<double> &z, std::int64_t ldz,
+                         sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+                         std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu,
+                         float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                         sycl::buffer<float> &z, std::int64_t ldz, sycl::buffer<float> &scratchpad,
+                         std::int64_t scratchpad_size);
+ONEMKL_EXPORT void syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                         oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
+                         std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu,
+                         double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                         sycl::buffer<double> &z, std::int64_t ldz,
+                         sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
 ONEMKL_EXPORT void sygvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                          oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
                          std::int64_t lda, sycl::buffer<double> &b, std::int64_t ldb,
@@ -327,6 +451,24 @@ ONEMKL_EXPORT void sytrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_
                          sycl::buffer<std::int64_t> &ipiv,
                          sycl::buffer<std::complex<double>> &scratchpad,
                          std::int64_t scratchpad_size);
+ONEMKL_EXPORT void sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<float> &b, std::int64_t ldb,
+                        sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<double> &b, std::int64_t ldb,
+                        sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<float>> &b,
+                        std::int64_t ldb, sycl::buffer<std::complex<float>> &scratchpad,
+                        std::int64_t scratchpad_size);
+ONEMKL_EXPORT void sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                        sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<double>> &b,
+                        std::int64_t ldb, sycl::buffer<std::complex<double>> &scratchpad,
+                        std::int64_t scratchpad_size);
 ONEMKL_EXPORT void trtrs(sycl::queue &queue, oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans,
                          oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs,
                          sycl::buffer<std::complex<float>> &a, std::int64_t lda,
@@ -493,6 +635,68 @@ ONEMKL_EXPORT void getrs_batch(sycl::queue &queue, oneapi::mkl::transpose trans,
                                std::int64_t stride_b, std::int64_t batch_size,
                                sycl::buffer<std::complex<double>> &scratchpad,
                                std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                              sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                              sycl::buffer<float> &b, std::int64_t ldb, std::int64_t stride_b,
+                              std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                              std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                              sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                              sycl::buffer<double> &b, std::int64_t ldb, std::int64_t stride_b,
+                              std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                              std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+                              std::int64_t stride_ipiv, sycl::buffer<std::complex<float>> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<std::complex<float>> &scratchpad,
+                              std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+                              std::int64_t stride_ipiv, sycl::buffer<std::complex<double>> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<std::complex<double>> &scratchpad,
+                              std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                              std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a,
+                              std::int64_t lda, std::int64_t stride_a, sycl::buffer<float> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                              std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a,
+                              std::int64_t lda, std::int64_t stride_a, sycl::buffer<double> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                              std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<std::complex<float>> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<std::complex<float>> &scratchpad,
+                              std::int64_t scratchpad_size);
+ONEMKL_EXPORT void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                              std::int64_t n, std::int64_t nrhs,
+                              sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<std::complex<double>> &b,
+                              std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<std::complex<double>> &scratchpad,
+                              std::int64_t scratchpad_size);
+ONEMKL_EXPORT void heevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                               std::int64_t n, sycl::buffer<std::complex<float>> &a,
+                               std::int64_t lda, std::int64_t stride_a, sycl::buffer<float> &w,
+                               std::int64_t stride_w, std::int64_t batch_size,
+                               sycl::buffer<std::complex<float>> &scratchpad,
+                               std::int64_t scratchpad_size);
+ONEMKL_EXPORT void heevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                               std::int64_t n, sycl::buffer<std::complex<double>> &a,
+                               std::int64_t lda, std::int64_t stride_a, sycl::buffer<double> &w,
+                               std::int64_t stride_w, std::int64_t batch_size,
+                               sycl::buffer<std::complex<double>> &scratchpad,
+                               std::int64_t scratchpad_size);
 ONEMKL_EXPORT void getrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n,
                                sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
                                sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
@@ -567,6 +771,40 @@ ONEMKL_EXPORT void potrs_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::
                                std::int64_t stride_b, std::int64_t batch_size,
                                sycl::buffer<std::complex<double>> &scratchpad,
                                std::int64_t scratchpad_size);
+ONEMKL_EXPORT void posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<float> &b, std::int64_t ldb,
+                              std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<double> &b, std::int64_t ldb,
+                              std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+ONEMKL_EXPORT void posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<std::complex<float>> &a,
+                              std::int64_t lda, std::int64_t stride_a,
+                              sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                              std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<std::complex<float>> &scratchpad,
+                              std::int64_t scratchpad_size);
+ONEMKL_EXPORT void posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                              std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
+                              std::int64_t lda, std::int64_t stride_a,
+                              sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                              std::int64_t stride_b, std::int64_t batch_size,
+                              sycl::buffer<std::complex<double>> &scratchpad,
+                              std::int64_t scratchpad_size);
+ONEMKL_EXPORT void syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                               std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+                               std::int64_t stride_a, sycl::buffer<float> &w, std::int64_t stride_w,
+                               std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                               std::int64_t scratchpad_size);
+ONEMKL_EXPORT void syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                               std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+                               std::int64_t stride_a, sycl::buffer<double> &w,
+                               std::int64_t stride_w, std::int64_t batch_size,
+                               sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
 ONEMKL_EXPORT void ungqr_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
                                sycl::buffer<std::complex<float>> &a, std::int64_t lda,
                                std::int64_t stride_a, sycl::buffer<std::complex<float>> &tau,
@@ -597,6 +835,48 @@ ONEMKL_EXPORT sycl::event gebrd(sycl::queue &queue, std::int64_t m, std::int64_t
                                 std::complex<double> *tauq, std::complex<double> *taup,
                                 std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                                 const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                               std::int64_t n, std::int64_t nrhs, float *a, std::int64_t lda,
+                               float *b, std::int64_t ldb, float *scratchpad,
+                               std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                               std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda,
+                               double *b, std::int64_t ldb, double *scratchpad,
+                               std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                               std::int64_t n, std::int64_t nrhs, std::complex<float> *a,
+                               std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
+                               std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                               std::int64_t n, std::int64_t nrhs, std::complex<double> *a,
+                               std::int64_t lda, std::complex<double> *b, std::int64_t ldb,
+                               std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t nrhs, float *a, std::int64_t lda, float *b,
+                                std::int64_t ldb, float *s, float rcond, std::int64_t *rank,
+                                float *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t nrhs, double *a, std::int64_t lda, double *b,
+                                std::int64_t ldb, double *s, double rcond, std::int64_t *rank,
+                                double *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                                std::complex<float> *b, std::int64_t ldb, float *s, float rcond,
+                                std::int64_t *rank, std::complex<float> *scratchpad,
+                                std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                                std::complex<double> *b, std::int64_t ldb, double *s, double rcond,
+                                std::int64_t *rank, std::complex<double> *scratchpad,
+                                std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {});
 ONEMKL_EXPORT sycl::event gerqf(sycl::queue &queue, std::int64_t m, std::int64_t n, float *a,
                                 std::int64_t lda, float *tau, float *scratchpad,
                                 std::int64_t scratchpad_size,
@@ -682,6 +962,24 @@ ONEMKL_EXPORT sycl::event getrs(sycl::queue &queue, oneapi::mkl::transpose trans
                                 std::int64_t *ipiv, std::complex<double> *b, std::int64_t ldb,
                                 std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                                 const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, float *a,
+                               std::int64_t lda, std::int64_t *ipiv, float *b, std::int64_t ldb,
+                               float *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, double *a,
+                               std::int64_t lda, std::int64_t *ipiv, double *b, std::int64_t ldb,
+                               double *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                               std::complex<float> *a, std::int64_t lda, std::int64_t *ipiv,
+                               std::complex<float> *b, std::int64_t ldb,
+                               std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                               std::complex<double> *a, std::int64_t lda, std::int64_t *ipiv,
+                               std::complex<double> *b, std::int64_t ldb,
+                               std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
 ONEMKL_EXPORT sycl::event gesvd(sycl::queue &queue, oneapi::mkl::jobsvd jobu,
                                 oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n,
                                 double *a, std::int64_t lda, double *s, double *u, std::int64_t ldu,
@@ -716,6 +1014,34 @@ ONEMKL_EXPORT sycl::event heevd(sycl::queue &queue, oneapi::mkl::job jobz, oneap
                                 double *w, std::complex<double> *scratchpad,
                                 std::int64_t scratchpad_size,
                                 const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event heevr(sycl::queue &queue, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<float> *a, std::int64_t lda, float vl, float vu,
+                                std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m,
+                                float *w, std::complex<float> *z, std::int64_t ldz,
+                                std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event heevr(sycl::queue &queue, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<double> *a, std::int64_t lda, double vl, double vu,
+                                std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+                                double *w, std::complex<double> *z, std::int64_t ldz,
+                                std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event heevx(sycl::queue &queue, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<float> *a, std::int64_t lda, float vl, float vu,
+                                std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m,
+                                float *w, std::complex<float> *z, std::int64_t ldz,
+                                std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event heevx(sycl::queue &queue, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                std::complex<double> *a, std::int64_t lda, double vl, double vu,
+                                std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+                                double *w, std::complex<double> *z, std::int64_t ldz,
+                                std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {});
 ONEMKL_EXPORT sycl::event hegvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                                 oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a,
                                 std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
@@ -850,6 +1176,24 @@ ONEMKL_EXPORT sycl::event potrs(sycl::queue &queue, oneapi::mkl::uplo uplo, std:
                                 std::complex<double> *b, std::int64_t ldb,
                                 std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                                 const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, float *a, std::int64_t lda, float *b,
+                               std::int64_t ldb, float *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, double *a, std::int64_t lda, double *b,
+                               std::int64_t ldb, double *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                               std::complex<float> *b, std::int64_t ldb,
+                               std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                               std::complex<double> *b, std::int64_t ldb,
+                               std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
 ONEMKL_EXPORT sycl::event syevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
                                 std::int64_t n, double *a, std::int64_t lda, double *w,
                                 double *scratchpad, std::int64_t scratchpad_size,
@@ -858,6 +1202,32 @@ ONEMKL_EXPORT sycl::event syevd(sycl::queue &queue, oneapi::mkl::job jobz, oneap
                                 std::int64_t n, float *a, std::int64_t lda, float *w,
                                 float *scratchpad, std::int64_t scratchpad_size,
                                 const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event syevr(sycl::queue &queue, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                float *a, std::int64_t lda, float vl, float vu, std::int64_t il,
+                                std::int64_t iu, float abstol, std::int64_t *m, float *w, float *z,
+                                std::int64_t ldz, float *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event syevr(sycl::queue &queue, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                double *a, std::int64_t lda, double vl, double vu, std::int64_t il,
+                                std::int64_t iu, double abstol, std::int64_t *m, double *w,
+                                double *z, std::int64_t ldz, double *scratchpad,
+                                std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event syevx(sycl::queue &queue, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                float *a, std::int64_t lda, float vl, float vu, std::int64_t il,
+                                std::int64_t iu, float abstol, std::int64_t *m, float *w, float *z,
+                                std::int64_t ldz, float *scratchpad, std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event syevx(sycl::queue &queue, oneapi::mkl::job jobz,
+                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                                double *a, std::int64_t lda, double vl, double vu, std::int64_t il,
+                                std::int64_t iu, double abstol, std::int64_t *m, double *w,
+                                double *z, std::int64_t ldz, double *scratchpad,
+                                std::int64_t scratchpad_size,
+                                const sycl::vector_class<sycl::event> &dependencies = {});
 ONEMKL_EXPORT sycl::event sygvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                                 oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda,
                                 double *b, std::int64_t ldb, double *w, double *scratchpad,
@@ -892,6 +1262,26 @@ ONEMKL_EXPORT sycl::event sytrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std:
                                 std::complex<double> *a, std::int64_t lda, std::int64_t *ipiv,
                                 std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                                 const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, float *a, std::int64_t lda, std::int64_t *ipiv,
+                               float *b, std::int64_t ldb, float *scratchpad,
+                               std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t *ipiv,
+                               double *b, std::int64_t ldb, double *scratchpad,
+                               std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                               std::int64_t *ipiv, std::complex<float> *b, std::int64_t ldb,
+                               std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                               std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                               std::int64_t *ipiv, std::complex<double> *b, std::int64_t ldb,
+                               std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                               const sycl::vector_class<sycl::event> &dependencies = {});
 ONEMKL_EXPORT sycl::event trtrs(sycl::queue &queue, oneapi::mkl::uplo uplo,
                                 oneapi::mkl::transpose trans, oneapi::mkl::diag diag,
                                 std::int64_t n, std::int64_t nrhs, std::complex<float> *a,
@@ -1145,6 +1535,60 @@ ONEMKL_EXPORT sycl::event getrs_batch(sycl::queue &queue, oneapi::mkl::transpose
                                       std::int64_t batch_size, std::complex<double> *scratchpad,
                                       std::int64_t scratchpad_size,
                                       const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gesv_batch(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, float *a, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv, float *b, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size, float *scratchpad, std::int64_t scratchpad_size,
+    const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gesv_batch(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv, double *b,
+    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, double *scratchpad,
+    std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gesv_batch(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv, std::complex<float> *b,
+    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+    std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gesv_batch(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::complex<double> *a,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv,
+    std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+    std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gels_batch(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, float *a, std::int64_t lda, std::int64_t stride_a, float *b,
+    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, float *scratchpad,
+    std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gels_batch(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t stride_a, double *b,
+    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, double *scratchpad,
+    std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gels_batch(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::complex<float> *a, std::int64_t lda, std::int64_t stride_a,
+    std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+    std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+    const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event gels_batch(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::complex<double> *a, std::int64_t lda, std::int64_t stride_a,
+    std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+    std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+    const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event heevd_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::complex<float> *a, std::int64_t lda, std::int64_t stride_a, float *w,
+    std::int64_t stride_w, std::int64_t batch_size, std::complex<float> *scratchpad,
+    std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event heevd_batch(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::complex<double> *a, std::int64_t lda, std::int64_t stride_a, double *w,
+    std::int64_t stride_w, std::int64_t batch_size, std::complex<double> *scratchpad,
+    std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies = {});
 ONEMKL_EXPORT sycl::event getrs_batch(sycl::queue &queue, oneapi::mkl::transpose *trans,
                                       std::int64_t *n, std::int64_t *nrhs, float **a,
                                       std::int64_t *lda, std::int64_t **ipiv, float **b,
@@ -1264,6 +1708,44 @@ ONEMKL_EXPORT sycl::event potrs_batch(sycl::queue &queue, oneapi::mkl::uplo uplo
                                       std::int64_t batch_size, std::complex<double> *scratchpad,
                                       std::int64_t scratchpad_size,
                                       const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                     std::int64_t nrhs, float *a, std::int64_t lda,
+                                     std::int64_t stride_a, float *b, std::int64_t ldb,
+                                     std::int64_t stride_b, std::int64_t batch_size,
+                                     float *scratchpad, std::int64_t scratchpad_size,
+                                     const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                     std::int64_t nrhs, double *a, std::int64_t lda,
+                                     std::int64_t stride_a, double *b, std::int64_t ldb,
+                                     std::int64_t stride_b, std::int64_t batch_size,
+                                     double *scratchpad, std::int64_t scratchpad_size,
+                                     const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                     std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                                     std::int64_t stride_a, std::complex<float> *b,
+                                     std::int64_t ldb, std::int64_t stride_b,
+                                     std::int64_t batch_size, std::complex<float> *scratchpad,
+                                     std::int64_t scratchpad_size,
+                                     const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                     std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                                     std::int64_t stride_a, std::complex<double> *b,
+                                     std::int64_t ldb, std::int64_t stride_b,
+                                     std::int64_t batch_size, std::complex<double> *scratchpad,
+                                     std::int64_t scratchpad_size,
+                                     const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz,
+                                      oneapi::mkl::uplo uplo, std::int64_t n, float *a,
+                                      std::int64_t lda, std::int64_t stride_a, float *w,
+                                      std::int64_t stride_w, std::int64_t batch_size,
+                                      float *scratchpad, std::int64_t scratchpad_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {});
+ONEMKL_EXPORT sycl::event syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz,
+                                      oneapi::mkl::uplo uplo, std::int64_t n, double *a,
+                                      std::int64_t lda, std::int64_t stride_a, double *w,
+                                      std::int64_t stride_w, std::int64_t batch_size,
+                                      double *scratchpad, std::int64_t scratchpad_size,
+                                      const sycl::vector_class<sycl::event> &dependencies = {});
 ONEMKL_EXPORT sycl::event potrs_batch(sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
                                       std::int64_t *nrhs, float **a, std::int64_t *lda, float **b,
                                       std::int64_t *ldb, std::int64_t group_count,
@@ -1319,6 +1801,13 @@ template <typename fp_type, internal::is_floating_point<fp_type> = nullptr>
 std::int64_t gebrd_scratchpad_size(sycl::queue &queue, std::int64_t m, std::int64_t n,
                                    std::int64_t lda);
 template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gels_scratchpad_size(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                                  std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                  std::int64_t ldb);
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gelsd_scratchpad_size(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                   std::int64_t nrhs, std::int64_t lda, std::int64_t ldb);
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
 std::int64_t gerqf_scratchpad_size(sycl::queue &queue, std::int64_t m, std::int64_t n,
                                    std::int64_t lda);
 template <typename fp_type, internal::is_floating_point<fp_type> = nullptr>
@@ -1340,10 +1829,21 @@ std::int64_t getri_scratchpad_size(sycl::queue &queue, std::int64_t n, std::int6
 template <typename fp_type, internal::is_floating_point<fp_type> = nullptr>
 std::int64_t getrs_scratchpad_size(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
                                    std::int64_t nrhs, std::int64_t lda, std::int64_t ldb);
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gesv_scratchpad_size(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                                  std::int64_t lda, std::int64_t ldb);
 template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullptr>
 std::int64_t heevd_scratchpad_size(sycl::queue &queue, oneapi::mkl::job jobz,
                                    oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda);
 template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevr_scratchpad_size(sycl::queue &queue, oneapi::mkl::job jobz,
+                                   oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                   std::int64_t n, std::int64_t lda, std::int64_t ldz);
+template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevx_scratchpad_size(sycl::queue &queue, oneapi::mkl::job jobz,
+                                   oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                   std::int64_t n, std::int64_t lda, std::int64_t ldz);
+template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullptr>
 std::int64_t hegvd_scratchpad_size(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                                    oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
                                    std::int64_t ldb);
@@ -1387,15 +1887,29 @@ template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_
 std::int64_t potrs_scratchpad_size(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
                                    std::int64_t nrhs, std::int64_t lda, std::int64_t ldb);
 template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t posv_scratchpad_size(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                  std::int64_t nrhs, std::int64_t lda, std::int64_t ldb);
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
 std::int64_t potri_scratchpad_size(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
                                    std::int64_t lda);
 template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
 std::int64_t sytrf_scratchpad_size(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
                                    std::int64_t lda);
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t sysv_scratchpad_size(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                  std::int64_t nrhs, std::int64_t lda, std::int64_t ldb);
 template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
 std::int64_t syevd_scratchpad_size(sycl::queue &queue, oneapi::mkl::job jobz,
                                    oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda);
 template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevr_scratchpad_size(sycl::queue &queue, oneapi::mkl::job jobz,
+                                   oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                   std::int64_t n, std::int64_t lda, std::int64_t ldz);
+template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevx_scratchpad_size(sycl::queue &queue, oneapi::mkl::job jobz,
+                                   oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                   std::int64_t n, std::int64_t lda, std::int64_t ldz);
+template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
 std::int64_t sygvd_scratchpad_size(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
                                    oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
                                    std::int64_t ldb);
@@ -1448,6 +1962,21 @@ std::int64_t getrs_batch_scratchpad_size(sycl::queue &queue, oneapi::mkl::transp
                                          std::int64_t ldb, std::int64_t stride_b,
                                          std::int64_t batch_size);
 template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gesv_batch_scratchpad_size(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                                        std::int64_t lda, std::int64_t stride_a,
+                                        std::int64_t stride_ipiv, std::int64_t ldb,
+                                        std::int64_t stride_b, std::int64_t batch_size);
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gels_batch_scratchpad_size(sycl::queue &queue, oneapi::mkl::transpose trans,
+                                        std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                                        std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+                                        std::int64_t stride_b, std::int64_t batch_size);
+template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevd_batch_scratchpad_size(sycl::queue &queue, oneapi::mkl::job jobz,
+                                         oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                         std::int64_t stride_a, std::int64_t stride_w,
+                                         std::int64_t batch_size);
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
 std::int64_t geqrf_batch_scratchpad_size(sycl::queue &queue, std::int64_t m, std::int64_t n,
                                          std::int64_t lda, std::int64_t stride_a,
                                          std::int64_t stride_tau, std::int64_t batch_size);
@@ -1460,6 +1989,16 @@ std::int64_t potrs_batch_scratchpad_size(sycl::queue &queue, oneapi::mkl::uplo u
                                          std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a,
                                          std::int64_t ldb, std::int64_t stride_b,
                                          std::int64_t batch_size);
+template <typename fp_type, oneapi::mkl::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t posv_batch_scratchpad_size(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                        std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a,
+                                        std::int64_t ldb, std::int64_t stride_b,
+                                        std::int64_t batch_size);
+template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevd_batch_scratchpad_size(sycl::queue &queue, oneapi::mkl::job jobz,
+                                         oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                         std::int64_t stride_a, std::int64_t stride_w,
+                                         std::int64_t batch_size);
 template <typename fp_type,
           oneapi::mkl::lapack::internal::is_real_floating_point<fp_type> = nullptr>
 std::int64_t orgqr_batch_scratchpad_size(sycl::queue &queue, std::int64_t m, std::int64_t n,
@@ -1522,6 +2061,39 @@ ONEMKL_EXPORT std::int64_t gebrd_scratchpad_size<std::complex<double>>(sycl::que
                                                                        std::int64_t n,
                                                                        std::int64_t lda);
 template <>
+ONEMKL_EXPORT std::int64_t gels_scratchpad_size<float>(sycl::queue &queue,
+                                                       oneapi::mkl::transpose trans, std::int64_t m,
+                                                       std::int64_t n, std::int64_t nrhs,
+                                                       std::int64_t lda, std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t gels_scratchpad_size<double>(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t gels_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t gels_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t gelsd_scratchpad_size<float>(sycl::queue &queue, std::int64_t m,
+                                                        std::int64_t n, std::int64_t nrhs,
+                                                        std::int64_t lda, std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t gelsd_scratchpad_size<double>(sycl::queue &queue, std::int64_t m,
+                                                         std::int64_t n, std::int64_t nrhs,
+                                                         std::int64_t lda, std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t gelsd_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+    std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t gelsd_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+    std::int64_t ldb);
+template <>
 ONEMKL_EXPORT std::int64_t gerqf_scratchpad_size<float>(sycl::queue &queue, std::int64_t m,
                                                         std::int64_t n, std::int64_t lda);
 template <>
@@ -1622,6 +2194,20 @@ ONEMKL_EXPORT std::int64_t getrs_scratchpad_size<std::complex<double>>(
     sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n, std::int64_t nrhs,
     std::int64_t lda, std::int64_t ldb);
 template <>
+ONEMKL_EXPORT std::int64_t gesv_scratchpad_size<float>(sycl::queue &queue, std::int64_t n,
+                                                       std::int64_t nrhs, std::int64_t lda,
+                                                       std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t gesv_scratchpad_size<double>(sycl::queue &queue, std::int64_t n,
+                                                        std::int64_t nrhs, std::int64_t lda,
+                                                        std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t gesv_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t gesv_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t ldb);
+template <>
 ONEMKL_EXPORT std::int64_t heevd_scratchpad_size<std::complex<float>>(sycl::queue &queue,
                                                                       oneapi::mkl::job jobz,
                                                                       oneapi::mkl::uplo uplo,
@@ -1634,6 +2220,22 @@ ONEMKL_EXPORT std::int64_t heevd_scratchpad_size<std::complex<double>>(sycl::que
                                                                        std::int64_t n,
                                                                        std::int64_t lda);
 template <>
+ONEMKL_EXPORT std::int64_t heevr_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t ldz);
+template <>
+ONEMKL_EXPORT std::int64_t heevr_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t ldz);
+template <>
+ONEMKL_EXPORT std::int64_t heevx_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t ldz);
+template <>
+ONEMKL_EXPORT std::int64_t heevx_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t ldz);
+template <>
 ONEMKL_EXPORT std::int64_t hegvd_scratchpad_size<std::complex<float>>(
     sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
     std::int64_t n, std::int64_t lda, std::int64_t ldb);
@@ -1754,6 +2356,22 @@ ONEMKL_EXPORT std::int64_t potrs_scratchpad_size<std::complex<double>>(
     sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, std::int64_t lda,
     std::int64_t ldb);
 template <>
+ONEMKL_EXPORT std::int64_t posv_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                       std::int64_t n, std::int64_t nrhs,
+                                                       std::int64_t lda, std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t posv_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                        std::int64_t n, std::int64_t nrhs,
+                                                        std::int64_t lda, std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t posv_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+    std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t posv_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+    std::int64_t ldb);
+template <>
 ONEMKL_EXPORT std::int64_t potri_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::uplo uplo,
                                                         std::int64_t n, std::int64_t lda);
 template <>
@@ -1786,6 +2404,22 @@ ONEMKL_EXPORT std::int64_t sytrf_scratchpad_size<std::complex<double>>(sycl::que
                                                                        std::int64_t n,
                                                                        std::int64_t lda);
 template <>
+ONEMKL_EXPORT std::int64_t sysv_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                       std::int64_t n, std::int64_t nrhs,
+                                                       std::int64_t lda, std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t sysv_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                        std::int64_t n, std::int64_t nrhs,
+                                                        std::int64_t lda, std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t sysv_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+    std::int64_t ldb);
+template <>
+ONEMKL_EXPORT std::int64_t sysv_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+    std::int64_t ldb);
+template <>
 ONEMKL_EXPORT std::int64_t syevd_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::job jobz,
                                                         oneapi::mkl::uplo uplo, std::int64_t n,
                                                         std::int64_t lda);
@@ -1794,6 +2428,26 @@ ONEMKL_EXPORT std::int64_t syevd_scratchpad_size<double>(sycl::queue &queue, one
                                                          oneapi::mkl::uplo uplo, std::int64_t n,
                                                          std::int64_t lda);
 template <>
+ONEMKL_EXPORT std::int64_t syevr_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                        oneapi::mkl::rangev range,
+                                                        oneapi::mkl::uplo uplo, std::int64_t n,
+                                                        std::int64_t lda, std::int64_t ldz);
+template <>
+ONEMKL_EXPORT std::int64_t syevr_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                         oneapi::mkl::rangev range,
+                                                         oneapi::mkl::uplo uplo, std::int64_t n,
+                                                         std::int64_t lda, std::int64_t ldz);
+template <>
+ONEMKL_EXPORT std::int64_t syevx_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                        oneapi::mkl::rangev range,
+                                                        oneapi::mkl::uplo uplo, std::int64_t n,
+                                                        std::int64_t lda, std::int64_t ldz);
+template <>
+ONEMKL_EXPORT std::int64_t syevx_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                         oneapi::mkl::rangev range,
+                                                         oneapi::mkl::uplo uplo, std::int64_t n,
+                                                         std::int64_t lda, std::int64_t ldz);
+template <>
 ONEMKL_EXPORT std::int64_t sygvd_scratchpad_size<float>(sycl::queue &queue, std::int64_t itype,
                                                         oneapi::mkl::job jobz,
                                                         oneapi::mkl::uplo uplo, std::int64_t n,
@@ -1940,6 +2594,50 @@ ONEMKL_EXPORT std::int64_t getrs_batch_scratchpad_size<std::complex<double>>(
     std::int64_t lda, std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t ldb,
     std::int64_t stride_b, std::int64_t batch_size);
 template <>
+ONEMKL_EXPORT std::int64_t gesv_batch_scratchpad_size<float>(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a,
+    std::int64_t stride_ipiv, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t gesv_batch_scratchpad_size<double>(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a,
+    std::int64_t stride_ipiv, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t gesv_batch_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a,
+    std::int64_t stride_ipiv, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t gesv_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a,
+    std::int64_t stride_ipiv, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t gels_batch_scratchpad_size<float>(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t gels_batch_scratchpad_size<double>(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t gels_batch_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t gels_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t heevd_batch_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t heevd_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w, std::int64_t batch_size);
+template <>
 ONEMKL_EXPORT std::int64_t geqrf_batch_scratchpad_size<float>(sycl::queue &queue, std::int64_t m,
                                                               std::int64_t n, std::int64_t lda,
                                                               std::int64_t stride_a,
@@ -1996,6 +2694,30 @@ ONEMKL_EXPORT std::int64_t potrs_batch_scratchpad_size<std::complex<double>>(
     sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, std::int64_t lda,
     std::int64_t stride_a, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size);
 template <>
+ONEMKL_EXPORT std::int64_t posv_batch_scratchpad_size<float>(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t posv_batch_scratchpad_size<double>(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t posv_batch_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t posv_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t syevd_batch_scratchpad_size<float>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w, std::int64_t batch_size);
+template <>
+ONEMKL_EXPORT std::int64_t syevd_batch_scratchpad_size<double>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w, std::int64_t batch_size);
+template <>
 ONEMKL_EXPORT std::int64_t orgqr_batch_scratchpad_size<float>(
     sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k, std::int64_t lda,
     std::int64_t stride_a, std::int64_t stride_tau, std::int64_t batch_size);
@@ -0,0 +1,122 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl/detail/export.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace lapack {
+
+// Frees every workspace block cached for the queue. Blocks still in use by
+// submitted work are waited on before being released.
+ONEMKL_EXPORT void release_workspace(sycl::queue &queue);
+
+// Upper bound, in bytes, on the idle workspace kept across all queues. Blocks
+// returned to the pool beyond this limit are freed instead of cached.
+ONEMKL_EXPORT void set_workspace_limit(std::int64_t bytes);
+ONEMKL_EXPORT std::int64_t get_workspace_limit();
+
+namespace detail {
+
+ONEMKL_EXPORT sycl::buffer<std::uint8_t, 1> acquire_workspace_buffer(sycl::queue &queue,
+                                                                     std::int64_t bytes);
+ONEMKL_EXPORT void return_workspace_buffer(sycl::queue &queue,
+                                           sycl::buffer<std::uint8_t, 1> &workspace);
+ONEMKL_EXPORT void *acquire_workspace_usm(sycl::queue &queue, std::int64_t bytes,
+                                          sycl::vector_class<sycl::event> &dependencies);
+ONEMKL_EXPORT void return_workspace_usm(sycl::queue &queue, void *workspace, std::int64_t bytes,
+                                        sycl::event last_use);
+
+// Scratchpad drawn from the per-queue pool for the lifetime of a call. The
+// buffer runtime orders later users of the same block after this one.
+template <typename T>
+class workspace_buffer {
+public:
+    workspace_buffer(sycl::queue &queue, std::int64_t size)
+            : queue_(queue),
+              raw_(acquire_workspace_buffer(queue, std::max<std::int64_t>(size, 1) * sizeof(T))),
+              typed_(raw_.reinterpret<T, 1>(sycl::range<1>(raw_.get_count() / sizeof(T)))) {}
+    workspace_buffer(const workspace_buffer &) = delete;
+    workspace_buffer &operator=(const workspace_buffer &) = delete;
+    ~workspace_buffer() {
+        return_workspace_buffer(queue_, raw_);
+    }
+
+    sycl::buffer<T> &get() {
+        return typed_;
+    }
+
+private:
+    sycl::queue queue_;
+    sycl::buffer<std::uint8_t, 1> raw_;
+    sycl::buffer<T> typed_;
+};
+
+// USM scratchpad drawn from the per-queue pool. A reused block carries the
+// event of its previous user, which is added to the dependencies of the call;
+// release() records the event after which the block may be handed out again.
+// If the call throws before release(), the previous event is kept.
+template <typename T>
+class workspace_usm {
+public:
+    workspace_usm(sycl::queue &queue, std::int64_t size,
+                  const sycl::vector_class<sycl::event> &dependencies)
+            : queue_(queue),
+              bytes_(std::max<std::int64_t>(size, 1) * sizeof(T)),
+              dependencies_(dependencies) {
+        ptr_ = static_cast<T *>(acquire_workspace_usm(queue, bytes_, dependencies_));
+        if (dependencies_.size() > dependencies.size())
+            last_use_ = dependencies_.back();
+    }
+    workspace_usm(const workspace_usm &) = delete;
+    workspace_usm &operator=(const workspace_usm &) = delete;
+    ~workspace_usm() {
+        return_workspace_usm(queue_, ptr_, bytes_, last_use_);
+    }
+
+    T *get() const {
+        return ptr_;
+    }
+    const sycl::vector_class<sycl::event> &dependencies() const {
+        return dependencies_;
+    }
+    sycl::event release(sycl::event last_use) {
+        last_use_ = last_use;
+        return last_use;
+    }
+
+private:
+    sycl::queue queue_;
+    std::int64_t bytes_;
+    sycl::vector_class<sycl::event> dependencies_;
+    sycl::event last_use_;
+    T *ptr_;
+};
+
+} // namespace detail
+} // namespace lapack
+} // namespace mkl
+} // namespace oneapi
@@ -0,0 +1,78 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_NUMA_HPP_
+#define _ONEMKL_NUMA_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl/detail/export.hpp"
+
+namespace oneapi {
+namespace mkl {
+
+// Page placement of the USM allocations of numa_malloc_shared on multi-socket
+// machines. Pages otherwise live on the node of the thread that first touches
+// them, often all on one socket, so large level-1 and gemm calls run at the
+// bandwidth of that socket alone.
+//
+// interleave spreads the pages of an allocation round-robin over the nodes.
+// partitioned splits an allocation into one contiguous block per node, in node
+// order, as a first touch by the threads of each node would.
+//
+// The USM axpy, copy, scal, dot and gemm calls of the MKL CPU and Netlib BLAS
+// backends on partitioned arrays split their work to match: each part runs on
+// the CPUs of the node holding its block, following the output array (the
+// input array for dot, the columns of C in column-major layout and its rows in
+// row-major layout). Calls on interleaved arrays, whose pages alternate between
+// the nodes at every scale, run as usual and draw on every node at once, as do
+// calls on small arrays, with non-unit increments, or on a queue with an
+// execution policy (see oneapi/mkl/execution_policy.hpp). Placement is only
+// supported on Linux; elsewhere, and on single-node machines, the allocation
+// is plain shared USM.
+//
+// ONEMKL_NUMA_NODES, a list such as "0,1" or "0-3", sets the nodes to place
+// allocations over instead of the online nodes with CPUs. A node may be listed
+// more than once, and the calls are split even where the pages cannot be
+// placed, so that the splits can be tested on single-node machines.
+enum class numa_policy : char { none, interleave, partitioned };
+
+// Number of NUMA nodes with CPUs, or of listed nodes, 1 where NUMA is not
+// supported.
+ONEMKL_EXPORT std::int64_t numa_node_count();
+
+// Allocates bytes of shared USM on the CPU queue, page aligned and placed by
+// policy. Returns nullptr if the allocation fails.
+ONEMKL_EXPORT void *numa_malloc_shared(std::size_t bytes, sycl::queue &queue, numa_policy policy);
+
+template <typename T>
+T *numa_malloc_shared(std::size_t count, sycl::queue &queue, numa_policy policy) {
+    return static_cast<T *>(numa_malloc_shared(count * sizeof(T), queue, policy));
+}
+
+// Frees an allocation of numa_malloc_shared.
+ONEMKL_EXPORT void numa_free(void *ptr, sycl::queue &queue);
+
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_NUMA_HPP_
@@ -61,6 +61,7 @@
 
 #include <CL/sycl.hpp>
 #include <cstdint>
+#include <vector>
 
 #include "oneapi/mkl/detail/export.hpp"
 #include "oneapi/mkl/rng/detail/engine_impl.hpp"
@@ -82,6 +83,20 @@ ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_mrg32k3a(cl::sycl::q
 ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_mrg32k3a(
     cl::sycl::queue queue, std::initializer_list<std::uint32_t> seed);
 
+ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_sobol(cl::sycl::queue queue,
+                                                                  std::uint32_t dimensions);
+
+ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_sobol(
+    cl::sycl::queue queue, std::uint32_t dimensions,
+    const std::vector<std::uint32_t>& direction_numbers);
+
+ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_niederreiter(
+    cl::sycl::queue queue, std::uint32_t dimensions);
+
+ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_niederreiter(
+    cl::sycl::queue queue, std::uint32_t dimensions,
+    const std::vector<std::uint32_t>& direction_numbers);
+
 } // namespace curand
 } // namespace rng
 } // namespace mkl
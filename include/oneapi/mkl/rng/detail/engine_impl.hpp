@@ -21,10 +21,12 @@
 #define _ONEMKL_RNG_ENGINE_IMPL_HPP_
 
 #include <cstdint>
+#include <vector>
 #include <CL/sycl.hpp>
 
 #include "oneapi/mkl/detail/export.hpp"
 #include "oneapi/mkl/detail/get_device_id.hpp"
+#include "oneapi/mkl/exceptions.hpp"
 
 #include "oneapi/mkl/rng/distributions.hpp"
 
@@ -94,6 +96,20 @@ public:
     virtual void generate(const bits<std::uint32_t>& distr, std::int64_t n,
                           cl::sycl::buffer<std::uint32_t, 1>& r) = 0;
 
+    virtual void generate(const bernoulli_v<std::int32_t, bernoulli_v_method::icdf>& distr,
+                          std::int64_t n, cl::sycl::buffer<std::int32_t, 1>& r) = 0;
+
+    virtual void generate(const bernoulli_v<std::uint32_t, bernoulli_v_method::icdf>& distr,
+                          std::int64_t n, cl::sycl::buffer<std::uint32_t, 1>& r) = 0;
+
+    virtual void generate(
+        const poisson_v<std::int32_t, poisson_v_method::gaussian_icdf_based>& distr,
+        std::int64_t n, cl::sycl::buffer<std::int32_t, 1>& r) = 0;
+
+    virtual void generate(
+        const poisson_v<std::uint32_t, poisson_v_method::gaussian_icdf_based>& distr,
+        std::int64_t n, cl::sycl::buffer<std::uint32_t, 1>& r) = 0;
+
     // USM APIs
     virtual cl::sycl::event generate(
         const uniform<float, uniform_method::standard>& distr, std::int64_t n, float* r,
@@ -167,6 +183,263 @@ public:
         const bits<std::uint32_t>& distr, std::int64_t n, std::uint32_t* r,
         const cl::sycl::vector_class<cl::sycl::event>& dependencies) = 0;
 
+    virtual cl::sycl::event generate(
+        const bernoulli_v<std::int32_t, bernoulli_v_method::icdf>& distr, std::int64_t n,
+        std::int32_t* r, const cl::sycl::vector_class<cl::sycl::event>& dependencies) = 0;
+
+    virtual cl::sycl::event generate(
+        const bernoulli_v<std::uint32_t, bernoulli_v_method::icdf>& distr, std::int64_t n,
+        std::uint32_t* r, const cl::sycl::vector_class<cl::sycl::event>& dependencies) = 0;
+
+    virtual cl::sycl::event generate(
+        const poisson_v<std::int32_t, poisson_v_method::gaussian_icdf_based>& distr,
+        std::int64_t n, std::int32_t* r,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) = 0;
+
+    virtual cl::sycl::event generate(
+        const poisson_v<std::uint32_t, poisson_v_method::gaussian_icdf_based>& distr,
+        std::int64_t n, std::uint32_t* r,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) = 0;
+
+    // Batch APIs: fill r[i * stride, i * stride + n) with numbers from engines[i] in one
+    //  submission. Backends without native support report them as unimplemented
+
+    virtual void generate_batch(const uniform<float, uniform_method::standard>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<float, 1>& r, std::int64_t stride) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual void generate_batch(const uniform<double, uniform_method::standard>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<double, 1>& r, std::int64_t stride) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual void generate_batch(const uniform<std::int32_t, uniform_method::standard>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<std::int32_t, 1>& r, std::int64_t stride) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual void generate_batch(const uniform<float, uniform_method::accurate>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<float, 1>& r, std::int64_t stride) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual void generate_batch(const uniform<double, uniform_method::accurate>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<double, 1>& r, std::int64_t stride) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual void generate_batch(const gaussian<float, gaussian_method::box_muller2>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<float, 1>& r, std::int64_t stride) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual void generate_batch(const gaussian<double, gaussian_method::box_muller2>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<double, 1>& r, std::int64_t stride) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual void generate_batch(const gaussian<float, gaussian_method::icdf>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<float, 1>& r, std::int64_t stride) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual void generate_batch(const gaussian<double, gaussian_method::icdf>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<double, 1>& r, std::int64_t stride) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual void generate_batch(const lognormal<float, lognormal_method::box_muller2>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<float, 1>& r, std::int64_t stride) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual void generate_batch(const lognormal<double, lognormal_method::box_muller2>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<double, 1>& r, std::int64_t stride) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual void generate_batch(const lognormal<float, lognormal_method::icdf>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<float, 1>& r, std::int64_t stride) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual void generate_batch(const lognormal<double, lognormal_method::icdf>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<double, 1>& r, std::int64_t stride) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual void generate_batch(const bernoulli<std::int32_t, bernoulli_method::icdf>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<std::int32_t, 1>& r, std::int64_t stride) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual void generate_batch(const bernoulli<std::uint32_t, bernoulli_method::icdf>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<std::uint32_t, 1>& r, std::int64_t stride) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual void generate_batch(
+        const poisson<std::int32_t, poisson_method::gaussian_icdf_based>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n,
+        cl::sycl::buffer<std::int32_t, 1>& r, std::int64_t stride) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual void generate_batch(
+        const poisson<std::uint32_t, poisson_method::gaussian_icdf_based>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n,
+        cl::sycl::buffer<std::uint32_t, 1>& r, std::int64_t stride) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual void generate_batch(const bits<std::uint32_t>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<std::uint32_t, 1>& r, std::int64_t stride) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const uniform<float, uniform_method::standard>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, float* r, std::int64_t stride,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const uniform<double, uniform_method::standard>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, double* r, std::int64_t stride,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const uniform<std::int32_t, uniform_method::standard>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, std::int32_t* r,
+        std::int64_t stride, const cl::sycl::vector_class<cl::sycl::event>& dependencies) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const uniform<float, uniform_method::accurate>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, float* r, std::int64_t stride,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const uniform<double, uniform_method::accurate>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, double* r, std::int64_t stride,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const gaussian<float, gaussian_method::box_muller2>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, float* r, std::int64_t stride,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const gaussian<double, gaussian_method::box_muller2>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, double* r, std::int64_t stride,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const gaussian<float, gaussian_method::icdf>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, float* r, std::int64_t stride,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const gaussian<double, gaussian_method::icdf>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, double* r, std::int64_t stride,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const lognormal<float, lognormal_method::box_muller2>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, float* r, std::int64_t stride,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const lognormal<double, lognormal_method::box_muller2>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, double* r, std::int64_t stride,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const lognormal<float, lognormal_method::icdf>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, float* r, std::int64_t stride,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const lognormal<double, lognormal_method::icdf>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, double* r, std::int64_t stride,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const bernoulli<std::int32_t, bernoulli_method::icdf>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, std::int32_t* r,
+        std::int64_t stride, const cl::sycl::vector_class<cl::sycl::event>& dependencies) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const bernoulli<std::uint32_t, bernoulli_method::icdf>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, std::uint32_t* r,
+        std::int64_t stride, const cl::sycl::vector_class<cl::sycl::event>& dependencies) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const poisson<std::int32_t, poisson_method::gaussian_icdf_based>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, std::int32_t* r,
+        std::int64_t stride, const cl::sycl::vector_class<cl::sycl::event>& dependencies) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const poisson<std::uint32_t, poisson_method::gaussian_icdf_based>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, std::uint32_t* r,
+        std::int64_t stride, const cl::sycl::vector_class<cl::sycl::event>& dependencies) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const bits<std::uint32_t>& distr, const std::vector<engine_impl*>& engines, std::int64_t n,
+        std::uint32_t* r, std::int64_t stride,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) {
+        throw oneapi::mkl::unimplemented("rng", "generate_batch");
+    }
+
     virtual engine_impl* copy_state() = 0;
 
     virtual void skip_ahead(std::uint64_t num_to_skip) = 0;
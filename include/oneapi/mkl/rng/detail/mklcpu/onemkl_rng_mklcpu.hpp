@@ -21,6 +21,7 @@
 #define _ONEMKL_RNG_MKLCPU_HPP_
 
 #include <cstdint>
+#include <vector>
 #include <CL/sycl.hpp>
 
 #include "oneapi/mkl/detail/export.hpp"
@@ -43,6 +44,20 @@ ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_mrg32k3a(cl::sycl::q
 ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_mrg32k3a(
     cl::sycl::queue queue, std::initializer_list<std::uint32_t> seed);
 
+ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_sobol(cl::sycl::queue queue,
+                                                                  std::uint32_t dimensions);
+
+ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_sobol(
+    cl::sycl::queue queue, std::uint32_t dimensions,
+    const std::vector<std::uint32_t>& direction_numbers);
+
+ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_niederreiter(
+    cl::sycl::queue queue, std::uint32_t dimensions);
+
+ONEMKL_EXPORT oneapi::mkl::rng::detail::engine_impl* create_niederreiter(
+    cl::sycl::queue queue, std::uint32_t dimensions,
+    const std::vector<std::uint32_t>& direction_numbers);
+
 } // namespace mklcpu
 } // namespace rng
 } // namespace mkl
@@ -21,6 +21,7 @@
 #define _ONEMKL_RNG_LOADER_HPP_
 
 #include <cstdint>
+#include <vector>
 #include <CL/sycl.hpp>
 
 #include "oneapi/mkl/detail/export.hpp"
@@ -45,6 +46,20 @@ ONEMKL_EXPORT engine_impl* create_mrg32k3a(oneapi::mkl::device libkey, cl::sycl:
 ONEMKL_EXPORT engine_impl* create_mrg32k3a(oneapi::mkl::device libkey, cl::sycl::queue queue,
                                            std::initializer_list<std::uint32_t> seed);
 
+ONEMKL_EXPORT engine_impl* create_sobol(oneapi::mkl::device libkey, cl::sycl::queue queue,
+                                        std::uint32_t dimensions);
+
+ONEMKL_EXPORT engine_impl* create_sobol(oneapi::mkl::device libkey, cl::sycl::queue queue,
+                                        std::uint32_t dimensions,
+                                        const std::vector<std::uint32_t>& direction_numbers);
+
+ONEMKL_EXPORT engine_impl* create_niederreiter(oneapi::mkl::device libkey, cl::sycl::queue queue,
+                                               std::uint32_t dimensions);
+
+ONEMKL_EXPORT engine_impl* create_niederreiter(oneapi::mkl::device libkey, cl::sycl::queue queue,
+                                               std::uint32_t dimensions,
+                                               const std::vector<std::uint32_t>& direction_numbers);
+
 } // namespace detail
 } // namespace rng
 } // namespace mkl
@@ -0,0 +1,30 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_RNG_DEVICE_HPP_
+#define _ONEMKL_RNG_DEVICE_HPP_
+
+// Header-only engines and distributions for use inside user kernels and host loops, no
+//  backend library or queue is involved
+
+#include "oneapi/mkl/rng/device/distributions.hpp"
+#include "oneapi/mkl/rng/device/engines.hpp"
+#include "oneapi/mkl/rng/device/functions.hpp"
+
+#endif //_ONEMKL_RNG_DEVICE_HPP_
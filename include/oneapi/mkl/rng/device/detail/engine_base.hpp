@@ -0,0 +1,47 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_RNG_DEVICE_ENGINE_BASE_HPP_
+#define _ONEMKL_RNG_DEVICE_ENGINE_BASE_HPP_
+
+#include <cstdint>
+#include <CL/sycl.hpp>
+
+namespace oneapi {
+namespace mkl {
+namespace rng {
+namespace device {
+namespace detail {
+
+// Specialized for every engine. Each specialization keeps the engine state and provides
+//  generate_bits<N>(r) storing the next N raw outputs to r, skip_ahead(num_to_skip), and
+//  unit_scale: the factor mapping a raw output to [0, 1)
+template <typename Engine>
+class engine_base {};
+
+} // namespace detail
+} // namespace device
+} // namespace rng
+} // namespace mkl
+} // namespace oneapi
+
+#include "oneapi/mkl/rng/device/detail/mrg32k3a_impl.hpp"
+#include "oneapi/mkl/rng/device/detail/philox4x32x10_impl.hpp"
+
+#endif //_ONEMKL_RNG_DEVICE_ENGINE_BASE_HPP_
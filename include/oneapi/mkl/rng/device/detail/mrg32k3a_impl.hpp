@@ -0,0 +1,181 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_RNG_DEVICE_MRG32K3A_IMPL_HPP_
+#define _ONEMKL_RNG_DEVICE_MRG32K3A_IMPL_HPP_
+
+#include <cstdint>
+#include <initializer_list>
+
+namespace oneapi {
+namespace mkl {
+namespace rng {
+namespace device {
+
+template <std::int32_t VecSize>
+class mrg32k3a;
+
+namespace detail {
+
+namespace mrg32k3a_param {
+constexpr std::int64_t m_1 = 4294967087;
+constexpr std::int64_t m_2 = 4294944443;
+constexpr std::int64_t a_12 = 1403580;
+constexpr std::int64_t a_13 = 810728;
+constexpr std::int64_t a_21 = 527612;
+constexpr std::int64_t a_23 = 1370589;
+} // namespace mrg32k3a_param
+
+// MRG32k3a state follows the VSL layout: x1 = {x1[n-3], x1[n-2], x1[n-1]} and the same for x2
+struct mrg32k3a_state {
+    std::uint32_t x1[3];
+    std::uint32_t x2[3];
+};
+
+static inline std::uint64_t mrg32k3a_mod_mul(std::uint64_t a, std::uint64_t b, std::uint64_t m) {
+    return (a * b) % m;
+}
+
+// a = a * b mod m for 3x3 matrices with entries below 2^32
+static inline void mrg32k3a_mat_mul(std::uint64_t* a, const std::uint64_t* b, std::uint64_t m) {
+    std::uint64_t c[9];
+    for (std::int32_t i = 0; i < 3; i++) {
+        for (std::int32_t j = 0; j < 3; j++) {
+            std::uint64_t sum = 0;
+            for (std::int32_t k = 0; k < 3; k++) {
+                sum = (sum + mrg32k3a_mod_mul(a[3 * i + k], b[3 * k + j], m)) % m;
+            }
+            c[3 * i + j] = sum;
+        }
+    }
+    for (std::int32_t i = 0; i < 9; i++) {
+        a[i] = c[i];
+    }
+}
+
+// x = A^n * x mod m
+static inline void mrg32k3a_skip(std::uint32_t* x, const std::uint64_t* a_in, std::uint64_t n,
+                                 std::uint64_t m) {
+    std::uint64_t a[9];
+    std::uint64_t p[9] = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+    for (std::int32_t i = 0; i < 9; i++) {
+        a[i] = a_in[i];
+    }
+    for (; n > 0; n >>= 1) {
+        if (n & 1) {
+            mrg32k3a_mat_mul(p, a, m);
+        }
+        mrg32k3a_mat_mul(a, a, m);
+    }
+    std::uint64_t y[3];
+    for (std::int32_t i = 0; i < 3; i++) {
+        y[i] = 0;
+        for (std::int32_t k = 0; k < 3; k++) {
+            y[i] = (y[i] + mrg32k3a_mod_mul(p[3 * i + k], x[k], m)) % m;
+        }
+    }
+    for (std::int32_t i = 0; i < 3; i++) {
+        x[i] = static_cast<std::uint32_t>(y[i]);
+    }
+}
+
+template <std::int32_t VecSize>
+class engine_base<oneapi::mkl::rng::device::mrg32k3a<VecSize>> {
+public:
+    static constexpr double unit_scale = 2.328306549295727688e-10; // 1 / (m_1 + 1)
+
+protected:
+    engine_base(std::uint32_t seed, std::uint64_t offset) {
+        init(1, &seed);
+        skip_ahead(offset);
+    }
+
+    engine_base(std::initializer_list<std::uint32_t> seed, std::uint64_t offset) {
+        init(static_cast<std::int32_t>(seed.size()), seed.begin());
+        skip_ahead(offset);
+    }
+
+    void skip_ahead(std::uint64_t num_to_skip) {
+        constexpr std::uint64_t a1[9] = {
+            0, 1, 0, 0, 0, 1, mrg32k3a_param::m_1 - mrg32k3a_param::a_13, mrg32k3a_param::a_12, 0
+        };
+        constexpr std::uint64_t a2[9] = {
+            0, 1, 0, 0, 0, 1, mrg32k3a_param::m_2 - mrg32k3a_param::a_23, 0, mrg32k3a_param::a_21
+        };
+        mrg32k3a_skip(state_.x1, a1, num_to_skip, mrg32k3a_param::m_1);
+        mrg32k3a_skip(state_.x2, a2, num_to_skip, mrg32k3a_param::m_2);
+    }
+
+    // Outputs z = (x1[n] - x2[n]) mod m_1 in [1, m_1]
+    template <std::int32_t N>
+    void generate_bits(std::uint32_t* r) {
+        for (std::int32_t i = 0; i < N; i++) {
+            std::int64_t p1 = (mrg32k3a_param::a_12 * static_cast<std::int64_t>(state_.x1[1]) -
+                               mrg32k3a_param::a_13 * static_cast<std::int64_t>(state_.x1[0])) %
+                              mrg32k3a_param::m_1;
+            if (p1 < 0) {
+                p1 += mrg32k3a_param::m_1;
+            }
+            std::int64_t p2 = (mrg32k3a_param::a_21 * static_cast<std::int64_t>(state_.x2[2]) -
+                               mrg32k3a_param::a_23 * static_cast<std::int64_t>(state_.x2[0])) %
+                              mrg32k3a_param::m_2;
+            if (p2 < 0) {
+                p2 += mrg32k3a_param::m_2;
+            }
+            state_.x1[0] = state_.x1[1];
+            state_.x1[1] = state_.x1[2];
+            state_.x1[2] = static_cast<std::uint32_t>(p1);
+            state_.x2[0] = state_.x2[1];
+            state_.x2[1] = state_.x2[2];
+            state_.x2[2] = static_cast<std::uint32_t>(p2);
+            r[i] = static_cast<std::uint32_t>((p1 > p2) ? (p1 - p2)
+                                                        : (p1 - p2 + mrg32k3a_param::m_1));
+        }
+    }
+
+private:
+    // Same seeding as VSL_BRNG_MRG32K3A: missing seed words are ones, an all-zero component
+    //  gets its first element set to one
+    void init(std::int32_t n_words, const std::uint32_t* words) {
+        std::uint32_t x[6] = { 1, 1, 1, 1, 1, 1 };
+        for (std::int32_t i = 0; i < n_words && i < 6; i++) {
+            x[i] = words[i];
+        }
+        for (std::int32_t i = 0; i < 3; i++) {
+            state_.x1[i] = static_cast<std::uint32_t>(x[i] % mrg32k3a_param::m_1);
+            state_.x2[i] = static_cast<std::uint32_t>(x[i + 3] % mrg32k3a_param::m_2);
+        }
+        if (state_.x1[0] == 0 && state_.x1[1] == 0 && state_.x1[2] == 0) {
+            state_.x1[0] = 1;
+        }
+        if (state_.x2[0] == 0 && state_.x2[1] == 0 && state_.x2[2] == 0) {
+            state_.x2[0] = 1;
+        }
+    }
+
+    mrg32k3a_state state_;
+};
+
+} // namespace detail
+} // namespace device
+} // namespace rng
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_RNG_DEVICE_MRG32K3A_IMPL_HPP_
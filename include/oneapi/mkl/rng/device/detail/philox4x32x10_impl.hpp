@@ -0,0 +1,165 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_RNG_DEVICE_PHILOX4X32X10_IMPL_HPP_
+#define _ONEMKL_RNG_DEVICE_PHILOX4X32X10_IMPL_HPP_
+
+#include <cstdint>
+#include <initializer_list>
+
+namespace oneapi {
+namespace mkl {
+namespace rng {
+namespace device {
+
+template <std::int32_t VecSize>
+class philox4x32x10;
+
+namespace detail {
+
+namespace philox4x32x10_param {
+constexpr std::uint32_t w_0 = 0x9E3779B9;
+constexpr std::uint32_t w_1 = 0xBB67AE85;
+constexpr std::uint32_t m_0 = 0xD2511F53;
+constexpr std::uint32_t m_1 = 0xCD9E8D57;
+constexpr std::int32_t n_rounds = 10;
+} // namespace philox4x32x10_param
+
+// Philox4x32x10 state follows the VSL layout: a 64-bit key and a 128-bit counter built from
+//  the seed words {k0, k1, c0, c1, c2, c3}. Every counter value gives a block of 4 outputs,
+//  part is the position of the next output inside the block of the current counter
+struct philox4x32x10_state {
+    std::uint32_t key[2];
+    std::uint32_t counter[4];
+    std::uint32_t part;
+};
+
+static inline void philox4x32x10_round(std::uint32_t* c, const std::uint32_t* k) {
+    std::uint64_t p0 = static_cast<std::uint64_t>(philox4x32x10_param::m_0) * c[0];
+    std::uint64_t p1 = static_cast<std::uint64_t>(philox4x32x10_param::m_1) * c[2];
+    std::uint32_t c1 = c[1];
+    std::uint32_t c3 = c[3];
+    c[0] = static_cast<std::uint32_t>(p1 >> 32) ^ c1 ^ k[0];
+    c[1] = static_cast<std::uint32_t>(p1);
+    c[2] = static_cast<std::uint32_t>(p0 >> 32) ^ c3 ^ k[1];
+    c[3] = static_cast<std::uint32_t>(p0);
+}
+
+// Computes the block of 4 outputs for the counter (counter + idx)
+static inline void philox4x32x10_block(const philox4x32x10_state& state, std::uint32_t idx,
+                                       std::uint32_t* r) {
+    std::uint32_t c[4];
+    std::uint32_t k[2] = { state.key[0], state.key[1] };
+    std::uint64_t sum = static_cast<std::uint64_t>(state.counter[0]) + idx;
+    c[0] = static_cast<std::uint32_t>(sum);
+    for (std::int32_t i = 1; i < 4; i++) {
+        sum = static_cast<std::uint64_t>(state.counter[i]) + (sum >> 32);
+        c[i] = static_cast<std::uint32_t>(sum);
+    }
+    for (std::int32_t i = 0; i < philox4x32x10_param::n_rounds; i++) {
+        philox4x32x10_round(c, k);
+        k[0] += philox4x32x10_param::w_0;
+        k[1] += philox4x32x10_param::w_1;
+    }
+    for (std::int32_t i = 0; i < 4; i++) {
+        r[i] = c[i];
+    }
+}
+
+static inline void philox4x32x10_increment(std::uint32_t* counter, std::uint64_t n) {
+    std::uint64_t sum = static_cast<std::uint64_t>(counter[0]) + static_cast<std::uint32_t>(n);
+    counter[0] = static_cast<std::uint32_t>(sum);
+    sum = static_cast<std::uint64_t>(counter[1]) + (n >> 32) + (sum >> 32);
+    counter[1] = static_cast<std::uint32_t>(sum);
+    for (std::int32_t i = 2; i < 4; i++) {
+        sum = static_cast<std::uint64_t>(counter[i]) + (sum >> 32);
+        counter[i] = static_cast<std::uint32_t>(sum);
+    }
+}
+
+template <std::int32_t VecSize>
+class engine_base<oneapi::mkl::rng::device::philox4x32x10<VecSize>> {
+public:
+    static constexpr double unit_scale = 2.3283064365386962890625e-10; // 2^-32
+
+protected:
+    engine_base(std::uint64_t seed, std::uint64_t offset) {
+        std::uint32_t words[2] = { static_cast<std::uint32_t>(seed),
+                                   static_cast<std::uint32_t>(seed >> 32) };
+        init(2, words);
+        skip_ahead(offset);
+    }
+
+    engine_base(std::initializer_list<std::uint64_t> seed, std::uint64_t offset) {
+        std::uint32_t words[6];
+        std::int32_t n_words = 0;
+        for (auto s = seed.begin(); s != seed.end() && n_words < 6; s++) {
+            words[n_words++] = static_cast<std::uint32_t>(*s);
+            words[n_words++] = static_cast<std::uint32_t>(*s >> 32);
+        }
+        init(n_words, words);
+        skip_ahead(offset);
+    }
+
+    void skip_ahead(std::uint64_t num_to_skip) {
+        std::uint64_t part = state_.part + (num_to_skip & 3);
+        philox4x32x10_increment(state_.counter, (num_to_skip >> 2) + (part >> 2));
+        state_.part = static_cast<std::uint32_t>(part & 3);
+    }
+
+    // All the counter blocks touched by N outputs are computed in one loop with a trip count
+    //  known at compile time, so that 4, 8 or 16 outputs are produced per SIMD step
+    template <std::int32_t N>
+    void generate_bits(std::uint32_t* r) {
+        constexpr std::int32_t n_blocks = (N + 6) / 4;
+        std::uint32_t blocks[4 * n_blocks];
+        for (std::int32_t i = 0; i < n_blocks; i++) {
+            philox4x32x10_block(state_, i, blocks + 4 * i);
+        }
+        for (std::int32_t i = 0; i < N; i++) {
+            r[i] = blocks[state_.part + i];
+        }
+        skip_ahead(N);
+    }
+
+private:
+    // Same seeding as VSL_BRNG_PHILOX4X32X10: missing seed words are zeros
+    void init(std::int32_t n_words, const std::uint32_t* words) {
+        std::uint32_t x[6] = { 0, 0, 0, 0, 0, 0 };
+        for (std::int32_t i = 0; i < n_words && i < 6; i++) {
+            x[i] = words[i];
+        }
+        state_.key[0] = x[0];
+        state_.key[1] = x[1];
+        for (std::int32_t i = 0; i < 4; i++) {
+            state_.counter[i] = x[i + 2];
+        }
+        state_.part = 0;
+    }
+
+    philox4x32x10_state state_;
+};
+
+} // namespace detail
+} // namespace device
+} // namespace rng
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_RNG_DEVICE_PHILOX4X32X10_IMPL_HPP_
@@ -0,0 +1,160 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_RNG_DEVICE_DISTRIBUTIONS_HPP_
+#define _ONEMKL_RNG_DEVICE_DISTRIBUTIONS_HPP_
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <CL/sycl.hpp>
+
+namespace oneapi {
+namespace mkl {
+namespace rng {
+namespace device {
+
+// Distributions of this namespace transform raw engine outputs one by one, so that every
+//  random value consumes exactly one engine output. Parameters are not checked as exceptions
+//  are not available in kernels
+
+// Class template oneapi::mkl::rng::device::uniform
+//
+// Represents continuous and discrete uniform random number distribution
+//
+// Supported types:
+//      float
+//      double
+//      std::int32_t
+//
+// Supported methods:
+//      oneapi::mkl::rng::device::uniform_method::standard
+//
+// Input arguments:
+//      a - left bound. 0.0 by default
+//      b - right bound. 1.0 by default (std::numeric_limits<std::int32_t>::max() for std::int32_t)
+
+namespace uniform_method {
+struct standard {};
+using by_default = standard;
+} // namespace uniform_method
+
+template <typename Type = float, typename Method = uniform_method::by_default>
+class uniform {
+public:
+    static_assert(std::is_same<Method, uniform_method::standard>::value,
+                  "rng device uniform distribution method is incorrect");
+
+    static_assert(std::is_same<Type, float>::value || std::is_same<Type, double>::value,
+                  "rng device uniform distribution type is not supported");
+
+    using method_type = Method;
+    using result_type = Type;
+
+    uniform() : uniform(static_cast<Type>(0.0f), static_cast<Type>(1.0f)) {}
+
+    explicit uniform(Type a, Type b) : a_(a), b_(b) {}
+
+    Type a() const {
+        return a_;
+    }
+
+    Type b() const {
+        return b_;
+    }
+
+    // float keeps the 24 high bits of the output so that the [0, 1) value is exact; double
+    //  uses the whole output scaled by the engine
+    template <typename Engine>
+    Type transform(std::uint32_t x) const {
+        Type u;
+        if (std::is_same<Type, float>::value) {
+            u = static_cast<Type>(x >> 8) * static_cast<Type>(5.9604644775390625e-08); // 2^-24
+        }
+        else {
+            u = static_cast<Type>(x) * static_cast<Type>(Engine::unit_scale);
+        }
+        return a_ + (b_ - a_) * u;
+    }
+
+private:
+    Type a_;
+    Type b_;
+};
+
+template <typename Method>
+class uniform<std::int32_t, Method> {
+public:
+    static_assert(std::is_same<Method, uniform_method::standard>::value,
+                  "rng device uniform distribution method is incorrect");
+
+    using method_type = Method;
+    using result_type = std::int32_t;
+
+    uniform() : uniform(0, std::numeric_limits<std::int32_t>::max()) {}
+
+    explicit uniform(std::int32_t a, std::int32_t b) : a_(a), b_(b) {}
+
+    std::int32_t a() const {
+        return a_;
+    }
+
+    std::int32_t b() const {
+        return b_;
+    }
+
+    // Integer-only mapping of the output to [a, b), no double precision support is required
+    template <typename Engine>
+    std::int32_t transform(std::uint32_t x) const {
+        std::uint64_t range = static_cast<std::uint64_t>(static_cast<std::int64_t>(b_) - a_);
+        return static_cast<std::int32_t>(a_ + static_cast<std::int64_t>((x * range) >> 32));
+    }
+
+private:
+    std::int32_t a_;
+    std::int32_t b_;
+};
+
+// Class template oneapi::mkl::rng::device::bits
+//
+// Represents bits of underlying random number engine
+//
+// Supported types:
+//      std::uint32_t
+//
+
+template <typename UIntType = std::uint32_t>
+class bits {
+public:
+    static_assert(std::is_same<UIntType, std::uint32_t>::value,
+                  "rng device bits type is not supported");
+    using result_type = UIntType;
+
+    template <typename Engine>
+    UIntType transform(std::uint32_t x) const {
+        return x;
+    }
+};
+
+} // namespace device
+} // namespace rng
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_RNG_DEVICE_DISTRIBUTIONS_HPP_
@@ -0,0 +1,127 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_RNG_DEVICE_ENGINES_HPP_
+#define _ONEMKL_RNG_DEVICE_ENGINES_HPP_
+
+#include <cstdint>
+#include <initializer_list>
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl/rng/device/detail/engine_base.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace rng {
+namespace device {
+
+// Engines of this namespace are plain objects with no queue: they are constructed and used
+//  directly inside user kernels or host loops, typically one engine per work-item with the
+//  work-item offset passed to the constructor.
+//
+// VecSize is the number of random values returned by one call of generate(). Supported
+//  values are 1, 2, 4, 8 and 16
+
+namespace detail {
+
+// Gives the free functions access to the engine state
+class engine_accessor {
+public:
+    template <std::int32_t N, typename Engine>
+    static void generate_bits(Engine& engine, std::uint32_t* r) {
+        engine.template generate_bits<N>(r);
+    }
+
+    template <typename Engine>
+    static void skip_ahead(Engine& engine, std::uint64_t num_to_skip) {
+        engine.skip_ahead(num_to_skip);
+    }
+};
+
+template <std::int32_t VecSize>
+constexpr bool is_vec_size_supported() {
+    return VecSize == 1 || VecSize == 2 || VecSize == 4 || VecSize == 8 || VecSize == 16;
+}
+
+} // namespace detail
+
+// Class template oneapi::mkl::rng::device::philox4x32x10
+//
+// Represents Philox4x32-10 counter-based pseudorandom number generator. For the same seed and
+//  offset the sequence matches oneapi::mkl::rng::philox4x32x10 after skip_ahead(offset).
+//  All the counter blocks needed by one generate() call are computed together, which gives
+//  4, 8 or 16 outputs per SIMD step for the corresponding VecSize
+//
+// Supported parallelization methods:
+//      skip_ahead
+template <std::int32_t VecSize = 1>
+class philox4x32x10 : public detail::engine_base<philox4x32x10<VecSize>> {
+public:
+    static_assert(detail::is_vec_size_supported<VecSize>(),
+                  "rng device philox4x32x10 VecSize is not supported");
+
+    static constexpr std::uint64_t default_seed = 0;
+    static constexpr std::int32_t vec_size = VecSize;
+
+    philox4x32x10() : philox4x32x10(default_seed) {}
+
+    philox4x32x10(std::uint64_t seed, std::uint64_t offset = 0)
+            : detail::engine_base<philox4x32x10<VecSize>>(seed, offset) {}
+
+    philox4x32x10(std::initializer_list<std::uint64_t> seed, std::uint64_t offset = 0)
+            : detail::engine_base<philox4x32x10<VecSize>>(seed, offset) {}
+
+private:
+    friend class detail::engine_accessor;
+};
+
+// Class template oneapi::mkl::rng::device::mrg32k3a
+//
+// Represents the combined recurcive pseudorandom number generator. For the same seed and
+//  offset the sequence matches oneapi::mkl::rng::mrg32k3a after skip_ahead(offset)
+//
+// Supported parallelization methods:
+//      skip_ahead
+template <std::int32_t VecSize = 1>
+class mrg32k3a : public detail::engine_base<mrg32k3a<VecSize>> {
+public:
+    static_assert(detail::is_vec_size_supported<VecSize>(),
+                  "rng device mrg32k3a VecSize is not supported");
+
+    static constexpr std::uint32_t default_seed = 1;
+    static constexpr std::int32_t vec_size = VecSize;
+
+    mrg32k3a() : mrg32k3a(default_seed) {}
+
+    mrg32k3a(std::uint32_t seed, std::uint64_t offset = 0)
+            : detail::engine_base<mrg32k3a<VecSize>>(seed, offset) {}
+
+    mrg32k3a(std::initializer_list<std::uint32_t> seed, std::uint64_t offset = 0)
+            : detail::engine_base<mrg32k3a<VecSize>>(seed, offset) {}
+
+private:
+    friend class detail::engine_accessor;
+};
+
+} // namespace device
+} // namespace rng
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_RNG_DEVICE_ENGINES_HPP_
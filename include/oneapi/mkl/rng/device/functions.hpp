@@ -0,0 +1,109 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_RNG_DEVICE_FUNCTIONS_HPP_
+#define _ONEMKL_RNG_DEVICE_FUNCTIONS_HPP_
+
+#include <cstdint>
+#include <type_traits>
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl/rng/device/distributions.hpp"
+#include "oneapi/mkl/rng/device/engines.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace rng {
+namespace device {
+
+namespace detail {
+
+template <typename T>
+static inline void set_element(T& res, std::int32_t i, T value) {
+    res = value;
+}
+
+template <typename T, int N>
+static inline void set_element(cl::sycl::vec<T, N>& res, std::int32_t i, T value) {
+    res[i] = value;
+}
+
+} // namespace detail
+
+// Function oneapi::mkl::rng::device::generate()
+// Provides Engine::vec_size random numbers from a given engine with a given statistics
+//
+// Input parameters:
+//      const Distr& distr - distribution object
+//      Engine& engine     - engine object
+//
+// Returns:
+//      typename Distr::result_type for Engine::vec_size == 1,
+//      cl::sycl::vec<typename Distr::result_type, Engine::vec_size> otherwise
+template <typename Distr, typename Engine>
+static inline auto generate(const Distr& distr, Engine& engine) ->
+    typename std::conditional<Engine::vec_size == 1, typename Distr::result_type,
+                              cl::sycl::vec<typename Distr::result_type, Engine::vec_size>>::type {
+    std::uint32_t x[Engine::vec_size];
+    detail::engine_accessor::generate_bits<Engine::vec_size>(engine, x);
+    typename std::conditional<Engine::vec_size == 1, typename Distr::result_type,
+                              cl::sycl::vec<typename Distr::result_type, Engine::vec_size>>::type
+        res;
+    for (std::int32_t i = 0; i < Engine::vec_size; i++) {
+        detail::set_element(res, i, distr.template transform<Engine>(x[i]));
+    }
+    return res;
+}
+
+// Function oneapi::mkl::rng::device::generate_single()
+// Provides a single random number from a given engine with a given statistics
+//
+// Input parameters:
+//      const Distr& distr - distribution object
+//      Engine& engine     - engine object
+//
+// Returns:
+//      typename Distr::result_type - random number
+template <typename Distr, typename Engine>
+static inline typename Distr::result_type generate_single(const Distr& distr, Engine& engine) {
+    std::uint32_t x;
+    detail::engine_accessor::generate_bits<1>(engine, &x);
+    return distr.template transform<Engine>(x);
+}
+
+//  SERVICE FUNCTIONS
+
+// Function oneapi::mkl::rng::device::skip_ahead()
+//
+// Proceeds state of engine using the skip-ahead method
+//
+// Input parameters:
+//      Engine& engine            - engine object
+//      std::uint64_t num_to_skip - number of skipped elements
+template <typename Engine>
+static inline void skip_ahead(Engine& engine, std::uint64_t num_to_skip) {
+    detail::engine_accessor::skip_ahead(engine, num_to_skip);
+}
+
+} // namespace device
+} // namespace rng
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_RNG_DEVICE_FUNCTIONS_HPP_
@@ -22,6 +22,7 @@
 
 #include <cstdint>
 #include <limits>
+#include <memory>
 #include <CL/sycl.hpp>
 
 #include "oneapi/mkl/exceptions.hpp"
@@ -300,6 +301,76 @@ private:
     float p_;
 };
 
+// Class template oneapi::mkl::rng::bernoulli_v
+//
+// Represents discrete Bernoulli random number distribution with per-element parameters:
+//      the i-th generated value is drawn with p[i]
+//
+// Supported types:
+//      std::uint32_t
+//      std::int32_t
+//
+// Supported methods:
+//      oneapi::mkl::rng::bernoulli_v_method::icdf
+//
+// Input arguments:
+//      p - array of success probabilities of trials. A buffer is used with the buffer API
+//          of generate, a USM pointer accessible on the engine's device with the USM API.
+//          It must hold at least n elements, where n is the number of generated values
+
+namespace bernoulli_v_method {
+struct icdf {};
+using by_default = icdf;
+} // namespace bernoulli_v_method
+
+template <typename IntType = std::uint32_t, typename Method = bernoulli_v_method::by_default>
+class bernoulli_v {
+public:
+    static_assert(std::is_same<Method, bernoulli_v_method::icdf>::value,
+                  "rng bernoulli_v method is incorrect");
+
+    static_assert(std::is_same<IntType, std::int32_t>::value ||
+                      std::is_same<IntType, std::uint32_t>::value,
+                  "rng bernoulli_v type is not supported");
+
+    using method_type = Method;
+    using result_type = IntType;
+    using param_type = float;
+
+    explicit bernoulli_v(cl::sycl::buffer<float, 1> p)
+            : p_buffer_(std::make_shared<cl::sycl::buffer<float, 1>>(p)),
+              p_ptr_(nullptr),
+              size_(p.get_count()) {}
+
+    bernoulli_v(const float* p, std::int64_t size) : p_ptr_(p), size_(size) {
+        if (p == nullptr) {
+            throw oneapi::mkl::invalid_argument("rng", "bernoulli_v", "p is nullptr");
+        }
+        if (size < 0) {
+            throw oneapi::mkl::invalid_argument("rng", "bernoulli_v", "size < 0");
+        }
+    }
+
+    // Parameters passed as a buffer, nullptr if they were passed as a USM pointer
+    cl::sycl::buffer<float, 1>* p_buffer() const {
+        return p_buffer_.get();
+    }
+
+    // Parameters passed as a USM pointer, nullptr if they were passed as a buffer
+    const float* p() const {
+        return p_ptr_;
+    }
+
+    std::int64_t size() const {
+        return size_;
+    }
+
+private:
+    std::shared_ptr<cl::sycl::buffer<float, 1>> p_buffer_;
+    const float* p_ptr_;
+    std::int64_t size_;
+};
+
 // Class template oneapi::mkl::rng::poisson
 //
 // Represents discrete Poisson random number distribution
@@ -347,6 +418,76 @@ private:
     double lambda_;
 };
 
+// Class template oneapi::mkl::rng::poisson_v
+//
+// Represents discrete Poisson random number distribution with per-element parameters:
+//      the i-th generated value is drawn with lambda[i]
+//
+// Supported types:
+//      std::uint32_t
+//      std::int32_t
+//
+// Supported methods:
+//      oneapi::mkl::rng::poisson_v_method::gaussian_icdf_based
+//
+// Input arguments:
+//      lambda - array of distribution parameters. A buffer is used with the buffer API
+//          of generate, a USM pointer accessible on the engine's device with the USM API.
+//          It must hold at least n elements, where n is the number of generated values
+
+namespace poisson_v_method {
+struct gaussian_icdf_based {};
+using by_default = gaussian_icdf_based;
+} // namespace poisson_v_method
+
+template <typename IntType = std::int32_t, typename Method = poisson_v_method::by_default>
+class poisson_v {
+public:
+    static_assert(std::is_same<Method, poisson_v_method::gaussian_icdf_based>::value,
+                  "rng poisson_v method is incorrect");
+
+    static_assert(std::is_same<IntType, std::int32_t>::value ||
+                      std::is_same<IntType, std::uint32_t>::value,
+                  "rng poisson_v type is not supported");
+
+    using method_type = Method;
+    using result_type = IntType;
+    using param_type = double;
+
+    explicit poisson_v(cl::sycl::buffer<double, 1> lambda)
+            : lambda_buffer_(std::make_shared<cl::sycl::buffer<double, 1>>(lambda)),
+              lambda_ptr_(nullptr),
+              size_(lambda.get_count()) {}
+
+    poisson_v(const double* lambda, std::int64_t size) : lambda_ptr_(lambda), size_(size) {
+        if (lambda == nullptr) {
+            throw oneapi::mkl::invalid_argument("rng", "poisson_v", "lambda is nullptr");
+        }
+        if (size < 0) {
+            throw oneapi::mkl::invalid_argument("rng", "poisson_v", "size < 0");
+        }
+    }
+
+    // Parameters passed as a buffer, nullptr if they were passed as a USM pointer
+    cl::sycl::buffer<double, 1>* lambda_buffer() const {
+        return lambda_buffer_.get();
+    }
+
+    // Parameters passed as a USM pointer, nullptr if they were passed as a buffer
+    const double* lambda() const {
+        return lambda_ptr_;
+    }
+
+    std::int64_t size() const {
+        return size_;
+    }
+
+private:
+    std::shared_ptr<cl::sycl::buffer<double, 1>> lambda_buffer_;
+    const double* lambda_ptr_;
+    std::int64_t size_;
+};
+
 // Class template oneapi::mkl::rng::bits
 //
 // Represents bits of underlying random number engine
@@ -23,6 +23,7 @@
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <vector>
 #include <CL/sycl.hpp>
 
 #include "oneapi/mkl/exceptions.hpp"
@@ -127,6 +128,17 @@ private:
     friend sycl::event generate(const Distr& distr, Engine& engine, std::int64_t n,
                                 typename Distr::result_type* r,
                                 const sycl::vector_class<sycl::event>& dependencies);
+
+    template <typename Distr, typename Engine>
+    friend void generate_batch(const Distr& distr, Engine* engines, std::int64_t batch_size,
+                               std::int64_t n, sycl::buffer<typename Distr::result_type, 1>& r,
+                               std::int64_t stride);
+
+    template <typename Distr, typename Engine>
+    friend sycl::event generate_batch(const Distr& distr, Engine* engines,
+                                      std::int64_t batch_size, std::int64_t n,
+                                      typename Distr::result_type* r, std::int64_t stride,
+                                      const sycl::vector_class<sycl::event>& dependencies);
 };
 
 // Class oneapi::mkl::rng::mrg32k3a
@@ -208,6 +220,237 @@ private:
     friend sycl::event generate(const Distr& distr, Engine& engine, std::int64_t n,
                                 typename Distr::result_type* r,
                                 const sycl::vector_class<sycl::event>& dependencies);
+
+    template <typename Distr, typename Engine>
+    friend void generate_batch(const Distr& distr, Engine* engines, std::int64_t batch_size,
+                               std::int64_t n, sycl::buffer<typename Distr::result_type, 1>& r,
+                               std::int64_t stride);
+
+    template <typename Distr, typename Engine>
+    friend sycl::event generate_batch(const Distr& distr, Engine* engines,
+                                      std::int64_t batch_size, std::int64_t n,
+                                      typename Distr::result_type* r, std::int64_t stride,
+                                      const sycl::vector_class<sycl::event>& dependencies);
+};
+
+// Class oneapi::mkl::rng::sobol
+//
+// Represents Sobol quasi-random number generator
+//
+// Supported parallelization methods:
+//      skip_ahead
+//
+// Note: quasi-random sequences should be transformed with inverse cumulative
+//      distribution function methods, e.g. gaussian_method::icdf
+//
+// Input arguments:
+//      dimensions - number of dimensions of the generated vectors, must be positive
+//      direction_numbers - user-defined table of direction numbers stored by dimension, the same
+//          number maxdeg of them for each dimension, so of size dimensions * maxdeg. It is
+//          passed to VSL as VSL_USER_QRNG_INITIAL_VALUES, VSL_USER_DIRECTION_NUMBERS and maxdeg,
+//          followed by the table
+class sobol {
+public:
+    static constexpr std::uint32_t default_dimensions = 1;
+
+    sobol(sycl::queue queue, std::uint32_t dimensions = default_dimensions)
+            : pimpl_(detail::create_sobol(get_device_id(queue), queue, dimensions)) {}
+
+    sobol(sycl::queue queue, std::uint32_t dimensions,
+          const std::vector<std::uint32_t>& direction_numbers)
+            : pimpl_(detail::create_sobol(get_device_id(queue), queue, dimensions,
+                                          direction_numbers)) {}
+
+#ifdef ENABLE_MKLCPU_BACKEND
+    sobol(backend_selector<backend::mklcpu> selector, std::uint32_t dimensions = default_dimensions)
+            : pimpl_(mklcpu::create_sobol(selector.get_queue(), dimensions)) {}
+
+    sobol(backend_selector<backend::mklcpu> selector, std::uint32_t dimensions,
+          const std::vector<std::uint32_t>& direction_numbers)
+            : pimpl_(mklcpu::create_sobol(selector.get_queue(), dimensions, direction_numbers)) {}
+#endif
+
+#ifdef ENABLE_MKLGPU_BACKEND
+    sobol(backend_selector<backend::mklgpu> selector, std::uint32_t dimensions = default_dimensions)
+            : pimpl_(mklgpu::create_sobol(selector.get_queue(), dimensions)) {}
+
+    sobol(backend_selector<backend::mklgpu> selector, std::uint32_t dimensions,
+          const std::vector<std::uint32_t>& direction_numbers)
+            : pimpl_(mklgpu::create_sobol(selector.get_queue(), dimensions, direction_numbers)) {}
+#endif
+
+#ifdef ENABLE_CURAND_BACKEND
+    sobol(backend_selector<backend::curand> selector, std::uint32_t dimensions = default_dimensions)
+            : pimpl_(curand::create_sobol(selector.get_queue(), dimensions)) {}
+
+    sobol(backend_selector<backend::curand> selector, std::uint32_t dimensions,
+          const std::vector<std::uint32_t>& direction_numbers)
+            : pimpl_(curand::create_sobol(selector.get_queue(), dimensions, direction_numbers)) {}
+#endif
+
+    sobol(const sobol& other) {
+        pimpl_.reset(other.pimpl_.get()->copy_state());
+    }
+
+    sobol(sobol&& other) {
+        pimpl_ = std::move(other.pimpl_);
+    }
+
+    sobol& operator=(const sobol& other) {
+        if (this == &other)
+            return *this;
+        pimpl_.reset(other.pimpl_.get()->copy_state());
+        return *this;
+    }
+
+    sobol& operator=(sobol&& other) {
+        if (this == &other)
+            return *this;
+        pimpl_ = std::move(other.pimpl_);
+        return *this;
+    }
+
+private:
+    std::unique_ptr<detail::engine_impl> pimpl_;
+
+    template <typename Engine>
+    friend void skip_ahead(Engine& engine, std::uint64_t num_to_skip);
+
+    template <typename Engine>
+    friend void skip_ahead(Engine& engine, std::initializer_list<std::uint64_t> num_to_skip);
+
+    template <typename Distr, typename Engine>
+    friend void generate(const Distr& distr, Engine& engine, std::int64_t n,
+                         sycl::buffer<typename Distr::result_type, 1>& r);
+
+    template <typename Distr, typename Engine>
+    friend sycl::event generate(const Distr& distr, Engine& engine, std::int64_t n,
+                                typename Distr::result_type* r,
+                                const sycl::vector_class<sycl::event>& dependencies);
+
+    template <typename Distr, typename Engine>
+    friend void generate_batch(const Distr& distr, Engine* engines, std::int64_t batch_size,
+                               std::int64_t n, sycl::buffer<typename Distr::result_type, 1>& r,
+                               std::int64_t stride);
+
+    template <typename Distr, typename Engine>
+    friend sycl::event generate_batch(const Distr& distr, Engine* engines,
+                                      std::int64_t batch_size, std::int64_t n,
+                                      typename Distr::result_type* r, std::int64_t stride,
+                                      const sycl::vector_class<sycl::event>& dependencies);
+};
+
+// Class oneapi::mkl::rng::niederreiter
+//
+// Represents Niederreiter quasi-random number generator
+//
+// Supported parallelization methods:
+//      skip_ahead
+//
+// Note: quasi-random sequences should be transformed with inverse cumulative
+//      distribution function methods, e.g. gaussian_method::icdf
+//
+// Input arguments:
+//      dimensions - number of dimensions of the generated vectors, must be positive
+//      direction_numbers - user-defined table of direction numbers stored by dimension, the same
+//          number of them for each dimension, so of a size multiple of dimensions. It is passed
+//          to VSL as VSL_USER_QRNG_INITIAL_VALUES and VSL_USER_DIRECTION_NUMBERS, followed by
+//          the table, without a count of the direction numbers of each dimension
+class niederreiter {
+public:
+    static constexpr std::uint32_t default_dimensions = 1;
+
+    niederreiter(sycl::queue queue, std::uint32_t dimensions = default_dimensions)
+            : pimpl_(detail::create_niederreiter(get_device_id(queue), queue, dimensions)) {}
+
+    niederreiter(sycl::queue queue, std::uint32_t dimensions,
+                 const std::vector<std::uint32_t>& direction_numbers)
+            : pimpl_(detail::create_niederreiter(get_device_id(queue), queue, dimensions,
+                                                 direction_numbers)) {}
+
+#ifdef ENABLE_MKLCPU_BACKEND
+    niederreiter(backend_selector<backend::mklcpu> selector,
+                 std::uint32_t dimensions = default_dimensions)
+            : pimpl_(mklcpu::create_niederreiter(selector.get_queue(), dimensions)) {}
+
+    niederreiter(backend_selector<backend::mklcpu> selector, std::uint32_t dimensions,
+                 const std::vector<std::uint32_t>& direction_numbers)
+            : pimpl_(mklcpu::create_niederreiter(selector.get_queue(), dimensions,
+                                               direction_numbers)) {}
+#endif
+
+#ifdef ENABLE_MKLGPU_BACKEND
+    niederreiter(backend_selector<backend::mklgpu> selector,
+                 std::uint32_t dimensions = default_dimensions)
+            : pimpl_(mklgpu::create_niederreiter(selector.get_queue(), dimensions)) {}
+
+    niederreiter(backend_selector<backend::mklgpu> selector, std::uint32_t dimensions,
+                 const std::vector<std::uint32_t>& direction_numbers)
+            : pimpl_(mklgpu::create_niederreiter(selector.get_queue(), dimensions,
+                                               direction_numbers)) {}
+#endif
+
+#ifdef ENABLE_CURAND_BACKEND
+    niederreiter(backend_selector<backend::curand> selector,
+                 std::uint32_t dimensions = default_dimensions)
+            : pimpl_(curand::create_niederreiter(selector.get_queue(), dimensions)) {}
+
+    niederreiter(backend_selector<backend::curand> selector, std::uint32_t dimensions,
+                 const std::vector<std::uint32_t>& direction_numbers)
+            : pimpl_(curand::create_niederreiter(selector.get_queue(), dimensions,
+                                               direction_numbers)) {}
+#endif
+
+    niederreiter(const niederreiter& other) {
+        pimpl_.reset(other.pimpl_.get()->copy_state());
+    }
+
+    niederreiter(niederreiter&& other) {
+        pimpl_ = std::move(other.pimpl_);
+    }
+
+    niederreiter& operator=(const niederreiter& other) {
+        if (this == &other)
+            return *this;
+        pimpl_.reset(other.pimpl_.get()->copy_state());
+        return *this;
+    }
+
+    niederreiter& operator=(niederreiter&& other) {
+        if (this == &other)
+            return *this;
+        pimpl_ = std::move(other.pimpl_);
+        return *this;
+    }
+
+private:
+    std::unique_ptr<detail::engine_impl> pimpl_;
+
+    template <typename Engine>
+    friend void skip_ahead(Engine& engine, std::uint64_t num_to_skip);
+
+    template <typename Engine>
+    friend void skip_ahead(Engine& engine, std::initializer_list<std::uint64_t> num_to_skip);
+
+    template <typename Distr, typename Engine>
+    friend void generate(const Distr& distr, Engine& engine, std::int64_t n,
+                         sycl::buffer<typename Distr::result_type, 1>& r);
+
+    template <typename Distr, typename Engine>
+    friend sycl::event generate(const Distr& distr, Engine& engine, std::int64_t n,
+                                typename Distr::result_type* r,
+                                const sycl::vector_class<sycl::event>& dependencies);
+
+    template <typename Distr, typename Engine>
+    friend void generate_batch(const Distr& distr, Engine* engines, std::int64_t batch_size,
+                               std::int64_t n, sycl::buffer<typename Distr::result_type, 1>& r,
+                               std::int64_t stride);
+
+    template <typename Distr, typename Engine>
+    friend sycl::event generate_batch(const Distr& distr, Engine* engines,
+                                      std::int64_t batch_size, std::int64_t n,
+                                      typename Distr::result_type* r, std::int64_t stride,
+                                      const sycl::vector_class<sycl::event>& dependencies);
 };
 
 // Default engine to be used for common cases
@@ -21,6 +21,7 @@
 #define _ONEMKL_RNG_FUNCTIONS_HPP_
 
 #include <cstdint>
+#include <vector>
 #include <CL/sycl.hpp>
 
 #include "oneapi/mkl/exceptions.hpp"
@@ -70,6 +71,69 @@ static inline cl::sycl::event generate(
     return engine.pimpl_->generate(distr, n, r, dependencies);
 }
 
+// Function oneapi::mkl::rng::generate_batch(). Buffer API
+// Provides random numbers from each of the given engines with a given statistics in a single
+//  submission. Numbers from engines[i] are stored to r[i * stride, i * stride + n)
+//
+// Input parameters:
+//      const Distr& distr               - distribution object
+//      Engine* engines                  - array of engine objects of the same backend
+//      std::int64_t batch_size          - number of engines
+//      std::int64_t n                   - number of random values to be generated by each engine
+//      std::int64_t stride              - distance between the outputs of successive engines
+//
+// Output parameters:
+//      cl::sycl::buffer<typename Distr::result_type, 1>& r - cl::sycl::buffer to the output vector
+template <typename Distr, typename Engine>
+static inline void generate_batch(const Distr& distr, Engine* engines, std::int64_t batch_size,
+                                  std::int64_t n, sycl::buffer<typename Distr::result_type, 1>& r,
+                                  std::int64_t stride) {
+    generate_batch_precondition(distr, engines, batch_size, n, r, stride);
+    if (batch_size == 0) {
+        return;
+    }
+    std::vector<detail::engine_impl*> impls(batch_size);
+    for (std::int64_t i = 0; i < batch_size; i++) {
+        impls[i] = engines[i].pimpl_.get();
+    }
+    engines[0].pimpl_->generate_batch(distr, impls, n, r, stride);
+}
+
+// Function oneapi::mkl::rng::generate_batch(). USM API
+// Provides random numbers from each of the given engines with a given statistics in a single
+//  submission. Numbers from engines[i] are stored to r[i * stride, i * stride + n)
+//
+// Input parameters:
+//      const Distr& distr               - distribution object
+//      Engine* engines                  - array of engine objects of the same backend
+//      std::int64_t batch_size          - number of engines
+//      std::int64_t n                   - number of random values to be generated by each engine
+//      std::int64_t stride              - distance between the outputs of successive engines
+//      const cl::sycl::vector_class<cl::sycl::event>& dependencies - list of events to wait for
+//                  before starting computation, if any. If omitted, defaults to no dependencies
+//
+// Output parameters:
+//      typename Distr::result_type* - pointer to the output vector
+//
+// Returns:
+//      cl::sycl::event - event for the submitted to the first engine's queue task
+template <typename Distr, typename Engine>
+static inline cl::sycl::event generate_batch(
+    const Distr& distr, Engine* engines, std::int64_t batch_size, std::int64_t n,
+    typename Distr::result_type* r, std::int64_t stride,
+    const cl::sycl::vector_class<cl::sycl::event>& dependencies = {}) {
+    generate_batch_precondition(distr, engines, batch_size, n, r, stride, dependencies);
+    if (batch_size == 0) {
+        cl::sycl::event::wait_and_throw(dependencies);
+        return cl::sycl::event{};
+    }
+    std::vector<detail::engine_impl*> impls(batch_size);
+    for (std::int64_t i = 0; i < batch_size; i++) {
+        impls[i] = engines[i].pimpl_.get();
+    }
+    return engines[0].pimpl_->generate_batch(distr, impls, n, r, stride, dependencies);
+}
+
 //  SERVICE FUNCTIONS
 
 // Function oneapi::mkl::rng::skip_ahead(). Common interface
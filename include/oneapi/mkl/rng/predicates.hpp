@@ -25,6 +25,7 @@
 
 #include "oneapi/mkl/exceptions.hpp"
 #include "oneapi/mkl/types.hpp"
+#include "oneapi/mkl/rng/distributions.hpp"
 
 namespace oneapi {
 namespace mkl {
@@ -58,6 +59,119 @@ inline void generate_precondition(const Distr& distr, Engine& engine, std::int64
 #endif
 }
 
+// Vector-parameter distributions: parameters must be passed in the same form as the output
+// and hold at least n elements
+
+template <typename IntType, typename Method, typename Engine>
+inline void generate_precondition(const bernoulli_v<IntType, Method>& distr, Engine& engine,
+                                  std::int64_t n, sycl::buffer<IntType, 1>& r) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    if (n < 0 || n > r.get_count() || n > distr.size()) {
+        throw oneapi::mkl::invalid_argument("rng", "generate", "n");
+    }
+    if (distr.p_buffer() == nullptr) {
+        throw oneapi::mkl::invalid_argument("rng", "generate", "p is not a buffer");
+    }
+#endif
+}
+
+template <typename IntType, typename Method, typename Engine>
+inline void generate_precondition(const bernoulli_v<IntType, Method>& distr, Engine& engine,
+                                  std::int64_t n, IntType* r,
+                                  const cl::sycl::vector_class<cl::sycl::event>& dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    if (n < 0 || n > distr.size()) {
+        throw oneapi::mkl::invalid_argument("rng", "generate", "n");
+    }
+    if (r == nullptr) {
+        throw oneapi::mkl::invalid_argument("rng", "generate", "r is nullptr");
+    }
+    if (distr.p() == nullptr) {
+        throw oneapi::mkl::invalid_argument("rng", "generate", "p is not a USM pointer");
+    }
+#endif
+}
+
+template <typename IntType, typename Method, typename Engine>
+inline void generate_precondition(const poisson_v<IntType, Method>& distr, Engine& engine,
+                                  std::int64_t n, sycl::buffer<IntType, 1>& r) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    if (n < 0 || n > r.get_count() || n > distr.size()) {
+        throw oneapi::mkl::invalid_argument("rng", "generate", "n");
+    }
+    if (distr.lambda_buffer() == nullptr) {
+        throw oneapi::mkl::invalid_argument("rng", "generate", "lambda is not a buffer");
+    }
+#endif
+}
+
+template <typename IntType, typename Method, typename Engine>
+inline void generate_precondition(const poisson_v<IntType, Method>& distr, Engine& engine,
+                                  std::int64_t n, IntType* r,
+                                  const cl::sycl::vector_class<cl::sycl::event>& dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    if (n < 0 || n > distr.size()) {
+        throw oneapi::mkl::invalid_argument("rng", "generate", "n");
+    }
+    if (r == nullptr) {
+        throw oneapi::mkl::invalid_argument("rng", "generate", "r is nullptr");
+    }
+    if (distr.lambda() == nullptr) {
+        throw oneapi::mkl::invalid_argument("rng", "generate", "lambda is not a USM pointer");
+    }
+#endif
+}
+
+// Batch APIs
+
+template <typename Distr, typename Engine>
+inline void generate_batch_precondition(const Distr& distr, Engine* engines,
+                                        std::int64_t batch_size, std::int64_t n,
+                                        sycl::buffer<typename Distr::result_type, 1>& r,
+                                        std::int64_t stride) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    if (batch_size < 0) {
+        throw oneapi::mkl::invalid_argument("rng", "generate_batch", "batch_size");
+    }
+    if (batch_size > 0 && engines == nullptr) {
+        throw oneapi::mkl::invalid_argument("rng", "generate_batch", "engines is nullptr");
+    }
+    if (n < 0) {
+        throw oneapi::mkl::invalid_argument("rng", "generate_batch", "n");
+    }
+    if (stride < n) {
+        throw oneapi::mkl::invalid_argument("rng", "generate_batch", "stride");
+    }
+    if (batch_size > 0 && (batch_size - 1) * stride + n > r.get_count()) {
+        throw oneapi::mkl::invalid_argument("rng", "generate_batch", "r is too small");
+    }
+#endif
+}
+
+template <typename Distr, typename Engine>
+inline void generate_batch_precondition(
+    const Distr& distr, Engine* engines, std::int64_t batch_size, std::int64_t n,
+    typename Distr::result_type* r, std::int64_t stride,
+    const cl::sycl::vector_class<cl::sycl::event>& dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    if (batch_size < 0) {
+        throw oneapi::mkl::invalid_argument("rng", "generate_batch", "batch_size");
+    }
+    if (batch_size > 0 && engines == nullptr) {
+        throw oneapi::mkl::invalid_argument("rng", "generate_batch", "engines is nullptr");
+    }
+    if (n < 0) {
+        throw oneapi::mkl::invalid_argument("rng", "generate_batch", "n");
+    }
+    if (stride < n) {
+        throw oneapi::mkl::invalid_argument("rng", "generate_batch", "stride");
+    }
+    if (r == nullptr) {
+        throw oneapi::mkl::invalid_argument("rng", "generate_batch", "r is nullptr");
+    }
+#endif
+}
+
 } // namespace rng
 } // namespace mkl
 } // namespace oneapi
@@ -0,0 +1,74 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_STATS_HPP_
+#define _ONEMKL_STATS_HPP_
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "oneapi/mkl/detail/export.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace stats {
+
+// Buckets of the size histograms. Bucket 0 counts calls of size 0 and bucket
+// b > 0 calls of size in [2^(b-1), 2^b), the last one also taking every
+// larger size.
+constexpr int size_buckets = 32;
+
+// Counters of one routine on one backend, gathered for every call that goes
+// through the run-time dispatcher since the process started or since the
+// last reset().
+struct routine_stats {
+    std::string domain;
+    // Precision-prefixed routine, suffixed with _usm for USM APIs.
+    std::string routine;
+    // column_major, row_major, or empty for domains without a layout.
+    std::string layout;
+    // Backend key (x86cpu, intelgpu, nvidiagpu or amdgpu) and the library the
+    // calls ran on. While autotuning routes x86cpu calls, each CPU backend has
+    // its own counters.
+    std::string device;
+    std::string backend;
+    std::int64_t calls;
+    // Floating-point operations and bytes of the operands, estimated from the
+    // scalar arguments. Complex operations count as four real ones. Both are
+    // zero for routines without an estimate, such as group batches.
+    double flops;
+    double bytes;
+    // Calls by size, the size of a call being the largest of m, n and k.
+    std::array<std::int64_t, size_buckets> size_histogram;
+};
+
+// Counters of every routine and backend called at least once. The counters
+// are updated without locking, so a snapshot taken while calls are in flight
+// may be slightly inconsistent between fields.
+ONEMKL_EXPORT std::vector<routine_stats> snapshot();
+
+ONEMKL_EXPORT void reset();
+
+} // namespace stats
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_STATS_HPP_
@@ -0,0 +1,52 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_THREADING_LAYER_HPP_
+#define _ONEMKL_THREADING_LAYER_HPP_
+
+#include "oneapi/mkl/detail/export.hpp"
+
+namespace oneapi {
+namespace mkl {
+
+// Threading layer of MKL in the MKL CPU BLAS and RNG backends. When oneMKL is
+// configured with ENABLE_MKLCPU_THREAD_RUNTIME, these backends link the single
+// dynamic MKL library, which loads the layer selected here when the first of
+// them runs a call, so one build serves both TBB and OpenMP applications.
+// Otherwise the layer is the one linked at build time and the selection has
+// no effect. This option cannot be combined with the backends that use the
+// MKL DPC++ interfaces (the MKL CPU LAPACK backend and the MKL GPU backends),
+// which link the layered MKL libraries.
+//
+// Setting ONEMKL_THREADING_LAYER to sequential, intel, gnu or tbb selects the
+// layer from startup. With mkl_default, MKL makes its own choice, following
+// MKL_THREADING_LAYER if it is set. The layer cannot change once MKL has run a
+// call, as MKL loads it only once per process.
+enum class threading_layer : char { mkl_default, sequential, intel, gnu, tbb };
+
+// Selects the layer the MKL CPU backends load. Throws invalid_argument if one
+// of them already ran a call with another layer.
+ONEMKL_EXPORT void set_threading_layer(threading_layer layer);
+
+ONEMKL_EXPORT threading_layer get_threading_layer();
+
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_THREADING_LAYER_HPP_
@@ -0,0 +1,57 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_VERBOSE_HPP_
+#define _ONEMKL_VERBOSE_HPP_
+
+#include <string>
+
+#include "oneapi/mkl/detail/export.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace verbose {
+
+// Tracing of the BLAS, LAPACK and RNG calls that go through the run-time
+// dispatcher. Each call is recorded with its routine, backend, layout, scalar
+// dimensions and host-side submit time. USM calls on a queue created with
+// sycl::property::queue::enable_profiling also get the device execution time
+// of their event. Records are buffered in memory and appended to a Chrome trace
+// file (JSON array format, readable by chrome://tracing and Perfetto) on
+// flush(), on disable() and at process exit.
+//
+// Setting ONEMKL_VERBOSE=1 enables tracing from startup. The output file is
+// ONEMKL_VERBOSE_OUTPUT, or onemkl_trace.<pid>.json if it is not set.
+
+// Starts tracing into path, or into the default file if path is empty.
+ONEMKL_EXPORT void enable(const std::string &path = "");
+
+// Writes pending records and stops tracing.
+ONEMKL_EXPORT void disable();
+
+// Writes pending records, waiting for the profiled events they refer to.
+ONEMKL_EXPORT void flush();
+
+ONEMKL_EXPORT bool is_enabled();
+
+} // namespace verbose
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_VERBOSE_HPP_
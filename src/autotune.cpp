@@ -0,0 +1,284 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "oneapi/mkl/autotune.hpp"
+#include "autotune_helper.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace detail {
+namespace autotune {
+
+std::atomic<bool> active{ false };
+
+namespace {
+
+// Key of a size bucket of a routine in the table: domain, layout, routine and
+// bucket, separated by spaces.
+std::string table_key(const stats::routine &routine, int bucket) {
+    std::string key = verbose::domain_name(routine.where.domain);
+    key += ' ';
+    key += routine.where.layout != nullptr ? routine.where.layout : "-";
+    key += ' ';
+    key += routine.name;
+    key += ' ';
+    key += std::to_string(bucket);
+    return key;
+}
+
+class tuner {
+public:
+    tuner() {
+        const char *env = std::getenv("ONEMKL_AUTOTUNE_SAMPLES");
+        if (env != nullptr && std::atoi(env) > 0)
+            samples_ = std::atoi(env);
+        env = std::getenv("ONEMKL_AUTOTUNE");
+        if (env != nullptr && std::atoi(env) > 0)
+            start("");
+    }
+
+    // The SYCL runtime may be gone by the time static objects are destroyed, so
+    // the events of calibration calls still pending are leaked rather than
+    // queried or destroyed.
+    ~tuner() {
+        active = false;
+        std::lock_guard<std::mutex> lock(mutex_);
+        write();
+        static_cast<void>(new std::vector<calibration_call>(std::move(calls_)));
+    }
+
+    void start(const std::string &path) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        write();
+        path_ = path;
+        if (path_.empty()) {
+            const char *env = std::getenv("ONEMKL_AUTOTUNE_FILE");
+            path_ = env != nullptr ? env : "onemkl_autotune.txt";
+        }
+        read();
+        active = true;
+    }
+
+    // Calibration calls still running are dropped.
+    void stop() {
+        active = false;
+        std::lock_guard<std::mutex> lock(mutex_);
+        collect();
+        calls_.clear();
+        trials_.clear();
+        write();
+    }
+
+    void save() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        collect();
+        write();
+    }
+
+    int choose(stats::routine &routine, int bucket, const std::vector<const char *> &libraries,
+               bool timed, bool &measure) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        collect();
+        const std::string key = table_key(routine, bucket);
+        auto winner = winners_.find(key);
+        if (winner != winners_.end()) {
+            for (std::size_t i = 0; i < libraries.size(); i++) {
+                if (winner->second == libraries[i]) {
+                    routine.choice(bucket).store(static_cast<std::int8_t>(i),
+                                                 std::memory_order_relaxed);
+                    measure = false;
+                    return static_cast<int>(i);
+                }
+            }
+        }
+        measure = timed;
+        if (!timed) {
+            routine.choice(bucket).store(untimed_choice, std::memory_order_relaxed);
+            return 0;
+        }
+        trial &t = trials_[key];
+        t.resize(libraries.size());
+        const auto backend = std::min_element(t.issued.begin(), t.issued.end()) - t.issued.begin();
+        t.issued[backend]++;
+        return static_cast<int>(backend);
+    }
+
+    void pending(stats::routine &routine, int bucket, const std::vector<const char *> &libraries,
+                 int backend, const sycl::event &event) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        calls_.push_back({ &routine, bucket, &libraries, backend, event });
+    }
+
+private:
+    // Calibration calls of a size bucket, by backend: the calls made, and the
+    // calls timed so far with the best of their times.
+    struct trial {
+        std::vector<int> issued;
+        std::vector<int> runs;
+        std::vector<std::int64_t> best;
+
+        void resize(std::size_t backends) {
+            issued.resize(backends, 0);
+            runs.resize(backends, 0);
+            best.resize(backends, std::numeric_limits<std::int64_t>::max());
+        }
+    };
+
+    // A calibration call whose event has not been seen complete yet. The
+    // routine and the libraries of its backends live as long as the library.
+    struct calibration_call {
+        stats::routine *routine;
+        int bucket;
+        const std::vector<const char *> *libraries;
+        int backend;
+        sycl::event event;
+    };
+
+    // Reports the calibration calls that completed, without waiting for the
+    // others. Calls whose event has no profiling information, such as calls
+    // run inline or recorded into a graph, are dropped.
+    void collect() {
+        std::vector<calibration_call> running;
+        for (auto &call : calls_) {
+            std::int64_t start, end;
+            try {
+                if (call.event.get_info<sycl::info::event::command_execution_status>() !=
+                    sycl::info::event_command_status::complete) {
+                    running.push_back(std::move(call));
+                    continue;
+                }
+                start = call.event.get_profiling_info<sycl::info::event_profiling::command_start>();
+                end = call.event.get_profiling_info<sycl::info::event_profiling::command_end>();
+            }
+            catch (const sycl::exception &) {
+                continue;
+            }
+            report(*call.routine, call.bucket, *call.libraries, call.backend, end - start);
+        }
+        calls_ = std::move(running);
+    }
+
+    void report(stats::routine &routine, int bucket, const std::vector<const char *> &libraries,
+                int backend, std::int64_t elapsed) {
+        const std::string key = table_key(routine, bucket);
+        auto found = trials_.find(key);
+        if (found == trials_.end())
+            return;
+        trial &t = found->second;
+        t.resize(libraries.size());
+        t.runs[backend]++;
+        t.best[backend] = std::min(t.best[backend], elapsed);
+        if (*std::min_element(t.runs.begin(), t.runs.end()) < samples_)
+            return;
+
+        // The best time of each backend, rather than its mean, so that the first
+        // calls paying for the initialization of a backend do not decide.
+        const auto winner = std::min_element(t.best.begin(), t.best.end()) - t.best.begin();
+        winners_[key] = libraries[winner];
+        dirty_ = true;
+        routine.choice(bucket).store(static_cast<std::int8_t>(winner), std::memory_order_relaxed);
+        trials_.erase(found);
+    }
+
+    // Each line of the table holds a key and the library of its winner.
+    void read() {
+        std::ifstream file(path_);
+        std::string line;
+        while (std::getline(file, line)) {
+            const auto split = line.rfind(' ');
+            if (line.empty() || line[0] == '#' || split == std::string::npos)
+                continue;
+            winners_[line.substr(0, split)] = line.substr(split + 1);
+        }
+    }
+
+    void write() {
+        if (!dirty_ || path_.empty())
+            return;
+        std::ofstream file(path_);
+        file << "# domain layout routine size_bucket backend\n";
+        for (const auto &winner : winners_)
+            file << winner.first << ' ' << winner.second << '\n';
+        dirty_ = !file;
+    }
+
+    std::mutex mutex_;
+    std::string path_;
+    int samples_ = 3;
+    bool dirty_ = false;
+    std::map<std::string, std::string> winners_;
+    std::map<std::string, trial> trials_;
+    std::vector<calibration_call> calls_;
+};
+
+tuner &instance() {
+    static tuner state;
+    return state;
+}
+
+// Creates the tuner, and so reads ONEMKL_AUTOTUNE, when the library is loaded.
+const bool tuner_created = (instance(), true);
+
+} // namespace
+
+int choose(stats::routine &routine, int bucket, const std::vector<const char *> &libraries,
+           bool timed, bool &measure) {
+    return instance().choose(routine, bucket, libraries, timed, measure);
+}
+
+void pending(stats::routine &routine, int bucket, const std::vector<const char *> &libraries,
+             int backend, const sycl::event &event) {
+    instance().pending(routine, bucket, libraries, backend, event);
+}
+
+} // namespace autotune
+} // namespace detail
+
+namespace autotune {
+
+void enable(const std::string &path) {
+    detail::autotune::instance().start(path);
+}
+
+void disable() {
+    detail::autotune::instance().stop();
+}
+
+void save() {
+    detail::autotune::instance().save();
+}
+
+bool is_enabled() {
+    return detail::autotune::enabled();
+}
+
+} // namespace autotune
+} // namespace mkl
+} // namespace oneapi
@@ -418,7 +418,7 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
                            const float **b, int64_t *ldb, float *beta, float **c, int64_t *ldc,
                            int64_t group_count, int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -454,7 +454,7 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
                            const double **b, int64_t *ldb, double *beta, double **c, int64_t *ldc,
                            int64_t group_count, int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -493,7 +493,7 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
                            std::complex<float> **c, int64_t *ldc, int64_t group_count,
                            int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -532,7 +532,7 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
                            std::complex<double> **c, int64_t *ldc, int64_t group_count,
                            int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -569,7 +569,7 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
                            int64_t stride_a, const float *b, int64_t ldb, int64_t stride_b,
                            float beta, float *c, int64_t ldc, int64_t stride_c, int64_t batch_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -620,7 +620,7 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
                            double beta, double *c, int64_t ldc, int64_t stride_c,
                            int64_t batch_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -672,7 +672,7 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
                            std::complex<float> beta, std::complex<float> *c, int64_t ldc,
                            int64_t stride_c, int64_t batch_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -727,7 +727,7 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
                            std::complex<double> beta, std::complex<double> *c, int64_t ldc,
                            int64_t stride_c, int64_t batch_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -779,7 +779,7 @@ cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t *n, float *alpha, con
                            int64_t *incx, float **y, int64_t *incy, int64_t group_count,
                            int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -796,7 +796,7 @@ cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t *n, double *alpha, co
                            int64_t *incx, double **y, int64_t *incy, int64_t group_count,
                            int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -813,7 +813,7 @@ cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t *n, std::complex<floa
                            const std::complex<float> **x, int64_t *incx, std::complex<float> **y,
                            int64_t *incy, int64_t group_count, int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -831,7 +831,7 @@ cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t *n, std::complex<doub
                            const std::complex<double> **x, int64_t *incx, std::complex<double> **y,
                            int64_t *incy, int64_t group_count, int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -28,10 +28,16 @@
 
 #include "mkl_blas.h"
 #include "mkl_cblas.h"
+#include "mkl_service.h"
 
 #include "oneapi/mkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
 #include "oneapi/mkl/types.hpp"
 
+#include "execution_policy_helper.hpp"
+#include "graph_helper.hpp"
+#include "numa_helper.hpp"
+#include "threading_layer_helper.hpp"
+
 namespace oneapi {
 namespace mkl {
 namespace blas {
@@ -51,11 +57,23 @@ static inline void host_task_internal(H &cgh, F f, long) {
 #endif
 }
 
+// host_task runs f under the execution policy of the queue of the call, if it
+//  has one (see oneapi/mkl/execution_policy.hpp). The MKL threading layer is
+//  selected before the first task.
 template <typename K, typename H, typename F>
 static inline void host_task(H &cgh, F f) {
-    (void)host_task_internal<K>(cgh, f, 0);
+    oneapi::mkl::detail::threading::ensure_mkl_layers();
+    (void)host_task_internal<K>(
+        cgh, oneapi::mkl::detail::policy::bind(f, mkl_set_num_threads_local), 0);
 }
 
+// submit runs a command group on the queue, or hands its host task to the
+// graph recording the queue (see oneapi/mkl/graph.hpp).
+using oneapi::mkl::detail::graph::submit;
+
+// Splitting of calls on NUMA-placed arrays (see oneapi/mkl/numa.hpp).
+namespace numa = oneapi::mkl::detail::numa;
+
 // Conversion functions to traditional Fortran characters.
 inline const char *fortran_char(transpose t) {
     if (t == transpose::nontrans)
@@ -18,6 +18,8 @@
 *******************************************************************************/
 
 #include <CL/sycl.hpp>
+#include <numeric>
+#include <vector>
 
 #include "mklcpu_common.hpp"
 #include "oneapi/mkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
@@ -692,7 +692,7 @@ void swap(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doubl
 
 cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx, float *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -705,7 +705,7 @@ cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const float *x, int64_t
 
 cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const double *x, int64_t incx,
                      double *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -718,7 +718,7 @@ cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const double *x, int64_t
 
 cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                      float *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -731,7 +731,7 @@ cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const std::complex<float
 
 cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
                      double *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -745,13 +745,21 @@ cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const std::complex<doubl
 cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, float alpha, const float *x, int64_t incx,
                      float *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_saxpy_usm>(cgh,
-                                              [=]() { ::cblas_saxpy(n, alpha, x, incx, y, incy); });
+        host_task<class mkl_kernel_saxpy_usm>(cgh, [=]() {
+            if (incx != 1 || incy != 1) {
+                ::cblas_saxpy(n, alpha, x, incx, y, incy);
+                return;
+            }
+            numa::split(y, n, sizeof(float), mkl_set_num_threads_local,
+                        [&](int64_t begin, int64_t end) {
+                            ::cblas_saxpy(end - begin, alpha, x + begin, 1, y + begin, 1);
+                        });
+        });
     });
     return done;
 }
@@ -759,13 +767,21 @@ cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, float alpha, const float
 cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, double alpha, const double *x, int64_t incx,
                      double *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_daxpy_usm>(cgh,
-                                              [=]() { ::cblas_daxpy(n, alpha, x, incx, y, incy); });
+        host_task<class mkl_kernel_daxpy_usm>(cgh, [=]() {
+            if (incx != 1 || incy != 1) {
+                ::cblas_daxpy(n, alpha, x, incx, y, incy);
+                return;
+            }
+            numa::split(y, n, sizeof(double), mkl_set_num_threads_local,
+                        [&](int64_t begin, int64_t end) {
+                            ::cblas_daxpy(end - begin, alpha, x + begin, 1, y + begin, 1);
+                        });
+        });
     });
     return done;
 }
@@ -773,7 +789,7 @@ cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, double alpha, const doub
 cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
                      const std::complex<float> *x, int64_t incx, std::complex<float> *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -790,7 +806,7 @@ cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, std::complex<float> alph
 cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
                      const std::complex<double> *x, int64_t incx, std::complex<double> *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -806,24 +822,42 @@ cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, std::complex<double> alp
 
 cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx, float *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_scopy_usm>(cgh, [=]() { ::cblas_scopy(n, x, incx, y, incy); });
+        host_task<class mkl_kernel_scopy_usm>(cgh, [=]() {
+            if (incx != 1 || incy != 1) {
+                ::cblas_scopy(n, x, incx, y, incy);
+                return;
+            }
+            numa::split(y, n, sizeof(float), mkl_set_num_threads_local,
+                        [&](int64_t begin, int64_t end) {
+                            ::cblas_scopy(end - begin, x + begin, 1, y + begin, 1);
+                        });
+        });
     });
     return done;
 }
 
 cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const double *x, int64_t incx, double *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_dcopy_usm>(cgh, [=]() { ::cblas_dcopy(n, x, incx, y, incy); });
+        host_task<class mkl_kernel_dcopy_usm>(cgh, [=]() {
+            if (incx != 1 || incy != 1) {
+                ::cblas_dcopy(n, x, incx, y, incy);
+                return;
+            }
+            numa::split(y, n, sizeof(double), mkl_set_num_threads_local,
+                        [&](int64_t begin, int64_t end) {
+                            ::cblas_dcopy(end - begin, x + begin, 1, y + begin, 1);
+                        });
+        });
     });
     return done;
 }
@@ -831,7 +865,7 @@ cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const double *x, int64_t
 cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                      std::complex<float> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -844,7 +878,7 @@ cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const std::complex<float
 cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
                      std::complex<double> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -857,13 +891,23 @@ cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const std::complex<doubl
 cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx, const float *y,
                     int64_t incy, float *result,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_sdot_usm>(
-            cgh, [=]() { result[0] = ::cblas_sdot(n, x, incx, y, incy); });
+        host_task<class mkl_kernel_sdot_usm>(cgh, [=]() {
+            if (incx != 1 || incy != 1) {
+                result[0] = ::cblas_sdot(n, x, incx, y, incy);
+                return;
+            }
+            numa::plan parts(x, n, sizeof(float), true);
+            std::vector<float> partial(parts.size());
+            parts.run(mkl_set_num_threads_local, [&](std::size_t i, int64_t begin, int64_t end) {
+                partial[i] = ::cblas_sdot(end - begin, x + begin, 1, y + begin, 1);
+            });
+            result[0] = std::accumulate(partial.begin(), partial.end(), float(0));
+        });
     });
     return done;
 }
@@ -871,13 +915,23 @@ cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, const float *x, int64_t i
 cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, const double *x, int64_t incx,
                     const double *y, int64_t incy, double *result,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_ddot_usm>(
-            cgh, [=]() { result[0] = ::cblas_ddot(n, x, incx, y, incy); });
+        host_task<class mkl_kernel_ddot_usm>(cgh, [=]() {
+            if (incx != 1 || incy != 1) {
+                result[0] = ::cblas_ddot(n, x, incx, y, incy);
+                return;
+            }
+            numa::plan parts(x, n, sizeof(double), true);
+            std::vector<double> partial(parts.size());
+            parts.run(mkl_set_num_threads_local, [&](std::size_t i, int64_t begin, int64_t end) {
+                partial[i] = ::cblas_ddot(end - begin, x + begin, 1, y + begin, 1);
+            });
+            result[0] = std::accumulate(partial.begin(), partial.end(), double(0));
+        });
     });
     return done;
 }
@@ -885,7 +939,7 @@ cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, const double *x, int64_t
 cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx, const float *y,
                     int64_t incy, double *result,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -899,7 +953,7 @@ cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, const float *x, int64_t i
 cl::sycl::event dotc(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                      const std::complex<float> *y, int64_t incy, std::complex<float> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -913,7 +967,7 @@ cl::sycl::event dotc(cl::sycl::queue &queue, int64_t n, const std::complex<float
 cl::sycl::event dotc(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
                      const std::complex<double> *y, int64_t incy, std::complex<double> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -927,7 +981,7 @@ cl::sycl::event dotc(cl::sycl::queue &queue, int64_t n, const std::complex<doubl
 cl::sycl::event dotu(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                      const std::complex<float> *y, int64_t incy, std::complex<float> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -941,7 +995,7 @@ cl::sycl::event dotu(cl::sycl::queue &queue, int64_t n, const std::complex<float
 cl::sycl::event dotu(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
                      const std::complex<double> *y, int64_t incy, std::complex<double> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -955,7 +1009,7 @@ cl::sycl::event dotu(cl::sycl::queue &queue, int64_t n, const std::complex<doubl
 cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx,
                       int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -969,7 +1023,7 @@ cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const float *x, int64_t
 cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const double *x, int64_t incx,
                       int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -983,7 +1037,7 @@ cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const double *x, int64_
 cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                       int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -997,7 +1051,7 @@ cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const std::complex<floa
 cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x,
                       int64_t incx, int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1011,7 +1065,7 @@ cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const std::complex<doub
 cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx,
                       int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1025,7 +1079,7 @@ cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const float *x, int64_t
 cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const double *x, int64_t incx,
                       int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1039,7 +1093,7 @@ cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const double *x, int64_
 cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                       int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1053,7 +1107,7 @@ cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const std::complex<floa
 cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x,
                       int64_t incx, int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1066,7 +1120,7 @@ cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const std::complex<doub
 
 cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx, float *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1079,7 +1133,7 @@ cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const float *x, int64_t
 
 cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const double *x, int64_t incx,
                      double *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1092,7 +1146,7 @@ cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const double *x, int64_t
 
 cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                      float *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1105,7 +1159,7 @@ cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const std::complex<float
 
 cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
                      double *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1119,7 +1173,7 @@ cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const std::complex<doubl
 cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, float *x, int64_t incx, float *y,
                     int64_t incy, float c, float s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1133,7 +1187,7 @@ cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, float *x, int64_t incx, f
 cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, double *x, int64_t incx, double *y,
                     int64_t incy, double c, double s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1147,7 +1201,7 @@ cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, double *x, int64_t incx,
 cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, std::complex<float> *x, int64_t incx,
                     std::complex<float> *y, int64_t incy, float c, float s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1161,7 +1215,7 @@ cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, std::complex<float> *x, i
 cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, std::complex<double> *x, int64_t incx,
                     std::complex<double> *y, int64_t incy, double c, double s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1174,7 +1228,7 @@ cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, std::complex<double> *x,
 
 cl::sycl::event rotg(cl::sycl::queue &queue, float *a, float *b, float *c, float *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1186,7 +1240,7 @@ cl::sycl::event rotg(cl::sycl::queue &queue, float *a, float *b, float *c, float
 
 cl::sycl::event rotg(cl::sycl::queue &queue, double *a, double *b, double *c, double *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1199,7 +1253,7 @@ cl::sycl::event rotg(cl::sycl::queue &queue, double *a, double *b, double *c, do
 cl::sycl::event rotg(cl::sycl::queue &queue, std::complex<float> *a, std::complex<float> *b,
                      float *c, std::complex<float> *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1212,7 +1266,7 @@ cl::sycl::event rotg(cl::sycl::queue &queue, std::complex<float> *a, std::comple
 cl::sycl::event rotg(cl::sycl::queue &queue, std::complex<double> *a, std::complex<double> *b,
                      double *c, std::complex<double> *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1225,7 +1279,7 @@ cl::sycl::event rotg(cl::sycl::queue &queue, std::complex<double> *a, std::compl
 cl::sycl::event rotm(cl::sycl::queue &queue, int64_t n, float *x, int64_t incx, float *y,
                      int64_t incy, float *param,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1239,7 +1293,7 @@ cl::sycl::event rotm(cl::sycl::queue &queue, int64_t n, float *x, int64_t incx,
 cl::sycl::event rotm(cl::sycl::queue &queue, int64_t n, double *x, int64_t incx, double *y,
                      int64_t incy, double *param,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1252,7 +1306,7 @@ cl::sycl::event rotm(cl::sycl::queue &queue, int64_t n, double *x, int64_t incx,
 
 cl::sycl::event rotmg(cl::sycl::queue &queue, float *d1, float *d2, float *x1, float y1,
                       float *param, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1265,7 +1319,7 @@ cl::sycl::event rotmg(cl::sycl::queue &queue, float *d1, float *d2, float *x1, f
 
 cl::sycl::event rotmg(cl::sycl::queue &queue, double *d1, double *d2, double *x1, double y1,
                       double *param, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1278,13 +1332,21 @@ cl::sycl::event rotmg(cl::sycl::queue &queue, double *d1, double *d2, double *x1
 
 cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, float alpha, float *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class mkl_kernel_sscal_usm>(cgh, [=]() {
-            ::sscal((const MKL_INT *)&n, (const float *)&alpha, x, (const MKL_INT *)&incx);
+            if (incx != 1) {
+                ::sscal((const MKL_INT *)&n, (const float *)&alpha, x, (const MKL_INT *)&incx);
+                return;
+            }
+            numa::split(x, n, sizeof(float), mkl_set_num_threads_local,
+                        [&](int64_t begin, int64_t end) {
+                            const MKL_INT count = end - begin, one = 1;
+                            ::sscal(&count, (const float *)&alpha, x + begin, &one);
+                        });
         });
     });
     return done;
@@ -1292,13 +1354,21 @@ cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, float alpha, float *x, i
 
 cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, double alpha, double *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class mkl_kernel_dscal_usm>(cgh, [=]() {
-            ::dscal((const MKL_INT *)&n, (const double *)&alpha, x, (const MKL_INT *)&incx);
+            if (incx != 1) {
+                ::dscal((const MKL_INT *)&n, (const double *)&alpha, x, (const MKL_INT *)&incx);
+                return;
+            }
+            numa::split(x, n, sizeof(double), mkl_set_num_threads_local,
+                        [&](int64_t begin, int64_t end) {
+                            const MKL_INT count = end - begin, one = 1;
+                            ::dscal(&count, (const double *)&alpha, x + begin, &one);
+                        });
         });
     });
     return done;
@@ -1307,7 +1377,7 @@ cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, double alpha, double *x,
 cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
                      std::complex<float> *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1323,7 +1393,7 @@ cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, std::complex<float> alph
 
 cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, float alpha, std::complex<float> *x,
                      int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1338,7 +1408,7 @@ cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, float alpha, std::comple
 cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
                      std::complex<double> *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1354,7 +1424,7 @@ cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, std::complex<double> alp
 
 cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, double alpha, std::complex<double> *x,
                      int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1369,7 +1439,7 @@ cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, double alpha, std::compl
 cl::sycl::event sdsdot(cl::sycl::queue &queue, int64_t n, float sb, const float *x, int64_t incx,
                        const float *y, int64_t incy, float *result,
                        const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1382,7 +1452,7 @@ cl::sycl::event sdsdot(cl::sycl::queue &queue, int64_t n, float sb, const float
 
 cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, float *x, int64_t incx, float *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1394,7 +1464,7 @@ cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, float *x, int64_t incx,
 
 cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, double *x, int64_t incx, double *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1407,7 +1477,7 @@ cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, double *x, int64_t incx,
 cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, std::complex<float> *x, int64_t incx,
                      std::complex<float> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1420,7 +1490,7 @@ cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, std::complex<float> *x,
 cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, std::complex<double> *x, int64_t incx,
                      std::complex<double> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1104,7 +1104,7 @@ cl::sycl::event gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
                      int64_t ku, float alpha, const float *a, int64_t lda, const float *x,
                      int64_t incx, float beta, float *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1121,7 +1121,7 @@ cl::sycl::event gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
                      int64_t ku, double alpha, const double *a, int64_t lda, const double *x,
                      int64_t incx, double beta, double *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1139,7 +1139,7 @@ cl::sycl::event gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
                      int64_t lda, const std::complex<float> *x, int64_t incx,
                      std::complex<float> beta, std::complex<float> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1162,7 +1162,7 @@ cl::sycl::event gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
                      int64_t lda, const std::complex<double> *x, int64_t incx,
                      std::complex<double> beta, std::complex<double> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1184,7 +1184,7 @@ cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
                      const float *a, int64_t lda, const float *x, int64_t incx, float beta,
                      float *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1201,7 +1201,7 @@ cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
                      const double *a, int64_t lda, const double *x, int64_t incx, double beta,
                      double *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1219,7 +1219,7 @@ cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
                      const std::complex<float> *x, int64_t incx, std::complex<float> beta,
                      std::complex<float> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1242,7 +1242,7 @@ cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
                      const std::complex<double> *x, int64_t incx, std::complex<double> beta,
                      std::complex<double> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1263,7 +1263,7 @@ cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
 cl::sycl::event ger(cl::sycl::queue &queue, int64_t m, int64_t n, float alpha, const float *x,
                     int64_t incx, const float *y, int64_t incy, float *a, int64_t lda,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1277,7 +1277,7 @@ cl::sycl::event ger(cl::sycl::queue &queue, int64_t m, int64_t n, float alpha, c
 cl::sycl::event ger(cl::sycl::queue &queue, int64_t m, int64_t n, double alpha, const double *x,
                     int64_t incx, const double *y, int64_t incy, double *a, int64_t lda,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1292,7 +1292,7 @@ cl::sycl::event gerc(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<
                      const std::complex<float> *x, int64_t incx, const std::complex<float> *y,
                      int64_t incy, std::complex<float> *a, int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1310,7 +1310,7 @@ cl::sycl::event gerc(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<
                      const std::complex<double> *x, int64_t incx, const std::complex<double> *y,
                      int64_t incy, std::complex<double> *a, int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1328,7 +1328,7 @@ cl::sycl::event geru(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<
                      const std::complex<float> *x, int64_t incx, const std::complex<float> *y,
                      int64_t incy, std::complex<float> *a, int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1346,7 +1346,7 @@ cl::sycl::event geru(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<
                      const std::complex<double> *x, int64_t incx, const std::complex<double> *y,
                      int64_t incy, std::complex<double> *a, int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1365,7 +1365,7 @@ cl::sycl::event hbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_
                      const std::complex<float> *x, int64_t incx, std::complex<float> beta,
                      std::complex<float> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1388,7 +1388,7 @@ cl::sycl::event hbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_
                      const std::complex<double> *x, int64_t incx, std::complex<double> beta,
                      std::complex<double> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1410,7 +1410,7 @@ cl::sycl::event hemv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::c
                      const std::complex<float> *a, int64_t lda, const std::complex<float> *x,
                      int64_t incx, std::complex<float> beta, std::complex<float> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1433,7 +1433,7 @@ cl::sycl::event hemv(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
                      const std::complex<double> *x, int64_t incx, std::complex<double> beta,
                      std::complex<double> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1454,7 +1454,7 @@ cl::sycl::event hemv(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
 cl::sycl::event her(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
                     const std::complex<float> *x, int64_t incx, std::complex<float> *a, int64_t lda,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1469,7 +1469,7 @@ cl::sycl::event her(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float a
 cl::sycl::event her(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
                     const std::complex<double> *x, int64_t incx, std::complex<double> *a,
                     int64_t lda, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1485,7 +1485,7 @@ cl::sycl::event her2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::c
                      const std::complex<float> *x, int64_t incx, const std::complex<float> *y,
                      int64_t incy, std::complex<float> *a, int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1505,7 +1505,7 @@ cl::sycl::event her2(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
                      std::complex<double> alpha, const std::complex<double> *x, int64_t incx,
                      const std::complex<double> *y, int64_t incy, std::complex<double> *a,
                      int64_t lda, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1525,7 +1525,7 @@ cl::sycl::event hpmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::c
                      const std::complex<float> *ap, const std::complex<float> *x, int64_t incx,
                      std::complex<float> beta, std::complex<float> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1548,7 +1548,7 @@ cl::sycl::event hpmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
                      const std::complex<double> *x, int64_t incx, std::complex<double> beta,
                      std::complex<double> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1569,7 +1569,7 @@ cl::sycl::event hpmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
 cl::sycl::event hpr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
                     const std::complex<float> *x, int64_t incx, std::complex<float> *ap,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1584,7 +1584,7 @@ cl::sycl::event hpr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float a
 cl::sycl::event hpr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
                     const std::complex<double> *x, int64_t incx, std::complex<double> *ap,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1600,7 +1600,7 @@ cl::sycl::event hpr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::c
                      const std::complex<float> *x, int64_t incx, const std::complex<float> *y,
                      int64_t incy, std::complex<float> *ap,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1619,7 +1619,7 @@ cl::sycl::event hpr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
                      std::complex<double> alpha, const std::complex<double> *x, int64_t incx,
                      const std::complex<double> *y, int64_t incy, std::complex<double> *ap,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1638,7 +1638,7 @@ cl::sycl::event sbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_
                      const float *a, int64_t lda, const float *x, int64_t incx, float beta,
                      float *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1655,7 +1655,7 @@ cl::sycl::event sbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_
                      const double *a, int64_t lda, const double *x, int64_t incx, double beta,
                      double *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1671,7 +1671,7 @@ cl::sycl::event sbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_
 cl::sycl::event spmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
                      const float *ap, const float *x, int64_t incx, float beta, float *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1687,7 +1687,7 @@ cl::sycl::event spmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float
 cl::sycl::event spmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
                      const double *ap, const double *x, int64_t incx, double beta, double *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1703,7 +1703,7 @@ cl::sycl::event spmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
 cl::sycl::event spr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
                     const float *x, int64_t incx, float *ap,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1718,7 +1718,7 @@ cl::sycl::event spr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float a
 cl::sycl::event spr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
                     const double *x, int64_t incx, double *ap,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1733,7 +1733,7 @@ cl::sycl::event spr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
 cl::sycl::event spr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
                      const float *x, int64_t incx, const float *y, int64_t incy, float *ap,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1749,7 +1749,7 @@ cl::sycl::event spr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float
 cl::sycl::event spr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
                      const double *x, int64_t incx, const double *y, int64_t incy, double *ap,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1766,7 +1766,7 @@ cl::sycl::event symv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float
                      const float *a, int64_t lda, const float *x, int64_t incx, float beta,
                      float *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1783,7 +1783,7 @@ cl::sycl::event symv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
                      const double *a, int64_t lda, const double *x, int64_t incx, double beta,
                      double *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1799,7 +1799,7 @@ cl::sycl::event symv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
 cl::sycl::event syr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
                     const float *x, int64_t incx, float *a, int64_t lda,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1814,7 +1814,7 @@ cl::sycl::event syr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float a
 cl::sycl::event syr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
                     const double *x, int64_t incx, double *a, int64_t lda,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1829,7 +1829,7 @@ cl::sycl::event syr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
 cl::sycl::event syr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
                      const float *x, int64_t incx, const float *y, int64_t incy, float *a,
                      int64_t lda, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1845,7 +1845,7 @@ cl::sycl::event syr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float
 cl::sycl::event syr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
                      const double *x, int64_t incx, const double *y, int64_t incy, double *a,
                      int64_t lda, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1861,7 +1861,7 @@ cl::sycl::event syr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
 cl::sycl::event tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, int64_t k, const float *a, int64_t lda, float *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1879,7 +1879,7 @@ cl::sycl::event tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, int64_t k, const double *a, int64_t lda, double *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1898,7 +1898,7 @@ cl::sycl::event tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                      int64_t n, int64_t k, const std::complex<float> *a, int64_t lda,
                      std::complex<float> *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1917,7 +1917,7 @@ cl::sycl::event tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                      int64_t n, int64_t k, const std::complex<double> *a, int64_t lda,
                      std::complex<double> *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1935,7 +1935,7 @@ cl::sycl::event tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, int64_t k, const float *a, int64_t lda, float *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1953,7 +1953,7 @@ cl::sycl::event tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, int64_t k, const double *a, int64_t lda, double *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1972,7 +1972,7 @@ cl::sycl::event tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                      int64_t n, int64_t k, const std::complex<float> *a, int64_t lda,
                      std::complex<float> *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1991,7 +1991,7 @@ cl::sycl::event tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                      int64_t n, int64_t k, const std::complex<double> *a, int64_t lda,
                      std::complex<double> *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -2009,7 +2009,7 @@ cl::sycl::event tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const float *ap, float *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -2027,7 +2027,7 @@ cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const double *ap, double *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -2045,7 +2045,7 @@ cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const std::complex<float> *ap, std::complex<float> *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -2063,7 +2063,7 @@ cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const std::complex<double> *ap, std::complex<double> *x,
                      int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -2081,7 +2081,7 @@ cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const float *ap, float *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -2099,7 +2099,7 @@ cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const double *ap, double *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -2117,7 +2117,7 @@ cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const std::complex<float> *ap, std::complex<float> *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -2135,7 +2135,7 @@ cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const std::complex<double> *ap, std::complex<double> *x,
                      int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -2153,7 +2153,7 @@ cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_diag,
                      int64_t n, const float *a, int64_t lda, float *b, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -2171,7 +2171,7 @@ cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa,
 cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_diag,
                      int64_t n, const double *a, int64_t lda, double *b, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -2189,7 +2189,7 @@ cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa,
 cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_diag,
                      int64_t n, const std::complex<float> *a, int64_t lda, std::complex<float> *b,
                      int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -2207,7 +2207,7 @@ cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa,
 cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_diag,
                      int64_t n, const std::complex<double> *a, int64_t lda, std::complex<double> *b,
                      int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -2225,7 +2225,7 @@ cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa,
 cl::sycl::event trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const float *a, int64_t lda, float *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -2243,7 +2243,7 @@ cl::sycl::event trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const double *a, int64_t lda, double *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -2261,7 +2261,7 @@ cl::sycl::event trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const std::complex<float> *a, int64_t lda, std::complex<float> *x,
                      int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -2279,7 +2279,7 @@ cl::sycl::event trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_diag,
                      int64_t n, const std::complex<double> *a, int64_t lda, std::complex<double> *x,
                      int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -681,7 +681,7 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
                      int64_t n, int64_t k, float alpha, const float *a, int64_t lda, const float *b,
                      int64_t ldb, float beta, float *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -689,8 +689,14 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
         host_task<class mkl_kernel_sgemm_usm>(cgh, [=]() {
-            ::cblas_sgemm(CBLASMAJOR, transa_, transb_, m, n, k, alpha, a, lda, b, ldb, beta, c,
-                          ldc);
+            numa::split_gemm(
+                CBLASMAJOR == CblasColMajor, transa != transpose::nontrans,
+                transb != transpose::nontrans, m, n, a, lda, b, ldb, c, ldc,
+                mkl_set_num_threads_local,
+                [&](int64_t m_, int64_t n_, const float *a_, const float *b_, float *c_) {
+                    ::cblas_sgemm(CBLASMAJOR, transa_, transb_, m_, n_, k, alpha, a_, lda, b_,
+                                  ldb, beta, c_, ldc);
+                });
         });
     });
     return done;
@@ -700,7 +706,7 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
                      int64_t n, int64_t k, double alpha, const double *a, int64_t lda,
                      const double *b, int64_t ldb, double beta, double *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -708,8 +714,14 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
         host_task<class mkl_kernel_dgemm_usm>(cgh, [=]() {
-            ::cblas_dgemm(CBLASMAJOR, transa_, transb_, m, n, k, alpha, a, lda, b, ldb, beta, c,
-                          ldc);
+            numa::split_gemm(
+                CBLASMAJOR == CblasColMajor, transa != transpose::nontrans,
+                transb != transpose::nontrans, m, n, a, lda, b, ldb, c, ldc,
+                mkl_set_num_threads_local,
+                [&](int64_t m_, int64_t n_, const double *a_, const double *b_, double *c_) {
+                    ::cblas_dgemm(CBLASMAJOR, transa_, transb_, m_, n_, k, alpha, a_, lda, b_,
+                                  ldb, beta, c_, ldc);
+                });
         });
     });
     return done;
@@ -720,7 +732,7 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
                      int64_t lda, const std::complex<float> *b, int64_t ldb,
                      std::complex<float> beta, std::complex<float> *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -744,7 +756,7 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
                      const std::complex<double> *a, int64_t lda, const std::complex<double> *b,
                      int64_t ldb, std::complex<double> beta, std::complex<double> *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -768,7 +780,7 @@ cl::sycl::event hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      int64_t lda, const std::complex<float> *b, int64_t ldb,
                      std::complex<float> beta, std::complex<float> *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -792,7 +804,7 @@ cl::sycl::event hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      int64_t lda, const std::complex<double> *b, int64_t ldb,
                      std::complex<double> beta, std::complex<double> *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -815,7 +827,7 @@ cl::sycl::event herk(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                      int64_t k, float alpha, const std::complex<float> *a, int64_t lda, float beta,
                      std::complex<float> *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -833,7 +845,7 @@ cl::sycl::event herk(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                      int64_t k, double alpha, const std::complex<double> *a, int64_t lda,
                      double beta, std::complex<double> *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -852,7 +864,7 @@ cl::sycl::event her2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                       int64_t lda, const std::complex<float> *b, int64_t ldb, float beta,
                       std::complex<float> *c, int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -874,7 +886,7 @@ cl::sycl::event her2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                       int64_t lda, const std::complex<double> *b, int64_t ldb, double beta,
                       std::complex<double> *c, int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -895,7 +907,7 @@ cl::sycl::event symm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      int64_t n, float alpha, const float *a, int64_t lda, const float *b,
                      int64_t ldb, float beta, float *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -914,7 +926,7 @@ cl::sycl::event symm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      int64_t n, double alpha, const double *a, int64_t lda, const double *b,
                      int64_t ldb, double beta, double *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -934,7 +946,7 @@ cl::sycl::event symm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      int64_t lda, const std::complex<float> *b, int64_t ldb,
                      std::complex<float> beta, std::complex<float> *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -958,7 +970,7 @@ cl::sycl::event symm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      int64_t lda, const std::complex<double> *b, int64_t ldb,
                      std::complex<double> beta, std::complex<double> *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -980,7 +992,7 @@ cl::sycl::event symm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
 cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
                      int64_t k, float alpha, const float *a, int64_t lda, float beta, float *c,
                      int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -997,7 +1009,7 @@ cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
                      int64_t k, double alpha, const double *a, int64_t lda, double beta, double *c,
                      int64_t ldc, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1015,7 +1027,7 @@ cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                      int64_t k, std::complex<float> alpha, const std::complex<float> *a,
                      int64_t lda, std::complex<float> beta, std::complex<float> *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1038,7 +1050,7 @@ cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                      int64_t k, std::complex<double> alpha, const std::complex<double> *a,
                      int64_t lda, std::complex<double> beta, std::complex<double> *c, int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1061,7 +1073,7 @@ cl::sycl::event syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                       int64_t k, float alpha, const float *a, int64_t lda, const float *b,
                       int64_t ldb, float beta, float *c, int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1080,7 +1092,7 @@ cl::sycl::event syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                       int64_t k, double alpha, const double *a, int64_t lda, const double *b,
                       int64_t ldb, double beta, double *c, int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1100,7 +1112,7 @@ cl::sycl::event syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                       int64_t lda, const std::complex<float> *b, int64_t ldb,
                       std::complex<float> beta, std::complex<float> *c, int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1124,7 +1136,7 @@ cl::sycl::event syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                       int64_t lda, const std::complex<double> *b, int64_t ldb,
                       std::complex<double> beta, std::complex<double> *c, int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1147,7 +1159,7 @@ cl::sycl::event trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      diag unit_diag, int64_t m, int64_t n, float alpha, const float *a, int64_t lda,
                      float *b, int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1168,7 +1180,7 @@ cl::sycl::event trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      diag unit_diag, int64_t m, int64_t n, double alpha, const double *a,
                      int64_t lda, double *b, int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1189,7 +1201,7 @@ cl::sycl::event trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      diag unit_diag, int64_t m, int64_t n, std::complex<float> alpha,
                      const std::complex<float> *a, int64_t lda, std::complex<float> *b, int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1212,7 +1224,7 @@ cl::sycl::event trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      diag unit_diag, int64_t m, int64_t n, std::complex<double> alpha,
                      const std::complex<double> *a, int64_t lda, std::complex<double> *b,
                      int64_t ldb, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1235,7 +1247,7 @@ cl::sycl::event trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      diag unit_diag, int64_t m, int64_t n, float alpha, const float *a, int64_t lda,
                      float *b, int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1256,7 +1268,7 @@ cl::sycl::event trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      diag unit_diag, int64_t m, int64_t n, double alpha, const double *a,
                      int64_t lda, double *b, int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1277,7 +1289,7 @@ cl::sycl::event trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      diag unit_diag, int64_t m, int64_t n, std::complex<float> alpha,
                      const std::complex<float> *a, int64_t lda, std::complex<float> *b, int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1300,7 +1312,7 @@ cl::sycl::event trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      diag unit_diag, int64_t m, int64_t n, std::complex<double> alpha,
                      const std::complex<double> *a, int64_t lda, std::complex<double> *b,
                      int64_t ldb, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
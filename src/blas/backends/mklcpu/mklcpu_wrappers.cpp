@@ -22,6 +22,8 @@
 
 #define WRAPPER_VERSION 1
 
+// Row-major gemm_bias is not provided, so the loader takes it from the next
+// x86cpu backend that has it, or throws unimplemented.
 extern "C" ONEMKL_EXPORT blas_function_table_t mkl_blas_table = {
     WRAPPER_VERSION,
     oneapi::mkl::blas::mklcpu::column_major::asum,
@@ -519,7 +521,7 @@ extern "C" ONEMKL_EXPORT blas_function_table_t mkl_blas_table = {
     oneapi::mkl::blas::mklcpu::row_major::gemmt,
     oneapi::mkl::blas::mklcpu::row_major::gemmt,
     oneapi::mkl::blas::mklcpu::row_major::gemmt,
-    oneapi::mkl::blas::mklcpu::row_major::gemm_bias,
+    nullptr, // gemm_s8u8s32_bias
     oneapi::mkl::blas::mklcpu::row_major::asum,
     oneapi::mkl::blas::mklcpu::row_major::asum,
     oneapi::mkl::blas::mklcpu::row_major::asum,
@@ -28,6 +28,10 @@
 #include "oneapi/mkl/blas/detail/netlib/onemkl_blas_netlib.hpp"
 #include "oneapi/mkl/types.hpp"
 
+#include "execution_policy_helper.hpp"
+#include "graph_helper.hpp"
+#include "numa_helper.hpp"
+
 namespace oneapi {
 namespace mkl {
 namespace blas {
@@ -82,11 +86,20 @@ static inline void host_task_internal(H &cgh, F f, long) {
     cgh.template single_task<K>(f);
 }
 
+// host_task runs f under the execution policy of the queue of the call, if it
+//  has one (see oneapi/mkl/execution_policy.hpp).
 template <typename K, typename H, typename F>
 static inline void host_task(H &cgh, F f) {
-    (void)host_task_internal<K>(cgh, f, 0);
+    (void)host_task_internal<K>(cgh, oneapi::mkl::detail::policy::bind(f), 0);
 }
 
+// submit runs a command group on the queue, or hands its host task to the
+// graph recording the queue (see oneapi/mkl/graph.hpp).
+using oneapi::mkl::detail::graph::submit;
+
+// Splitting of calls on NUMA-placed arrays (see oneapi/mkl/numa.hpp).
+namespace numa = oneapi::mkl::detail::numa;
+
 } // namespace netlib
 } // namespace blas
 } // namespace mkl
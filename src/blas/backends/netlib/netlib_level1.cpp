@@ -18,6 +18,8 @@
 *******************************************************************************/
 
 #include <CL/sycl.hpp>
+#include <numeric>
+#include <vector>
 
 #include "netlib_common.hpp"
 #include "oneapi/mkl/blas/detail/netlib/onemkl_blas_netlib.hpp"
@@ -700,7 +700,7 @@ void swap(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doubl
 
 cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx, float *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -713,7 +713,7 @@ cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const float *x, int64_t
 
 cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const double *x, int64_t incx,
                      double *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -726,7 +726,7 @@ cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const double *x, int64_t
 
 cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                      float *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -739,7 +739,7 @@ cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const std::complex<float
 
 cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
                      double *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -753,13 +753,21 @@ cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const std::complex<doubl
 cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, float alpha, const float *x, int64_t incx,
                      float *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_saxpy_usm>(cgh, [=]() {
-            ::cblas_saxpy((const int)n, (const float)alpha, x, (const int)incx, y, (const int)incy);
+            if (incx != 1 || incy != 1) {
+                ::cblas_saxpy((const int)n, (const float)alpha, x, (const int)incx, y,
+                              (const int)incy);
+                return;
+            }
+            numa::split(y, n, sizeof(float), nullptr, [&](int64_t begin, int64_t end) {
+                ::cblas_saxpy((const int)(end - begin), (const float)alpha, x + begin, 1,
+                              y + begin, 1);
+            });
         });
     });
     return done;
@@ -768,14 +776,21 @@ cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, float alpha, const float
 cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, double alpha, const double *x, int64_t incx,
                      double *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_daxpy_usm>(cgh, [=]() {
-            ::cblas_daxpy((const int)n, (const double)alpha, x, (const int)incx, y,
-                          (const int)incy);
+            if (incx != 1 || incy != 1) {
+                ::cblas_daxpy((const int)n, (const double)alpha, x, (const int)incx, y,
+                              (const int)incy);
+                return;
+            }
+            numa::split(y, n, sizeof(double), nullptr, [&](int64_t begin, int64_t end) {
+                ::cblas_daxpy((const int)(end - begin), (const double)alpha, x + begin, 1,
+                              y + begin, 1);
+            });
         });
     });
     return done;
@@ -784,7 +799,7 @@ cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, double alpha, const doub
 cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
                      const std::complex<float> *x, int64_t incx, std::complex<float> *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -800,7 +815,7 @@ cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, std::complex<float> alph
 cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
                      const std::complex<double> *x, int64_t incx, std::complex<double> *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -815,26 +830,40 @@ cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, std::complex<double> alp
 
 cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx, float *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_scopy_usm>(
-            cgh, [=]() { ::cblas_scopy((const int)n, x, (const int)incx, y, (const int)incy); });
+        host_task<class netlib_scopy_usm>(cgh, [=]() {
+            if (incx != 1 || incy != 1) {
+                ::cblas_scopy((const int)n, x, (const int)incx, y, (const int)incy);
+                return;
+            }
+            numa::split(y, n, sizeof(float), nullptr, [&](int64_t begin, int64_t end) {
+                ::cblas_scopy((const int)(end - begin), x + begin, 1, y + begin, 1);
+            });
+        });
     });
     return done;
 }
 
 cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const double *x, int64_t incx, double *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dcopy_usm>(
-            cgh, [=]() { ::cblas_dcopy((const int)n, x, (const int)incx, y, (const int)incy); });
+        host_task<class netlib_dcopy_usm>(cgh, [=]() {
+            if (incx != 1 || incy != 1) {
+                ::cblas_dcopy((const int)n, x, (const int)incx, y, (const int)incy);
+                return;
+            }
+            numa::split(y, n, sizeof(double), nullptr, [&](int64_t begin, int64_t end) {
+                ::cblas_dcopy((const int)(end - begin), x + begin, 1, y + begin, 1);
+            });
+        });
     });
     return done;
 }
@@ -842,7 +871,7 @@ cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const double *x, int64_t
 cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                      std::complex<float> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -856,7 +885,7 @@ cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const std::complex<float
 cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
                      std::complex<double> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -870,13 +899,22 @@ cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const std::complex<doubl
 cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx, const float *y,
                     int64_t incy, float *result,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_sdot_usm>(cgh, [=]() {
-            result[0] = ::cblas_sdot((const int)n, x, (const int)incx, y, (const int)incy);
+            if (incx != 1 || incy != 1) {
+                result[0] = ::cblas_sdot((const int)n, x, (const int)incx, y, (const int)incy);
+                return;
+            }
+            numa::plan parts(x, n, sizeof(float), false);
+            std::vector<float> partial(parts.size());
+            parts.run(nullptr, [&](std::size_t i, int64_t begin, int64_t end) {
+                partial[i] = ::cblas_sdot((const int)(end - begin), x + begin, 1, y + begin, 1);
+            });
+            result[0] = std::accumulate(partial.begin(), partial.end(), float(0));
         });
     });
     return done;
@@ -885,13 +923,22 @@ cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, const float *x, int64_t i
 cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, const double *x, int64_t incx,
                     const double *y, int64_t incy, double *result,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_ddot_usm>(cgh, [=]() {
-            result[0] = ::cblas_ddot((const int)n, x, (const int)incx, y, (const int)incy);
+            if (incx != 1 || incy != 1) {
+                result[0] = ::cblas_ddot((const int)n, x, (const int)incx, y, (const int)incy);
+                return;
+            }
+            numa::plan parts(x, n, sizeof(double), false);
+            std::vector<double> partial(parts.size());
+            parts.run(nullptr, [&](std::size_t i, int64_t begin, int64_t end) {
+                partial[i] = ::cblas_ddot((const int)(end - begin), x + begin, 1, y + begin, 1);
+            });
+            result[0] = std::accumulate(partial.begin(), partial.end(), double(0));
         });
     });
     return done;
@@ -900,7 +947,7 @@ cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, const double *x, int64_t
 cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx, const float *y,
                     int64_t incy, double *result,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -915,7 +962,7 @@ cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, const float *x, int64_t i
 cl::sycl::event dotc(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                      const std::complex<float> *y, int64_t incy, std::complex<float> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -930,7 +977,7 @@ cl::sycl::event dotc(cl::sycl::queue &queue, int64_t n, const std::complex<float
 cl::sycl::event dotc(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
                      const std::complex<double> *y, int64_t incy, std::complex<double> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -945,7 +992,7 @@ cl::sycl::event dotc(cl::sycl::queue &queue, int64_t n, const std::complex<doubl
 cl::sycl::event dotu(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                      const std::complex<float> *y, int64_t incy, std::complex<float> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -960,7 +1007,7 @@ cl::sycl::event dotu(cl::sycl::queue &queue, int64_t n, const std::complex<float
 cl::sycl::event dotu(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
                      const std::complex<double> *y, int64_t incy, std::complex<double> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -975,7 +1022,7 @@ cl::sycl::event dotu(cl::sycl::queue &queue, int64_t n, const std::complex<doubl
 cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx,
                       int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -989,7 +1036,7 @@ cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const float *x, int64_t
 cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const double *x, int64_t incx,
                       int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1003,7 +1050,7 @@ cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const double *x, int64_
 cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                       int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1017,7 +1064,7 @@ cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const std::complex<floa
 cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x,
                       int64_t incx, int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1031,7 +1078,7 @@ cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const std::complex<doub
 cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx,
                       int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1045,7 +1092,7 @@ cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const float *x, int64_t
 cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const double *x, int64_t incx,
                       int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1059,7 +1106,7 @@ cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const double *x, int64_
 cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                       int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1073,7 +1120,7 @@ cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const std::complex<floa
 cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x,
                       int64_t incx, int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1086,7 +1133,7 @@ cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const std::complex<doub
 
 cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx, float *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1099,7 +1146,7 @@ cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const float *x, int64_t
 
 cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const double *x, int64_t incx,
                      double *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1112,7 +1159,7 @@ cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const double *x, int64_t
 
 cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                      float *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1125,7 +1172,7 @@ cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const std::complex<float
 
 cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
                      double *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1139,7 +1186,7 @@ cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const std::complex<doubl
 cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, float *x, int64_t incx, float *y,
                     int64_t incy, float c, float s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1155,7 +1202,7 @@ cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, float *x, int64_t incx, f
 cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, double *x, int64_t incx, double *y,
                     int64_t incy, double c, double s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1171,7 +1218,7 @@ cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, double *x, int64_t incx,
 cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, std::complex<float> *x, int64_t incx,
                     std::complex<float> *y, int64_t incy, float c, float s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1187,7 +1234,7 @@ cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, std::complex<float> *x, i
 cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, std::complex<double> *x, int64_t incx,
                     std::complex<double> *y, int64_t incy, double c, double s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1202,7 +1249,7 @@ cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, std::complex<double> *x,
 
 cl::sycl::event rotg(cl::sycl::queue &queue, float *a, float *b, float *c, float *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1214,7 +1261,7 @@ cl::sycl::event rotg(cl::sycl::queue &queue, float *a, float *b, float *c, float
 
 cl::sycl::event rotg(cl::sycl::queue &queue, double *a, double *b, double *c, double *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1227,7 +1274,7 @@ cl::sycl::event rotg(cl::sycl::queue &queue, double *a, double *b, double *c, do
 cl::sycl::event rotg(cl::sycl::queue &queue, std::complex<float> *a, std::complex<float> *b,
                      float *c, std::complex<float> *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1240,7 +1287,7 @@ cl::sycl::event rotg(cl::sycl::queue &queue, std::complex<float> *a, std::comple
 cl::sycl::event rotg(cl::sycl::queue &queue, std::complex<double> *a, std::complex<double> *b,
                      double *c, std::complex<double> *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1253,7 +1300,7 @@ cl::sycl::event rotg(cl::sycl::queue &queue, std::complex<double> *a, std::compl
 cl::sycl::event rotm(cl::sycl::queue &queue, int64_t n, float *x, int64_t incx, float *y,
                      int64_t incy, float *param,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1268,7 +1315,7 @@ cl::sycl::event rotm(cl::sycl::queue &queue, int64_t n, float *x, int64_t incx,
 cl::sycl::event rotm(cl::sycl::queue &queue, int64_t n, double *x, int64_t incx, double *y,
                      int64_t incy, double *param,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1282,7 +1329,7 @@ cl::sycl::event rotm(cl::sycl::queue &queue, int64_t n, double *x, int64_t incx,
 
 cl::sycl::event rotmg(cl::sycl::queue &queue, float *d1, float *d2, float *x1, float y1,
                       float *param, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1295,7 +1342,7 @@ cl::sycl::event rotmg(cl::sycl::queue &queue, float *d1, float *d2, float *x1, f
 
 cl::sycl::event rotmg(cl::sycl::queue &queue, double *d1, double *d2, double *x1, double y1,
                       double *param, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1308,13 +1355,19 @@ cl::sycl::event rotmg(cl::sycl::queue &queue, double *d1, double *d2, double *x1
 
 cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, float alpha, float *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_sscal_usm>(cgh, [=]() {
-            ::cblas_sscal((const int)n, (const float)alpha, x, (const int)std::abs(incx));
+            if (std::abs(incx) != 1) {
+                ::cblas_sscal((const int)n, (const float)alpha, x, (const int)std::abs(incx));
+                return;
+            }
+            numa::split(x, n, sizeof(float), nullptr, [&](int64_t begin, int64_t end) {
+                ::cblas_sscal((const int)(end - begin), (const float)alpha, x + begin, 1);
+            });
         });
     });
     return done;
@@ -1322,13 +1375,19 @@ cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, float alpha, float *x, i
 
 cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, double alpha, double *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dscal_usm>(cgh, [=]() {
-            ::cblas_dscal((const int)n, (const double)alpha, x, (const int)std::abs(incx));
+            if (std::abs(incx) != 1) {
+                ::cblas_dscal((const int)n, (const double)alpha, x, (const int)std::abs(incx));
+                return;
+            }
+            numa::split(x, n, sizeof(double), nullptr, [&](int64_t begin, int64_t end) {
+                ::cblas_dscal((const int)(end - begin), (const double)alpha, x + begin, 1);
+            });
         });
     });
     return done;
@@ -1337,7 +1396,7 @@ cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, double alpha, double *x,
 cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
                      std::complex<float> *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1351,7 +1410,7 @@ cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, std::complex<float> alph
 
 cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, float alpha, std::complex<float> *x,
                      int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1366,7 +1425,7 @@ cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, float alpha, std::comple
 cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
                      std::complex<double> *x, int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1380,7 +1439,7 @@ cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, std::complex<double> alp
 
 cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, double alpha, std::complex<double> *x,
                      int64_t incx, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1395,7 +1454,7 @@ cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, double alpha, std::compl
 cl::sycl::event sdsdot(cl::sycl::queue &queue, int64_t n, float sb, const float *x, int64_t incx,
                        const float *y, int64_t incy, float *result,
                        const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1410,7 +1469,7 @@ cl::sycl::event sdsdot(cl::sycl::queue &queue, int64_t n, float sb, const float
 
 cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, float *x, int64_t incx, float *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1423,7 +1482,7 @@ cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, float *x, int64_t incx,
 
 cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, double *x, int64_t incx, double *y,
                      int64_t incy, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1437,7 +1496,7 @@ cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, double *x, int64_t incx,
 cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, std::complex<float> *x, int64_t incx,
                      std::complex<float> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1451,7 +1510,7 @@ cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, std::complex<float> *x,
 cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, std::complex<double> *x, int64_t incx,
                      std::complex<double> *y, int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+    auto done = submit(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -22,6 +22,9 @@
 
 #define WRAPPER_VERSION 1
 
+// Routines Netlib does not provide (batches, gemmt and the mixed precision
+// gemm variants) are nullptr entries: the loader takes them from the next
+// x86cpu backend that has them, or throws unimplemented.
 extern "C" ONEMKL_EXPORT blas_function_table_t mkl_blas_table = {
     WRAPPER_VERSION,
     oneapi::mkl::blas::netlib::column_major::asum,
@@ -148,8 +151,8 @@ extern "C" ONEMKL_EXPORT blas_function_table_t mkl_blas_table = {
     oneapi::mkl::blas::netlib::column_major::gemm,
     oneapi::mkl::blas::netlib::column_major::gemm,
     oneapi::mkl::blas::netlib::column_major::gemm,
-    oneapi::mkl::blas::netlib::column_major::gemm,
-    oneapi::mkl::blas::netlib::column_major::gemm,
+    nullptr, // hgemm
+    nullptr, // gemm_f16f16f32
     oneapi::mkl::blas::netlib::column_major::hemm,
     oneapi::mkl::blas::netlib::column_major::hemm,
     oneapi::mkl::blas::netlib::column_major::herk,
@@ -176,19 +179,19 @@ extern "C" ONEMKL_EXPORT blas_function_table_t mkl_blas_table = {
     oneapi::mkl::blas::netlib::column_major::trsm,
     oneapi::mkl::blas::netlib::column_major::trsm,
     oneapi::mkl::blas::netlib::column_major::trsm,
-    oneapi::mkl::blas::netlib::column_major::gemm_batch,
-    oneapi::mkl::blas::netlib::column_major::gemm_batch,
-    oneapi::mkl::blas::netlib::column_major::gemm_batch,
-    oneapi::mkl::blas::netlib::column_major::gemm_batch,
-    oneapi::mkl::blas::netlib::column_major::trsm_batch,
-    oneapi::mkl::blas::netlib::column_major::trsm_batch,
-    oneapi::mkl::blas::netlib::column_major::trsm_batch,
-    oneapi::mkl::blas::netlib::column_major::trsm_batch,
-    oneapi::mkl::blas::netlib::column_major::gemmt,
-    oneapi::mkl::blas::netlib::column_major::gemmt,
-    oneapi::mkl::blas::netlib::column_major::gemmt,
-    oneapi::mkl::blas::netlib::column_major::gemmt,
-    oneapi::mkl::blas::netlib::column_major::gemm_bias,
+    nullptr, // sgemm_batch_strided
+    nullptr, // dgemm_batch_strided
+    nullptr, // cgemm_batch_strided
+    nullptr, // zgemm_batch_strided
+    nullptr, // strsm_batch_strided
+    nullptr, // dtrsm_batch_strided
+    nullptr, // ctrsm_batch_strided
+    nullptr, // ztrsm_batch_strided
+    nullptr, // sgemmt
+    nullptr, // dgemmt
+    nullptr, // cgemmt
+    nullptr, // zgemmt
+    nullptr, // gemm_s8u8s32_bias
     oneapi::mkl::blas::netlib::column_major::asum,
     oneapi::mkl::blas::netlib::column_major::asum,
     oneapi::mkl::blas::netlib::column_major::asum,
@@ -197,10 +200,10 @@ extern "C" ONEMKL_EXPORT blas_function_table_t mkl_blas_table = {
     oneapi::mkl::blas::netlib::column_major::axpy,
     oneapi::mkl::blas::netlib::column_major::axpy,
     oneapi::mkl::blas::netlib::column_major::axpy,
-    oneapi::mkl::blas::netlib::column_major::axpy_batch,
-    oneapi::mkl::blas::netlib::column_major::axpy_batch,
-    oneapi::mkl::blas::netlib::column_major::axpy_batch,
-    oneapi::mkl::blas::netlib::column_major::axpy_batch,
+    nullptr, // saxpy_batch_group_usm
+    nullptr, // daxpy_batch_group_usm
+    nullptr, // caxpy_batch_group_usm
+    nullptr, // zaxpy_batch_group_usm
     oneapi::mkl::blas::netlib::column_major::copy,
     oneapi::mkl::blas::netlib::column_major::copy,
     oneapi::mkl::blas::netlib::column_major::copy,
@@ -343,18 +346,18 @@ extern "C" ONEMKL_EXPORT blas_function_table_t mkl_blas_table = {
     oneapi::mkl::blas::netlib::column_major::trsm,
     oneapi::mkl::blas::netlib::column_major::trsm,
     oneapi::mkl::blas::netlib::column_major::trsm,
-    oneapi::mkl::blas::netlib::column_major::gemm_batch,
-    oneapi::mkl::blas::netlib::column_major::gemm_batch,
-    oneapi::mkl::blas::netlib::column_major::gemm_batch,
-    oneapi::mkl::blas::netlib::column_major::gemm_batch,
-    oneapi::mkl::blas::netlib::column_major::gemm_batch,
-    oneapi::mkl::blas::netlib::column_major::gemm_batch,
-    oneapi::mkl::blas::netlib::column_major::gemm_batch,
-    oneapi::mkl::blas::netlib::column_major::gemm_batch,
-    oneapi::mkl::blas::netlib::column_major::gemmt,
-    oneapi::mkl::blas::netlib::column_major::gemmt,
-    oneapi::mkl::blas::netlib::column_major::gemmt,
-    oneapi::mkl::blas::netlib::column_major::gemmt,
+    nullptr, // sgemm_batch_group_usm
+    nullptr, // dgemm_batch_group_usm
+    nullptr, // cgemm_batch_group_usm
+    nullptr, // zgemm_batch_group_usm
+    nullptr, // sgemm_batch_strided_usm
+    nullptr, // dgemm_batch_strided_usm
+    nullptr, // cgemm_batch_strided_usm
+    nullptr, // zgemm_batch_strided_usm
+    nullptr, // sgemmt_usm
+    nullptr, // dgemmt_usm
+    nullptr, // cgemmt_usm
+    nullptr, // zgemmt_usm
     oneapi::mkl::blas::netlib::row_major::asum,
     oneapi::mkl::blas::netlib::row_major::asum,
     oneapi::mkl::blas::netlib::row_major::asum,
@@ -479,8 +482,8 @@ extern "C" ONEMKL_EXPORT blas_function_table_t mkl_blas_table = {
     oneapi::mkl::blas::netlib::row_major::gemm,
     oneapi::mkl::blas::netlib::row_major::gemm,
     oneapi::mkl::blas::netlib::row_major::gemm,
-    oneapi::mkl::blas::netlib::row_major::gemm,
-    oneapi::mkl::blas::netlib::row_major::gemm,
+    nullptr, // hgemm
+    nullptr, // gemm_f16f16f32
     oneapi::mkl::blas::netlib::row_major::hemm,
     oneapi::mkl::blas::netlib::row_major::hemm,
     oneapi::mkl::blas::netlib::row_major::herk,
@@ -507,19 +510,19 @@ extern "C" ONEMKL_EXPORT blas_function_table_t mkl_blas_table = {
     oneapi::mkl::blas::netlib::row_major::trsm,
     oneapi::mkl::blas::netlib::row_major::trsm,
     oneapi::mkl::blas::netlib::row_major::trsm,
-    oneapi::mkl::blas::netlib::row_major::gemm_batch,
-    oneapi::mkl::blas::netlib::row_major::gemm_batch,
-    oneapi::mkl::blas::netlib::row_major::gemm_batch,
-    oneapi::mkl::blas::netlib::row_major::gemm_batch,
-    oneapi::mkl::blas::netlib::row_major::trsm_batch,
-    oneapi::mkl::blas::netlib::row_major::trsm_batch,
-    oneapi::mkl::blas::netlib::row_major::trsm_batch,
-    oneapi::mkl::blas::netlib::row_major::trsm_batch,
-    oneapi::mkl::blas::netlib::row_major::gemmt,
-    oneapi::mkl::blas::netlib::row_major::gemmt,
-    oneapi::mkl::blas::netlib::row_major::gemmt,
-    oneapi::mkl::blas::netlib::row_major::gemmt,
-    oneapi::mkl::blas::netlib::row_major::gemm_bias,
+    nullptr, // sgemm_batch_strided
+    nullptr, // dgemm_batch_strided
+    nullptr, // cgemm_batch_strided
+    nullptr, // zgemm_batch_strided
+    nullptr, // strsm_batch_strided
+    nullptr, // dtrsm_batch_strided
+    nullptr, // ctrsm_batch_strided
+    nullptr, // ztrsm_batch_strided
+    nullptr, // sgemmt
+    nullptr, // dgemmt
+    nullptr, // cgemmt
+    nullptr, // zgemmt
+    nullptr, // gemm_s8u8s32_bias
     oneapi::mkl::blas::netlib::row_major::asum,
     oneapi::mkl::blas::netlib::row_major::asum,
     oneapi::mkl::blas::netlib::row_major::asum,
@@ -528,10 +531,10 @@ extern "C" ONEMKL_EXPORT blas_function_table_t mkl_blas_table = {
     oneapi::mkl::blas::netlib::row_major::axpy,
     oneapi::mkl::blas::netlib::row_major::axpy,
     oneapi::mkl::blas::netlib::row_major::axpy,
-    oneapi::mkl::blas::netlib::row_major::axpy_batch,
-    oneapi::mkl::blas::netlib::row_major::axpy_batch,
-    oneapi::mkl::blas::netlib::row_major::axpy_batch,
-    oneapi::mkl::blas::netlib::row_major::axpy_batch,
+    nullptr, // saxpy_batch_group_usm
+    nullptr, // daxpy_batch_group_usm
+    nullptr, // caxpy_batch_group_usm
+    nullptr, // zaxpy_batch_group_usm
     oneapi::mkl::blas::netlib::row_major::copy,
     oneapi::mkl::blas::netlib::row_major::copy,
     oneapi::mkl::blas::netlib::row_major::copy,
@@ -674,16 +677,16 @@ extern "C" ONEMKL_EXPORT blas_function_table_t mkl_blas_table = {
     oneapi::mkl::blas::netlib::row_major::trsm,
     oneapi::mkl::blas::netlib::row_major::trsm,
     oneapi::mkl::blas::netlib::row_major::trsm,
-    oneapi::mkl::blas::netlib::row_major::gemm_batch,
-    oneapi::mkl::blas::netlib::row_major::gemm_batch,
-    oneapi::mkl::blas::netlib::row_major::gemm_batch,
-    oneapi::mkl::blas::netlib::row_major::gemm_batch,
-    oneapi::mkl::blas::netlib::row_major::gemm_batch,
-    oneapi::mkl::blas::netlib::row_major::gemm_batch,
-    oneapi::mkl::blas::netlib::row_major::gemm_batch,
-    oneapi::mkl::blas::netlib::row_major::gemm_batch,
-    oneapi::mkl::blas::netlib::row_major::gemmt,
-    oneapi::mkl::blas::netlib::row_major::gemmt,
-    oneapi::mkl::blas::netlib::row_major::gemmt,
-    oneapi::mkl::blas::netlib::row_major::gemmt,
+    nullptr, // sgemm_batch_group_usm
+    nullptr, // dgemm_batch_group_usm
+    nullptr, // cgemm_batch_group_usm
+    nullptr, // zgemm_batch_group_usm
+    nullptr, // sgemm_batch_strided_usm
+    nullptr, // dgemm_batch_strided_usm
+    nullptr, // cgemm_batch_strided_usm
+    nullptr, // zgemm_batch_strided_usm
+    nullptr, // sgemmt_usm
+    nullptr, // dgemmt_usm
+    nullptr, // cgemmt_usm
+    nullptr, // zgemmt_usm
 };
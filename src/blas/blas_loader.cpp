@@ -30,343 +30,621 @@ namespace detail {
 
 static oneapi::mkl::detail::table_initializer<domain::blas, blas_function_table_t> function_tables;
 
+namespace verbose = oneapi::mkl::detail::verbose;
+namespace stats = oneapi::mkl::detail::stats;
+static constexpr verbose::site trace_site{ domain::blas, "column_major" };
+
 // Buffer APIs
 
 void asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<float, 1> &result) {
-    function_tables[libkey].column_major_scasum_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "scasum", "n incx",
+                                   { stats::work::asum, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_scasum_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<double, 1> &result) {
-    function_tables[libkey].column_major_dzasum_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "dzasum", "n incx",
+                                   { stats::work::asum, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dzasum_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &result) {
-    function_tables[libkey].column_major_sasum_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "sasum", "n incx",
+                                   { stats::work::asum, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_sasum_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &result) {
-    function_tables[libkey].column_major_dasum_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "dasum", "n incx",
+                                   { stats::work::asum, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dasum_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, float alpha,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].column_major_saxpy_sycl(queue, n, alpha, x, incx, y, incy);
+    static stats::routine routine{ trace_site, "saxpy", "n incx incy",
+                                   { stats::work::axpy, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_saxpy_sycl)(queue, n, alpha, x, incx, y, incy);
+    });
 }
 
 void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, double alpha,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].column_major_daxpy_sycl(queue, n, alpha, x, incx, y, incy);
+    static stats::routine routine{ trace_site, "daxpy", "n incx incy",
+                                   { stats::work::axpy, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_daxpy_sycl)(queue, n, alpha, x, incx, y, incy);
+    });
 }
 
 void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_caxpy_sycl(queue, n, alpha, x, incx, y, incy);
+    static stats::routine routine{ trace_site, "caxpy", "n incx incy",
+                                   { stats::work::axpy, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_caxpy_sycl)(queue, n, alpha, x, incx, y, incy);
+    });
 }
 
 void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
           std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_zaxpy_sycl(queue, n, alpha, x, incx, y, incy);
+    static stats::routine routine{ trace_site, "zaxpy", "n incx incy",
+                                   { stats::work::axpy, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zaxpy_sycl)(queue, n, alpha, x, incx, y, incy);
+    });
 }
 
 void copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].column_major_scopy_sycl(queue, n, x, incx, y, incy);
+    static stats::routine routine{ trace_site, "scopy", "n incx incy",
+                                   { stats::work::copy, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_scopy_sycl)(queue, n, x, incx, y, incy);
+    });
 }
 
 void copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].column_major_dcopy_sycl(queue, n, x, incx, y, incy);
+    static stats::routine routine{ trace_site, "dcopy", "n incx incy",
+                                   { stats::work::copy, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dcopy_sycl)(queue, n, x, incx, y, incy);
+    });
 }
 
 void copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_ccopy_sycl(queue, n, x, incx, y, incy);
+    static stats::routine routine{ trace_site, "ccopy", "n incx incy",
+                                   { stats::work::copy, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_ccopy_sycl)(queue, n, x, incx, y, incy);
+    });
 }
 
 void copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_zcopy_sycl(queue, n, x, incx, y, incy);
+    static stats::routine routine{ trace_site, "zcopy", "n incx incy",
+                                   { stats::work::copy, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zcopy_sycl)(queue, n, x, incx, y, incy);
+    });
 }
 
 void dot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
          cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
          std::int64_t incy, cl::sycl::buffer<float, 1> &result) {
-    function_tables[libkey].column_major_sdot_sycl(queue, n, x, incx, y, incy, result);
+    static stats::routine routine{ trace_site, "sdot", "n incx incy",
+                                   { stats::work::dot, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_sdot_sycl)(queue, n, x, incx, y, incy, result);
+    });
 }
 
 void dot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
          cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
          std::int64_t incy, cl::sycl::buffer<double, 1> &result) {
-    function_tables[libkey].column_major_ddot_sycl(queue, n, x, incx, y, incy, result);
+    static stats::routine routine{ trace_site, "ddot", "n incx incy",
+                                   { stats::work::dot, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_ddot_sycl)(queue, n, x, incx, y, incy, result);
+    });
 }
 
 void dot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
          cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
          std::int64_t incy, cl::sycl::buffer<double, 1> &result) {
-    function_tables[libkey].column_major_dsdot_sycl(queue, n, x, incx, y, incy, result);
+    static stats::routine routine{ trace_site, "dsdot", "n incx incy",
+                                   { stats::work::dot, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dsdot_sycl)(queue, n, x, incx, y, incy, result);
+    });
 }
 
 void dotc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<float>, 1> &result) {
-    function_tables[libkey].column_major_cdotc_sycl(queue, n, x, incx, y, incy, result);
+    static stats::routine routine{ trace_site, "cdotc", "n incx incy",
+                                   { stats::work::dot, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_cdotc_sycl)(queue, n, x, incx, y, incy, result);
+    });
 }
 
 void dotc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<double>, 1> &result) {
-    function_tables[libkey].column_major_zdotc_sycl(queue, n, x, incx, y, incy, result);
+    static stats::routine routine{ trace_site, "zdotc", "n incx incy",
+                                   { stats::work::dot, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zdotc_sycl)(queue, n, x, incx, y, incy, result);
+    });
 }
 
 void dotu(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<float>, 1> &result) {
-    function_tables[libkey].column_major_cdotu_sycl(queue, n, x, incx, y, incy, result);
+    static stats::routine routine{ trace_site, "cdotu", "n incx incy",
+                                   { stats::work::dot, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_cdotu_sycl)(queue, n, x, incx, y, incy, result);
+    });
 }
 
 void dotu(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<double>, 1> &result) {
-    function_tables[libkey].column_major_zdotu_sycl(queue, n, x, incx, y, incy, result);
+    static stats::routine routine{ trace_site, "zdotu", "n incx incy",
+                                   { stats::work::dot, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zdotu_sycl)(queue, n, x, incx, y, incy, result);
+    });
 }
 
 void iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
            cl::sycl::buffer<float, 1> &x, std::int64_t incx,
            cl::sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].column_major_isamin_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "isamin", "n incx",
+                                   { stats::work::iamax, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_isamin_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
            cl::sycl::buffer<double, 1> &x, std::int64_t incx,
            cl::sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].column_major_idamin_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "idamin", "n incx",
+                                   { stats::work::iamax, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_idamin_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
            cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
            cl::sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].column_major_icamin_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "icamin", "n incx",
+                                   { stats::work::iamax, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_icamin_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
            cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
            cl::sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].column_major_izamin_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "izamin", "n incx",
+                                   { stats::work::iamax, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_izamin_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
            cl::sycl::buffer<float, 1> &x, std::int64_t incx,
            cl::sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].column_major_isamax_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "isamax", "n incx",
+                                   { stats::work::iamax, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_isamax_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
            cl::sycl::buffer<double, 1> &x, std::int64_t incx,
            cl::sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].column_major_idamax_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "idamax", "n incx",
+                                   { stats::work::iamax, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_idamax_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
            cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
            cl::sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].column_major_icamax_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "icamax", "n incx",
+                                   { stats::work::iamax, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_icamax_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
            cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
            cl::sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].column_major_izamax_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "izamax", "n incx",
+                                   { stats::work::iamax, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_izamax_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<float, 1> &result) {
-    function_tables[libkey].column_major_scnrm2_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "scnrm2", "n incx",
+                                   { stats::work::nrm2, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_scnrm2_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<double, 1> &result) {
-    function_tables[libkey].column_major_dznrm2_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "dznrm2", "n incx",
+                                   { stats::work::nrm2, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dznrm2_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &result) {
-    function_tables[libkey].column_major_snrm2_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "snrm2", "n incx",
+                                   { stats::work::nrm2, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_snrm2_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &result) {
-    function_tables[libkey].column_major_dnrm2_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "dnrm2", "n incx",
+                                   { stats::work::nrm2, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dnrm2_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
          cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy, float c, float s) {
-    function_tables[libkey].column_major_srot_sycl(queue, n, x, incx, y, incy, c, s);
+    static stats::routine routine{ trace_site, "srot", "n incx incy",
+                                   { stats::work::rot, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_srot_sycl)(queue, n, x, incx, y, incy, c, s);
+    });
 }
 
 void rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
          cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy, double c, double s) {
-    function_tables[libkey].column_major_drot_sycl(queue, n, x, incx, y, incy, c, s);
+    static stats::routine routine{ trace_site, "drot", "n incx incy",
+                                   { stats::work::rot, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_drot_sycl)(queue, n, x, incx, y, incy, c, s);
+    });
 }
 
 void rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
          cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
          std::int64_t incy, float c, float s) {
-    function_tables[libkey].column_major_csrot_sycl(queue, n, x, incx, y, incy, c, s);
+    static stats::routine routine{ trace_site, "csrot", "n incx incy",
+                                   { stats::work::rot, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_csrot_sycl)(queue, n, x, incx, y, incy, c, s);
+    });
 }
 
 void rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
          cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
          std::int64_t incy, double c, double s) {
-    function_tables[libkey].column_major_zdrot_sycl(queue, n, x, incx, y, incy, c, s);
+    static stats::routine routine{ trace_site, "zdrot", "n incx incy",
+                                   { stats::work::rot, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zdrot_sycl)(queue, n, x, incx, y, incy, c, s);
+    });
 }
 
 void rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue, cl::sycl::buffer<float, 1> &a,
           cl::sycl::buffer<float, 1> &b, cl::sycl::buffer<float, 1> &c,
           cl::sycl::buffer<float, 1> &s) {
-    function_tables[libkey].column_major_srotg_sycl(queue, a, b, c, s);
+    static stats::routine routine{ trace_site, "srotg", "" };
+    auto shape = verbose::make_dims();
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_srotg_sycl)(queue, a, b, c, s);
+    });
 }
 
 void rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue, cl::sycl::buffer<double, 1> &a,
           cl::sycl::buffer<double, 1> &b, cl::sycl::buffer<double, 1> &c,
           cl::sycl::buffer<double, 1> &s) {
-    function_tables[libkey].column_major_drotg_sycl(queue, a, b, c, s);
+    static stats::routine routine{ trace_site, "drotg", "" };
+    auto shape = verbose::make_dims();
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_drotg_sycl)(queue, a, b, c, s);
+    });
 }
 
 void rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue,
           cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::complex<float>, 1> &b,
           cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<std::complex<float>, 1> &s) {
-    function_tables[libkey].column_major_crotg_sycl(queue, a, b, c, s);
+    static stats::routine routine{ trace_site, "crotg", "" };
+    auto shape = verbose::make_dims();
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_crotg_sycl)(queue, a, b, c, s);
+    });
 }
 
 void rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue,
           cl::sycl::buffer<std::complex<double>, 1> &a,
           cl::sycl::buffer<std::complex<double>, 1> &b, cl::sycl::buffer<double, 1> &c,
           cl::sycl::buffer<std::complex<double>, 1> &s) {
-    function_tables[libkey].column_major_zrotg_sycl(queue, a, b, c, s);
+    static stats::routine routine{ trace_site, "zrotg", "" };
+    auto shape = verbose::make_dims();
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zrotg_sycl)(queue, a, b, c, s);
+    });
 }
 
 void rotm(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
           std::int64_t incy, cl::sycl::buffer<float, 1> &param) {
-    function_tables[libkey].column_major_srotm_sycl(queue, n, x, incx, y, incy, param);
+    static stats::routine routine{ trace_site, "srotm", "n incx incy",
+                                   { stats::work::rot, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_srotm_sycl)(queue, n, x, incx, y, incy, param);
+    });
 }
 
 void rotm(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
           std::int64_t incy, cl::sycl::buffer<double, 1> &param) {
-    function_tables[libkey].column_major_drotm_sycl(queue, n, x, incx, y, incy, param);
+    static stats::routine routine{ trace_site, "drotm", "n incx incy",
+                                   { stats::work::rot, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_drotm_sycl)(queue, n, x, incx, y, incy, param);
+    });
 }
 
 void rotmg(oneapi::mkl::device libkey, cl::sycl::queue &queue, cl::sycl::buffer<float, 1> &d1,
            cl::sycl::buffer<float, 1> &d2, cl::sycl::buffer<float, 1> &x1, float y1,
            cl::sycl::buffer<float, 1> &param) {
-    function_tables[libkey].column_major_srotmg_sycl(queue, d1, d2, x1, y1, param);
+    static stats::routine routine{ trace_site, "srotmg", "" };
+    auto shape = verbose::make_dims();
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_srotmg_sycl)(queue, d1, d2, x1, y1, param);
+    });
 }
 
 void rotmg(oneapi::mkl::device libkey, cl::sycl::queue &queue, cl::sycl::buffer<double, 1> &d1,
            cl::sycl::buffer<double, 1> &d2, cl::sycl::buffer<double, 1> &x1, double y1,
            cl::sycl::buffer<double, 1> &param) {
-    function_tables[libkey].column_major_drotmg_sycl(queue, d1, d2, x1, y1, param);
+    static stats::routine routine{ trace_site, "drotmg", "" };
+    auto shape = verbose::make_dims();
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_drotmg_sycl)(queue, d1, d2, x1, y1, param);
+    });
 }
 
 void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, float alpha,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_sscal_sycl(queue, n, alpha, x, incx);
+    static stats::routine routine{ trace_site, "sscal", "n incx",
+                                   { stats::work::scal, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_sscal_sycl)(queue, n, alpha, x, incx);
+    });
 }
 
 void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, double alpha,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_dscal_sycl(queue, n, alpha, x, incx);
+    static stats::routine routine{ trace_site, "dscal", "n incx",
+                                   { stats::work::scal, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dscal_sycl)(queue, n, alpha, x, incx);
+    });
 }
 
 void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
           std::int64_t incx) {
-    function_tables[libkey].column_major_cscal_sycl(queue, n, alpha, x, incx);
+    static stats::routine routine{ trace_site, "cscal", "n incx",
+                                   { stats::work::scal, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_cscal_sycl)(queue, n, alpha, x, incx);
+    });
 }
 
 void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
           std::int64_t incx) {
-    function_tables[libkey].column_major_csscal_sycl(queue, n, alpha, x, incx);
+    static stats::routine routine{ trace_site, "csscal", "n incx",
+                                   { stats::work::scal, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_csscal_sycl)(queue, n, alpha, x, incx);
+    });
 }
 
 void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, float alpha,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_zscal_sycl(queue, n, alpha, x, incx);
+    static stats::routine routine{ trace_site, "zscal", "n incx",
+                                   { stats::work::scal, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zscal_sycl)(queue, n, alpha, x, incx);
+    });
 }
 
 void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, double alpha,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_zdscal_sycl(queue, n, alpha, x, incx);
+    static stats::routine routine{ trace_site, "zdscal", "n incx",
+                                   { stats::work::scal, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zdscal_sycl)(queue, n, alpha, x, incx);
+    });
 }
 
 void sdsdot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, float sb,
             cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
             std::int64_t incy, cl::sycl::buffer<float, 1> &result) {
-    function_tables[libkey].column_major_sdsdot_sycl(queue, n, sb, x, incx, y, incy, result);
+    static stats::routine routine{ trace_site, "sdsdot", "n incx incy",
+                                   { stats::work::dot, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_sdsdot_sycl)(queue, n, sb, x, incx, y, incy, result);
+    });
 }
 
 void swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].column_major_sswap_sycl(queue, n, x, incx, y, incy);
+    static stats::routine routine{ trace_site, "sswap", "n incx incy",
+                                   { stats::work::swap, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_sswap_sycl)(queue, n, x, incx, y, incy);
+    });
 }
 
 void swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].column_major_dswap_sycl(queue, n, x, incx, y, incy);
+    static stats::routine routine{ trace_site, "dswap", "n incx incy",
+                                   { stats::work::swap, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dswap_sycl)(queue, n, x, incx, y, incy);
+    });
 }
 
 void swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_cswap_sycl(queue, n, x, incx, y, incy);
+    static stats::routine routine{ trace_site, "cswap", "n incx incy",
+                                   { stats::work::swap, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_cswap_sycl)(queue, n, x, incx, y, incy);
+    });
 }
 
 void swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_zswap_sycl(queue, n, x, incx, y, incy);
+    static stats::routine routine{ trace_site, "zswap", "n incx incy",
+                                   { stats::work::swap, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zswap_sycl)(queue, n, x, incx, y, incy);
+    });
 }
 
 void gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
           std::int64_t n, std::int64_t kl, std::int64_t ku, float alpha,
           cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &x,
           std::int64_t incx, float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_sgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a, lda, x,
-                                                    incx, beta, y, incy);
+    static stats::routine routine{ trace_site, "sgbmv", "trans m n kl ku lda incx incy",
+                                   { stats::work::gbmv, stats::f32 } };
+    auto shape = verbose::make_dims(trans, m, n, kl, ku, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_sgbmv_sycl)(queue, trans, m, n, kl, ku, alpha, a, lda, x,
+                                                       incx, beta, y, incy);
+    });
 }
 
 void gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
           std::int64_t n, std::int64_t kl, std::int64_t ku, double alpha,
           cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &x,
           std::int64_t incx, double beta, cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_dgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a, lda, x,
-                                                    incx, beta, y, incy);
+    static stats::routine routine{ trace_site, "dgbmv", "trans m n kl ku lda incx incy",
+                                   { stats::work::gbmv, stats::f64 } };
+    auto shape = verbose::make_dims(trans, m, n, kl, ku, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dgbmv_sycl)(queue, trans, m, n, kl, ku, alpha, a, lda, x,
+                                                       incx, beta, y, incy);
+    });
 }
 
 void gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
@@ -374,8 +652,13 @@ void gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, s
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_cgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a, lda, x,
-                                                    incx, beta, y, incy);
+    static stats::routine routine{ trace_site, "cgbmv", "trans m n kl ku lda incx incy",
+                                   { stats::work::gbmv, stats::c32 } };
+    auto shape = verbose::make_dims(trans, m, n, kl, ku, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_cgbmv_sycl)(queue, trans, m, n, kl, ku, alpha, a, lda, x,
+                                                       incx, beta, y, incy);
+    });
 }
 
 void gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
@@ -384,24 +667,39 @@ void gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, s
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].column_major_zgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a, lda, x,
-                                                    incx, beta, y, incy);
+    static stats::routine routine{ trace_site, "zgbmv", "trans m n kl ku lda incx incy",
+                                   { stats::work::gbmv, stats::c64 } };
+    auto shape = verbose::make_dims(trans, m, n, kl, ku, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zgbmv_sycl)(queue, trans, m, n, kl, ku, alpha, a, lda, x,
+                                                       incx, beta, y, incy);
+    });
 }
 
 void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
           std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
           cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_sgemv_sycl(queue, trans, m, n, alpha, a, lda, x, incx,
-                                                    beta, y, incy);
+    static stats::routine routine{ trace_site, "sgemv", "trans m n lda incx incy",
+                                   { stats::work::gemv, stats::f32 } };
+    auto shape = verbose::make_dims(trans, m, n, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_sgemv_sycl)(queue, trans, m, n, alpha, a, lda, x, incx,
+                                                       beta, y, incy);
+    });
 }
 
 void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
           std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
           cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_dgemv_sycl(queue, trans, m, n, alpha, a, lda, x, incx,
-                                                    beta, y, incy);
+    static stats::routine routine{ trace_site, "dgemv", "trans m n lda incx incy",
+                                   { stats::work::gemv, stats::f64 } };
+    auto shape = verbose::make_dims(trans, m, n, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dgemv_sycl)(queue, trans, m, n, alpha, a, lda, x, incx,
+                                                       beta, y, incy);
+    });
 }
 
 void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
@@ -409,8 +707,13 @@ void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, s
           std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].column_major_cgemv_sycl(queue, trans, m, n, alpha, a, lda, x, incx,
-                                                    beta, y, incy);
+    static stats::routine routine{ trace_site, "cgemv", "trans m n lda incx incy",
+                                   { stats::work::gemv, stats::c32 } };
+    auto shape = verbose::make_dims(trans, m, n, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_cgemv_sycl)(queue, trans, m, n, alpha, a, lda, x, incx,
+                                                       beta, y, incy);
+    });
 }
 
 void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
@@ -418,50 +721,89 @@ void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, s
           std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].column_major_zgemv_sycl(queue, trans, m, n, alpha, a, lda, x, incx,
-                                                    beta, y, incy);
+    static stats::routine routine{ trace_site, "zgemv", "trans m n lda incx incy",
+                                   { stats::work::gemv, stats::c64 } };
+    auto shape = verbose::make_dims(trans, m, n, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zgemv_sycl)(queue, trans, m, n, alpha, a, lda, x, incx,
+                                                       beta, y, incy);
+    });
 }
 
 void ger(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
          float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
          cl::sycl::buffer<float, 1> &y, std::int64_t incy, cl::sycl::buffer<float, 1> &a,
          std::int64_t lda) {
-    function_tables[libkey].column_major_sger_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    static stats::routine routine{ trace_site, "sger", "m n incx incy lda",
+                                   { stats::work::ger, stats::f32 } };
+    auto shape = verbose::make_dims(m, n, incx, incy, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_sger_sycl)(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    });
 }
 
 void ger(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
          double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
          cl::sycl::buffer<double, 1> &y, std::int64_t incy, cl::sycl::buffer<double, 1> &a,
          std::int64_t lda) {
-    function_tables[libkey].column_major_dger_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    static stats::routine routine{ trace_site, "dger", "m n incx incy lda",
+                                   { stats::work::ger, stats::f64 } };
+    auto shape = verbose::make_dims(m, n, incx, incy, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dger_sycl)(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    });
 }
 
 void gerc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].column_major_cgerc_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    static stats::routine routine{ trace_site, "cgerc", "m n incx incy lda",
+                                   { stats::work::ger, stats::c32 } };
+    auto shape = verbose::make_dims(m, n, incx, incy, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_cgerc_sycl)(queue, m, n, alpha, x, incx, y, incy, a,
+                                                       lda);
+    });
 }
 
 void gerc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
           std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].column_major_zgerc_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    static stats::routine routine{ trace_site, "zgerc", "m n incx incy lda",
+                                   { stats::work::ger, stats::c64 } };
+    auto shape = verbose::make_dims(m, n, incx, incy, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zgerc_sycl)(queue, m, n, alpha, x, incx, y, incy, a,
+                                                       lda);
+    });
 }
 
 void geru(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].column_major_cgeru_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    static stats::routine routine{ trace_site, "cgeru", "m n incx incy lda",
+                                   { stats::work::ger, stats::c32 } };
+    auto shape = verbose::make_dims(m, n, incx, incy, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_cgeru_sycl)(queue, m, n, alpha, x, incx, y, incy, a,
+                                                       lda);
+    });
 }
 
 void geru(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
           std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].column_major_zgeru_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    static stats::routine routine{ trace_site, "zgeru", "m n incx incy lda",
+                                   { stats::work::ger, stats::c64 } };
+    auto shape = verbose::make_dims(m, n, incx, incy, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zgeru_sycl)(queue, m, n, alpha, x, incx, y, incy, a,
+                                                       lda);
+    });
 }
 
 void hbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
@@ -469,8 +811,13 @@ void hbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].column_major_chbmv_sycl(queue, upper_lower, n, k, alpha, a, lda, x,
-                                                    incx, beta, y, incy);
+    static stats::routine routine{ trace_site, "chbmv", "upper_lower n k lda incx incy",
+                                   { stats::work::sbmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, k, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_chbmv_sycl)(queue, upper_lower, n, k, alpha, a, lda, x,
+                                                       incx, beta, y, incy);
+    });
 }
 
 void hbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
@@ -478,16 +825,26 @@ void hbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].column_major_zhbmv_sycl(queue, upper_lower, n, k, alpha, a, lda, x,
-                                                    incx, beta, y, incy);
+    static stats::routine routine{ trace_site, "zhbmv", "upper_lower n k lda incx incy",
+                                   { stats::work::sbmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, k, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zhbmv_sycl)(queue, upper_lower, n, k, alpha, a, lda, x,
+                                                       incx, beta, y, incy);
+    });
 }
 
 void hemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_chemv_sycl(queue, upper_lower, n, alpha, a, lda, x, incx,
-                                                    beta, y, incy);
+    static stats::routine routine{ trace_site, "chemv", "upper_lower n lda incx incy",
+                                   { stats::work::symv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_chemv_sycl)(queue, upper_lower, n, alpha, a, lda, x,
+                                                       incx, beta, y, incy);
+    });
 }
 
 void hemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
@@ -495,44 +852,76 @@ void hemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].column_major_zhemv_sycl(queue, upper_lower, n, alpha, a, lda, x, incx,
-                                                    beta, y, incy);
+    static stats::routine routine{ trace_site, "zhemv", "upper_lower n lda incx incy",
+                                   { stats::work::symv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zhemv_sycl)(queue, upper_lower, n, alpha, a, lda, x,
+                                                       incx, beta, y, incy);
+    });
 }
 
 void her(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
          float alpha, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
          cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].column_major_cher_sycl(queue, upper_lower, n, alpha, x, incx, a, lda);
+    static stats::routine routine{ trace_site, "cher", "upper_lower n incx lda",
+                                   { stats::work::syr, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_cher_sycl)(queue, upper_lower, n, alpha, x, incx, a,
+                                                      lda);
+    });
 }
 
 void her(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
          double alpha, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
          cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].column_major_zher_sycl(queue, upper_lower, n, alpha, x, incx, a, lda);
+    static stats::routine routine{ trace_site, "zher", "upper_lower n incx lda",
+                                   { stats::work::syr, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zher_sycl)(queue, upper_lower, n, alpha, x, incx, a,
+                                                      lda);
+    });
 }
 
 void her2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].column_major_cher2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy,
-                                                    a, lda);
+    static stats::routine routine{ trace_site, "cher2", "upper_lower n incx incy lda",
+                                   { stats::work::syr2, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_cher2_sycl)(queue, upper_lower, n, alpha, x, incx, y,
+                                                       incy, a, lda);
+    });
 }
 
 void her2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
           std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].column_major_zher2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy,
-                                                    a, lda);
+    static stats::routine routine{ trace_site, "zher2", "upper_lower n incx incy lda",
+                                   { stats::work::syr2, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zher2_sycl)(queue, upper_lower, n, alpha, x, incx, y,
+                                                       incy, a, lda);
+    });
 }
 
 void hpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_chpmv_sycl(queue, upper_lower, n, alpha, a, x, incx, beta,
-                                                    y, incy);
+    static stats::routine routine{ trace_site, "chpmv", "upper_lower n incx incy",
+                                   { stats::work::symv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_chpmv_sycl)(queue, upper_lower, n, alpha, a, x, incx,
+                                                       beta, y, incy);
+    });
 }
 
 void hpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
@@ -540,324 +929,551 @@ void hpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].column_major_zhpmv_sycl(queue, upper_lower, n, alpha, a, x, incx, beta,
-                                                    y, incy);
+    static stats::routine routine{ trace_site, "zhpmv", "upper_lower n incx incy",
+                                   { stats::work::symv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zhpmv_sycl)(queue, upper_lower, n, alpha, a, x, incx,
+                                                       beta, y, incy);
+    });
 }
 
 void hpr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
          float alpha, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
          cl::sycl::buffer<std::complex<float>, 1> &a) {
-    function_tables[libkey].column_major_chpr_sycl(queue, upper_lower, n, alpha, x, incx, a);
+    static stats::routine routine{ trace_site, "chpr", "upper_lower n incx",
+                                   { stats::work::syr, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_chpr_sycl)(queue, upper_lower, n, alpha, x, incx, a);
+    });
 }
 
 void hpr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
          double alpha, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
          cl::sycl::buffer<std::complex<double>, 1> &a) {
-    function_tables[libkey].column_major_zhpr_sycl(queue, upper_lower, n, alpha, x, incx, a);
+    static stats::routine routine{ trace_site, "zhpr", "upper_lower n incx",
+                                   { stats::work::syr, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zhpr_sycl)(queue, upper_lower, n, alpha, x, incx, a);
+    });
 }
 
 void hpr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<float>, 1> &a) {
-    function_tables[libkey].column_major_chpr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy,
-                                                    a);
+    static stats::routine routine{ trace_site, "chpr2", "upper_lower n incx incy",
+                                   { stats::work::syr2, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_chpr2_sycl)(queue, upper_lower, n, alpha, x, incx, y,
+                                                       incy, a);
+    });
 }
 
 void hpr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
           std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<double>, 1> &a) {
-    function_tables[libkey].column_major_zhpr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy,
-                                                    a);
+    static stats::routine routine{ trace_site, "zhpr2", "upper_lower n incx incy",
+                                   { stats::work::syr2, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zhpr2_sycl)(queue, upper_lower, n, alpha, x, incx, y,
+                                                       incy, a);
+    });
 }
 
 void sbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
           cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_ssbmv_sycl(queue, upper_lower, n, k, alpha, a, lda, x,
-                                                    incx, beta, y, incy);
+    static stats::routine routine{ trace_site, "ssbmv", "upper_lower n k lda incx incy",
+                                   { stats::work::sbmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, k, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_ssbmv_sycl)(queue, upper_lower, n, k, alpha, a, lda, x,
+                                                       incx, beta, y, incy);
+    });
 }
 
 void sbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::int64_t k, double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
           cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_dsbmv_sycl(queue, upper_lower, n, k, alpha, a, lda, x,
-                                                    incx, beta, y, incy);
+    static stats::routine routine{ trace_site, "dsbmv", "upper_lower n k lda incx incy",
+                                   { stats::work::sbmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, k, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dsbmv_sycl)(queue, upper_lower, n, k, alpha, a, lda, x,
+                                                       incx, beta, y, incy);
+    });
 }
 
 void spmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           float alpha, cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<float, 1> &x,
           std::int64_t incx, float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_sspmv_sycl(queue, upper_lower, n, alpha, a, x, incx, beta,
-                                                    y, incy);
+    static stats::routine routine{ trace_site, "sspmv", "upper_lower n incx incy",
+                                   { stats::work::symv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_sspmv_sycl)(queue, upper_lower, n, alpha, a, x, incx,
+                                                       beta, y, incy);
+    });
 }
 
 void spmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           double alpha, cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<double, 1> &x,
           std::int64_t incx, double beta, cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_dspmv_sycl(queue, upper_lower, n, alpha, a, x, incx, beta,
-                                                    y, incy);
+    static stats::routine routine{ trace_site, "dspmv", "upper_lower n incx incy",
+                                   { stats::work::symv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dspmv_sycl)(queue, upper_lower, n, alpha, a, x, incx,
+                                                       beta, y, incy);
+    });
 }
 
 void spr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
          float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
          cl::sycl::buffer<float, 1> &a) {
-    function_tables[libkey].column_major_sspr_sycl(queue, upper_lower, n, alpha, x, incx, a);
+    static stats::routine routine{ trace_site, "sspr", "upper_lower n incx",
+                                   { stats::work::syr, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_sspr_sycl)(queue, upper_lower, n, alpha, x, incx, a);
+    });
 }
 
 void spr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
          double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
          cl::sycl::buffer<double, 1> &a) {
-    function_tables[libkey].column_major_dspr_sycl(queue, upper_lower, n, alpha, x, incx, a);
+    static stats::routine routine{ trace_site, "dspr", "upper_lower n incx",
+                                   { stats::work::syr, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dspr_sycl)(queue, upper_lower, n, alpha, x, incx, a);
+    });
 }
 
 void spr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
           cl::sycl::buffer<float, 1> &y, std::int64_t incy, cl::sycl::buffer<float, 1> &a) {
-    function_tables[libkey].column_major_sspr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy,
-                                                    a);
+    static stats::routine routine{ trace_site, "sspr2", "upper_lower n incx incy",
+                                   { stats::work::syr2, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_sspr2_sycl)(queue, upper_lower, n, alpha, x, incx, y,
+                                                       incy, a);
+    });
 }
 
 void spr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
           cl::sycl::buffer<double, 1> &y, std::int64_t incy, cl::sycl::buffer<double, 1> &a) {
-    function_tables[libkey].column_major_dspr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy,
-                                                    a);
+    static stats::routine routine{ trace_site, "dspr2", "upper_lower n incx incy",
+                                   { stats::work::syr2, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dspr2_sycl)(queue, upper_lower, n, alpha, x, incx, y,
+                                                       incy, a);
+    });
 }
 
 void symv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
           cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_ssymv_sycl(queue, upper_lower, n, alpha, a, lda, x, incx,
-                                                    beta, y, incy);
+    static stats::routine routine{ trace_site, "ssymv", "upper_lower n lda incx incy",
+                                   { stats::work::symv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_ssymv_sycl)(queue, upper_lower, n, alpha, a, lda, x,
+                                                       incx, beta, y, incy);
+    });
 }
 
 void symv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
           cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_dsymv_sycl(queue, upper_lower, n, alpha, a, lda, x, incx,
-                                                    beta, y, incy);
+    static stats::routine routine{ trace_site, "dsymv", "upper_lower n lda incx incy",
+                                   { stats::work::symv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dsymv_sycl)(queue, upper_lower, n, alpha, a, lda, x,
+                                                       incx, beta, y, incy);
+    });
 }
 
 void syr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
          float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
          cl::sycl::buffer<float, 1> &a, std::int64_t lda) {
-    function_tables[libkey].column_major_ssyr_sycl(queue, upper_lower, n, alpha, x, incx, a, lda);
+    static stats::routine routine{ trace_site, "ssyr", "upper_lower n incx lda",
+                                   { stats::work::syr, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_ssyr_sycl)(queue, upper_lower, n, alpha, x, incx, a,
+                                                      lda);
+    });
 }
 
 void syr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
          double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
          cl::sycl::buffer<double, 1> &a, std::int64_t lda) {
-    function_tables[libkey].column_major_dsyr_sycl(queue, upper_lower, n, alpha, x, incx, a, lda);
+    static stats::routine routine{ trace_site, "dsyr", "upper_lower n incx lda",
+                                   { stats::work::syr, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dsyr_sycl)(queue, upper_lower, n, alpha, x, incx, a,
+                                                      lda);
+    });
 }
 
 void syr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
           cl::sycl::buffer<float, 1> &y, std::int64_t incy, cl::sycl::buffer<float, 1> &a,
           std::int64_t lda) {
-    function_tables[libkey].column_major_ssyr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy,
-                                                    a, lda);
+    static stats::routine routine{ trace_site, "ssyr2", "upper_lower n incx incy lda",
+                                   { stats::work::syr2, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_ssyr2_sycl)(queue, upper_lower, n, alpha, x, incx, y,
+                                                       incy, a, lda);
+    });
 }
 
 void syr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
           cl::sycl::buffer<double, 1> &y, std::int64_t incy, cl::sycl::buffer<double, 1> &a,
           std::int64_t lda) {
-    function_tables[libkey].column_major_dsyr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy,
-                                                    a, lda);
+    static stats::routine routine{ trace_site, "dsyr2", "upper_lower n incx incy lda",
+                                   { stats::work::syr2, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dsyr2_sycl)(queue, upper_lower, n, alpha, x, incx, y,
+                                                       incy, a, lda);
+    });
 }
 
 void tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, cl::sycl::buffer<float, 1> &a,
           std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_stbmv_sycl(queue, upper_lower, trans, unit_diag, n, k, a,
-                                                    lda, x, incx);
+    static stats::routine routine{ trace_site, "stbmv", "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_stbmv_sycl)(queue, upper_lower, trans, unit_diag, n, k,
+                                                       a, lda, x, incx);
+    });
 }
 
 void tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, cl::sycl::buffer<double, 1> &a,
           std::int64_t lda, cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_dtbmv_sycl(queue, upper_lower, trans, unit_diag, n, k, a,
-                                                    lda, x, incx);
+    static stats::routine routine{ trace_site, "dtbmv", "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dtbmv_sycl)(queue, upper_lower, trans, unit_diag, n, k,
+                                                       a, lda, x, incx);
+    });
 }
 
 void tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k,
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_ctbmv_sycl(queue, upper_lower, trans, unit_diag, n, k, a,
-                                                    lda, x, incx);
+    static stats::routine routine{ trace_site, "ctbmv", "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_ctbmv_sycl)(queue, upper_lower, trans, unit_diag, n, k,
+                                                       a, lda, x, incx);
+    });
 }
 
 void tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k,
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_ztbmv_sycl(queue, upper_lower, trans, unit_diag, n, k, a,
-                                                    lda, x, incx);
+    static stats::routine routine{ trace_site, "ztbmv", "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_ztbmv_sycl)(queue, upper_lower, trans, unit_diag, n, k,
+                                                       a, lda, x, incx);
+    });
 }
 
 void tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, cl::sycl::buffer<float, 1> &a,
           std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_stbsv_sycl(queue, upper_lower, trans, unit_diag, n, k, a,
-                                                    lda, x, incx);
+    static stats::routine routine{ trace_site, "stbsv", "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_stbsv_sycl)(queue, upper_lower, trans, unit_diag, n, k,
+                                                       a, lda, x, incx);
+    });
 }
 
 void tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, cl::sycl::buffer<double, 1> &a,
           std::int64_t lda, cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_dtbsv_sycl(queue, upper_lower, trans, unit_diag, n, k, a,
-                                                    lda, x, incx);
+    static stats::routine routine{ trace_site, "dtbsv", "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dtbsv_sycl)(queue, upper_lower, trans, unit_diag, n, k,
+                                                       a, lda, x, incx);
+    });
 }
 
 void tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k,
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_ctbsv_sycl(queue, upper_lower, trans, unit_diag, n, k, a,
-                                                    lda, x, incx);
+    static stats::routine routine{ trace_site, "ctbsv", "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_ctbsv_sycl)(queue, upper_lower, trans, unit_diag, n, k,
+                                                       a, lda, x, incx);
+    });
 }
 
 void tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k,
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_ztbsv_sycl(queue, upper_lower, trans, unit_diag, n, k, a,
-                                                    lda, x, incx);
+    static stats::routine routine{ trace_site, "ztbsv", "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_ztbsv_sycl)(queue, upper_lower, trans, unit_diag, n, k,
+                                                       a, lda, x, incx);
+    });
 }
 
 void tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<float, 1> &a,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_stpmv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                    incx);
+    static stats::routine routine{ trace_site, "stpmv", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_stpmv_sycl)(queue, upper_lower, trans, unit_diag, n, a,
+                                                       x, incx);
+    });
 }
 
 void tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<double, 1> &a,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_dtpmv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                    incx);
+    static stats::routine routine{ trace_site, "dtpmv", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dtpmv_sycl)(queue, upper_lower, trans, unit_diag, n, a,
+                                                       x, incx);
+    });
 }
 
 void tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_ctpmv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                    incx);
+    static stats::routine routine{ trace_site, "ctpmv", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_ctpmv_sycl)(queue, upper_lower, trans, unit_diag, n, a,
+                                                       x, incx);
+    });
 }
 
 void tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &a,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_ztpmv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                    incx);
+    static stats::routine routine{ trace_site, "ztpmv", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_ztpmv_sycl)(queue, upper_lower, trans, unit_diag, n, a,
+                                                       x, incx);
+    });
 }
 
 void tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<float, 1> &a,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_stpsv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                    incx);
+    static stats::routine routine{ trace_site, "stpsv", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_stpsv_sycl)(queue, upper_lower, trans, unit_diag, n, a,
+                                                       x, incx);
+    });
 }
 
 void tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<double, 1> &a,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_dtpsv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                    incx);
+    static stats::routine routine{ trace_site, "dtpsv", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dtpsv_sycl)(queue, upper_lower, trans, unit_diag, n, a,
+                                                       x, incx);
+    });
 }
 
 void tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_ctpsv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                    incx);
+    static stats::routine routine{ trace_site, "ctpsv", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_ctpsv_sycl)(queue, upper_lower, trans, unit_diag, n, a,
+                                                       x, incx);
+    });
 }
 
 void tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &a,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_ztpsv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                    incx);
+    static stats::routine routine{ trace_site, "ztpsv", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_ztpsv_sycl)(queue, upper_lower, trans, unit_diag, n, a,
+                                                       x, incx);
+    });
 }
 
 void trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_strmv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda,
-                                                    x, incx);
+    static stats::routine routine{ trace_site, "strmv", "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_strmv_sycl)(queue, upper_lower, trans, unit_diag, n, a,
+                                                       lda, x, incx);
+    });
 }
 
 void trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_dtrmv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda,
-                                                    x, incx);
+    static stats::routine routine{ trace_site, "dtrmv", "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dtrmv_sycl)(queue, upper_lower, trans, unit_diag, n, a,
+                                                       lda, x, incx);
+    });
 }
 
 void trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a,
           std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_ctrmv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda,
-                                                    x, incx);
+    static stats::routine routine{ trace_site, "ctrmv", "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_ctrmv_sycl)(queue, upper_lower, trans, unit_diag, n, a,
+                                                       lda, x, incx);
+    });
 }
 
 void trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &a,
           std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_ztrmv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda,
-                                                    x, incx);
+    static stats::routine routine{ trace_site, "ztrmv", "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_ztrmv_sycl)(queue, upper_lower, trans, unit_diag, n, a,
+                                                       lda, x, incx);
+    });
 }
 
 void trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_strsv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda,
-                                                    x, incx);
+    static stats::routine routine{ trace_site, "strsv", "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_strsv_sycl)(queue, upper_lower, trans, unit_diag, n, a,
+                                                       lda, x, incx);
+    });
 }
 
 void trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_dtrsv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda,
-                                                    x, incx);
+    static stats::routine routine{ trace_site, "dtrsv", "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dtrsv_sycl)(queue, upper_lower, trans, unit_diag, n, a,
+                                                       lda, x, incx);
+    });
 }
 
 void trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a,
           std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_ctrsv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda,
-                                                    x, incx);
+    static stats::routine routine{ trace_site, "ctrsv", "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_ctrsv_sycl)(queue, upper_lower, trans, unit_diag, n, a,
+                                                       lda, x, incx);
+    });
 }
 
 void trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &a,
           std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_ztrsv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda,
-                                                    x, incx);
+    static stats::routine routine{ trace_site, "ztrsv", "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_ztrsv_sycl)(queue, upper_lower, trans, unit_diag, n, a,
+                                                       lda, x, incx);
+    });
 }
 
 void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
           std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
           cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
           std::int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_sgemm_sycl(queue, transa, transb, m, n, k, alpha, a, lda,
-                                                    b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "sgemm", "transa transb m n k lda ldb ldc",
+                                   { stats::work::gemm, stats::f32 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_sgemm_sycl)(queue, transa, transb, m, n, k, alpha, a,
+                                                       lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
           std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
           cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
           std::int64_t ldb, double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_dgemm_sycl(queue, transa, transb, m, n, k, alpha, a, lda,
-                                                    b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "dgemm", "transa transb m n k lda ldb ldc",
+                                   { stats::work::gemm, stats::f64 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dgemm_sycl)(queue, transa, transb, m, n, k, alpha, a,
+                                                       lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
@@ -865,8 +1481,13 @@ void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_cgemm_sycl(queue, transa, transb, m, n, k, alpha, a, lda,
-                                                    b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "cgemm", "transa transb m n k lda ldb ldc",
+                                   { stats::work::gemm, stats::c32 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_cgemm_sycl)(queue, transa, transb, m, n, k, alpha, a,
+                                                       lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
@@ -874,8 +1495,13 @@ void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
           cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_zgemm_sycl(queue, transa, transb, m, n, k, alpha, a, lda,
-                                                    b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "zgemm", "transa transb m n k lda ldb ldc",
+                                   { stats::work::gemm, stats::c64 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zgemm_sycl)(queue, transa, transb, m, n, k, alpha, a,
+                                                       lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
@@ -883,8 +1509,13 @@ void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
           cl::sycl::buffer<cl::sycl::half, 1> &a, std::int64_t lda,
           cl::sycl::buffer<cl::sycl::half, 1> &b, std::int64_t ldb, cl::sycl::half beta,
           cl::sycl::buffer<cl::sycl::half, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_hgemm_sycl(queue, transa, transb, m, n, k, alpha, a, lda,
-                                                    b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "hgemm", "transa transb m n k lda ldb ldc",
+                                   { stats::work::gemm, stats::f16 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_hgemm_sycl)(queue, transa, transb, m, n, k, alpha, a,
+                                                       lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
@@ -892,8 +1523,13 @@ void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
           cl::sycl::buffer<cl::sycl::half, 1> &a, std::int64_t lda,
           cl::sycl::buffer<cl::sycl::half, 1> &b, std::int64_t ldb, float beta,
           cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_gemm_f16f16f32_sycl(queue, transa, transb, m, n, k, alpha,
-                                                             a, lda, b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "gemm_f16f16f32", "transa transb m n k lda ldb ldc",
+                                   { stats::work::gemm, stats::f16 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_gemm_f16f16f32_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void hemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
@@ -901,8 +1537,13 @@ void hemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, u
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_chemm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
-                                                    lda, b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "chemm", "left_right upper_lower m n lda ldb ldc",
+                                   { stats::work::symm, stats::c32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, m, n, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_chemm_sycl)(queue, left_right, upper_lower, m, n, alpha,
+                                                       a, lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void hemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
@@ -910,24 +1551,39 @@ void hemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, u
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
           cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_zhemm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
-                                                    lda, b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "zhemm", "left_right upper_lower m n lda ldb ldc",
+                                   { stats::work::symm, stats::c64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, m, n, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zhemm_sycl)(queue, left_right, upper_lower, m, n, alpha,
+                                                       a, lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void herk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
           std::int64_t lda, float beta, cl::sycl::buffer<std::complex<float>, 1> &c,
           std::int64_t ldc) {
-    function_tables[libkey].column_major_cherk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                    beta, c, ldc);
+    static stats::routine routine{ trace_site, "cherk", "upper_lower trans n k lda ldc",
+                                   { stats::work::syrk, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_cherk_sycl)(queue, upper_lower, trans, n, k, alpha, a,
+                                                       lda, beta, c, ldc);
+    });
 }
 
 void herk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, double alpha,
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda, double beta,
           cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_zherk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                    beta, c, ldc);
+    static stats::routine routine{ trace_site, "zherk", "upper_lower trans n k lda ldc",
+                                   { stats::work::syrk, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zherk_sycl)(queue, upper_lower, trans, n, k, alpha, a,
+                                                       lda, beta, c, ldc);
+    });
 }
 
 void her2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -935,8 +1591,13 @@ void her2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
            cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
            cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, float beta,
            cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_cher2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                     b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "cher2k", "upper_lower trans n k lda ldb ldc",
+                                   { stats::work::syr2k, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_cher2k_sycl)(queue, upper_lower, trans, n, k, alpha, a,
+                                                        lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void her2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -944,24 +1605,39 @@ void her2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
            cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
            cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, double beta,
            cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_zher2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                     b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "zher2k", "upper_lower trans n k lda ldb ldc",
+                                   { stats::work::syr2k, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zher2k_sycl)(queue, upper_lower, trans, n, k, alpha, a,
+                                                        lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
           std::int64_t m, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
           std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
           cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_ssymm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
-                                                    lda, b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "ssymm", "left_right upper_lower m n lda ldb ldc",
+                                   { stats::work::symm, stats::f32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, m, n, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_ssymm_sycl)(queue, left_right, upper_lower, m, n, alpha,
+                                                       a, lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
           std::int64_t m, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
           std::int64_t lda, cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
           cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_dsymm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
-                                                    lda, b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "dsymm", "left_right upper_lower m n lda ldb ldc",
+                                   { stats::work::symm, stats::f64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, m, n, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dsymm_sycl)(queue, left_right, upper_lower, m, n, alpha,
+                                                       a, lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
@@ -969,8 +1645,13 @@ void symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, u
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_csymm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
-                                                    lda, b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "csymm", "left_right upper_lower m n lda ldb ldc",
+                                   { stats::work::symm, stats::c32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, m, n, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_csymm_sycl)(queue, left_right, upper_lower, m, n, alpha,
+                                                       a, lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
@@ -978,54 +1659,89 @@ void symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, u
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
           cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_zsymm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
-                                                    lda, b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "zsymm", "left_right upper_lower m n lda ldb ldc",
+                                   { stats::work::symm, stats::c64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, m, n, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zsymm_sycl)(queue, left_right, upper_lower, m, n, alpha,
+                                                       a, lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a,
           std::int64_t lda, float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_ssyrk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                    beta, c, ldc);
+    static stats::routine routine{ trace_site, "ssyrk", "upper_lower trans n k lda ldc",
+                                   { stats::work::syrk, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_ssyrk_sycl)(queue, upper_lower, trans, n, k, alpha, a,
+                                                       lda, beta, c, ldc);
+    });
 }
 
 void syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, double alpha, cl::sycl::buffer<double, 1> &a,
           std::int64_t lda, double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_dsyrk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                    beta, c, ldc);
+    static stats::routine routine{ trace_site, "dsyrk", "upper_lower trans n k lda ldc",
+                                   { stats::work::syrk, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dsyrk_sycl)(queue, upper_lower, trans, n, k, alpha, a,
+                                                       lda, beta, c, ldc);
+    });
 }
 
 void syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, std::complex<float> alpha,
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_csyrk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                    beta, c, ldc);
+    static stats::routine routine{ trace_site, "csyrk", "upper_lower trans n k lda ldc",
+                                   { stats::work::syrk, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_csyrk_sycl)(queue, upper_lower, trans, n, k, alpha, a,
+                                                       lda, beta, c, ldc);
+    });
 }
 
 void syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, std::complex<double> alpha,
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda, std::complex<double> beta,
           cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_zsyrk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                    beta, c, ldc);
+    static stats::routine routine{ trace_site, "zsyrk", "upper_lower trans n k lda ldc",
+                                   { stats::work::syrk, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zsyrk_sycl)(queue, upper_lower, trans, n, k, alpha, a,
+                                                       lda, beta, c, ldc);
+    });
 }
 
 void syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
            std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a,
            std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
            cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_ssyr2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                     b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "ssyr2k", "upper_lower trans n k lda ldb ldc",
+                                   { stats::work::syr2k, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_ssyr2k_sycl)(queue, upper_lower, trans, n, k, alpha, a,
+                                                        lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
            std::int64_t n, std::int64_t k, double alpha, cl::sycl::buffer<double, 1> &a,
            std::int64_t lda, cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
            cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_dsyr2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                     b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "dsyr2k", "upper_lower trans n k lda ldb ldc",
+                                   { stats::work::syr2k, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dsyr2k_sycl)(queue, upper_lower, trans, n, k, alpha, a,
+                                                        lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -1033,8 +1749,13 @@ void syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
            cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
            cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
            cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_csyr2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                     b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "csyr2k", "upper_lower trans n k lda ldb ldc",
+                                   { stats::work::syr2k, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_csyr2k_sycl)(queue, upper_lower, trans, n, k, alpha, a,
+                                                        lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -1043,72 +1764,125 @@ void syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
            cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
            std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
            std::int64_t ldc) {
-    function_tables[libkey].column_major_zsyr2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                     b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "zsyr2k", "upper_lower trans n k lda ldb ldc",
+                                   { stats::work::syr2k, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zsyr2k_sycl)(queue, upper_lower, trans, n, k, alpha, a,
+                                                        lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
           cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
           std::int64_t ldb) {
-    function_tables[libkey].column_major_strmm_sycl(queue, left_right, upper_lower, trans,
-                                                    unit_diag, m, n, alpha, a, lda, b, ldb);
+    static stats::routine routine{ trace_site, "strmm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::f32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_strmm_sycl)(queue, left_right, upper_lower, trans,
+                                                       unit_diag, m, n, alpha, a, lda, b, ldb);
+    });
 }
 
 void trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
           cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
           std::int64_t ldb) {
-    function_tables[libkey].column_major_dtrmm_sycl(queue, left_right, upper_lower, trans,
-                                                    unit_diag, m, n, alpha, a, lda, b, ldb);
+    static stats::routine routine{ trace_site, "dtrmm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::f64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dtrmm_sycl)(queue, left_right, upper_lower, trans,
+                                                       unit_diag, m, n, alpha, a, lda, b, ldb);
+    });
 }
 
 void trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].column_major_ctrmm_sycl(queue, left_right, upper_lower, trans,
-                                                    unit_diag, m, n, alpha, a, lda, b, ldb);
+    static stats::routine routine{ trace_site, "ctrmm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::c32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_ctrmm_sycl)(queue, left_right, upper_lower, trans,
+                                                       unit_diag, m, n, alpha, a, lda, b, ldb);
+    });
 }
 
 void trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
           std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].column_major_ztrmm_sycl(queue, left_right, upper_lower, trans,
-                                                    unit_diag, m, n, alpha, a, lda, b, ldb);
+    static stats::routine routine{ trace_site, "ztrmm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::c64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_ztrmm_sycl)(queue, left_right, upper_lower, trans,
+                                                       unit_diag, m, n, alpha, a, lda, b, ldb);
+    });
 }
 
 void trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
           cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
           std::int64_t ldb) {
-    function_tables[libkey].column_major_strsm_sycl(queue, left_right, upper_lower, trans,
-                                                    unit_diag, m, n, alpha, a, lda, b, ldb);
+    static stats::routine routine{ trace_site, "strsm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::f32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_strsm_sycl)(queue, left_right, upper_lower, trans,
+                                                       unit_diag, m, n, alpha, a, lda, b, ldb);
+    });
 }
 
 void trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
           cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
           std::int64_t ldb) {
-    function_tables[libkey].column_major_dtrsm_sycl(queue, left_right, upper_lower, trans,
-                                                    unit_diag, m, n, alpha, a, lda, b, ldb);
+    static stats::routine routine{ trace_site, "dtrsm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::f64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dtrsm_sycl)(queue, left_right, upper_lower, trans,
+                                                       unit_diag, m, n, alpha, a, lda, b, ldb);
+    });
 }
 
 void trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].column_major_ctrsm_sycl(queue, left_right, upper_lower, trans,
-                                                    unit_diag, m, n, alpha, a, lda, b, ldb);
+    static stats::routine routine{ trace_site, "ctrsm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::c32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_ctrsm_sycl)(queue, left_right, upper_lower, trans,
+                                                       unit_diag, m, n, alpha, a, lda, b, ldb);
+    });
 }
 
 void trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
           std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].column_major_ztrsm_sycl(queue, left_right, upper_lower, trans,
-                                                    unit_diag, m, n, alpha, a, lda, b, ldb);
+    static stats::routine routine{ trace_site, "ztrsm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::c64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_ztrsm_sycl)(queue, left_right, upper_lower, trans,
+                                                       unit_diag, m, n, alpha, a, lda, b, ldb);
+    });
 }
 
 void gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
@@ -1117,9 +1891,16 @@ void gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose tr
                 cl::sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b, float beta,
                 cl::sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
                 std::int64_t batch_size) {
-    function_tables[libkey].column_major_sgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    static stats::routine routine{ trace_site, "sgemm_batch_strided",
+        "transa transb m n k lda stride_a ldb stride_b ldc stride_c batch_size",
+        { stats::work::gemm, stats::f32 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, stride_a, ldb, stride_b, ldc,
+                                    stride_c, batch_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_sgemm_batch_strided_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+            stride_c, batch_size);
+    });
 }
 
 void gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
@@ -1128,9 +1909,16 @@ void gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose tr
                 cl::sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t stride_b,
                 double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
                 std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[libkey].column_major_dgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    static stats::routine routine{ trace_site, "dgemm_batch_strided",
+        "transa transb m n k lda stride_a ldb stride_b ldc stride_c batch_size",
+        { stats::work::gemm, stats::f64 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, stride_a, ldb, stride_b, ldc,
+                                    stride_c, batch_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dgemm_batch_strided_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+            stride_c, batch_size);
+    });
 }
 
 void gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
@@ -1141,9 +1929,16 @@ void gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose tr
                 std::int64_t stride_b, std::complex<float> beta,
                 cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
                 std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[libkey].column_major_cgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    static stats::routine routine{ trace_site, "cgemm_batch_strided",
+        "transa transb m n k lda stride_a ldb stride_b ldc stride_c batch_size",
+        { stats::work::gemm, stats::c32 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, stride_a, ldb, stride_b, ldc,
+                                    stride_c, batch_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_cgemm_batch_strided_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+            stride_c, batch_size);
+    });
 }
 
 void gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
@@ -1154,9 +1949,16 @@ void gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose tr
                 std::int64_t stride_b, std::complex<double> beta,
                 cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
                 std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[libkey].column_major_zgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    static stats::routine routine{ trace_site, "zgemm_batch_strided",
+        "transa transb m n k lda stride_a ldb stride_b ldc stride_c batch_size",
+        { stats::work::gemm, stats::c64 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, stride_a, ldb, stride_b, ldc,
+                                    stride_c, batch_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zgemm_batch_strided_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+            stride_c, batch_size);
+    });
 }
 
 void trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -1164,9 +1966,16 @@ void trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_ri
                 float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
                 cl::sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b,
                 std::int64_t batch_size) {
-    function_tables[libkey].column_major_strsm_batch_strided_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size);
+    static stats::routine routine{ trace_site, "strsm_batch_strided",
+        "left_right upper_lower trans unit_diag m n lda stride_a ldb stride_b batch_size",
+        { stats::work::trmm, stats::f32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, stride_a,
+                                    ldb, stride_b, batch_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_strsm_batch_strided_sycl)(
+            queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
+            stride_b, batch_size);
+    });
 }
 
 void trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -1174,9 +1983,16 @@ void trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_ri
                 double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
                 std::int64_t stride_a, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
                 std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[libkey].column_major_dtrsm_batch_strided_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size);
+    static stats::routine routine{ trace_site, "dtrsm_batch_strided",
+        "left_right upper_lower trans unit_diag m n lda stride_a ldb stride_b batch_size",
+        { stats::work::trmm, stats::f64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, stride_a,
+                                    ldb, stride_b, batch_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dtrsm_batch_strided_sycl)(
+            queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
+            stride_b, batch_size);
+    });
 }
 
 void trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -1185,9 +2001,16 @@ void trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_ri
                 std::int64_t lda, std::int64_t stride_a,
                 cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
                 std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[libkey].column_major_ctrsm_batch_strided_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size);
+    static stats::routine routine{ trace_site, "ctrsm_batch_strided",
+        "left_right upper_lower trans unit_diag m n lda stride_a ldb stride_b batch_size",
+        { stats::work::trmm, stats::c32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, stride_a,
+                                    ldb, stride_b, batch_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_ctrsm_batch_strided_sycl)(
+            queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
+            stride_b, batch_size);
+    });
 }
 
 void trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -1196,25 +2019,44 @@ void trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_ri
                 std::int64_t lda, std::int64_t stride_a,
                 cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
                 std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[libkey].column_major_ztrsm_batch_strided_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size);
+    static stats::routine routine{ trace_site, "ztrsm_batch_strided",
+        "left_right upper_lower trans unit_diag m n lda stride_a ldb stride_b batch_size",
+        { stats::work::trmm, stats::c64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, stride_a,
+                                    ldb, stride_b, batch_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_ztrsm_batch_strided_sycl)(
+            queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
+            stride_b, batch_size);
+    });
 }
 
 void gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose transa,
            transpose transb, std::int64_t n, std::int64_t k, float alpha,
            cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
            std::int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_sgemmt_sycl(queue, upper_lower, transa, transb, n, k,
-                                                     alpha, a, lda, b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "sgemmt",
+                                   "upper_lower transa transb n k lda ldb ldc",
+                                   { stats::work::gemmt, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, transa, transb, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_sgemmt_sycl)(queue, upper_lower, transa, transb, n, k,
+                                                        alpha, a, lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose transa,
            transpose transb, std::int64_t n, std::int64_t k, double alpha,
            cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
            std::int64_t ldb, double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_dgemmt_sycl(queue, upper_lower, transa, transb, n, k,
-                                                     alpha, a, lda, b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "dgemmt",
+                                   "upper_lower transa transb n k lda ldb ldc",
+                                   { stats::work::gemmt, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, transa, transb, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_dgemmt_sycl)(queue, upper_lower, transa, transb, n, k,
+                                                        alpha, a, lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose transa,
@@ -1222,8 +2064,14 @@ void gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
            cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
            cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
            cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_cgemmt_sycl(queue, upper_lower, transa, transb, n, k,
-                                                     alpha, a, lda, b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "cgemmt",
+                                   "upper_lower transa transb n k lda ldb ldc",
+                                   { stats::work::gemmt, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, transa, transb, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_cgemmt_sycl)(queue, upper_lower, transa, transb, n, k,
+                                                        alpha, a, lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose transa,
@@ -1232,8 +2080,14 @@ void gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
            cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
            std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
            std::int64_t ldc) {
-    function_tables[libkey].column_major_zgemmt_sycl(queue, upper_lower, transa, transb, n, k,
-                                                     alpha, a, lda, b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "zgemmt",
+                                   "upper_lower transa transb n k lda ldb ldc",
+                                   { stats::work::gemmt, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, transa, transb, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_zgemmt_sycl)(queue, upper_lower, transa, transb, n, k,
+                                                        alpha, a, lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void gemm_bias(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
@@ -1242,8 +2096,15 @@ void gemm_bias(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose tra
                cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, uint8_t bo, float beta,
                cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
                cl::sycl::buffer<int32_t, 1> &co) {
-    function_tables[libkey].column_major_gemm_s8u8s32_bias_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co);
+    static stats::routine routine{ trace_site, "gemm_s8u8s32_bias",
+                                   "transa transb offsetc m n k lda ldb ldc",
+                                   { stats::work::gemm, stats::s8 } };
+    auto shape = verbose::make_dims(transa, transb, offsetc, m, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.column_major_gemm_s8u8s32_bias_sycl)(queue, transa, transb, offsetc,
+                                                                   m, n, k, alpha, a, lda, ao, b,
+                                                                   ldb, bo, beta, c, ldc, co);
+    });
 }
 
 // USM APIs
@@ -1251,75 +2112,125 @@ void gemm_bias(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose tra
 cl::sycl::event asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const std::complex<float> *x, std::int64_t incx, float *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_scasum_usm_sycl(queue, n, x, incx, result,
-                                                                dependencies);
+    static stats::routine routine{ trace_site, "scasum_usm", "n incx",
+                                   { stats::work::asum, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_scasum_usm_sycl)(queue, n, x, incx, result,
+                                                                   dependencies);
+    });
 }
 
 cl::sycl::event asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const std::complex<double> *x, std::int64_t incx, double *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dzasum_usm_sycl(queue, n, x, incx, result,
-                                                                dependencies);
+    static stats::routine routine{ trace_site, "dzasum_usm", "n incx",
+                                   { stats::work::asum, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dzasum_usm_sycl)(queue, n, x, incx, result,
+                                                                   dependencies);
+    });
 }
 
 cl::sycl::event asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const float *x, std::int64_t incx, float *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sasum_usm_sycl(queue, n, x, incx, result,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "sasum_usm", "n incx",
+                                   { stats::work::asum, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_sasum_usm_sycl)(queue, n, x, incx, result,
+                                                                  dependencies);
+    });
 }
 
 cl::sycl::event asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const double *x, std::int64_t incx, double *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dasum_usm_sycl(queue, n, x, incx, result,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "dasum_usm", "n incx",
+                                   { stats::work::asum, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dasum_usm_sycl)(queue, n, x, incx, result,
+                                                                  dependencies);
+    });
 }
 
 cl::sycl::event axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      float alpha, const float *x, std::int64_t incx, float *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_saxpy_usm_sycl(queue, n, alpha, x, incx, y, incy,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "saxpy_usm", "n incx incy",
+                                   { stats::work::axpy, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_saxpy_usm_sycl)(queue, n, alpha, x, incx, y, incy,
+                                                                  dependencies);
+    });
 }
 
 cl::sycl::event axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      double alpha, const double *x, std::int64_t incx, double *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_daxpy_usm_sycl(queue, n, alpha, x, incx, y, incy,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "daxpy_usm", "n incx incy",
+                                   { stats::work::axpy, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_daxpy_usm_sycl)(queue, n, alpha, x, incx, y, incy,
+                                                                  dependencies);
+    });
 }
 
 cl::sycl::event axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      std::complex<float> alpha, const std::complex<float> *x, std::int64_t incx,
                      std::complex<float> *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_caxpy_usm_sycl(queue, n, alpha, x, incx, y, incy,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "caxpy_usm", "n incx incy",
+                                   { stats::work::axpy, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_caxpy_usm_sycl)(queue, n, alpha, x, incx, y, incy,
+                                                                  dependencies);
+    });
 }
 
 cl::sycl::event axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      std::complex<double> alpha, const std::complex<double> *x, std::int64_t incx,
                      std::complex<double> *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zaxpy_usm_sycl(queue, n, alpha, x, incx, y, incy,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "zaxpy_usm", "n incx incy",
+                                   { stats::work::axpy, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zaxpy_usm_sycl)(queue, n, alpha, x, incx, y, incy,
+                                                                  dependencies);
+    });
 }
 
 cl::sycl::event axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t *n,
                            float *alpha, const float **x, std::int64_t *incx, float **y,
                            std::int64_t *incy, std::int64_t group_count, std::int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_saxpy_batch_group_usm_sycl(
-        queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    static stats::routine routine{ trace_site, "saxpy_batch_group_usm", "group_count",
+                                   { stats::work::axpy, stats::f32 } };
+    auto shape = verbose::make_dims(group_count);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_saxpy_batch_group_usm_sycl)(
+            queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    });
 }
 
 cl::sycl::event axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t *n,
                            double *alpha, const double **x, std::int64_t *incx, double **y,
                            std::int64_t *incy, std::int64_t group_count, std::int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_daxpy_batch_group_usm_sycl(
-        queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    static stats::routine routine{ trace_site, "daxpy_batch_group_usm", "group_count",
+                                   { stats::work::axpy, stats::f64 } };
+    auto shape = verbose::make_dims(group_count);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_daxpy_batch_group_usm_sycl)(
+            queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    });
 }
 
 cl::sycl::event axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t *n,
@@ -1327,8 +2238,13 @@ cl::sycl::event axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, s
                            std::int64_t *incx, std::complex<float> **y, std::int64_t *incy,
                            std::int64_t group_count, std::int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_caxpy_batch_group_usm_sycl(
-        queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    static stats::routine routine{ trace_site, "caxpy_batch_group_usm", "group_count",
+                                   { stats::work::axpy, stats::c32 } };
+    auto shape = verbose::make_dims(group_count);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_caxpy_batch_group_usm_sycl)(
+            queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    });
 }
 
 cl::sycl::event axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t *n,
@@ -1336,336 +2252,565 @@ cl::sycl::event axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, s
                            std::int64_t *incx, std::complex<double> **y, std::int64_t *incy,
                            std::int64_t group_count, std::int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zaxpy_batch_group_usm_sycl(
-        queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    static stats::routine routine{ trace_site, "zaxpy_batch_group_usm", "group_count",
+                                   { stats::work::axpy, stats::c64 } };
+    auto shape = verbose::make_dims(group_count);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zaxpy_batch_group_usm_sycl)(
+            queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    });
 }
 
 cl::sycl::event copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const float *x, std::int64_t incx, float *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_scopy_usm_sycl(queue, n, x, incx, y, incy,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "scopy_usm", "n incx incy",
+                                   { stats::work::copy, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_scopy_usm_sycl)(queue, n, x, incx, y, incy,
+                                                                  dependencies);
+    });
 }
 
 cl::sycl::event copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const double *x, std::int64_t incx, double *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dcopy_usm_sycl(queue, n, x, incx, y, incy,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "dcopy_usm", "n incx incy",
+                                   { stats::work::copy, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dcopy_usm_sycl)(queue, n, x, incx, y, incy,
+                                                                  dependencies);
+    });
 }
 
 cl::sycl::event copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const std::complex<float> *x, std::int64_t incx, std::complex<float> *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ccopy_usm_sycl(queue, n, x, incx, y, incy,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "ccopy_usm", "n incx incy",
+                                   { stats::work::copy, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_ccopy_usm_sycl)(queue, n, x, incx, y, incy,
+                                                                  dependencies);
+    });
 }
 
 cl::sycl::event copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const std::complex<double> *x, std::int64_t incx, std::complex<double> *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zcopy_usm_sycl(queue, n, x, incx, y, incy,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "zcopy_usm", "n incx incy",
+                                   { stats::work::copy, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zcopy_usm_sycl)(queue, n, x, incx, y, incy,
+                                                                  dependencies);
+    });
 }
 
 cl::sycl::event dot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                     const float *x, std::int64_t incx, const float *y, std::int64_t incy,
                     float *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sdot_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                              dependencies);
+    static stats::routine routine{ trace_site, "sdot_usm", "n incx incy",
+                                   { stats::work::dot, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_sdot_usm_sycl)(queue, n, x, incx, y, incy, result,
+                                                                 dependencies);
+    });
 }
 
 cl::sycl::event dot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                     const double *x, std::int64_t incx, const double *y, std::int64_t incy,
                     double *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ddot_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                              dependencies);
+    static stats::routine routine{ trace_site, "ddot_usm", "n incx incy",
+                                   { stats::work::dot, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_ddot_usm_sycl)(queue, n, x, incx, y, incy, result,
+                                                                 dependencies);
+    });
 }
 
 cl::sycl::event dot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                     const float *x, std::int64_t incx, const float *y, std::int64_t incy,
                     double *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dsdot_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "dsdot_usm", "n incx incy",
+                                   { stats::work::dot, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dsdot_usm_sycl)(queue, n, x, incx, y, incy,
+                                                                  result, dependencies);
+    });
 }
 
 cl::sycl::event dotc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const std::complex<float> *x, std::int64_t incx, const std::complex<float> *y,
                      std::int64_t incy, std::complex<float> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cdotc_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "cdotc_usm", "n incx incy",
+                                   { stats::work::dot, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_cdotc_usm_sycl)(queue, n, x, incx, y, incy,
+                                                                  result, dependencies);
+    });
 }
 
 cl::sycl::event dotc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const std::complex<double> *x, std::int64_t incx,
                      const std::complex<double> *y, std::int64_t incy, std::complex<double> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zdotc_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "zdotc_usm", "n incx incy",
+                                   { stats::work::dot, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zdotc_usm_sycl)(queue, n, x, incx, y, incy,
+                                                                  result, dependencies);
+    });
 }
 
 cl::sycl::event dotu(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const std::complex<float> *x, std::int64_t incx, const std::complex<float> *y,
                      std::int64_t incy, std::complex<float> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cdotu_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "cdotu_usm", "n incx incy",
+                                   { stats::work::dot, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_cdotu_usm_sycl)(queue, n, x, incx, y, incy,
+                                                                  result, dependencies);
+    });
 }
 
 cl::sycl::event dotu(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const std::complex<double> *x, std::int64_t incx,
                      const std::complex<double> *y, std::int64_t incy, std::complex<double> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zdotu_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "zdotu_usm", "n incx incy",
+                                   { stats::work::dot, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zdotu_usm_sycl)(queue, n, x, incx, y, incy,
+                                                                  result, dependencies);
+    });
 }
 
 cl::sycl::event iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                       const float *x, std::int64_t incx, std::int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_isamin_usm_sycl(queue, n, x, incx, result,
-                                                                dependencies);
+    static stats::routine routine{ trace_site, "isamin_usm", "n incx",
+                                   { stats::work::iamax, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_isamin_usm_sycl)(queue, n, x, incx, result,
+                                                                   dependencies);
+    });
 }
 
 cl::sycl::event iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                       const double *x, std::int64_t incx, std::int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_idamin_usm_sycl(queue, n, x, incx, result,
-                                                                dependencies);
+    static stats::routine routine{ trace_site, "idamin_usm", "n incx",
+                                   { stats::work::iamax, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_idamin_usm_sycl)(queue, n, x, incx, result,
+                                                                   dependencies);
+    });
 }
 
 cl::sycl::event iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                       const std::complex<float> *x, std::int64_t incx, std::int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_icamin_usm_sycl(queue, n, x, incx, result,
-                                                                dependencies);
+    static stats::routine routine{ trace_site, "icamin_usm", "n incx",
+                                   { stats::work::iamax, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_icamin_usm_sycl)(queue, n, x, incx, result,
+                                                                   dependencies);
+    });
 }
 
 cl::sycl::event iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                       const std::complex<double> *x, std::int64_t incx, std::int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_izamin_usm_sycl(queue, n, x, incx, result,
-                                                                dependencies);
+    static stats::routine routine{ trace_site, "izamin_usm", "n incx",
+                                   { stats::work::iamax, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_izamin_usm_sycl)(queue, n, x, incx, result,
+                                                                   dependencies);
+    });
 }
 
 cl::sycl::event iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                       const float *x, std::int64_t incx, std::int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_isamax_usm_sycl(queue, n, x, incx, result,
-                                                                dependencies);
+    static stats::routine routine{ trace_site, "isamax_usm", "n incx",
+                                   { stats::work::iamax, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_isamax_usm_sycl)(queue, n, x, incx, result,
+                                                                   dependencies);
+    });
 }
 
 cl::sycl::event iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                       const double *x, std::int64_t incx, std::int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_idamax_usm_sycl(queue, n, x, incx, result,
-                                                                dependencies);
+    static stats::routine routine{ trace_site, "idamax_usm", "n incx",
+                                   { stats::work::iamax, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_idamax_usm_sycl)(queue, n, x, incx, result,
+                                                                   dependencies);
+    });
 }
 
 cl::sycl::event iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                       const std::complex<float> *x, std::int64_t incx, std::int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_icamax_usm_sycl(queue, n, x, incx, result,
-                                                                dependencies);
+    static stats::routine routine{ trace_site, "icamax_usm", "n incx",
+                                   { stats::work::iamax, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_icamax_usm_sycl)(queue, n, x, incx, result,
+                                                                   dependencies);
+    });
 }
 
 cl::sycl::event iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                       const std::complex<double> *x, std::int64_t incx, std::int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_izamax_usm_sycl(queue, n, x, incx, result,
-                                                                dependencies);
+    static stats::routine routine{ trace_site, "izamax_usm", "n incx",
+                                   { stats::work::iamax, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_izamax_usm_sycl)(queue, n, x, incx, result,
+                                                                   dependencies);
+    });
 }
 
 cl::sycl::event nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const std::complex<float> *x, std::int64_t incx, float *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_scnrm2_usm_sycl(queue, n, x, incx, result,
-                                                                dependencies);
+    static stats::routine routine{ trace_site, "scnrm2_usm", "n incx",
+                                   { stats::work::nrm2, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_scnrm2_usm_sycl)(queue, n, x, incx, result,
+                                                                   dependencies);
+    });
 }
 
 cl::sycl::event nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const std::complex<double> *x, std::int64_t incx, double *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dznrm2_usm_sycl(queue, n, x, incx, result,
-                                                                dependencies);
+    static stats::routine routine{ trace_site, "dznrm2_usm", "n incx",
+                                   { stats::work::nrm2, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dznrm2_usm_sycl)(queue, n, x, incx, result,
+                                                                   dependencies);
+    });
 }
 
 cl::sycl::event nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const float *x, std::int64_t incx, float *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_snrm2_usm_sycl(queue, n, x, incx, result,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "snrm2_usm", "n incx",
+                                   { stats::work::nrm2, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_snrm2_usm_sycl)(queue, n, x, incx, result,
+                                                                  dependencies);
+    });
 }
 
 cl::sycl::event nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const double *x, std::int64_t incx, double *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dnrm2_usm_sycl(queue, n, x, incx, result,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "dnrm2_usm", "n incx",
+                                   { stats::work::nrm2, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dnrm2_usm_sycl)(queue, n, x, incx, result,
+                                                                  dependencies);
+    });
 }
 
 cl::sycl::event rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                     std::complex<float> *x, std::int64_t incx, std::complex<float> *y,
                     std::int64_t incy, float c, float s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_srot_usm_sycl(queue, n, x, incx, y, incy, c, s,
-                                                              dependencies);
+    static stats::routine routine{ trace_site, "srot_usm", "n incx incy",
+                                   { stats::work::rot, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_srot_usm_sycl)(queue, n, x, incx, y, incy, c, s,
+                                                                 dependencies);
+    });
 }
 
 cl::sycl::event rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                     std::complex<double> *x, std::int64_t incx, std::complex<double> *y,
                     std::int64_t incy, double c, double s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_drot_usm_sycl(queue, n, x, incx, y, incy, c, s,
-                                                              dependencies);
+    static stats::routine routine{ trace_site, "drot_usm", "n incx incy",
+                                   { stats::work::rot, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_drot_usm_sycl)(queue, n, x, incx, y, incy, c, s,
+                                                                 dependencies);
+    });
 }
 
 cl::sycl::event rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, float *x,
                     std::int64_t incx, float *y, std::int64_t incy, float c, float s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_csrot_usm_sycl(queue, n, x, incx, y, incy, c, s,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "csrot_usm", "n incx incy",
+                                   { stats::work::rot, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_csrot_usm_sycl)(queue, n, x, incx, y, incy, c, s,
+                                                                  dependencies);
+    });
 }
 
 cl::sycl::event rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, double *x,
                     std::int64_t incx, double *y, std::int64_t incy, double c, double s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zdrot_usm_sycl(queue, n, x, incx, y, incy, c, s,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "zdrot_usm", "n incx incy",
+                                   { stats::work::rot, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zdrot_usm_sycl)(queue, n, x, incx, y, incy, c, s,
+                                                                  dependencies);
+    });
 }
 
 cl::sycl::event rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue, float *a, float *b,
                      float *c, float *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_srotg_usm_sycl(queue, a, b, c, s, dependencies);
+    static stats::routine routine{ trace_site, "srotg_usm", "" };
+    auto shape = verbose::make_dims();
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_srotg_usm_sycl)(queue, a, b, c, s, dependencies);
+    });
 }
 
 cl::sycl::event rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue, double *a, double *b,
                      double *c, double *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_drotg_usm_sycl(queue, a, b, c, s, dependencies);
+    static stats::routine routine{ trace_site, "drotg_usm", "" };
+    auto shape = verbose::make_dims();
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_drotg_usm_sycl)(queue, a, b, c, s, dependencies);
+    });
 }
 
 cl::sycl::event rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::complex<float> *a,
                      std::complex<float> *b, float *c, std::complex<float> *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_crotg_usm_sycl(queue, a, b, c, s, dependencies);
+    static stats::routine routine{ trace_site, "crotg_usm", "" };
+    auto shape = verbose::make_dims();
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_crotg_usm_sycl)(queue, a, b, c, s, dependencies);
+    });
 }
 
 cl::sycl::event rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::complex<double> *a,
                      std::complex<double> *b, double *c, std::complex<double> *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zrotg_usm_sycl(queue, a, b, c, s, dependencies);
+    static stats::routine routine{ trace_site, "zrotg_usm", "" };
+    auto shape = verbose::make_dims();
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zrotg_usm_sycl)(queue, a, b, c, s, dependencies);
+    });
 }
 
 cl::sycl::event rotm(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, float *x,
                      std::int64_t incx, float *y, std::int64_t incy, float *param,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_srotm_usm_sycl(queue, n, x, incx, y, incy, param,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "srotm_usm", "n incx incy",
+                                   { stats::work::rot, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_srotm_usm_sycl)(queue, n, x, incx, y, incy, param,
+                                                                  dependencies);
+    });
 }
 
 cl::sycl::event rotm(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, double *x,
                      std::int64_t incx, double *y, std::int64_t incy, double *param,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_drotm_usm_sycl(queue, n, x, incx, y, incy, param,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "drotm_usm", "n incx incy",
+                                   { stats::work::rot, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_drotm_usm_sycl)(queue, n, x, incx, y, incy, param,
+                                                                  dependencies);
+    });
 }
 
 cl::sycl::event rotmg(oneapi::mkl::device libkey, cl::sycl::queue &queue, float *d1, float *d2,
                       float *x1, float y1, float *param,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_srotmg_usm_sycl(queue, d1, d2, x1, y1, param,
-                                                                dependencies);
+    static stats::routine routine{ trace_site, "srotmg_usm", "" };
+    auto shape = verbose::make_dims();
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_srotmg_usm_sycl)(queue, d1, d2, x1, y1, param,
+                                                                   dependencies);
+    });
 }
 
 cl::sycl::event rotmg(oneapi::mkl::device libkey, cl::sycl::queue &queue, double *d1, double *d2,
                       double *x1, double y1, double *param,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_drotmg_usm_sycl(queue, d1, d2, x1, y1, param,
-                                                                dependencies);
+    static stats::routine routine{ trace_site, "drotmg_usm", "" };
+    auto shape = verbose::make_dims();
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_drotmg_usm_sycl)(queue, d1, d2, x1, y1, param,
+                                                                   dependencies);
+    });
 }
 
 cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      float alpha, float *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sscal_usm_sycl(queue, n, alpha, x, incx,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "sscal_usm", "n incx",
+                                   { stats::work::scal, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_sscal_usm_sycl)(queue, n, alpha, x, incx,
+                                                                  dependencies);
+    });
 }
 
 cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      double alpha, double *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dscal_usm_sycl(queue, n, alpha, x, incx,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "dscal_usm", "n incx",
+                                   { stats::work::scal, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dscal_usm_sycl)(queue, n, alpha, x, incx,
+                                                                  dependencies);
+    });
 }
 
 cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      std::complex<float> alpha, std::complex<float> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cscal_usm_sycl(queue, n, alpha, x, incx,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "cscal_usm", "n incx",
+                                   { stats::work::scal, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_cscal_usm_sycl)(queue, n, alpha, x, incx,
+                                                                  dependencies);
+    });
 }
 
 cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      std::complex<double> alpha, std::complex<double> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_csscal_usm_sycl(queue, n, alpha, x, incx,
-                                                                dependencies);
+    static stats::routine routine{ trace_site, "csscal_usm", "n incx",
+                                   { stats::work::scal, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_csscal_usm_sycl)(queue, n, alpha, x, incx,
+                                                                   dependencies);
+    });
 }
 
 cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      float alpha, std::complex<float> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zscal_usm_sycl(queue, n, alpha, x, incx,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "zscal_usm", "n incx",
+                                   { stats::work::scal, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zscal_usm_sycl)(queue, n, alpha, x, incx,
+                                                                  dependencies);
+    });
 }
 
 cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      double alpha, std::complex<double> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zdscal_usm_sycl(queue, n, alpha, x, incx,
-                                                                dependencies);
+    static stats::routine routine{ trace_site, "zdscal_usm", "n incx",
+                                   { stats::work::scal, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zdscal_usm_sycl)(queue, n, alpha, x, incx,
+                                                                   dependencies);
+    });
 }
 
 cl::sycl::event sdsdot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, float sb,
                        const float *x, std::int64_t incx, const float *y, std::int64_t incy,
                        float *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sdsdot_usm_sycl(queue, n, sb, x, incx, y, incy,
-                                                                result, dependencies);
+    static stats::routine routine{ trace_site, "sdsdot_usm", "n incx incy",
+                                   { stats::work::dot, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_sdsdot_usm_sycl)(queue, n, sb, x, incx, y, incy,
+                                                                   result, dependencies);
+    });
 }
 
 cl::sycl::event swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, float *x,
                      std::int64_t incx, float *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sswap_usm_sycl(queue, n, x, incx, y, incy,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "sswap_usm", "n incx incy",
+                                   { stats::work::swap, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_sswap_usm_sycl)(queue, n, x, incx, y, incy,
+                                                                  dependencies);
+    });
 }
 
 cl::sycl::event swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, double *x,
                      std::int64_t incx, double *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dswap_usm_sycl(queue, n, x, incx, y, incy,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "dswap_usm", "n incx incy",
+                                   { stats::work::swap, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dswap_usm_sycl)(queue, n, x, incx, y, incy,
+                                                                  dependencies);
+    });
 }
 
 cl::sycl::event swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      std::complex<float> *x, std::int64_t incx, std::complex<float> *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cswap_usm_sycl(queue, n, x, incx, y, incy,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "cswap_usm", "n incx incy",
+                                   { stats::work::swap, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_cswap_usm_sycl)(queue, n, x, incx, y, incy,
+                                                                  dependencies);
+    });
 }
 
 cl::sycl::event swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      std::complex<double> *x, std::int64_t incx, std::complex<double> *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zswap_usm_sycl(queue, n, x, incx, y, incy,
-                                                               dependencies);
+    static stats::routine routine{ trace_site, "zswap_usm", "n incx incy",
+                                   { stats::work::swap, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zswap_usm_sycl)(queue, n, x, incx, y, incy,
+                                                                  dependencies);
+    });
 }
 
 cl::sycl::event gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
@@ -1673,8 +2818,13 @@ cl::sycl::event gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      const float *a, std::int64_t lda, const float *x, std::int64_t incx,
                      float beta, float *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sgbmv_usm_sycl(
-        queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "sgbmv_usm", "trans m n kl ku lda incx incy",
+                                   { stats::work::gbmv, stats::f32 } };
+    auto shape = verbose::make_dims(trans, m, n, kl, ku, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_sgbmv_usm_sycl)(
+            queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
@@ -1682,8 +2832,13 @@ cl::sycl::event gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      const double *a, std::int64_t lda, const double *x, std::int64_t incx,
                      double beta, double *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dgbmv_usm_sycl(
-        queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "dgbmv_usm", "trans m n kl ku lda incx incy",
+                                   { stats::work::gbmv, stats::f64 } };
+    auto shape = verbose::make_dims(trans, m, n, kl, ku, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dgbmv_usm_sycl)(
+            queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
@@ -1692,8 +2847,13 @@ cl::sycl::event gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      const std::complex<float> *x, std::int64_t incx, std::complex<float> beta,
                      std::complex<float> *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cgbmv_usm_sycl(
-        queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "cgbmv_usm", "trans m n kl ku lda incx incy",
+                                   { stats::work::gbmv, stats::c32 } };
+    auto shape = verbose::make_dims(trans, m, n, kl, ku, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_cgbmv_usm_sycl)(
+            queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
@@ -1702,16 +2862,26 @@ cl::sycl::event gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      const std::complex<double> *x, std::int64_t incx, std::complex<double> beta,
                      std::complex<double> *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zgbmv_usm_sycl(
-        queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "zgbmv_usm", "trans m n kl ku lda incx incy",
+                                   { stats::work::gbmv, stats::c64 } };
+    auto shape = verbose::make_dims(trans, m, n, kl, ku, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zgbmv_usm_sycl)(
+            queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
                      std::int64_t m, std::int64_t n, float alpha, const float *a, std::int64_t lda,
                      const float *x, std::int64_t incx, float beta, float *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sgemv_usm_sycl(queue, trans, m, n, alpha, a, lda, x,
-                                                               incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "sgemv_usm", "trans m n lda incx incy",
+                                   { stats::work::gemv, stats::f32 } };
+    auto shape = verbose::make_dims(trans, m, n, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_sgemv_usm_sycl)(
+            queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
@@ -1719,8 +2889,13 @@ cl::sycl::event gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      std::int64_t lda, const double *x, std::int64_t incx, double beta, double *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dgemv_usm_sycl(queue, trans, m, n, alpha, a, lda, x,
-                                                               incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "dgemv_usm", "trans m n lda incx incy",
+                                   { stats::work::gemv, stats::f64 } };
+    auto shape = verbose::make_dims(trans, m, n, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dgemv_usm_sycl)(
+            queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
@@ -1729,8 +2904,13 @@ cl::sycl::event gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      std::int64_t incx, std::complex<float> beta, std::complex<float> *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cgemv_usm_sycl(queue, trans, m, n, alpha, a, lda, x,
-                                                               incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "cgemv_usm", "trans m n lda incx incy",
+                                   { stats::work::gemv, stats::c32 } };
+    auto shape = verbose::make_dims(trans, m, n, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_cgemv_usm_sycl)(
+            queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
@@ -1739,24 +2919,39 @@ cl::sycl::event gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      std::int64_t incx, std::complex<double> beta, std::complex<double> *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zgemv_usm_sycl(queue, trans, m, n, alpha, a, lda, x,
-                                                               incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "zgemv_usm", "trans m n lda incx incy",
+                                   { stats::work::gemv, stats::c64 } };
+    auto shape = verbose::make_dims(trans, m, n, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zgemv_usm_sycl)(
+            queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event ger(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m,
                     std::int64_t n, float alpha, const float *x, std::int64_t incx, const float *y,
                     std::int64_t incy, float *a, std::int64_t lda,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sger_usm_sycl(queue, m, n, alpha, x, incx, y, incy,
-                                                              a, lda, dependencies);
+    static stats::routine routine{ trace_site, "sger_usm", "m n incx incy lda",
+                                   { stats::work::ger, stats::f32 } };
+    auto shape = verbose::make_dims(m, n, incx, incy, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_sger_usm_sycl)(queue, m, n, alpha, x, incx, y,
+                                                                 incy, a, lda, dependencies);
+    });
 }
 
 cl::sycl::event ger(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m,
                     std::int64_t n, double alpha, const double *x, std::int64_t incx,
                     const double *y, std::int64_t incy, double *a, std::int64_t lda,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dger_usm_sycl(queue, m, n, alpha, x, incx, y, incy,
-                                                              a, lda, dependencies);
+    static stats::routine routine{ trace_site, "dger_usm", "m n incx incy lda",
+                                   { stats::work::ger, stats::f64 } };
+    auto shape = verbose::make_dims(m, n, incx, incy, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dger_usm_sycl)(queue, m, n, alpha, x, incx, y,
+                                                                 incy, a, lda, dependencies);
+    });
 }
 
 cl::sycl::event gerc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m,
@@ -1764,8 +2959,13 @@ cl::sycl::event gerc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::in
                      std::int64_t incx, const std::complex<float> *y, std::int64_t incy,
                      std::complex<float> *a, std::int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cgerc_usm_sycl(queue, m, n, alpha, x, incx, y, incy,
-                                                               a, lda, dependencies);
+    static stats::routine routine{ trace_site, "cgerc_usm", "m n incx incy lda",
+                                   { stats::work::ger, stats::c32 } };
+    auto shape = verbose::make_dims(m, n, incx, incy, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_cgerc_usm_sycl)(queue, m, n, alpha, x, incx, y,
+                                                                  incy, a, lda, dependencies);
+    });
 }
 
 cl::sycl::event gerc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m,
@@ -1773,8 +2973,13 @@ cl::sycl::event gerc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::in
                      std::int64_t incx, const std::complex<double> *y, std::int64_t incy,
                      std::complex<double> *a, std::int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zgerc_usm_sycl(queue, m, n, alpha, x, incx, y, incy,
-                                                               a, lda, dependencies);
+    static stats::routine routine{ trace_site, "zgerc_usm", "m n incx incy lda",
+                                   { stats::work::ger, stats::c64 } };
+    auto shape = verbose::make_dims(m, n, incx, incy, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zgerc_usm_sycl)(queue, m, n, alpha, x, incx, y,
+                                                                  incy, a, lda, dependencies);
+    });
 }
 
 cl::sycl::event geru(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m,
@@ -1782,8 +2987,13 @@ cl::sycl::event geru(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::in
                      std::int64_t incx, const std::complex<float> *y, std::int64_t incy,
                      std::complex<float> *a, std::int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cgeru_usm_sycl(queue, m, n, alpha, x, incx, y, incy,
-                                                               a, lda, dependencies);
+    static stats::routine routine{ trace_site, "cgeru_usm", "m n incx incy lda",
+                                   { stats::work::ger, stats::c32 } };
+    auto shape = verbose::make_dims(m, n, incx, incy, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_cgeru_usm_sycl)(queue, m, n, alpha, x, incx, y,
+                                                                  incy, a, lda, dependencies);
+    });
 }
 
 cl::sycl::event geru(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m,
@@ -1791,8 +3001,13 @@ cl::sycl::event geru(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::in
                      std::int64_t incx, const std::complex<double> *y, std::int64_t incy,
                      std::complex<double> *a, std::int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zgeru_usm_sycl(queue, m, n, alpha, x, incx, y, incy,
-                                                               a, lda, dependencies);
+    static stats::routine routine{ trace_site, "zgeru_usm", "m n incx incy lda",
+                                   { stats::work::ger, stats::c64 } };
+    auto shape = verbose::make_dims(m, n, incx, incy, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zgeru_usm_sycl)(queue, m, n, alpha, x, incx, y,
+                                                                  incy, a, lda, dependencies);
+    });
 }
 
 cl::sycl::event hbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -1801,8 +3016,13 @@ cl::sycl::event hbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t incx, std::complex<float> beta, std::complex<float> *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_chbmv_usm_sycl(
-        queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "chbmv_usm", "upper_lower n k lda incx incy",
+                                   { stats::work::sbmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, k, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_chbmv_usm_sycl)(
+            queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event hbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -1811,8 +3031,13 @@ cl::sycl::event hbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t incx, std::complex<double> beta, std::complex<double> *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zhbmv_usm_sycl(
-        queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "zhbmv_usm", "upper_lower n k lda incx incy",
+                                   { stats::work::sbmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, k, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zhbmv_usm_sycl)(
+            queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event hemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -1820,8 +3045,13 @@ cl::sycl::event hemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t lda, const std::complex<float> *x, std::int64_t incx,
                      std::complex<float> beta, std::complex<float> *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_chemv_usm_sycl(
-        queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "chemv_usm", "upper_lower n lda incx incy",
+                                   { stats::work::symv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_chemv_usm_sycl)(
+            queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event hemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -1829,24 +3059,39 @@ cl::sycl::event hemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t lda, const std::complex<double> *x, std::int64_t incx,
                      std::complex<double> beta, std::complex<double> *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zhemv_usm_sycl(
-        queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "zhemv_usm", "upper_lower n lda incx incy",
+                                   { stats::work::symv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zhemv_usm_sycl)(
+            queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event her(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                     std::int64_t n, float alpha, const std::complex<float> *x, std::int64_t incx,
                     std::complex<float> *a, std::int64_t lda,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cher_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                              a, lda, dependencies);
+    static stats::routine routine{ trace_site, "cher_usm", "upper_lower n incx lda",
+                                   { stats::work::syr, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_cher_usm_sycl)(queue, upper_lower, n, alpha, x,
+                                                                 incx, a, lda, dependencies);
+    });
 }
 
 cl::sycl::event her(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                     std::int64_t n, double alpha, const std::complex<double> *x, std::int64_t incx,
                     std::complex<double> *a, std::int64_t lda,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zher_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                              a, lda, dependencies);
+    static stats::routine routine{ trace_site, "zher_usm", "upper_lower n incx lda",
+                                   { stats::work::syr, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zher_usm_sycl)(queue, upper_lower, n, alpha, x,
+                                                                 incx, a, lda, dependencies);
+    });
 }
 
 cl::sycl::event her2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -1854,8 +3099,13 @@ cl::sycl::event her2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t incx, const std::complex<float> *y, std::int64_t incy,
                      std::complex<float> *a, std::int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cher2_usm_sycl(queue, upper_lower, n, alpha, x,
-                                                               incx, y, incy, a, lda, dependencies);
+    static stats::routine routine{ trace_site, "cher2_usm", "upper_lower n incx incy lda",
+                                   { stats::work::syr2, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_cher2_usm_sycl)(
+            queue, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
+    });
 }
 
 cl::sycl::event her2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -1863,8 +3113,13 @@ cl::sycl::event her2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t incx, const std::complex<double> *y, std::int64_t incy,
                      std::complex<double> *a, std::int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zher2_usm_sycl(queue, upper_lower, n, alpha, x,
-                                                               incx, y, incy, a, lda, dependencies);
+    static stats::routine routine{ trace_site, "zher2_usm", "upper_lower n incx incy lda",
+                                   { stats::work::syr2, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zher2_usm_sycl)(
+            queue, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
+    });
 }
 
 cl::sycl::event hpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -1872,8 +3127,13 @@ cl::sycl::event hpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<float> *x, std::int64_t incx, std::complex<float> beta,
                      std::complex<float> *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_chpmv_usm_sycl(queue, upper_lower, n, alpha, a, x,
-                                                               incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "chpmv_usm", "upper_lower n incx incy",
+                                   { stats::work::symv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_chpmv_usm_sycl)(
+            queue, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event hpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -1881,24 +3141,39 @@ cl::sycl::event hpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<double> *x, std::int64_t incx, std::complex<double> beta,
                      std::complex<double> *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zhpmv_usm_sycl(queue, upper_lower, n, alpha, a, x,
-                                                               incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "zhpmv_usm", "upper_lower n incx incy",
+                                   { stats::work::symv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zhpmv_usm_sycl)(
+            queue, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event hpr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                     std::int64_t n, float alpha, const std::complex<float> *x, std::int64_t incx,
                     std::complex<float> *a,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_chpr_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                              a, dependencies);
+    static stats::routine routine{ trace_site, "chpr_usm", "upper_lower n incx",
+                                   { stats::work::syr, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_chpr_usm_sycl)(queue, upper_lower, n, alpha, x,
+                                                                 incx, a, dependencies);
+    });
 }
 
 cl::sycl::event hpr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                     std::int64_t n, double alpha, const std::complex<double> *x, std::int64_t incx,
                     std::complex<double> *a,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zhpr_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                              a, dependencies);
+    static stats::routine routine{ trace_site, "zhpr_usm", "upper_lower n incx",
+                                   { stats::work::syr, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zhpr_usm_sycl)(queue, upper_lower, n, alpha, x,
+                                                                 incx, a, dependencies);
+    });
 }
 
 cl::sycl::event hpr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -1906,8 +3181,13 @@ cl::sycl::event hpr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t incx, const std::complex<float> *y, std::int64_t incy,
                      std::complex<float> *a,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_chpr2_usm_sycl(queue, upper_lower, n, alpha, x,
-                                                               incx, y, incy, a, dependencies);
+    static stats::routine routine{ trace_site, "chpr2_usm", "upper_lower n incx incy",
+                                   { stats::work::syr2, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_chpr2_usm_sycl)(queue, upper_lower, n, alpha, x,
+                                                                  incx, y, incy, a, dependencies);
+    });
 }
 
 cl::sycl::event hpr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -1915,16 +3195,26 @@ cl::sycl::event hpr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t incx, const std::complex<double> *y, std::int64_t incy,
                      std::complex<double> *a,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zhpr2_usm_sycl(queue, upper_lower, n, alpha, x,
-                                                               incx, y, incy, a, dependencies);
+    static stats::routine routine{ trace_site, "zhpr2_usm", "upper_lower n incx incy",
+                                   { stats::work::syr2, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zhpr2_usm_sycl)(queue, upper_lower, n, alpha, x,
+                                                                  incx, y, incy, a, dependencies);
+    });
 }
 
 cl::sycl::event sbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda,
                      const float *x, std::int64_t incx, float beta, float *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ssbmv_usm_sycl(
-        queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "ssbmv_usm", "upper_lower n k lda incx incy",
+                                   { stats::work::sbmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, k, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_ssbmv_usm_sycl)(
+            queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event sbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -1932,116 +3222,193 @@ cl::sycl::event sbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t lda, const double *x, std::int64_t incx, double beta, double *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dsbmv_usm_sycl(
-        queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "dsbmv_usm", "upper_lower n k lda incx incy",
+                                   { stats::work::sbmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, k, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dsbmv_usm_sycl)(
+            queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event spmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      std::int64_t n, float alpha, const float *a, const float *x, std::int64_t incx,
                      float beta, float *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sspmv_usm_sycl(queue, upper_lower, n, alpha, a, x,
-                                                               incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "sspmv_usm", "upper_lower n incx incy",
+                                   { stats::work::symv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_sspmv_usm_sycl)(
+            queue, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event spmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      std::int64_t n, double alpha, const double *a, const double *x,
                      std::int64_t incx, double beta, double *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dspmv_usm_sycl(queue, upper_lower, n, alpha, a, x,
-                                                               incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "dspmv_usm", "upper_lower n incx incy",
+                                   { stats::work::symv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dspmv_usm_sycl)(
+            queue, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event spr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                     std::int64_t n, float alpha, const float *x, std::int64_t incx, float *a,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sspr_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                              a, dependencies);
+    static stats::routine routine{ trace_site, "sspr_usm", "upper_lower n incx",
+                                   { stats::work::syr, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_sspr_usm_sycl)(queue, upper_lower, n, alpha, x,
+                                                                 incx, a, dependencies);
+    });
 }
 
 cl::sycl::event spr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                     std::int64_t n, double alpha, const double *x, std::int64_t incx, double *a,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dspr_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                              a, dependencies);
+    static stats::routine routine{ trace_site, "dspr_usm", "upper_lower n incx",
+                                   { stats::work::syr, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dspr_usm_sycl)(queue, upper_lower, n, alpha, x,
+                                                                 incx, a, dependencies);
+    });
 }
 
 cl::sycl::event spr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      std::int64_t n, float alpha, const float *x, std::int64_t incx, const float *y,
                      std::int64_t incy, float *a,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sspr2_usm_sycl(queue, upper_lower, n, alpha, x,
-                                                               incx, y, incy, a, dependencies);
+    static stats::routine routine{ trace_site, "sspr2_usm", "upper_lower n incx incy",
+                                   { stats::work::syr2, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_sspr2_usm_sycl)(queue, upper_lower, n, alpha, x,
+                                                                  incx, y, incy, a, dependencies);
+    });
 }
 
 cl::sycl::event spr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      std::int64_t n, double alpha, const double *x, std::int64_t incx,
                      const double *y, std::int64_t incy, double *a,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dspr2_usm_sycl(queue, upper_lower, n, alpha, x,
-                                                               incx, y, incy, a, dependencies);
+    static stats::routine routine{ trace_site, "dspr2_usm", "upper_lower n incx incy",
+                                   { stats::work::syr2, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dspr2_usm_sycl)(queue, upper_lower, n, alpha, x,
+                                                                  incx, y, incy, a, dependencies);
+    });
 }
 
 cl::sycl::event symv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      std::int64_t n, float alpha, const float *a, std::int64_t lda, const float *x,
                      std::int64_t incx, float beta, float *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ssymv_usm_sycl(
-        queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "ssymv_usm", "upper_lower n lda incx incy",
+                                   { stats::work::symv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_ssymv_usm_sycl)(
+            queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event symv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      std::int64_t n, double alpha, const double *a, std::int64_t lda,
                      const double *x, std::int64_t incx, double beta, double *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dsymv_usm_sycl(
-        queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "dsymv_usm", "upper_lower n lda incx incy",
+                                   { stats::work::symv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dsymv_usm_sycl)(
+            queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event syr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                     std::int64_t n, float alpha, const float *x, std::int64_t incx, float *a,
                     std::int64_t lda, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ssyr_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                              a, lda, dependencies);
+    static stats::routine routine{ trace_site, "ssyr_usm", "upper_lower n incx lda",
+                                   { stats::work::syr, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_ssyr_usm_sycl)(queue, upper_lower, n, alpha, x,
+                                                                 incx, a, lda, dependencies);
+    });
 }
 
 cl::sycl::event syr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                     std::int64_t n, double alpha, const double *x, std::int64_t incx, double *a,
                     std::int64_t lda, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dsyr_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                              a, lda, dependencies);
+    static stats::routine routine{ trace_site, "dsyr_usm", "upper_lower n incx lda",
+                                   { stats::work::syr, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dsyr_usm_sycl)(queue, upper_lower, n, alpha, x,
+                                                                 incx, a, lda, dependencies);
+    });
 }
 
 cl::sycl::event syr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      std::int64_t n, float alpha, const float *x, std::int64_t incx, const float *y,
                      std::int64_t incy, float *a, std::int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ssyr2_usm_sycl(queue, upper_lower, n, alpha, x,
-                                                               incx, y, incy, a, lda, dependencies);
+    static stats::routine routine{ trace_site, "ssyr2_usm", "upper_lower n incx incy lda",
+                                   { stats::work::syr2, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_ssyr2_usm_sycl)(
+            queue, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
+    });
 }
 
 cl::sycl::event syr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      std::int64_t n, double alpha, const double *x, std::int64_t incx,
                      const double *y, std::int64_t incy, double *a, std::int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dsyr2_usm_sycl(queue, upper_lower, n, alpha, x,
-                                                               incx, y, incy, a, lda, dependencies);
+    static stats::routine routine{ trace_site, "dsyr2_usm", "upper_lower n incx incy lda",
+                                   { stats::work::syr2, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dsyr2_usm_sycl)(
+            queue, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
+    });
 }
 
 cl::sycl::event tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
                      const float *a, std::int64_t lda, float *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_stbmv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, k, a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "stbmv_usm",
+                                   "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_stbmv_usm_sycl)(
+            queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
                      const double *a, std::int64_t lda, double *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dtbmv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, k, a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "dtbmv_usm",
+                                   "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dtbmv_usm_sycl)(
+            queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -2049,8 +3416,14 @@ cl::sycl::event tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<float> *a, std::int64_t lda, std::complex<float> *x,
                      std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ctbmv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, k, a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "ctbmv_usm",
+                                   "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_ctbmv_usm_sycl)(
+            queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -2058,24 +3431,42 @@ cl::sycl::event tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<double> *a, std::int64_t lda, std::complex<double> *x,
                      std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ztbmv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, k, a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "ztbmv_usm",
+                                   "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_ztbmv_usm_sycl)(
+            queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
                      const float *a, std::int64_t lda, float *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_stbsv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, k, a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "stbsv_usm",
+                                   "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_stbsv_usm_sycl)(
+            queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
                      const double *a, std::int64_t lda, double *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dtbsv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, k, a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "dtbsv_usm",
+                                   "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dtbsv_usm_sycl)(
+            queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -2083,8 +3474,14 @@ cl::sycl::event tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<float> *a, std::int64_t lda, std::complex<float> *x,
                      std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ctbsv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, k, a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "ctbsv_usm",
+                                   "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_ctbsv_usm_sycl)(
+            queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -2092,136 +3489,230 @@ cl::sycl::event tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<double> *a, std::int64_t lda, std::complex<double> *x,
                      std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ztbsv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, k, a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "ztbsv_usm",
+                                   "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_ztbsv_usm_sycl)(
+            queue, upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const float *a, float *x,
                      std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_stpmv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "stpmv_usm", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_stpmv_usm_sycl)(
+            queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const double *a, double *x,
                      std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dtpmv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "dtpmv_usm", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dtpmv_usm_sycl)(
+            queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const std::complex<float> *a,
                      std::complex<float> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ctpmv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "ctpmv_usm", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_ctpmv_usm_sycl)(
+            queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const std::complex<double> *a,
                      std::complex<double> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ztpmv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "ztpmv_usm", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_ztpmv_usm_sycl)(
+            queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const float *a, float *x,
                      std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_stpsv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "stpsv_usm", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_stpsv_usm_sycl)(
+            queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const double *a, double *x,
                      std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dtpsv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "dtpsv_usm", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dtpsv_usm_sycl)(
+            queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const std::complex<float> *a,
                      std::complex<float> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ctpsv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "ctpsv_usm", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_ctpsv_usm_sycl)(
+            queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const std::complex<double> *a,
                      std::complex<double> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ztpsv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "ztpsv_usm", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_ztpsv_usm_sycl)(
+            queue, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const float *a,
                      std::int64_t lda, float *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_strmv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "strmv_usm",
+                                   "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_strmv_usm_sycl)(
+            queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const double *a,
                      std::int64_t lda, double *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dtrmv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "dtrmv_usm",
+                                   "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dtrmv_usm_sycl)(
+            queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const std::complex<float> *a,
                      std::int64_t lda, std::complex<float> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ctrmv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "ctrmv_usm",
+                                   "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_ctrmv_usm_sycl)(
+            queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const std::complex<double> *a,
                      std::int64_t lda, std::complex<double> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ztrmv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "ztrmv_usm",
+                                   "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_ztrmv_usm_sycl)(
+            queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const float *a,
                      std::int64_t lda, float *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_strsv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "strsv_usm",
+                                   "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_strsv_usm_sycl)(
+            queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const double *a,
                      std::int64_t lda, double *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dtrsv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "dtrsv_usm",
+                                   "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dtrsv_usm_sycl)(
+            queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const std::complex<float> *a,
                      std::int64_t lda, std::complex<float> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ctrsv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "ctrsv_usm",
+                                   "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_ctrsv_usm_sycl)(
+            queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const std::complex<double> *a,
                      std::int64_t lda, std::complex<double> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ztrsv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "ztrsv_usm",
+                                   "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_ztrsv_usm_sycl)(
+            queue, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
@@ -2229,8 +3720,13 @@ cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      const float *a, std::int64_t lda, const float *b, std::int64_t ldb, float beta,
                      float *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "sgemm_usm", "transa transb m n k lda ldb ldc",
+                                   { stats::work::gemm, stats::f32 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_sgemm_usm_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
@@ -2238,8 +3734,13 @@ cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      const double *a, std::int64_t lda, const double *b, std::int64_t ldb,
                      double beta, double *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "dgemm_usm", "transa transb m n k lda ldb ldc",
+                                   { stats::work::gemm, stats::f64 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dgemm_usm_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
@@ -2248,8 +3749,13 @@ cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
                      std::complex<float> *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "cgemm_usm", "transa transb m n k lda ldb ldc",
+                                   { stats::work::gemm, stats::c32 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_cgemm_usm_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
@@ -2258,8 +3764,13 @@ cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
                      std::complex<double> *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "zgemm_usm", "transa transb m n k lda ldb ldc",
+                                   { stats::work::gemm, stats::c64 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zgemm_usm_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event hemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -2268,8 +3779,15 @@ cl::sycl::event hemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
                      std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_chemm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "chemm_usm",
+                                   "left_right upper_lower m n lda ldb ldc",
+                                   { stats::work::symm, stats::c32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, m, n, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_chemm_usm_sycl)(queue, left_right, upper_lower, m,
+                                                                  n, alpha, a, lda, b, ldb, beta, c,
+                                                                  ldc, dependencies);
+    });
 }
 
 cl::sycl::event hemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -2278,8 +3796,15 @@ cl::sycl::event hemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t ldb, std::complex<double> beta, std::complex<double> *c,
                      std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zhemm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "zhemm_usm",
+                                   "left_right upper_lower m n lda ldb ldc",
+                                   { stats::work::symm, stats::c64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, m, n, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zhemm_usm_sycl)(queue, left_right, upper_lower, m,
+                                                                  n, alpha, a, lda, b, ldb, beta, c,
+                                                                  ldc, dependencies);
+    });
 }
 
 cl::sycl::event herk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -2287,8 +3812,13 @@ cl::sycl::event herk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<float> *a, std::int64_t lda, float beta,
                      std::complex<float> *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cherk_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "cherk_usm", "upper_lower trans n k lda ldc",
+                                   { stats::work::syrk, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_cherk_usm_sycl)(
+            queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event herk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -2296,8 +3826,13 @@ cl::sycl::event herk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<double> *a, std::int64_t lda, double beta,
                      std::complex<double> *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zherk_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "zherk_usm", "upper_lower trans n k lda ldc",
+                                   { stats::work::syrk, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zherk_usm_sycl)(
+            queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event her2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -2305,8 +3840,13 @@ cl::sycl::event her2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
                       std::int64_t ldb, float beta, std::complex<float> *c, std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cher2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "cher2k_usm", "upper_lower trans n k lda ldb ldc",
+                                   { stats::work::syr2k, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_cher2k_usm_sycl)(
+            queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event her2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -2315,8 +3855,13 @@ cl::sycl::event her2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       const std::complex<double> *b, std::int64_t ldb, double beta,
                       std::complex<double> *c, std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zher2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "zher2k_usm", "upper_lower trans n k lda ldb ldc",
+                                   { stats::work::syr2k, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zher2k_usm_sycl)(
+            queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -2324,8 +3869,15 @@ cl::sycl::event symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t lda, const float *b, std::int64_t ldb, float beta, float *c,
                      std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ssymm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "ssymm_usm",
+                                   "left_right upper_lower m n lda ldb ldc",
+                                   { stats::work::symm, stats::f32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, m, n, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_ssymm_usm_sycl)(queue, left_right, upper_lower, m,
+                                                                  n, alpha, a, lda, b, ldb, beta, c,
+                                                                  ldc, dependencies);
+    });
 }
 
 cl::sycl::event symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -2333,8 +3885,15 @@ cl::sycl::event symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      const double *a, std::int64_t lda, const double *b, std::int64_t ldb,
                      double beta, double *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dsymm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "dsymm_usm",
+                                   "left_right upper_lower m n lda ldb ldc",
+                                   { stats::work::symm, stats::f64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, m, n, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dsymm_usm_sycl)(queue, left_right, upper_lower, m,
+                                                                  n, alpha, a, lda, b, ldb, beta, c,
+                                                                  ldc, dependencies);
+    });
 }
 
 cl::sycl::event symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -2343,8 +3902,15 @@ cl::sycl::event symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
                      std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_csymm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "csymm_usm",
+                                   "left_right upper_lower m n lda ldb ldc",
+                                   { stats::work::symm, stats::c32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, m, n, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_csymm_usm_sycl)(queue, left_right, upper_lower, m,
+                                                                  n, alpha, a, lda, b, ldb, beta, c,
+                                                                  ldc, dependencies);
+    });
 }
 
 cl::sycl::event symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -2353,24 +3919,41 @@ cl::sycl::event symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t ldb, std::complex<double> beta, std::complex<double> *c,
                      std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zsymm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "zsymm_usm",
+                                   "left_right upper_lower m n lda ldb ldc",
+                                   { stats::work::symm, stats::c64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, m, n, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zsymm_usm_sycl)(queue, left_right, upper_lower, m,
+                                                                  n, alpha, a, lda, b, ldb, beta, c,
+                                                                  ldc, dependencies);
+    });
 }
 
 cl::sycl::event syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, std::int64_t n, std::int64_t k, float alpha, const float *a,
                      std::int64_t lda, float beta, float *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ssyrk_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "ssyrk_usm", "upper_lower trans n k lda ldc",
+                                   { stats::work::syrk, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_ssyrk_usm_sycl)(
+            queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, std::int64_t n, std::int64_t k, double alpha, const double *a,
                      std::int64_t lda, double beta, double *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dsyrk_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "dsyrk_usm", "upper_lower trans n k lda ldc",
+                                   { stats::work::syrk, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dsyrk_usm_sycl)(
+            queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -2378,8 +3961,13 @@ cl::sycl::event syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<float> *a, std::int64_t lda, std::complex<float> beta,
                      std::complex<float> *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_csyrk_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "csyrk_usm", "upper_lower trans n k lda ldc",
+                                   { stats::work::syrk, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_csyrk_usm_sycl)(
+            queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -2387,8 +3975,13 @@ cl::sycl::event syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<double> *a, std::int64_t lda, std::complex<double> beta,
                      std::complex<double> *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zsyrk_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "zsyrk_usm", "upper_lower trans n k lda ldc",
+                                   { stats::work::syrk, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zsyrk_usm_sycl)(
+            queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -2396,8 +3989,13 @@ cl::sycl::event syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       std::int64_t lda, const float *b, std::int64_t ldb, float beta, float *c,
                       std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ssyr2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "ssyr2k_usm", "upper_lower trans n k lda ldb ldc",
+                                   { stats::work::syr2k, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_ssyr2k_usm_sycl)(
+            queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -2405,8 +4003,13 @@ cl::sycl::event syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       const double *a, std::int64_t lda, const double *b, std::int64_t ldb,
                       double beta, double *c, std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dsyr2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "dsyr2k_usm", "upper_lower trans n k lda ldb ldc",
+                                   { stats::work::syr2k, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dsyr2k_usm_sycl)(
+            queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -2415,8 +4018,13 @@ cl::sycl::event syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
                       std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_csyr2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "csyr2k_usm", "upper_lower trans n k lda ldb ldc",
+                                   { stats::work::syr2k, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_csyr2k_usm_sycl)(
+            queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -2425,8 +4033,13 @@ cl::sycl::event syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
                       std::complex<double> *c, std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zsyr2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "zsyr2k_usm", "upper_lower trans n k lda ldb ldc",
+                                   { stats::work::syr2k, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zsyr2k_usm_sycl)(
+            queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -2434,9 +4047,15 @@ cl::sycl::event trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t n, float alpha, const float *a, std::int64_t lda, float *b,
                      std::int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_strmm_usm_sycl(queue, left_right, upper_lower,
-                                                               trans, unit_diag, m, n, alpha, a,
-                                                               lda, b, ldb, dependencies);
+    static stats::routine routine{ trace_site, "strmm_usm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::f32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_strmm_usm_sycl)(queue, left_right, upper_lower,
+                                                                  trans, unit_diag, m, n, alpha, a,
+                                                                  lda, b, ldb, dependencies);
+    });
 }
 
 cl::sycl::event trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -2444,9 +4063,15 @@ cl::sycl::event trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t n, double alpha, const double *a, std::int64_t lda, double *b,
                      std::int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dtrmm_usm_sycl(queue, left_right, upper_lower,
-                                                               trans, unit_diag, m, n, alpha, a,
-                                                               lda, b, ldb, dependencies);
+    static stats::routine routine{ trace_site, "dtrmm_usm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::f64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dtrmm_usm_sycl)(queue, left_right, upper_lower,
+                                                                  trans, unit_diag, m, n, alpha, a,
+                                                                  lda, b, ldb, dependencies);
+    });
 }
 
 cl::sycl::event trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -2454,9 +4079,15 @@ cl::sycl::event trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t n, std::complex<float> alpha, const std::complex<float> *a,
                      std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ctrmm_usm_sycl(queue, left_right, upper_lower,
-                                                               trans, unit_diag, m, n, alpha, a,
-                                                               lda, b, ldb, dependencies);
+    static stats::routine routine{ trace_site, "ctrmm_usm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::c32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_ctrmm_usm_sycl)(queue, left_right, upper_lower,
+                                                                  trans, unit_diag, m, n, alpha, a,
+                                                                  lda, b, ldb, dependencies);
+    });
 }
 
 cl::sycl::event trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -2464,9 +4095,15 @@ cl::sycl::event trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t n, std::complex<double> alpha, const std::complex<double> *a,
                      std::int64_t lda, std::complex<double> *b, std::int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ztrmm_usm_sycl(queue, left_right, upper_lower,
-                                                               trans, unit_diag, m, n, alpha, a,
-                                                               lda, b, ldb, dependencies);
+    static stats::routine routine{ trace_site, "ztrmm_usm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::c64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_ztrmm_usm_sycl)(queue, left_right, upper_lower,
+                                                                  trans, unit_diag, m, n, alpha, a,
+                                                                  lda, b, ldb, dependencies);
+    });
 }
 
 cl::sycl::event trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -2474,9 +4111,15 @@ cl::sycl::event trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t n, float alpha, const float *a, std::int64_t lda, float *b,
                      std::int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_strsm_usm_sycl(queue, left_right, upper_lower,
-                                                               trans, unit_diag, m, n, alpha, a,
-                                                               lda, b, ldb, dependencies);
+    static stats::routine routine{ trace_site, "strsm_usm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::f32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_strsm_usm_sycl)(queue, left_right, upper_lower,
+                                                                  trans, unit_diag, m, n, alpha, a,
+                                                                  lda, b, ldb, dependencies);
+    });
 }
 
 cl::sycl::event trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -2484,9 +4127,15 @@ cl::sycl::event trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t n, double alpha, const double *a, std::int64_t lda, double *b,
                      std::int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dtrsm_usm_sycl(queue, left_right, upper_lower,
-                                                               trans, unit_diag, m, n, alpha, a,
-                                                               lda, b, ldb, dependencies);
+    static stats::routine routine{ trace_site, "dtrsm_usm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::f64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dtrsm_usm_sycl)(queue, left_right, upper_lower,
+                                                                  trans, unit_diag, m, n, alpha, a,
+                                                                  lda, b, ldb, dependencies);
+    });
 }
 
 cl::sycl::event trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -2494,9 +4143,15 @@ cl::sycl::event trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t n, std::complex<float> alpha, const std::complex<float> *a,
                      std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ctrsm_usm_sycl(queue, left_right, upper_lower,
-                                                               trans, unit_diag, m, n, alpha, a,
-                                                               lda, b, ldb, dependencies);
+    static stats::routine routine{ trace_site, "ctrsm_usm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::c32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_ctrsm_usm_sycl)(queue, left_right, upper_lower,
+                                                                  trans, unit_diag, m, n, alpha, a,
+                                                                  lda, b, ldb, dependencies);
+    });
 }
 
 cl::sycl::event trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -2504,9 +4159,15 @@ cl::sycl::event trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t n, std::complex<double> alpha, const std::complex<double> *a,
                      std::int64_t lda, std::complex<double> *b, std::int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ztrsm_usm_sycl(queue, left_right, upper_lower,
-                                                               trans, unit_diag, m, n, alpha, a,
-                                                               lda, b, ldb, dependencies);
+    static stats::routine routine{ trace_site, "ztrsm_usm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::c64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_ztrsm_usm_sycl)(queue, left_right, upper_lower,
+                                                                  trans, unit_diag, m, n, alpha, a,
+                                                                  lda, b, ldb, dependencies);
+    });
 }
 
 cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose *transa,
@@ -2515,9 +4176,14 @@ cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, t
                            std::int64_t *ldb, float *beta, float **c, std::int64_t *ldc,
                            std::int64_t group_count, std::int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    static stats::routine routine{ trace_site, "sgemm_batch_group_usm", "group_count",
+                                   { stats::work::gemm, stats::f32 } };
+    auto shape = verbose::make_dims(group_count);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_sgemm_batch_group_usm_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
+            group_size, dependencies);
+    });
 }
 
 cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose *transa,
@@ -2526,9 +4192,14 @@ cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, t
                            std::int64_t *ldb, double *beta, double **c, std::int64_t *ldc,
                            std::int64_t group_count, std::int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    static stats::routine routine{ trace_site, "dgemm_batch_group_usm", "group_count",
+                                   { stats::work::gemm, stats::f64 } };
+    auto shape = verbose::make_dims(group_count);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dgemm_batch_group_usm_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
+            group_size, dependencies);
+    });
 }
 
 cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose *transa,
@@ -2538,9 +4209,14 @@ cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, t
                            std::complex<float> *beta, std::complex<float> **c, std::int64_t *ldc,
                            std::int64_t group_count, std::int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    static stats::routine routine{ trace_site, "cgemm_batch_group_usm", "group_count",
+                                   { stats::work::gemm, stats::c32 } };
+    auto shape = verbose::make_dims(group_count);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_cgemm_batch_group_usm_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
+            group_size, dependencies);
+    });
 }
 
 cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose *transa,
@@ -2550,9 +4226,14 @@ cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, t
                            std::complex<double> *beta, std::complex<double> **c, std::int64_t *ldc,
                            std::int64_t group_count, std::int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    static stats::routine routine{ trace_site, "zgemm_batch_group_usm", "group_count",
+                                   { stats::work::gemm, stats::c64 } };
+    auto shape = verbose::make_dims(group_count);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zgemm_batch_group_usm_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
+            group_size, dependencies);
+    });
 }
 
 cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
@@ -2562,9 +4243,16 @@ cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, t
                            float *c, std::int64_t ldc, std::int64_t stride_c,
                            std::int64_t batch_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    static stats::routine routine{ trace_site, "sgemm_batch_strided_usm",
+        "transa transb m n k lda stride_a ldb stride_b ldc stride_c batch_size",
+        { stats::work::gemm, stats::f32 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, stride_a, ldb, stride_b, ldc,
+                                    stride_c, batch_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_sgemm_batch_strided_usm_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+            stride_c, batch_size, dependencies);
+    });
 }
 
 cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
@@ -2574,9 +4262,16 @@ cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, t
                            double *c, std::int64_t ldc, std::int64_t stride_c,
                            std::int64_t batch_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    static stats::routine routine{ trace_site, "dgemm_batch_strided_usm",
+        "transa transb m n k lda stride_a ldb stride_b ldc stride_c batch_size",
+        { stats::work::gemm, stats::f64 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, stride_a, ldb, stride_b, ldc,
+                                    stride_c, batch_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dgemm_batch_strided_usm_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+            stride_c, batch_size, dependencies);
+    });
 }
 
 cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
@@ -2587,9 +4282,16 @@ cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, t
                            std::complex<float> *c, std::int64_t ldc, std::int64_t stride_c,
                            std::int64_t batch_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    static stats::routine routine{ trace_site, "cgemm_batch_strided_usm",
+        "transa transb m n k lda stride_a ldb stride_b ldc stride_c batch_size",
+        { stats::work::gemm, stats::c32 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, stride_a, ldb, stride_b, ldc,
+                                    stride_c, batch_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_cgemm_batch_strided_usm_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+            stride_c, batch_size, dependencies);
+    });
 }
 
 cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
@@ -2600,9 +4302,16 @@ cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, t
                            std::complex<double> *c, std::int64_t ldc, std::int64_t stride_c,
                            std::int64_t batch_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    static stats::routine routine{ trace_site, "zgemm_batch_strided_usm",
+        "transa transb m n k lda stride_a ldb stride_b ldc stride_c batch_size",
+        { stats::work::gemm, stats::c64 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, stride_a, ldb, stride_b, ldc,
+                                    stride_c, batch_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zgemm_batch_strided_usm_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+            stride_c, batch_size, dependencies);
+    });
 }
 
 cl::sycl::event gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -2610,9 +4319,15 @@ cl::sycl::event gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       float alpha, const float *a, std::int64_t lda, const float *b,
                       std::int64_t ldb, float beta, float *c, std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sgemmt_usm_sycl(queue, upper_lower, transa, transb,
-                                                                n, k, alpha, a, lda, b, ldb, beta,
-                                                                c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "sgemmt_usm",
+                                   "upper_lower transa transb n k lda ldb ldc",
+                                   { stats::work::gemmt, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, transa, transb, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_sgemmt_usm_sycl)(queue, upper_lower, transa,
+                                                                   transb, n, k, alpha, a, lda, b,
+                                                                   ldb, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -2620,9 +4335,15 @@ cl::sycl::event gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       double alpha, const double *a, std::int64_t lda, const double *b,
                       std::int64_t ldb, double beta, double *c, std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dgemmt_usm_sycl(queue, upper_lower, transa, transb,
-                                                                n, k, alpha, a, lda, b, ldb, beta,
-                                                                c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "dgemmt_usm",
+                                   "upper_lower transa transb n k lda ldb ldc",
+                                   { stats::work::gemmt, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, transa, transb, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_dgemmt_usm_sycl)(queue, upper_lower, transa,
+                                                                   transb, n, k, alpha, a, lda, b,
+                                                                   ldb, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -2631,9 +4352,15 @@ cl::sycl::event gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
                       std::complex<float> *c, std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cgemmt_usm_sycl(queue, upper_lower, transa, transb,
-                                                                n, k, alpha, a, lda, b, ldb, beta,
-                                                                c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "cgemmt_usm",
+                                   "upper_lower transa transb n k lda ldb ldc",
+                                   { stats::work::gemmt, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, transa, transb, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_cgemmt_usm_sycl)(queue, upper_lower, transa,
+                                                                   transb, n, k, alpha, a, lda, b,
+                                                                   ldb, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -2642,9 +4369,15 @@ cl::sycl::event gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
                       std::complex<double> *c, std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zgemmt_usm_sycl(queue, upper_lower, transa, transb,
-                                                                n, k, alpha, a, lda, b, ldb, beta,
-                                                                c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "zgemmt_usm",
+                                   "upper_lower transa transb n k lda ldb ldc",
+                                   { stats::work::gemmt, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, transa, transb, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.column_major_zgemmt_usm_sycl)(queue, upper_lower, transa,
+                                                                   transb, n, k, alpha, a, lda, b,
+                                                                   ldb, beta, c, ldc, dependencies);
+    });
 }
 
 } //namespace detail
@@ -2654,343 +4387,621 @@ namespace detail {
 
 static oneapi::mkl::detail::table_initializer<domain::blas, blas_function_table_t> function_tables;
 
+namespace verbose = oneapi::mkl::detail::verbose;
+namespace stats = oneapi::mkl::detail::stats;
+static constexpr verbose::site trace_site{ domain::blas, "row_major" };
+
 // Buffer APIs
 
 void asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<float, 1> &result) {
-    function_tables[libkey].row_major_scasum_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "scasum", "n incx",
+                                   { stats::work::asum, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_scasum_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<double, 1> &result) {
-    function_tables[libkey].row_major_dzasum_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "dzasum", "n incx",
+                                   { stats::work::asum, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dzasum_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &result) {
-    function_tables[libkey].row_major_sasum_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "sasum", "n incx",
+                                   { stats::work::asum, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_sasum_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &result) {
-    function_tables[libkey].row_major_dasum_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "dasum", "n incx",
+                                   { stats::work::asum, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dasum_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, float alpha,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].row_major_saxpy_sycl(queue, n, alpha, x, incx, y, incy);
+    static stats::routine routine{ trace_site, "saxpy", "n incx incy",
+                                   { stats::work::axpy, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_saxpy_sycl)(queue, n, alpha, x, incx, y, incy);
+    });
 }
 
 void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, double alpha,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].row_major_daxpy_sycl(queue, n, alpha, x, incx, y, incy);
+    static stats::routine routine{ trace_site, "daxpy", "n incx incy",
+                                   { stats::work::axpy, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_daxpy_sycl)(queue, n, alpha, x, incx, y, incy);
+    });
 }
 
 void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_caxpy_sycl(queue, n, alpha, x, incx, y, incy);
+    static stats::routine routine{ trace_site, "caxpy", "n incx incy",
+                                   { stats::work::axpy, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_caxpy_sycl)(queue, n, alpha, x, incx, y, incy);
+    });
 }
 
 void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
           std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_zaxpy_sycl(queue, n, alpha, x, incx, y, incy);
+    static stats::routine routine{ trace_site, "zaxpy", "n incx incy",
+                                   { stats::work::axpy, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zaxpy_sycl)(queue, n, alpha, x, incx, y, incy);
+    });
 }
 
 void copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].row_major_scopy_sycl(queue, n, x, incx, y, incy);
+    static stats::routine routine{ trace_site, "scopy", "n incx incy",
+                                   { stats::work::copy, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_scopy_sycl)(queue, n, x, incx, y, incy);
+    });
 }
 
 void copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].row_major_dcopy_sycl(queue, n, x, incx, y, incy);
+    static stats::routine routine{ trace_site, "dcopy", "n incx incy",
+                                   { stats::work::copy, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dcopy_sycl)(queue, n, x, incx, y, incy);
+    });
 }
 
 void copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_ccopy_sycl(queue, n, x, incx, y, incy);
+    static stats::routine routine{ trace_site, "ccopy", "n incx incy",
+                                   { stats::work::copy, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_ccopy_sycl)(queue, n, x, incx, y, incy);
+    });
 }
 
 void copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_zcopy_sycl(queue, n, x, incx, y, incy);
+    static stats::routine routine{ trace_site, "zcopy", "n incx incy",
+                                   { stats::work::copy, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zcopy_sycl)(queue, n, x, incx, y, incy);
+    });
 }
 
 void dot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
          cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
          std::int64_t incy, cl::sycl::buffer<float, 1> &result) {
-    function_tables[libkey].row_major_sdot_sycl(queue, n, x, incx, y, incy, result);
+    static stats::routine routine{ trace_site, "sdot", "n incx incy",
+                                   { stats::work::dot, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_sdot_sycl)(queue, n, x, incx, y, incy, result);
+    });
 }
 
 void dot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
          cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
          std::int64_t incy, cl::sycl::buffer<double, 1> &result) {
-    function_tables[libkey].row_major_ddot_sycl(queue, n, x, incx, y, incy, result);
+    static stats::routine routine{ trace_site, "ddot", "n incx incy",
+                                   { stats::work::dot, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_ddot_sycl)(queue, n, x, incx, y, incy, result);
+    });
 }
 
 void dot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
          cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
          std::int64_t incy, cl::sycl::buffer<double, 1> &result) {
-    function_tables[libkey].row_major_dsdot_sycl(queue, n, x, incx, y, incy, result);
+    static stats::routine routine{ trace_site, "dsdot", "n incx incy",
+                                   { stats::work::dot, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dsdot_sycl)(queue, n, x, incx, y, incy, result);
+    });
 }
 
 void dotc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<float>, 1> &result) {
-    function_tables[libkey].row_major_cdotc_sycl(queue, n, x, incx, y, incy, result);
+    static stats::routine routine{ trace_site, "cdotc", "n incx incy",
+                                   { stats::work::dot, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_cdotc_sycl)(queue, n, x, incx, y, incy, result);
+    });
 }
 
 void dotc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<double>, 1> &result) {
-    function_tables[libkey].row_major_zdotc_sycl(queue, n, x, incx, y, incy, result);
+    static stats::routine routine{ trace_site, "zdotc", "n incx incy",
+                                   { stats::work::dot, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zdotc_sycl)(queue, n, x, incx, y, incy, result);
+    });
 }
 
 void dotu(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<float>, 1> &result) {
-    function_tables[libkey].row_major_cdotu_sycl(queue, n, x, incx, y, incy, result);
+    static stats::routine routine{ trace_site, "cdotu", "n incx incy",
+                                   { stats::work::dot, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_cdotu_sycl)(queue, n, x, incx, y, incy, result);
+    });
 }
 
 void dotu(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<double>, 1> &result) {
-    function_tables[libkey].row_major_zdotu_sycl(queue, n, x, incx, y, incy, result);
+    static stats::routine routine{ trace_site, "zdotu", "n incx incy",
+                                   { stats::work::dot, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zdotu_sycl)(queue, n, x, incx, y, incy, result);
+    });
 }
 
 void iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
            cl::sycl::buffer<float, 1> &x, std::int64_t incx,
            cl::sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].row_major_isamin_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "isamin", "n incx",
+                                   { stats::work::iamax, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_isamin_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
            cl::sycl::buffer<double, 1> &x, std::int64_t incx,
            cl::sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].row_major_idamin_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "idamin", "n incx",
+                                   { stats::work::iamax, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_idamin_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
            cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
            cl::sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].row_major_icamin_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "icamin", "n incx",
+                                   { stats::work::iamax, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_icamin_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
            cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
            cl::sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].row_major_izamin_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "izamin", "n incx",
+                                   { stats::work::iamax, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_izamin_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
            cl::sycl::buffer<float, 1> &x, std::int64_t incx,
            cl::sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].row_major_isamax_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "isamax", "n incx",
+                                   { stats::work::iamax, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_isamax_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
            cl::sycl::buffer<double, 1> &x, std::int64_t incx,
            cl::sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].row_major_idamax_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "idamax", "n incx",
+                                   { stats::work::iamax, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_idamax_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
            cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
            cl::sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].row_major_icamax_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "icamax", "n incx",
+                                   { stats::work::iamax, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_icamax_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
            cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
            cl::sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].row_major_izamax_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "izamax", "n incx",
+                                   { stats::work::iamax, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_izamax_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<float, 1> &result) {
-    function_tables[libkey].row_major_scnrm2_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "scnrm2", "n incx",
+                                   { stats::work::nrm2, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_scnrm2_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<double, 1> &result) {
-    function_tables[libkey].row_major_dznrm2_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "dznrm2", "n incx",
+                                   { stats::work::nrm2, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dznrm2_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &result) {
-    function_tables[libkey].row_major_snrm2_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "snrm2", "n incx",
+                                   { stats::work::nrm2, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_snrm2_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &result) {
-    function_tables[libkey].row_major_dnrm2_sycl(queue, n, x, incx, result);
+    static stats::routine routine{ trace_site, "dnrm2", "n incx",
+                                   { stats::work::nrm2, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dnrm2_sycl)(queue, n, x, incx, result);
+    });
 }
 
 void rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
          cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy, float c, float s) {
-    function_tables[libkey].row_major_srot_sycl(queue, n, x, incx, y, incy, c, s);
+    static stats::routine routine{ trace_site, "srot", "n incx incy",
+                                   { stats::work::rot, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_srot_sycl)(queue, n, x, incx, y, incy, c, s);
+    });
 }
 
 void rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
          cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy, double c, double s) {
-    function_tables[libkey].row_major_drot_sycl(queue, n, x, incx, y, incy, c, s);
+    static stats::routine routine{ trace_site, "drot", "n incx incy",
+                                   { stats::work::rot, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_drot_sycl)(queue, n, x, incx, y, incy, c, s);
+    });
 }
 
 void rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
          cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
          std::int64_t incy, float c, float s) {
-    function_tables[libkey].row_major_csrot_sycl(queue, n, x, incx, y, incy, c, s);
+    static stats::routine routine{ trace_site, "csrot", "n incx incy",
+                                   { stats::work::rot, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_csrot_sycl)(queue, n, x, incx, y, incy, c, s);
+    });
 }
 
 void rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
          cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
          std::int64_t incy, double c, double s) {
-    function_tables[libkey].row_major_zdrot_sycl(queue, n, x, incx, y, incy, c, s);
+    static stats::routine routine{ trace_site, "zdrot", "n incx incy",
+                                   { stats::work::rot, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zdrot_sycl)(queue, n, x, incx, y, incy, c, s);
+    });
 }
 
 void rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue, cl::sycl::buffer<float, 1> &a,
           cl::sycl::buffer<float, 1> &b, cl::sycl::buffer<float, 1> &c,
           cl::sycl::buffer<float, 1> &s) {
-    function_tables[libkey].row_major_srotg_sycl(queue, a, b, c, s);
+    static stats::routine routine{ trace_site, "srotg", "" };
+    auto shape = verbose::make_dims();
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_srotg_sycl)(queue, a, b, c, s);
+    });
 }
 
 void rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue, cl::sycl::buffer<double, 1> &a,
           cl::sycl::buffer<double, 1> &b, cl::sycl::buffer<double, 1> &c,
           cl::sycl::buffer<double, 1> &s) {
-    function_tables[libkey].row_major_drotg_sycl(queue, a, b, c, s);
+    static stats::routine routine{ trace_site, "drotg", "" };
+    auto shape = verbose::make_dims();
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_drotg_sycl)(queue, a, b, c, s);
+    });
 }
 
 void rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue,
           cl::sycl::buffer<std::complex<float>, 1> &a, cl::sycl::buffer<std::complex<float>, 1> &b,
           cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<std::complex<float>, 1> &s) {
-    function_tables[libkey].row_major_crotg_sycl(queue, a, b, c, s);
+    static stats::routine routine{ trace_site, "crotg", "" };
+    auto shape = verbose::make_dims();
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_crotg_sycl)(queue, a, b, c, s);
+    });
 }
 
 void rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue,
           cl::sycl::buffer<std::complex<double>, 1> &a,
           cl::sycl::buffer<std::complex<double>, 1> &b, cl::sycl::buffer<double, 1> &c,
           cl::sycl::buffer<std::complex<double>, 1> &s) {
-    function_tables[libkey].row_major_zrotg_sycl(queue, a, b, c, s);
+    static stats::routine routine{ trace_site, "zrotg", "" };
+    auto shape = verbose::make_dims();
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zrotg_sycl)(queue, a, b, c, s);
+    });
 }
 
 void rotm(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
           std::int64_t incy, cl::sycl::buffer<float, 1> &param) {
-    function_tables[libkey].row_major_srotm_sycl(queue, n, x, incx, y, incy, param);
+    static stats::routine routine{ trace_site, "srotm", "n incx incy",
+                                   { stats::work::rot, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_srotm_sycl)(queue, n, x, incx, y, incy, param);
+    });
 }
 
 void rotm(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
           std::int64_t incy, cl::sycl::buffer<double, 1> &param) {
-    function_tables[libkey].row_major_drotm_sycl(queue, n, x, incx, y, incy, param);
+    static stats::routine routine{ trace_site, "drotm", "n incx incy",
+                                   { stats::work::rot, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_drotm_sycl)(queue, n, x, incx, y, incy, param);
+    });
 }
 
 void rotmg(oneapi::mkl::device libkey, cl::sycl::queue &queue, cl::sycl::buffer<float, 1> &d1,
            cl::sycl::buffer<float, 1> &d2, cl::sycl::buffer<float, 1> &x1, float y1,
            cl::sycl::buffer<float, 1> &param) {
-    function_tables[libkey].row_major_srotmg_sycl(queue, d1, d2, x1, y1, param);
+    static stats::routine routine{ trace_site, "srotmg", "" };
+    auto shape = verbose::make_dims();
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_srotmg_sycl)(queue, d1, d2, x1, y1, param);
+    });
 }
 
 void rotmg(oneapi::mkl::device libkey, cl::sycl::queue &queue, cl::sycl::buffer<double, 1> &d1,
            cl::sycl::buffer<double, 1> &d2, cl::sycl::buffer<double, 1> &x1, double y1,
            cl::sycl::buffer<double, 1> &param) {
-    function_tables[libkey].row_major_drotmg_sycl(queue, d1, d2, x1, y1, param);
+    static stats::routine routine{ trace_site, "drotmg", "" };
+    auto shape = verbose::make_dims();
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_drotmg_sycl)(queue, d1, d2, x1, y1, param);
+    });
 }
 
 void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, float alpha,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_sscal_sycl(queue, n, alpha, x, incx);
+    static stats::routine routine{ trace_site, "sscal", "n incx",
+                                   { stats::work::scal, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_sscal_sycl)(queue, n, alpha, x, incx);
+    });
 }
 
 void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, double alpha,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_dscal_sycl(queue, n, alpha, x, incx);
+    static stats::routine routine{ trace_site, "dscal", "n incx",
+                                   { stats::work::scal, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dscal_sycl)(queue, n, alpha, x, incx);
+    });
 }
 
 void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
           std::int64_t incx) {
-    function_tables[libkey].row_major_cscal_sycl(queue, n, alpha, x, incx);
+    static stats::routine routine{ trace_site, "cscal", "n incx",
+                                   { stats::work::scal, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_cscal_sycl)(queue, n, alpha, x, incx);
+    });
 }
 
 void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
           std::int64_t incx) {
-    function_tables[libkey].row_major_csscal_sycl(queue, n, alpha, x, incx);
+    static stats::routine routine{ trace_site, "csscal", "n incx",
+                                   { stats::work::scal, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_csscal_sycl)(queue, n, alpha, x, incx);
+    });
 }
 
 void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, float alpha,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_zscal_sycl(queue, n, alpha, x, incx);
+    static stats::routine routine{ trace_site, "zscal", "n incx",
+                                   { stats::work::scal, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zscal_sycl)(queue, n, alpha, x, incx);
+    });
 }
 
 void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, double alpha,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_zdscal_sycl(queue, n, alpha, x, incx);
+    static stats::routine routine{ trace_site, "zdscal", "n incx",
+                                   { stats::work::scal, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zdscal_sycl)(queue, n, alpha, x, incx);
+    });
 }
 
 void sdsdot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, float sb,
             cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
             std::int64_t incy, cl::sycl::buffer<float, 1> &result) {
-    function_tables[libkey].row_major_sdsdot_sycl(queue, n, sb, x, incx, y, incy, result);
+    static stats::routine routine{ trace_site, "sdsdot", "n incx incy",
+                                   { stats::work::dot, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_sdsdot_sycl)(queue, n, sb, x, incx, y, incy, result);
+    });
 }
 
 void swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, cl::sycl::buffer<float, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].row_major_sswap_sycl(queue, n, x, incx, y, incy);
+    static stats::routine routine{ trace_site, "sswap", "n incx incy",
+                                   { stats::work::swap, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_sswap_sycl)(queue, n, x, incx, y, incy);
+    });
 }
 
 void swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx, cl::sycl::buffer<double, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].row_major_dswap_sycl(queue, n, x, incx, y, incy);
+    static stats::routine routine{ trace_site, "dswap", "n incx incy",
+                                   { stats::work::swap, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dswap_sycl)(queue, n, x, incx, y, incy);
+    });
 }
 
 void swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_cswap_sycl(queue, n, x, incx, y, incy);
+    static stats::routine routine{ trace_site, "cswap", "n incx incy",
+                                   { stats::work::swap, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_cswap_sycl)(queue, n, x, incx, y, incy);
+    });
 }
 
 void swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_zswap_sycl(queue, n, x, incx, y, incy);
+    static stats::routine routine{ trace_site, "zswap", "n incx incy",
+                                   { stats::work::swap, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zswap_sycl)(queue, n, x, incx, y, incy);
+    });
 }
 
 void gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
           std::int64_t n, std::int64_t kl, std::int64_t ku, float alpha,
           cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &x,
           std::int64_t incx, float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_sgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx,
-                                                 beta, y, incy);
+    static stats::routine routine{ trace_site, "sgbmv", "trans m n kl ku lda incx incy",
+                                   { stats::work::gbmv, stats::f32 } };
+    auto shape = verbose::make_dims(trans, m, n, kl, ku, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_sgbmv_sycl)(queue, trans, m, n, kl, ku, alpha, a, lda, x,
+                                                    incx, beta, y, incy);
+    });
 }
 
 void gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
           std::int64_t n, std::int64_t kl, std::int64_t ku, double alpha,
           cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &x,
           std::int64_t incx, double beta, cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_dgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx,
-                                                 beta, y, incy);
+    static stats::routine routine{ trace_site, "dgbmv", "trans m n kl ku lda incx incy",
+                                   { stats::work::gbmv, stats::f64 } };
+    auto shape = verbose::make_dims(trans, m, n, kl, ku, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dgbmv_sycl)(queue, trans, m, n, kl, ku, alpha, a, lda, x,
+                                                    incx, beta, y, incy);
+    });
 }
 
 void gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
@@ -2998,8 +5009,13 @@ void gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, s
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_cgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx,
-                                                 beta, y, incy);
+    static stats::routine routine{ trace_site, "cgbmv", "trans m n kl ku lda incx incy",
+                                   { stats::work::gbmv, stats::c32 } };
+    auto shape = verbose::make_dims(trans, m, n, kl, ku, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_cgbmv_sycl)(queue, trans, m, n, kl, ku, alpha, a, lda, x,
+                                                    incx, beta, y, incy);
+    });
 }
 
 void gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
@@ -3008,24 +5024,39 @@ void gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, s
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].row_major_zgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx,
-                                                 beta, y, incy);
+    static stats::routine routine{ trace_site, "zgbmv", "trans m n kl ku lda incx incy",
+                                   { stats::work::gbmv, stats::c64 } };
+    auto shape = verbose::make_dims(trans, m, n, kl, ku, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zgbmv_sycl)(queue, trans, m, n, kl, ku, alpha, a, lda, x,
+                                                    incx, beta, y, incy);
+    });
 }
 
 void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
           std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
           cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_sgemv_sycl(queue, trans, m, n, alpha, a, lda, x, incx, beta,
-                                                 y, incy);
+    static stats::routine routine{ trace_site, "sgemv", "trans m n lda incx incy",
+                                   { stats::work::gemv, stats::f32 } };
+    auto shape = verbose::make_dims(trans, m, n, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_sgemv_sycl)(queue, trans, m, n, alpha, a, lda, x, incx,
+                                                    beta, y, incy);
+    });
 }
 
 void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
           std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
           cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_dgemv_sycl(queue, trans, m, n, alpha, a, lda, x, incx, beta,
-                                                 y, incy);
+    static stats::routine routine{ trace_site, "dgemv", "trans m n lda incx incy",
+                                   { stats::work::gemv, stats::f64 } };
+    auto shape = verbose::make_dims(trans, m, n, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dgemv_sycl)(queue, trans, m, n, alpha, a, lda, x, incx,
+                                                    beta, y, incy);
+    });
 }
 
 void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
@@ -3033,8 +5064,13 @@ void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, s
           std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].row_major_cgemv_sycl(queue, trans, m, n, alpha, a, lda, x, incx, beta,
-                                                 y, incy);
+    static stats::routine routine{ trace_site, "cgemv", "trans m n lda incx incy",
+                                   { stats::work::gemv, stats::c32 } };
+    auto shape = verbose::make_dims(trans, m, n, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_cgemv_sycl)(queue, trans, m, n, alpha, a, lda, x, incx,
+                                                    beta, y, incy);
+    });
 }
 
 void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
@@ -3042,50 +5078,85 @@ void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, s
           std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].row_major_zgemv_sycl(queue, trans, m, n, alpha, a, lda, x, incx, beta,
-                                                 y, incy);
+    static stats::routine routine{ trace_site, "zgemv", "trans m n lda incx incy",
+                                   { stats::work::gemv, stats::c64 } };
+    auto shape = verbose::make_dims(trans, m, n, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zgemv_sycl)(queue, trans, m, n, alpha, a, lda, x, incx,
+                                                    beta, y, incy);
+    });
 }
 
 void ger(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
          float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
          cl::sycl::buffer<float, 1> &y, std::int64_t incy, cl::sycl::buffer<float, 1> &a,
          std::int64_t lda) {
-    function_tables[libkey].row_major_sger_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    static stats::routine routine{ trace_site, "sger", "m n incx incy lda",
+                                   { stats::work::ger, stats::f32 } };
+    auto shape = verbose::make_dims(m, n, incx, incy, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_sger_sycl)(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    });
 }
 
 void ger(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
          double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
          cl::sycl::buffer<double, 1> &y, std::int64_t incy, cl::sycl::buffer<double, 1> &a,
          std::int64_t lda) {
-    function_tables[libkey].row_major_dger_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    static stats::routine routine{ trace_site, "dger", "m n incx incy lda",
+                                   { stats::work::ger, stats::f64 } };
+    auto shape = verbose::make_dims(m, n, incx, incy, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dger_sycl)(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    });
 }
 
 void gerc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].row_major_cgerc_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    static stats::routine routine{ trace_site, "cgerc", "m n incx incy lda",
+                                   { stats::work::ger, stats::c32 } };
+    auto shape = verbose::make_dims(m, n, incx, incy, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_cgerc_sycl)(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    });
 }
 
 void gerc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
           std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].row_major_zgerc_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    static stats::routine routine{ trace_site, "zgerc", "m n incx incy lda",
+                                   { stats::work::ger, stats::c64 } };
+    auto shape = verbose::make_dims(m, n, incx, incy, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zgerc_sycl)(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    });
 }
 
 void geru(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].row_major_cgeru_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    static stats::routine routine{ trace_site, "cgeru", "m n incx incy lda",
+                                   { stats::work::ger, stats::c32 } };
+    auto shape = verbose::make_dims(m, n, incx, incy, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_cgeru_sycl)(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    });
 }
 
 void geru(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m, std::int64_t n,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
           std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].row_major_zgeru_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    static stats::routine routine{ trace_site, "zgeru", "m n incx incy lda",
+                                   { stats::work::ger, stats::c64 } };
+    auto shape = verbose::make_dims(m, n, incx, incy, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zgeru_sycl)(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    });
 }
 
 void hbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
@@ -3093,8 +5164,13 @@ void hbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].row_major_chbmv_sycl(queue, upper_lower, n, k, alpha, a, lda, x, incx,
-                                                 beta, y, incy);
+    static stats::routine routine{ trace_site, "chbmv", "upper_lower n k lda incx incy",
+                                   { stats::work::sbmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, k, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_chbmv_sycl)(queue, upper_lower, n, k, alpha, a, lda, x,
+                                                    incx, beta, y, incy);
+    });
 }
 
 void hbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
@@ -3102,16 +5178,26 @@ void hbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].row_major_zhbmv_sycl(queue, upper_lower, n, k, alpha, a, lda, x, incx,
-                                                 beta, y, incy);
+    static stats::routine routine{ trace_site, "zhbmv", "upper_lower n k lda incx incy",
+                                   { stats::work::sbmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, k, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zhbmv_sycl)(queue, upper_lower, n, k, alpha, a, lda, x,
+                                                    incx, beta, y, incy);
+    });
 }
 
 void hemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_chemv_sycl(queue, upper_lower, n, alpha, a, lda, x, incx,
-                                                 beta, y, incy);
+    static stats::routine routine{ trace_site, "chemv", "upper_lower n lda incx incy",
+                                   { stats::work::symv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_chemv_sycl)(queue, upper_lower, n, alpha, a, lda, x, incx,
+                                                    beta, y, incy);
+    });
 }
 
 void hemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
@@ -3119,44 +5205,74 @@ void hemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].row_major_zhemv_sycl(queue, upper_lower, n, alpha, a, lda, x, incx,
-                                                 beta, y, incy);
+    static stats::routine routine{ trace_site, "zhemv", "upper_lower n lda incx incy",
+                                   { stats::work::symv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zhemv_sycl)(queue, upper_lower, n, alpha, a, lda, x, incx,
+                                                    beta, y, incy);
+    });
 }
 
 void her(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
          float alpha, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
          cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].row_major_cher_sycl(queue, upper_lower, n, alpha, x, incx, a, lda);
+    static stats::routine routine{ trace_site, "cher", "upper_lower n incx lda",
+                                   { stats::work::syr, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_cher_sycl)(queue, upper_lower, n, alpha, x, incx, a, lda);
+    });
 }
 
 void her(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
          double alpha, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
          cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].row_major_zher_sycl(queue, upper_lower, n, alpha, x, incx, a, lda);
+    static stats::routine routine{ trace_site, "zher", "upper_lower n incx lda",
+                                   { stats::work::syr, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zher_sycl)(queue, upper_lower, n, alpha, x, incx, a, lda);
+    });
 }
 
 void her2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].row_major_cher2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a,
-                                                 lda);
+    static stats::routine routine{ trace_site, "cher2", "upper_lower n incx incy lda",
+                                   { stats::work::syr2, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_cher2_sycl)(queue, upper_lower, n, alpha, x, incx, y, incy,
+                                                    a, lda);
+    });
 }
 
 void her2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
           std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].row_major_zher2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a,
-                                                 lda);
+    static stats::routine routine{ trace_site, "zher2", "upper_lower n incx incy lda",
+                                   { stats::work::syr2, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zher2_sycl)(queue, upper_lower, n, alpha, x, incx, y, incy,
+                                                    a, lda);
+    });
 }
 
 void hpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_chpmv_sycl(queue, upper_lower, n, alpha, a, x, incx, beta, y,
-                                                 incy);
+    static stats::routine routine{ trace_site, "chpmv", "upper_lower n incx incy",
+                                   { stats::work::symv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_chpmv_sycl)(queue, upper_lower, n, alpha, a, x, incx, beta,
+                                                    y, incy);
+    });
 }
 
 void hpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
@@ -3164,320 +5280,549 @@ void hpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].row_major_zhpmv_sycl(queue, upper_lower, n, alpha, a, x, incx, beta, y,
-                                                 incy);
+    static stats::routine routine{ trace_site, "zhpmv", "upper_lower n incx incy",
+                                   { stats::work::symv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zhpmv_sycl)(queue, upper_lower, n, alpha, a, x, incx, beta,
+                                                    y, incy);
+    });
 }
 
 void hpr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
          float alpha, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
          cl::sycl::buffer<std::complex<float>, 1> &a) {
-    function_tables[libkey].row_major_chpr_sycl(queue, upper_lower, n, alpha, x, incx, a);
+    static stats::routine routine{ trace_site, "chpr", "upper_lower n incx",
+                                   { stats::work::syr, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_chpr_sycl)(queue, upper_lower, n, alpha, x, incx, a);
+    });
 }
 
 void hpr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
          double alpha, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
          cl::sycl::buffer<std::complex<double>, 1> &a) {
-    function_tables[libkey].row_major_zhpr_sycl(queue, upper_lower, n, alpha, x, incx, a);
+    static stats::routine routine{ trace_site, "zhpr", "upper_lower n incx",
+                                   { stats::work::syr, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zhpr_sycl)(queue, upper_lower, n, alpha, x, incx, a);
+    });
 }
 
 void hpr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<float>, 1> &a) {
-    function_tables[libkey].row_major_chpr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a);
+    static stats::routine routine{ trace_site, "chpr2", "upper_lower n incx incy",
+                                   { stats::work::syr2, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_chpr2_sycl)(queue, upper_lower, n, alpha, x, incx, y, incy,
+                                                    a);
+    });
 }
 
 void hpr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
           std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           cl::sycl::buffer<std::complex<double>, 1> &a) {
-    function_tables[libkey].row_major_zhpr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a);
+    static stats::routine routine{ trace_site, "zhpr2", "upper_lower n incx incy",
+                                   { stats::work::syr2, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zhpr2_sycl)(queue, upper_lower, n, alpha, x, incx, y, incy,
+                                                    a);
+    });
 }
 
 void sbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
           cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_ssbmv_sycl(queue, upper_lower, n, k, alpha, a, lda, x, incx,
-                                                 beta, y, incy);
+    static stats::routine routine{ trace_site, "ssbmv", "upper_lower n k lda incx incy",
+                                   { stats::work::sbmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, k, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_ssbmv_sycl)(queue, upper_lower, n, k, alpha, a, lda, x,
+                                                    incx, beta, y, incy);
+    });
 }
 
 void sbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::int64_t k, double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
           cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_dsbmv_sycl(queue, upper_lower, n, k, alpha, a, lda, x, incx,
-                                                 beta, y, incy);
+    static stats::routine routine{ trace_site, "dsbmv", "upper_lower n k lda incx incy",
+                                   { stats::work::sbmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, k, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dsbmv_sycl)(queue, upper_lower, n, k, alpha, a, lda, x,
+                                                    incx, beta, y, incy);
+    });
 }
 
 void spmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           float alpha, cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<float, 1> &x,
           std::int64_t incx, float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_sspmv_sycl(queue, upper_lower, n, alpha, a, x, incx, beta, y,
-                                                 incy);
+    static stats::routine routine{ trace_site, "sspmv", "upper_lower n incx incy",
+                                   { stats::work::symv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_sspmv_sycl)(queue, upper_lower, n, alpha, a, x, incx, beta,
+                                                    y, incy);
+    });
 }
 
 void spmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           double alpha, cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<double, 1> &x,
           std::int64_t incx, double beta, cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_dspmv_sycl(queue, upper_lower, n, alpha, a, x, incx, beta, y,
-                                                 incy);
+    static stats::routine routine{ trace_site, "dspmv", "upper_lower n incx incy",
+                                   { stats::work::symv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dspmv_sycl)(queue, upper_lower, n, alpha, a, x, incx, beta,
+                                                    y, incy);
+    });
 }
 
 void spr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
          float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
          cl::sycl::buffer<float, 1> &a) {
-    function_tables[libkey].row_major_sspr_sycl(queue, upper_lower, n, alpha, x, incx, a);
+    static stats::routine routine{ trace_site, "sspr", "upper_lower n incx",
+                                   { stats::work::syr, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_sspr_sycl)(queue, upper_lower, n, alpha, x, incx, a);
+    });
 }
 
 void spr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
          double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
          cl::sycl::buffer<double, 1> &a) {
-    function_tables[libkey].row_major_dspr_sycl(queue, upper_lower, n, alpha, x, incx, a);
+    static stats::routine routine{ trace_site, "dspr", "upper_lower n incx",
+                                   { stats::work::syr, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dspr_sycl)(queue, upper_lower, n, alpha, x, incx, a);
+    });
 }
 
 void spr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
           cl::sycl::buffer<float, 1> &y, std::int64_t incy, cl::sycl::buffer<float, 1> &a) {
-    function_tables[libkey].row_major_sspr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a);
+    static stats::routine routine{ trace_site, "sspr2", "upper_lower n incx incy",
+                                   { stats::work::syr2, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_sspr2_sycl)(queue, upper_lower, n, alpha, x, incx, y, incy,
+                                                    a);
+    });
 }
 
 void spr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
           cl::sycl::buffer<double, 1> &y, std::int64_t incy, cl::sycl::buffer<double, 1> &a) {
-    function_tables[libkey].row_major_dspr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a);
+    static stats::routine routine{ trace_site, "dspr2", "upper_lower n incx incy",
+                                   { stats::work::syr2, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dspr2_sycl)(queue, upper_lower, n, alpha, x, incx, y, incy,
+                                                    a);
+    });
 }
 
 void symv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
           cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_ssymv_sycl(queue, upper_lower, n, alpha, a, lda, x, incx,
-                                                 beta, y, incy);
+    static stats::routine routine{ trace_site, "ssymv", "upper_lower n lda incx incy",
+                                   { stats::work::symv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_ssymv_sycl)(queue, upper_lower, n, alpha, a, lda, x, incx,
+                                                    beta, y, incy);
+    });
 }
 
 void symv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
           cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_dsymv_sycl(queue, upper_lower, n, alpha, a, lda, x, incx,
-                                                 beta, y, incy);
+    static stats::routine routine{ trace_site, "dsymv", "upper_lower n lda incx incy",
+                                   { stats::work::symv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, lda, incx, incy);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dsymv_sycl)(queue, upper_lower, n, alpha, a, lda, x, incx,
+                                                    beta, y, incy);
+    });
 }
 
 void syr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
          float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
          cl::sycl::buffer<float, 1> &a, std::int64_t lda) {
-    function_tables[libkey].row_major_ssyr_sycl(queue, upper_lower, n, alpha, x, incx, a, lda);
+    static stats::routine routine{ trace_site, "ssyr", "upper_lower n incx lda",
+                                   { stats::work::syr, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_ssyr_sycl)(queue, upper_lower, n, alpha, x, incx, a, lda);
+    });
 }
 
 void syr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
          double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
          cl::sycl::buffer<double, 1> &a, std::int64_t lda) {
-    function_tables[libkey].row_major_dsyr_sycl(queue, upper_lower, n, alpha, x, incx, a, lda);
+    static stats::routine routine{ trace_site, "dsyr", "upper_lower n incx lda",
+                                   { stats::work::syr, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dsyr_sycl)(queue, upper_lower, n, alpha, x, incx, a, lda);
+    });
 }
 
 void syr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
           cl::sycl::buffer<float, 1> &y, std::int64_t incy, cl::sycl::buffer<float, 1> &a,
           std::int64_t lda) {
-    function_tables[libkey].row_major_ssyr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a,
-                                                 lda);
+    static stats::routine routine{ trace_site, "ssyr2", "upper_lower n incx incy lda",
+                                   { stats::work::syr2, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_ssyr2_sycl)(queue, upper_lower, n, alpha, x, incx, y, incy,
+                                                    a, lda);
+    });
 }
 
 void syr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, std::int64_t n,
           double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
           cl::sycl::buffer<double, 1> &y, std::int64_t incy, cl::sycl::buffer<double, 1> &a,
           std::int64_t lda) {
-    function_tables[libkey].row_major_dsyr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a,
-                                                 lda);
+    static stats::routine routine{ trace_site, "dsyr2", "upper_lower n incx incy lda",
+                                   { stats::work::syr2, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy, lda);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dsyr2_sycl)(queue, upper_lower, n, alpha, x, incx, y, incy,
+                                                    a, lda);
+    });
 }
 
 void tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, cl::sycl::buffer<float, 1> &a,
           std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_stbmv_sycl(queue, upper_lower, trans, unit_diag, n, k, a, lda,
-                                                 x, incx);
+    static stats::routine routine{ trace_site, "stbmv", "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_stbmv_sycl)(queue, upper_lower, trans, unit_diag, n, k, a,
+                                                    lda, x, incx);
+    });
 }
 
 void tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, cl::sycl::buffer<double, 1> &a,
           std::int64_t lda, cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_dtbmv_sycl(queue, upper_lower, trans, unit_diag, n, k, a, lda,
-                                                 x, incx);
+    static stats::routine routine{ trace_site, "dtbmv", "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dtbmv_sycl)(queue, upper_lower, trans, unit_diag, n, k, a,
+                                                    lda, x, incx);
+    });
 }
 
 void tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k,
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_ctbmv_sycl(queue, upper_lower, trans, unit_diag, n, k, a, lda,
-                                                 x, incx);
+    static stats::routine routine{ trace_site, "ctbmv", "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_ctbmv_sycl)(queue, upper_lower, trans, unit_diag, n, k, a,
+                                                    lda, x, incx);
+    });
 }
 
 void tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k,
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_ztbmv_sycl(queue, upper_lower, trans, unit_diag, n, k, a, lda,
-                                                 x, incx);
+    static stats::routine routine{ trace_site, "ztbmv", "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_ztbmv_sycl)(queue, upper_lower, trans, unit_diag, n, k, a,
+                                                    lda, x, incx);
+    });
 }
 
 void tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, cl::sycl::buffer<float, 1> &a,
           std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_stbsv_sycl(queue, upper_lower, trans, unit_diag, n, k, a, lda,
-                                                 x, incx);
+    static stats::routine routine{ trace_site, "stbsv", "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_stbsv_sycl)(queue, upper_lower, trans, unit_diag, n, k, a,
+                                                    lda, x, incx);
+    });
 }
 
 void tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, cl::sycl::buffer<double, 1> &a,
           std::int64_t lda, cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_dtbsv_sycl(queue, upper_lower, trans, unit_diag, n, k, a, lda,
-                                                 x, incx);
+    static stats::routine routine{ trace_site, "dtbsv", "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dtbsv_sycl)(queue, upper_lower, trans, unit_diag, n, k, a,
+                                                    lda, x, incx);
+    });
 }
 
 void tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k,
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_ctbsv_sycl(queue, upper_lower, trans, unit_diag, n, k, a, lda,
-                                                 x, incx);
+    static stats::routine routine{ trace_site, "ctbsv", "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_ctbsv_sycl)(queue, upper_lower, trans, unit_diag, n, k, a,
+                                                    lda, x, incx);
+    });
 }
 
 void tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k,
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_ztbsv_sycl(queue, upper_lower, trans, unit_diag, n, k, a, lda,
-                                                 x, incx);
+    static stats::routine routine{ trace_site, "ztbsv", "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_ztbsv_sycl)(queue, upper_lower, trans, unit_diag, n, k, a,
+                                                    lda, x, incx);
+    });
 }
 
 void tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<float, 1> &a,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_stpmv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                 incx);
+    static stats::routine routine{ trace_site, "stpmv", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_stpmv_sycl)(queue, upper_lower, trans, unit_diag, n, a, x,
+                                                    incx);
+    });
 }
 
 void tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<double, 1> &a,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_dtpmv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                 incx);
+    static stats::routine routine{ trace_site, "dtpmv", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dtpmv_sycl)(queue, upper_lower, trans, unit_diag, n, a, x,
+                                                    incx);
+    });
 }
 
 void tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_ctpmv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                 incx);
+    static stats::routine routine{ trace_site, "ctpmv", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_ctpmv_sycl)(queue, upper_lower, trans, unit_diag, n, a, x,
+                                                    incx);
+    });
 }
 
 void tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &a,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_ztpmv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                 incx);
+    static stats::routine routine{ trace_site, "ztpmv", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_ztpmv_sycl)(queue, upper_lower, trans, unit_diag, n, a, x,
+                                                    incx);
+    });
 }
 
 void tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<float, 1> &a,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_stpsv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                 incx);
+    static stats::routine routine{ trace_site, "stpsv", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_stpsv_sycl)(queue, upper_lower, trans, unit_diag, n, a, x,
+                                                    incx);
+    });
 }
 
 void tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<double, 1> &a,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_dtpsv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                 incx);
+    static stats::routine routine{ trace_site, "dtpsv", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dtpsv_sycl)(queue, upper_lower, trans, unit_diag, n, a, x,
+                                                    incx);
+    });
 }
 
 void tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a,
           cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_ctpsv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                 incx);
+    static stats::routine routine{ trace_site, "ctpsv", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_ctpsv_sycl)(queue, upper_lower, trans, unit_diag, n, a, x,
+                                                    incx);
+    });
 }
 
 void tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &a,
           cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_ztpsv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                 incx);
+    static stats::routine routine{ trace_site, "ztpsv", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_ztpsv_sycl)(queue, upper_lower, trans, unit_diag, n, a, x,
+                                                    incx);
+    });
 }
 
 void trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_strmv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda, x,
-                                                 incx);
+    static stats::routine routine{ trace_site, "strmv", "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_strmv_sycl)(queue, upper_lower, trans, unit_diag, n, a, lda,
+                                                    x, incx);
+    });
 }
 
 void trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_dtrmv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda, x,
-                                                 incx);
+    static stats::routine routine{ trace_site, "dtrmv", "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dtrmv_sycl)(queue, upper_lower, trans, unit_diag, n, a, lda,
+                                                    x, incx);
+    });
 }
 
 void trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a,
           std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_ctrmv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda, x,
-                                                 incx);
+    static stats::routine routine{ trace_site, "ctrmv", "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_ctrmv_sycl)(queue, upper_lower, trans, unit_diag, n, a, lda,
+                                                    x, incx);
+    });
 }
 
 void trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &a,
           std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_ztrmv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda, x,
-                                                 incx);
+    static stats::routine routine{ trace_site, "ztrmv", "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_ztrmv_sycl)(queue, upper_lower, trans, unit_diag, n, a, lda,
+                                                    x, incx);
+    });
 }
 
 void trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
           cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_strsv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda, x,
-                                                 incx);
+    static stats::routine routine{ trace_site, "strsv", "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_strsv_sycl)(queue, upper_lower, trans, unit_diag, n, a, lda,
+                                                    x, incx);
+    });
 }
 
 void trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
           cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_dtrsv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda, x,
-                                                 incx);
+    static stats::routine routine{ trace_site, "dtrsv", "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dtrsv_sycl)(queue, upper_lower, trans, unit_diag, n, a, lda,
+                                                    x, incx);
+    });
 }
 
 void trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &a,
           std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_ctrsv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda, x,
-                                                 incx);
+    static stats::routine routine{ trace_site, "ctrsv", "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_ctrsv_sycl)(queue, upper_lower, trans, unit_diag, n, a, lda,
+                                                    x, incx);
+    });
 }
 
 void trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &a,
           std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_ztrsv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda, x,
-                                                 incx);
+    static stats::routine routine{ trace_site, "ztrsv", "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_ztrsv_sycl)(queue, upper_lower, trans, unit_diag, n, a, lda,
+                                                    x, incx);
+    });
 }
 
 void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
           std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
           cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
           std::int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_sgemm_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b,
-                                                 ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "sgemm", "transa transb m n k lda ldb ldc",
+                                   { stats::work::gemm, stats::f32 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_sgemm_sycl)(queue, transa, transb, m, n, k, alpha, a, lda,
+                                                    b, ldb, beta, c, ldc);
+    });
 }
 
 void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
           std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
           cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
           std::int64_t ldb, double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_dgemm_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b,
-                                                 ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "dgemm", "transa transb m n k lda ldb ldc",
+                                   { stats::work::gemm, stats::f64 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dgemm_sycl)(queue, transa, transb, m, n, k, alpha, a, lda,
+                                                    b, ldb, beta, c, ldc);
+    });
 }
 
 void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
@@ -3485,8 +5830,13 @@ void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_cgemm_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b,
-                                                 ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "cgemm", "transa transb m n k lda ldb ldc",
+                                   { stats::work::gemm, stats::c32 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_cgemm_sycl)(queue, transa, transb, m, n, k, alpha, a, lda,
+                                                    b, ldb, beta, c, ldc);
+    });
 }
 
 void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
@@ -3494,16 +5844,26 @@ void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
           cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_zgemm_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b,
-                                                 ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "zgemm", "transa transb m n k lda ldb ldc",
+                                   { stats::work::gemm, stats::c64 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zgemm_sycl)(queue, transa, transb, m, n, k, alpha, a, lda,
+                                                    b, ldb, beta, c, ldc);
+    });
 }
 void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
           std::int64_t m, std::int64_t n, std::int64_t k, cl::sycl::half alpha,
           cl::sycl::buffer<cl::sycl::half, 1> &a, std::int64_t lda,
           cl::sycl::buffer<cl::sycl::half, 1> &b, std::int64_t ldb, cl::sycl::half beta,
           cl::sycl::buffer<cl::sycl::half, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_hgemm_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b,
-                                                 ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "hgemm", "transa transb m n k lda ldb ldc",
+                                   { stats::work::gemm, stats::f16 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_hgemm_sycl)(queue, transa, transb, m, n, k, alpha, a, lda,
+                                                    b, ldb, beta, c, ldc);
+    });
 }
 
 void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
@@ -3511,8 +5871,13 @@ void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
           cl::sycl::buffer<cl::sycl::half, 1> &a, std::int64_t lda,
           cl::sycl::buffer<cl::sycl::half, 1> &b, std::int64_t ldb, float beta,
           cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_gemm_f16f16f32_sycl(queue, transa, transb, m, n, k, alpha, a,
-                                                          lda, b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "gemm_f16f16f32", "transa transb m n k lda ldb ldc",
+                                   { stats::work::gemm, stats::f16 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_gemm_f16f16f32_sycl)(queue, transa, transb, m, n, k, alpha,
+                                                             a, lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void hemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
@@ -3520,8 +5885,13 @@ void hemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, u
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_chemm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
-                                                 lda, b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "chemm", "left_right upper_lower m n lda ldb ldc",
+                                   { stats::work::symm, stats::c32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, m, n, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_chemm_sycl)(queue, left_right, upper_lower, m, n, alpha, a,
+                                                    lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void hemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
@@ -3529,24 +5899,39 @@ void hemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, u
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
           cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_zhemm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
-                                                 lda, b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "zhemm", "left_right upper_lower m n lda ldb ldc",
+                                   { stats::work::symm, stats::c64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, m, n, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zhemm_sycl)(queue, left_right, upper_lower, m, n, alpha, a,
+                                                    lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void herk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
           std::int64_t lda, float beta, cl::sycl::buffer<std::complex<float>, 1> &c,
           std::int64_t ldc) {
-    function_tables[libkey].row_major_cherk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                 beta, c, ldc);
+    static stats::routine routine{ trace_site, "cherk", "upper_lower trans n k lda ldc",
+                                   { stats::work::syrk, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_cherk_sycl)(queue, upper_lower, trans, n, k, alpha, a, lda,
+                                                    beta, c, ldc);
+    });
 }
 
 void herk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, double alpha,
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda, double beta,
           cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_zherk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                 beta, c, ldc);
+    static stats::routine routine{ trace_site, "zherk", "upper_lower trans n k lda ldc",
+                                   { stats::work::syrk, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zherk_sycl)(queue, upper_lower, trans, n, k, alpha, a, lda,
+                                                    beta, c, ldc);
+    });
 }
 
 void her2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -3554,8 +5939,13 @@ void her2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
            cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
            cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, float beta,
            cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_cher2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda, b,
-                                                  ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "cher2k", "upper_lower trans n k lda ldb ldc",
+                                   { stats::work::syr2k, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_cher2k_sycl)(queue, upper_lower, trans, n, k, alpha, a, lda,
+                                                     b, ldb, beta, c, ldc);
+    });
 }
 
 void her2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -3563,24 +5953,39 @@ void her2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
            cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
            cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, double beta,
            cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_zher2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda, b,
-                                                  ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "zher2k", "upper_lower trans n k lda ldb ldc",
+                                   { stats::work::syr2k, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zher2k_sycl)(queue, upper_lower, trans, n, k, alpha, a, lda,
+                                                     b, ldb, beta, c, ldc);
+    });
 }
 
 void symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
           std::int64_t m, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
           std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
           cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_ssymm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
-                                                 lda, b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "ssymm", "left_right upper_lower m n lda ldb ldc",
+                                   { stats::work::symm, stats::f32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, m, n, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_ssymm_sycl)(queue, left_right, upper_lower, m, n, alpha, a,
+                                                    lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
           std::int64_t m, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
           std::int64_t lda, cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
           cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_dsymm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
-                                                 lda, b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "dsymm", "left_right upper_lower m n lda ldb ldc",
+                                   { stats::work::symm, stats::f64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, m, n, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dsymm_sycl)(queue, left_right, upper_lower, m, n, alpha, a,
+                                                    lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
@@ -3588,8 +5993,13 @@ void symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, u
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_csymm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
-                                                 lda, b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "csymm", "left_right upper_lower m n lda ldb ldc",
+                                   { stats::work::symm, stats::c32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, m, n, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_csymm_sycl)(queue, left_right, upper_lower, m, n, alpha, a,
+                                                    lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
@@ -3597,54 +6007,89 @@ void symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, u
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
           cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_zsymm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
-                                                 lda, b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "zsymm", "left_right upper_lower m n lda ldb ldc",
+                                   { stats::work::symm, stats::c64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, m, n, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zsymm_sycl)(queue, left_right, upper_lower, m, n, alpha, a,
+                                                    lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a,
           std::int64_t lda, float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_ssyrk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                 beta, c, ldc);
+    static stats::routine routine{ trace_site, "ssyrk", "upper_lower trans n k lda ldc",
+                                   { stats::work::syrk, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_ssyrk_sycl)(queue, upper_lower, trans, n, k, alpha, a, lda,
+                                                    beta, c, ldc);
+    });
 }
 
 void syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, double alpha, cl::sycl::buffer<double, 1> &a,
           std::int64_t lda, double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_dsyrk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                 beta, c, ldc);
+    static stats::routine routine{ trace_site, "dsyrk", "upper_lower trans n k lda ldc",
+                                   { stats::work::syrk, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dsyrk_sycl)(queue, upper_lower, trans, n, k, alpha, a, lda,
+                                                    beta, c, ldc);
+    });
 }
 
 void syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, std::complex<float> alpha,
           cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_csyrk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                 beta, c, ldc);
+    static stats::routine routine{ trace_site, "csyrk", "upper_lower trans n k lda ldc",
+                                   { stats::work::syrk, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_csyrk_sycl)(queue, upper_lower, trans, n, k, alpha, a, lda,
+                                                    beta, c, ldc);
+    });
 }
 
 void syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, std::complex<double> alpha,
           cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda, std::complex<double> beta,
           cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_zsyrk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                 beta, c, ldc);
+    static stats::routine routine{ trace_site, "zsyrk", "upper_lower trans n k lda ldc",
+                                   { stats::work::syrk, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zsyrk_sycl)(queue, upper_lower, trans, n, k, alpha, a, lda,
+                                                    beta, c, ldc);
+    });
 }
 
 void syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
            std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a,
            std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
            cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_ssyr2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda, b,
-                                                  ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "ssyr2k", "upper_lower trans n k lda ldb ldc",
+                                   { stats::work::syr2k, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_ssyr2k_sycl)(queue, upper_lower, trans, n, k, alpha, a, lda,
+                                                     b, ldb, beta, c, ldc);
+    });
 }
 
 void syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
            std::int64_t n, std::int64_t k, double alpha, cl::sycl::buffer<double, 1> &a,
            std::int64_t lda, cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
            cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_dsyr2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda, b,
-                                                  ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "dsyr2k", "upper_lower trans n k lda ldb ldc",
+                                   { stats::work::syr2k, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dsyr2k_sycl)(queue, upper_lower, trans, n, k, alpha, a, lda,
+                                                     b, ldb, beta, c, ldc);
+    });
 }
 
 void syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -3652,8 +6097,13 @@ void syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
            cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
            cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
            cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_csyr2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda, b,
-                                                  ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "csyr2k", "upper_lower trans n k lda ldb ldc",
+                                   { stats::work::syr2k, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_csyr2k_sycl)(queue, upper_lower, trans, n, k, alpha, a, lda,
+                                                     b, ldb, beta, c, ldc);
+    });
 }
 
 void syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -3662,72 +6112,125 @@ void syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
            cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
            std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
            std::int64_t ldc) {
-    function_tables[libkey].row_major_zsyr2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda, b,
-                                                  ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "zsyr2k", "upper_lower trans n k lda ldb ldc",
+                                   { stats::work::syr2k, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zsyr2k_sycl)(queue, upper_lower, trans, n, k, alpha, a, lda,
+                                                     b, ldb, beta, c, ldc);
+    });
 }
 
 void trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
           cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
           std::int64_t ldb) {
-    function_tables[libkey].row_major_strmm_sycl(queue, left_right, upper_lower, trans, unit_diag,
-                                                 m, n, alpha, a, lda, b, ldb);
+    static stats::routine routine{ trace_site, "strmm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::f32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_strmm_sycl)(queue, left_right, upper_lower, trans,
+                                                    unit_diag, m, n, alpha, a, lda, b, ldb);
+    });
 }
 
 void trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
           cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
           std::int64_t ldb) {
-    function_tables[libkey].row_major_dtrmm_sycl(queue, left_right, upper_lower, trans, unit_diag,
-                                                 m, n, alpha, a, lda, b, ldb);
+    static stats::routine routine{ trace_site, "dtrmm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::f64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dtrmm_sycl)(queue, left_right, upper_lower, trans,
+                                                    unit_diag, m, n, alpha, a, lda, b, ldb);
+    });
 }
 
 void trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].row_major_ctrmm_sycl(queue, left_right, upper_lower, trans, unit_diag,
-                                                 m, n, alpha, a, lda, b, ldb);
+    static stats::routine routine{ trace_site, "ctrmm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::c32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_ctrmm_sycl)(queue, left_right, upper_lower, trans,
+                                                    unit_diag, m, n, alpha, a, lda, b, ldb);
+    });
 }
 
 void trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
           std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].row_major_ztrmm_sycl(queue, left_right, upper_lower, trans, unit_diag,
-                                                 m, n, alpha, a, lda, b, ldb);
+    static stats::routine routine{ trace_site, "ztrmm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::c64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_ztrmm_sycl)(queue, left_right, upper_lower, trans,
+                                                    unit_diag, m, n, alpha, a, lda, b, ldb);
+    });
 }
 
 void trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
           cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
           std::int64_t ldb) {
-    function_tables[libkey].row_major_strsm_sycl(queue, left_right, upper_lower, trans, unit_diag,
-                                                 m, n, alpha, a, lda, b, ldb);
+    static stats::routine routine{ trace_site, "strsm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::f32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_strsm_sycl)(queue, left_right, upper_lower, trans,
+                                                    unit_diag, m, n, alpha, a, lda, b, ldb);
+    });
 }
 
 void trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
           cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
           std::int64_t ldb) {
-    function_tables[libkey].row_major_dtrsm_sycl(queue, left_right, upper_lower, trans, unit_diag,
-                                                 m, n, alpha, a, lda, b, ldb);
+    static stats::routine routine{ trace_site, "dtrsm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::f64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dtrsm_sycl)(queue, left_right, upper_lower, trans,
+                                                    unit_diag, m, n, alpha, a, lda, b, ldb);
+    });
 }
 
 void trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].row_major_ctrsm_sycl(queue, left_right, upper_lower, trans, unit_diag,
-                                                 m, n, alpha, a, lda, b, ldb);
+    static stats::routine routine{ trace_site, "ctrsm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::c32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_ctrsm_sycl)(queue, left_right, upper_lower, trans,
+                                                    unit_diag, m, n, alpha, a, lda, b, ldb);
+    });
 }
 
 void trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
           std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].row_major_ztrsm_sycl(queue, left_right, upper_lower, trans, unit_diag,
-                                                 m, n, alpha, a, lda, b, ldb);
+    static stats::routine routine{ trace_site, "ztrsm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::c64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_ztrsm_sycl)(queue, left_right, upper_lower, trans,
+                                                    unit_diag, m, n, alpha, a, lda, b, ldb);
+    });
 }
 
 void gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
@@ -3736,9 +6239,16 @@ void gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose tr
                 cl::sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b, float beta,
                 cl::sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
                 std::int64_t batch_size) {
-    function_tables[libkey].row_major_sgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    static stats::routine routine{ trace_site, "sgemm_batch_strided",
+        "transa transb m n k lda stride_a ldb stride_b ldc stride_c batch_size",
+        { stats::work::gemm, stats::f32 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, stride_a, ldb, stride_b, ldc,
+                                    stride_c, batch_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_sgemm_batch_strided_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+            stride_c, batch_size);
+    });
 }
 
 void gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
@@ -3747,9 +6257,16 @@ void gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose tr
                 cl::sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t stride_b,
                 double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
                 std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[libkey].row_major_dgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    static stats::routine routine{ trace_site, "dgemm_batch_strided",
+        "transa transb m n k lda stride_a ldb stride_b ldc stride_c batch_size",
+        { stats::work::gemm, stats::f64 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, stride_a, ldb, stride_b, ldc,
+                                    stride_c, batch_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dgemm_batch_strided_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+            stride_c, batch_size);
+    });
 }
 
 void gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
@@ -3760,9 +6277,16 @@ void gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose tr
                 std::int64_t stride_b, std::complex<float> beta,
                 cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
                 std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[libkey].row_major_cgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    static stats::routine routine{ trace_site, "cgemm_batch_strided",
+        "transa transb m n k lda stride_a ldb stride_b ldc stride_c batch_size",
+        { stats::work::gemm, stats::c32 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, stride_a, ldb, stride_b, ldc,
+                                    stride_c, batch_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_cgemm_batch_strided_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+            stride_c, batch_size);
+    });
 }
 
 void gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
@@ -3773,9 +6297,16 @@ void gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose tr
                 std::int64_t stride_b, std::complex<double> beta,
                 cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
                 std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[libkey].row_major_zgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    static stats::routine routine{ trace_site, "zgemm_batch_strided",
+        "transa transb m n k lda stride_a ldb stride_b ldc stride_c batch_size",
+        { stats::work::gemm, stats::c64 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, stride_a, ldb, stride_b, ldc,
+                                    stride_c, batch_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zgemm_batch_strided_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+            stride_c, batch_size);
+    });
 }
 
 void trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -3783,9 +6314,16 @@ void trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_ri
                 float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
                 cl::sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b,
                 std::int64_t batch_size) {
-    function_tables[libkey].row_major_strsm_batch_strided_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size);
+    static stats::routine routine{ trace_site, "strsm_batch_strided",
+        "left_right upper_lower trans unit_diag m n lda stride_a ldb stride_b batch_size",
+        { stats::work::trmm, stats::f32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, stride_a,
+                                    ldb, stride_b, batch_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_strsm_batch_strided_sycl)(
+            queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
+            stride_b, batch_size);
+    });
 }
 
 void trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -3793,9 +6331,16 @@ void trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_ri
                 double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
                 std::int64_t stride_a, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
                 std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[libkey].row_major_dtrsm_batch_strided_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size);
+    static stats::routine routine{ trace_site, "dtrsm_batch_strided",
+        "left_right upper_lower trans unit_diag m n lda stride_a ldb stride_b batch_size",
+        { stats::work::trmm, stats::f64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, stride_a,
+                                    ldb, stride_b, batch_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dtrsm_batch_strided_sycl)(
+            queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
+            stride_b, batch_size);
+    });
 }
 
 void trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -3804,9 +6349,16 @@ void trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_ri
                 std::int64_t lda, std::int64_t stride_a,
                 cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
                 std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[libkey].row_major_ctrsm_batch_strided_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size);
+    static stats::routine routine{ trace_site, "ctrsm_batch_strided",
+        "left_right upper_lower trans unit_diag m n lda stride_a ldb stride_b batch_size",
+        { stats::work::trmm, stats::c32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, stride_a,
+                                    ldb, stride_b, batch_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_ctrsm_batch_strided_sycl)(
+            queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
+            stride_b, batch_size);
+    });
 }
 
 void trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -3815,25 +6367,44 @@ void trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_ri
                 std::int64_t lda, std::int64_t stride_a,
                 cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
                 std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[libkey].row_major_ztrsm_batch_strided_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size);
+    static stats::routine routine{ trace_site, "ztrsm_batch_strided",
+        "left_right upper_lower trans unit_diag m n lda stride_a ldb stride_b batch_size",
+        { stats::work::trmm, stats::c64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, stride_a,
+                                    ldb, stride_b, batch_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_ztrsm_batch_strided_sycl)(
+            queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
+            stride_b, batch_size);
+    });
 }
 
 void gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose transa,
            transpose transb, std::int64_t n, std::int64_t k, float alpha,
            cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
            std::int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_sgemmt_sycl(queue, upper_lower, transa, transb, n, k, alpha,
-                                                  a, lda, b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "sgemmt",
+                                   "upper_lower transa transb n k lda ldb ldc",
+                                   { stats::work::gemmt, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, transa, transb, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_sgemmt_sycl)(queue, upper_lower, transa, transb, n, k,
+                                                     alpha, a, lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose transa,
            transpose transb, std::int64_t n, std::int64_t k, double alpha,
            cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
            std::int64_t ldb, double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_dgemmt_sycl(queue, upper_lower, transa, transb, n, k, alpha,
-                                                  a, lda, b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "dgemmt",
+                                   "upper_lower transa transb n k lda ldb ldc",
+                                   { stats::work::gemmt, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, transa, transb, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_dgemmt_sycl)(queue, upper_lower, transa, transb, n, k,
+                                                     alpha, a, lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose transa,
@@ -3841,8 +6412,14 @@ void gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
            cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
            cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
            cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_cgemmt_sycl(queue, upper_lower, transa, transb, n, k, alpha,
-                                                  a, lda, b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "cgemmt",
+                                   "upper_lower transa transb n k lda ldb ldc",
+                                   { stats::work::gemmt, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, transa, transb, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_cgemmt_sycl)(queue, upper_lower, transa, transb, n, k,
+                                                     alpha, a, lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower, transpose transa,
@@ -3851,8 +6428,14 @@ void gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
            cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
            std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
            std::int64_t ldc) {
-    function_tables[libkey].row_major_zgemmt_sycl(queue, upper_lower, transa, transb, n, k, alpha,
-                                                  a, lda, b, ldb, beta, c, ldc);
+    static stats::routine routine{ trace_site, "zgemmt",
+                                   "upper_lower transa transb n k lda ldb ldc",
+                                   { stats::work::gemmt, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, transa, transb, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_zgemmt_sycl)(queue, upper_lower, transa, transb, n, k,
+                                                     alpha, a, lda, b, ldb, beta, c, ldc);
+    });
 }
 
 void gemm_bias(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
@@ -3861,8 +6444,15 @@ void gemm_bias(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose tra
                cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, uint8_t bo, float beta,
                cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
                cl::sycl::buffer<int32_t, 1> &co) {
-    function_tables[libkey].row_major_gemm_s8u8s32_bias_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co);
+    static stats::routine routine{ trace_site, "gemm_s8u8s32_bias",
+                                   "transa transb offsetc m n k lda ldb ldc",
+                                   { stats::work::gemm, stats::s8 } };
+    auto shape = verbose::make_dims(transa, transb, offsetc, m, n, k, lda, ldb, ldc);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.row_major_gemm_s8u8s32_bias_sycl)(queue, transa, transb, offsetc, m,
+                                                                n, k, alpha, a, lda, ao, b, ldb, bo,
+                                                                beta, c, ldc, co);
+    });
 }
 
 // USM APIs
@@ -3870,75 +6460,125 @@ void gemm_bias(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose tra
 cl::sycl::event asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const std::complex<float> *x, std::int64_t incx, float *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_scasum_usm_sycl(queue, n, x, incx, result,
-                                                             dependencies);
+    static stats::routine routine{ trace_site, "scasum_usm", "n incx",
+                                   { stats::work::asum, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_scasum_usm_sycl)(queue, n, x, incx, result,
+                                                                dependencies);
+    });
 }
 
 cl::sycl::event asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const std::complex<double> *x, std::int64_t incx, double *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dzasum_usm_sycl(queue, n, x, incx, result,
-                                                             dependencies);
+    static stats::routine routine{ trace_site, "dzasum_usm", "n incx",
+                                   { stats::work::asum, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dzasum_usm_sycl)(queue, n, x, incx, result,
+                                                                dependencies);
+    });
 }
 
 cl::sycl::event asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const float *x, std::int64_t incx, float *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sasum_usm_sycl(queue, n, x, incx, result,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "sasum_usm", "n incx",
+                                   { stats::work::asum, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_sasum_usm_sycl)(queue, n, x, incx, result,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const double *x, std::int64_t incx, double *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dasum_usm_sycl(queue, n, x, incx, result,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "dasum_usm", "n incx",
+                                   { stats::work::asum, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dasum_usm_sycl)(queue, n, x, incx, result,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      float alpha, const float *x, std::int64_t incx, float *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_saxpy_usm_sycl(queue, n, alpha, x, incx, y, incy,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "saxpy_usm", "n incx incy",
+                                   { stats::work::axpy, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_saxpy_usm_sycl)(queue, n, alpha, x, incx, y, incy,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      double alpha, const double *x, std::int64_t incx, double *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_daxpy_usm_sycl(queue, n, alpha, x, incx, y, incy,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "daxpy_usm", "n incx incy",
+                                   { stats::work::axpy, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_daxpy_usm_sycl)(queue, n, alpha, x, incx, y, incy,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      std::complex<float> alpha, const std::complex<float> *x, std::int64_t incx,
                      std::complex<float> *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_caxpy_usm_sycl(queue, n, alpha, x, incx, y, incy,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "caxpy_usm", "n incx incy",
+                                   { stats::work::axpy, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_caxpy_usm_sycl)(queue, n, alpha, x, incx, y, incy,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      std::complex<double> alpha, const std::complex<double> *x, std::int64_t incx,
                      std::complex<double> *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zaxpy_usm_sycl(queue, n, alpha, x, incx, y, incy,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "zaxpy_usm", "n incx incy",
+                                   { stats::work::axpy, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zaxpy_usm_sycl)(queue, n, alpha, x, incx, y, incy,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t *n,
                            float *alpha, const float **x, std::int64_t *incx, float **y,
                            std::int64_t *incy, std::int64_t group_count, std::int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_saxpy_batch_group_usm_sycl(
-        queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    static stats::routine routine{ trace_site, "saxpy_batch_group_usm", "group_count",
+                                   { stats::work::axpy, stats::f32 } };
+    auto shape = verbose::make_dims(group_count);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_saxpy_batch_group_usm_sycl)(
+            queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    });
 }
 
 cl::sycl::event axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t *n,
                            double *alpha, const double **x, std::int64_t *incx, double **y,
                            std::int64_t *incy, std::int64_t group_count, std::int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_daxpy_batch_group_usm_sycl(
-        queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    static stats::routine routine{ trace_site, "daxpy_batch_group_usm", "group_count",
+                                   { stats::work::axpy, stats::f64 } };
+    auto shape = verbose::make_dims(group_count);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_daxpy_batch_group_usm_sycl)(
+            queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    });
 }
 
 cl::sycl::event axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t *n,
@@ -3946,8 +6586,13 @@ cl::sycl::event axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, s
                            std::int64_t *incx, std::complex<float> **y, std::int64_t *incy,
                            std::int64_t group_count, std::int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_caxpy_batch_group_usm_sycl(
-        queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    static stats::routine routine{ trace_site, "caxpy_batch_group_usm", "group_count",
+                                   { stats::work::axpy, stats::c32 } };
+    auto shape = verbose::make_dims(group_count);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_caxpy_batch_group_usm_sycl)(
+            queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    });
 }
 
 cl::sycl::event axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t *n,
@@ -3955,332 +6600,565 @@ cl::sycl::event axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, s
                            std::int64_t *incx, std::complex<double> **y, std::int64_t *incy,
                            std::int64_t group_count, std::int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zaxpy_batch_group_usm_sycl(
-        queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    static stats::routine routine{ trace_site, "zaxpy_batch_group_usm", "group_count",
+                                   { stats::work::axpy, stats::c64 } };
+    auto shape = verbose::make_dims(group_count);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zaxpy_batch_group_usm_sycl)(
+            queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    });
 }
 
 cl::sycl::event copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const float *x, std::int64_t incx, float *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_scopy_usm_sycl(queue, n, x, incx, y, incy,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "scopy_usm", "n incx incy",
+                                   { stats::work::copy, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_scopy_usm_sycl)(queue, n, x, incx, y, incy,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const double *x, std::int64_t incx, double *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dcopy_usm_sycl(queue, n, x, incx, y, incy,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "dcopy_usm", "n incx incy",
+                                   { stats::work::copy, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dcopy_usm_sycl)(queue, n, x, incx, y, incy,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const std::complex<float> *x, std::int64_t incx, std::complex<float> *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ccopy_usm_sycl(queue, n, x, incx, y, incy,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "ccopy_usm", "n incx incy",
+                                   { stats::work::copy, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_ccopy_usm_sycl)(queue, n, x, incx, y, incy,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const std::complex<double> *x, std::int64_t incx, std::complex<double> *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zcopy_usm_sycl(queue, n, x, incx, y, incy,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "zcopy_usm", "n incx incy",
+                                   { stats::work::copy, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zcopy_usm_sycl)(queue, n, x, incx, y, incy,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event dot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                     const float *x, std::int64_t incx, const float *y, std::int64_t incy,
                     float *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sdot_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                           dependencies);
+    static stats::routine routine{ trace_site, "sdot_usm", "n incx incy",
+                                   { stats::work::dot, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_sdot_usm_sycl)(queue, n, x, incx, y, incy, result,
+                                                              dependencies);
+    });
 }
 
 cl::sycl::event dot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                     const double *x, std::int64_t incx, const double *y, std::int64_t incy,
                     double *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ddot_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                           dependencies);
+    static stats::routine routine{ trace_site, "ddot_usm", "n incx incy",
+                                   { stats::work::dot, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_ddot_usm_sycl)(queue, n, x, incx, y, incy, result,
+                                                              dependencies);
+    });
 }
 
 cl::sycl::event dot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                     const float *x, std::int64_t incx, const float *y, std::int64_t incy,
                     double *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dsdot_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "dsdot_usm", "n incx incy",
+                                   { stats::work::dot, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dsdot_usm_sycl)(queue, n, x, incx, y, incy, result,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event dotc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const std::complex<float> *x, std::int64_t incx, const std::complex<float> *y,
                      std::int64_t incy, std::complex<float> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cdotc_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "cdotc_usm", "n incx incy",
+                                   { stats::work::dot, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_cdotc_usm_sycl)(queue, n, x, incx, y, incy, result,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event dotc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const std::complex<double> *x, std::int64_t incx,
                      const std::complex<double> *y, std::int64_t incy, std::complex<double> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zdotc_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "zdotc_usm", "n incx incy",
+                                   { stats::work::dot, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zdotc_usm_sycl)(queue, n, x, incx, y, incy, result,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event dotu(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const std::complex<float> *x, std::int64_t incx, const std::complex<float> *y,
                      std::int64_t incy, std::complex<float> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cdotu_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "cdotu_usm", "n incx incy",
+                                   { stats::work::dot, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_cdotu_usm_sycl)(queue, n, x, incx, y, incy, result,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event dotu(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const std::complex<double> *x, std::int64_t incx,
                      const std::complex<double> *y, std::int64_t incy, std::complex<double> *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zdotu_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "zdotu_usm", "n incx incy",
+                                   { stats::work::dot, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zdotu_usm_sycl)(queue, n, x, incx, y, incy, result,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                       const float *x, std::int64_t incx, std::int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_isamin_usm_sycl(queue, n, x, incx, result,
-                                                             dependencies);
+    static stats::routine routine{ trace_site, "isamin_usm", "n incx",
+                                   { stats::work::iamax, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_isamin_usm_sycl)(queue, n, x, incx, result,
+                                                                dependencies);
+    });
 }
 
 cl::sycl::event iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                       const double *x, std::int64_t incx, std::int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_idamin_usm_sycl(queue, n, x, incx, result,
-                                                             dependencies);
+    static stats::routine routine{ trace_site, "idamin_usm", "n incx",
+                                   { stats::work::iamax, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_idamin_usm_sycl)(queue, n, x, incx, result,
+                                                                dependencies);
+    });
 }
 
 cl::sycl::event iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                       const std::complex<float> *x, std::int64_t incx, std::int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_icamin_usm_sycl(queue, n, x, incx, result,
-                                                             dependencies);
+    static stats::routine routine{ trace_site, "icamin_usm", "n incx",
+                                   { stats::work::iamax, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_icamin_usm_sycl)(queue, n, x, incx, result,
+                                                                dependencies);
+    });
 }
 
 cl::sycl::event iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                       const std::complex<double> *x, std::int64_t incx, std::int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_izamin_usm_sycl(queue, n, x, incx, result,
-                                                             dependencies);
+    static stats::routine routine{ trace_site, "izamin_usm", "n incx",
+                                   { stats::work::iamax, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_izamin_usm_sycl)(queue, n, x, incx, result,
+                                                                dependencies);
+    });
 }
 
 cl::sycl::event iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                       const float *x, std::int64_t incx, std::int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_isamax_usm_sycl(queue, n, x, incx, result,
-                                                             dependencies);
+    static stats::routine routine{ trace_site, "isamax_usm", "n incx",
+                                   { stats::work::iamax, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_isamax_usm_sycl)(queue, n, x, incx, result,
+                                                                dependencies);
+    });
 }
 
 cl::sycl::event iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                       const double *x, std::int64_t incx, std::int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_idamax_usm_sycl(queue, n, x, incx, result,
-                                                             dependencies);
+    static stats::routine routine{ trace_site, "idamax_usm", "n incx",
+                                   { stats::work::iamax, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_idamax_usm_sycl)(queue, n, x, incx, result,
+                                                                dependencies);
+    });
 }
 
 cl::sycl::event iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                       const std::complex<float> *x, std::int64_t incx, std::int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_icamax_usm_sycl(queue, n, x, incx, result,
-                                                             dependencies);
+    static stats::routine routine{ trace_site, "icamax_usm", "n incx",
+                                   { stats::work::iamax, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_icamax_usm_sycl)(queue, n, x, incx, result,
+                                                                dependencies);
+    });
 }
 
 cl::sycl::event iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                       const std::complex<double> *x, std::int64_t incx, std::int64_t *result,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_izamax_usm_sycl(queue, n, x, incx, result,
-                                                             dependencies);
+    static stats::routine routine{ trace_site, "izamax_usm", "n incx",
+                                   { stats::work::iamax, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_izamax_usm_sycl)(queue, n, x, incx, result,
+                                                                dependencies);
+    });
 }
 
 cl::sycl::event nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const std::complex<float> *x, std::int64_t incx, float *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_scnrm2_usm_sycl(queue, n, x, incx, result,
-                                                             dependencies);
+    static stats::routine routine{ trace_site, "scnrm2_usm", "n incx",
+                                   { stats::work::nrm2, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_scnrm2_usm_sycl)(queue, n, x, incx, result,
+                                                                dependencies);
+    });
 }
 
 cl::sycl::event nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const std::complex<double> *x, std::int64_t incx, double *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dznrm2_usm_sycl(queue, n, x, incx, result,
-                                                             dependencies);
+    static stats::routine routine{ trace_site, "dznrm2_usm", "n incx",
+                                   { stats::work::nrm2, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dznrm2_usm_sycl)(queue, n, x, incx, result,
+                                                                dependencies);
+    });
 }
 
 cl::sycl::event nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const float *x, std::int64_t incx, float *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_snrm2_usm_sycl(queue, n, x, incx, result,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "snrm2_usm", "n incx",
+                                   { stats::work::nrm2, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_snrm2_usm_sycl)(queue, n, x, incx, result,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      const double *x, std::int64_t incx, double *result,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dnrm2_usm_sycl(queue, n, x, incx, result,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "dnrm2_usm", "n incx",
+                                   { stats::work::nrm2, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dnrm2_usm_sycl)(queue, n, x, incx, result,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                     std::complex<float> *x, std::int64_t incx, std::complex<float> *y,
                     std::int64_t incy, float c, float s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_srot_usm_sycl(queue, n, x, incx, y, incy, c, s,
-                                                           dependencies);
+    static stats::routine routine{ trace_site, "srot_usm", "n incx incy",
+                                   { stats::work::rot, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_srot_usm_sycl)(queue, n, x, incx, y, incy, c, s,
+                                                              dependencies);
+    });
 }
 
 cl::sycl::event rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                     std::complex<double> *x, std::int64_t incx, std::complex<double> *y,
                     std::int64_t incy, double c, double s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_drot_usm_sycl(queue, n, x, incx, y, incy, c, s,
-                                                           dependencies);
+    static stats::routine routine{ trace_site, "drot_usm", "n incx incy",
+                                   { stats::work::rot, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_drot_usm_sycl)(queue, n, x, incx, y, incy, c, s,
+                                                              dependencies);
+    });
 }
 
 cl::sycl::event rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, float *x,
                     std::int64_t incx, float *y, std::int64_t incy, float c, float s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_csrot_usm_sycl(queue, n, x, incx, y, incy, c, s,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "csrot_usm", "n incx incy",
+                                   { stats::work::rot, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_csrot_usm_sycl)(queue, n, x, incx, y, incy, c, s,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, double *x,
                     std::int64_t incx, double *y, std::int64_t incy, double c, double s,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zdrot_usm_sycl(queue, n, x, incx, y, incy, c, s,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "zdrot_usm", "n incx incy",
+                                   { stats::work::rot, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zdrot_usm_sycl)(queue, n, x, incx, y, incy, c, s,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue, float *a, float *b,
                      float *c, float *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_srotg_usm_sycl(queue, a, b, c, s, dependencies);
+    static stats::routine routine{ trace_site, "srotg_usm", "" };
+    auto shape = verbose::make_dims();
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_srotg_usm_sycl)(queue, a, b, c, s, dependencies);
+    });
 }
 
 cl::sycl::event rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue, double *a, double *b,
                      double *c, double *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_drotg_usm_sycl(queue, a, b, c, s, dependencies);
+    static stats::routine routine{ trace_site, "drotg_usm", "" };
+    auto shape = verbose::make_dims();
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_drotg_usm_sycl)(queue, a, b, c, s, dependencies);
+    });
 }
 
 cl::sycl::event rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::complex<float> *a,
                      std::complex<float> *b, float *c, std::complex<float> *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_crotg_usm_sycl(queue, a, b, c, s, dependencies);
+    static stats::routine routine{ trace_site, "crotg_usm", "" };
+    auto shape = verbose::make_dims();
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_crotg_usm_sycl)(queue, a, b, c, s, dependencies);
+    });
 }
 
 cl::sycl::event rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::complex<double> *a,
                      std::complex<double> *b, double *c, std::complex<double> *s,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zrotg_usm_sycl(queue, a, b, c, s, dependencies);
+    static stats::routine routine{ trace_site, "zrotg_usm", "" };
+    auto shape = verbose::make_dims();
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zrotg_usm_sycl)(queue, a, b, c, s, dependencies);
+    });
 }
 
 cl::sycl::event rotm(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, float *x,
                      std::int64_t incx, float *y, std::int64_t incy, float *param,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_srotm_usm_sycl(queue, n, x, incx, y, incy, param,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "srotm_usm", "n incx incy",
+                                   { stats::work::rot, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_srotm_usm_sycl)(queue, n, x, incx, y, incy, param,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event rotm(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, double *x,
                      std::int64_t incx, double *y, std::int64_t incy, double *param,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_drotm_usm_sycl(queue, n, x, incx, y, incy, param,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "drotm_usm", "n incx incy",
+                                   { stats::work::rot, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_drotm_usm_sycl)(queue, n, x, incx, y, incy, param,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event rotmg(oneapi::mkl::device libkey, cl::sycl::queue &queue, float *d1, float *d2,
                       float *x1, float y1, float *param,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_srotmg_usm_sycl(queue, d1, d2, x1, y1, param,
-                                                             dependencies);
+    static stats::routine routine{ trace_site, "srotmg_usm", "" };
+    auto shape = verbose::make_dims();
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_srotmg_usm_sycl)(queue, d1, d2, x1, y1, param,
+                                                                dependencies);
+    });
 }
 
 cl::sycl::event rotmg(oneapi::mkl::device libkey, cl::sycl::queue &queue, double *d1, double *d2,
                       double *x1, double y1, double *param,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_drotmg_usm_sycl(queue, d1, d2, x1, y1, param,
-                                                             dependencies);
+    static stats::routine routine{ trace_site, "drotmg_usm", "" };
+    auto shape = verbose::make_dims();
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_drotmg_usm_sycl)(queue, d1, d2, x1, y1, param,
+                                                                dependencies);
+    });
 }
 
 cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      float alpha, float *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sscal_usm_sycl(queue, n, alpha, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "sscal_usm", "n incx",
+                                   { stats::work::scal, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_sscal_usm_sycl)(queue, n, alpha, x, incx,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      double alpha, double *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dscal_usm_sycl(queue, n, alpha, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "dscal_usm", "n incx",
+                                   { stats::work::scal, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dscal_usm_sycl)(queue, n, alpha, x, incx,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      std::complex<float> alpha, std::complex<float> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cscal_usm_sycl(queue, n, alpha, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "cscal_usm", "n incx",
+                                   { stats::work::scal, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_cscal_usm_sycl)(queue, n, alpha, x, incx,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      std::complex<double> alpha, std::complex<double> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_csscal_usm_sycl(queue, n, alpha, x, incx,
-                                                             dependencies);
+    static stats::routine routine{ trace_site, "csscal_usm", "n incx",
+                                   { stats::work::scal, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_csscal_usm_sycl)(queue, n, alpha, x, incx,
+                                                                dependencies);
+    });
 }
 
 cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      float alpha, std::complex<float> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zscal_usm_sycl(queue, n, alpha, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "zscal_usm", "n incx",
+                                   { stats::work::scal, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zscal_usm_sycl)(queue, n, alpha, x, incx,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      double alpha, std::complex<double> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zdscal_usm_sycl(queue, n, alpha, x, incx,
-                                                             dependencies);
+    static stats::routine routine{ trace_site, "zdscal_usm", "n incx",
+                                   { stats::work::scal, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zdscal_usm_sycl)(queue, n, alpha, x, incx,
+                                                                dependencies);
+    });
 }
 
 cl::sycl::event sdsdot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, float sb,
                        const float *x, std::int64_t incx, const float *y, std::int64_t incy,
                        float *result, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sdsdot_usm_sycl(queue, n, sb, x, incx, y, incy, result,
-                                                             dependencies);
+    static stats::routine routine{ trace_site, "sdsdot_usm", "n incx incy",
+                                   { stats::work::dot, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_sdsdot_usm_sycl)(queue, n, sb, x, incx, y, incy,
+                                                                result, dependencies);
+    });
 }
 
 cl::sycl::event swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, float *x,
                      std::int64_t incx, float *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sswap_usm_sycl(queue, n, x, incx, y, incy,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "sswap_usm", "n incx incy",
+                                   { stats::work::swap, stats::f32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_sswap_usm_sycl)(queue, n, x, incx, y, incy,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n, double *x,
                      std::int64_t incx, double *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dswap_usm_sycl(queue, n, x, incx, y, incy,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "dswap_usm", "n incx incy",
+                                   { stats::work::swap, stats::f64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dswap_usm_sycl)(queue, n, x, incx, y, incy,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      std::complex<float> *x, std::int64_t incx, std::complex<float> *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cswap_usm_sycl(queue, n, x, incx, y, incy,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "cswap_usm", "n incx incy",
+                                   { stats::work::swap, stats::c32 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_cswap_usm_sycl)(queue, n, x, incx, y, incy,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
                      std::complex<double> *x, std::int64_t incx, std::complex<double> *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zswap_usm_sycl(queue, n, x, incx, y, incy,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "zswap_usm", "n incx incy",
+                                   { stats::work::swap, stats::c64 } };
+    auto shape = verbose::make_dims(n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zswap_usm_sycl)(queue, n, x, incx, y, incy,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
@@ -4288,8 +7166,13 @@ cl::sycl::event gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      const float *a, std::int64_t lda, const float *x, std::int64_t incx,
                      float beta, float *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sgbmv_usm_sycl(
-        queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "sgbmv_usm", "trans m n kl ku lda incx incy",
+                                   { stats::work::gbmv, stats::f32 } };
+    auto shape = verbose::make_dims(trans, m, n, kl, ku, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_sgbmv_usm_sycl)(
+            queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
@@ -4297,8 +7180,13 @@ cl::sycl::event gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      const double *a, std::int64_t lda, const double *x, std::int64_t incx,
                      double beta, double *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dgbmv_usm_sycl(
-        queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "dgbmv_usm", "trans m n kl ku lda incx incy",
+                                   { stats::work::gbmv, stats::f64 } };
+    auto shape = verbose::make_dims(trans, m, n, kl, ku, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dgbmv_usm_sycl)(
+            queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
@@ -4307,8 +7195,13 @@ cl::sycl::event gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      const std::complex<float> *x, std::int64_t incx, std::complex<float> beta,
                      std::complex<float> *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cgbmv_usm_sycl(
-        queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "cgbmv_usm", "trans m n kl ku lda incx incy",
+                                   { stats::work::gbmv, stats::c32 } };
+    auto shape = verbose::make_dims(trans, m, n, kl, ku, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_cgbmv_usm_sycl)(
+            queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
@@ -4317,16 +7210,26 @@ cl::sycl::event gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      const std::complex<double> *x, std::int64_t incx, std::complex<double> beta,
                      std::complex<double> *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zgbmv_usm_sycl(
-        queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "zgbmv_usm", "trans m n kl ku lda incx incy",
+                                   { stats::work::gbmv, stats::c64 } };
+    auto shape = verbose::make_dims(trans, m, n, kl, ku, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zgbmv_usm_sycl)(
+            queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
                      std::int64_t m, std::int64_t n, float alpha, const float *a, std::int64_t lda,
                      const float *x, std::int64_t incx, float beta, float *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sgemv_usm_sycl(queue, trans, m, n, alpha, a, lda, x,
-                                                            incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "sgemv_usm", "trans m n lda incx incy",
+                                   { stats::work::gemv, stats::f32 } };
+    auto shape = verbose::make_dims(trans, m, n, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_sgemv_usm_sycl)(queue, trans, m, n, alpha, a, lda, x,
+                                                               incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
@@ -4334,8 +7237,13 @@ cl::sycl::event gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      std::int64_t lda, const double *x, std::int64_t incx, double beta, double *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dgemv_usm_sycl(queue, trans, m, n, alpha, a, lda, x,
-                                                            incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "dgemv_usm", "trans m n lda incx incy",
+                                   { stats::work::gemv, stats::f64 } };
+    auto shape = verbose::make_dims(trans, m, n, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dgemv_usm_sycl)(queue, trans, m, n, alpha, a, lda, x,
+                                                               incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
@@ -4344,8 +7252,13 @@ cl::sycl::event gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      std::int64_t incx, std::complex<float> beta, std::complex<float> *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cgemv_usm_sycl(queue, trans, m, n, alpha, a, lda, x,
-                                                            incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "cgemv_usm", "trans m n lda incx incy",
+                                   { stats::work::gemv, stats::c32 } };
+    auto shape = verbose::make_dims(trans, m, n, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_cgemv_usm_sycl)(queue, trans, m, n, alpha, a, lda, x,
+                                                               incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
@@ -4354,24 +7267,39 @@ cl::sycl::event gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      std::int64_t incx, std::complex<double> beta, std::complex<double> *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zgemv_usm_sycl(queue, trans, m, n, alpha, a, lda, x,
-                                                            incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "zgemv_usm", "trans m n lda incx incy",
+                                   { stats::work::gemv, stats::c64 } };
+    auto shape = verbose::make_dims(trans, m, n, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zgemv_usm_sycl)(queue, trans, m, n, alpha, a, lda, x,
+                                                               incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event ger(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m,
                     std::int64_t n, float alpha, const float *x, std::int64_t incx, const float *y,
                     std::int64_t incy, float *a, std::int64_t lda,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sger_usm_sycl(queue, m, n, alpha, x, incx, y, incy, a,
-                                                           lda, dependencies);
+    static stats::routine routine{ trace_site, "sger_usm", "m n incx incy lda",
+                                   { stats::work::ger, stats::f32 } };
+    auto shape = verbose::make_dims(m, n, incx, incy, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_sger_usm_sycl)(queue, m, n, alpha, x, incx, y, incy,
+                                                              a, lda, dependencies);
+    });
 }
 
 cl::sycl::event ger(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m,
                     std::int64_t n, double alpha, const double *x, std::int64_t incx,
                     const double *y, std::int64_t incy, double *a, std::int64_t lda,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dger_usm_sycl(queue, m, n, alpha, x, incx, y, incy, a,
-                                                           lda, dependencies);
+    static stats::routine routine{ trace_site, "dger_usm", "m n incx incy lda",
+                                   { stats::work::ger, stats::f64 } };
+    auto shape = verbose::make_dims(m, n, incx, incy, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dger_usm_sycl)(queue, m, n, alpha, x, incx, y, incy,
+                                                              a, lda, dependencies);
+    });
 }
 
 cl::sycl::event gerc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m,
@@ -4379,8 +7307,13 @@ cl::sycl::event gerc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::in
                      std::int64_t incx, const std::complex<float> *y, std::int64_t incy,
                      std::complex<float> *a, std::int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cgerc_usm_sycl(queue, m, n, alpha, x, incx, y, incy, a,
-                                                            lda, dependencies);
+    static stats::routine routine{ trace_site, "cgerc_usm", "m n incx incy lda",
+                                   { stats::work::ger, stats::c32 } };
+    auto shape = verbose::make_dims(m, n, incx, incy, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_cgerc_usm_sycl)(queue, m, n, alpha, x, incx, y, incy,
+                                                               a, lda, dependencies);
+    });
 }
 
 cl::sycl::event gerc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m,
@@ -4388,8 +7321,13 @@ cl::sycl::event gerc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::in
                      std::int64_t incx, const std::complex<double> *y, std::int64_t incy,
                      std::complex<double> *a, std::int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zgerc_usm_sycl(queue, m, n, alpha, x, incx, y, incy, a,
-                                                            lda, dependencies);
+    static stats::routine routine{ trace_site, "zgerc_usm", "m n incx incy lda",
+                                   { stats::work::ger, stats::c64 } };
+    auto shape = verbose::make_dims(m, n, incx, incy, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zgerc_usm_sycl)(queue, m, n, alpha, x, incx, y, incy,
+                                                               a, lda, dependencies);
+    });
 }
 
 cl::sycl::event geru(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m,
@@ -4397,8 +7335,13 @@ cl::sycl::event geru(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::in
                      std::int64_t incx, const std::complex<float> *y, std::int64_t incy,
                      std::complex<float> *a, std::int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cgeru_usm_sycl(queue, m, n, alpha, x, incx, y, incy, a,
-                                                            lda, dependencies);
+    static stats::routine routine{ trace_site, "cgeru_usm", "m n incx incy lda",
+                                   { stats::work::ger, stats::c32 } };
+    auto shape = verbose::make_dims(m, n, incx, incy, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_cgeru_usm_sycl)(queue, m, n, alpha, x, incx, y, incy,
+                                                               a, lda, dependencies);
+    });
 }
 
 cl::sycl::event geru(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m,
@@ -4406,8 +7349,13 @@ cl::sycl::event geru(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::in
                      std::int64_t incx, const std::complex<double> *y, std::int64_t incy,
                      std::complex<double> *a, std::int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zgeru_usm_sycl(queue, m, n, alpha, x, incx, y, incy, a,
-                                                            lda, dependencies);
+    static stats::routine routine{ trace_site, "zgeru_usm", "m n incx incy lda",
+                                   { stats::work::ger, stats::c64 } };
+    auto shape = verbose::make_dims(m, n, incx, incy, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zgeru_usm_sycl)(queue, m, n, alpha, x, incx, y, incy,
+                                                               a, lda, dependencies);
+    });
 }
 
 cl::sycl::event hbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -4416,8 +7364,13 @@ cl::sycl::event hbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t incx, std::complex<float> beta, std::complex<float> *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_chbmv_usm_sycl(queue, upper_lower, n, k, alpha, a, lda,
-                                                            x, incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "chbmv_usm", "upper_lower n k lda incx incy",
+                                   { stats::work::sbmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, k, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_chbmv_usm_sycl)(
+            queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event hbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -4426,8 +7379,13 @@ cl::sycl::event hbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t incx, std::complex<double> beta, std::complex<double> *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zhbmv_usm_sycl(queue, upper_lower, n, k, alpha, a, lda,
-                                                            x, incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "zhbmv_usm", "upper_lower n k lda incx incy",
+                                   { stats::work::sbmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, k, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zhbmv_usm_sycl)(
+            queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event hemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -4435,8 +7393,13 @@ cl::sycl::event hemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t lda, const std::complex<float> *x, std::int64_t incx,
                      std::complex<float> beta, std::complex<float> *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_chemv_usm_sycl(queue, upper_lower, n, alpha, a, lda, x,
-                                                            incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "chemv_usm", "upper_lower n lda incx incy",
+                                   { stats::work::symv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_chemv_usm_sycl)(
+            queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event hemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -4444,24 +7407,39 @@ cl::sycl::event hemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t lda, const std::complex<double> *x, std::int64_t incx,
                      std::complex<double> beta, std::complex<double> *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zhemv_usm_sycl(queue, upper_lower, n, alpha, a, lda, x,
-                                                            incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "zhemv_usm", "upper_lower n lda incx incy",
+                                   { stats::work::symv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zhemv_usm_sycl)(
+            queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event her(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                     std::int64_t n, float alpha, const std::complex<float> *x, std::int64_t incx,
                     std::complex<float> *a, std::int64_t lda,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cher_usm_sycl(queue, upper_lower, n, alpha, x, incx, a,
-                                                           lda, dependencies);
+    static stats::routine routine{ trace_site, "cher_usm", "upper_lower n incx lda",
+                                   { stats::work::syr, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_cher_usm_sycl)(queue, upper_lower, n, alpha, x, incx,
+                                                              a, lda, dependencies);
+    });
 }
 
 cl::sycl::event her(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                     std::int64_t n, double alpha, const std::complex<double> *x, std::int64_t incx,
                     std::complex<double> *a, std::int64_t lda,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zher_usm_sycl(queue, upper_lower, n, alpha, x, incx, a,
-                                                           lda, dependencies);
+    static stats::routine routine{ trace_site, "zher_usm", "upper_lower n incx lda",
+                                   { stats::work::syr, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zher_usm_sycl)(queue, upper_lower, n, alpha, x, incx,
+                                                              a, lda, dependencies);
+    });
 }
 
 cl::sycl::event her2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -4469,8 +7447,13 @@ cl::sycl::event her2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t incx, const std::complex<float> *y, std::int64_t incy,
                      std::complex<float> *a, std::int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cher2_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                            y, incy, a, lda, dependencies);
+    static stats::routine routine{ trace_site, "cher2_usm", "upper_lower n incx incy lda",
+                                   { stats::work::syr2, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_cher2_usm_sycl)(queue, upper_lower, n, alpha, x,
+                                                               incx, y, incy, a, lda, dependencies);
+    });
 }
 
 cl::sycl::event her2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -4478,8 +7461,13 @@ cl::sycl::event her2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t incx, const std::complex<double> *y, std::int64_t incy,
                      std::complex<double> *a, std::int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zher2_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                            y, incy, a, lda, dependencies);
+    static stats::routine routine{ trace_site, "zher2_usm", "upper_lower n incx incy lda",
+                                   { stats::work::syr2, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zher2_usm_sycl)(queue, upper_lower, n, alpha, x,
+                                                               incx, y, incy, a, lda, dependencies);
+    });
 }
 
 cl::sycl::event hpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -4487,8 +7475,13 @@ cl::sycl::event hpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<float> *x, std::int64_t incx, std::complex<float> beta,
                      std::complex<float> *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_chpmv_usm_sycl(queue, upper_lower, n, alpha, a, x,
-                                                            incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "chpmv_usm", "upper_lower n incx incy",
+                                   { stats::work::symv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_chpmv_usm_sycl)(queue, upper_lower, n, alpha, a, x,
+                                                               incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event hpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -4496,24 +7489,39 @@ cl::sycl::event hpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<double> *x, std::int64_t incx, std::complex<double> beta,
                      std::complex<double> *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zhpmv_usm_sycl(queue, upper_lower, n, alpha, a, x,
-                                                            incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "zhpmv_usm", "upper_lower n incx incy",
+                                   { stats::work::symv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zhpmv_usm_sycl)(queue, upper_lower, n, alpha, a, x,
+                                                               incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event hpr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                     std::int64_t n, float alpha, const std::complex<float> *x, std::int64_t incx,
                     std::complex<float> *a,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_chpr_usm_sycl(queue, upper_lower, n, alpha, x, incx, a,
-                                                           dependencies);
+    static stats::routine routine{ trace_site, "chpr_usm", "upper_lower n incx",
+                                   { stats::work::syr, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_chpr_usm_sycl)(queue, upper_lower, n, alpha, x, incx,
+                                                              a, dependencies);
+    });
 }
 
 cl::sycl::event hpr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                     std::int64_t n, double alpha, const std::complex<double> *x, std::int64_t incx,
                     std::complex<double> *a,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zhpr_usm_sycl(queue, upper_lower, n, alpha, x, incx, a,
-                                                           dependencies);
+    static stats::routine routine{ trace_site, "zhpr_usm", "upper_lower n incx",
+                                   { stats::work::syr, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zhpr_usm_sycl)(queue, upper_lower, n, alpha, x, incx,
+                                                              a, dependencies);
+    });
 }
 
 cl::sycl::event hpr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -4521,8 +7529,13 @@ cl::sycl::event hpr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t incx, const std::complex<float> *y, std::int64_t incy,
                      std::complex<float> *a,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_chpr2_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                            y, incy, a, dependencies);
+    static stats::routine routine{ trace_site, "chpr2_usm", "upper_lower n incx incy",
+                                   { stats::work::syr2, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_chpr2_usm_sycl)(queue, upper_lower, n, alpha, x,
+                                                               incx, y, incy, a, dependencies);
+    });
 }
 
 cl::sycl::event hpr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -4530,16 +7543,26 @@ cl::sycl::event hpr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t incx, const std::complex<double> *y, std::int64_t incy,
                      std::complex<double> *a,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zhpr2_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                            y, incy, a, dependencies);
+    static stats::routine routine{ trace_site, "zhpr2_usm", "upper_lower n incx incy",
+                                   { stats::work::syr2, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zhpr2_usm_sycl)(queue, upper_lower, n, alpha, x,
+                                                               incx, y, incy, a, dependencies);
+    });
 }
 
 cl::sycl::event sbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda,
                      const float *x, std::int64_t incx, float beta, float *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ssbmv_usm_sycl(queue, upper_lower, n, k, alpha, a, lda,
-                                                            x, incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "ssbmv_usm", "upper_lower n k lda incx incy",
+                                   { stats::work::sbmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, k, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_ssbmv_usm_sycl)(
+            queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event sbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -4547,116 +7570,193 @@ cl::sycl::event sbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      std::int64_t lda, const double *x, std::int64_t incx, double beta, double *y,
                      std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dsbmv_usm_sycl(queue, upper_lower, n, k, alpha, a, lda,
-                                                            x, incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "dsbmv_usm", "upper_lower n k lda incx incy",
+                                   { stats::work::sbmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, k, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dsbmv_usm_sycl)(
+            queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event spmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      std::int64_t n, float alpha, const float *a, const float *x, std::int64_t incx,
                      float beta, float *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sspmv_usm_sycl(queue, upper_lower, n, alpha, a, x,
-                                                            incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "sspmv_usm", "upper_lower n incx incy",
+                                   { stats::work::symv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_sspmv_usm_sycl)(queue, upper_lower, n, alpha, a, x,
+                                                               incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event spmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      std::int64_t n, double alpha, const double *a, const double *x,
                      std::int64_t incx, double beta, double *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dspmv_usm_sycl(queue, upper_lower, n, alpha, a, x,
-                                                            incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "dspmv_usm", "upper_lower n incx incy",
+                                   { stats::work::symv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dspmv_usm_sycl)(queue, upper_lower, n, alpha, a, x,
+                                                               incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event spr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                     std::int64_t n, float alpha, const float *x, std::int64_t incx, float *a,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sspr_usm_sycl(queue, upper_lower, n, alpha, x, incx, a,
-                                                           dependencies);
+    static stats::routine routine{ trace_site, "sspr_usm", "upper_lower n incx",
+                                   { stats::work::syr, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_sspr_usm_sycl)(queue, upper_lower, n, alpha, x, incx,
+                                                              a, dependencies);
+    });
 }
 
 cl::sycl::event spr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                     std::int64_t n, double alpha, const double *x, std::int64_t incx, double *a,
                     const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dspr_usm_sycl(queue, upper_lower, n, alpha, x, incx, a,
-                                                           dependencies);
+    static stats::routine routine{ trace_site, "dspr_usm", "upper_lower n incx",
+                                   { stats::work::syr, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dspr_usm_sycl)(queue, upper_lower, n, alpha, x, incx,
+                                                              a, dependencies);
+    });
 }
 
 cl::sycl::event spr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      std::int64_t n, float alpha, const float *x, std::int64_t incx, const float *y,
                      std::int64_t incy, float *a,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sspr2_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                            y, incy, a, dependencies);
+    static stats::routine routine{ trace_site, "sspr2_usm", "upper_lower n incx incy",
+                                   { stats::work::syr2, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_sspr2_usm_sycl)(queue, upper_lower, n, alpha, x,
+                                                               incx, y, incy, a, dependencies);
+    });
 }
 
 cl::sycl::event spr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      std::int64_t n, double alpha, const double *x, std::int64_t incx,
                      const double *y, std::int64_t incy, double *a,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dspr2_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                            y, incy, a, dependencies);
+    static stats::routine routine{ trace_site, "dspr2_usm", "upper_lower n incx incy",
+                                   { stats::work::syr2, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dspr2_usm_sycl)(queue, upper_lower, n, alpha, x,
+                                                               incx, y, incy, a, dependencies);
+    });
 }
 
 cl::sycl::event symv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      std::int64_t n, float alpha, const float *a, std::int64_t lda, const float *x,
                      std::int64_t incx, float beta, float *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ssymv_usm_sycl(queue, upper_lower, n, alpha, a, lda, x,
-                                                            incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "ssymv_usm", "upper_lower n lda incx incy",
+                                   { stats::work::symv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_ssymv_usm_sycl)(
+            queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event symv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      std::int64_t n, double alpha, const double *a, std::int64_t lda,
                      const double *x, std::int64_t incx, double beta, double *y, std::int64_t incy,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dsymv_usm_sycl(queue, upper_lower, n, alpha, a, lda, x,
-                                                            incx, beta, y, incy, dependencies);
+    static stats::routine routine{ trace_site, "dsymv_usm", "upper_lower n lda incx incy",
+                                   { stats::work::symv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, lda, incx, incy);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dsymv_usm_sycl)(
+            queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    });
 }
 
 cl::sycl::event syr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                     std::int64_t n, float alpha, const float *x, std::int64_t incx, float *a,
                     std::int64_t lda, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ssyr_usm_sycl(queue, upper_lower, n, alpha, x, incx, a,
-                                                           lda, dependencies);
+    static stats::routine routine{ trace_site, "ssyr_usm", "upper_lower n incx lda",
+                                   { stats::work::syr, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_ssyr_usm_sycl)(queue, upper_lower, n, alpha, x, incx,
+                                                              a, lda, dependencies);
+    });
 }
 
 cl::sycl::event syr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                     std::int64_t n, double alpha, const double *x, std::int64_t incx, double *a,
                     std::int64_t lda, const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dsyr_usm_sycl(queue, upper_lower, n, alpha, x, incx, a,
-                                                           lda, dependencies);
+    static stats::routine routine{ trace_site, "dsyr_usm", "upper_lower n incx lda",
+                                   { stats::work::syr, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dsyr_usm_sycl)(queue, upper_lower, n, alpha, x, incx,
+                                                              a, lda, dependencies);
+    });
 }
 
 cl::sycl::event syr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      std::int64_t n, float alpha, const float *x, std::int64_t incx, const float *y,
                      std::int64_t incy, float *a, std::int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ssyr2_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                            y, incy, a, lda, dependencies);
+    static stats::routine routine{ trace_site, "ssyr2_usm", "upper_lower n incx incy lda",
+                                   { stats::work::syr2, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_ssyr2_usm_sycl)(queue, upper_lower, n, alpha, x,
+                                                               incx, y, incy, a, lda, dependencies);
+    });
 }
 
 cl::sycl::event syr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      std::int64_t n, double alpha, const double *x, std::int64_t incx,
                      const double *y, std::int64_t incy, double *a, std::int64_t lda,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dsyr2_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                            y, incy, a, lda, dependencies);
+    static stats::routine routine{ trace_site, "dsyr2_usm", "upper_lower n incx incy lda",
+                                   { stats::work::syr2, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, n, incx, incy, lda);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dsyr2_usm_sycl)(queue, upper_lower, n, alpha, x,
+                                                               incx, y, incy, a, lda, dependencies);
+    });
 }
 
 cl::sycl::event tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
                      const float *a, std::int64_t lda, float *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_stbmv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            k, a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "stbmv_usm",
+                                   "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_stbmv_usm_sycl)(queue, upper_lower, trans, unit_diag,
+                                                               n, k, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
                      const double *a, std::int64_t lda, double *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dtbmv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            k, a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "dtbmv_usm",
+                                   "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dtbmv_usm_sycl)(queue, upper_lower, trans, unit_diag,
+                                                               n, k, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -4664,8 +7764,14 @@ cl::sycl::event tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<float> *a, std::int64_t lda, std::complex<float> *x,
                      std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ctbmv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            k, a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "ctbmv_usm",
+                                   "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_ctbmv_usm_sycl)(queue, upper_lower, trans, unit_diag,
+                                                               n, k, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -4673,24 +7779,42 @@ cl::sycl::event tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<double> *a, std::int64_t lda, std::complex<double> *x,
                      std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ztbmv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            k, a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "ztbmv_usm",
+                                   "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_ztbmv_usm_sycl)(queue, upper_lower, trans, unit_diag,
+                                                               n, k, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
                      const float *a, std::int64_t lda, float *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_stbsv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            k, a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "stbsv_usm",
+                                   "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_stbsv_usm_sycl)(queue, upper_lower, trans, unit_diag,
+                                                               n, k, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
                      const double *a, std::int64_t lda, double *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dtbsv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            k, a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "dtbsv_usm",
+                                   "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dtbsv_usm_sycl)(queue, upper_lower, trans, unit_diag,
+                                                               n, k, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -4698,8 +7822,14 @@ cl::sycl::event tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<float> *a, std::int64_t lda, std::complex<float> *x,
                      std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ctbsv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            k, a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "ctbsv_usm",
+                                   "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_ctbsv_usm_sycl)(queue, upper_lower, trans, unit_diag,
+                                                               n, k, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -4707,136 +7837,230 @@ cl::sycl::event tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<double> *a, std::int64_t lda, std::complex<double> *x,
                      std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ztbsv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            k, a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "ztbsv_usm",
+                                   "upper_lower trans unit_diag n k lda incx",
+                                   { stats::work::tbmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, k, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_ztbsv_usm_sycl)(queue, upper_lower, trans, unit_diag,
+                                                               n, k, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const float *a, float *x,
                      std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_stpmv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "stpmv_usm", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_stpmv_usm_sycl)(queue, upper_lower, trans, unit_diag,
+                                                               n, a, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const double *a, double *x,
                      std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dtpmv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "dtpmv_usm", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dtpmv_usm_sycl)(queue, upper_lower, trans, unit_diag,
+                                                               n, a, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const std::complex<float> *a,
                      std::complex<float> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ctpmv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "ctpmv_usm", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_ctpmv_usm_sycl)(queue, upper_lower, trans, unit_diag,
+                                                               n, a, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const std::complex<double> *a,
                      std::complex<double> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ztpmv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "ztpmv_usm", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_ztpmv_usm_sycl)(queue, upper_lower, trans, unit_diag,
+                                                               n, a, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const float *a, float *x,
                      std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_stpsv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "stpsv_usm", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_stpsv_usm_sycl)(queue, upper_lower, trans, unit_diag,
+                                                               n, a, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const double *a, double *x,
                      std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dtpsv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "dtpsv_usm", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dtpsv_usm_sycl)(queue, upper_lower, trans, unit_diag,
+                                                               n, a, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const std::complex<float> *a,
                      std::complex<float> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ctpsv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "ctpsv_usm", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_ctpsv_usm_sycl)(queue, upper_lower, trans, unit_diag,
+                                                               n, a, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const std::complex<double> *a,
                      std::complex<double> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ztpsv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "ztpsv_usm", "upper_lower trans unit_diag n incx",
+                                   { stats::work::trmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_ztpsv_usm_sycl)(queue, upper_lower, trans, unit_diag,
+                                                               n, a, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const float *a,
                      std::int64_t lda, float *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_strmv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "strmv_usm",
+                                   "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_strmv_usm_sycl)(queue, upper_lower, trans, unit_diag,
+                                                               n, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const double *a,
                      std::int64_t lda, double *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dtrmv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "dtrmv_usm",
+                                   "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dtrmv_usm_sycl)(queue, upper_lower, trans, unit_diag,
+                                                               n, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const std::complex<float> *a,
                      std::int64_t lda, std::complex<float> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ctrmv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "ctrmv_usm",
+                                   "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_ctrmv_usm_sycl)(queue, upper_lower, trans, unit_diag,
+                                                               n, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const std::complex<double> *a,
                      std::int64_t lda, std::complex<double> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ztrmv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "ztrmv_usm",
+                                   "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_ztrmv_usm_sycl)(queue, upper_lower, trans, unit_diag,
+                                                               n, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const float *a,
                      std::int64_t lda, float *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_strsv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "strsv_usm",
+                                   "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_strsv_usm_sycl)(queue, upper_lower, trans, unit_diag,
+                                                               n, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const double *a,
                      std::int64_t lda, double *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dtrsv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "dtrsv_usm",
+                                   "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dtrsv_usm_sycl)(queue, upper_lower, trans, unit_diag,
+                                                               n, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const std::complex<float> *a,
                      std::int64_t lda, std::complex<float> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ctrsv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "ctrsv_usm",
+                                   "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_ctrsv_usm_sycl)(queue, upper_lower, trans, unit_diag,
+                                                               n, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, diag unit_diag, std::int64_t n, const std::complex<double> *a,
                      std::int64_t lda, std::complex<double> *x, std::int64_t incx,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ztrsv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, lda, x, incx, dependencies);
+    static stats::routine routine{ trace_site, "ztrsv_usm",
+                                   "upper_lower trans unit_diag n lda incx",
+                                   { stats::work::trmv, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, unit_diag, n, lda, incx);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_ztrsv_usm_sycl)(queue, upper_lower, trans, unit_diag,
+                                                               n, a, lda, x, incx, dependencies);
+    });
 }
 
 cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
@@ -4844,8 +8068,13 @@ cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      const float *a, std::int64_t lda, const float *b, std::int64_t ldb, float beta,
                      float *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "sgemm_usm", "transa transb m n k lda ldb ldc",
+                                   { stats::work::gemm, stats::f32 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_sgemm_usm_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
@@ -4853,8 +8082,13 @@ cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      const double *a, std::int64_t lda, const double *b, std::int64_t ldb,
                      double beta, double *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "dgemm_usm", "transa transb m n k lda ldb ldc",
+                                   { stats::work::gemm, stats::f64 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dgemm_usm_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
@@ -4863,8 +8097,13 @@ cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
                      std::complex<float> *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "cgemm_usm", "transa transb m n k lda ldb ldc",
+                                   { stats::work::gemm, stats::c32 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_cgemm_usm_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
@@ -4873,8 +8112,13 @@ cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpo
                      const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
                      std::complex<double> *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "zgemm_usm", "transa transb m n k lda ldb ldc",
+                                   { stats::work::gemm, stats::c64 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zgemm_usm_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event hemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -4883,8 +8127,15 @@ cl::sycl::event hemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
                      std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_chemm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "chemm_usm",
+                                   "left_right upper_lower m n lda ldb ldc",
+                                   { stats::work::symm, stats::c32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, m, n, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_chemm_usm_sycl)(queue, left_right, upper_lower, m, n,
+                                                               alpha, a, lda, b, ldb, beta, c, ldc,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event hemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -4893,8 +8144,15 @@ cl::sycl::event hemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t ldb, std::complex<double> beta, std::complex<double> *c,
                      std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zhemm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "zhemm_usm",
+                                   "left_right upper_lower m n lda ldb ldc",
+                                   { stats::work::symm, stats::c64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, m, n, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zhemm_usm_sycl)(queue, left_right, upper_lower, m, n,
+                                                               alpha, a, lda, b, ldb, beta, c, ldc,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event herk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -4902,8 +8160,13 @@ cl::sycl::event herk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<float> *a, std::int64_t lda, float beta,
                      std::complex<float> *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cherk_usm_sycl(queue, upper_lower, trans, n, k, alpha,
-                                                            a, lda, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "cherk_usm", "upper_lower trans n k lda ldc",
+                                   { stats::work::syrk, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_cherk_usm_sycl)(
+            queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event herk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -4911,8 +8174,13 @@ cl::sycl::event herk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<double> *a, std::int64_t lda, double beta,
                      std::complex<double> *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zherk_usm_sycl(queue, upper_lower, trans, n, k, alpha,
-                                                            a, lda, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "zherk_usm", "upper_lower trans n k lda ldc",
+                                   { stats::work::syrk, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zherk_usm_sycl)(
+            queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event her2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -4920,8 +8188,13 @@ cl::sycl::event her2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
                       std::int64_t ldb, float beta, std::complex<float> *c, std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cher2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "cher2k_usm", "upper_lower trans n k lda ldb ldc",
+                                   { stats::work::syr2k, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_cher2k_usm_sycl)(
+            queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event her2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -4930,8 +8203,13 @@ cl::sycl::event her2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       const std::complex<double> *b, std::int64_t ldb, double beta,
                       std::complex<double> *c, std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zher2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "zher2k_usm", "upper_lower trans n k lda ldb ldc",
+                                   { stats::work::syr2k, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zher2k_usm_sycl)(
+            queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -4939,8 +8217,15 @@ cl::sycl::event symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t lda, const float *b, std::int64_t ldb, float beta, float *c,
                      std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ssymm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "ssymm_usm",
+                                   "left_right upper_lower m n lda ldb ldc",
+                                   { stats::work::symm, stats::f32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, m, n, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_ssymm_usm_sycl)(queue, left_right, upper_lower, m, n,
+                                                               alpha, a, lda, b, ldb, beta, c, ldc,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -4948,8 +8233,15 @@ cl::sycl::event symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      const double *a, std::int64_t lda, const double *b, std::int64_t ldb,
                      double beta, double *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dsymm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "dsymm_usm",
+                                   "left_right upper_lower m n lda ldb ldc",
+                                   { stats::work::symm, stats::f64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, m, n, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dsymm_usm_sycl)(queue, left_right, upper_lower, m, n,
+                                                               alpha, a, lda, b, ldb, beta, c, ldc,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -4958,8 +8250,15 @@ cl::sycl::event symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
                      std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_csymm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "csymm_usm",
+                                   "left_right upper_lower m n lda ldb ldc",
+                                   { stats::work::symm, stats::c32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, m, n, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_csymm_usm_sycl)(queue, left_right, upper_lower, m, n,
+                                                               alpha, a, lda, b, ldb, beta, c, ldc,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -4968,24 +8267,41 @@ cl::sycl::event symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t ldb, std::complex<double> beta, std::complex<double> *c,
                      std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zsymm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "zsymm_usm",
+                                   "left_right upper_lower m n lda ldb ldc",
+                                   { stats::work::symm, stats::c64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, m, n, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zsymm_usm_sycl)(queue, left_right, upper_lower, m, n,
+                                                               alpha, a, lda, b, ldb, beta, c, ldc,
+                                                               dependencies);
+    });
 }
 
 cl::sycl::event syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, std::int64_t n, std::int64_t k, float alpha, const float *a,
                      std::int64_t lda, float beta, float *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ssyrk_usm_sycl(queue, upper_lower, trans, n, k, alpha,
-                                                            a, lda, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "ssyrk_usm", "upper_lower trans n k lda ldc",
+                                   { stats::work::syrk, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_ssyrk_usm_sycl)(
+            queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
                      transpose trans, std::int64_t n, std::int64_t k, double alpha, const double *a,
                      std::int64_t lda, double beta, double *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dsyrk_usm_sycl(queue, upper_lower, trans, n, k, alpha,
-                                                            a, lda, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "dsyrk_usm", "upper_lower trans n k lda ldc",
+                                   { stats::work::syrk, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dsyrk_usm_sycl)(
+            queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -4993,8 +8309,13 @@ cl::sycl::event syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<float> *a, std::int64_t lda, std::complex<float> beta,
                      std::complex<float> *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_csyrk_usm_sycl(queue, upper_lower, trans, n, k, alpha,
-                                                            a, lda, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "csyrk_usm", "upper_lower trans n k lda ldc",
+                                   { stats::work::syrk, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_csyrk_usm_sycl)(
+            queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -5002,8 +8323,13 @@ cl::sycl::event syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo up
                      const std::complex<double> *a, std::int64_t lda, std::complex<double> beta,
                      std::complex<double> *c, std::int64_t ldc,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zsyrk_usm_sycl(queue, upper_lower, trans, n, k, alpha,
-                                                            a, lda, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "zsyrk_usm", "upper_lower trans n k lda ldc",
+                                   { stats::work::syrk, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zsyrk_usm_sycl)(
+            queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -5011,8 +8337,13 @@ cl::sycl::event syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       std::int64_t lda, const float *b, std::int64_t ldb, float beta, float *c,
                       std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ssyr2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "ssyr2k_usm", "upper_lower trans n k lda ldb ldc",
+                                   { stats::work::syr2k, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_ssyr2k_usm_sycl)(
+            queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -5020,8 +8351,13 @@ cl::sycl::event syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       const double *a, std::int64_t lda, const double *b, std::int64_t ldb,
                       double beta, double *c, std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dsyr2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "dsyr2k_usm", "upper_lower trans n k lda ldb ldc",
+                                   { stats::work::syr2k, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dsyr2k_usm_sycl)(
+            queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -5030,8 +8366,13 @@ cl::sycl::event syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
                       std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_csyr2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "csyr2k_usm", "upper_lower trans n k lda ldb ldc",
+                                   { stats::work::syr2k, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_csyr2k_usm_sycl)(
+            queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -5040,8 +8381,13 @@ cl::sycl::event syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
                       std::complex<double> *c, std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zsyr2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    static stats::routine routine{ trace_site, "zsyr2k_usm", "upper_lower trans n k lda ldb ldc",
+                                   { stats::work::syr2k, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, trans, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zsyr2k_usm_sycl)(
+            queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -5049,9 +8395,15 @@ cl::sycl::event trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t n, float alpha, const float *a, std::int64_t lda, float *b,
                      std::int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_strmm_usm_sycl(queue, left_right, upper_lower, trans,
-                                                            unit_diag, m, n, alpha, a, lda, b, ldb,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "strmm_usm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::f32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_strmm_usm_sycl)(queue, left_right, upper_lower,
+                                                               trans, unit_diag, m, n, alpha, a,
+                                                               lda, b, ldb, dependencies);
+    });
 }
 
 cl::sycl::event trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -5059,9 +8411,15 @@ cl::sycl::event trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t n, double alpha, const double *a, std::int64_t lda, double *b,
                      std::int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dtrmm_usm_sycl(queue, left_right, upper_lower, trans,
-                                                            unit_diag, m, n, alpha, a, lda, b, ldb,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "dtrmm_usm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::f64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dtrmm_usm_sycl)(queue, left_right, upper_lower,
+                                                               trans, unit_diag, m, n, alpha, a,
+                                                               lda, b, ldb, dependencies);
+    });
 }
 
 cl::sycl::event trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -5069,9 +8427,15 @@ cl::sycl::event trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t n, std::complex<float> alpha, const std::complex<float> *a,
                      std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ctrmm_usm_sycl(queue, left_right, upper_lower, trans,
-                                                            unit_diag, m, n, alpha, a, lda, b, ldb,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "ctrmm_usm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::c32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_ctrmm_usm_sycl)(queue, left_right, upper_lower,
+                                                               trans, unit_diag, m, n, alpha, a,
+                                                               lda, b, ldb, dependencies);
+    });
 }
 
 cl::sycl::event trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -5079,9 +8443,15 @@ cl::sycl::event trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t n, std::complex<double> alpha, const std::complex<double> *a,
                      std::int64_t lda, std::complex<double> *b, std::int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ztrmm_usm_sycl(queue, left_right, upper_lower, trans,
-                                                            unit_diag, m, n, alpha, a, lda, b, ldb,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "ztrmm_usm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::c64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_ztrmm_usm_sycl)(queue, left_right, upper_lower,
+                                                               trans, unit_diag, m, n, alpha, a,
+                                                               lda, b, ldb, dependencies);
+    });
 }
 
 cl::sycl::event trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -5089,9 +8459,15 @@ cl::sycl::event trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t n, float alpha, const float *a, std::int64_t lda, float *b,
                      std::int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_strsm_usm_sycl(queue, left_right, upper_lower, trans,
-                                                            unit_diag, m, n, alpha, a, lda, b, ldb,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "strsm_usm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::f32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_strsm_usm_sycl)(queue, left_right, upper_lower,
+                                                               trans, unit_diag, m, n, alpha, a,
+                                                               lda, b, ldb, dependencies);
+    });
 }
 
 cl::sycl::event trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -5099,9 +8475,15 @@ cl::sycl::event trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t n, double alpha, const double *a, std::int64_t lda, double *b,
                      std::int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dtrsm_usm_sycl(queue, left_right, upper_lower, trans,
-                                                            unit_diag, m, n, alpha, a, lda, b, ldb,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "dtrsm_usm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::f64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dtrsm_usm_sycl)(queue, left_right, upper_lower,
+                                                               trans, unit_diag, m, n, alpha, a,
+                                                               lda, b, ldb, dependencies);
+    });
 }
 
 cl::sycl::event trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -5109,9 +8491,15 @@ cl::sycl::event trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t n, std::complex<float> alpha, const std::complex<float> *a,
                      std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ctrsm_usm_sycl(queue, left_right, upper_lower, trans,
-                                                            unit_diag, m, n, alpha, a, lda, b, ldb,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "ctrsm_usm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::c32 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_ctrsm_usm_sycl)(queue, left_right, upper_lower,
+                                                               trans, unit_diag, m, n, alpha, a,
+                                                               lda, b, ldb, dependencies);
+    });
 }
 
 cl::sycl::event trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
@@ -5119,9 +8507,15 @@ cl::sycl::event trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side le
                      std::int64_t n, std::complex<double> alpha, const std::complex<double> *a,
                      std::int64_t lda, std::complex<double> *b, std::int64_t ldb,
                      const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ztrsm_usm_sycl(queue, left_right, upper_lower, trans,
-                                                            unit_diag, m, n, alpha, a, lda, b, ldb,
-                                                            dependencies);
+    static stats::routine routine{ trace_site, "ztrsm_usm",
+                                   "left_right upper_lower trans unit_diag m n lda ldb",
+                                   { stats::work::trmm, stats::c64 } };
+    auto shape = verbose::make_dims(left_right, upper_lower, trans, unit_diag, m, n, lda, ldb);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_ztrsm_usm_sycl)(queue, left_right, upper_lower,
+                                                               trans, unit_diag, m, n, alpha, a,
+                                                               lda, b, ldb, dependencies);
+    });
 }
 
 cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose *transa,
@@ -5130,9 +8524,14 @@ cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, t
                            std::int64_t *ldb, float *beta, float **c, std::int64_t *ldc,
                            std::int64_t group_count, std::int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    static stats::routine routine{ trace_site, "sgemm_batch_group_usm", "group_count",
+                                   { stats::work::gemm, stats::f32 } };
+    auto shape = verbose::make_dims(group_count);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_sgemm_batch_group_usm_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
+            group_size, dependencies);
+    });
 }
 
 cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose *transa,
@@ -5141,9 +8540,14 @@ cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, t
                            std::int64_t *ldb, double *beta, double **c, std::int64_t *ldc,
                            std::int64_t group_count, std::int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    static stats::routine routine{ trace_site, "dgemm_batch_group_usm", "group_count",
+                                   { stats::work::gemm, stats::f64 } };
+    auto shape = verbose::make_dims(group_count);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dgemm_batch_group_usm_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
+            group_size, dependencies);
+    });
 }
 
 cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose *transa,
@@ -5153,9 +8557,14 @@ cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, t
                            std::complex<float> *beta, std::complex<float> **c, std::int64_t *ldc,
                            std::int64_t group_count, std::int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    static stats::routine routine{ trace_site, "cgemm_batch_group_usm", "group_count",
+                                   { stats::work::gemm, stats::c32 } };
+    auto shape = verbose::make_dims(group_count);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_cgemm_batch_group_usm_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
+            group_size, dependencies);
+    });
 }
 
 cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose *transa,
@@ -5165,9 +8574,14 @@ cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, t
                            std::complex<double> *beta, std::complex<double> **c, std::int64_t *ldc,
                            std::int64_t group_count, std::int64_t *group_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    static stats::routine routine{ trace_site, "zgemm_batch_group_usm", "group_count",
+                                   { stats::work::gemm, stats::c64 } };
+    auto shape = verbose::make_dims(group_count);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zgemm_batch_group_usm_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
+            group_size, dependencies);
+    });
 }
 
 cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
@@ -5177,9 +8591,16 @@ cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, t
                            float *c, std::int64_t ldc, std::int64_t stride_c,
                            std::int64_t batch_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    static stats::routine routine{ trace_site, "sgemm_batch_strided_usm",
+        "transa transb m n k lda stride_a ldb stride_b ldc stride_c batch_size",
+        { stats::work::gemm, stats::f32 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, stride_a, ldb, stride_b, ldc,
+                                    stride_c, batch_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_sgemm_batch_strided_usm_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+            stride_c, batch_size, dependencies);
+    });
 }
 
 cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
@@ -5189,9 +8610,16 @@ cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, t
                            double *c, std::int64_t ldc, std::int64_t stride_c,
                            std::int64_t batch_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    static stats::routine routine{ trace_site, "dgemm_batch_strided_usm",
+        "transa transb m n k lda stride_a ldb stride_b ldc stride_c batch_size",
+        { stats::work::gemm, stats::f64 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, stride_a, ldb, stride_b, ldc,
+                                    stride_c, batch_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dgemm_batch_strided_usm_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+            stride_c, batch_size, dependencies);
+    });
 }
 
 cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
@@ -5202,9 +8630,16 @@ cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, t
                            std::complex<float> *c, std::int64_t ldc, std::int64_t stride_c,
                            std::int64_t batch_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    static stats::routine routine{ trace_site, "cgemm_batch_strided_usm",
+        "transa transb m n k lda stride_a ldb stride_b ldc stride_c batch_size",
+        { stats::work::gemm, stats::c32 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, stride_a, ldb, stride_b, ldc,
+                                    stride_c, batch_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_cgemm_batch_strided_usm_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+            stride_c, batch_size, dependencies);
+    });
 }
 
 cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
@@ -5215,9 +8650,16 @@ cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, t
                            std::complex<double> *c, std::int64_t ldc, std::int64_t stride_c,
                            std::int64_t batch_size,
                            const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    static stats::routine routine{ trace_site, "zgemm_batch_strided_usm",
+        "transa transb m n k lda stride_a ldb stride_b ldc stride_c batch_size",
+        { stats::work::gemm, stats::c64 } };
+    auto shape = verbose::make_dims(transa, transb, m, n, k, lda, stride_a, ldb, stride_b, ldc,
+                                    stride_c, batch_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zgemm_batch_strided_usm_sycl)(
+            queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+            stride_c, batch_size, dependencies);
+    });
 }
 
 cl::sycl::event gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -5225,9 +8667,15 @@ cl::sycl::event gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       float alpha, const float *a, std::int64_t lda, const float *b,
                       std::int64_t ldb, float beta, float *c, std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sgemmt_usm_sycl(queue, upper_lower, transa, transb, n,
-                                                             k, alpha, a, lda, b, ldb, beta, c, ldc,
-                                                             dependencies);
+    static stats::routine routine{ trace_site, "sgemmt_usm",
+                                   "upper_lower transa transb n k lda ldb ldc",
+                                   { stats::work::gemmt, stats::f32 } };
+    auto shape = verbose::make_dims(upper_lower, transa, transb, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_sgemmt_usm_sycl)(queue, upper_lower, transa, transb,
+                                                                n, k, alpha, a, lda, b, ldb, beta,
+                                                                c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -5235,9 +8683,15 @@ cl::sycl::event gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       double alpha, const double *a, std::int64_t lda, const double *b,
                       std::int64_t ldb, double beta, double *c, std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dgemmt_usm_sycl(queue, upper_lower, transa, transb, n,
-                                                             k, alpha, a, lda, b, ldb, beta, c, ldc,
-                                                             dependencies);
+    static stats::routine routine{ trace_site, "dgemmt_usm",
+                                   "upper_lower transa transb n k lda ldb ldc",
+                                   { stats::work::gemmt, stats::f64 } };
+    auto shape = verbose::make_dims(upper_lower, transa, transb, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_dgemmt_usm_sycl)(queue, upper_lower, transa, transb,
+                                                                n, k, alpha, a, lda, b, ldb, beta,
+                                                                c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -5246,9 +8700,15 @@ cl::sycl::event gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
                       std::complex<float> *c, std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cgemmt_usm_sycl(queue, upper_lower, transa, transb, n,
-                                                             k, alpha, a, lda, b, ldb, beta, c, ldc,
-                                                             dependencies);
+    static stats::routine routine{ trace_site, "cgemmt_usm",
+                                   "upper_lower transa transb n k lda ldb ldc",
+                                   { stats::work::gemmt, stats::c32 } };
+    auto shape = verbose::make_dims(upper_lower, transa, transb, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_cgemmt_usm_sycl)(queue, upper_lower, transa, transb,
+                                                                n, k, alpha, a, lda, b, ldb, beta,
+                                                                c, ldc, dependencies);
+    });
 }
 
 cl::sycl::event gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
@@ -5257,9 +8717,15 @@ cl::sycl::event gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo u
                       const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
                       std::complex<double> *c, std::int64_t ldc,
                       const cl::sycl::vector_class<cl::sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zgemmt_usm_sycl(queue, upper_lower, transa, transb, n,
-                                                             k, alpha, a, lda, b, ldb, beta, c, ldc,
-                                                             dependencies);
+    static stats::routine routine{ trace_site, "zgemmt_usm",
+                                   "upper_lower transa transb n k lda ldb ldc",
+                                   { stats::work::gemmt, stats::c64 } };
+    auto shape = verbose::make_dims(upper_lower, transa, transb, n, k, lda, ldb, ldc);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.row_major_zgemmt_usm_sycl)(queue, upper_lower, transa, transb,
+                                                                n, k, alpha, a, lda, b, ldb, beta,
+                                                                c, ldc, dependencies);
+    });
 }
 
 } //namespace detail
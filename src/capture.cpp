@@ -0,0 +1,178 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "oneapi/mkl/capture.hpp"
+#include "verbose_helper.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace detail {
+namespace verbose {
+
+namespace {
+
+// Pending bytes are written out once there are this many of them.
+constexpr std::size_t write_threshold = 1 << 20;
+
+class capture_log {
+public:
+    capture_log() {
+        const char *env = std::getenv("ONEMKL_CAPTURE");
+        if (env != nullptr && *env != '\0')
+            start(env);
+    }
+
+    ~capture_log() {
+        stop();
+    }
+
+    void start(const std::string &path) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        close();
+        file_ = std::fopen(path.c_str(), "wb");
+        if (file_ == nullptr)
+            return;
+        const char *magic = oneapi::mkl::capture::format_magic;
+        buffer_.assign(magic, magic + std::strlen(magic));
+        ids_.clear();
+        last_start_ = 0;
+        active.fetch_or(capture_sink);
+    }
+
+    void stop() {
+        active.fetch_and(~capture_sink);
+        std::lock_guard<std::mutex> lock(mutex_);
+        close();
+    }
+
+    bool is_active() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return file_ != nullptr;
+    }
+
+    void add(const routine_info &routine, oneapi::mkl::device libkey, const dims &args,
+             std::int64_t start, std::int64_t end) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (file_ == nullptr)
+            return;
+        auto id = ids_.find(&routine);
+        if (id == ids_.end()) {
+            id = ids_.emplace(&routine, ids_.size()).first;
+            buffer_.push_back('R');
+            put(id->second);
+            buffer_.push_back(static_cast<char>(routine.where.domain));
+            put(routine.where.layout != nullptr ? routine.where.layout : "");
+            put(routine.name);
+            put(routine.dims);
+        }
+        buffer_.push_back('C');
+        put(id->second);
+        buffer_.push_back(static_cast<char>(libkey));
+        put(static_cast<std::uint64_t>(args.count));
+        for (int i = 0; i < args.count; i++)
+            put_signed(args.values[i]);
+        put_signed(start - last_start_);
+        put(static_cast<std::uint64_t>(end - start));
+        last_start_ = start;
+        if (buffer_.size() >= write_threshold)
+            write();
+    }
+
+private:
+    void put(std::uint64_t value) {
+        for (; value >= 0x80; value >>= 7)
+            buffer_.push_back(static_cast<char>((value & 0x7f) | 0x80));
+        buffer_.push_back(static_cast<char>(value));
+    }
+
+    void put_signed(std::int64_t value) {
+        put((static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+    }
+
+    void put(const char *s) {
+        const std::size_t length = std::strlen(s);
+        put(static_cast<std::uint64_t>(length));
+        buffer_.insert(buffer_.end(), s, s + length);
+    }
+
+    void write() {
+        std::fwrite(buffer_.data(), 1, buffer_.size(), file_);
+        buffer_.clear();
+    }
+
+    void close() {
+        if (file_ == nullptr)
+            return;
+        write();
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+
+    std::mutex mutex_;
+    std::FILE *file_ = nullptr;
+    std::vector<char> buffer_;
+    std::unordered_map<const routine_info *, std::uint64_t> ids_;
+    std::int64_t last_start_ = 0;
+};
+
+capture_log &capture_file() {
+    static capture_log instance;
+    return instance;
+}
+
+// Creates the capture, and so reads ONEMKL_CAPTURE, when the library is loaded.
+const bool capture_created = (capture_file(), true);
+
+} // namespace
+
+void capture(const routine_info &routine, oneapi::mkl::device libkey, const dims &args,
+             std::int64_t start, std::int64_t end) {
+    capture_file().add(routine, libkey, args, start, end);
+}
+
+} // namespace verbose
+} // namespace detail
+
+namespace capture {
+
+void start(const std::string &path) {
+    detail::verbose::capture_file().start(path);
+}
+
+void stop() {
+    detail::verbose::capture_file().stop();
+}
+
+bool is_active() {
+    return detail::verbose::capture_file().is_active();
+}
+
+} // namespace capture
+} // namespace mkl
+} // namespace oneapi
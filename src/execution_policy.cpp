@@ -0,0 +1,127 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl/detail/export.hpp"
+#include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/execution_policy.hpp"
+#include "execution_policy_helper.hpp"
+#include "numa_helper.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace detail {
+namespace policy {
+
+std::atomic<int> active{ 0 };
+
+namespace {
+
+struct entry {
+    sycl::queue queue;
+    execution_policy requested;
+    shared_policy resolved;
+};
+
+std::mutex registry_mutex;
+std::vector<entry> registry;
+
+thread_local const shared_policy *current_policy = nullptr;
+
+std::vector<entry>::iterator lookup(const sycl::queue &queue) {
+    return std::find_if(registry.begin(), registry.end(),
+                        [&](const entry &e) { return e.queue == queue; });
+}
+
+} // namespace
+
+shared_policy find(sycl::queue &queue) {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    auto it = lookup(queue);
+    return it != registry.end() ? it->resolved : nullptr;
+}
+
+const shared_policy *exchange(const shared_policy *p) {
+    return std::exchange(current_policy, p);
+}
+
+} // namespace policy
+} // namespace detail
+
+void set_execution_policy(sycl::queue &queue, const execution_policy &policy) {
+    if (!queue.get_device().is_cpu())
+        throw oneapi::mkl::unsupported_device("", "set_execution_policy", queue.get_device());
+    if (policy.threads < 0)
+        throw oneapi::mkl::invalid_argument("", "set_execution_policy",
+                                            "the thread count is negative");
+    if (policy.numa_node < -1)
+        throw oneapi::mkl::invalid_argument("", "set_execution_policy",
+                                            "the NUMA node is invalid");
+
+    execution_policy resolved = policy;
+    if (resolved.cpus.empty() && resolved.numa_node >= 0) {
+        resolved.cpus = detail::numa::node_cpus(resolved.numa_node);
+        if (resolved.cpus.empty())
+            throw oneapi::mkl::invalid_argument("", "set_execution_policy",
+                                                "the NUMA node has no CPUs");
+    }
+
+    std::lock_guard<std::mutex> lock(detail::policy::registry_mutex);
+    auto shared = std::make_shared<const execution_policy>(std::move(resolved));
+    auto it = detail::policy::lookup(queue);
+    if (it != detail::policy::registry.end()) {
+        it->requested = policy;
+        it->resolved = std::move(shared);
+        return;
+    }
+    detail::policy::registry.push_back({ queue, policy, std::move(shared) });
+    detail::policy::active.fetch_add(1);
+}
+
+execution_policy get_execution_policy(const sycl::queue &queue) {
+    std::lock_guard<std::mutex> lock(detail::policy::registry_mutex);
+    auto it = detail::policy::lookup(queue);
+    return it != detail::policy::registry.end() ? it->requested : execution_policy{};
+}
+
+void clear_execution_policy(sycl::queue &queue) {
+    std::lock_guard<std::mutex> lock(detail::policy::registry_mutex);
+    auto it = detail::policy::lookup(queue);
+    if (it == detail::policy::registry.end())
+        return;
+    detail::policy::registry.erase(it);
+    detail::policy::active.fetch_sub(1);
+}
+
+} // namespace mkl
+} // namespace oneapi
+
+// Looked up by the CPU backends, see execution_policy_helper.hpp.
+extern "C" ONEMKL_EXPORT const oneapi::mkl::detail::policy::shared_policy *
+onemkl_execution_policy() {
+    return oneapi::mkl::detail::policy::current_policy;
+}
@@ -0,0 +1,171 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl/detail/export.hpp"
+#include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/graph.hpp"
+#include "graph_helper.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace detail {
+namespace graph {
+
+std::atomic<int> active{ 0 };
+
+struct state : recorder {
+    void depends_on(const sycl::event &event) override {
+        std::lock_guard<std::mutex> lock(mutex);
+        dependencies.push_back(event);
+    }
+
+    // Recorded calls return an already complete event.
+    sycl::event add(std::function<void()> task) override {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks->push_back(std::move(task));
+        return sycl::event{};
+    }
+
+    std::size_t size() const override {
+        std::lock_guard<std::mutex> lock(mutex);
+        return tasks->size();
+    }
+
+    mutable std::mutex mutex;
+    std::unique_ptr<sycl::queue> queue;
+    bool recording = false;
+    // Runs keep the list they were submitted with; begin() starts a new one.
+    std::shared_ptr<std::vector<std::function<void()>>> tasks =
+        std::make_shared<std::vector<std::function<void()>>>();
+    std::vector<sycl::event> dependencies;
+};
+
+namespace {
+
+std::mutex registry_mutex;
+std::vector<std::shared_ptr<state>> registry;
+
+thread_local recorder *current_recorder = nullptr;
+
+} // namespace
+
+std::shared_ptr<recorder> find(sycl::queue &queue) {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    for (auto &graph : registry) {
+        if (*graph->queue == queue)
+            return graph;
+    }
+    return nullptr;
+}
+
+scope::scope(recorder *r) : previous_(current_recorder) {
+    current_recorder = r;
+}
+
+scope::~scope() {
+    current_recorder = previous_;
+}
+
+} // namespace graph
+} // namespace detail
+
+graph::graph() : state_(std::make_shared<detail::graph::state>()) {}
+
+graph::~graph() {
+    end();
+}
+
+void graph::begin(sycl::queue &queue) {
+    if (!queue.get_device().is_cpu())
+        throw oneapi::mkl::unsupported_device("", "graph::begin", queue.get_device());
+    end();
+    std::lock_guard<std::mutex> registry_lock(detail::graph::registry_mutex);
+    for (auto &other : detail::graph::registry) {
+        if (*other->queue == queue)
+            throw oneapi::mkl::invalid_argument("", "graph::begin",
+                                                "the queue is recorded by another graph");
+    }
+    {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        state_->queue = std::make_unique<sycl::queue>(queue);
+        state_->recording = true;
+        state_->tasks = std::make_shared<std::vector<std::function<void()>>>();
+        state_->dependencies.clear();
+    }
+    detail::graph::registry.push_back(state_);
+    detail::graph::active.fetch_add(1);
+}
+
+void graph::end() {
+    std::lock_guard<std::mutex> registry_lock(detail::graph::registry_mutex);
+    auto &registry = detail::graph::registry;
+    auto it = std::find(registry.begin(), registry.end(), state_);
+    if (it == registry.end())
+        return;
+    registry.erase(it);
+    detail::graph::active.fetch_sub(1);
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    state_->recording = false;
+}
+
+sycl::event graph::run(const sycl::vector_class<sycl::event> &dependencies) {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    if (state_->recording)
+        throw oneapi::mkl::invalid_argument("", "graph::run", "the graph is recording");
+    if (!state_->queue)
+        throw oneapi::mkl::uninitialized("", "graph::run", "nothing was recorded");
+    auto run_tasks = [tasks = state_->tasks]() {
+        for (auto &task : *tasks)
+            task();
+    };
+    return state_->queue->submit([&](sycl::handler &cgh) {
+        for (auto &event : state_->dependencies)
+            cgh.depends_on(event);
+        for (auto &event : dependencies)
+            cgh.depends_on(event);
+        detail::graph::host_task(cgh, run_tasks);
+    });
+}
+
+std::size_t graph::size() const {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->tasks->size();
+}
+
+bool graph::is_recording() const {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->recording;
+}
+
+} // namespace mkl
+} // namespace oneapi
+
+// Looked up by the CPU backends, see graph_helper.hpp.
+extern "C" ONEMKL_EXPORT oneapi::mkl::detail::graph::recorder *onemkl_graph_recorder() {
+    return oneapi::mkl::detail::graph::current_recorder;
+}
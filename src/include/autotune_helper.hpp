@@ -0,0 +1,98 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_AUTOTUNE_HELPER_HPP_
+#define _ONEMKL_AUTOTUNE_HELPER_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "stats_helper.hpp"
+#include "verbose_helper.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace detail {
+namespace autotune {
+
+extern std::atomic<bool> active;
+
+inline bool enabled() {
+    return active.load(std::memory_order_relaxed);
+}
+
+// Choice of a size bucket without a winner once an untimed call ran in it:
+// later untimed calls go to the first backend without calling choose(), while
+// timed calls still calibrate the bucket.
+constexpr std::int8_t untimed_choice = -2;
+
+// Backend to run a call of routine in a size bucket without a winner yet, as
+// an index in libraries. Sets measure if the call is a calibration call, whose
+// event is to be passed to pending(); otherwise the winner is already stored
+// in the choice of the routine, or the call cannot be timed, goes to the
+// first backend and stores untimed_choice. Calibration calls that completed
+// since the last choice are reported first.
+int choose(stats::routine &routine, int bucket, const std::vector<const char *> &libraries,
+           bool timed, bool &measure);
+
+// Keeps the event of a calibration call until it completes. Its execution time
+// is then taken from the profiling information of the event, without waiting
+// on the call or its queue, and the winner of the bucket is picked once every
+// backend has run enough calls.
+void pending(stats::routine &routine, int bucket, const std::vector<const char *> &libraries,
+             int backend, const sycl::event &event);
+
+// Only USM calls on queues with profiling enabled can be timed: their event
+// tells when the call ran on the device. Other calls are never calibration
+// calls.
+template <typename R>
+struct calibration {
+    static bool timed(sycl::queue &) {
+        return false;
+    }
+
+    template <typename F, typename G>
+    static R run(F &f, G) {
+        return f();
+    }
+};
+
+template <>
+struct calibration<sycl::event> {
+    static bool timed(sycl::queue &queue) {
+        return queue.has_property<sycl::property::queue::enable_profiling>();
+    }
+
+    template <typename F, typename G>
+    static sycl::event run(F &f, G done) {
+        sycl::event event = f();
+        done(event);
+        return event;
+    }
+};
+
+} // namespace autotune
+} // namespace detail
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_AUTOTUNE_HELPER_HPP_
@@ -0,0 +1,186 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_EXECUTION_POLICY_HELPER_HPP_
+#define _ONEMKL_EXECUTION_POLICY_HELPER_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl/execution_policy.hpp"
+
+#ifdef __linux__
+#include <dlfcn.h>
+#include <pthread.h>
+#include <sched.h>
+#elif defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace oneapi {
+namespace mkl {
+namespace detail {
+namespace policy {
+
+// Policy of the call being dispatched on the calling thread, as the CPU
+// backends see it: the policy of its queue (see oneapi/mkl/execution_policy.hpp)
+// with the CPUs of its NUMA node resolved into its CPU list.
+using shared_policy = std::shared_ptr<const execution_policy>;
+
+// Function of the dispatcher library returning the policy of the calling
+// thread, or nullptr. The backends look it up at run time, so they do not
+// link to the dispatcher.
+constexpr char policy_symbol[] = "onemkl_execution_policy";
+using policy_fn = const shared_policy *(*)();
+
+// Number of queues with a policy, so that the dispatch of a call only looks
+// for its queue while some queue has one.
+extern std::atomic<int> active;
+
+inline bool enabled() {
+    return active.load(std::memory_order_relaxed) != 0;
+}
+
+// Policy of queue, or nullptr.
+shared_policy find(sycl::queue &queue);
+
+// Makes p the policy of the calling thread and returns the previous one.
+const shared_policy *exchange(const shared_policy *p);
+
+// Makes the policy of the calling thread p, if any, for its lifetime.
+class scope {
+public:
+    explicit scope(shared_policy p) : policy_(std::move(p)) {
+        if (policy_)
+            previous_ = exchange(&policy_);
+    }
+
+    ~scope() {
+        if (policy_)
+            exchange(previous_);
+    }
+
+    scope(const scope &) = delete;
+    scope &operator=(const scope &) = delete;
+
+private:
+    shared_policy policy_;
+    const shared_policy *previous_ = nullptr;
+};
+
+// Backend side.
+
+inline shared_policy current() {
+#ifdef __linux__
+    static const auto fn = reinterpret_cast<policy_fn>(dlsym(RTLD_DEFAULT, policy_symbol));
+#elif defined(_WIN64)
+    static const auto fn = reinterpret_cast<policy_fn>(
+        GetProcAddress(GetModuleHandleA("onemkl.dll"), policy_symbol));
+#else
+    static const policy_fn fn = nullptr;
+#endif
+    const shared_policy *p = fn != nullptr ? fn() : nullptr;
+    return p != nullptr ? *p : nullptr;
+}
+
+// Threads the parallel paths of a backend may start from the calling thread,
+// 0 outside of the host tasks of calls with a policy.
+inline std::int64_t &thread_limit() {
+    static thread_local std::int64_t limit = 0;
+    return limit;
+}
+
+// Applies a policy to the calling thread for its lifetime: pins the thread to
+// the CPUs of the policy, sets the thread limit and, given the thread-local
+// thread count setter of a threaded library, the threads of the library.
+class applied {
+public:
+    using thread_setter = int (*)(int);
+
+    applied(const execution_policy *p, thread_setter set_threads)
+            : policy_(p),
+              set_threads_(set_threads) {
+        if (policy_ == nullptr)
+            return;
+        previous_limit_ = thread_limit();
+        thread_limit() = policy_->threads > 0 ? policy_->threads
+                                              : static_cast<std::int64_t>(policy_->cpus.size());
+        if (set_threads_ != nullptr && policy_->threads > 0)
+            previous_threads_ = set_threads_(static_cast<int>(policy_->threads));
+#ifdef __linux__
+        if (!policy_->cpus.empty()) {
+            cpu_set_t cpus;
+            CPU_ZERO(&cpus);
+            for (int cpu : policy_->cpus) {
+                if (cpu >= 0 && cpu < CPU_SETSIZE)
+                    CPU_SET(cpu, &cpus);
+            }
+            pinned_ = pthread_getaffinity_np(pthread_self(), sizeof(previous_cpus_),
+                                             &previous_cpus_) == 0 &&
+                      pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0;
+        }
+#endif
+    }
+
+    ~applied() {
+        if (policy_ == nullptr)
+            return;
+#ifdef __linux__
+        if (pinned_)
+            pthread_setaffinity_np(pthread_self(), sizeof(previous_cpus_), &previous_cpus_);
+#endif
+        if (set_threads_ != nullptr && policy_->threads > 0)
+            set_threads_(previous_threads_);
+        thread_limit() = previous_limit_;
+    }
+
+    applied(const applied &) = delete;
+    applied &operator=(const applied &) = delete;
+
+private:
+    const execution_policy *policy_;
+    thread_setter set_threads_;
+    std::int64_t previous_limit_ = 0;
+    int previous_threads_ = 0;
+#ifdef __linux__
+    cpu_set_t previous_cpus_;
+    bool pinned_ = false;
+#endif
+};
+
+// Host task running f under the policy of the call being dispatched on the
+// calling thread. The policy is taken when the task is made, so the task keeps
+// it even if the policy of the queue changes before it runs.
+template <typename F>
+inline auto bind(F f, applied::thread_setter set_threads = nullptr) {
+    return [p = current(), set_threads, f]() {
+        applied applying(p.get(), set_threads);
+        f();
+    };
+}
+
+} // namespace policy
+} // namespace detail
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_EXECUTION_POLICY_HELPER_HPP_
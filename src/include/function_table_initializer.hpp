@@ -20,12 +20,26 @@
 #ifndef _LOADER_HPP_
 #define _LOADER_HPP_
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
-#include <map>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "oneapi/mkl/detail/backends_table.hpp"
 #include "oneapi/mkl/detail/exceptions.hpp"
 
+#include "autotune_helper.hpp"
+#include "execution_policy_helper.hpp"
+#include "graph_helper.hpp"
+#include "inline_calls_helper.hpp"
+#include "stats_helper.hpp"
+#include "verbose_helper.hpp"
+
 #define SPEC_VERSION 1
 
 #ifdef __linux__
@@ -35,6 +49,12 @@
 #define GET_FUNC(lib, fn)        dlsym(lib, (fn))
 #define FREE_LIB_HANDLE(libname) dlclose(libname)
 #define ERROR_MSG                dlerror()
+
+// Extra backends, loaded side by side for autotuning or to provide the entries
+// the first backend lacks, do not add their symbols to the global scope and
+// resolve their own dependencies first, so that a Netlib backend does not end
+// up calling the CBLAS symbols of an MKL backend loaded before it.
+#define GET_ISOLATED_LIB_HANDLE(libname) dlopen((libname), RTLD_LAZY | RTLD_LOCAL | RTLD_DEEPBIND)
 #elif defined(_WIN64)
 #include <windows.h>
 #define LIB_TYPE                 HINSTANCE
@@ -42,12 +62,26 @@
 #define GET_FUNC(lib, fn)        GetProcAddress((lib), (fn))
 #define FREE_LIB_HANDLE(libname) FreeLibrary(libname)
 #define ERROR_MSG                GetLastErrorStdStr()
+
+#define GET_ISOLATED_LIB_HANDLE(libname) LoadLibrary(libname)
 #endif
 
 namespace oneapi {
 namespace mkl {
 namespace detail {
 
+// Whether extra backends are loaded. Isolating them relies on RTLD_DEEPBIND,
+// which sanitizers and libraries interposing malloc do not support: setting
+// ONEMKL_ISOLATE_BACKENDS=0 leaves the first backend of each key alone, with
+// no autotuning candidates and no entries taken from other backends.
+inline bool isolate_backends() {
+    static const bool isolate = [] {
+        const char *env = std::getenv("ONEMKL_ISOLATE_BACKENDS");
+        return env == nullptr || std::atoi(env) > 0;
+    }();
+    return isolate;
+}
+
 template <oneapi::mkl::domain domain_id, typename function_table_t>
 class table_initializer {
     struct handle_deleter {
@@ -59,14 +93,94 @@ class table_initializer {
     using dlhandle = std::unique_ptr<LIB_TYPE, handle_deleter>;
 
 public:
+    // Loads the backend of the key on first use. A failed load is retried by
+    // the next call.
     function_table_t &operator[](oneapi::mkl::device key) {
-        auto lib = tables.find(key);
-        if (lib != tables.end())
-            return lib->second;
-        return add_table(key);
+        backend &b = backends[static_cast<std::size_t>(key)];
+        std::call_once(b.loaded, [&] { add_table(key, b); });
+        return b.table;
+    }
+
+    // Calls f with the table of the backend to run a call on. Calls made on a
+    // queue a graph records go to the first backend, with the recorder of the
+    // graph set for the backend to hand its host task to. While inline calls
+    // are enabled, tiny x86cpu calls on out-of-order queues are routed with an
+    // inline executor set, which runs their host task on the calling thread.
+    // The execution policy of the queue, if any, is set for the backend to
+    // give its host task. The call is counted in the statistics of the backend
+    // it runs on.
+    template <typename F>
+    auto call(stats::routine &routine, oneapi::mkl::device key, sycl::queue &queue,
+              const verbose::dims &args, F f) -> decltype(f(std::declval<function_table_t &>())) {
+        policy::scope applying(policy::enabled() ? policy::find(queue) : nullptr);
+        if (graph::enabled()) {
+            if (auto recorder = graph::find(queue)) {
+                graph::scope recording(recorder.get());
+                routine.count(key, 0, args);
+                return verbose::call(routine, key, queue, args, [&] {
+                    auto run = [&] { return f((*this)[key]); };
+                    return graph::recording<decltype(run())>::run(
+                        *recorder, verbose::domain_name(domain_id), routine.name, run);
+                });
+            }
+        }
+        const std::int64_t limit = inline_calls::limit();
+        if (limit > 0 && key == oneapi::mkl::device::x86cpu && routine.smaller(args, limit) &&
+            !queue.is_in_order()) {
+            inline_calls::executor executor(queue);
+            graph::scope running(&executor);
+            return route(routine, key, queue, args, f);
+        }
+        return route(routine, key, queue, args, f);
+    }
+
+    // Largest answer of f over the backends a call may be routed to, so that
+    // scratchpad sizes fit whichever backend autotuning picks.
+    template <typename F>
+    std::int64_t largest(oneapi::mkl::device key, F f) {
+        if (!autotune::enabled() || key != oneapi::mkl::device::x86cpu)
+            return f((*this)[key]);
+        std::int64_t size = 0;
+        for (auto &table : candidates(key).tables)
+            size = std::max<std::int64_t>(size, f(table));
+        return size;
     }
 
 private:
+    // Runs a call on the first backend found for the key, unless autotuning
+    // routes x86cpu calls to the fastest CPU backend for the routine and size
+    // of the call.
+    template <typename F>
+    auto route(stats::routine &routine, oneapi::mkl::device key, sycl::queue &queue,
+               const verbose::dims &args, F f) -> decltype(f(std::declval<function_table_t &>())) {
+        using result_t = decltype(f(std::declval<function_table_t &>()));
+        if (!autotune::enabled() || key != oneapi::mkl::device::x86cpu) {
+            routine.count(key, 0, args);
+            return verbose::call(routine, key, queue, args, [&] { return f((*this)[key]); });
+        }
+        backend_set &set = candidates(key);
+
+        const int bucket = routine.bucket(args);
+        int backend = routine.choice(bucket).load(std::memory_order_relaxed);
+        bool measure = false;
+        if (backend < 0) {
+            const bool timed = autotune::calibration<result_t>::timed(queue);
+            if (backend == autotune::untimed_choice && !timed)
+                backend = 0;
+            else
+                backend = autotune::choose(routine, bucket, set.libraries, timed, measure);
+        }
+        routine.count(key, backend, args);
+        auto run = [&] { return f(set.tables[backend]); };
+        if (!measure)
+            return verbose::call(routine, key, queue, args, run);
+        return verbose::call(routine, key, queue, args, [&] {
+            return autotune::calibration<result_t>::run(run, [&](const sycl::event &event) {
+                autotune::pending(routine, bucket, set.libraries, backend, event);
+            });
+        });
+    }
+
 #ifdef _WIN64
     // Create a string with last error message
     std::string GetLastErrorStdStr() {
@@ -90,13 +204,40 @@ private:
     }
 #endif
 
-    function_table_t &add_table(oneapi::mkl::device key) {
+    // Backends and autotuning candidates are loaded under a once flag per key,
+    // so that concurrent first calls load them once. Everything one key loads
+    // is kept in its slot.
+    struct backend_set;
+    struct backend {
+        std::once_flag loaded;
+        function_table_t table;
         dlhandle handle;
+        const char *name = nullptr;
+        std::vector<dlhandle> extra_handles;
+        std::once_flag candidates_built;
+        std::unique_ptr<backend_set> candidates;
+    };
+
+    // Libraries listed for the key, without inserting into the shared table.
+    static const std::vector<const char *> &library_names(oneapi::mkl::device key) {
+        static const std::vector<const char *> none;
+        auto domain_libraries = libraries.find(domain_id);
+        if (domain_libraries == libraries.end())
+            return none;
+        auto found = domain_libraries->second.find(key);
+        return found != domain_libraries->second.end() ? found->second : none;
+    }
+
+    void add_table(oneapi::mkl::device key, backend &b) {
+        dlhandle handle;
+        const char *loaded = nullptr;
         // check all available libraries for the key(device)
-        for (const char *libname : libraries[domain_id][key]) {
+        for (const char *libname : library_names(key)) {
             handle = dlhandle{ ::GET_LIB_HANDLE(libname) };
-            if (handle)
+            if (handle) {
+                loaded = libname;
                 break;
+            }
         }
         if (!handle) {
             std::cerr << ERROR_MSG << '\n';
@@ -112,13 +253,127 @@ private:
         if (t->version != SPEC_VERSION)
             throw mkl::specification_mismatch();
 
-        handles[key] = std::move(handle);
-        tables[key] = *t;
-        return *t;
+        b.handle = std::move(handle);
+        function_table_t &table = b.table = *t;
+        b.name = loaded;
+
+        // Entries the backend marks absent are taken from the next libraries
+        // of the key, in order.
+        std::string composed = loaded;
+        bool next = false;
+        for (const char *libname : library_names(key)) {
+            if (complete(table))
+                break;
+            if (next) {
+                // A library none of whose entries is used is closed again.
+                dlhandle fallback_handle;
+                const function_table_t *fallback = open_isolated(libname, fallback_handle);
+                if (fallback && compose(table, *fallback)) {
+                    composed = composed + "+" + libname;
+                    b.extra_handles.push_back(std::move(fallback_handle));
+                }
+            }
+            next = next || libname == loaded;
+        }
+        verbose::register_backend(domain_id, key, composed.c_str());
+    }
+
+    // Entries of a table are the function pointers after its version.
+    using entry_t = void (*)();
+    static constexpr std::size_t entries_offset =
+        (sizeof(int) + alignof(entry_t) - 1) / alignof(entry_t) * alignof(entry_t);
+    static constexpr std::size_t num_entries =
+        (sizeof(function_table_t) - entries_offset) / sizeof(entry_t);
+    static_assert(sizeof(function_table_t) == entries_offset + num_entries * sizeof(entry_t),
+                  "function tables must hold only function pointers after their version");
+
+    static entry_t *entries(function_table_t &table) {
+        return reinterpret_cast<entry_t *>(reinterpret_cast<char *>(&table) + entries_offset);
+    }
+
+    static const entry_t *entries(const function_table_t &table) {
+        return reinterpret_cast<const entry_t *>(reinterpret_cast<const char *>(&table) +
+                                                 entries_offset);
+    }
+
+    static bool complete(const function_table_t &table) {
+        const entry_t *e = entries(table);
+        return std::find(e, e + num_entries, nullptr) == e + num_entries;
+    }
+
+    // Copies the entries table lacks from fallback, returning whether it used
+    // any of them.
+    static bool compose(function_table_t &table, const function_table_t &fallback) {
+        entry_t *to = entries(table);
+        const entry_t *from = entries(fallback);
+        bool used = false;
+        for (std::size_t i = 0; i < num_entries; i++) {
+            if (to[i] == nullptr && from[i] != nullptr) {
+                to[i] = from[i];
+                used = true;
+            }
+        }
+        return used;
+    }
+
+    // Table of a further library of the key, loaded next to the first one. The
+    // library stays loaded as long as handle holds it. None is opened when
+    // backends are not isolated.
+    const function_table_t *open_isolated(const char *libname, dlhandle &handle) {
+        if (!isolate_backends())
+            return nullptr;
+        handle = dlhandle{ ::GET_ISOLATED_LIB_HANDLE(libname) };
+        if (!handle)
+            return nullptr;
+        auto t = reinterpret_cast<const function_table_t *>(
+            ::GET_FUNC(handle.get(), table_names[domain_id]));
+        if (!t || t->version != SPEC_VERSION) {
+            handle.reset();
+            return nullptr;
+        }
+        return t;
+    }
+
+    // Backends autotuning chooses from: the first one found for the key, then
+    // every other library of the key that opens. Each table is composed with
+    // the others so that it has every entry one of them provides.
+    struct backend_set {
+        std::vector<const char *> libraries;
+        std::vector<function_table_t> tables;
+    };
+
+    backend_set &candidates(oneapi::mkl::device key) {
+        function_table_t &first = (*this)[key];
+        backend &b = backends[static_cast<std::size_t>(key)];
+        std::call_once(b.candidates_built, [&] {
+            auto set = std::make_unique<backend_set>();
+            set->libraries.push_back(b.name);
+            set->tables.push_back(first);
+            for (const char *libname : library_names(key)) {
+                if (libname == b.name)
+                    continue;
+                dlhandle handle;
+                const function_table_t *t = open_isolated(libname, handle);
+                if (!t)
+                    continue;
+                b.extra_handles.push_back(std::move(handle));
+                stats::register_backend(domain_id, key, static_cast<int>(set->libraries.size()),
+                                        libname);
+                set->libraries.push_back(libname);
+                set->tables.push_back(*t);
+            }
+            for (std::size_t i = 1; i < set->tables.size(); i++) {
+                for (std::size_t j = 0; j < set->tables.size(); j++) {
+                    if (j != i)
+                        compose(set->tables[i], set->tables[j]);
+                }
+            }
+            b.candidates = std::move(set);
+        });
+        return *b.candidates;
     }
 
-    std::map<oneapi::mkl::device, function_table_t> tables;
-    std::map<oneapi::mkl::device, dlhandle> handles;
+    backend backends[stats::num_devices];
 };
 
 } //namespace detail
@@ -0,0 +1,189 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_GRAPH_HELPER_HPP_
+#define _ONEMKL_GRAPH_HELPER_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl/exceptions.hpp"
+
+#ifdef __linux__
+#include <dlfcn.h>
+#elif defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace oneapi {
+namespace mkl {
+namespace detail {
+namespace graph {
+
+// Receives the host tasks of the calls made on a queue while a graph records
+// it (see oneapi/mkl/graph.hpp), or while tiny calls run inline (see
+// oneapi/mkl/inline_calls.hpp). The CPU backends hand their tasks and the
+// events they depend on to the recorder of the calling thread instead of
+// submitting them; add() returns the event of the call. size() is the number
+// of tasks added so far.
+class recorder {
+public:
+    virtual void depends_on(const sycl::event &event) = 0;
+    virtual sycl::event add(std::function<void()> task) = 0;
+    virtual std::size_t size() const = 0;
+
+protected:
+    ~recorder() = default;
+};
+
+// Function of the dispatcher library returning the recorder of the calling
+// thread, if a call dispatched for a recorded queue is running on it. The
+// backends look it up at run time, so they do not link to the dispatcher.
+constexpr char recorder_symbol[] = "onemkl_graph_recorder";
+using recorder_fn = recorder *(*)();
+
+// Number of queues being recorded, so that the dispatch of a call only looks
+// for its queue while some graph records.
+extern std::atomic<int> active;
+
+inline bool enabled() {
+    return active.load(std::memory_order_relaxed) != 0;
+}
+
+// Recorder of the graph recording queue, or nullptr. The graph stays alive
+// while the recorder is held, even if it is destroyed meanwhile.
+std::shared_ptr<recorder> find(sycl::queue &queue);
+
+// Makes the recorder of the calling thread r for its lifetime.
+class scope {
+public:
+    explicit scope(recorder *r);
+    ~scope();
+
+    scope(const scope &) = delete;
+    scope &operator=(const scope &) = delete;
+
+private:
+    recorder *previous_;
+};
+
+// Runs f, a call dispatched while r records its queue. A call the backend
+// submits instead of handing it to r would run ahead of the calls recorded
+// before it, so it is refused: calls on buffers before they are made, since
+// no backend records them, and USM calls once the backend has submitted them.
+template <typename R>
+struct recording {
+    template <typename F>
+    static R run(recorder &r, const char *domain, const char *name, F &f) {
+        const std::size_t recorded = r.size();
+        R result = f();
+        if (r.size() == recorded)
+            throw oneapi::mkl::unimplemented(domain, name,
+                                             "in a graph by this backend, which submitted it");
+        return result;
+    }
+};
+
+template <>
+struct recording<void> {
+    template <typename F>
+    static void run(recorder &, const char *domain, const char *name, F &) {
+        throw oneapi::mkl::invalid_argument(domain, name, "calls on buffers cannot be recorded");
+    }
+};
+
+// host_task automatically uses run_on_host_intel if it is supported by the
+// compiler. Otherwise, it falls back to the SYCL 2020 host_task.
+template <typename H, typename F>
+inline auto host_task_internal(H &cgh, F f, int) -> decltype(cgh.run_on_host_intel(f)) {
+    return cgh.run_on_host_intel(f);
+}
+
+template <typename H, typename F>
+inline void host_task_internal(H &cgh, F f, long) {
+    cgh.host_task(f);
+}
+
+template <typename F>
+inline void host_task(sycl::handler &cgh, F f) {
+    (void)host_task_internal(cgh, f, 0);
+}
+
+// Backend side.
+
+inline recorder *current() {
+#ifdef __linux__
+    static const auto fn = reinterpret_cast<recorder_fn>(dlsym(RTLD_DEFAULT, recorder_symbol));
+#elif defined(_WIN64)
+    static const auto fn = reinterpret_cast<recorder_fn>(
+        GetProcAddress(GetModuleHandleA("onemkl.dll"), recorder_symbol));
+#else
+    static const recorder_fn fn = nullptr;
+#endif
+    return fn != nullptr ? fn() : nullptr;
+}
+
+// Stands in for the command group handler of a call being recorded. It takes
+// the host task of the command group and the events it depends on.
+class handler {
+public:
+    explicit handler(recorder &r) : recorder_(r) {}
+
+    void depends_on(const sycl::event &event) {
+        recorder_.depends_on(event);
+    }
+
+    template <typename F>
+    void run_on_host_intel(F f) {
+        done_ = recorder_.add(std::move(f));
+    }
+
+    sycl::event done() const {
+        return done_;
+    }
+
+private:
+    recorder &recorder_;
+    sycl::event done_;
+};
+
+// Submits a command group made of dependencies and a host task, written as a
+// generic lambda, to queue. If the calling thread has a recorder the command
+// group is run against it instead.
+template <typename CGF>
+inline sycl::event submit(sycl::queue &queue, CGF cgf) {
+    if (recorder *r = current()) {
+        handler cgh(*r);
+        cgf(cgh);
+        return cgh.done();
+    }
+    return queue.submit([&](sycl::handler &cgh) { cgf(cgh); });
+}
+
+} // namespace graph
+} // namespace detail
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_GRAPH_HELPER_HPP_
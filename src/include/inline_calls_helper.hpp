@@ -0,0 +1,68 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_INLINE_CALLS_HELPER_HPP_
+#define _ONEMKL_INLINE_CALLS_HELPER_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "graph_helper.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace detail {
+namespace inline_calls {
+
+// Size below which calls run inline, 0 while inline calls are disabled.
+extern std::atomic<std::int64_t> threshold;
+
+inline std::int64_t limit() {
+    return threshold.load(std::memory_order_relaxed);
+}
+
+// Recorder that runs the host task of a call at once when the events it
+// depends on are complete, and submits it to the queue otherwise.
+class executor : public graph::recorder {
+public:
+    explicit executor(sycl::queue &queue) : queue_(queue) {}
+
+    void depends_on(const sycl::event &event) override;
+    sycl::event add(std::function<void()> task) override;
+    std::size_t size() const override {
+        return size_;
+    }
+
+private:
+    sycl::queue &queue_;
+    std::vector<sycl::event> dependencies_;
+    std::size_t size_ = 0;
+};
+
+} // namespace inline_calls
+} // namespace detail
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_INLINE_CALLS_HELPER_HPP_
@@ -0,0 +1,220 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_NUMA_HELPER_HPP_
+#define _ONEMKL_NUMA_HELPER_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "oneapi/mkl/execution_policy.hpp"
+#include "oneapi/mkl/numa.hpp"
+#include "execution_policy_helper.hpp"
+
+#ifdef __linux__
+#include <dlfcn.h>
+#elif defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace oneapi {
+namespace mkl {
+namespace detail {
+namespace numa {
+
+// Allocation of numa_malloc_shared (see oneapi/mkl/numa.hpp) whose pages were
+// placed over several nodes.
+struct allocation {
+    const char *begin;
+    std::size_t bytes;
+    numa_policy policy;
+    // Byte offsets of the blocks of the nodes of a partitioned allocation, one
+    // more than the nodes.
+    std::vector<std::size_t> bounds;
+    // CPUs of each node, and as many threads.
+    std::vector<execution_policy> nodes;
+};
+
+using shared_allocation = std::shared_ptr<const allocation>;
+
+// Function of the dispatcher library setting its second argument to the
+// allocation holding an address, or to nullptr. The backends look it up at run
+// time, so they do not link to the dispatcher.
+constexpr char allocation_symbol[] = "onemkl_numa_allocation";
+using allocation_fn = void (*)(const void *, shared_allocation *);
+
+// Dispatcher side.
+
+// Nodes listed by ONEMKL_NUMA_NODES (see oneapi/mkl/numa.hpp), or nullptr.
+const char *listed_nodes();
+
+// Listed nodes, or else the online nodes with CPUs.
+std::vector<std::int64_t> nodes();
+
+// CPUs of a node, empty if it has none or NUMA is not supported.
+std::vector<int> node_cpus(std::int64_t node);
+
+// Backend side.
+
+inline shared_allocation find(const void *p) {
+#ifdef __linux__
+    static const auto fn = reinterpret_cast<allocation_fn>(dlsym(RTLD_DEFAULT, allocation_symbol));
+#elif defined(_WIN64)
+    static const auto fn = reinterpret_cast<allocation_fn>(
+        GetProcAddress(GetModuleHandleA("onemkl.dll"), allocation_symbol));
+#else
+    static const allocation_fn fn = nullptr;
+#endif
+    shared_allocation found;
+    if (fn != nullptr)
+        fn(p, &found);
+    return found;
+}
+
+// Calls smaller than this per node are not split, as starting the threads
+// would cost more than the bandwidth they gain.
+constexpr std::size_t min_node_bytes = std::size_t(1) << 20;
+
+// Smallest part of a node's share run by a thread of its own, for backends
+// whose library is not threaded.
+constexpr std::size_t min_thread_bytes = std::size_t(64) << 10;
+
+// Parts of a call over count items of stride bytes from p, following the
+// blocks of the partitioned allocation holding p. Each part runs on a thread
+// pinned to the CPUs of its node, under the threads of the node if the library
+// of the backend is threaded, and split into one part per CPU of the node
+// otherwise. A call on an array that is not partitioned is a single part run
+// on the calling thread: the pages of an interleaved array alternate between
+// the nodes within every part, so pinning parts to nodes would gain nothing.
+class plan {
+public:
+    plan(const void *p, std::int64_t count, std::size_t stride, bool threaded_library) {
+        parts_.push_back({ 0, count, nullptr });
+        if (count <= 0 || policy::thread_limit() > 0)
+            return;
+        allocation_ = find(p);
+        if (!allocation_ || allocation_->policy != numa_policy::partitioned ||
+            count * stride < allocation_->nodes.size() * min_node_bytes)
+            return;
+
+        const std::size_t offset = static_cast<const char *>(p) - allocation_->begin;
+        // First item whose start lies at byte offset bound of the allocation or past it.
+        auto first_item = [&](std::size_t bound) {
+            if (bound <= offset)
+                return std::int64_t(0);
+            return std::min<std::int64_t>(count, (bound - offset + stride - 1) / stride);
+        };
+
+        const std::size_t num_nodes = allocation_->nodes.size();
+        std::vector<part> parts;
+        for (std::size_t k = 0; k < num_nodes; k++) {
+            const execution_policy &node = allocation_->nodes[k];
+            const std::int64_t begin = first_item(allocation_->bounds[k]);
+            const std::int64_t end = first_item(allocation_->bounds[k + 1]);
+            if (begin >= end)
+                continue;
+            std::int64_t threads = 1;
+            if (!threaded_library) {
+                threads = std::max<std::int64_t>(
+                    1, std::min<std::int64_t>(node.threads,
+                                              (end - begin) * stride / min_thread_bytes));
+            }
+            for (std::int64_t t = 0; t < threads; t++) {
+                parts.push_back({ begin + (end - begin) * t / threads,
+                                  begin + (end - begin) * (t + 1) / threads, &node });
+            }
+        }
+        if (!parts.empty())
+            parts_ = std::move(parts);
+    }
+
+    std::size_t size() const {
+        return parts_.size();
+    }
+
+    // Calls f(part, begin, end) for every part, giving the threaded library
+    // of the backend the threads of the node through set_threads.
+    template <typename F>
+    void run(policy::applied::thread_setter set_threads, F f) const {
+        if (parts_.size() == 1 && parts_[0].node == nullptr) {
+            f(std::size_t(0), parts_[0].begin, parts_[0].end);
+            return;
+        }
+        auto work = [&](std::size_t i) {
+            policy::applied pinned(parts_[i].node, set_threads);
+            f(i, parts_[i].begin, parts_[i].end);
+        };
+        std::vector<std::thread> threads;
+        threads.reserve(parts_.size() - 1);
+        for (std::size_t i = 1; i < parts_.size(); i++)
+            threads.emplace_back(work, i);
+        work(0);
+        for (auto &thread : threads)
+            thread.join();
+    }
+
+private:
+    struct part {
+        std::int64_t begin, end;
+        const execution_policy *node;
+    };
+
+    shared_allocation allocation_;
+    std::vector<part> parts_;
+};
+
+// Runs f(begin, end) over count items of stride bytes from p, split by plan.
+template <typename F>
+inline void split(const void *p, std::int64_t count, std::size_t stride,
+                  policy::applied::thread_setter set_threads, F f) {
+    plan(p, count, stride, set_threads != nullptr)
+        .run(set_threads, [&](std::size_t, std::int64_t begin, std::int64_t end) {
+            f(begin, end);
+        });
+}
+
+// Splits a gemm over blocks of c following its placement: its columns in
+// column-major layout, its rows in row-major layout. f(m, n, a, b, c) computes
+// the block of c with the matching block of op(b), or of op(a).
+template <typename T, typename F>
+inline void split_gemm(bool column_major, bool trans_a, bool trans_b, std::int64_t m,
+                       std::int64_t n, const T *a, std::int64_t lda, const T *b, std::int64_t ldb,
+                       T *c, std::int64_t ldc, policy::applied::thread_setter set_threads, F f) {
+    if (column_major) {
+        split(c, n, ldc * sizeof(T), set_threads, [&](std::int64_t begin, std::int64_t end) {
+            f(m, end - begin, a, b + begin * (trans_b ? 1 : ldb), c + begin * ldc);
+        });
+    }
+    else {
+        split(c, m, ldc * sizeof(T), set_threads, [&](std::int64_t begin, std::int64_t end) {
+            f(end - begin, n, a + begin * (trans_a ? 1 : lda), b, c + begin * ldc);
+        });
+    }
+}
+
+} // namespace numa
+} // namespace detail
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_NUMA_HELPER_HPP_
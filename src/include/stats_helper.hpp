@@ -0,0 +1,246 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_STATS_HELPER_HPP_
+#define _ONEMKL_STATS_HELPER_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+#include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/stats.hpp"
+#include "verbose_helper.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace detail {
+namespace stats {
+
+constexpr int num_devices = 4;
+// Backends a call for a device can run on: the first one found for the
+// device, then the other backends autotuning routes x86cpu calls to.
+constexpr int max_backends = 4;
+constexpr int size_buckets = oneapi::mkl::stats::size_buckets;
+
+// Scalar arguments the work estimates and the size of a call depend on.
+enum arg { arg_m, arg_n, arg_k, arg_nrhs, arg_kl, arg_ku, arg_side, arg_job, arg_batch, num_args };
+
+// Problem shape of one call, as read from its scalar arguments.
+struct shape {
+    double m, n, k, nrhs, kl, ku;
+    bool left;
+    bool vectors;
+};
+
+// Families of routines sharing an operation count formula.
+enum class work {
+    none,
+    asum,
+    axpy,
+    copy,
+    dot,
+    iamax,
+    nrm2,
+    rot,
+    scal,
+    swap,
+    gemv,
+    gbmv,
+    ger,
+    symv,
+    sbmv,
+    syr,
+    syr2,
+    trmv,
+    tbmv,
+    gemm,
+    gemmt,
+    symm,
+    syrk,
+    syr2k,
+    trmm,
+    getrf,
+    getrs,
+    getri,
+    potrf,
+    potri,
+    trtrs,
+    geqrf,
+    orgqr,
+    orgtr,
+    ormqr,
+    ormtr,
+    sytrd,
+    gebrd,
+    sytrf,
+    syevd,
+    sygvd,
+    gesv,
+    posv,
+    gels
+};
+
+// Element size of the operands of a routine, and weight of one of its
+// operations: complex operations count as four real ones.
+struct precision {
+    double element_size;
+    double flop_scale;
+};
+
+constexpr precision s8{ 1, 1 };
+constexpr precision f16{ 2, 1 };
+constexpr precision f32{ 4, 1 };
+constexpr precision f64{ 8, 1 };
+constexpr precision c32{ 8, 4 };
+constexpr precision c64{ 16, 4 };
+
+// Family and precision of a routine, given by the loader next to its name.
+// Routines without a work estimate keep the default.
+struct kind {
+    work family = work::none;
+    precision type = { 0, 0 };
+};
+
+// Floating-point operations and matrix or vector elements read or written by
+// one problem of the given shape.
+void estimate(work kind, const shape &s, double &flops, double &elements);
+
+// Names the library of a backend other than the first one of its device, for
+// snapshots.
+void register_backend(oneapi::mkl::domain domain, oneapi::mkl::device libkey, int backend,
+                      const char *library);
+
+inline int size_bucket(std::int64_t size) {
+    int bucket = 0;
+    for (; size > 0 && bucket < size_buckets - 1; size >>= 1)
+        bucket++;
+    return bucket;
+}
+
+// Call counters of a loader routine. Each routine is a function-local static
+// that registers itself on construction; the counters are relaxed atomics so
+// that counting never takes a lock.
+class routine : public verbose::routine_info {
+public:
+    struct counters {
+        std::atomic<std::int64_t> calls;
+        std::atomic<std::uint64_t> flops;
+        std::atomic<std::uint64_t> bytes;
+        std::atomic<std::int64_t> histogram[size_buckets];
+    };
+
+    routine(const verbose::site &where, const char *name, const char *dims, kind k = {});
+    routine(const routine &) = delete;
+    routine &operator=(const routine &) = delete;
+
+    // Counts a call run on the given backend of libkey.
+    void count(oneapi::mkl::device libkey, int backend, const verbose::dims &args) {
+        counters &c = counters_[static_cast<int>(libkey)][std::min(backend, max_backends - 1)];
+        c.calls.fetch_add(1, std::memory_order_relaxed);
+        if (kind_.family != work::none) {
+            shape s;
+            s.m = value(args, arg_m);
+            s.n = value(args, arg_n);
+            s.k = value(args, arg_k);
+            s.nrhs = value(args, arg_nrhs);
+            s.kl = value(args, arg_kl);
+            s.ku = value(args, arg_ku);
+            s.left = value(args, arg_side) == 0;
+            s.vectors = value(args, arg_job) != 0;
+            const double batch = slots_[arg_batch] < 0 ? 1.0 : value(args, arg_batch);
+            double flops, elements;
+            estimate(kind_.family, s, flops, elements);
+            const precision &type = kind_.type;
+            c.flops.fetch_add(static_cast<std::uint64_t>(batch * flops * type.flop_scale),
+                              std::memory_order_relaxed);
+            c.bytes.fetch_add(static_cast<std::uint64_t>(batch * elements * type.element_size),
+                              std::memory_order_relaxed);
+        }
+        if (sized_)
+            c.histogram[bucket(args)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Largest of the m, n and k of a call.
+    std::int64_t size(const verbose::dims &args) const {
+        std::int64_t size = 0;
+        for (int a : { arg_m, arg_n, arg_k }) {
+            if (slots_[a] >= 0)
+                size = std::max(size, args.values[slots_[a]]);
+        }
+        return size;
+    }
+
+    // Size bucket of a call, from the largest of its m, n and k.
+    int bucket(const verbose::dims &args) const {
+        return size_bucket(size(args));
+    }
+
+    // Whether a call is a single problem, not a batch, of size below limit.
+    bool smaller(const verbose::dims &args, std::int64_t limit) const {
+        return sized_ && slots_[arg_batch] < 0 && size(args) < limit;
+    }
+
+    // Entry of a backend table for this routine. Composed tables hold nullptr
+    // for routines none of the loaded backends provides.
+    template <typename Fn>
+    Fn require(Fn fn) const {
+        if (fn == nullptr)
+            throw oneapi::mkl::unimplemented(verbose::domain_name(where.domain), name,
+                                             "in the loaded backends");
+        return fn;
+    }
+
+    // Index of the x86cpu backend the autotuner picked for a size bucket, -1
+    // until it is known, or autotune::untimed_choice while only untimed calls
+    // ran in it.
+    std::atomic<std::int8_t> &choice(int bucket) {
+        return choices_[bucket];
+    }
+
+    counters &get(int device, int backend) {
+        return counters_[device][backend];
+    }
+
+    void clear();
+
+    routine *next() const {
+        return next_;
+    }
+
+private:
+    double value(const verbose::dims &args, arg a) const {
+        return slots_[a] < 0 ? 0.0 : static_cast<double>(args.values[slots_[a]]);
+    }
+
+    counters counters_[num_devices][max_backends];
+    std::atomic<std::int8_t> choices_[size_buckets];
+    // Position of each arg in the dims of the routine, -1 if absent.
+    std::int8_t slots_[num_args];
+    bool sized_;
+    kind kind_;
+    routine *next_;
+};
+
+} // namespace stats
+} // namespace detail
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_STATS_HELPER_HPP_
@@ -0,0 +1,112 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_THREAD_POOL_HELPER_HPP_
+#define _ONEMKL_THREAD_POOL_HELPER_HPP_
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace oneapi {
+namespace mkl {
+namespace detail {
+
+// Host threads shared by the batched paths of the CPU backends, so that a call
+// does not pay for starting threads. The pool is never destroyed: its threads are
+// idle at exit and joining them from a static destructor could deadlock.
+class host_thread_pool {
+public:
+    static host_thread_pool &instance() {
+        static host_thread_pool *pool = new host_thread_pool();
+        return *pool;
+    }
+
+    // Calls f(t) for t in [0, count), f(0) on the calling thread. While its
+    // tasks run, the calling thread runs queued tasks too, so that nested and
+    // concurrent calls always make progress.
+    template <typename F>
+    void run(std::int64_t count, F &f) {
+        std::int64_t remaining = count - 1;
+        std::mutex done_mutex;
+        std::condition_variable done;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (; num_workers_ < count - 1; num_workers_++)
+                std::thread([this] { work(); }).detach();
+            for (std::int64_t t = 1; t < count; t++) {
+                tasks_.push_back([&, t] {
+                    f(t);
+                    std::lock_guard<std::mutex> done_lock(done_mutex);
+                    if (--remaining == 0)
+                        done.notify_one();
+                });
+            }
+        }
+        ready_.notify_all();
+        f(0);
+        while (run_one()) {
+        }
+        std::unique_lock<std::mutex> done_lock(done_mutex);
+        done.wait(done_lock, [&] { return remaining == 0; });
+    }
+
+private:
+    host_thread_pool() = default;
+
+    bool run_one() {
+        std::function<void()> task;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (tasks_.empty())
+                return false;
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        task();
+        return true;
+    }
+
+    void work() {
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                ready_.wait(lock, [this] { return !tasks_.empty(); });
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::deque<std::function<void()>> tasks_;
+    std::int64_t num_workers_ = 0;
+};
+
+} // namespace detail
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_THREAD_POOL_HELPER_HPP_
@@ -0,0 +1,94 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_THREADING_LAYER_HELPER_HPP_
+#define _ONEMKL_THREADING_LAYER_HELPER_HPP_
+
+#include "oneapi/mkl/threading_layer.hpp"
+
+#ifdef __linux__
+#include <dlfcn.h>
+#elif defined(_WIN64)
+#include <windows.h>
+#endif
+
+#ifdef ONEMKL_MKLCPU_THREAD_RUNTIME
+#include "mkl_service.h"
+#endif
+
+namespace oneapi {
+namespace mkl {
+namespace detail {
+namespace threading {
+
+// Function of the dispatcher library returning the selected threading layer
+// (see oneapi/mkl/threading_layer.hpp), after which it can no longer change.
+// The backends look it up at run time, so they do not link to the dispatcher.
+constexpr char layer_symbol[] = "onemkl_threading_layer";
+using layer_fn = int (*)();
+
+// Backend side.
+
+inline threading_layer requested() {
+#ifdef __linux__
+    static const auto fn = reinterpret_cast<layer_fn>(dlsym(RTLD_DEFAULT, layer_symbol));
+#elif defined(_WIN64)
+    static const auto fn = reinterpret_cast<layer_fn>(
+        GetProcAddress(GetModuleHandleA("onemkl.dll"), layer_symbol));
+#else
+    static const layer_fn fn = nullptr;
+#endif
+    return fn != nullptr ? static_cast<threading_layer>(fn()) : threading_layer::mkl_default;
+}
+
+#ifdef ONEMKL_MKLCPU_THREAD_RUNTIME
+// Sets the interface and threading layers of the single dynamic MKL library.
+// Returns the MKL threading layer in effect, which is not the requested one if
+// MKL already ran a call, or -1 if MKL makes its own choice.
+inline int select_mkl_layers() {
+#ifdef MKL_ILP64
+    mkl_set_interface_layer(MKL_INTERFACE_ILP64);
+#endif
+    switch (requested()) {
+        case threading_layer::sequential: return mkl_set_threading_layer(MKL_THREADING_SEQUENTIAL);
+        case threading_layer::intel: return mkl_set_threading_layer(MKL_THREADING_INTEL);
+        case threading_layer::gnu: return mkl_set_threading_layer(MKL_THREADING_GNU);
+        case threading_layer::tbb: return mkl_set_threading_layer(MKL_THREADING_TBB);
+        default: return -1;
+    }
+}
+#endif
+
+// Selects the MKL layers once, before the first MKL call of a backend. The MKL
+// CPU backends call it as they dispatch a call rather than when they are
+// loaded, since the dispatcher may load a backend, to compose or autotune
+// tables, well before the application picks its threading layer.
+inline void ensure_mkl_layers() {
+#ifdef ONEMKL_MKLCPU_THREAD_RUNTIME
+    static const int layer = select_mkl_layers();
+    static_cast<void>(layer);
+#endif
+}
+
+} // namespace threading
+} // namespace detail
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_THREADING_LAYER_HELPER_HPP_
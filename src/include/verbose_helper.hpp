@@ -0,0 +1,157 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_VERBOSE_HELPER_HPP_
+#define _ONEMKL_VERBOSE_HELPER_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl/detail/backends_table.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace detail {
+namespace verbose {
+
+// Largest number of scalar arguments recorded for a call.
+constexpr int max_dims = 16;
+
+// Scalar arguments of a call, named by the dims of its routine.
+struct dims {
+    std::int64_t values[max_dims];
+    int count;
+};
+
+template <typename... Args>
+inline dims make_dims(Args... args) {
+    static_assert(sizeof...(Args) <= max_dims, "too many traced arguments");
+    return { { static_cast<std::int64_t>(args)... }, int(sizeof...(Args)) };
+}
+
+inline const char *domain_name(oneapi::mkl::domain domain) {
+    switch (domain) {
+        case oneapi::mkl::domain::blas: return "blas";
+        case oneapi::mkl::domain::lapack: return "lapack";
+        default: return "rng";
+    }
+}
+
+inline const char *device_name(oneapi::mkl::device libkey) {
+    switch (libkey) {
+        case oneapi::mkl::device::x86cpu: return "x86cpu";
+        case oneapi::mkl::device::intelgpu: return "intelgpu";
+        case oneapi::mkl::device::nvidiagpu: return "nvidiagpu";
+        default: return "amdgpu";
+    }
+}
+
+// Domain and data layout shared by the routines of a loader.
+struct site {
+    oneapi::mkl::domain domain;
+    const char *layout;
+};
+
+// A routine of a loader. dims is a space-separated list naming the scalar
+// arguments passed with each call.
+struct routine_info {
+    const site &where;
+    const char *name;
+    const char *dims;
+};
+
+// Consumers of the recorded calls, as bits of active.
+enum sink : int { trace_sink = 1, capture_sink = 2 };
+
+extern std::atomic<int> active;
+
+inline bool enabled() {
+    return active.load(std::memory_order_relaxed) != 0;
+}
+
+// Nanoseconds on the clock used for the trace.
+std::int64_t now();
+
+// Records a call that started at start and returned now. event is the event
+// returned by USM routines, nullptr otherwise.
+void record(const routine_info &routine, oneapi::mkl::device libkey, sycl::queue &queue,
+            const dims &args, std::int64_t start, const sycl::event *event);
+
+// Appends a call to the binary capture.
+void capture(const routine_info &routine, oneapi::mkl::device libkey, const dims &args,
+             std::int64_t start, std::int64_t end);
+
+// Called once a backend library has been loaded, to name it in the trace.
+void register_backend(oneapi::mkl::domain domain, oneapi::mkl::device libkey,
+                      const char *library);
+
+// Library registered for the backend, or an empty string.
+std::string backend_name(oneapi::mkl::domain domain, oneapi::mkl::device libkey);
+
+inline const sycl::event *event_of(const sycl::event &event) {
+    return &event;
+}
+
+template <typename T>
+inline const sycl::event *event_of(const T &) {
+    return nullptr;
+}
+
+template <typename R>
+struct recorder {
+    template <typename F>
+    static R run(const routine_info &routine, oneapi::mkl::device libkey, sycl::queue &queue,
+                 const dims &args, F &f) {
+        const std::int64_t start = now();
+        R result = f();
+        record(routine, libkey, queue, args, start, event_of(result));
+        return result;
+    }
+};
+
+template <>
+struct recorder<void> {
+    template <typename F>
+    static void run(const routine_info &routine, oneapi::mkl::device libkey, sycl::queue &queue,
+                    const dims &args, F &f) {
+        const std::int64_t start = now();
+        f();
+        record(routine, libkey, queue, args, start, nullptr);
+    }
+};
+
+// Calls f, the dispatch to the backend. When neither tracing nor capture is
+// enabled this costs a single relaxed load and branch on top of the dispatch.
+template <typename F>
+inline auto call(const routine_info &routine, oneapi::mkl::device libkey, sycl::queue &queue,
+                 const dims &args, F f) -> decltype(f()) {
+    if (!enabled())
+        return f();
+    return recorder<decltype(f())>::run(routine, libkey, queue, args, f);
+}
+
+} // namespace verbose
+} // namespace detail
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_VERBOSE_HELPER_HPP_
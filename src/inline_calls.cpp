@@ -0,0 +1,109 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <functional>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl/inline_calls.hpp"
+#include "inline_calls_helper.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace detail {
+namespace inline_calls {
+
+namespace {
+
+std::int64_t threshold_from_environment() {
+    const char *env = std::getenv("ONEMKL_INLINE");
+    if (env == nullptr || std::atoi(env) <= 0)
+        return 0;
+    env = std::getenv("ONEMKL_INLINE_THRESHOLD");
+    if (env != nullptr && std::atoll(env) > 0)
+        return std::atoll(env);
+    return oneapi::mkl::inline_calls::default_threshold;
+}
+
+} // namespace
+
+std::atomic<std::int64_t> threshold{ threshold_from_environment() };
+
+void executor::depends_on(const sycl::event &event) {
+    dependencies_.push_back(event);
+}
+
+sycl::event executor::add(std::function<void()> task) {
+    size_++;
+    const bool ready =
+        std::all_of(dependencies_.begin(), dependencies_.end(), [](const sycl::event &event) {
+            return event.get_info<sycl::info::event::command_execution_status>() ==
+                   sycl::info::event_command_status::complete;
+        });
+    if (ready) {
+        // A backend error is raised the way it would be by the host task: the
+        // exception is rethrown by a host task submitted to the queue, which
+        // hands it to the asynchronous handler of the queue.
+        std::exception_ptr error;
+        try {
+            task();
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+        if (!error)
+            return sycl::event{};
+        task = [error] { std::rethrow_exception(error); };
+    }
+    return queue_.submit([&](sycl::handler &cgh) {
+        for (auto &event : dependencies_)
+            cgh.depends_on(event);
+        graph::host_task(cgh, task);
+    });
+}
+
+} // namespace inline_calls
+} // namespace detail
+
+namespace inline_calls {
+
+void enable(std::int64_t threshold) {
+    detail::inline_calls::threshold = std::max<std::int64_t>(threshold, 0);
+}
+
+void disable() {
+    detail::inline_calls::threshold = 0;
+}
+
+bool is_enabled() {
+    return detail::inline_calls::limit() > 0;
+}
+
+std::int64_t get_threshold() {
+    return detail::inline_calls::limit();
+}
+
+} // namespace inline_calls
+} // namespace mkl
+} // namespace oneapi
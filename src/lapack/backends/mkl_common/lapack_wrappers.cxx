@@ -328,4 +328,108 @@ oneapi::mkl::lapack::LAPACK_BACKEND::gebrd, oneapi::mkl::lapack::LAPACK_BACKEND:
     oneapi::mkl::lapack::LAPACK_BACKEND::potrs_batch_scratchpad_size<std::complex<float>>,
     oneapi::mkl::lapack::LAPACK_BACKEND::potrs_batch_scratchpad_size<std::complex<double>>,
     oneapi::mkl::lapack::LAPACK_BACKEND::ungqr_batch_scratchpad_size<std::complex<float>>,
-    oneapi::mkl::lapack::LAPACK_BACKEND::ungqr_batch_scratchpad_size<std::complex<double>>
+    oneapi::mkl::lapack::LAPACK_BACKEND::ungqr_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv, oneapi::mkl::lapack::LAPACK_BACKEND::gesv,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv, oneapi::mkl::lapack::LAPACK_BACKEND::gesv,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv, oneapi::mkl::lapack::LAPACK_BACKEND::gesv,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv, oneapi::mkl::lapack::LAPACK_BACKEND::gesv,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv, oneapi::mkl::lapack::LAPACK_BACKEND::posv,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv, oneapi::mkl::lapack::LAPACK_BACKEND::posv,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv, oneapi::mkl::lapack::LAPACK_BACKEND::posv,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv, oneapi::mkl::lapack::LAPACK_BACKEND::posv,
+    oneapi::mkl::lapack::LAPACK_BACKEND::sysv, oneapi::mkl::lapack::LAPACK_BACKEND::sysv,
+    oneapi::mkl::lapack::LAPACK_BACKEND::sysv, oneapi::mkl::lapack::LAPACK_BACKEND::sysv,
+    oneapi::mkl::lapack::LAPACK_BACKEND::sysv, oneapi::mkl::lapack::LAPACK_BACKEND::sysv,
+    oneapi::mkl::lapack::LAPACK_BACKEND::sysv, oneapi::mkl::lapack::LAPACK_BACKEND::sysv,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_scratchpad_size<float>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_scratchpad_size<float>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::sysv_scratchpad_size<float>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::sysv_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::sysv_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::sysv_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gesv_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::posv_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels, oneapi::mkl::lapack::LAPACK_BACKEND::gels,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels, oneapi::mkl::lapack::LAPACK_BACKEND::gels,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels, oneapi::mkl::lapack::LAPACK_BACKEND::gels,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels, oneapi::mkl::lapack::LAPACK_BACKEND::gels,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gelsd, oneapi::mkl::lapack::LAPACK_BACKEND::gelsd,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gelsd, oneapi::mkl::lapack::LAPACK_BACKEND::gelsd,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gelsd, oneapi::mkl::lapack::LAPACK_BACKEND::gelsd,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gelsd, oneapi::mkl::lapack::LAPACK_BACKEND::gelsd,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_scratchpad_size<float>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gelsd_scratchpad_size<float>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gelsd_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gelsd_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gelsd_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::gels_batch_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevr, oneapi::mkl::lapack::LAPACK_BACKEND::syevr,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevr, oneapi::mkl::lapack::LAPACK_BACKEND::syevr,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevx, oneapi::mkl::lapack::LAPACK_BACKEND::syevx,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevx, oneapi::mkl::lapack::LAPACK_BACKEND::syevx,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevr_scratchpad_size<float>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevr_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevx_scratchpad_size<float>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevx_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevr, oneapi::mkl::lapack::LAPACK_BACKEND::heevr,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevr, oneapi::mkl::lapack::LAPACK_BACKEND::heevr,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevx, oneapi::mkl::lapack::LAPACK_BACKEND::heevx,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevx, oneapi::mkl::lapack::LAPACK_BACKEND::heevx,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevr_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevr_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevx_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevx_scratchpad_size<std::complex<double>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevd_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevd_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevd_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevd_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevd_batch_scratchpad_size<float>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::syevd_batch_scratchpad_size<double>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevd_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevd_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevd_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevd_batch,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevd_batch_scratchpad_size<std::complex<float>>,
+    oneapi::mkl::lapack::LAPACK_BACKEND::heevd_batch_scratchpad_size<std::complex<double>>
@@ -46,6 +46,86 @@ void gebrd(sycl::queue &queue, std::int64_t m, std::int64_t n,
     ::oneapi::mkl::lapack::gebrd(queue, m, n, a, lda, d, e, tauq, taup, scratchpad,
                                  scratchpad_size);
 }
+void gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+          std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &b,
+          std::int64_t ldb, sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    if (trans != oneapi::mkl::transpose::nontrans || m < n)
+        throw unimplemented("lapack", "gels", "for trans != nontrans or m < n");
+    sycl::buffer<float> tau(sycl::range<1>(std::max<std::int64_t>(n, 1)));
+    ::oneapi::mkl::lapack::geqrf(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+    ::oneapi::mkl::lapack::ormqr(queue, oneapi::mkl::side::left, oneapi::mkl::transpose::trans, m,
+                                 nrhs, n, a, lda, tau, b, ldb, scratchpad, scratchpad_size);
+    ::oneapi::mkl::lapack::trtrs(queue, oneapi::mkl::uplo::upper, oneapi::mkl::transpose::nontrans,
+                                 oneapi::mkl::diag::nonunit, n, nrhs, a, lda, b, ldb, scratchpad,
+                                 scratchpad_size);
+}
+void gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+          std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b,
+          std::int64_t ldb, sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    if (trans != oneapi::mkl::transpose::nontrans || m < n)
+        throw unimplemented("lapack", "gels", "for trans != nontrans or m < n");
+    sycl::buffer<double> tau(sycl::range<1>(std::max<std::int64_t>(n, 1)));
+    ::oneapi::mkl::lapack::geqrf(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+    ::oneapi::mkl::lapack::ormqr(queue, oneapi::mkl::side::left, oneapi::mkl::transpose::trans, m,
+                                 nrhs, n, a, lda, tau, b, ldb, scratchpad, scratchpad_size);
+    ::oneapi::mkl::lapack::trtrs(queue, oneapi::mkl::uplo::upper, oneapi::mkl::transpose::nontrans,
+                                 oneapi::mkl::diag::nonunit, n, nrhs, a, lda, b, ldb, scratchpad,
+                                 scratchpad_size);
+}
+void gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+          std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+          sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+          sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    if (trans != oneapi::mkl::transpose::nontrans || m < n)
+        throw unimplemented("lapack", "gels", "for trans != nontrans or m < n");
+    sycl::buffer<std::complex<float>> tau(sycl::range<1>(std::max<std::int64_t>(n, 1)));
+    ::oneapi::mkl::lapack::geqrf(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+    ::oneapi::mkl::lapack::unmqr(queue, oneapi::mkl::side::left, oneapi::mkl::transpose::conjtrans,
+                                 m, nrhs, n, a, lda, tau, b, ldb, scratchpad, scratchpad_size);
+    ::oneapi::mkl::lapack::trtrs(queue, oneapi::mkl::uplo::upper, oneapi::mkl::transpose::nontrans,
+                                 oneapi::mkl::diag::nonunit, n, nrhs, a, lda, b, ldb, scratchpad,
+                                 scratchpad_size);
+}
+void gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+          std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+          sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+          sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    if (trans != oneapi::mkl::transpose::nontrans || m < n)
+        throw unimplemented("lapack", "gels", "for trans != nontrans or m < n");
+    sycl::buffer<std::complex<double>> tau(sycl::range<1>(std::max<std::int64_t>(n, 1)));
+    ::oneapi::mkl::lapack::geqrf(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+    ::oneapi::mkl::lapack::unmqr(queue, oneapi::mkl::side::left, oneapi::mkl::transpose::conjtrans,
+                                 m, nrhs, n, a, lda, tau, b, ldb, scratchpad, scratchpad_size);
+    ::oneapi::mkl::lapack::trtrs(queue, oneapi::mkl::uplo::upper, oneapi::mkl::transpose::nontrans,
+                                 oneapi::mkl::diag::nonunit, n, nrhs, a, lda, b, ldb, scratchpad,
+                                 scratchpad_size);
+}
+void gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+           sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &b, std::int64_t ldb,
+           sycl::buffer<float> &s, float rcond, sycl::buffer<std::int64_t> &rank,
+           sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gelsd");
+}
+void gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+           sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b, std::int64_t ldb,
+           sycl::buffer<double> &s, double rcond, sycl::buffer<std::int64_t> &rank,
+           sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gelsd");
+}
+void gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+           sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<float>> &b, std::int64_t ldb, sycl::buffer<float> &s,
+           float rcond, sycl::buffer<std::int64_t> &rank,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gelsd");
+}
+void gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+           sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<double>> &b, std::int64_t ldb, sycl::buffer<double> &s,
+           double rcond, sycl::buffer<std::int64_t> &rank,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gelsd");
+}
 void gerqf(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<float> &a,
            std::int64_t lda, sycl::buffer<float> &tau, sycl::buffer<float> &scratchpad,
            std::int64_t scratchpad_size) {
@@ -158,6 +238,36 @@ void getrs(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n, std
     ::oneapi::mkl::lapack::getrs(queue, trans, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
                                  scratchpad_size);
 }
+void gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a,
+          std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, sycl::buffer<float> &b,
+          std::int64_t ldb, sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    ::oneapi::mkl::lapack::getrf(queue, n, n, a, lda, ipiv, scratchpad, scratchpad_size);
+    ::oneapi::mkl::lapack::getrs(queue, oneapi::mkl::transpose::nontrans, n, nrhs, a, lda, ipiv, b,
+                                 ldb, scratchpad, scratchpad_size);
+}
+void gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a,
+          std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, sycl::buffer<double> &b,
+          std::int64_t ldb, sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    ::oneapi::mkl::lapack::getrf(queue, n, n, a, lda, ipiv, scratchpad, scratchpad_size);
+    ::oneapi::mkl::lapack::getrs(queue, oneapi::mkl::transpose::nontrans, n, nrhs, a, lda, ipiv, b,
+                                 ldb, scratchpad, scratchpad_size);
+}
+void gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+          sycl::buffer<std::complex<float>> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+          sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+          sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    ::oneapi::mkl::lapack::getrf(queue, n, n, a, lda, ipiv, scratchpad, scratchpad_size);
+    ::oneapi::mkl::lapack::getrs(queue, oneapi::mkl::transpose::nontrans, n, nrhs, a, lda, ipiv, b,
+                                 ldb, scratchpad, scratchpad_size);
+}
+void gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+          sycl::buffer<std::complex<double>> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+          sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+          sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    ::oneapi::mkl::lapack::getrf(queue, n, n, a, lda, ipiv, scratchpad, scratchpad_size);
+    ::oneapi::mkl::lapack::getrs(queue, oneapi::mkl::transpose::nontrans, n, nrhs, a, lda, ipiv, b,
+                                 ldb, scratchpad, scratchpad_size);
+}
 void gesvd(sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
            std::int64_t n, sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &s,
            sycl::buffer<double> &u, std::int64_t ldu, sycl::buffer<double> &vt, std::int64_t ldvt,
@@ -365,6 +475,32 @@ void potrs(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int6
            sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
     ::oneapi::mkl::lapack::potrs(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad, scratchpad_size);
 }
+void posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+          sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &b, std::int64_t ldb,
+          sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    ::oneapi::mkl::lapack::potrf(queue, uplo, n, a, lda, scratchpad, scratchpad_size);
+    ::oneapi::mkl::lapack::potrs(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad, scratchpad_size);
+}
+void posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+          sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b, std::int64_t ldb,
+          sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    ::oneapi::mkl::lapack::potrf(queue, uplo, n, a, lda, scratchpad, scratchpad_size);
+    ::oneapi::mkl::lapack::potrs(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad, scratchpad_size);
+}
+void posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+          sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+          sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+          sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    ::oneapi::mkl::lapack::potrf(queue, uplo, n, a, lda, scratchpad, scratchpad_size);
+    ::oneapi::mkl::lapack::potrs(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad, scratchpad_size);
+}
+void posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+          sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+          sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+          sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    ::oneapi::mkl::lapack::potrf(queue, uplo, n, a, lda, scratchpad, scratchpad_size);
+    ::oneapi::mkl::lapack::potrs(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad, scratchpad_size);
+}
 void syevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
            sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &w,
            sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
@@ -422,6 +558,30 @@ void sytrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
            std::int64_t scratchpad_size) {
     ::oneapi::mkl::lapack::sytrf(queue, uplo, n, a, lda, ipiv, scratchpad, scratchpad_size);
 }
+void sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+          sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+          sycl::buffer<float> &b, std::int64_t ldb, sycl::buffer<float> &scratchpad,
+          std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "sysv");
+}
+void sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+          sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+          sycl::buffer<double> &b, std::int64_t ldb, sycl::buffer<double> &scratchpad,
+          std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "sysv");
+}
+void sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+          sycl::buffer<std::complex<float>> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+          sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+          sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "sysv");
+}
+void sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+          sycl::buffer<std::complex<double>> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+          sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+          sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "sysv");
+}
 void trtrs(sycl::queue &queue, oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans,
            oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs,
            sycl::buffer<std::complex<float>> &a, std::int64_t lda,
@@ -568,6 +728,114 @@ sycl::event gebrd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::compl
     return ::oneapi::mkl::lapack::gebrd(queue, m, n, a, lda, d, e, tauq, taup, scratchpad,
                                         scratchpad_size, dependencies);
 }
+sycl::event gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                 std::int64_t nrhs, float *a, std::int64_t lda, float *b, std::int64_t ldb,
+                 float *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    if (trans != oneapi::mkl::transpose::nontrans || m < n)
+        throw unimplemented("lapack", "gels", "for trans != nontrans or m < n");
+    float *tau = scratchpad;
+    float *work = scratchpad + n;
+    const std::int64_t work_size = scratchpad_size - n;
+    auto factor_done = ::oneapi::mkl::lapack::geqrf(queue, m, n, a, lda, tau, work, work_size,
+                                                    dependencies);
+    auto apply_done = ::oneapi::mkl::lapack::ormqr(queue, oneapi::mkl::side::left,
+                                                   oneapi::mkl::transpose::trans, m, nrhs, n, a,
+                                                   lda, tau, b, ldb, work, work_size,
+                                                   { factor_done });
+    return ::oneapi::mkl::lapack::trtrs(queue, oneapi::mkl::uplo::upper,
+                                        oneapi::mkl::transpose::nontrans,
+                                        oneapi::mkl::diag::nonunit, n, nrhs, a, lda, b, ldb, work,
+                                        work_size, { apply_done });
+}
+sycl::event gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                 std::int64_t nrhs, double *a, std::int64_t lda, double *b, std::int64_t ldb,
+                 double *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    if (trans != oneapi::mkl::transpose::nontrans || m < n)
+        throw unimplemented("lapack", "gels", "for trans != nontrans or m < n");
+    double *tau = scratchpad;
+    double *work = scratchpad + n;
+    const std::int64_t work_size = scratchpad_size - n;
+    auto factor_done = ::oneapi::mkl::lapack::geqrf(queue, m, n, a, lda, tau, work, work_size,
+                                                    dependencies);
+    auto apply_done = ::oneapi::mkl::lapack::ormqr(queue, oneapi::mkl::side::left,
+                                                   oneapi::mkl::transpose::trans, m, nrhs, n, a,
+                                                   lda, tau, b, ldb, work, work_size,
+                                                   { factor_done });
+    return ::oneapi::mkl::lapack::trtrs(queue, oneapi::mkl::uplo::upper,
+                                        oneapi::mkl::transpose::nontrans,
+                                        oneapi::mkl::diag::nonunit, n, nrhs, a, lda, b, ldb, work,
+                                        work_size, { apply_done });
+}
+sycl::event gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                 std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                 std::complex<float> *b, std::int64_t ldb, std::complex<float> *scratchpad,
+                 std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    if (trans != oneapi::mkl::transpose::nontrans || m < n)
+        throw unimplemented("lapack", "gels", "for trans != nontrans or m < n");
+    std::complex<float> *tau = scratchpad;
+    std::complex<float> *work = scratchpad + n;
+    const std::int64_t work_size = scratchpad_size - n;
+    auto factor_done = ::oneapi::mkl::lapack::geqrf(queue, m, n, a, lda, tau, work, work_size,
+                                                    dependencies);
+    auto apply_done = ::oneapi::mkl::lapack::unmqr(queue, oneapi::mkl::side::left,
+                                                   oneapi::mkl::transpose::conjtrans, m, nrhs, n, a,
+                                                   lda, tau, b, ldb, work, work_size,
+                                                   { factor_done });
+    return ::oneapi::mkl::lapack::trtrs(queue, oneapi::mkl::uplo::upper,
+                                        oneapi::mkl::transpose::nontrans,
+                                        oneapi::mkl::diag::nonunit, n, nrhs, a, lda, b, ldb, work,
+                                        work_size, { apply_done });
+}
+sycl::event gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                 std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                 std::complex<double> *b, std::int64_t ldb, std::complex<double> *scratchpad,
+                 std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    if (trans != oneapi::mkl::transpose::nontrans || m < n)
+        throw unimplemented("lapack", "gels", "for trans != nontrans or m < n");
+    std::complex<double> *tau = scratchpad;
+    std::complex<double> *work = scratchpad + n;
+    const std::int64_t work_size = scratchpad_size - n;
+    auto factor_done = ::oneapi::mkl::lapack::geqrf(queue, m, n, a, lda, tau, work, work_size,
+                                                    dependencies);
+    auto apply_done = ::oneapi::mkl::lapack::unmqr(queue, oneapi::mkl::side::left,
+                                                   oneapi::mkl::transpose::conjtrans, m, nrhs, n, a,
+                                                   lda, tau, b, ldb, work, work_size,
+                                                   { factor_done });
+    return ::oneapi::mkl::lapack::trtrs(queue, oneapi::mkl::uplo::upper,
+                                        oneapi::mkl::transpose::nontrans,
+                                        oneapi::mkl::diag::nonunit, n, nrhs, a, lda, b, ldb, work,
+                                        work_size, { apply_done });
+}
+sycl::event gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs, float *a,
+                  std::int64_t lda, float *b, std::int64_t ldb, float *s, float rcond,
+                  std::int64_t *rank, float *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gelsd");
+}
+sycl::event gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs, double *a,
+                  std::int64_t lda, double *b, std::int64_t ldb, double *s, double rcond,
+                  std::int64_t *rank, double *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gelsd");
+}
+sycl::event gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                  std::complex<float> *a, std::int64_t lda, std::complex<float> *b,
+                  std::int64_t ldb, float *s, float rcond, std::int64_t *rank,
+                  std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gelsd");
+}
+sycl::event gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                  std::complex<double> *a, std::int64_t lda, std::complex<double> *b,
+                  std::int64_t ldb, double *s, double rcond, std::int64_t *rank,
+                  std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gelsd");
+}
 sycl::event gerqf(sycl::queue &queue, std::int64_t m, std::int64_t n, float *a, std::int64_t lda,
                   float *tau, float *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
@@ -701,6 +969,42 @@ sycl::event getrs(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t
     return ::oneapi::mkl::lapack::getrs(queue, trans, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
                                         scratchpad_size, dependencies);
 }
+sycl::event gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, float *a, std::int64_t lda,
+                 std::int64_t *ipiv, float *b, std::int64_t ldb, float *scratchpad,
+                 std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    auto factor_done = ::oneapi::mkl::lapack::getrf(queue, n, n, a, lda, ipiv, scratchpad,
+                                                    scratchpad_size, dependencies);
+    return ::oneapi::mkl::lapack::getrs(queue, oneapi::mkl::transpose::nontrans, n, nrhs, a, lda,
+                                        ipiv, b, ldb, scratchpad, scratchpad_size, { factor_done });
+}
+sycl::event gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda,
+                 std::int64_t *ipiv, double *b, std::int64_t ldb, double *scratchpad,
+                 std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    auto factor_done = ::oneapi::mkl::lapack::getrf(queue, n, n, a, lda, ipiv, scratchpad,
+                                                    scratchpad_size, dependencies);
+    return ::oneapi::mkl::lapack::getrs(queue, oneapi::mkl::transpose::nontrans, n, nrhs, a, lda,
+                                        ipiv, b, ldb, scratchpad, scratchpad_size, { factor_done });
+}
+sycl::event gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::complex<float> *a,
+                 std::int64_t lda, std::int64_t *ipiv, std::complex<float> *b, std::int64_t ldb,
+                 std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    auto factor_done = ::oneapi::mkl::lapack::getrf(queue, n, n, a, lda, ipiv, scratchpad,
+                                                    scratchpad_size, dependencies);
+    return ::oneapi::mkl::lapack::getrs(queue, oneapi::mkl::transpose::nontrans, n, nrhs, a, lda,
+                                        ipiv, b, ldb, scratchpad, scratchpad_size, { factor_done });
+}
+sycl::event gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::complex<double> *a,
+                 std::int64_t lda, std::int64_t *ipiv, std::complex<double> *b, std::int64_t ldb,
+                 std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    auto factor_done = ::oneapi::mkl::lapack::getrf(queue, n, n, a, lda, ipiv, scratchpad,
+                                                    scratchpad_size, dependencies);
+    return ::oneapi::mkl::lapack::getrs(queue, oneapi::mkl::transpose::nontrans, n, nrhs, a, lda,
+                                        ipiv, b, ldb, scratchpad, scratchpad_size, { factor_done });
+}
 sycl::event gesvd(sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt,
                   std::int64_t m, std::int64_t n, double *a, std::int64_t lda, double *s, double *u,
                   std::int64_t ldu, double *vt, std::int64_t ldvt, double *scratchpad,
@@ -959,6 +1263,42 @@ sycl::event potrs(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, st
     return ::oneapi::mkl::lapack::potrs(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
                                         scratchpad_size, dependencies);
 }
+sycl::event posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                 float *a, std::int64_t lda, float *b, std::int64_t ldb, float *scratchpad,
+                 std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    auto factor_done = ::oneapi::mkl::lapack::potrf(queue, uplo, n, a, lda, scratchpad,
+                                                    scratchpad_size, dependencies);
+    return ::oneapi::mkl::lapack::potrs(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
+                                        scratchpad_size, { factor_done });
+}
+sycl::event posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                 double *a, std::int64_t lda, double *b, std::int64_t ldb, double *scratchpad,
+                 std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    auto factor_done = ::oneapi::mkl::lapack::potrf(queue, uplo, n, a, lda, scratchpad,
+                                                    scratchpad_size, dependencies);
+    return ::oneapi::mkl::lapack::potrs(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
+                                        scratchpad_size, { factor_done });
+}
+sycl::event posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                 std::complex<float> *a, std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
+                 std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    auto factor_done = ::oneapi::mkl::lapack::potrf(queue, uplo, n, a, lda, scratchpad,
+                                                    scratchpad_size, dependencies);
+    return ::oneapi::mkl::lapack::potrs(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
+                                        scratchpad_size, { factor_done });
+}
+sycl::event posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                 std::complex<double> *a, std::int64_t lda, std::complex<double> *b,
+                 std::int64_t ldb, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    auto factor_done = ::oneapi::mkl::lapack::potrf(queue, uplo, n, a, lda, scratchpad,
+                                                    scratchpad_size, dependencies);
+    return ::oneapi::mkl::lapack::potrs(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
+                                        scratchpad_size, { factor_done });
+}
 sycl::event syevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
                   double *a, std::int64_t lda, double *w, double *scratchpad,
                   std::int64_t scratchpad_size,
@@ -1029,6 +1369,32 @@ sycl::event sytrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
     return ::oneapi::mkl::lapack::sytrf(queue, uplo, n, a, lda, ipiv, scratchpad, scratchpad_size,
                                         dependencies);
 }
+sycl::event sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                 float *a, std::int64_t lda, std::int64_t *ipiv, float *b, std::int64_t ldb,
+                 float *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "sysv");
+}
+sycl::event sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                 double *a, std::int64_t lda, std::int64_t *ipiv, double *b, std::int64_t ldb,
+                 double *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "sysv");
+}
+sycl::event sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                 std::complex<float> *a, std::int64_t lda, std::int64_t *ipiv,
+                 std::complex<float> *b, std::int64_t ldb, std::complex<float> *scratchpad,
+                 std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "sysv");
+}
+sycl::event sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                 std::complex<double> *a, std::int64_t lda, std::int64_t *ipiv,
+                 std::complex<double> *b, std::int64_t ldb, std::complex<double> *scratchpad,
+                 std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "sysv");
+}
 sycl::event trtrs(sycl::queue &queue, oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans,
                   oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs, std::complex<float> *a,
                   std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
@@ -1248,6 +1614,104 @@ void getrs_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t
     ::oneapi::mkl::lapack::getrs_batch(queue, trans, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv,
                                        b, ldb, stride_b, batch_size, scratchpad, scratchpad_size);
 }
+void gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a,
+                std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+                std::int64_t stride_ipiv, sycl::buffer<float> &b, std::int64_t ldb,
+                std::int64_t stride_b, std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                std::int64_t scratchpad_size) {
+    ::oneapi::mkl::lapack::getrf_batch(queue, n, n, a, lda, stride_a, ipiv, stride_ipiv, batch_size,
+                                       scratchpad, scratchpad_size);
+    ::oneapi::mkl::lapack::getrs_batch(queue, oneapi::mkl::transpose::nontrans, n, nrhs, a, lda,
+                                       stride_a, ipiv, stride_ipiv, b, ldb, stride_b, batch_size,
+                                       scratchpad, scratchpad_size);
+}
+void gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a,
+                std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+                std::int64_t stride_ipiv, sycl::buffer<double> &b, std::int64_t ldb,
+                std::int64_t stride_b, std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                std::int64_t scratchpad_size) {
+    ::oneapi::mkl::lapack::getrf_batch(queue, n, n, a, lda, stride_a, ipiv, stride_ipiv, batch_size,
+                                       scratchpad, scratchpad_size);
+    ::oneapi::mkl::lapack::getrs_batch(queue, oneapi::mkl::transpose::nontrans, n, nrhs, a, lda,
+                                       stride_a, ipiv, stride_ipiv, b, ldb, stride_b, batch_size,
+                                       scratchpad, scratchpad_size);
+}
+void gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                sycl::buffer<std::complex<float>> &b, std::int64_t ldb, std::int64_t stride_b,
+                std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
+                std::int64_t scratchpad_size) {
+    ::oneapi::mkl::lapack::getrf_batch(queue, n, n, a, lda, stride_a, ipiv, stride_ipiv, batch_size,
+                                       scratchpad, scratchpad_size);
+    ::oneapi::mkl::lapack::getrs_batch(queue, oneapi::mkl::transpose::nontrans, n, nrhs, a, lda,
+                                       stride_a, ipiv, stride_ipiv, b, ldb, stride_b, batch_size,
+                                       scratchpad, scratchpad_size);
+}
+void gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                sycl::buffer<std::complex<double>> &b, std::int64_t ldb, std::int64_t stride_b,
+                std::int64_t batch_size, sycl::buffer<std::complex<double>> &scratchpad,
+                std::int64_t scratchpad_size) {
+    ::oneapi::mkl::lapack::getrf_batch(queue, n, n, a, lda, stride_a, ipiv, stride_ipiv, batch_size,
+                                       scratchpad, scratchpad_size);
+    ::oneapi::mkl::lapack::getrs_batch(queue, oneapi::mkl::transpose::nontrans, n, nrhs, a, lda,
+                                       stride_a, ipiv, stride_ipiv, b, ldb, stride_b, batch_size,
+                                       scratchpad, scratchpad_size);
+}
+void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<float> &b, std::int64_t ldb, std::int64_t stride_b,
+                std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gels_batch");
+}
+void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<double> &b, std::int64_t ldb, std::int64_t stride_b,
+                std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gels_batch");
+}
+void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                std::int64_t stride_a, sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                std::int64_t stride_b, std::int64_t batch_size,
+                sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gels_batch");
+}
+void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                std::int64_t stride_a, sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                std::int64_t stride_b, std::int64_t batch_size,
+                sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "gels_batch");
+}
+void heevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                 sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<float> &w, std::int64_t stride_w, std::int64_t batch_size,
+                 sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    for (std::int64_t i = 0; i < batch_size; i++) {
+        sycl::buffer<std::complex<float>> a_i(a, sycl::id<1>(i * stride_a),
+                                              sycl::range<1>(lda * n));
+        sycl::buffer<float> w_i(w, sycl::id<1>(i * stride_w), sycl::range<1>(n));
+        ::oneapi::mkl::lapack::heevd(queue, jobz, uplo, n, a_i, lda, w_i, scratchpad,
+                                     scratchpad_size);
+    }
+}
+void heevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                 sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<double> &w, std::int64_t stride_w, std::int64_t batch_size,
+                 sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    for (std::int64_t i = 0; i < batch_size; i++) {
+        sycl::buffer<std::complex<double>> a_i(a, sycl::id<1>(i * stride_a),
+                                               sycl::range<1>(lda * n));
+        sycl::buffer<double> w_i(w, sycl::id<1>(i * stride_w), sycl::range<1>(n));
+        ::oneapi::mkl::lapack::heevd(queue, jobz, uplo, n, a_i, lda, w_i, scratchpad,
+                                     scratchpad_size);
+    }
+}
 void getrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<float> &a,
                  std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
                  std::int64_t stride_ipiv, std::int64_t batch_size, sycl::buffer<float> &scratchpad,
@@ -1351,6 +1815,68 @@ void potrs_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std
     ::oneapi::mkl::lapack::potrs_batch(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b,
                                        batch_size, scratchpad, scratchpad_size);
 }
+void posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<float> &b, std::int64_t ldb, std::int64_t stride_b,
+                std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                std::int64_t scratchpad_size) {
+    ::oneapi::mkl::lapack::potrf_batch(queue, uplo, n, a, lda, stride_a, batch_size, scratchpad,
+                                       scratchpad_size);
+    ::oneapi::mkl::lapack::potrs_batch(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b,
+                                       batch_size, scratchpad, scratchpad_size);
+}
+void posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<double> &b, std::int64_t ldb, std::int64_t stride_b,
+                std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                std::int64_t scratchpad_size) {
+    ::oneapi::mkl::lapack::potrf_batch(queue, uplo, n, a, lda, stride_a, batch_size, scratchpad,
+                                       scratchpad_size);
+    ::oneapi::mkl::lapack::potrs_batch(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b,
+                                       batch_size, scratchpad, scratchpad_size);
+}
+void posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<std::complex<float>> &b, std::int64_t ldb, std::int64_t stride_b,
+                std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
+                std::int64_t scratchpad_size) {
+    ::oneapi::mkl::lapack::potrf_batch(queue, uplo, n, a, lda, stride_a, batch_size, scratchpad,
+                                       scratchpad_size);
+    ::oneapi::mkl::lapack::potrs_batch(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b,
+                                       batch_size, scratchpad, scratchpad_size);
+}
+void posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<std::complex<double>> &b, std::int64_t ldb, std::int64_t stride_b,
+                std::int64_t batch_size, sycl::buffer<std::complex<double>> &scratchpad,
+                std::int64_t scratchpad_size) {
+    ::oneapi::mkl::lapack::potrf_batch(queue, uplo, n, a, lda, stride_a, batch_size, scratchpad,
+                                       scratchpad_size);
+    ::oneapi::mkl::lapack::potrs_batch(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b,
+                                       batch_size, scratchpad, scratchpad_size);
+}
+void syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                 sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<float> &w, std::int64_t stride_w, std::int64_t batch_size,
+                 sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    for (std::int64_t i = 0; i < batch_size; i++) {
+        sycl::buffer<float> a_i(a, sycl::id<1>(i * stride_a), sycl::range<1>(lda * n));
+        sycl::buffer<float> w_i(w, sycl::id<1>(i * stride_w), sycl::range<1>(n));
+        ::oneapi::mkl::lapack::syevd(queue, jobz, uplo, n, a_i, lda, w_i, scratchpad,
+                                     scratchpad_size);
+    }
+}
+void syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                 sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<double> &w, std::int64_t stride_w, std::int64_t batch_size,
+                 sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    for (std::int64_t i = 0; i < batch_size; i++) {
+        sycl::buffer<double> a_i(a, sycl::id<1>(i * stride_a), sycl::range<1>(lda * n));
+        sycl::buffer<double> w_i(w, sycl::id<1>(i * stride_w), sycl::range<1>(n));
+        ::oneapi::mkl::lapack::syevd(queue, jobz, uplo, n, a_i, lda, w_i, scratchpad,
+                                     scratchpad_size);
+    }
+}
 void ungqr_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
                  sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
                  sycl::buffer<std::complex<float>> &tau, std::int64_t stride_tau,
@@ -1605,6 +2131,120 @@ sycl::event getrs_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::i
                                               stride_ipiv, b, ldb, stride_b, batch_size, scratchpad,
                                               scratchpad_size, dependencies);
 }
+sycl::event gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, float *a,
+                       std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
+                       std::int64_t stride_ipiv, float *b, std::int64_t ldb, std::int64_t stride_b,
+                       std::int64_t batch_size, float *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    auto factor_done = ::oneapi::mkl::lapack::getrf_batch(queue, n, n, a, lda, stride_a, ipiv,
+                                                          stride_ipiv, batch_size, scratchpad,
+                                                          scratchpad_size, dependencies);
+    return ::oneapi::mkl::lapack::getrs_batch(queue, oneapi::mkl::transpose::nontrans, n, nrhs, a,
+                                              lda, stride_a, ipiv, stride_ipiv, b, ldb, stride_b,
+                                              batch_size, scratchpad, scratchpad_size,
+                                              { factor_done });
+}
+sycl::event gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, double *a,
+                       std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
+                       std::int64_t stride_ipiv, double *b, std::int64_t ldb, std::int64_t stride_b,
+                       std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    auto factor_done = ::oneapi::mkl::lapack::getrf_batch(queue, n, n, a, lda, stride_a, ipiv,
+                                                          stride_ipiv, batch_size, scratchpad,
+                                                          scratchpad_size, dependencies);
+    return ::oneapi::mkl::lapack::getrs_batch(queue, oneapi::mkl::transpose::nontrans, n, nrhs, a,
+                                              lda, stride_a, ipiv, stride_ipiv, b, ldb, stride_b,
+                                              batch_size, scratchpad, scratchpad_size,
+                                              { factor_done });
+}
+sycl::event gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                       std::complex<float> *a, std::int64_t lda, std::int64_t stride_a,
+                       std::int64_t *ipiv, std::int64_t stride_ipiv, std::complex<float> *b,
+                       std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                       std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    auto factor_done = ::oneapi::mkl::lapack::getrf_batch(queue, n, n, a, lda, stride_a, ipiv,
+                                                          stride_ipiv, batch_size, scratchpad,
+                                                          scratchpad_size, dependencies);
+    return ::oneapi::mkl::lapack::getrs_batch(queue, oneapi::mkl::transpose::nontrans, n, nrhs, a,
+                                              lda, stride_a, ipiv, stride_ipiv, b, ldb, stride_b,
+                                              batch_size, scratchpad, scratchpad_size,
+                                              { factor_done });
+}
+sycl::event gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                       std::complex<double> *a, std::int64_t lda, std::int64_t stride_a,
+                       std::int64_t *ipiv, std::int64_t stride_ipiv, std::complex<double> *b,
+                       std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                       std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    auto factor_done = ::oneapi::mkl::lapack::getrf_batch(queue, n, n, a, lda, stride_a, ipiv,
+                                                          stride_ipiv, batch_size, scratchpad,
+                                                          scratchpad_size, dependencies);
+    return ::oneapi::mkl::lapack::getrs_batch(queue, oneapi::mkl::transpose::nontrans, n, nrhs, a,
+                                              lda, stride_a, ipiv, stride_ipiv, b, ldb, stride_b,
+                                              batch_size, scratchpad, scratchpad_size,
+                                              { factor_done });
+}
+sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                       std::int64_t n, std::int64_t nrhs, float *a, std::int64_t lda,
+                       std::int64_t stride_a, float *b, std::int64_t ldb, std::int64_t stride_b,
+                       std::int64_t batch_size, float *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gels_batch");
+}
+sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                       std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda,
+                       std::int64_t stride_a, double *b, std::int64_t ldb, std::int64_t stride_b,
+                       std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gels_batch");
+}
+sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                       std::int64_t n, std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                       std::int64_t stride_a, std::complex<float> *b, std::int64_t ldb,
+                       std::int64_t stride_b, std::int64_t batch_size,
+                       std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gels_batch");
+}
+sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                       std::int64_t n, std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                       std::int64_t stride_a, std::complex<double> *b, std::int64_t ldb,
+                       std::int64_t stride_b, std::int64_t batch_size,
+                       std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "gels_batch");
+}
+sycl::event heevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                        std::int64_t n, std::complex<float> *a, std::int64_t lda,
+                        std::int64_t stride_a, float *w, std::int64_t stride_w,
+                        std::int64_t batch_size, std::complex<float> *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    sycl::vector_class<sycl::event> deps = dependencies;
+    sycl::event done;
+    for (std::int64_t i = 0; i < batch_size; i++) {
+        done = ::oneapi::mkl::lapack::heevd(queue, jobz, uplo, n, a + i * stride_a, lda,
+                                            w + i * stride_w, scratchpad, scratchpad_size, deps);
+        deps = { done };
+    }
+    return done;
+}
+sycl::event heevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                        std::int64_t n, std::complex<double> *a, std::int64_t lda,
+                        std::int64_t stride_a, double *w, std::int64_t stride_w,
+                        std::int64_t batch_size, std::complex<double> *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    sycl::vector_class<sycl::event> deps = dependencies;
+    sycl::event done;
+    for (std::int64_t i = 0; i < batch_size; i++) {
+        done = ::oneapi::mkl::lapack::heevd(queue, jobz, uplo, n, a + i * stride_a, lda,
+                                            w + i * stride_w, scratchpad, scratchpad_size, deps);
+        deps = { done };
+    }
+    return done;
+}
 sycl::event getrs_batch(sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *n,
                         std::int64_t *nrhs, float **a, std::int64_t *lda, std::int64_t **ipiv,
                         float **b, std::int64_t *ldb, std::int64_t group_count,
@@ -1773,6 +2413,84 @@ sycl::event potrs_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t
                                               stride_b, batch_size, scratchpad, scratchpad_size,
                                               dependencies);
 }
+sycl::event posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                       std::int64_t nrhs, float *a, std::int64_t lda, std::int64_t stride_a,
+                       float *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                       float *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    auto factor_done = ::oneapi::mkl::lapack::potrf_batch(queue, uplo, n, a, lda, stride_a,
+                                                          batch_size, scratchpad, scratchpad_size,
+                                                          dependencies);
+    return ::oneapi::mkl::lapack::potrs_batch(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                                              stride_b, batch_size, scratchpad, scratchpad_size,
+                                              { factor_done });
+}
+sycl::event posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                       std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t stride_a,
+                       double *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                       double *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    auto factor_done = ::oneapi::mkl::lapack::potrf_batch(queue, uplo, n, a, lda, stride_a,
+                                                          batch_size, scratchpad, scratchpad_size,
+                                                          dependencies);
+    return ::oneapi::mkl::lapack::potrs_batch(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                                              stride_b, batch_size, scratchpad, scratchpad_size,
+                                              { factor_done });
+}
+sycl::event posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                       std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                       std::int64_t stride_a, std::complex<float> *b, std::int64_t ldb,
+                       std::int64_t stride_b, std::int64_t batch_size,
+                       std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    auto factor_done = ::oneapi::mkl::lapack::potrf_batch(queue, uplo, n, a, lda, stride_a,
+                                                          batch_size, scratchpad, scratchpad_size,
+                                                          dependencies);
+    return ::oneapi::mkl::lapack::potrs_batch(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                                              stride_b, batch_size, scratchpad, scratchpad_size,
+                                              { factor_done });
+}
+sycl::event posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                       std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                       std::int64_t stride_a, std::complex<double> *b, std::int64_t ldb,
+                       std::int64_t stride_b, std::int64_t batch_size,
+                       std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    auto factor_done = ::oneapi::mkl::lapack::potrf_batch(queue, uplo, n, a, lda, stride_a,
+                                                          batch_size, scratchpad, scratchpad_size,
+                                                          dependencies);
+    return ::oneapi::mkl::lapack::potrs_batch(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                                              stride_b, batch_size, scratchpad, scratchpad_size,
+                                              { factor_done });
+}
+sycl::event syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                        std::int64_t n, float *a, std::int64_t lda, std::int64_t stride_a, float *w,
+                        std::int64_t stride_w, std::int64_t batch_size, float *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    sycl::vector_class<sycl::event> deps = dependencies;
+    sycl::event done;
+    for (std::int64_t i = 0; i < batch_size; i++) {
+        done = ::oneapi::mkl::lapack::syevd(queue, jobz, uplo, n, a + i * stride_a, lda,
+                                            w + i * stride_w, scratchpad, scratchpad_size, deps);
+        deps = { done };
+    }
+    return done;
+}
+sycl::event syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                        std::int64_t n, double *a, std::int64_t lda, std::int64_t stride_a,
+                        double *w, std::int64_t stride_w, std::int64_t batch_size,
+                        double *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    sycl::vector_class<sycl::event> deps = dependencies;
+    sycl::event done;
+    for (std::int64_t i = 0; i < batch_size; i++) {
+        done = ::oneapi::mkl::lapack::syevd(queue, jobz, uplo, n, a + i * stride_a, lda,
+                                            w + i * stride_w, scratchpad, scratchpad_size, deps);
+        deps = { done };
+    }
+    return done;
+}
 sycl::event potrs_batch(sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
                         std::int64_t *nrhs, float **a, std::int64_t *lda, float **b,
                         std::int64_t *ldb, std::int64_t group_count, std::int64_t *group_sizes,
@@ -1871,6 +2589,99 @@ std::int64_t gebrd_scratchpad_size<std::complex<double>>(sycl::queue &queue,
     return ::oneapi::mkl::lapack::gebrd_scratchpad_size<std::complex<double>>(queue, m, n, lda);
 }
 template <>
+std::int64_t gels_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::transpose trans,
+                                         std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                                         std::int64_t lda, std::int64_t ldb) {
+    if (trans != oneapi::mkl::transpose::nontrans || m < n)
+        throw unimplemented("lapack", "gels_scratchpad_size", "for trans != nontrans or m < n");
+    const std::int64_t factor_size =
+        ::oneapi::mkl::lapack::geqrf_scratchpad_size<float>(queue, m, n, lda);
+    const std::int64_t apply_size = ::oneapi::mkl::lapack::ormqr_scratchpad_size<float>(
+        queue, oneapi::mkl::side::left, oneapi::mkl::transpose::trans, m, nrhs, n, lda, ldb);
+    const std::int64_t solve_size = ::oneapi::mkl::lapack::trtrs_scratchpad_size<float>(
+        queue, oneapi::mkl::uplo::upper, oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::diag::nonunit, n, nrhs, lda, ldb);
+    // The USM variant keeps tau in front of the work area.
+    return n + std::max({ factor_size, apply_size, solve_size });
+}
+template <>
+std::int64_t gels_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::transpose trans,
+                                          std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                                          std::int64_t lda, std::int64_t ldb) {
+    if (trans != oneapi::mkl::transpose::nontrans || m < n)
+        throw unimplemented("lapack", "gels_scratchpad_size", "for trans != nontrans or m < n");
+    const std::int64_t factor_size =
+        ::oneapi::mkl::lapack::geqrf_scratchpad_size<double>(queue, m, n, lda);
+    const std::int64_t apply_size = ::oneapi::mkl::lapack::ormqr_scratchpad_size<double>(
+        queue, oneapi::mkl::side::left, oneapi::mkl::transpose::trans, m, nrhs, n, lda, ldb);
+    const std::int64_t solve_size = ::oneapi::mkl::lapack::trtrs_scratchpad_size<double>(
+        queue, oneapi::mkl::uplo::upper, oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::diag::nonunit, n, nrhs, lda, ldb);
+    // The USM variant keeps tau in front of the work area.
+    return n + std::max({ factor_size, apply_size, solve_size });
+}
+template <>
+std::int64_t gels_scratchpad_size<std::complex<float>>(sycl::queue &queue,
+                                                       oneapi::mkl::transpose trans, std::int64_t m,
+                                                       std::int64_t n, std::int64_t nrhs,
+                                                       std::int64_t lda, std::int64_t ldb) {
+    if (trans != oneapi::mkl::transpose::nontrans || m < n)
+        throw unimplemented("lapack", "gels_scratchpad_size", "for trans != nontrans or m < n");
+    const std::int64_t factor_size =
+        ::oneapi::mkl::lapack::geqrf_scratchpad_size<std::complex<float>>(queue, m, n, lda);
+    const std::int64_t apply_size =
+        ::oneapi::mkl::lapack::unmqr_scratchpad_size<std::complex<float>>(
+            queue, oneapi::mkl::side::left, oneapi::mkl::transpose::conjtrans, m, nrhs, n, lda,
+            ldb);
+    const std::int64_t solve_size =
+        ::oneapi::mkl::lapack::trtrs_scratchpad_size<std::complex<float>>(
+            queue, oneapi::mkl::uplo::upper, oneapi::mkl::transpose::nontrans,
+            oneapi::mkl::diag::nonunit, n, nrhs, lda, ldb);
+    // The USM variant keeps tau in front of the work area.
+    return n + std::max({ factor_size, apply_size, solve_size });
+}
+template <>
+std::int64_t gels_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t ldb) {
+    if (trans != oneapi::mkl::transpose::nontrans || m < n)
+        throw unimplemented("lapack", "gels_scratchpad_size", "for trans != nontrans or m < n");
+    const std::int64_t factor_size =
+        ::oneapi::mkl::lapack::geqrf_scratchpad_size<std::complex<double>>(queue, m, n, lda);
+    const std::int64_t apply_size =
+        ::oneapi::mkl::lapack::unmqr_scratchpad_size<std::complex<double>>(
+            queue, oneapi::mkl::side::left, oneapi::mkl::transpose::conjtrans, m, nrhs, n, lda,
+            ldb);
+    const std::int64_t solve_size =
+        ::oneapi::mkl::lapack::trtrs_scratchpad_size<std::complex<double>>(
+            queue, oneapi::mkl::uplo::upper, oneapi::mkl::transpose::nontrans,
+            oneapi::mkl::diag::nonunit, n, nrhs, lda, ldb);
+    // The USM variant keeps tau in front of the work area.
+    return n + std::max({ factor_size, apply_size, solve_size });
+}
+template <>
+std::int64_t gelsd_scratchpad_size<float>(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                          std::int64_t nrhs, std::int64_t lda, std::int64_t ldb) {
+    throw unimplemented("lapack", "gelsd_scratchpad_size");
+}
+template <>
+std::int64_t gelsd_scratchpad_size<double>(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                           std::int64_t nrhs, std::int64_t lda, std::int64_t ldb) {
+    throw unimplemented("lapack", "gelsd_scratchpad_size");
+}
+template <>
+std::int64_t gelsd_scratchpad_size<std::complex<float>>(sycl::queue &queue, std::int64_t m,
+                                                        std::int64_t n, std::int64_t nrhs,
+                                                        std::int64_t lda, std::int64_t ldb) {
+    throw unimplemented("lapack", "gelsd_scratchpad_size");
+}
+template <>
+std::int64_t gelsd_scratchpad_size<std::complex<double>>(sycl::queue &queue, std::int64_t m,
+                                                         std::int64_t n, std::int64_t nrhs,
+                                                         std::int64_t lda, std::int64_t ldb) {
+    throw unimplemented("lapack", "gelsd_scratchpad_size");
+}
+template <>
 std::int64_t gerqf_scratchpad_size<float>(sycl::queue &queue, std::int64_t m,
                                                         std::int64_t n, std::int64_t lda) {
     return ::oneapi::mkl::lapack::gerqf_scratchpad_size<float>(queue, m, n, lda);
@@ -2025,6 +2836,46 @@ std::int64_t getrs_scratchpad_size<std::complex<double>>(
                                                                               lda, ldb);
 }
 template <>
+std::int64_t gesv_scratchpad_size<float>(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                                         std::int64_t lda, std::int64_t ldb) {
+    const std::int64_t factor_size = ::oneapi::mkl::lapack::getrf_scratchpad_size<float>(queue, n,
+                                                                                         n, lda);
+    const std::int64_t solve_size = ::oneapi::mkl::lapack::getrs_scratchpad_size<float>(
+        queue, oneapi::mkl::transpose::nontrans, n, nrhs, lda, ldb);
+    return std::max(factor_size, solve_size);
+}
+template <>
+std::int64_t gesv_scratchpad_size<double>(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                                          std::int64_t lda, std::int64_t ldb) {
+    const std::int64_t factor_size = ::oneapi::mkl::lapack::getrf_scratchpad_size<double>(queue, n,
+                                                                                          n, lda);
+    const std::int64_t solve_size = ::oneapi::mkl::lapack::getrs_scratchpad_size<double>(
+        queue, oneapi::mkl::transpose::nontrans, n, nrhs, lda, ldb);
+    return std::max(factor_size, solve_size);
+}
+template <>
+std::int64_t gesv_scratchpad_size<std::complex<float>>(sycl::queue &queue, std::int64_t n,
+                                                       std::int64_t nrhs, std::int64_t lda,
+                                                       std::int64_t ldb) {
+    const std::int64_t factor_size =
+        ::oneapi::mkl::lapack::getrf_scratchpad_size<std::complex<float>>(queue, n, n, lda);
+    const std::int64_t solve_size =
+        ::oneapi::mkl::lapack::getrs_scratchpad_size<std::complex<float>>(
+            queue, oneapi::mkl::transpose::nontrans, n, nrhs, lda, ldb);
+    return std::max(factor_size, solve_size);
+}
+template <>
+std::int64_t gesv_scratchpad_size<std::complex<double>>(sycl::queue &queue, std::int64_t n,
+                                                        std::int64_t nrhs, std::int64_t lda,
+                                                        std::int64_t ldb) {
+    const std::int64_t factor_size =
+        ::oneapi::mkl::lapack::getrf_scratchpad_size<std::complex<double>>(queue, n, n, lda);
+    const std::int64_t solve_size =
+        ::oneapi::mkl::lapack::getrs_scratchpad_size<std::complex<double>>(
+            queue, oneapi::mkl::transpose::nontrans, n, nrhs, lda, ldb);
+    return std::max(factor_size, solve_size);
+}
+template <>
 std::int64_t heevd_scratchpad_size<std::complex<float>>(sycl::queue &queue,
                                                                       oneapi::mkl::job jobz,
                                                                       oneapi::mkl::uplo uplo,
@@ -2225,6 +3076,47 @@ std::int64_t potrs_scratchpad_size<std::complex<double>>(
                                                                               lda, ldb);
 }
 template <>
+std::int64_t posv_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                         std::int64_t nrhs, std::int64_t lda, std::int64_t ldb) {
+    const std::int64_t factor_size =
+        ::oneapi::mkl::lapack::potrf_scratchpad_size<float>(queue, uplo, n, lda);
+    const std::int64_t solve_size =
+        ::oneapi::mkl::lapack::potrs_scratchpad_size<float>(queue, uplo, n, nrhs, lda, ldb);
+    return std::max(factor_size, solve_size);
+}
+template <>
+std::int64_t posv_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                          std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                          std::int64_t ldb) {
+    const std::int64_t factor_size =
+        ::oneapi::mkl::lapack::potrf_scratchpad_size<double>(queue, uplo, n, lda);
+    const std::int64_t solve_size = ::oneapi::mkl::lapack::potrs_scratchpad_size<double>(
+        queue, uplo, n, nrhs, lda, ldb);
+    return std::max(factor_size, solve_size);
+}
+template <>
+std::int64_t posv_scratchpad_size<std::complex<float>>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                       std::int64_t n, std::int64_t nrhs,
+                                                       std::int64_t lda, std::int64_t ldb) {
+    const std::int64_t factor_size =
+        ::oneapi::mkl::lapack::potrf_scratchpad_size<std::complex<float>>(queue, uplo, n, lda);
+    const std::int64_t solve_size =
+        ::oneapi::mkl::lapack::potrs_scratchpad_size<std::complex<float>>(queue, uplo, n, nrhs, lda,
+                                                                          ldb);
+    return std::max(factor_size, solve_size);
+}
+template <>
+std::int64_t posv_scratchpad_size<std::complex<double>>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                        std::int64_t n, std::int64_t nrhs,
+                                                        std::int64_t lda, std::int64_t ldb) {
+    const std::int64_t factor_size =
+        ::oneapi::mkl::lapack::potrf_scratchpad_size<std::complex<double>>(queue, uplo, n, lda);
+    const std::int64_t solve_size =
+        ::oneapi::mkl::lapack::potrs_scratchpad_size<std::complex<double>>(queue, uplo, n, nrhs,
+                                                                           lda, ldb);
+    return std::max(factor_size, solve_size);
+}
+template <>
 std::int64_t potri_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::uplo uplo,
                                                         std::int64_t n, std::int64_t lda) {
     return ::oneapi::mkl::lapack::potri_scratchpad_size<float>(queue, uplo, n, lda);
@@ -2273,6 +3165,29 @@ std::int64_t sytrf_scratchpad_size<std::complex<double>>(sycl::queue &queue,
     return ::oneapi::mkl::lapack::sytrf_scratchpad_size<std::complex<double>>(queue, uplo, n, lda);
 }
 template <>
+std::int64_t sysv_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                         std::int64_t nrhs, std::int64_t lda, std::int64_t ldb) {
+    throw unimplemented("lapack", "sysv_scratchpad_size");
+}
+template <>
+std::int64_t sysv_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                          std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                          std::int64_t ldb) {
+    throw unimplemented("lapack", "sysv_scratchpad_size");
+}
+template <>
+std::int64_t sysv_scratchpad_size<std::complex<float>>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                       std::int64_t n, std::int64_t nrhs,
+                                                       std::int64_t lda, std::int64_t ldb) {
+    throw unimplemented("lapack", "sysv_scratchpad_size");
+}
+template <>
+std::int64_t sysv_scratchpad_size<std::complex<double>>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                        std::int64_t n, std::int64_t nrhs,
+                                                        std::int64_t lda, std::int64_t ldb) {
+    throw unimplemented("lapack", "sysv_scratchpad_size");
+}
+template <>
 std::int64_t syevd_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::job jobz,
                                                         oneapi::mkl::uplo uplo, std::int64_t n,
                                                         std::int64_t lda) {
@@ -2521,6 +3436,100 @@ std::int64_t getrs_batch_scratchpad_size<std::complex<double>>(
         queue, trans, n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, batch_size);
 }
 template <>
+std::int64_t gesv_batch_scratchpad_size<float>(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a,
+    std::int64_t stride_ipiv, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+    const std::int64_t factor_size = ::oneapi::mkl::lapack::getrf_batch_scratchpad_size<float>(
+        queue, n, n, lda, stride_a, stride_ipiv, batch_size);
+    const std::int64_t solve_size =
+        ::oneapi::mkl::lapack::getrs_batch_scratchpad_size<float>(
+            queue, oneapi::mkl::transpose::nontrans, n, nrhs, lda, stride_a, stride_ipiv, ldb,
+            stride_b, batch_size);
+    return std::max(factor_size, solve_size);
+}
+template <>
+std::int64_t gesv_batch_scratchpad_size<double>(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a,
+    std::int64_t stride_ipiv, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+    const std::int64_t factor_size = ::oneapi::mkl::lapack::getrf_batch_scratchpad_size<double>(
+        queue, n, n, lda, stride_a, stride_ipiv, batch_size);
+    const std::int64_t solve_size =
+        ::oneapi::mkl::lapack::getrs_batch_scratchpad_size<double>(
+            queue, oneapi::mkl::transpose::nontrans, n, nrhs, lda, stride_a, stride_ipiv, ldb,
+            stride_b, batch_size);
+    return std::max(factor_size, solve_size);
+}
+template <>
+std::int64_t gesv_batch_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a,
+    std::int64_t stride_ipiv, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+    const std::int64_t factor_size =
+        ::oneapi::mkl::lapack::getrf_batch_scratchpad_size<std::complex<float>>(
+            queue, n, n, lda, stride_a, stride_ipiv, batch_size);
+    const std::int64_t solve_size =
+        ::oneapi::mkl::lapack::getrs_batch_scratchpad_size<std::complex<float>>(
+            queue, oneapi::mkl::transpose::nontrans, n, nrhs, lda, stride_a, stride_ipiv, ldb,
+            stride_b, batch_size);
+    return std::max(factor_size, solve_size);
+}
+template <>
+std::int64_t gesv_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a,
+    std::int64_t stride_ipiv, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+    const std::int64_t factor_size =
+        ::oneapi::mkl::lapack::getrf_batch_scratchpad_size<std::complex<double>>(
+            queue, n, n, lda, stride_a, stride_ipiv, batch_size);
+    const std::int64_t solve_size =
+        ::oneapi::mkl::lapack::getrs_batch_scratchpad_size<std::complex<double>>(
+            queue, oneapi::mkl::transpose::nontrans, n, nrhs, lda, stride_a, stride_ipiv, ldb,
+            stride_b, batch_size);
+    return std::max(factor_size, solve_size);
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::transpose trans,
+                                               std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                                               std::int64_t lda, std::int64_t stride_a,
+                                               std::int64_t ldb, std::int64_t stride_b,
+                                               std::int64_t batch_size) {
+    throw unimplemented("lapack", "gels_batch_scratchpad_size");
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::transpose trans,
+                                                std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                                                std::int64_t lda, std::int64_t stride_a,
+                                                std::int64_t ldb, std::int64_t stride_b,
+                                                std::int64_t batch_size) {
+    throw unimplemented("lapack", "gels_batch_scratchpad_size");
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size) {
+    throw unimplemented("lapack", "gels_batch_scratchpad_size");
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size) {
+    throw unimplemented("lapack", "gels_batch_scratchpad_size");
+}
+template <>
+std::int64_t heevd_batch_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w, std::int64_t batch_size) {
+    return ::oneapi::mkl::lapack::heevd_scratchpad_size<std::complex<float>>(queue, jobz, uplo, n,
+                                                                             lda);
+}
+template <>
+std::int64_t heevd_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w, std::int64_t batch_size) {
+    return ::oneapi::mkl::lapack::heevd_scratchpad_size<std::complex<double>>(queue, jobz, uplo, n,
+                                                                              lda);
+}
+template <>
 std::int64_t geqrf_batch_scratchpad_size<float>(sycl::queue &queue, std::int64_t m,
                                                               std::int64_t n, std::int64_t lda,
                                                               std::int64_t stride_a,
@@ -2613,6 +3622,66 @@ std::int64_t potrs_batch_scratchpad_size<std::complex<double>>(
         queue, uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
 }
 template <>
+std::int64_t posv_batch_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                               std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                               std::int64_t stride_a, std::int64_t ldb,
+                                               std::int64_t stride_b, std::int64_t batch_size) {
+    const std::int64_t factor_size = ::oneapi::mkl::lapack::potrf_batch_scratchpad_size<float>(
+        queue, uplo, n, lda, stride_a, batch_size);
+    const std::int64_t solve_size = ::oneapi::mkl::lapack::potrs_batch_scratchpad_size<float>(
+        queue, uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    return std::max(factor_size, solve_size);
+}
+template <>
+std::int64_t posv_batch_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                                std::int64_t stride_a, std::int64_t ldb,
+                                                std::int64_t stride_b, std::int64_t batch_size) {
+    const std::int64_t factor_size = ::oneapi::mkl::lapack::potrf_batch_scratchpad_size<double>(
+        queue, uplo, n, lda, stride_a, batch_size);
+    const std::int64_t solve_size = ::oneapi::mkl::lapack::potrs_batch_scratchpad_size<double>(
+        queue, uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    return std::max(factor_size, solve_size);
+}
+template <>
+std::int64_t posv_batch_scratchpad_size<std::complex<float>>(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+    const std::int64_t factor_size =
+        ::oneapi::mkl::lapack::potrf_batch_scratchpad_size<std::complex<float>>(
+            queue, uplo, n, lda, stride_a, batch_size);
+    const std::int64_t solve_size =
+        ::oneapi::mkl::lapack::potrs_batch_scratchpad_size<std::complex<float>>(
+            queue, uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    return std::max(factor_size, solve_size);
+}
+template <>
+std::int64_t posv_batch_scratchpad_size<std::complex<double>>(
+    sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+    std::int64_t stride_a, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+    const std::int64_t factor_size =
+        ::oneapi::mkl::lapack::potrf_batch_scratchpad_size<std::complex<double>>(
+            queue, uplo, n, lda, stride_a, batch_size);
+    const std::int64_t solve_size =
+        ::oneapi::mkl::lapack::potrs_batch_scratchpad_size<std::complex<double>>(
+            queue, uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    return std::max(factor_size, solve_size);
+}
+template <>
+std::int64_t syevd_batch_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                oneapi::mkl::uplo uplo, std::int64_t n,
+                                                std::int64_t lda, std::int64_t stride_a,
+                                                std::int64_t stride_w, std::int64_t batch_size) {
+    return ::oneapi::mkl::lapack::syevd_scratchpad_size<float>(queue, jobz, uplo, n, lda);
+}
+template <>
+std::int64_t syevd_batch_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                 oneapi::mkl::uplo uplo, std::int64_t n,
+                                                 std::int64_t lda, std::int64_t stride_a,
+                                                 std::int64_t stride_w, std::int64_t batch_size) {
+    return ::oneapi::mkl::lapack::syevd_scratchpad_size<double>(queue, jobz, uplo, n, lda);
+}
+template <>
 std::int64_t orgqr_batch_scratchpad_size<float>(
     sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k, std::int64_t lda,
     std::int64_t stride_a, std::int64_t stride_tau, std::int64_t batch_size) {
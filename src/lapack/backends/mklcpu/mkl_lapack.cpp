@@ -17,8 +17,11 @@
 * SPDX-License-Identifier: Apache-2.0
 *******************************************************************************/
 
+#include <algorithm>
+
 #include <CL/sycl.hpp>
 
+#include "oneapi/mkl/exceptions.hpp"
 #include "oneapi/mkl/types.hpp"
 #include "oneapi/mkl/lapack/types.hpp"
 #include "oneapi/mkl/lapack/detail/mklcpu/onemkl_lapack_mklcpu.hpp"
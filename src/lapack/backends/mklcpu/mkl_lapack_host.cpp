@@ -0,0 +1,559 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Routines that the MKL DPC++ API does not provide. They run as host tasks on
+// top of the MKL C LAPACK interface, which only the CPU backend can do: USM
+// allocations made for a CPU queue are accessible from the host.
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#define MKL_Complex8  std::complex<float>
+#define MKL_Complex16 std::complex<double>
+
+#include "mkl_lapacke.h"
+
+#include "oneapi/mkl/types.hpp"
+#include "oneapi/mkl/lapack/types.hpp"
+#include "oneapi/mkl/lapack/exceptions.hpp"
+#include "oneapi/mkl/lapack/detail/mklcpu/onemkl_lapack_mklcpu.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace lapack {
+namespace mklcpu {
+
+// host_task automatically uses run_on_host_intel if it is supported by the
+//  compiler. Otherwise, it falls back to single_task.
+template <typename K, typename H, typename F>
+static inline auto host_task_internal(H &cgh, F f, int) -> decltype(cgh.run_on_host_intel(f)) {
+    return cgh.run_on_host_intel(f);
+}
+
+template <typename K, typename H, typename F>
+static inline void host_task_internal(H &cgh, F f, long) {
+#ifndef SYCL_DEVICE_ONLY
+    cgh.template single_task<K>(f);
+#endif
+}
+
+template <typename K, typename H, typename F>
+static inline void host_task(H &cgh, F f) {
+    (void)host_task_internal<K>(cgh, f, 0);
+}
+
+inline char convert_to_lapack_uplo(uplo is_upper) {
+    return is_upper == uplo::upper ? 'U' : 'L';
+}
+
+inline char convert_to_lapack_job(job jobz) {
+    return jobz == job::vec ? 'V' : 'N';
+}
+
+inline char convert_to_lapack_rangev(rangev range) {
+    switch (range) {
+        case rangev::values: return 'V';
+        case rangev::indices: return 'I';
+        default: return 'A';
+    }
+}
+
+inline void check_info(const std::string &function, lapack_int info) {
+    if (info == LAPACK_WORK_MEMORY_ERROR || info == LAPACK_TRANSPOSE_MEMORY_ERROR)
+        throw computation_error(function, "failed to allocate workspace", info);
+    if (info < 0)
+        throw invalid_argument(function, "invalid argument", -info);
+    if (info > 0)
+        throw computation_error(function, "computation failed", info);
+}
+
+void heevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+           std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+           sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_m = m.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_z = z.get_access<sycl::access::mode::write>(cgh);
+        host_task<class mklcpu_cheevr>(cgh, [=]() {
+            std::vector<lapack_int> isuppz(2 * std::max<std::int64_t>(1, n));
+            lapack_int found = 0;
+            auto info = LAPACKE_cheevr(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, accessor_a.get_pointer(),
+                                       lda, vl, vu, il, iu, abstol, &found,
+                                       accessor_w.get_pointer(), accessor_z.get_pointer(), ldz,
+                                       isuppz.data());
+            accessor_m[0] = found;
+            check_info("heevr", info);
+        });
+    });
+}
+
+void heevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<double>> &a,
+           std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+           sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_m = m.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_z = z.get_access<sycl::access::mode::write>(cgh);
+        host_task<class mklcpu_zheevr>(cgh, [=]() {
+            std::vector<lapack_int> isuppz(2 * std::max<std::int64_t>(1, n));
+            lapack_int found = 0;
+            auto info = LAPACKE_zheevr(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, accessor_a.get_pointer(),
+                                       lda, vl, vu, il, iu, abstol, &found,
+                                       accessor_w.get_pointer(), accessor_z.get_pointer(), ldz,
+                                       isuppz.data());
+            accessor_m[0] = found;
+            check_info("heevr", info);
+        });
+    });
+}
+
+sycl::event heevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a, std::int64_t lda,
+                  float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+                  std::int64_t *m, float *w, std::complex<float> *z, std::int64_t ldz,
+                  std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class mklcpu_cheevr_usm>(cgh, [=]() {
+            std::vector<lapack_int> isuppz(2 * std::max<std::int64_t>(1, n));
+            lapack_int found = 0;
+            auto info = LAPACKE_cheevr(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, a, lda, vl, vu, il, iu,
+                                       abstol, &found, w, z, ldz, isuppz.data());
+            m[0] = found;
+            check_info("heevr", info);
+        });
+    });
+    return done;
+}
+
+sycl::event heevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a, std::int64_t lda,
+                  double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+                  std::int64_t *m, double *w, std::complex<double> *z, std::int64_t ldz,
+                  std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class mklcpu_zheevr_usm>(cgh, [=]() {
+            std::vector<lapack_int> isuppz(2 * std::max<std::int64_t>(1, n));
+            lapack_int found = 0;
+            auto info = LAPACKE_zheevr(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, a, lda, vl, vu, il, iu,
+                                       abstol, &found, w, z, ldz, isuppz.data());
+            m[0] = found;
+            check_info("heevr", info);
+        });
+    });
+    return done;
+}
+
+void heevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+           std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+           sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_m = m.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_z = z.get_access<sycl::access::mode::write>(cgh);
+        host_task<class mklcpu_cheevx>(cgh, [=]() {
+            std::vector<lapack_int> ifail(std::max<std::int64_t>(1, n));
+            lapack_int found = 0;
+            auto info = LAPACKE_cheevx(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, accessor_a.get_pointer(),
+                                       lda, vl, vu, il, iu, abstol, &found,
+                                       accessor_w.get_pointer(), accessor_z.get_pointer(), ldz,
+                                       ifail.data());
+            accessor_m[0] = found;
+            check_info("heevx", info);
+        });
+    });
+}
+
+void heevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<double>> &a,
+           std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+           sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_m = m.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_z = z.get_access<sycl::access::mode::write>(cgh);
+        host_task<class mklcpu_zheevx>(cgh, [=]() {
+            std::vector<lapack_int> ifail(std::max<std::int64_t>(1, n));
+            lapack_int found = 0;
+            auto info = LAPACKE_zheevx(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, accessor_a.get_pointer(),
+                                       lda, vl, vu, il, iu, abstol, &found,
+                                       accessor_w.get_pointer(), accessor_z.get_pointer(), ldz,
+                                       ifail.data());
+            accessor_m[0] = found;
+            check_info("heevx", info);
+        });
+    });
+}
+
+sycl::event heevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a, std::int64_t lda,
+                  float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+                  std::int64_t *m, float *w, std::complex<float> *z, std::int64_t ldz,
+                  std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class mklcpu_cheevx_usm>(cgh, [=]() {
+            std::vector<lapack_int> ifail(std::max<std::int64_t>(1, n));
+            lapack_int found = 0;
+            auto info = LAPACKE_cheevx(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, a, lda, vl, vu, il, iu,
+                                       abstol, &found, w, z, ldz, ifail.data());
+            m[0] = found;
+            check_info("heevx", info);
+        });
+    });
+    return done;
+}
+
+sycl::event heevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a, std::int64_t lda,
+                  double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+                  std::int64_t *m, double *w, std::complex<double> *z, std::int64_t ldz,
+                  std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class mklcpu_zheevx_usm>(cgh, [=]() {
+            std::vector<lapack_int> ifail(std::max<std::int64_t>(1, n));
+            lapack_int found = 0;
+            auto info = LAPACKE_zheevx(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, a, lda, vl, vu, il, iu,
+                                       abstol, &found, w, z, ldz, ifail.data());
+            m[0] = found;
+            check_info("heevx", info);
+        });
+    });
+    return done;
+}
+
+void syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+           float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w, sycl::buffer<float> &z,
+           std::int64_t ldz, sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_m = m.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_z = z.get_access<sycl::access::mode::write>(cgh);
+        host_task<class mklcpu_ssyevr>(cgh, [=]() {
+            std::vector<lapack_int> isuppz(2 * std::max<std::int64_t>(1, n));
+            lapack_int found = 0;
+            auto info = LAPACKE_ssyevr(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, accessor_a.get_pointer(),
+                                       lda, vl, vu, il, iu, abstol, &found,
+                                       accessor_w.get_pointer(), accessor_z.get_pointer(), ldz,
+                                       isuppz.data());
+            accessor_m[0] = found;
+            check_info("syevr", info);
+        });
+    });
+}
+
+void syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+           double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w, sycl::buffer<double> &z,
+           std::int64_t ldz, sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_m = m.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_z = z.get_access<sycl::access::mode::write>(cgh);
+        host_task<class mklcpu_dsyevr>(cgh, [=]() {
+            std::vector<lapack_int> isuppz(2 * std::max<std::int64_t>(1, n));
+            lapack_int found = 0;
+            auto info = LAPACKE_dsyevr(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, accessor_a.get_pointer(),
+                                       lda, vl, vu, il, iu, abstol, &found,
+                                       accessor_w.get_pointer(), accessor_z.get_pointer(), ldz,
+                                       isuppz.data());
+            accessor_m[0] = found;
+            check_info("syevr", info);
+        });
+    });
+}
+
+sycl::event syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda, float vl,
+                  float vu, std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m,
+                  float *w, float *z, std::int64_t ldz, float *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class mklcpu_ssyevr_usm>(cgh, [=]() {
+            std::vector<lapack_int> isuppz(2 * std::max<std::int64_t>(1, n));
+            lapack_int found = 0;
+            auto info = LAPACKE_ssyevr(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, a, lda, vl, vu, il, iu,
+                                       abstol, &found, w, z, ldz, isuppz.data());
+            m[0] = found;
+            check_info("syevr", info);
+        });
+    });
+    return done;
+}
+
+sycl::event syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda, double vl,
+                  double vu, std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+                  double *w, double *z, std::int64_t ldz, double *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class mklcpu_dsyevr_usm>(cgh, [=]() {
+            std::vector<lapack_int> isuppz(2 * std::max<std::int64_t>(1, n));
+            lapack_int found = 0;
+            auto info = LAPACKE_dsyevr(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, a, lda, vl, vu, il, iu,
+                                       abstol, &found, w, z, ldz, isuppz.data());
+            m[0] = found;
+            check_info("syevr", info);
+        });
+    });
+    return done;
+}
+
+void syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+           float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w, sycl::buffer<float> &z,
+           std::int64_t ldz, sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_m = m.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_z = z.get_access<sycl::access::mode::write>(cgh);
+        host_task<class mklcpu_ssyevx>(cgh, [=]() {
+            std::vector<lapack_int> ifail(std::max<std::int64_t>(1, n));
+            lapack_int found = 0;
+            auto info = LAPACKE_ssyevx(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, accessor_a.get_pointer(),
+                                       lda, vl, vu, il, iu, abstol, &found,
+                                       accessor_w.get_pointer(), accessor_z.get_pointer(), ldz,
+                                       ifail.data());
+            accessor_m[0] = found;
+            check_info("syevx", info);
+        });
+    });
+}
+
+void syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+           double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w, sycl::buffer<double> &z,
+           std::int64_t ldz, sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_m = m.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_z = z.get_access<sycl::access::mode::write>(cgh);
+        host_task<class mklcpu_dsyevx>(cgh, [=]() {
+            std::vector<lapack_int> ifail(std::max<std::int64_t>(1, n));
+            lapack_int found = 0;
+            auto info = LAPACKE_dsyevx(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, accessor_a.get_pointer(),
+                                       lda, vl, vu, il, iu, abstol, &found,
+                                       accessor_w.get_pointer(), accessor_z.get_pointer(), ldz,
+                                       ifail.data());
+            accessor_m[0] = found;
+            check_info("syevx", info);
+        });
+    });
+}
+
+sycl::event syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda, float vl,
+                  float vu, std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m,
+                  float *w, float *z, std::int64_t ldz, float *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class mklcpu_ssyevx_usm>(cgh, [=]() {
+            std::vector<lapack_int> ifail(std::max<std::int64_t>(1, n));
+            lapack_int found = 0;
+            auto info = LAPACKE_ssyevx(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, a, lda, vl, vu, il, iu,
+                                       abstol, &found, w, z, ldz, ifail.data());
+            m[0] = found;
+            check_info("syevx", info);
+        });
+    });
+    return done;
+}
+
+sycl::event syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda, double vl,
+                  double vu, std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+                  double *w, double *z, std::int64_t ldz, double *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class mklcpu_dsyevx_usm>(cgh, [=]() {
+            std::vector<lapack_int> ifail(std::max<std::int64_t>(1, n));
+            lapack_int found = 0;
+            auto info = LAPACKE_dsyevx(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, a, lda, vl, vu, il, iu,
+                                       abstol, &found, w, z, ldz, ifail.data());
+            m[0] = found;
+            check_info("syevx", info);
+        });
+    });
+    return done;
+}
+
+// The C interface allocates its own workspace, so no scratchpad is needed.
+template <>
+std::int64_t heevr_scratchpad_size<std::complex<float>>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                        oneapi::mkl::rangev range,
+                                                        oneapi::mkl::uplo uplo, std::int64_t n,
+                                                        std::int64_t lda, std::int64_t ldz) {
+    return 1;
+}
+
+template <>
+std::int64_t heevr_scratchpad_size<std::complex<double>>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                         oneapi::mkl::rangev range,
+                                                         oneapi::mkl::uplo uplo, std::int64_t n,
+                                                         std::int64_t lda, std::int64_t ldz) {
+    return 1;
+}
+
+template <>
+std::int64_t heevx_scratchpad_size<std::complex<float>>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                        oneapi::mkl::rangev range,
+                                                        oneapi::mkl::uplo uplo, std::int64_t n,
+                                                        std::int64_t lda, std::int64_t ldz) {
+    return 1;
+}
+
+template <>
+std::int64_t heevx_scratchpad_size<std::complex<double>>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                         oneapi::mkl::rangev range,
+                                                         oneapi::mkl::uplo uplo, std::int64_t n,
+                                                         std::int64_t lda, std::int64_t ldz) {
+    return 1;
+}
+
+template <>
+std::int64_t syevr_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                          oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                          std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    return 1;
+}
+
+template <>
+std::int64_t syevr_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                           std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    return 1;
+}
+
+template <>
+std::int64_t syevx_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                          oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                          std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    return 1;
+}
+
+template <>
+std::int64_t syevx_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                           std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    return 1;
+}
+
+} // namespace mklcpu
+} // namespace lapack
+} // namespace mkl
+} // namespace oneapi
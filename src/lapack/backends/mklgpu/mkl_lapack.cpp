@@ -17,8 +17,11 @@
 * SPDX-License-Identifier: Apache-2.0
 *******************************************************************************/
 
+#include <algorithm>
+
 #include <CL/sycl.hpp>
 
+#include "oneapi/mkl/exceptions.hpp"
 #include "oneapi/mkl/types.hpp"
 #include "oneapi/mkl/lapack/types.hpp"
 #include "oneapi/mkl/lapack/detail/mklgpu/onemkl_lapack_mklgpu.hpp"
@@ -31,6 +34,208 @@ namespace mklgpu {
 
 #include "../mkl_common/mkl_lapack.cxx"
 
+// The partial eigensolvers are implemented on the MKL C interface, which cannot
+// operate on device memory.
+void heevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+           std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+           sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "heevr");
+}
+
+void heevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<double>> &a,
+           std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+           sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "heevr");
+}
+
+sycl::event heevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a, std::int64_t lda,
+                  float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+                  std::int64_t *m, float *w, std::complex<float> *z, std::int64_t ldz,
+                  std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevr");
+}
+
+sycl::event heevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a, std::int64_t lda,
+                  double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+                  std::int64_t *m, double *w, std::complex<double> *z, std::int64_t ldz,
+                  std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevr");
+}
+
+void heevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+           std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+           sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "heevx");
+}
+
+void heevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<double>> &a,
+           std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+           sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "heevx");
+}
+
+sycl::event heevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a, std::int64_t lda,
+                  float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+                  std::int64_t *m, float *w, std::complex<float> *z, std::int64_t ldz,
+                  std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevx");
+}
+
+sycl::event heevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a, std::int64_t lda,
+                  double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+                  std::int64_t *m, double *w, std::complex<double> *z, std::int64_t ldz,
+                  std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "heevx");
+}
+
+void syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+           float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w, sycl::buffer<float> &z,
+           std::int64_t ldz, sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "syevr");
+}
+
+void syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+           double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w, sycl::buffer<double> &z,
+           std::int64_t ldz, sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "syevr");
+}
+
+sycl::event syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda, float vl,
+                  float vu, std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m,
+                  float *w, float *z, std::int64_t ldz, float *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevr");
+}
+
+sycl::event syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda, double vl,
+                  double vu, std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+                  double *w, double *z, std::int64_t ldz, double *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevr");
+}
+
+void syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+           float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w, sycl::buffer<float> &z,
+           std::int64_t ldz, sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "syevx");
+}
+
+void syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+           double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w, sycl::buffer<double> &z,
+           std::int64_t ldz, sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    throw unimplemented("lapack", "syevx");
+}
+
+sycl::event syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda, float vl,
+                  float vu, std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m,
+                  float *w, float *z, std::int64_t ldz, float *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevx");
+}
+
+sycl::event syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda, double vl,
+                  double vu, std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+                  double *w, double *z, std::int64_t ldz, double *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    throw unimplemented("lapack", "syevx");
+}
+
+template <>
+std::int64_t heevr_scratchpad_size<std::complex<float>>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                        oneapi::mkl::rangev range,
+                                                        oneapi::mkl::uplo uplo, std::int64_t n,
+                                                        std::int64_t lda, std::int64_t ldz) {
+    throw unimplemented("lapack", "heevr_scratchpad_size");
+}
+
+template <>
+std::int64_t heevr_scratchpad_size<std::complex<double>>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                         oneapi::mkl::rangev range,
+                                                         oneapi::mkl::uplo uplo, std::int64_t n,
+                                                         std::int64_t lda, std::int64_t ldz) {
+    throw unimplemented("lapack", "heevr_scratchpad_size");
+}
+
+template <>
+std::int64_t heevx_scratchpad_size<std::complex<float>>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                        oneapi::mkl::rangev range,
+                                                        oneapi::mkl::uplo uplo, std::int64_t n,
+                                                        std::int64_t lda, std::int64_t ldz) {
+    throw unimplemented("lapack", "heevx_scratchpad_size");
+}
+
+template <>
+std::int64_t heevx_scratchpad_size<std::complex<double>>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                         oneapi::mkl::rangev range,
+                                                         oneapi::mkl::uplo uplo, std::int64_t n,
+                                                         std::int64_t lda, std::int64_t ldz) {
+    throw unimplemented("lapack", "heevx_scratchpad_size");
+}
+
+template <>
+std::int64_t syevr_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                          oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                          std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    throw unimplemented("lapack", "syevr_scratchpad_size");
+}
+
+template <>
+std::int64_t syevr_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                           std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    throw unimplemented("lapack", "syevr_scratchpad_size");
+}
+
+template <>
+std::int64_t syevx_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                          oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                          std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    throw unimplemented("lapack", "syevx_scratchpad_size");
+}
+
+template <>
+std::int64_t syevx_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                           std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    throw unimplemented("lapack", "syevx_scratchpad_size");
+}
+
 } // namespace mklgpu
 } // namespace lapack
 } // namespace mkl
@@ -0,0 +1,2453 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <CL/sycl.hpp>
+
+#include "netlib_common.hpp"
+#include "netlib_small_batch.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace lapack {
+namespace netlib {
+
+void geqrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<float> &a,
+                 std::int64_t lda, std::int64_t stride_a, sycl::buffer<float> &tau,
+                 std::int64_t stride_tau, std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_sgeqrf_batch>(cgh, [=]() {
+            if (small_batch::geqrf_batch("geqrf_batch", m, n, accessor_a.get_pointer().get(), lda,
+                                         stride_a, accessor_tau.get_pointer().get(), stride_tau,
+                                         batch_size))
+                return;
+            run_batch("geqrf_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_sgeqrf(LAPACK_COL_MAJOR, m, n,
+                                      accessor_a.get_pointer() + i * stride_a, lda,
+                                      accessor_tau.get_pointer() + i * stride_tau);
+            });
+        });
+    });
+}
+
+void geqrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<double> &a,
+                 std::int64_t lda, std::int64_t stride_a, sycl::buffer<double> &tau,
+                 std::int64_t stride_tau, std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_dgeqrf_batch>(cgh, [=]() {
+            if (small_batch::geqrf_batch("geqrf_batch", m, n, accessor_a.get_pointer().get(), lda,
+                                         stride_a, accessor_tau.get_pointer().get(), stride_tau,
+                                         batch_size))
+                return;
+            run_batch("geqrf_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_dgeqrf(LAPACK_COL_MAJOR, m, n,
+                                      accessor_a.get_pointer() + i * stride_a, lda,
+                                      accessor_tau.get_pointer() + i * stride_tau);
+            });
+        });
+    });
+}
+
+void geqrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                 sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<std::complex<float>> &tau, std::int64_t stride_tau,
+                 std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_cgeqrf_batch>(cgh, [=]() {
+            if (small_batch::geqrf_batch("geqrf_batch", m, n, accessor_a.get_pointer().get(), lda,
+                                         stride_a, accessor_tau.get_pointer().get(), stride_tau,
+                                         batch_size))
+                return;
+            run_batch("geqrf_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_cgeqrf(LAPACK_COL_MAJOR, m, n,
+                                      accessor_a.get_pointer() + i * stride_a, lda,
+                                      accessor_tau.get_pointer() + i * stride_tau);
+            });
+        });
+    });
+}
+
+void geqrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                 sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<std::complex<double>> &tau, std::int64_t stride_tau,
+                 std::int64_t batch_size, sycl::buffer<std::complex<double>> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_zgeqrf_batch>(cgh, [=]() {
+            if (small_batch::geqrf_batch("geqrf_batch", m, n, accessor_a.get_pointer().get(), lda,
+                                         stride_a, accessor_tau.get_pointer().get(), stride_tau,
+                                         batch_size))
+                return;
+            run_batch("geqrf_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_zgeqrf(LAPACK_COL_MAJOR, m, n,
+                                      accessor_a.get_pointer() + i * stride_a, lda,
+                                      accessor_tau.get_pointer() + i * stride_tau);
+            });
+        });
+    });
+}
+
+void getri_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+                 std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                 std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_sgetri_batch>(cgh, [=]() {
+            run_batch("getri_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_sgetri(LAPACK_COL_MAJOR, n, accessor_a.get_pointer() + i * stride_a,
+                                      lda, accessor_ipiv.get_pointer() + i * stride_ipiv);
+            });
+        });
+    });
+}
+
+void getri_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+                 std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                 std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_dgetri_batch>(cgh, [=]() {
+            run_batch("getri_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_dgetri(LAPACK_COL_MAJOR, n, accessor_a.get_pointer() + i * stride_a,
+                                      lda, accessor_ipiv.get_pointer() + i * stride_ipiv);
+            });
+        });
+    });
+}
+
+void getri_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+                 std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+                 std::int64_t stride_ipiv, std::int64_t batch_size,
+                 sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_cgetri_batch>(cgh, [=]() {
+            run_batch("getri_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_cgetri(LAPACK_COL_MAJOR, n, accessor_a.get_pointer() + i * stride_a,
+                                      lda, accessor_ipiv.get_pointer() + i * stride_ipiv);
+            });
+        });
+    });
+}
+
+void getri_batch(sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<double>> &a,
+                 std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+                 std::int64_t stride_ipiv, std::int64_t batch_size,
+                 sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_zgetri_batch>(cgh, [=]() {
+            run_batch("getri_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_zgetri(LAPACK_COL_MAJOR, n, accessor_a.get_pointer() + i * stride_a,
+                                      lda, accessor_ipiv.get_pointer() + i * stride_ipiv);
+            });
+        });
+    });
+}
+
+void getrs_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                 std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv, sycl::buffer<float> &b,
+                 std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                 sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_sgetrs_batch>(cgh, [=]() {
+            run_batch("getrs_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_sgetrs(LAPACK_COL_MAJOR, convert_to_lapack_trans<float>(trans), n,
+                                      nrhs, accessor_a.get_pointer() + i * stride_a, lda,
+                                      accessor_ipiv.get_pointer() + i * stride_ipiv,
+                                      accessor_b.get_pointer() + i * stride_b, ldb);
+            });
+        });
+    });
+}
+
+void getrs_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                 std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                 std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                 sycl::buffer<double> &b, std::int64_t ldb, std::int64_t stride_b,
+                 std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dgetrs_batch>(cgh, [=]() {
+            run_batch("getrs_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_dgetrs(LAPACK_COL_MAJOR, convert_to_lapack_trans<double>(trans), n,
+                                      nrhs, accessor_a.get_pointer() + i * stride_a, lda,
+                                      accessor_ipiv.get_pointer() + i * stride_ipiv,
+                                      accessor_b.get_pointer() + i * stride_b, ldb);
+            });
+        });
+    });
+}
+
+void getrs_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                 std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                 std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                 sycl::buffer<std::complex<float>> &b, std::int64_t ldb, std::int64_t stride_b,
+                 std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cgetrs_batch>(cgh, [=]() {
+            run_batch("getrs_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_cgetrs(LAPACK_COL_MAJOR,
+                                      convert_to_lapack_trans<std::complex<float>>(trans), n, nrhs,
+                                      accessor_a.get_pointer() + i * stride_a, lda,
+                                      accessor_ipiv.get_pointer() + i * stride_ipiv,
+                                      accessor_b.get_pointer() + i * stride_b, ldb);
+            });
+        });
+    });
+}
+
+void getrs_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                 std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                 std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                 sycl::buffer<std::complex<double>> &b, std::int64_t ldb, std::int64_t stride_b,
+                 std::int64_t batch_size, sycl::buffer<std::complex<double>> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zgetrs_batch>(cgh, [=]() {
+            run_batch("getrs_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_zgetrs(LAPACK_COL_MAJOR,
+                                      convert_to_lapack_trans<std::complex<double>>(trans), n, nrhs,
+                                      accessor_a.get_pointer() + i * stride_a, lda,
+                                      accessor_ipiv.get_pointer() + i * stride_ipiv,
+                                      accessor_b.get_pointer() + i * stride_b, ldb);
+            });
+        });
+    });
+}
+
+void gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a,
+                std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+                std::int64_t stride_ipiv, sycl::buffer<float> &b, std::int64_t ldb,
+                std::int64_t stride_b, std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_sgesv_batch>(cgh, [=]() {
+            run_batch("gesv_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_sgesv(LAPACK_COL_MAJOR, n, nrhs,
+                                     accessor_a.get_pointer() + i * stride_a, lda,
+                                     accessor_ipiv.get_pointer() + i * stride_ipiv,
+                                     accessor_b.get_pointer() + i * stride_b, ldb);
+            });
+        });
+    });
+}
+
+void gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a,
+                std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+                std::int64_t stride_ipiv, sycl::buffer<double> &b, std::int64_t ldb,
+                std::int64_t stride_b, std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dgesv_batch>(cgh, [=]() {
+            run_batch("gesv_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_dgesv(LAPACK_COL_MAJOR, n, nrhs,
+                                     accessor_a.get_pointer() + i * stride_a, lda,
+                                     accessor_ipiv.get_pointer() + i * stride_ipiv,
+                                     accessor_b.get_pointer() + i * stride_b, ldb);
+            });
+        });
+    });
+}
+
+void gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                sycl::buffer<std::complex<float>> &b, std::int64_t ldb, std::int64_t stride_b,
+                std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
+                std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cgesv_batch>(cgh, [=]() {
+            run_batch("gesv_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_cgesv(LAPACK_COL_MAJOR, n, nrhs,
+                                     accessor_a.get_pointer() + i * stride_a, lda,
+                                     accessor_ipiv.get_pointer() + i * stride_ipiv,
+                                     accessor_b.get_pointer() + i * stride_b, ldb);
+            });
+        });
+    });
+}
+
+void gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                sycl::buffer<std::complex<double>> &b, std::int64_t ldb, std::int64_t stride_b,
+                std::int64_t batch_size, sycl::buffer<std::complex<double>> &scratchpad,
+                std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zgesv_batch>(cgh, [=]() {
+            run_batch("gesv_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_zgesv(LAPACK_COL_MAJOR, n, nrhs,
+                                     accessor_a.get_pointer() + i * stride_a, lda,
+                                     accessor_ipiv.get_pointer() + i * stride_ipiv,
+                                     accessor_b.get_pointer() + i * stride_b, ldb);
+            });
+        });
+    });
+}
+
+void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<float> &b, std::int64_t ldb, std::int64_t stride_b,
+                std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_sgels_batch>(cgh, [=]() {
+            run_batch("gels_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_sgels(LAPACK_COL_MAJOR, convert_to_lapack_trans<float>(trans), m, n,
+                                     nrhs, accessor_a.get_pointer() + i * stride_a, lda,
+                                     accessor_b.get_pointer() + i * stride_b, ldb);
+            });
+        });
+    });
+}
+
+void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<double> &b, std::int64_t ldb, std::int64_t stride_b,
+                std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dgels_batch>(cgh, [=]() {
+            run_batch("gels_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_dgels(LAPACK_COL_MAJOR, convert_to_lapack_trans<double>(trans), m, n,
+                                     nrhs, accessor_a.get_pointer() + i * stride_a, lda,
+                                     accessor_b.get_pointer() + i * stride_b, ldb);
+            });
+        });
+    });
+}
+
+void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                std::int64_t stride_a, sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                std::int64_t stride_b, std::int64_t batch_size,
+                sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cgels_batch>(cgh, [=]() {
+            run_batch("gels_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_cgels(LAPACK_COL_MAJOR,
+                                     convert_to_lapack_trans<std::complex<float>>(trans), m, n,
+                                     nrhs, accessor_a.get_pointer() + i * stride_a, lda,
+                                     accessor_b.get_pointer() + i * stride_b, ldb);
+            });
+        });
+    });
+}
+
+void gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                std::int64_t stride_a, sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                std::int64_t stride_b, std::int64_t batch_size,
+                sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zgels_batch>(cgh, [=]() {
+            run_batch("gels_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_zgels(LAPACK_COL_MAJOR,
+                                     convert_to_lapack_trans<std::complex<double>>(trans), m, n,
+                                     nrhs, accessor_a.get_pointer() + i * stride_a, lda,
+                                     accessor_b.get_pointer() + i * stride_b, ldb);
+            });
+        });
+    });
+}
+
+void heevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                 sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<float> &w, std::int64_t stride_w, std::int64_t batch_size,
+                 sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_cheevd_batch>(cgh, [=]() {
+            auto heevd = [=](std::int64_t i) {
+                return LAPACKE_cheevd(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                      convert_to_lapack_uplo(uplo), n,
+                                      accessor_a.get_pointer() + i * stride_a, lda,
+                                      accessor_w.get_pointer() + i * stride_w);
+            };
+            if (small_batch::heevd_batch("heevd_batch", jobz == oneapi::mkl::job::vec,
+                                         uplo == oneapi::mkl::uplo::upper, n,
+                                         accessor_a.get_pointer().get(), lda, stride_a,
+                                         accessor_w.get_pointer().get(), stride_w, batch_size,
+                                         heevd))
+                return;
+            run_batch("heevd_batch", batch_size, heevd);
+        });
+    });
+}
+
+void heevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                 sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<double> &w, std::int64_t stride_w, std::int64_t batch_size,
+                 sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_zheevd_batch>(cgh, [=]() {
+            auto heevd = [=](std::int64_t i) {
+                return LAPACKE_zheevd(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                      convert_to_lapack_uplo(uplo), n,
+                                      accessor_a.get_pointer() + i * stride_a, lda,
+                                      accessor_w.get_pointer() + i * stride_w);
+            };
+            if (small_batch::heevd_batch("heevd_batch", jobz == oneapi::mkl::job::vec,
+                                         uplo == oneapi::mkl::uplo::upper, n,
+                                         accessor_a.get_pointer().get(), lda, stride_a,
+                                         accessor_w.get_pointer().get(), stride_w, batch_size,
+                                         heevd))
+                return;
+            run_batch("heevd_batch", batch_size, heevd);
+        });
+    });
+}
+
+void getrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<float> &a,
+                 std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+                 std::int64_t stride_ipiv, std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_sgetrf_batch>(cgh, [=]() {
+            if (small_batch::getrf_batch("getrf_batch", m, n, accessor_a.get_pointer().get(), lda,
+                                         stride_a, accessor_ipiv.get_pointer().get(), stride_ipiv,
+                                         batch_size))
+                return;
+            run_batch("getrf_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_sgetrf(LAPACK_COL_MAJOR, m, n,
+                                      accessor_a.get_pointer() + i * stride_a, lda,
+                                      accessor_ipiv.get_pointer() + i * stride_ipiv);
+            });
+        });
+    });
+}
+
+void getrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<double> &a,
+                 std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+                 std::int64_t stride_ipiv, std::int64_t batch_size,
+                 sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_dgetrf_batch>(cgh, [=]() {
+            if (small_batch::getrf_batch("getrf_batch", m, n, accessor_a.get_pointer().get(), lda,
+                                         stride_a, accessor_ipiv.get_pointer().get(), stride_ipiv,
+                                         batch_size))
+                return;
+            run_batch("getrf_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_dgetrf(LAPACK_COL_MAJOR, m, n,
+                                      accessor_a.get_pointer() + i * stride_a, lda,
+                                      accessor_ipiv.get_pointer() + i * stride_ipiv);
+            });
+        });
+    });
+}
+
+void getrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                 sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                 std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_cgetrf_batch>(cgh, [=]() {
+            if (small_batch::getrf_batch("getrf_batch", m, n, accessor_a.get_pointer().get(), lda,
+                                         stride_a, accessor_ipiv.get_pointer().get(), stride_ipiv,
+                                         batch_size))
+                return;
+            run_batch("getrf_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_cgetrf(LAPACK_COL_MAJOR, m, n,
+                                      accessor_a.get_pointer() + i * stride_a, lda,
+                                      accessor_ipiv.get_pointer() + i * stride_ipiv);
+            });
+        });
+    });
+}
+
+void getrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                 sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                 std::int64_t batch_size, sycl::buffer<std::complex<double>> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_zgetrf_batch>(cgh, [=]() {
+            if (small_batch::getrf_batch("getrf_batch", m, n, accessor_a.get_pointer().get(), lda,
+                                         stride_a, accessor_ipiv.get_pointer().get(), stride_ipiv,
+                                         batch_size))
+                return;
+            run_batch("getrf_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_zgetrf(LAPACK_COL_MAJOR, m, n,
+                                      accessor_a.get_pointer() + i * stride_a, lda,
+                                      accessor_ipiv.get_pointer() + i * stride_ipiv);
+            });
+        });
+    });
+}
+
+void orgqr_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
+                 sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<float> &tau, std::int64_t stride_tau, std::int64_t batch_size,
+                 sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_sorgqr_batch>(cgh, [=]() {
+            run_batch("orgqr_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_sorgqr(LAPACK_COL_MAJOR, m, n, k,
+                                      accessor_a.get_pointer() + i * stride_a, lda,
+                                      accessor_tau.get_pointer() + i * stride_tau);
+            });
+        });
+    });
+}
+
+void orgqr_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
+                 sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<double> &tau, std::int64_t stride_tau, std::int64_t batch_size,
+                 sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_dorgqr_batch>(cgh, [=]() {
+            run_batch("orgqr_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_dorgqr(LAPACK_COL_MAJOR, m, n, k,
+                                      accessor_a.get_pointer() + i * stride_a, lda,
+                                      accessor_tau.get_pointer() + i * stride_tau);
+            });
+        });
+    });
+}
+
+void potrf_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+                 std::int64_t lda, std::int64_t stride_a, std::int64_t batch_size,
+                 sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_spotrf_batch>(cgh, [=]() {
+            if (small_batch::potrf_batch("potrf_batch", uplo == oneapi::mkl::uplo::upper, n,
+                                         accessor_a.get_pointer().get(), lda, stride_a, batch_size))
+                return;
+            run_batch("potrf_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_spotrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                      accessor_a.get_pointer() + i * stride_a, lda);
+            });
+        });
+    });
+}
+
+void potrf_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                 sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                 std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dpotrf_batch>(cgh, [=]() {
+            if (small_batch::potrf_batch("potrf_batch", uplo == oneapi::mkl::uplo::upper, n,
+                                         accessor_a.get_pointer().get(), lda, stride_a, batch_size))
+                return;
+            run_batch("potrf_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_dpotrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                      accessor_a.get_pointer() + i * stride_a, lda);
+            });
+        });
+    });
+}
+
+void potrf_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                 sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
+                 std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cpotrf_batch>(cgh, [=]() {
+            if (small_batch::potrf_batch("potrf_batch", uplo == oneapi::mkl::uplo::upper, n,
+                                         accessor_a.get_pointer().get(), lda, stride_a, batch_size))
+                return;
+            run_batch("potrf_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_cpotrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                      accessor_a.get_pointer() + i * stride_a, lda);
+            });
+        });
+    });
+}
+
+void potrf_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                 sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+                 std::int64_t batch_size, sycl::buffer<std::complex<double>> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zpotrf_batch>(cgh, [=]() {
+            if (small_batch::potrf_batch("potrf_batch", uplo == oneapi::mkl::uplo::upper, n,
+                                         accessor_a.get_pointer().get(), lda, stride_a, batch_size))
+                return;
+            run_batch("potrf_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_zpotrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                      accessor_a.get_pointer() + i * stride_a, lda);
+            });
+        });
+    });
+}
+
+void potrs_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                 sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<float> &b, std::int64_t ldb, std::int64_t stride_b,
+                 std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_spotrs_batch>(cgh, [=]() {
+            run_batch("potrs_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_spotrs(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                      accessor_a.get_pointer() + i * stride_a, lda,
+                                      accessor_b.get_pointer() + i * stride_b, ldb);
+            });
+        });
+    });
+}
+
+void potrs_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                 sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<double> &b, std::int64_t ldb, std::int64_t stride_b,
+                 std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dpotrs_batch>(cgh, [=]() {
+            run_batch("potrs_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_dpotrs(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                      accessor_a.get_pointer() + i * stride_a, lda,
+                                      accessor_b.get_pointer() + i * stride_b, ldb);
+            });
+        });
+    });
+}
+
+void potrs_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                 sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<std::complex<float>> &b, std::int64_t ldb, std::int64_t stride_b,
+                 std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cpotrs_batch>(cgh, [=]() {
+            run_batch("potrs_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_cpotrs(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                      accessor_a.get_pointer() + i * stride_a, lda,
+                                      accessor_b.get_pointer() + i * stride_b, ldb);
+            });
+        });
+    });
+}
+
+void potrs_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                 sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<std::complex<double>> &b, std::int64_t ldb, std::int64_t stride_b,
+                 std::int64_t batch_size, sycl::buffer<std::complex<double>> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zpotrs_batch>(cgh, [=]() {
+            run_batch("potrs_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_zpotrs(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                      accessor_a.get_pointer() + i * stride_a, lda,
+                                      accessor_b.get_pointer() + i * stride_b, ldb);
+            });
+        });
+    });
+}
+
+void posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<float> &b, std::int64_t ldb, std::int64_t stride_b,
+                std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_sposv_batch>(cgh, [=]() {
+            run_batch("posv_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_sposv(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                     accessor_a.get_pointer() + i * stride_a, lda,
+                                     accessor_b.get_pointer() + i * stride_b, ldb);
+            });
+        });
+    });
+}
+
+void posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<double> &b, std::int64_t ldb, std::int64_t stride_b,
+                std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dposv_batch>(cgh, [=]() {
+            run_batch("posv_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_dposv(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                     accessor_a.get_pointer() + i * stride_a, lda,
+                                     accessor_b.get_pointer() + i * stride_b, ldb);
+            });
+        });
+    });
+}
+
+void posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<std::complex<float>> &b, std::int64_t ldb, std::int64_t stride_b,
+                std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
+                std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cposv_batch>(cgh, [=]() {
+            run_batch("posv_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_cposv(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                     accessor_a.get_pointer() + i * stride_a, lda,
+                                     accessor_b.get_pointer() + i * stride_b, ldb);
+            });
+        });
+    });
+}
+
+void posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<std::complex<double>> &b, std::int64_t ldb, std::int64_t stride_b,
+                std::int64_t batch_size, sycl::buffer<std::complex<double>> &scratchpad,
+                std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zposv_batch>(cgh, [=]() {
+            run_batch("posv_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_zposv(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                     accessor_a.get_pointer() + i * stride_a, lda,
+                                     accessor_b.get_pointer() + i * stride_b, ldb);
+            });
+        });
+    });
+}
+
+void syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                 sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<float> &w, std::int64_t stride_w, std::int64_t batch_size,
+                 sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_ssyevd_batch>(cgh, [=]() {
+            auto syevd = [=](std::int64_t i) {
+                return LAPACKE_ssyevd(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                      convert_to_lapack_uplo(uplo), n,
+                                      accessor_a.get_pointer() + i * stride_a, lda,
+                                      accessor_w.get_pointer() + i * stride_w);
+            };
+            if (small_batch::heevd_batch("syevd_batch", jobz == oneapi::mkl::job::vec,
+                                         uplo == oneapi::mkl::uplo::upper, n,
+                                         accessor_a.get_pointer().get(), lda, stride_a,
+                                         accessor_w.get_pointer().get(), stride_w, batch_size,
+                                         syevd))
+                return;
+            run_batch("syevd_batch", batch_size, syevd);
+        });
+    });
+}
+
+void syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                 sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<double> &w, std::int64_t stride_w, std::int64_t batch_size,
+                 sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_dsyevd_batch>(cgh, [=]() {
+            auto syevd = [=](std::int64_t i) {
+                return LAPACKE_dsyevd(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                      convert_to_lapack_uplo(uplo), n,
+                                      accessor_a.get_pointer() + i * stride_a, lda,
+                                      accessor_w.get_pointer() + i * stride_w);
+            };
+            if (small_batch::heevd_batch("syevd_batch", jobz == oneapi::mkl::job::vec,
+                                         uplo == oneapi::mkl::uplo::upper, n,
+                                         accessor_a.get_pointer().get(), lda, stride_a,
+                                         accessor_w.get_pointer().get(), stride_w, batch_size,
+                                         syevd))
+                return;
+            run_batch("syevd_batch", batch_size, syevd);
+        });
+    });
+}
+
+void ungqr_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
+                 sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<std::complex<float>> &tau, std::int64_t stride_tau,
+                 std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_cungqr_batch>(cgh, [=]() {
+            run_batch("ungqr_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_cungqr(LAPACK_COL_MAJOR, m, n, k,
+                                      accessor_a.get_pointer() + i * stride_a, lda,
+                                      accessor_tau.get_pointer() + i * stride_tau);
+            });
+        });
+    });
+}
+
+void ungqr_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
+                 sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+                 sycl::buffer<std::complex<double>> &tau, std::int64_t stride_tau,
+                 std::int64_t batch_size, sycl::buffer<std::complex<double>> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_zungqr_batch>(cgh, [=]() {
+            run_batch("ungqr_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_zungqr(LAPACK_COL_MAJOR, m, n, k,
+                                      accessor_a.get_pointer() + i * stride_a, lda,
+                                      accessor_tau.get_pointer() + i * stride_tau);
+            });
+        });
+    });
+}
+
+sycl::event geqrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, float *a,
+                        std::int64_t lda, std::int64_t stride_a, float *tau,
+                        std::int64_t stride_tau, std::int64_t batch_size, float *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgeqrf_batch_usm>(cgh, [=]() {
+            if (small_batch::geqrf_batch("geqrf_batch", m, n, a, lda, stride_a, tau, stride_tau,
+                                         batch_size))
+                return;
+            run_batch("geqrf_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_sgeqrf(LAPACK_COL_MAJOR, m, n, a + i * stride_a, lda,
+                                      tau + i * stride_tau);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event geqrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, double *a,
+                        std::int64_t lda, std::int64_t stride_a, double *tau,
+                        std::int64_t stride_tau, std::int64_t batch_size, double *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgeqrf_batch_usm>(cgh, [=]() {
+            if (small_batch::geqrf_batch("geqrf_batch", m, n, a, lda, stride_a, tau, stride_tau,
+                                         batch_size))
+                return;
+            run_batch("geqrf_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_dgeqrf(LAPACK_COL_MAJOR, m, n, a + i * stride_a, lda,
+                                      tau + i * stride_tau);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event geqrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<float> *a,
+                        std::int64_t lda, std::int64_t stride_a, std::complex<float> *tau,
+                        std::int64_t stride_tau, std::int64_t batch_size,
+                        std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgeqrf_batch_usm>(cgh, [=]() {
+            if (small_batch::geqrf_batch("geqrf_batch", m, n, a, lda, stride_a, tau, stride_tau,
+                                         batch_size))
+                return;
+            run_batch("geqrf_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_cgeqrf(LAPACK_COL_MAJOR, m, n, a + i * stride_a, lda,
+                                      tau + i * stride_tau);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event geqrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<double> *a,
+                        std::int64_t lda, std::int64_t stride_a, std::complex<double> *tau,
+                        std::int64_t stride_tau, std::int64_t batch_size,
+                        std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgeqrf_batch_usm>(cgh, [=]() {
+            if (small_batch::geqrf_batch("geqrf_batch", m, n, a, lda, stride_a, tau, stride_tau,
+                                         batch_size))
+                return;
+            run_batch("geqrf_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_zgeqrf(LAPACK_COL_MAJOR, m, n, a + i * stride_a, lda,
+                                      tau + i * stride_tau);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event geqrf_batch(sycl::queue &queue, std::int64_t *m, std::int64_t *n, float **a,
+                        std::int64_t *lda, float **tau, std::int64_t group_count,
+                        std::int64_t *group_sizes, float *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgeqrf_group_batch_usm>(cgh, [=]() {
+            run_group_batch("geqrf_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_sgeqrf(LAPACK_COL_MAJOR, m[g], n[g], a[i], lda[g],
+                                                      tau[i]);
+                            });
+        });
+    });
+    return done;
+}
+
+sycl::event geqrf_batch(sycl::queue &queue, std::int64_t *m, std::int64_t *n, double **a,
+                        std::int64_t *lda, double **tau, std::int64_t group_count,
+                        std::int64_t *group_sizes, double *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgeqrf_group_batch_usm>(cgh, [=]() {
+            run_group_batch("geqrf_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_dgeqrf(LAPACK_COL_MAJOR, m[g], n[g], a[i], lda[g],
+                                                      tau[i]);
+                            });
+        });
+    });
+    return done;
+}
+
+sycl::event geqrf_batch(sycl::queue &queue, std::int64_t *m, std::int64_t *n,
+                        std::complex<float> **a, std::int64_t *lda, std::complex<float> **tau,
+                        std::int64_t group_count, std::int64_t *group_sizes,
+                        std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgeqrf_group_batch_usm>(cgh, [=]() {
+            run_group_batch("geqrf_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_cgeqrf(LAPACK_COL_MAJOR, m[g], n[g], a[i], lda[g],
+                                                      tau[i]);
+                            });
+        });
+    });
+    return done;
+}
+
+sycl::event geqrf_batch(sycl::queue &queue, std::int64_t *m, std::int64_t *n,
+                        std::complex<double> **a, std::int64_t *lda, std::complex<double> **tau,
+                        std::int64_t group_count, std::int64_t *group_sizes,
+                        std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgeqrf_group_batch_usm>(cgh, [=]() {
+            run_group_batch("geqrf_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_zgeqrf(LAPACK_COL_MAJOR, m[g], n[g], a[i], lda[g],
+                                                      tau[i]);
+                            });
+        });
+    });
+    return done;
+}
+
+sycl::event getrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, float *a,
+                        std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
+                        std::int64_t stride_ipiv, std::int64_t batch_size, float *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgetrf_batch_usm>(cgh, [=]() {
+            if (small_batch::getrf_batch("getrf_batch", m, n, a, lda, stride_a, ipiv, stride_ipiv,
+                                         batch_size))
+                return;
+            run_batch("getrf_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_sgetrf(LAPACK_COL_MAJOR, m, n, a + i * stride_a, lda,
+                                      ipiv + i * stride_ipiv);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event getrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, double *a,
+                        std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
+                        std::int64_t stride_ipiv, std::int64_t batch_size, double *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgetrf_batch_usm>(cgh, [=]() {
+            if (small_batch::getrf_batch("getrf_batch", m, n, a, lda, stride_a, ipiv, stride_ipiv,
+                                         batch_size))
+                return;
+            run_batch("getrf_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_dgetrf(LAPACK_COL_MAJOR, m, n, a + i * stride_a, lda,
+                                      ipiv + i * stride_ipiv);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event getrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<float> *a,
+                        std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
+                        std::int64_t stride_ipiv, std::int64_t batch_size,
+                        std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgetrf_batch_usm>(cgh, [=]() {
+            if (small_batch::getrf_batch("getrf_batch", m, n, a, lda, stride_a, ipiv, stride_ipiv,
+                                         batch_size))
+                return;
+            run_batch("getrf_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_cgetrf(LAPACK_COL_MAJOR, m, n, a + i * stride_a, lda,
+                                      ipiv + i * stride_ipiv);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event getrf_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<double> *a,
+                        std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
+                        std::int64_t stride_ipiv, std::int64_t batch_size,
+                        std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgetrf_batch_usm>(cgh, [=]() {
+            if (small_batch::getrf_batch("getrf_batch", m, n, a, lda, stride_a, ipiv, stride_ipiv,
+                                         batch_size))
+                return;
+            run_batch("getrf_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_zgetrf(LAPACK_COL_MAJOR, m, n, a + i * stride_a, lda,
+                                      ipiv + i * stride_ipiv);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event getrf_batch(sycl::queue &queue, std::int64_t *m, std::int64_t *n, float **a,
+                        std::int64_t *lda, std::int64_t **ipiv, std::int64_t group_count,
+                        std::int64_t *group_sizes, float *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgetrf_group_batch_usm>(cgh, [=]() {
+            run_group_batch("getrf_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_sgetrf(LAPACK_COL_MAJOR, m[g], n[g], a[i], lda[g],
+                                                      ipiv[i]);
+                            });
+        });
+    });
+    return done;
+}
+
+sycl::event getrf_batch(sycl::queue &queue, std::int64_t *m, std::int64_t *n, double **a,
+                        std::int64_t *lda, std::int64_t **ipiv, std::int64_t group_count,
+                        std::int64_t *group_sizes, double *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgetrf_group_batch_usm>(cgh, [=]() {
+            run_group_batch("getrf_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_dgetrf(LAPACK_COL_MAJOR, m[g], n[g], a[i], lda[g],
+                                                      ipiv[i]);
+                            });
+        });
+    });
+    return done;
+}
+
+sycl::event getrf_batch(sycl::queue &queue, std::int64_t *m, std::int64_t *n,
+                        std::complex<float> **a, std::int64_t *lda, std::int64_t **ipiv,
+                        std::int64_t group_count, std::int64_t *group_sizes,
+                        std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgetrf_group_batch_usm>(cgh, [=]() {
+            run_group_batch("getrf_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_cgetrf(LAPACK_COL_MAJOR, m[g], n[g], a[i], lda[g],
+                                                      ipiv[i]);
+                            });
+        });
+    });
+    return done;
+}
+
+sycl::event getrf_batch(sycl::queue &queue, std::int64_t *m, std::int64_t *n,
+                        std::complex<double> **a, std::int64_t *lda, std::int64_t **ipiv,
+                        std::int64_t group_count, std::int64_t *group_sizes,
+                        std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgetrf_group_batch_usm>(cgh, [=]() {
+            run_group_batch("getrf_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_zgetrf(LAPACK_COL_MAJOR, m[g], n[g], a[i], lda[g],
+                                                      ipiv[i]);
+                            });
+        });
+    });
+    return done;
+}
+
+sycl::event getri_batch(sycl::queue &queue, std::int64_t n, float *a, std::int64_t lda,
+                        std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv,
+                        std::int64_t batch_size, float *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgetri_batch_usm>(cgh, [=]() {
+            run_batch("getri_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_sgetri(LAPACK_COL_MAJOR, n, a + i * stride_a, lda,
+                                      ipiv + i * stride_ipiv);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event getri_batch(sycl::queue &queue, std::int64_t n, double *a, std::int64_t lda,
+                        std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv,
+                        std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgetri_batch_usm>(cgh, [=]() {
+            run_batch("getri_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_dgetri(LAPACK_COL_MAJOR, n, a + i * stride_a, lda,
+                                      ipiv + i * stride_ipiv);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event getri_batch(sycl::queue &queue, std::int64_t n, std::complex<float> *a,
+                        std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
+                        std::int64_t stride_ipiv, std::int64_t batch_size,
+                        std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgetri_batch_usm>(cgh, [=]() {
+            run_batch("getri_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_cgetri(LAPACK_COL_MAJOR, n, a + i * stride_a, lda,
+                                      ipiv + i * stride_ipiv);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event getri_batch(sycl::queue &queue, std::int64_t n, std::complex<double> *a,
+                        std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
+                        std::int64_t stride_ipiv, std::int64_t batch_size,
+                        std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgetri_batch_usm>(cgh, [=]() {
+            run_batch("getri_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_zgetri(LAPACK_COL_MAJOR, n, a + i * stride_a, lda,
+                                      ipiv + i * stride_ipiv);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event getri_batch(sycl::queue &queue, std::int64_t *n, float **a, std::int64_t *lda,
+                        std::int64_t **ipiv, std::int64_t group_count, std::int64_t *group_sizes,
+                        float *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgetri_group_batch_usm>(cgh, [=]() {
+            run_group_batch("getri_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_sgetri(LAPACK_COL_MAJOR, n[g], a[i], lda[g],
+                                                      ipiv[i]);
+                            });
+        });
+    });
+    return done;
+}
+
+sycl::event getri_batch(sycl::queue &queue, std::int64_t *n, double **a, std::int64_t *lda,
+                        std::int64_t **ipiv, std::int64_t group_count, std::int64_t *group_sizes,
+                        double *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgetri_group_batch_usm>(cgh, [=]() {
+            run_group_batch("getri_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_dgetri(LAPACK_COL_MAJOR, n[g], a[i], lda[g],
+                                                      ipiv[i]);
+                            });
+        });
+    });
+    return done;
+}
+
+sycl::event getri_batch(sycl::queue &queue, std::int64_t *n, std::complex<float> **a,
+                        std::int64_t *lda, std::int64_t **ipiv, std::int64_t group_count,
+                        std::int64_t *group_sizes, std::complex<float> *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgetri_group_batch_usm>(cgh, [=]() {
+            run_group_batch("getri_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_cgetri(LAPACK_COL_MAJOR, n[g], a[i], lda[g],
+                                                      ipiv[i]);
+                            });
+        });
+    });
+    return done;
+}
+
+sycl::event getri_batch(sycl::queue &queue, std::int64_t *n, std::complex<double> **a,
+                        std::int64_t *lda, std::int64_t **ipiv, std::int64_t group_count,
+                        std::int64_t *group_sizes, std::complex<double> *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgetri_group_batch_usm>(cgh, [=]() {
+            run_group_batch("getri_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_zgetri(LAPACK_COL_MAJOR, n[g], a[i], lda[g],
+                                                      ipiv[i]);
+                            });
+        });
+    });
+    return done;
+}
+
+sycl::event getrs_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                        std::int64_t nrhs, float *a, std::int64_t lda, std::int64_t stride_a,
+                        std::int64_t *ipiv, std::int64_t stride_ipiv, float *b, std::int64_t ldb,
+                        std::int64_t stride_b, std::int64_t batch_size, float *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgetrs_batch_usm>(cgh, [=]() {
+            run_batch("getrs_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_sgetrs(LAPACK_COL_MAJOR, convert_to_lapack_trans<float>(trans), n,
+                                      nrhs, a + i * stride_a, lda, ipiv + i * stride_ipiv,
+                                      b + i * stride_b, ldb);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event getrs_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                        std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t stride_a,
+                        std::int64_t *ipiv, std::int64_t stride_ipiv, double *b, std::int64_t ldb,
+                        std::int64_t stride_b, std::int64_t batch_size, double *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgetrs_batch_usm>(cgh, [=]() {
+            run_batch("getrs_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_dgetrs(LAPACK_COL_MAJOR, convert_to_lapack_trans<double>(trans), n,
+                                      nrhs, a + i * stride_a, lda, ipiv + i * stride_ipiv,
+                                      b + i * stride_b, ldb);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event getrs_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                        std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                        std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv,
+                        std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
+                        std::int64_t batch_size, std::complex<float> *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgetrs_batch_usm>(cgh, [=]() {
+            run_batch("getrs_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_cgetrs(LAPACK_COL_MAJOR,
+                                      convert_to_lapack_trans<std::complex<float>>(trans), n, nrhs,
+                                      a + i * stride_a, lda, ipiv + i * stride_ipiv,
+                                      b + i * stride_b, ldb);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event getrs_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                        std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                        std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv,
+                        std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
+                        std::int64_t batch_size, std::complex<double> *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgetrs_batch_usm>(cgh, [=]() {
+            run_batch("getrs_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_zgetrs(LAPACK_COL_MAJOR,
+                                      convert_to_lapack_trans<std::complex<double>>(trans), n, nrhs,
+                                      a + i * stride_a, lda, ipiv + i * stride_ipiv,
+                                      b + i * stride_b, ldb);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, float *a,
+                       std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
+                       std::int64_t stride_ipiv, float *b, std::int64_t ldb, std::int64_t stride_b,
+                       std::int64_t batch_size, float *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgesv_batch_usm>(cgh, [=]() {
+            run_batch("gesv_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_sgesv(LAPACK_COL_MAJOR, n, nrhs, a + i * stride_a, lda,
+                                     ipiv + i * stride_ipiv, b + i * stride_b, ldb);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, double *a,
+                       std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
+                       std::int64_t stride_ipiv, double *b, std::int64_t ldb, std::int64_t stride_b,
+                       std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgesv_batch_usm>(cgh, [=]() {
+            run_batch("gesv_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_dgesv(LAPACK_COL_MAJOR, n, nrhs, a + i * stride_a, lda,
+                                     ipiv + i * stride_ipiv, b + i * stride_b, ldb);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                       std::complex<float> *a, std::int64_t lda, std::int64_t stride_a,
+                       std::int64_t *ipiv, std::int64_t stride_ipiv, std::complex<float> *b,
+                       std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                       std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgesv_batch_usm>(cgh, [=]() {
+            run_batch("gesv_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_cgesv(LAPACK_COL_MAJOR, n, nrhs, a + i * stride_a, lda,
+                                     ipiv + i * stride_ipiv, b + i * stride_b, ldb);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event gesv_batch(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                       std::complex<double> *a, std::int64_t lda, std::int64_t stride_a,
+                       std::int64_t *ipiv, std::int64_t stride_ipiv, std::complex<double> *b,
+                       std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                       std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgesv_batch_usm>(cgh, [=]() {
+            run_batch("gesv_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_zgesv(LAPACK_COL_MAJOR, n, nrhs, a + i * stride_a, lda,
+                                     ipiv + i * stride_ipiv, b + i * stride_b, ldb);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                       std::int64_t n, std::int64_t nrhs, float *a, std::int64_t lda,
+                       std::int64_t stride_a, float *b, std::int64_t ldb, std::int64_t stride_b,
+                       std::int64_t batch_size, float *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgels_batch_usm>(cgh, [=]() {
+            run_batch("gels_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_sgels(LAPACK_COL_MAJOR, convert_to_lapack_trans<float>(trans), m, n,
+                                     nrhs, a + i * stride_a, lda, b + i * stride_b, ldb);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                       std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda,
+                       std::int64_t stride_a, double *b, std::int64_t ldb, std::int64_t stride_b,
+                       std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgels_batch_usm>(cgh, [=]() {
+            run_batch("gels_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_dgels(LAPACK_COL_MAJOR, convert_to_lapack_trans<double>(trans), m, n,
+                                     nrhs, a + i * stride_a, lda, b + i * stride_b, ldb);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                       std::int64_t n, std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                       std::int64_t stride_a, std::complex<float> *b, std::int64_t ldb,
+                       std::int64_t stride_b, std::int64_t batch_size,
+                       std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgels_batch_usm>(cgh, [=]() {
+            run_batch("gels_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_cgels(LAPACK_COL_MAJOR,
+                                     convert_to_lapack_trans<std::complex<float>>(trans), m, n,
+                                     nrhs, a + i * stride_a, lda, b + i * stride_b, ldb);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event gels_batch(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                       std::int64_t n, std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                       std::int64_t stride_a, std::complex<double> *b, std::int64_t ldb,
+                       std::int64_t stride_b, std::int64_t batch_size,
+                       std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgels_batch_usm>(cgh, [=]() {
+            run_batch("gels_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_zgels(LAPACK_COL_MAJOR,
+                                     convert_to_lapack_trans<std::complex<double>>(trans), m, n,
+                                     nrhs, a + i * stride_a, lda, b + i * stride_b, ldb);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event heevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                        std::int64_t n, std::complex<float> *a, std::int64_t lda,
+                        std::int64_t stride_a, float *w, std::int64_t stride_w,
+                        std::int64_t batch_size, std::complex<float> *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cheevd_batch_usm>(cgh, [=]() {
+            auto heevd = [=](std::int64_t i) {
+                return LAPACKE_cheevd(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                      convert_to_lapack_uplo(uplo), n, a + i * stride_a, lda,
+                                      w + i * stride_w);
+            };
+            if (small_batch::heevd_batch("heevd_batch", jobz == oneapi::mkl::job::vec,
+                                         uplo == oneapi::mkl::uplo::upper, n, a, lda, stride_a, w,
+                                         stride_w, batch_size, heevd))
+                return;
+            run_batch("heevd_batch", batch_size, heevd);
+        });
+    });
+    return done;
+}
+
+sycl::event heevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                        std::int64_t n, std::complex<double> *a, std::int64_t lda,
+                        std::int64_t stride_a, double *w, std::int64_t stride_w,
+                        std::int64_t batch_size, std::complex<double> *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zheevd_batch_usm>(cgh, [=]() {
+            auto heevd = [=](std::int64_t i) {
+                return LAPACKE_zheevd(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                      convert_to_lapack_uplo(uplo), n, a + i * stride_a, lda,
+                                      w + i * stride_w);
+            };
+            if (small_batch::heevd_batch("heevd_batch", jobz == oneapi::mkl::job::vec,
+                                         uplo == oneapi::mkl::uplo::upper, n, a, lda, stride_a, w,
+                                         stride_w, batch_size, heevd))
+                return;
+            run_batch("heevd_batch", batch_size, heevd);
+        });
+    });
+    return done;
+}
+
+sycl::event getrs_batch(sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *n,
+                        std::int64_t *nrhs, float **a, std::int64_t *lda, std::int64_t **ipiv,
+                        float **b, std::int64_t *ldb, std::int64_t group_count,
+                        std::int64_t *group_sizes, float *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgetrs_group_batch_usm>(cgh, [=]() {
+            run_group_batch("getrs_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_sgetrs(LAPACK_COL_MAJOR,
+                                                      convert_to_lapack_trans<float>(trans[g]),
+                                                      n[g], nrhs[g], a[i], lda[g], ipiv[i], b[i],
+                                                      ldb[g]);
+                            });
+        });
+    });
+    return done;
+}
+
+sycl::event getrs_batch(sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *n,
+                        std::int64_t *nrhs, double **a, std::int64_t *lda, std::int64_t **ipiv,
+                        double **b, std::int64_t *ldb, std::int64_t group_count,
+                        std::int64_t *group_sizes, double *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgetrs_group_batch_usm>(cgh, [=]() {
+            run_group_batch("getrs_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_dgetrs(LAPACK_COL_MAJOR,
+                                                      convert_to_lapack_trans<double>(trans[g]),
+                                                      n[g], nrhs[g], a[i], lda[g], ipiv[i], b[i],
+                                                      ldb[g]);
+                            });
+        });
+    });
+    return done;
+}
+
+sycl::event getrs_batch(sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *n,
+                        std::int64_t *nrhs, std::complex<float> **a, std::int64_t *lda,
+                        std::int64_t **ipiv, std::complex<float> **b, std::int64_t *ldb,
+                        std::int64_t group_count, std::int64_t *group_sizes,
+                        std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgetrs_group_batch_usm>(cgh, [=]() {
+            run_group_batch("getrs_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_cgetrs(
+                                    LAPACK_COL_MAJOR,
+                                    convert_to_lapack_trans<std::complex<float>>(trans[g]), n[g],
+                                    nrhs[g], a[i], lda[g], ipiv[i], b[i], ldb[g]);
+                            });
+        });
+    });
+    return done;
+}
+
+sycl::event getrs_batch(sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *n,
+                        std::int64_t *nrhs, std::complex<double> **a, std::int64_t *lda,
+                        std::int64_t **ipiv, std::complex<double> **b, std::int64_t *ldb,
+                        std::int64_t group_count, std::int64_t *group_sizes,
+                        std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgetrs_group_batch_usm>(cgh, [=]() {
+            run_group_batch("getrs_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_zgetrs(
+                                    LAPACK_COL_MAJOR,
+                                    convert_to_lapack_trans<std::complex<double>>(trans[g]), n[g],
+                                    nrhs[g], a[i], lda[g], ipiv[i], b[i], ldb[g]);
+                            });
+        });
+    });
+    return done;
+}
+
+sycl::event orgqr_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
+                        float *a, std::int64_t lda, std::int64_t stride_a, float *tau,
+                        std::int64_t stride_tau, std::int64_t batch_size, float *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sorgqr_batch_usm>(cgh, [=]() {
+            run_batch("orgqr_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_sorgqr(LAPACK_COL_MAJOR, m, n, k, a + i * stride_a, lda,
+                                      tau + i * stride_tau);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event orgqr_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
+                        double *a, std::int64_t lda, std::int64_t stride_a, double *tau,
+                        std::int64_t stride_tau, std::int64_t batch_size, double *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dorgqr_batch_usm>(cgh, [=]() {
+            run_batch("orgqr_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_dorgqr(LAPACK_COL_MAJOR, m, n, k, a + i * stride_a, lda,
+                                      tau + i * stride_tau);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event orgqr_batch(sycl::queue &queue, std::int64_t *m, std::int64_t *n, std::int64_t *k,
+                        float **a, std::int64_t *lda, float **tau, std::int64_t group_count,
+                        std::int64_t *group_sizes, float *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sorgqr_group_batch_usm>(cgh, [=]() {
+            run_group_batch("orgqr_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_sorgqr(LAPACK_COL_MAJOR, m[g], n[g], k[g], a[i],
+                                                      lda[g], tau[i]);
+                            });
+        });
+    });
+    return done;
+}
+
+sycl::event orgqr_batch(sycl::queue &queue, std::int64_t *m, std::int64_t *n, std::int64_t *k,
+                        double **a, std::int64_t *lda, double **tau, std::int64_t group_count,
+                        std::int64_t *group_sizes, double *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dorgqr_group_batch_usm>(cgh, [=]() {
+            run_group_batch("orgqr_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_dorgqr(LAPACK_COL_MAJOR, m[g], n[g], k[g], a[i],
+                                                      lda[g], tau[i]);
+                            });
+        });
+    });
+    return done;
+}
+
+sycl::event potrf_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, float *a,
+                        std::int64_t lda, std::int64_t stride_a, std::int64_t batch_size,
+                        float *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_spotrf_batch_usm>(cgh, [=]() {
+            if (small_batch::potrf_batch("potrf_batch", uplo == oneapi::mkl::uplo::upper, n, a, lda,
+                                         stride_a, batch_size))
+                return;
+            run_batch("potrf_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_spotrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                      a + i * stride_a, lda);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event potrf_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, double *a,
+                        std::int64_t lda, std::int64_t stride_a, std::int64_t batch_size,
+                        double *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dpotrf_batch_usm>(cgh, [=]() {
+            if (small_batch::potrf_batch("potrf_batch", uplo == oneapi::mkl::uplo::upper, n, a, lda,
+                                         stride_a, batch_size))
+                return;
+            run_batch("potrf_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_dpotrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                      a + i * stride_a, lda);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event potrf_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::complex<float> *a, std::int64_t lda, std::int64_t stride_a,
+                        std::int64_t batch_size, std::complex<float> *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cpotrf_batch_usm>(cgh, [=]() {
+            if (small_batch::potrf_batch("potrf_batch", uplo == oneapi::mkl::uplo::upper, n, a, lda,
+                                         stride_a, batch_size))
+                return;
+            run_batch("potrf_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_cpotrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                      a + i * stride_a, lda);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event potrf_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::complex<double> *a, std::int64_t lda, std::int64_t stride_a,
+                        std::int64_t batch_size, std::complex<double> *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zpotrf_batch_usm>(cgh, [=]() {
+            if (small_batch::potrf_batch("potrf_batch", uplo == oneapi::mkl::uplo::upper, n, a, lda,
+                                         stride_a, batch_size))
+                return;
+            run_batch("potrf_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_zpotrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                      a + i * stride_a, lda);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event potrf_batch(sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n, float **a,
+                        std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes,
+                        float *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_spotrf_group_batch_usm>(cgh, [=]() {
+            run_group_batch("potrf_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_spotrf(LAPACK_COL_MAJOR,
+                                                      convert_to_lapack_uplo(uplo[g]), n[g], a[i],
+                                                      lda[g]);
+                            });
+        });
+    });
+    return done;
+}
+
+sycl::event potrf_batch(sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n, double **a,
+                        std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes,
+                        double *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dpotrf_group_batch_usm>(cgh, [=]() {
+            run_group_batch("potrf_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_dpotrf(LAPACK_COL_MAJOR,
+                                                      convert_to_lapack_uplo(uplo[g]), n[g], a[i],
+                                                      lda[g]);
+                            });
+        });
+    });
+    return done;
+}
+
+sycl::event potrf_batch(sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
+                        std::complex<float> **a, std::int64_t *lda, std::int64_t group_count,
+                        std::int64_t *group_sizes, std::complex<float> *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cpotrf_group_batch_usm>(cgh, [=]() {
+            run_group_batch("potrf_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_cpotrf(LAPACK_COL_MAJOR,
+                                                      convert_to_lapack_uplo(uplo[g]), n[g], a[i],
+                                                      lda[g]);
+                            });
+        });
+    });
+    return done;
+}
+
+sycl::event potrf_batch(sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
+                        std::complex<double> **a, std::int64_t *lda, std::int64_t group_count,
+                        std::int64_t *group_sizes, std::complex<double> *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zpotrf_group_batch_usm>(cgh, [=]() {
+            run_group_batch("potrf_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_zpotrf(LAPACK_COL_MAJOR,
+                                                      convert_to_lapack_uplo(uplo[g]), n[g], a[i],
+                                                      lda[g]);
+                            });
+        });
+    });
+    return done;
+}
+
+sycl::event potrs_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, float *a, std::int64_t lda, std::int64_t stride_a,
+                        float *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                        float *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_spotrs_batch_usm>(cgh, [=]() {
+            run_batch("potrs_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_spotrs(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                      a + i * stride_a, lda, b + i * stride_b, ldb);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event potrs_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t stride_a,
+                        double *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                        double *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dpotrs_batch_usm>(cgh, [=]() {
+            run_batch("potrs_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_dpotrs(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                      a + i * stride_a, lda, b + i * stride_b, ldb);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event potrs_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                        std::int64_t stride_a, std::complex<float> *b, std::int64_t ldb,
+                        std::int64_t stride_b, std::int64_t batch_size,
+                        std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cpotrs_batch_usm>(cgh, [=]() {
+            run_batch("potrs_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_cpotrs(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                      a + i * stride_a, lda, b + i * stride_b, ldb);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event potrs_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                        std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                        std::int64_t stride_a, std::complex<double> *b, std::int64_t ldb,
+                        std::int64_t stride_b, std::int64_t batch_size,
+                        std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zpotrs_batch_usm>(cgh, [=]() {
+            run_batch("potrs_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_zpotrs(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                      a + i * stride_a, lda, b + i * stride_b, ldb);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                       std::int64_t nrhs, float *a, std::int64_t lda, std::int64_t stride_a,
+                       float *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                       float *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sposv_batch_usm>(cgh, [=]() {
+            run_batch("posv_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_sposv(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                     a + i * stride_a, lda, b + i * stride_b, ldb);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                       std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t stride_a,
+                       double *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                       double *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dposv_batch_usm>(cgh, [=]() {
+            run_batch("posv_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_dposv(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                     a + i * stride_a, lda, b + i * stride_b, ldb);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                       std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                       std::int64_t stride_a, std::complex<float> *b, std::int64_t ldb,
+                       std::int64_t stride_b, std::int64_t batch_size,
+                       std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cposv_batch_usm>(cgh, [=]() {
+            run_batch("posv_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_cposv(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                     a + i * stride_a, lda, b + i * stride_b, ldb);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event posv_batch(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                       std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                       std::int64_t stride_a, std::complex<double> *b, std::int64_t ldb,
+                       std::int64_t stride_b, std::int64_t batch_size,
+                       std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zposv_batch_usm>(cgh, [=]() {
+            run_batch("posv_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_zposv(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                     a + i * stride_a, lda, b + i * stride_b, ldb);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                        std::int64_t n, float *a, std::int64_t lda, std::int64_t stride_a, float *w,
+                        std::int64_t stride_w, std::int64_t batch_size, float *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ssyevd_batch_usm>(cgh, [=]() {
+            auto syevd = [=](std::int64_t i) {
+                return LAPACKE_ssyevd(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                      convert_to_lapack_uplo(uplo), n, a + i * stride_a, lda,
+                                      w + i * stride_w);
+            };
+            if (small_batch::heevd_batch("syevd_batch", jobz == oneapi::mkl::job::vec,
+                                         uplo == oneapi::mkl::uplo::upper, n, a, lda, stride_a, w,
+                                         stride_w, batch_size, syevd))
+                return;
+            run_batch("syevd_batch", batch_size, syevd);
+        });
+    });
+    return done;
+}
+
+sycl::event syevd_batch(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                        std::int64_t n, double *a, std::int64_t lda, std::int64_t stride_a,
+                        double *w, std::int64_t stride_w, std::int64_t batch_size,
+                        double *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dsyevd_batch_usm>(cgh, [=]() {
+            auto syevd = [=](std::int64_t i) {
+                return LAPACKE_dsyevd(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                      convert_to_lapack_uplo(uplo), n, a + i * stride_a, lda,
+                                      w + i * stride_w);
+            };
+            if (small_batch::heevd_batch("syevd_batch", jobz == oneapi::mkl::job::vec,
+                                         uplo == oneapi::mkl::uplo::upper, n, a, lda, stride_a, w,
+                                         stride_w, batch_size, syevd))
+                return;
+            run_batch("syevd_batch", batch_size, syevd);
+        });
+    });
+    return done;
+}
+
+sycl::event potrs_batch(sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
+                        std::int64_t *nrhs, float **a, std::int64_t *lda, float **b,
+                        std::int64_t *ldb, std::int64_t group_count, std::int64_t *group_sizes,
+                        float *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_spotrs_group_batch_usm>(cgh, [=]() {
+            run_group_batch("potrs_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_spotrs(LAPACK_COL_MAJOR,
+                                                      convert_to_lapack_uplo(uplo[g]), n[g],
+                                                      nrhs[g], a[i], lda[g], b[i], ldb[g]);
+                            });
+        });
+    });
+    return done;
+}
+
+sycl::event potrs_batch(sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
+                        std::int64_t *nrhs, double **a, std::int64_t *lda, double **b,
+                        std::int64_t *ldb, std::int64_t group_count, std::int64_t *group_sizes,
+                        double *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dpotrs_group_batch_usm>(cgh, [=]() {
+            run_group_batch("potrs_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_dpotrs(LAPACK_COL_MAJOR,
+                                                      convert_to_lapack_uplo(uplo[g]), n[g],
+                                                      nrhs[g], a[i], lda[g], b[i], ldb[g]);
+                            });
+        });
+    });
+    return done;
+}
+
+sycl::event potrs_batch(sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
+                        std::int64_t *nrhs, std::complex<float> **a, std::int64_t *lda,
+                        std::complex<float> **b, std::int64_t *ldb, std::int64_t group_count,
+                        std::int64_t *group_sizes, std::complex<float> *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cpotrs_group_batch_usm>(cgh, [=]() {
+            run_group_batch("potrs_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_cpotrs(LAPACK_COL_MAJOR,
+                                                      convert_to_lapack_uplo(uplo[g]), n[g],
+                                                      nrhs[g], a[i], lda[g], b[i], ldb[g]);
+                            });
+        });
+    });
+    return done;
+}
+
+sycl::event potrs_batch(sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
+                        std::int64_t *nrhs, std::complex<double> **a, std::int64_t *lda,
+                        std::complex<double> **b, std::int64_t *ldb, std::int64_t group_count,
+                        std::int64_t *group_sizes, std::complex<double> *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zpotrs_group_batch_usm>(cgh, [=]() {
+            run_group_batch("potrs_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_zpotrs(LAPACK_COL_MAJOR,
+                                                      convert_to_lapack_uplo(uplo[g]), n[g],
+                                                      nrhs[g], a[i], lda[g], b[i], ldb[g]);
+                            });
+        });
+    });
+    return done;
+}
+
+sycl::event ungqr_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
+                        std::complex<float> *a, std::int64_t lda, std::int64_t stride_a,
+                        std::complex<float> *tau, std::int64_t stride_tau, std::int64_t batch_size,
+                        std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cungqr_batch_usm>(cgh, [=]() {
+            run_batch("ungqr_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_cungqr(LAPACK_COL_MAJOR, m, n, k, a + i * stride_a, lda,
+                                      tau + i * stride_tau);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event ungqr_batch(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
+                        std::complex<double> *a, std::int64_t lda, std::int64_t stride_a,
+                        std::complex<double> *tau, std::int64_t stride_tau, std::int64_t batch_size,
+                        std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zungqr_batch_usm>(cgh, [=]() {
+            run_batch("ungqr_batch", batch_size, [=](std::int64_t i) {
+                return LAPACKE_zungqr(LAPACK_COL_MAJOR, m, n, k, a + i * stride_a, lda,
+                                      tau + i * stride_tau);
+            });
+        });
+    });
+    return done;
+}
+
+sycl::event ungqr_batch(sycl::queue &queue, std::int64_t *m, std::int64_t *n, std::int64_t *k,
+                        std::complex<float> **a, std::int64_t *lda, std::complex<float> **tau,
+                        std::int64_t group_count, std::int64_t *group_sizes,
+                        std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cungqr_group_batch_usm>(cgh, [=]() {
+            run_group_batch("ungqr_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_cungqr(LAPACK_COL_MAJOR, m[g], n[g], k[g], a[i],
+                                                      lda[g], tau[i]);
+                            });
+        });
+    });
+    return done;
+}
+
+sycl::event ungqr_batch(sycl::queue &queue, std::int64_t *m, std::int64_t *n, std::int64_t *k,
+                        std::complex<double> **a, std::int64_t *lda, std::complex<double> **tau,
+                        std::int64_t group_count, std::int64_t *group_sizes,
+                        std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zungqr_group_batch_usm>(cgh, [=]() {
+            run_group_batch("ungqr_batch", group_count, group_sizes,
+                            [=](std::int64_t g, std::int64_t i) {
+                                return LAPACKE_zungqr(LAPACK_COL_MAJOR, m[g], n[g], k[g], a[i],
+                                                      lda[g], tau[i]);
+                            });
+        });
+    });
+    return done;
+}
+
+} // namespace netlib
+} // namespace lapack
+} // namespace mkl
+} // namespace oneapi
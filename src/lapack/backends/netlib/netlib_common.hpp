@@ -0,0 +1,264 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_LAPACK_COMMON_HPP_
+#define _NETLIB_LAPACK_COMMON_HPP_
+
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#ifndef lapack_int
+#define lapack_int int64_t
+#endif
+#define LAPACK_COMPLEX_CPP
+#include "lapacke.h"
+
+#include "oneapi/mkl/types.hpp"
+#include "oneapi/mkl/lapack/types.hpp"
+#include "oneapi/mkl/lapack/exceptions.hpp"
+#include "oneapi/mkl/lapack/detail/netlib/onemkl_lapack_netlib.hpp"
+
+#include "execution_policy_helper.hpp"
+#include "graph_helper.hpp"
+#include "thread_pool_helper.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace lapack {
+namespace netlib {
+
+/**
+ * Helper methods for converting between onemkl types and their LAPACK
+ * equivalents.
+ */
+
+template <typename fp>
+inline char convert_to_lapack_trans(transpose trans) {
+    constexpr bool is_complex = std::is_same<fp, std::complex<float>>::value ||
+                                std::is_same<fp, std::complex<double>>::value;
+    if (trans == transpose::nontrans)
+        return 'N';
+    else if (trans == transpose::conjtrans && is_complex)
+        return 'C';
+    else
+        return 'T';
+}
+
+inline char convert_to_lapack_uplo(uplo is_upper) {
+    return is_upper == uplo::upper ? 'U' : 'L';
+}
+
+inline char convert_to_lapack_diag(diag is_unit) {
+    return is_unit == diag::unit ? 'U' : 'N';
+}
+
+inline char convert_to_lapack_side(side is_left) {
+    return is_left == side::left ? 'L' : 'R';
+}
+
+inline char convert_to_lapack_job(job jobz) {
+    switch (jobz) {
+        case job::vec: return 'V';
+        case job::updatevec: return 'U';
+        case job::allvec: return 'A';
+        case job::somevec: return 'S';
+        case job::overwritevec: return 'O';
+        default: return 'N';
+    }
+}
+
+inline char convert_to_lapack_jobsvd(jobsvd job) {
+    switch (job) {
+        case jobsvd::vectors: return 'A';
+        case jobsvd::vectorsina: return 'O';
+        case jobsvd::somevec: return 'S';
+        default: return 'N';
+    }
+}
+
+inline char convert_to_lapack_generate(generate vect) {
+    switch (vect) {
+        case generate::q: return 'Q';
+        case generate::p: return 'P';
+        case generate::both: return 'V';
+        default: return 'N';
+    }
+}
+
+inline char convert_to_lapack_rangev(rangev range) {
+    switch (range) {
+        case rangev::values: return 'V';
+        case rangev::indices: return 'I';
+        default: return 'A';
+    }
+}
+
+// Maps a non-zero LAPACKE info value to the matching oneMKL LAPACK exception.
+inline std::exception_ptr info_to_exception(const std::string &function, lapack_int info) {
+    if (info == LAPACK_WORK_MEMORY_ERROR || info == LAPACK_TRANSPOSE_MEMORY_ERROR)
+        return std::make_exception_ptr(
+            computation_error(function, "failed to allocate workspace", info));
+    else if (info < 0)
+        return std::make_exception_ptr(invalid_argument(function, "invalid argument", -info));
+    else
+        return std::make_exception_ptr(computation_error(function, "computation failed", info));
+}
+
+inline void check_info(const std::string &function, lapack_int info) {
+    if (info != 0)
+        std::rethrow_exception(info_to_exception(function, info));
+}
+
+// Number of host threads used for count independent work items, at most the
+// threads of the execution policy of the call, if it has one.
+inline std::int64_t batch_threads(std::int64_t count) {
+    const std::int64_t limit = oneapi::mkl::detail::policy::thread_limit();
+    return std::min<std::int64_t>(
+        count, limit > 0 ? limit : std::max<std::int64_t>(1, std::thread::hardware_concurrency()));
+}
+
+// Splits [0, count) into contiguous blocks, one per thread given by
+// batch_threads(count), and calls f(thread, begin, end) for each block. Calls
+// with an execution policy start their own threads, which inherit the CPUs the
+// calling thread is pinned to.
+template <typename F>
+inline void parallel_for_blocks(std::int64_t count, F f) {
+    const std::int64_t num_threads = batch_threads(count);
+    auto worker = [&](std::int64_t t) {
+        f(t, count * t / num_threads, count * (t + 1) / num_threads);
+    };
+    if (num_threads <= 1) {
+        worker(0);
+        return;
+    }
+    if (oneapi::mkl::detail::policy::thread_limit() == 0) {
+        oneapi::mkl::detail::host_thread_pool::instance().run(num_threads, worker);
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads - 1);
+    for (std::int64_t t = 1; t < num_threads; t++)
+        threads.emplace_back(worker, t);
+    worker(0);
+    for (auto &thread : threads)
+        thread.join();
+}
+
+// Problems of a batch that reported a non-zero info, recorded per thread so
+// that workers never contend.
+class batch_failures {
+public:
+    explicit batch_failures(std::int64_t count)
+            : ids_(batch_threads(count)),
+              infos_(batch_threads(count)) {}
+
+    void add(std::int64_t thread, std::int64_t id, lapack_int info) {
+        ids_[thread].push_back(id);
+        infos_[thread].push_back(info);
+    }
+
+    void throw_if_any(const std::string &function) const {
+        sycl::vector_class<std::int64_t> ids;
+        sycl::vector_class<std::exception_ptr> exceptions;
+        for (std::size_t t = 0; t < ids_.size(); t++) {
+            for (std::size_t j = 0; j < ids_[t].size(); j++) {
+                ids.push_back(ids_[t][j]);
+                exceptions.push_back(info_to_exception(function, infos_[t][j]));
+            }
+        }
+        if (!ids.empty())
+            throw batch_error(function, "some problems in the batch failed", ids.size(), ids,
+                              exceptions);
+    }
+
+private:
+    std::vector<std::vector<std::int64_t>> ids_;
+    std::vector<std::vector<lapack_int>> infos_;
+};
+
+// Runs f(i) for every problem of a batch, splitting the batch into contiguous
+// blocks over the available host threads. Problems reporting a non-zero info
+// are collected into a single batch_error once the whole batch has completed.
+template <typename F>
+inline void run_batch(const std::string &function, std::int64_t batch_size, F f) {
+    if (batch_size <= 0)
+        return;
+    batch_failures failures(batch_size);
+    parallel_for_blocks(batch_size, [&](std::int64_t t, std::int64_t begin, std::int64_t end) {
+        for (std::int64_t i = begin; i < end; i++) {
+            const lapack_int info = f(i);
+            if (info != 0)
+                failures.add(t, i, info);
+        }
+    });
+    failures.throw_if_any(function);
+}
+
+// Group batches are flattened into one batch: f(g, i) is called with the group
+// index g of the i-th problem.
+template <typename F>
+inline void run_group_batch(const std::string &function, std::int64_t group_count,
+                            const std::int64_t *group_sizes, F f) {
+    std::vector<std::int64_t> offsets(group_count + 1, 0);
+    for (std::int64_t g = 0; g < group_count; g++)
+        offsets[g + 1] = offsets[g] + group_sizes[g];
+    run_batch(function, offsets.back(), [&](std::int64_t i) {
+        const std::int64_t g =
+            std::upper_bound(offsets.begin(), offsets.end(), i) - offsets.begin() - 1;
+        return f(g, i);
+    });
+}
+
+// host_task automatically uses run_on_host_intel if it is supported by the
+//  compiler. Otherwise, it falls back to single_task.
+template <typename K, typename H, typename F>
+static inline auto host_task_internal(H &cgh, F f, int) -> decltype(cgh.run_on_host_intel(f)) {
+    return cgh.run_on_host_intel(f);
+}
+
+template <typename K, typename H, typename F>
+static inline void host_task_internal(H &cgh, F f, long) {
+    cgh.template single_task<K>(f);
+}
+
+// host_task runs f under the execution policy of the queue of the call, if it
+//  has one (see oneapi/mkl/execution_policy.hpp).
+template <typename K, typename H, typename F>
+static inline void host_task(H &cgh, F f) {
+    (void)host_task_internal<K>(cgh, oneapi::mkl::detail::policy::bind(f), 0);
+}
+
+// submit runs a command group on the queue, or hands its host task to the
+// graph recording the queue (see oneapi/mkl/graph.hpp).
+using oneapi::mkl::detail::graph::submit;
+
+} // namespace netlib
+} // namespace lapack
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_NETLIB_LAPACK_COMMON_HPP_
@@ -0,0 +1,4045 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <CL/sycl.hpp>
+
+#include "netlib_common.hpp"
+#include "netlib_tsqr.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace lapack {
+namespace netlib {
+
+void gebrd(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+           std::int64_t lda, sycl::buffer<float> &d, sycl::buffer<float> &e,
+           sycl::buffer<std::complex<float>> &tauq, sycl::buffer<std::complex<float>> &taup,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_d = d.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_e = e.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_tauq = tauq.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_taup = taup.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_cgebrd>(cgh, [=]() {
+            auto info = LAPACKE_cgebrd(LAPACK_COL_MAJOR, m, n, accessor_a.get_pointer(), lda,
+                                       accessor_d.get_pointer(), accessor_e.get_pointer(),
+                                       accessor_tauq.get_pointer(), accessor_taup.get_pointer());
+            check_info("gebrd", info);
+        });
+    });
+}
+
+void gebrd(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<double> &a,
+           std::int64_t lda, sycl::buffer<double> &d, sycl::buffer<double> &e,
+           sycl::buffer<double> &tauq, sycl::buffer<double> &taup, sycl::buffer<double> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_d = d.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_e = e.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_tauq = tauq.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_taup = taup.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_dgebrd>(cgh, [=]() {
+            auto info = LAPACKE_dgebrd(LAPACK_COL_MAJOR, m, n, accessor_a.get_pointer(), lda,
+                                       accessor_d.get_pointer(), accessor_e.get_pointer(),
+                                       accessor_tauq.get_pointer(), accessor_taup.get_pointer());
+            check_info("gebrd", info);
+        });
+    });
+}
+
+void gebrd(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<float> &a,
+           std::int64_t lda, sycl::buffer<float> &d, sycl::buffer<float> &e,
+           sycl::buffer<float> &tauq, sycl::buffer<float> &taup, sycl::buffer<float> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_d = d.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_e = e.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_tauq = tauq.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_taup = taup.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_sgebrd>(cgh, [=]() {
+            auto info = LAPACKE_sgebrd(LAPACK_COL_MAJOR, m, n, accessor_a.get_pointer(), lda,
+                                       accessor_d.get_pointer(), accessor_e.get_pointer(),
+                                       accessor_tauq.get_pointer(), accessor_taup.get_pointer());
+            check_info("gebrd", info);
+        });
+    });
+}
+
+void gebrd(sycl::queue &queue, std::int64_t m, std::int64_t n,
+           sycl::buffer<std::complex<double>> &a, std::int64_t lda, sycl::buffer<double> &d,
+           sycl::buffer<double> &e, sycl::buffer<std::complex<double>> &tauq,
+           sycl::buffer<std::complex<double>> &taup, sycl::buffer<std::complex<double>> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_d = d.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_e = e.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_tauq = tauq.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_taup = taup.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_zgebrd>(cgh, [=]() {
+            auto info = LAPACKE_zgebrd(LAPACK_COL_MAJOR, m, n, accessor_a.get_pointer(), lda,
+                                       accessor_d.get_pointer(), accessor_e.get_pointer(),
+                                       accessor_tauq.get_pointer(), accessor_taup.get_pointer());
+            check_info("gebrd", info);
+        });
+    });
+}
+
+void gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+          std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &b,
+          std::int64_t ldb, sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_sgels>(cgh, [=]() {
+            auto info = LAPACKE_sgels(LAPACK_COL_MAJOR, convert_to_lapack_trans<float>(trans), m, n,
+                                      nrhs, accessor_a.get_pointer(), lda, accessor_b.get_pointer(),
+                                      ldb);
+            check_info("gels", info);
+        });
+    });
+}
+
+void gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+          std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b,
+          std::int64_t ldb, sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dgels>(cgh, [=]() {
+            auto info = LAPACKE_dgels(LAPACK_COL_MAJOR, convert_to_lapack_trans<double>(trans), m,
+                                      n, nrhs, accessor_a.get_pointer(), lda,
+                                      accessor_b.get_pointer(), ldb);
+            check_info("gels", info);
+        });
+    });
+}
+
+void gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+          std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+          sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+          sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cgels>(cgh, [=]() {
+            auto info = LAPACKE_cgels(LAPACK_COL_MAJOR,
+                                      convert_to_lapack_trans<std::complex<float>>(trans), m, n,
+                                      nrhs, accessor_a.get_pointer(), lda, accessor_b.get_pointer(),
+                                      ldb);
+            check_info("gels", info);
+        });
+    });
+}
+
+void gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+          std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+          sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+          sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zgels>(cgh, [=]() {
+            auto info = LAPACKE_zgels(LAPACK_COL_MAJOR,
+                                      convert_to_lapack_trans<std::complex<double>>(trans), m, n,
+                                      nrhs, accessor_a.get_pointer(), lda, accessor_b.get_pointer(),
+                                      ldb);
+            check_info("gels", info);
+        });
+    });
+}
+
+void gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+           sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &b, std::int64_t ldb,
+           sycl::buffer<float> &s, float rcond, sycl::buffer<std::int64_t> &rank,
+           sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_s = s.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_rank = rank.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_sgelsd>(cgh, [=]() {
+            auto info = LAPACKE_sgelsd(LAPACK_COL_MAJOR, m, n, nrhs, accessor_a.get_pointer(), lda,
+                                       accessor_b.get_pointer(), ldb, accessor_s.get_pointer(),
+                                       rcond, accessor_rank.get_pointer());
+            check_info("gelsd", info);
+        });
+    });
+}
+
+void gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+           sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b, std::int64_t ldb,
+           sycl::buffer<double> &s, double rcond, sycl::buffer<std::int64_t> &rank,
+           sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_s = s.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_rank = rank.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_dgelsd>(cgh, [=]() {
+            auto info = LAPACKE_dgelsd(LAPACK_COL_MAJOR, m, n, nrhs, accessor_a.get_pointer(), lda,
+                                       accessor_b.get_pointer(), ldb, accessor_s.get_pointer(),
+                                       rcond, accessor_rank.get_pointer());
+            check_info("gelsd", info);
+        });
+    });
+}
+
+void gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+           sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<float>> &b, std::int64_t ldb, sycl::buffer<float> &s,
+           float rcond, sycl::buffer<std::int64_t> &rank,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_s = s.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_rank = rank.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_cgelsd>(cgh, [=]() {
+            auto info = LAPACKE_cgelsd(LAPACK_COL_MAJOR, m, n, nrhs, accessor_a.get_pointer(), lda,
+                                       accessor_b.get_pointer(), ldb, accessor_s.get_pointer(),
+                                       rcond, accessor_rank.get_pointer());
+            check_info("gelsd", info);
+        });
+    });
+}
+
+void gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+           sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<double>> &b, std::int64_t ldb, sycl::buffer<double> &s,
+           double rcond, sycl::buffer<std::int64_t> &rank,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_s = s.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_rank = rank.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_zgelsd>(cgh, [=]() {
+            auto info = LAPACKE_zgelsd(LAPACK_COL_MAJOR, m, n, nrhs, accessor_a.get_pointer(), lda,
+                                       accessor_b.get_pointer(), ldb, accessor_s.get_pointer(),
+                                       rcond, accessor_rank.get_pointer());
+            check_info("gelsd", info);
+        });
+    });
+}
+
+void gerqf(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<float> &a,
+           std::int64_t lda, sycl::buffer<float> &tau, sycl::buffer<float> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_sgerqf>(cgh, [=]() {
+            auto info = LAPACKE_sgerqf(LAPACK_COL_MAJOR, m, n, accessor_a.get_pointer(), lda,
+                                       accessor_tau.get_pointer());
+            check_info("gerqf", info);
+        });
+    });
+}
+
+void gerqf(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<double> &a,
+           std::int64_t lda, sycl::buffer<double> &tau, sycl::buffer<double> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_dgerqf>(cgh, [=]() {
+            auto info = LAPACKE_dgerqf(LAPACK_COL_MAJOR, m, n, accessor_a.get_pointer(), lda,
+                                       accessor_tau.get_pointer());
+            check_info("gerqf", info);
+        });
+    });
+}
+
+void gerqf(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+           std::int64_t lda, sycl::buffer<std::complex<float>> &tau,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_cgerqf>(cgh, [=]() {
+            auto info = LAPACKE_cgerqf(LAPACK_COL_MAJOR, m, n, accessor_a.get_pointer(), lda,
+                                       accessor_tau.get_pointer());
+            check_info("gerqf", info);
+        });
+    });
+}
+
+void gerqf(sycl::queue &queue, std::int64_t m, std::int64_t n,
+           sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<double>> &tau, sycl::buffer<std::complex<double>> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_zgerqf>(cgh, [=]() {
+            auto info = LAPACKE_zgerqf(LAPACK_COL_MAJOR, m, n, accessor_a.get_pointer(), lda,
+                                       accessor_tau.get_pointer());
+            check_info("gerqf", info);
+        });
+    });
+}
+
+void geqrf(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+           std::int64_t lda, sycl::buffer<std::complex<float>> &tau,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_cgeqrf>(cgh, [=]() {
+            auto info = tsqr::geqrf(m, n, accessor_a.get_pointer().get(), lda,
+                                    accessor_tau.get_pointer().get());
+            check_info("geqrf", info);
+        });
+    });
+}
+
+void geqrf(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<double> &a,
+           std::int64_t lda, sycl::buffer<double> &tau, sycl::buffer<double> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_dgeqrf>(cgh, [=]() {
+            auto info = tsqr::geqrf(m, n, accessor_a.get_pointer().get(), lda,
+                                    accessor_tau.get_pointer().get());
+            check_info("geqrf", info);
+        });
+    });
+}
+
+void geqrf(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<float> &a,
+           std::int64_t lda, sycl::buffer<float> &tau, sycl::buffer<float> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_sgeqrf>(cgh, [=]() {
+            auto info = tsqr::geqrf(m, n, accessor_a.get_pointer().get(), lda,
+                                    accessor_tau.get_pointer().get());
+            check_info("geqrf", info);
+        });
+    });
+}
+
+void geqrf(sycl::queue &queue, std::int64_t m, std::int64_t n,
+           sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<double>> &tau, sycl::buffer<std::complex<double>> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_zgeqrf>(cgh, [=]() {
+            auto info = tsqr::geqrf(m, n, accessor_a.get_pointer().get(), lda,
+                                    accessor_tau.get_pointer().get());
+            check_info("geqrf", info);
+        });
+    });
+}
+
+void getrf(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+           std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_cgetrf>(cgh, [=]() {
+            auto info = LAPACKE_cgetrf(LAPACK_COL_MAJOR, m, n, accessor_a.get_pointer(), lda,
+                                       accessor_ipiv.get_pointer());
+            check_info("getrf", info);
+        });
+    });
+}
+
+void getrf(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<double> &a,
+           std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, sycl::buffer<double> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_dgetrf>(cgh, [=]() {
+            auto info = LAPACKE_dgetrf(LAPACK_COL_MAJOR, m, n, accessor_a.get_pointer(), lda,
+                                       accessor_ipiv.get_pointer());
+            check_info("getrf", info);
+        });
+    });
+}
+
+void getrf(sycl::queue &queue, std::int64_t m, std::int64_t n, sycl::buffer<float> &a,
+           std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, sycl::buffer<float> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_sgetrf>(cgh, [=]() {
+            auto info = LAPACKE_sgetrf(LAPACK_COL_MAJOR, m, n, accessor_a.get_pointer(), lda,
+                                       accessor_ipiv.get_pointer());
+            check_info("getrf", info);
+        });
+    });
+}
+
+void getrf(sycl::queue &queue, std::int64_t m, std::int64_t n,
+           sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+           sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<double>> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_zgetrf>(cgh, [=]() {
+            auto info = LAPACKE_zgetrf(LAPACK_COL_MAJOR, m, n, accessor_a.get_pointer(), lda,
+                                       accessor_ipiv.get_pointer());
+            check_info("getrf", info);
+        });
+    });
+}
+
+void getri(sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+           std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_cgetri>(cgh, [=]() {
+            auto info = LAPACKE_cgetri(LAPACK_COL_MAJOR, n, accessor_a.get_pointer(), lda,
+                                       accessor_ipiv.get_pointer());
+            check_info("getri", info);
+        });
+    });
+}
+
+void getri(sycl::queue &queue, std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+           sycl::buffer<std::int64_t> &ipiv, sycl::buffer<double> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_dgetri>(cgh, [=]() {
+            auto info = LAPACKE_dgetri(LAPACK_COL_MAJOR, n, accessor_a.get_pointer(), lda,
+                                       accessor_ipiv.get_pointer());
+            check_info("getri", info);
+        });
+    });
+}
+
+void getri(sycl::queue &queue, std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+           sycl::buffer<std::int64_t> &ipiv, sycl::buffer<float> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_sgetri>(cgh, [=]() {
+            auto info = LAPACKE_sgetri(LAPACK_COL_MAJOR, n, accessor_a.get_pointer(), lda,
+                                       accessor_ipiv.get_pointer());
+            check_info("getri", info);
+        });
+    });
+}
+
+void getri(sycl::queue &queue, std::int64_t n, sycl::buffer<std::complex<double>> &a,
+           std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_zgetri>(cgh, [=]() {
+            auto info = LAPACKE_zgetri(LAPACK_COL_MAJOR, n, accessor_a.get_pointer(), lda,
+                                       accessor_ipiv.get_pointer());
+            check_info("getri", info);
+        });
+    });
+}
+
+void getrs(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n, std::int64_t nrhs,
+           sycl::buffer<std::complex<float>> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+           sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cgetrs>(cgh, [=]() {
+            auto info = LAPACKE_cgetrs(LAPACK_COL_MAJOR,
+                                       convert_to_lapack_trans<std::complex<float>>(trans), n, nrhs,
+                                       accessor_a.get_pointer(), lda, accessor_ipiv.get_pointer(),
+                                       accessor_b.get_pointer(), ldb);
+            check_info("getrs", info);
+        });
+    });
+}
+
+void getrs(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n, std::int64_t nrhs,
+           sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+           sycl::buffer<double> &b, std::int64_t ldb, sycl::buffer<double> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dgetrs>(cgh, [=]() {
+            auto info = LAPACKE_dgetrs(LAPACK_COL_MAJOR, convert_to_lapack_trans<double>(trans), n,
+                                       nrhs, accessor_a.get_pointer(), lda,
+                                       accessor_ipiv.get_pointer(), accessor_b.get_pointer(), ldb);
+            check_info("getrs", info);
+        });
+    });
+}
+
+void getrs(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n, std::int64_t nrhs,
+           sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+           sycl::buffer<float> &b, std::int64_t ldb, sycl::buffer<float> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_sgetrs>(cgh, [=]() {
+            auto info = LAPACKE_sgetrs(LAPACK_COL_MAJOR, convert_to_lapack_trans<float>(trans), n,
+                                       nrhs, accessor_a.get_pointer(), lda,
+                                       accessor_ipiv.get_pointer(), accessor_b.get_pointer(), ldb);
+            check_info("getrs", info);
+        });
+    });
+}
+
+void getrs(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n, std::int64_t nrhs,
+           sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+           sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<double>> &b,
+           std::int64_t ldb, sycl::buffer<std::complex<double>> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zgetrs>(cgh, [=]() {
+            auto info = LAPACKE_zgetrs(LAPACK_COL_MAJOR,
+                                       convert_to_lapack_trans<std::complex<double>>(trans), n,
+                                       nrhs, accessor_a.get_pointer(), lda,
+                                       accessor_ipiv.get_pointer(), accessor_b.get_pointer(), ldb);
+            check_info("getrs", info);
+        });
+    });
+}
+
+void gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a,
+          std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, sycl::buffer<float> &b,
+          std::int64_t ldb, sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_sgesv>(cgh, [=]() {
+            auto info = LAPACKE_sgesv(LAPACK_COL_MAJOR, n, nrhs, accessor_a.get_pointer(), lda,
+                                      accessor_ipiv.get_pointer(), accessor_b.get_pointer(), ldb);
+            check_info("gesv", info);
+        });
+    });
+}
+
+void gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a,
+          std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, sycl::buffer<double> &b,
+          std::int64_t ldb, sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dgesv>(cgh, [=]() {
+            auto info = LAPACKE_dgesv(LAPACK_COL_MAJOR, n, nrhs, accessor_a.get_pointer(), lda,
+                                      accessor_ipiv.get_pointer(), accessor_b.get_pointer(), ldb);
+            check_info("gesv", info);
+        });
+    });
+}
+
+void gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+          sycl::buffer<std::complex<float>> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+          sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+          sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cgesv>(cgh, [=]() {
+            auto info = LAPACKE_cgesv(LAPACK_COL_MAJOR, n, nrhs, accessor_a.get_pointer(), lda,
+                                      accessor_ipiv.get_pointer(), accessor_b.get_pointer(), ldb);
+            check_info("gesv", info);
+        });
+    });
+}
+
+void gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+          sycl::buffer<std::complex<double>> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+          sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+          sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zgesv>(cgh, [=]() {
+            auto info = LAPACKE_zgesv(LAPACK_COL_MAJOR, n, nrhs, accessor_a.get_pointer(), lda,
+                                      accessor_ipiv.get_pointer(), accessor_b.get_pointer(), ldb);
+            check_info("gesv", info);
+        });
+    });
+}
+
+void gesvd(sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+           std::int64_t n, sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &s,
+           sycl::buffer<double> &u, std::int64_t ldu, sycl::buffer<double> &vt, std::int64_t ldvt,
+           sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_s = s.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_u = u.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_vt = vt.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_dgesvd>(cgh, [=]() {
+            std::vector<double> superb(std::max<std::int64_t>(1, std::min(m, n) - 1));
+            auto info = LAPACKE_dgesvd(LAPACK_COL_MAJOR, convert_to_lapack_jobsvd(jobu),
+                                       convert_to_lapack_jobsvd(jobvt), m, n,
+                                       accessor_a.get_pointer(), lda, accessor_s.get_pointer(),
+                                       accessor_u.get_pointer(), ldu, accessor_vt.get_pointer(),
+                                       ldvt, superb.data());
+            check_info("gesvd", info);
+        });
+    });
+}
+
+void gesvd(sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+           std::int64_t n, sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &s,
+           sycl::buffer<float> &u, std::int64_t ldu, sycl::buffer<float> &vt, std::int64_t ldvt,
+           sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_s = s.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_u = u.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_vt = vt.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_sgesvd>(cgh, [=]() {
+            std::vector<float> superb(std::max<std::int64_t>(1, std::min(m, n) - 1));
+            auto info = LAPACKE_sgesvd(LAPACK_COL_MAJOR, convert_to_lapack_jobsvd(jobu),
+                                       convert_to_lapack_jobsvd(jobvt), m, n,
+                                       accessor_a.get_pointer(), lda, accessor_s.get_pointer(),
+                                       accessor_u.get_pointer(), ldu, accessor_vt.get_pointer(),
+                                       ldvt, superb.data());
+            check_info("gesvd", info);
+        });
+    });
+}
+
+void gesvd(sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+           std::int64_t n, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+           sycl::buffer<float> &s, sycl::buffer<std::complex<float>> &u, std::int64_t ldu,
+           sycl::buffer<std::complex<float>> &vt, std::int64_t ldvt,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_s = s.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_u = u.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_vt = vt.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_cgesvd>(cgh, [=]() {
+            std::vector<float> superb(std::max<std::int64_t>(1, std::min(m, n) - 1));
+            auto info = LAPACKE_cgesvd(LAPACK_COL_MAJOR, convert_to_lapack_jobsvd(jobu),
+                                       convert_to_lapack_jobsvd(jobvt), m, n,
+                                       accessor_a.get_pointer(), lda, accessor_s.get_pointer(),
+                                       accessor_u.get_pointer(), ldu, accessor_vt.get_pointer(),
+                                       ldvt, superb.data());
+            check_info("gesvd", info);
+        });
+    });
+}
+
+void gesvd(sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt, std::int64_t m,
+           std::int64_t n, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+           sycl::buffer<double> &s, sycl::buffer<std::complex<double>> &u, std::int64_t ldu,
+           sycl::buffer<std::complex<double>> &vt, std::int64_t ldvt,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_s = s.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_u = u.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_vt = vt.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_zgesvd>(cgh, [=]() {
+            std::vector<double> superb(std::max<std::int64_t>(1, std::min(m, n) - 1));
+            auto info = LAPACKE_zgesvd(LAPACK_COL_MAJOR, convert_to_lapack_jobsvd(jobu),
+                                       convert_to_lapack_jobsvd(jobvt), m, n,
+                                       accessor_a.get_pointer(), lda, accessor_s.get_pointer(),
+                                       accessor_u.get_pointer(), ldu, accessor_vt.get_pointer(),
+                                       ldvt, superb.data());
+            check_info("gesvd", info);
+        });
+    });
+}
+
+void heevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<std::complex<float>> &a, std::int64_t lda, sycl::buffer<float> &w,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_cheevd>(cgh, [=]() {
+            auto info = LAPACKE_cheevd(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_uplo(uplo), n, accessor_a.get_pointer(),
+                                       lda, accessor_w.get_pointer());
+            check_info("heevd", info);
+        });
+    });
+}
+
+void heevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<std::complex<double>> &a, std::int64_t lda, sycl::buffer<double> &w,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_zheevd>(cgh, [=]() {
+            auto info = LAPACKE_zheevd(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_uplo(uplo), n, accessor_a.get_pointer(),
+                                       lda, accessor_w.get_pointer());
+            check_info("heevd", info);
+        });
+    });
+}
+
+void heevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+           std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+           sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_m = m.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_z = z.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_cheevr>(cgh, [=]() {
+            std::vector<lapack_int> isuppz(2 * std::max<std::int64_t>(1, n));
+            auto info = LAPACKE_cheevr(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, accessor_a.get_pointer(),
+                                       lda, vl, vu, il, iu, abstol, accessor_m.get_pointer(),
+                                       accessor_w.get_pointer(), accessor_z.get_pointer(), ldz,
+                                       isuppz.data());
+            check_info("heevr", info);
+        });
+    });
+}
+
+void heevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<double>> &a,
+           std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+           sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_m = m.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_z = z.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_zheevr>(cgh, [=]() {
+            std::vector<lapack_int> isuppz(2 * std::max<std::int64_t>(1, n));
+            auto info = LAPACKE_zheevr(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, accessor_a.get_pointer(),
+                                       lda, vl, vu, il, iu, abstol, accessor_m.get_pointer(),
+                                       accessor_w.get_pointer(), accessor_z.get_pointer(), ldz,
+                                       isuppz.data());
+            check_info("heevr", info);
+        });
+    });
+}
+
+void heevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+           std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+           sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_m = m.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_z = z.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_cheevx>(cgh, [=]() {
+            std::vector<lapack_int> ifail(std::max<std::int64_t>(1, n));
+            auto info = LAPACKE_cheevx(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, accessor_a.get_pointer(),
+                                       lda, vl, vu, il, iu, abstol, accessor_m.get_pointer(),
+                                       accessor_w.get_pointer(), accessor_z.get_pointer(), ldz,
+                                       ifail.data());
+            check_info("heevx", info);
+        });
+    });
+}
+
+void heevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<double>> &a,
+           std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+           sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_m = m.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_z = z.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_zheevx>(cgh, [=]() {
+            std::vector<lapack_int> ifail(std::max<std::int64_t>(1, n));
+            auto info = LAPACKE_zheevx(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, accessor_a.get_pointer(),
+                                       lda, vl, vu, il, iu, abstol, accessor_m.get_pointer(),
+                                       accessor_w.get_pointer(), accessor_z.get_pointer(), ldz,
+                                       ifail.data());
+            check_info("heevx", info);
+        });
+    });
+}
+
+void hegvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+           std::int64_t n, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<float>> &b, std::int64_t ldb, sycl::buffer<float> &w,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_chegvd>(cgh, [=]() {
+            auto info = LAPACKE_chegvd(LAPACK_COL_MAJOR, itype, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_uplo(uplo), n, accessor_a.get_pointer(),
+                                       lda, accessor_b.get_pointer(), ldb,
+                                       accessor_w.get_pointer());
+            check_info("hegvd", info);
+        });
+    });
+}
+
+void hegvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+           std::int64_t n, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<double>> &b, std::int64_t ldb, sycl::buffer<double> &w,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_zhegvd>(cgh, [=]() {
+            auto info = LAPACKE_zhegvd(LAPACK_COL_MAJOR, itype, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_uplo(uplo), n, accessor_a.get_pointer(),
+                                       lda, accessor_b.get_pointer(), ldb,
+                                       accessor_w.get_pointer());
+            check_info("hegvd", info);
+        });
+    });
+}
+
+void hetrd(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<std::complex<float>> &a, std::int64_t lda, sycl::buffer<float> &d,
+           sycl::buffer<float> &e, sycl::buffer<std::complex<float>> &tau,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_d = d.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_e = e.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_chetrd>(cgh, [=]() {
+            auto info = LAPACKE_chetrd(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                       accessor_a.get_pointer(), lda, accessor_d.get_pointer(),
+                                       accessor_e.get_pointer(), accessor_tau.get_pointer());
+            check_info("hetrd", info);
+        });
+    });
+}
+
+void hetrd(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<std::complex<double>> &a, std::int64_t lda, sycl::buffer<double> &d,
+           sycl::buffer<double> &e, sycl::buffer<std::complex<double>> &tau,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_d = d.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_e = e.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_zhetrd>(cgh, [=]() {
+            auto info = LAPACKE_zhetrd(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                       accessor_a.get_pointer(), lda, accessor_d.get_pointer(),
+                                       accessor_e.get_pointer(), accessor_tau.get_pointer());
+            check_info("hetrd", info);
+        });
+    });
+}
+
+void hetrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<std::complex<float>> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_chetrf>(cgh, [=]() {
+            auto info = LAPACKE_chetrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                       accessor_a.get_pointer(), lda, accessor_ipiv.get_pointer());
+            check_info("hetrf", info);
+        });
+    });
+}
+
+void hetrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+           sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<double>> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_zhetrf>(cgh, [=]() {
+            auto info = LAPACKE_zhetrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                       accessor_a.get_pointer(), lda, accessor_ipiv.get_pointer());
+            check_info("hetrf", info);
+        });
+    });
+}
+
+void orgbr(sycl::queue &queue, oneapi::mkl::generate vec, std::int64_t m, std::int64_t n,
+           std::int64_t k, sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &tau,
+           sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_sorgbr>(cgh, [=]() {
+            auto info = LAPACKE_sorgbr(LAPACK_COL_MAJOR, convert_to_lapack_generate(vec), m, n, k,
+                                       accessor_a.get_pointer(), lda, accessor_tau.get_pointer());
+            check_info("orgbr", info);
+        });
+    });
+}
+
+void orgbr(sycl::queue &queue, oneapi::mkl::generate vec, std::int64_t m, std::int64_t n,
+           std::int64_t k, sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &tau,
+           sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_dorgbr>(cgh, [=]() {
+            auto info = LAPACKE_dorgbr(LAPACK_COL_MAJOR, convert_to_lapack_generate(vec), m, n, k,
+                                       accessor_a.get_pointer(), lda, accessor_tau.get_pointer());
+            check_info("orgbr", info);
+        });
+    });
+}
+
+void orgqr(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
+           sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &tau,
+           sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_dorgqr>(cgh, [=]() {
+            auto info = tsqr::orgqr(m, n, k, accessor_a.get_pointer().get(), lda,
+                                    accessor_tau.get_pointer().get());
+            check_info("orgqr", info);
+        });
+    });
+}
+
+void orgqr(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
+           sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &tau,
+           sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_sorgqr>(cgh, [=]() {
+            auto info = tsqr::orgqr(m, n, k, accessor_a.get_pointer().get(), lda,
+                                    accessor_tau.get_pointer().get());
+            check_info("orgqr", info);
+        });
+    });
+}
+
+void orgtr(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+           std::int64_t lda, sycl::buffer<float> &tau, sycl::buffer<float> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_sorgtr>(cgh, [=]() {
+            auto info = LAPACKE_sorgtr(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                       accessor_a.get_pointer(), lda, accessor_tau.get_pointer());
+            check_info("orgtr", info);
+        });
+    });
+}
+
+void orgtr(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
+           std::int64_t lda, sycl::buffer<double> &tau, sycl::buffer<double> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_dorgtr>(cgh, [=]() {
+            auto info = LAPACKE_dorgtr(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                       accessor_a.get_pointer(), lda, accessor_tau.get_pointer());
+            check_info("orgtr", info);
+        });
+    });
+}
+
+void ormtr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+           oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, sycl::buffer<float> &a,
+           std::int64_t lda, sycl::buffer<float> &tau, sycl::buffer<float> &c, std::int64_t ldc,
+           sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_sormtr>(cgh, [=]() {
+            auto info = LAPACKE_sormtr(LAPACK_COL_MAJOR, convert_to_lapack_side(side),
+                                       convert_to_lapack_uplo(uplo),
+                                       convert_to_lapack_trans<float>(trans), m, n,
+                                       accessor_a.get_pointer(), lda, accessor_tau.get_pointer(),
+                                       accessor_c.get_pointer(), ldc);
+            check_info("ormtr", info);
+        });
+    });
+}
+
+void ormtr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+           oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, sycl::buffer<double> &a,
+           std::int64_t lda, sycl::buffer<double> &tau, sycl::buffer<double> &c, std::int64_t ldc,
+           sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dormtr>(cgh, [=]() {
+            auto info = LAPACKE_dormtr(LAPACK_COL_MAJOR, convert_to_lapack_side(side),
+                                       convert_to_lapack_uplo(uplo),
+                                       convert_to_lapack_trans<double>(trans), m, n,
+                                       accessor_a.get_pointer(), lda, accessor_tau.get_pointer(),
+                                       accessor_c.get_pointer(), ldc);
+            check_info("ormtr", info);
+        });
+    });
+}
+
+void ormrq(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans, std::int64_t m,
+           std::int64_t n, std::int64_t k, sycl::buffer<float> &a, std::int64_t lda,
+           sycl::buffer<float> &tau, sycl::buffer<float> &c, std::int64_t ldc,
+           sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_sormrq>(cgh, [=]() {
+            auto info = LAPACKE_sormrq(LAPACK_COL_MAJOR, convert_to_lapack_side(side),
+                                       convert_to_lapack_trans<float>(trans), m, n, k,
+                                       accessor_a.get_pointer(), lda, accessor_tau.get_pointer(),
+                                       accessor_c.get_pointer(), ldc);
+            check_info("ormrq", info);
+        });
+    });
+}
+
+void ormrq(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans, std::int64_t m,
+           std::int64_t n, std::int64_t k, sycl::buffer<double> &a, std::int64_t lda,
+           sycl::buffer<double> &tau, sycl::buffer<double> &c, std::int64_t ldc,
+           sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dormrq>(cgh, [=]() {
+            auto info = LAPACKE_dormrq(LAPACK_COL_MAJOR, convert_to_lapack_side(side),
+                                       convert_to_lapack_trans<double>(trans), m, n, k,
+                                       accessor_a.get_pointer(), lda, accessor_tau.get_pointer(),
+                                       accessor_c.get_pointer(), ldc);
+            check_info("ormrq", info);
+        });
+    });
+}
+
+void ormqr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans, std::int64_t m,
+           std::int64_t n, std::int64_t k, sycl::buffer<double> &a, std::int64_t lda,
+           sycl::buffer<double> &tau, sycl::buffer<double> &c, std::int64_t ldc,
+           sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dormqr>(cgh, [=]() {
+            auto info = LAPACKE_dormqr(LAPACK_COL_MAJOR, convert_to_lapack_side(side),
+                                       convert_to_lapack_trans<double>(trans), m, n, k,
+                                       accessor_a.get_pointer(), lda, accessor_tau.get_pointer(),
+                                       accessor_c.get_pointer(), ldc);
+            check_info("ormqr", info);
+        });
+    });
+}
+
+void ormqr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans, std::int64_t m,
+           std::int64_t n, std::int64_t k, sycl::buffer<float> &a, std::int64_t lda,
+           sycl::buffer<float> &tau, sycl::buffer<float> &c, std::int64_t ldc,
+           sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_sormqr>(cgh, [=]() {
+            auto info = LAPACKE_sormqr(LAPACK_COL_MAJOR, convert_to_lapack_side(side),
+                                       convert_to_lapack_trans<float>(trans), m, n, k,
+                                       accessor_a.get_pointer(), lda, accessor_tau.get_pointer(),
+                                       accessor_c.get_pointer(), ldc);
+            check_info("ormqr", info);
+        });
+    });
+}
+
+void potrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+           std::int64_t lda, sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_spotrf>(cgh, [=]() {
+            auto info = LAPACKE_spotrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                       accessor_a.get_pointer(), lda);
+            check_info("potrf", info);
+        });
+    });
+}
+
+void potrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
+           std::int64_t lda, sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dpotrf>(cgh, [=]() {
+            auto info = LAPACKE_dpotrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                       accessor_a.get_pointer(), lda);
+            check_info("potrf", info);
+        });
+    });
+}
+
+void potrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cpotrf>(cgh, [=]() {
+            auto info = LAPACKE_cpotrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                       accessor_a.get_pointer(), lda);
+            check_info("potrf", info);
+        });
+    });
+}
+
+void potrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zpotrf>(cgh, [=]() {
+            auto info = LAPACKE_zpotrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                       accessor_a.get_pointer(), lda);
+            check_info("potrf", info);
+        });
+    });
+}
+
+void potri(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+           std::int64_t lda, sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_spotri>(cgh, [=]() {
+            auto info = LAPACKE_spotri(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                       accessor_a.get_pointer(), lda);
+            check_info("potri", info);
+        });
+    });
+}
+
+void potri(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
+           std::int64_t lda, sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dpotri>(cgh, [=]() {
+            auto info = LAPACKE_dpotri(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                       accessor_a.get_pointer(), lda);
+            check_info("potri", info);
+        });
+    });
+}
+
+void potri(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cpotri>(cgh, [=]() {
+            auto info = LAPACKE_cpotri(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                       accessor_a.get_pointer(), lda);
+            check_info("potri", info);
+        });
+    });
+}
+
+void potri(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zpotri>(cgh, [=]() {
+            auto info = LAPACKE_zpotri(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                       accessor_a.get_pointer(), lda);
+            check_info("potri", info);
+        });
+    });
+}
+
+void potrs(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+           sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &b, std::int64_t ldb,
+           sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_spotrs>(cgh, [=]() {
+            auto info = LAPACKE_spotrs(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                       accessor_a.get_pointer(), lda, accessor_b.get_pointer(),
+                                       ldb);
+            check_info("potrs", info);
+        });
+    });
+}
+
+void potrs(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+           sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b, std::int64_t ldb,
+           sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dpotrs>(cgh, [=]() {
+            auto info = LAPACKE_dpotrs(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                       accessor_a.get_pointer(), lda, accessor_b.get_pointer(),
+                                       ldb);
+            check_info("potrs", info);
+        });
+    });
+}
+
+void potrs(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+           sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cpotrs>(cgh, [=]() {
+            auto info = LAPACKE_cpotrs(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                       accessor_a.get_pointer(), lda, accessor_b.get_pointer(),
+                                       ldb);
+            check_info("potrs", info);
+        });
+    });
+}
+
+void potrs(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+           sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zpotrs>(cgh, [=]() {
+            auto info = LAPACKE_zpotrs(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                       accessor_a.get_pointer(), lda, accessor_b.get_pointer(),
+                                       ldb);
+            check_info("potrs", info);
+        });
+    });
+}
+
+void posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+          sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &b, std::int64_t ldb,
+          sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_sposv>(cgh, [=]() {
+            auto info = LAPACKE_sposv(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                      accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb);
+            check_info("posv", info);
+        });
+    });
+}
+
+void posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+          sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b, std::int64_t ldb,
+          sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dposv>(cgh, [=]() {
+            auto info = LAPACKE_dposv(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                      accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb);
+            check_info("posv", info);
+        });
+    });
+}
+
+void posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+          sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+          sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+          sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cposv>(cgh, [=]() {
+            auto info = LAPACKE_cposv(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                      accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb);
+            check_info("posv", info);
+        });
+    });
+}
+
+void posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+          sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+          sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+          sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zposv>(cgh, [=]() {
+            auto info = LAPACKE_zposv(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                      accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb);
+            check_info("posv", info);
+        });
+    });
+}
+
+void syevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &w,
+           sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_dsyevd>(cgh, [=]() {
+            auto info = LAPACKE_dsyevd(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_uplo(uplo), n, accessor_a.get_pointer(),
+                                       lda, accessor_w.get_pointer());
+            check_info("syevd", info);
+        });
+    });
+}
+
+void syevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &w,
+           sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_ssyevd>(cgh, [=]() {
+            auto info = LAPACKE_ssyevd(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_uplo(uplo), n, accessor_a.get_pointer(),
+                                       lda, accessor_w.get_pointer());
+            check_info("syevd", info);
+        });
+    });
+}
+
+void syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+           float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w, sycl::buffer<float> &z,
+           std::int64_t ldz, sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_m = m.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_z = z.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_ssyevr>(cgh, [=]() {
+            std::vector<lapack_int> isuppz(2 * std::max<std::int64_t>(1, n));
+            auto info = LAPACKE_ssyevr(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, accessor_a.get_pointer(),
+                                       lda, vl, vu, il, iu, abstol, accessor_m.get_pointer(),
+                                       accessor_w.get_pointer(), accessor_z.get_pointer(), ldz,
+                                       isuppz.data());
+            check_info("syevr", info);
+        });
+    });
+}
+
+void syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+           double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w, sycl::buffer<double> &z,
+           std::int64_t ldz, sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_m = m.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_z = z.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_dsyevr>(cgh, [=]() {
+            std::vector<lapack_int> isuppz(2 * std::max<std::int64_t>(1, n));
+            auto info = LAPACKE_dsyevr(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, accessor_a.get_pointer(),
+                                       lda, vl, vu, il, iu, abstol, accessor_m.get_pointer(),
+                                       accessor_w.get_pointer(), accessor_z.get_pointer(), ldz,
+                                       isuppz.data());
+            check_info("syevr", info);
+        });
+    });
+}
+
+void syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+           float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w, sycl::buffer<float> &z,
+           std::int64_t ldz, sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_m = m.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_z = z.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_ssyevx>(cgh, [=]() {
+            std::vector<lapack_int> ifail(std::max<std::int64_t>(1, n));
+            auto info = LAPACKE_ssyevx(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, accessor_a.get_pointer(),
+                                       lda, vl, vu, il, iu, abstol, accessor_m.get_pointer(),
+                                       accessor_w.get_pointer(), accessor_z.get_pointer(), ldz,
+                                       ifail.data());
+            check_info("syevx", info);
+        });
+    });
+}
+
+void syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+           oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+           double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+           sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w, sycl::buffer<double> &z,
+           std::int64_t ldz, sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_m = m.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_z = z.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_dsyevx>(cgh, [=]() {
+            std::vector<lapack_int> ifail(std::max<std::int64_t>(1, n));
+            auto info = LAPACKE_dsyevx(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, accessor_a.get_pointer(),
+                                       lda, vl, vu, il, iu, abstol, accessor_m.get_pointer(),
+                                       accessor_w.get_pointer(), accessor_z.get_pointer(), ldz,
+                                       ifail.data());
+            check_info("syevx", info);
+        });
+    });
+}
+
+void sygvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+           std::int64_t n, sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b,
+           std::int64_t ldb, sycl::buffer<double> &w, sycl::buffer<double> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_dsygvd>(cgh, [=]() {
+            auto info = LAPACKE_dsygvd(LAPACK_COL_MAJOR, itype, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_uplo(uplo), n, accessor_a.get_pointer(),
+                                       lda, accessor_b.get_pointer(), ldb,
+                                       accessor_w.get_pointer());
+            check_info("sygvd", info);
+        });
+    });
+}
+
+void sygvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+           std::int64_t n, sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &b,
+           std::int64_t ldb, sycl::buffer<float> &w, sycl::buffer<float> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_w = w.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_ssygvd>(cgh, [=]() {
+            auto info = LAPACKE_ssygvd(LAPACK_COL_MAJOR, itype, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_uplo(uplo), n, accessor_a.get_pointer(),
+                                       lda, accessor_b.get_pointer(), ldb,
+                                       accessor_w.get_pointer());
+            check_info("sygvd", info);
+        });
+    });
+}
+
+void sytrd(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
+           std::int64_t lda, sycl::buffer<double> &d, sycl::buffer<double> &e,
+           sycl::buffer<double> &tau, sycl::buffer<double> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_d = d.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_e = e.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_dsytrd>(cgh, [=]() {
+            auto info = LAPACKE_dsytrd(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                       accessor_a.get_pointer(), lda, accessor_d.get_pointer(),
+                                       accessor_e.get_pointer(), accessor_tau.get_pointer());
+            check_info("sytrd", info);
+        });
+    });
+}
+
+void sytrd(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+           std::int64_t lda, sycl::buffer<float> &d, sycl::buffer<float> &e,
+           sycl::buffer<float> &tau, sycl::buffer<float> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_d = d.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_e = e.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_ssytrd>(cgh, [=]() {
+            auto info = LAPACKE_ssytrd(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                       accessor_a.get_pointer(), lda, accessor_d.get_pointer(),
+                                       accessor_e.get_pointer(), accessor_tau.get_pointer());
+            check_info("sytrd", info);
+        });
+    });
+}
+
+void sytrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+           std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, sycl::buffer<float> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_ssytrf>(cgh, [=]() {
+            auto info = LAPACKE_ssytrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                       accessor_a.get_pointer(), lda, accessor_ipiv.get_pointer());
+            check_info("sytrf", info);
+        });
+    });
+}
+
+void sytrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
+           std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, sycl::buffer<double> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_dsytrf>(cgh, [=]() {
+            auto info = LAPACKE_dsytrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                       accessor_a.get_pointer(), lda, accessor_ipiv.get_pointer());
+            check_info("sytrf", info);
+        });
+    });
+}
+
+void sytrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<std::complex<float>> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_csytrf>(cgh, [=]() {
+            auto info = LAPACKE_csytrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                       accessor_a.get_pointer(), lda, accessor_ipiv.get_pointer());
+            check_info("sytrf", info);
+        });
+    });
+}
+
+void sytrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+           sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<double>> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_zsytrf>(cgh, [=]() {
+            auto info = LAPACKE_zsytrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                       accessor_a.get_pointer(), lda, accessor_ipiv.get_pointer());
+            check_info("sytrf", info);
+        });
+    });
+}
+
+void sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+          sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+          sycl::buffer<float> &b, std::int64_t ldb, sycl::buffer<float> &scratchpad,
+          std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_ssysv>(cgh, [=]() {
+            auto info = LAPACKE_ssysv(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                      accessor_a.get_pointer(), lda, accessor_ipiv.get_pointer(),
+                                      accessor_b.get_pointer(), ldb);
+            check_info("sysv", info);
+        });
+    });
+}
+
+void sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+          sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+          sycl::buffer<double> &b, std::int64_t ldb, sycl::buffer<double> &scratchpad,
+          std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dsysv>(cgh, [=]() {
+            auto info = LAPACKE_dsysv(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                      accessor_a.get_pointer(), lda, accessor_ipiv.get_pointer(),
+                                      accessor_b.get_pointer(), ldb);
+            check_info("sysv", info);
+        });
+    });
+}
+
+void sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+          sycl::buffer<std::complex<float>> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+          sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+          sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_csysv>(cgh, [=]() {
+            auto info = LAPACKE_csysv(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                      accessor_a.get_pointer(), lda, accessor_ipiv.get_pointer(),
+                                      accessor_b.get_pointer(), ldb);
+            check_info("sysv", info);
+        });
+    });
+}
+
+void sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+          sycl::buffer<std::complex<double>> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+          sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+          sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_ipiv = ipiv.get_access<sycl::access::mode::write>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zsysv>(cgh, [=]() {
+            auto info = LAPACKE_zsysv(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs,
+                                      accessor_a.get_pointer(), lda, accessor_ipiv.get_pointer(),
+                                      accessor_b.get_pointer(), ldb);
+            check_info("sysv", info);
+        });
+    });
+}
+
+void trtrs(sycl::queue &queue, oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans,
+           oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs,
+           sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_ctrtrs>(cgh, [=]() {
+            auto info = LAPACKE_ctrtrs(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo),
+                                       convert_to_lapack_trans<std::complex<float>>(trans),
+                                       convert_to_lapack_diag(diag), n, nrhs,
+                                       accessor_a.get_pointer(), lda, accessor_b.get_pointer(),
+                                       ldb);
+            check_info("trtrs", info);
+        });
+    });
+}
+
+void trtrs(sycl::queue &queue, oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans,
+           oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a,
+           std::int64_t lda, sycl::buffer<double> &b, std::int64_t ldb,
+           sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dtrtrs>(cgh, [=]() {
+            auto info = LAPACKE_dtrtrs(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo),
+                                       convert_to_lapack_trans<double>(trans),
+                                       convert_to_lapack_diag(diag), n, nrhs,
+                                       accessor_a.get_pointer(), lda, accessor_b.get_pointer(),
+                                       ldb);
+            check_info("trtrs", info);
+        });
+    });
+}
+
+void trtrs(sycl::queue &queue, oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans,
+           oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a,
+           std::int64_t lda, sycl::buffer<float> &b, std::int64_t ldb,
+           sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_strtrs>(cgh, [=]() {
+            auto info = LAPACKE_strtrs(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo),
+                                       convert_to_lapack_trans<float>(trans),
+                                       convert_to_lapack_diag(diag), n, nrhs,
+                                       accessor_a.get_pointer(), lda, accessor_b.get_pointer(),
+                                       ldb);
+            check_info("trtrs", info);
+        });
+    });
+}
+
+void trtrs(sycl::queue &queue, oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans,
+           oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs,
+           sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_ztrtrs>(cgh, [=]() {
+            auto info = LAPACKE_ztrtrs(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo),
+                                       convert_to_lapack_trans<std::complex<double>>(trans),
+                                       convert_to_lapack_diag(diag), n, nrhs,
+                                       accessor_a.get_pointer(), lda, accessor_b.get_pointer(),
+                                       ldb);
+            check_info("trtrs", info);
+        });
+    });
+}
+
+void ungbr(sycl::queue &queue, oneapi::mkl::generate vec, std::int64_t m, std::int64_t n,
+           std::int64_t k, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<float>> &tau, sycl::buffer<std::complex<float>> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_cungbr>(cgh, [=]() {
+            auto info = LAPACKE_cungbr(LAPACK_COL_MAJOR, convert_to_lapack_generate(vec), m, n, k,
+                                       accessor_a.get_pointer(), lda, accessor_tau.get_pointer());
+            check_info("ungbr", info);
+        });
+    });
+}
+
+void ungbr(sycl::queue &queue, oneapi::mkl::generate vec, std::int64_t m, std::int64_t n,
+           std::int64_t k, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<double>> &tau, sycl::buffer<std::complex<double>> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_zungbr>(cgh, [=]() {
+            auto info = LAPACKE_zungbr(LAPACK_COL_MAJOR, convert_to_lapack_generate(vec), m, n, k,
+                                       accessor_a.get_pointer(), lda, accessor_tau.get_pointer());
+            check_info("ungbr", info);
+        });
+    });
+}
+
+void ungqr(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
+           sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<float>> &tau, sycl::buffer<std::complex<float>> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_cungqr>(cgh, [=]() {
+            auto info = tsqr::orgqr(m, n, k, accessor_a.get_pointer().get(), lda,
+                                    accessor_tau.get_pointer().get());
+            check_info("ungqr", info);
+        });
+    });
+}
+
+void ungqr(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
+           sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<double>> &tau, sycl::buffer<std::complex<double>> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_zungqr>(cgh, [=]() {
+            auto info = tsqr::orgqr(m, n, k, accessor_a.get_pointer().get(), lda,
+                                    accessor_tau.get_pointer().get());
+            check_info("ungqr", info);
+        });
+    });
+}
+
+void ungtr(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<float>> &tau, sycl::buffer<std::complex<float>> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_cungtr>(cgh, [=]() {
+            auto info = LAPACKE_cungtr(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                       accessor_a.get_pointer(), lda, accessor_tau.get_pointer());
+            check_info("ungtr", info);
+        });
+    });
+}
+
+void ungtr(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<double>> &tau, sycl::buffer<std::complex<double>> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_zungtr>(cgh, [=]() {
+            auto info = LAPACKE_zungtr(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n,
+                                       accessor_a.get_pointer(), lda, accessor_tau.get_pointer());
+            check_info("ungtr", info);
+        });
+    });
+}
+
+void unmrq(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans, std::int64_t m,
+           std::int64_t n, std::int64_t k, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<float>> &tau, sycl::buffer<std::complex<float>> &c,
+           std::int64_t ldc, sycl::buffer<std::complex<float>> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cunmrq>(cgh, [=]() {
+            auto info = LAPACKE_cunmrq(LAPACK_COL_MAJOR, convert_to_lapack_side(side),
+                                       convert_to_lapack_trans<std::complex<float>>(trans), m, n, k,
+                                       accessor_a.get_pointer(), lda, accessor_tau.get_pointer(),
+                                       accessor_c.get_pointer(), ldc);
+            check_info("unmrq", info);
+        });
+    });
+}
+
+void unmrq(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans, std::int64_t m,
+           std::int64_t n, std::int64_t k, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<double>> &tau, sycl::buffer<std::complex<double>> &c,
+           std::int64_t ldc, sycl::buffer<std::complex<double>> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zunmrq>(cgh, [=]() {
+            auto info = LAPACKE_zunmrq(LAPACK_COL_MAJOR, convert_to_lapack_side(side),
+                                       convert_to_lapack_trans<std::complex<double>>(trans), m, n,
+                                       k, accessor_a.get_pointer(), lda, accessor_tau.get_pointer(),
+                                       accessor_c.get_pointer(), ldc);
+            check_info("unmrq", info);
+        });
+    });
+}
+
+void unmqr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans, std::int64_t m,
+           std::int64_t n, std::int64_t k, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<float>> &tau, sycl::buffer<std::complex<float>> &c,
+           std::int64_t ldc, sycl::buffer<std::complex<float>> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cunmqr>(cgh, [=]() {
+            auto info = LAPACKE_cunmqr(LAPACK_COL_MAJOR, convert_to_lapack_side(side),
+                                       convert_to_lapack_trans<std::complex<float>>(trans), m, n, k,
+                                       accessor_a.get_pointer(), lda, accessor_tau.get_pointer(),
+                                       accessor_c.get_pointer(), ldc);
+            check_info("unmqr", info);
+        });
+    });
+}
+
+void unmqr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans, std::int64_t m,
+           std::int64_t n, std::int64_t k, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<double>> &tau, sycl::buffer<std::complex<double>> &c,
+           std::int64_t ldc, sycl::buffer<std::complex<double>> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zunmqr>(cgh, [=]() {
+            auto info = LAPACKE_zunmqr(LAPACK_COL_MAJOR, convert_to_lapack_side(side),
+                                       convert_to_lapack_trans<std::complex<double>>(trans), m, n,
+                                       k, accessor_a.get_pointer(), lda, accessor_tau.get_pointer(),
+                                       accessor_c.get_pointer(), ldc);
+            check_info("unmqr", info);
+        });
+    });
+}
+
+void unmtr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+           oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+           sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<float>> &tau, sycl::buffer<std::complex<float>> &c,
+           std::int64_t ldc, sycl::buffer<std::complex<float>> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cunmtr>(cgh, [=]() {
+            auto info = LAPACKE_cunmtr(LAPACK_COL_MAJOR, convert_to_lapack_side(side),
+                                       convert_to_lapack_uplo(uplo),
+                                       convert_to_lapack_trans<std::complex<float>>(trans), m, n,
+                                       accessor_a.get_pointer(), lda, accessor_tau.get_pointer(),
+                                       accessor_c.get_pointer(), ldc);
+            check_info("unmtr", info);
+        });
+    });
+}
+
+void unmtr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+           oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+           sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<double>> &tau, sycl::buffer<std::complex<double>> &c,
+           std::int64_t ldc, sycl::buffer<std::complex<double>> &scratchpad,
+           std::int64_t scratchpad_size) {
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_tau = tau.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zunmtr>(cgh, [=]() {
+            auto info = LAPACKE_zunmtr(LAPACK_COL_MAJOR, convert_to_lapack_side(side),
+                                       convert_to_lapack_uplo(uplo),
+                                       convert_to_lapack_trans<std::complex<double>>(trans), m, n,
+                                       accessor_a.get_pointer(), lda, accessor_tau.get_pointer(),
+                                       accessor_c.get_pointer(), ldc);
+            check_info("unmtr", info);
+        });
+    });
+}
+
+sycl::event gebrd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<float> *a,
+                  std::int64_t lda, float *d, float *e, std::complex<float> *tauq,
+                  std::complex<float> *taup, std::complex<float> *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgebrd_usm>(cgh, [=]() {
+            auto info = LAPACKE_cgebrd(LAPACK_COL_MAJOR, m, n, a, lda, d, e, tauq, taup);
+            check_info("gebrd", info);
+        });
+    });
+    return done;
+}
+
+sycl::event gebrd(sycl::queue &queue, std::int64_t m, std::int64_t n, double *a, std::int64_t lda,
+                  double *d, double *e, double *tauq, double *taup, double *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgebrd_usm>(cgh, [=]() {
+            auto info = LAPACKE_dgebrd(LAPACK_COL_MAJOR, m, n, a, lda, d, e, tauq, taup);
+            check_info("gebrd", info);
+        });
+    });
+    return done;
+}
+
+sycl::event gebrd(sycl::queue &queue, std::int64_t m, std::int64_t n, float *a, std::int64_t lda,
+                  float *d, float *e, float *tauq, float *taup, float *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgebrd_usm>(cgh, [=]() {
+            auto info = LAPACKE_sgebrd(LAPACK_COL_MAJOR, m, n, a, lda, d, e, tauq, taup);
+            check_info("gebrd", info);
+        });
+    });
+    return done;
+}
+
+sycl::event gebrd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<double> *a,
+                  std::int64_t lda, double *d, double *e, std::complex<double> *tauq,
+                  std::complex<double> *taup, std::complex<double> *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgebrd_usm>(cgh, [=]() {
+            auto info = LAPACKE_zgebrd(LAPACK_COL_MAJOR, m, n, a, lda, d, e, tauq, taup);
+            check_info("gebrd", info);
+        });
+    });
+    return done;
+}
+
+sycl::event gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                 std::int64_t nrhs, float *a, std::int64_t lda, float *b, std::int64_t ldb,
+                 float *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgels_usm>(cgh, [=]() {
+            auto info = LAPACKE_sgels(LAPACK_COL_MAJOR, convert_to_lapack_trans<float>(trans), m, n,
+                                      nrhs, a, lda, b, ldb);
+            check_info("gels", info);
+        });
+    });
+    return done;
+}
+
+sycl::event gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                 std::int64_t nrhs, double *a, std::int64_t lda, double *b, std::int64_t ldb,
+                 double *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgels_usm>(cgh, [=]() {
+            auto info = LAPACKE_dgels(LAPACK_COL_MAJOR, convert_to_lapack_trans<double>(trans), m,
+                                      n, nrhs, a, lda, b, ldb);
+            check_info("gels", info);
+        });
+    });
+    return done;
+}
+
+sycl::event gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                 std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                 std::complex<float> *b, std::int64_t ldb, std::complex<float> *scratchpad,
+                 std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgels_usm>(cgh, [=]() {
+            auto info = LAPACKE_cgels(LAPACK_COL_MAJOR,
+                                      convert_to_lapack_trans<std::complex<float>>(trans), m, n,
+                                      nrhs, a, lda, b, ldb);
+            check_info("gels", info);
+        });
+    });
+    return done;
+}
+
+sycl::event gels(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                 std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                 std::complex<double> *b, std::int64_t ldb, std::complex<double> *scratchpad,
+                 std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgels_usm>(cgh, [=]() {
+            auto info = LAPACKE_zgels(LAPACK_COL_MAJOR,
+                                      convert_to_lapack_trans<std::complex<double>>(trans), m, n,
+                                      nrhs, a, lda, b, ldb);
+            check_info("gels", info);
+        });
+    });
+    return done;
+}
+
+sycl::event gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs, float *a,
+                  std::int64_t lda, float *b, std::int64_t ldb, float *s, float rcond,
+                  std::int64_t *rank, float *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgelsd_usm>(cgh, [=]() {
+            auto info = LAPACKE_sgelsd(LAPACK_COL_MAJOR, m, n, nrhs, a, lda, b, ldb, s, rcond,
+                                       rank);
+            check_info("gelsd", info);
+        });
+    });
+    return done;
+}
+
+sycl::event gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs, double *a,
+                  std::int64_t lda, double *b, std::int64_t ldb, double *s, double rcond,
+                  std::int64_t *rank, double *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgelsd_usm>(cgh, [=]() {
+            auto info = LAPACKE_dgelsd(LAPACK_COL_MAJOR, m, n, nrhs, a, lda, b, ldb, s, rcond,
+                                       rank);
+            check_info("gelsd", info);
+        });
+    });
+    return done;
+}
+
+sycl::event gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                  std::complex<float> *a, std::int64_t lda, std::complex<float> *b,
+                  std::int64_t ldb, float *s, float rcond, std::int64_t *rank,
+                  std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgelsd_usm>(cgh, [=]() {
+            auto info = LAPACKE_cgelsd(LAPACK_COL_MAJOR, m, n, nrhs, a, lda, b, ldb, s, rcond,
+                                       rank);
+            check_info("gelsd", info);
+        });
+    });
+    return done;
+}
+
+sycl::event gelsd(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                  std::complex<double> *a, std::int64_t lda, std::complex<double> *b,
+                  std::int64_t ldb, double *s, double rcond, std::int64_t *rank,
+                  std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgelsd_usm>(cgh, [=]() {
+            auto info = LAPACKE_zgelsd(LAPACK_COL_MAJOR, m, n, nrhs, a, lda, b, ldb, s, rcond,
+                                       rank);
+            check_info("gelsd", info);
+        });
+    });
+    return done;
+}
+
+sycl::event gerqf(sycl::queue &queue, std::int64_t m, std::int64_t n, float *a, std::int64_t lda,
+                  float *tau, float *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgerqf_usm>(cgh, [=]() {
+            auto info = LAPACKE_sgerqf(LAPACK_COL_MAJOR, m, n, a, lda, tau);
+            check_info("gerqf", info);
+        });
+    });
+    return done;
+}
+
+sycl::event gerqf(sycl::queue &queue, std::int64_t m, std::int64_t n, double *a, std::int64_t lda,
+                  double *tau, double *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgerqf_usm>(cgh, [=]() {
+            auto info = LAPACKE_dgerqf(LAPACK_COL_MAJOR, m, n, a, lda, tau);
+            check_info("gerqf", info);
+        });
+    });
+    return done;
+}
+
+sycl::event gerqf(sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<float> *a,
+                  std::int64_t lda, std::complex<float> *tau, std::complex<float> *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgerqf_usm>(cgh, [=]() {
+            auto info = LAPACKE_cgerqf(LAPACK_COL_MAJOR, m, n, a, lda, tau);
+            check_info("gerqf", info);
+        });
+    });
+    return done;
+}
+
+sycl::event gerqf(sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<double> *a,
+                  std::int64_t lda, std::complex<double> *tau, std::complex<double> *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgerqf_usm>(cgh, [=]() {
+            auto info = LAPACKE_zgerqf(LAPACK_COL_MAJOR, m, n, a, lda, tau);
+            check_info("gerqf", info);
+        });
+    });
+    return done;
+}
+
+sycl::event geqrf(sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<float> *a,
+                  std::int64_t lda, std::complex<float> *tau, std::complex<float> *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgeqrf_usm>(cgh, [=]() {
+            auto info = tsqr::geqrf(m, n, a, lda, tau);
+            check_info("geqrf", info);
+        });
+    });
+    return done;
+}
+
+sycl::event geqrf(sycl::queue &queue, std::int64_t m, std::int64_t n, double *a, std::int64_t lda,
+                  double *tau, double *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgeqrf_usm>(cgh, [=]() {
+            auto info = tsqr::geqrf(m, n, a, lda, tau);
+            check_info("geqrf", info);
+        });
+    });
+    return done;
+}
+
+sycl::event geqrf(sycl::queue &queue, std::int64_t m, std::int64_t n, float *a, std::int64_t lda,
+                  float *tau, float *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgeqrf_usm>(cgh, [=]() {
+            auto info = tsqr::geqrf(m, n, a, lda, tau);
+            check_info("geqrf", info);
+        });
+    });
+    return done;
+}
+
+sycl::event geqrf(sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<double> *a,
+                  std::int64_t lda, std::complex<double> *tau, std::complex<double> *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgeqrf_usm>(cgh, [=]() {
+            auto info = tsqr::geqrf(m, n, a, lda, tau);
+            check_info("geqrf", info);
+        });
+    });
+    return done;
+}
+
+sycl::event getrf(sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<float> *a,
+                  std::int64_t lda, std::int64_t *ipiv, std::complex<float> *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgetrf_usm>(cgh, [=]() {
+            auto info = LAPACKE_cgetrf(LAPACK_COL_MAJOR, m, n, a, lda, ipiv);
+            check_info("getrf", info);
+        });
+    });
+    return done;
+}
+
+sycl::event getrf(sycl::queue &queue, std::int64_t m, std::int64_t n, double *a, std::int64_t lda,
+                  std::int64_t *ipiv, double *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgetrf_usm>(cgh, [=]() {
+            auto info = LAPACKE_dgetrf(LAPACK_COL_MAJOR, m, n, a, lda, ipiv);
+            check_info("getrf", info);
+        });
+    });
+    return done;
+}
+
+sycl::event getrf(sycl::queue &queue, std::int64_t m, std::int64_t n, float *a, std::int64_t lda,
+                  std::int64_t *ipiv, float *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgetrf_usm>(cgh, [=]() {
+            auto info = LAPACKE_sgetrf(LAPACK_COL_MAJOR, m, n, a, lda, ipiv);
+            check_info("getrf", info);
+        });
+    });
+    return done;
+}
+
+sycl::event getrf(sycl::queue &queue, std::int64_t m, std::int64_t n, std::complex<double> *a,
+                  std::int64_t lda, std::int64_t *ipiv, std::complex<double> *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgetrf_usm>(cgh, [=]() {
+            auto info = LAPACKE_zgetrf(LAPACK_COL_MAJOR, m, n, a, lda, ipiv);
+            check_info("getrf", info);
+        });
+    });
+    return done;
+}
+
+sycl::event getri(sycl::queue &queue, std::int64_t n, std::complex<float> *a, std::int64_t lda,
+                  std::int64_t *ipiv, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgetri_usm>(cgh, [=]() {
+            auto info = LAPACKE_cgetri(LAPACK_COL_MAJOR, n, a, lda, ipiv);
+            check_info("getri", info);
+        });
+    });
+    return done;
+}
+
+sycl::event getri(sycl::queue &queue, std::int64_t n, double *a, std::int64_t lda,
+                  std::int64_t *ipiv, double *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgetri_usm>(cgh, [=]() {
+            auto info = LAPACKE_dgetri(LAPACK_COL_MAJOR, n, a, lda, ipiv);
+            check_info("getri", info);
+        });
+    });
+    return done;
+}
+
+sycl::event getri(sycl::queue &queue, std::int64_t n, float *a, std::int64_t lda,
+                  std::int64_t *ipiv, float *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgetri_usm>(cgh, [=]() {
+            auto info = LAPACKE_sgetri(LAPACK_COL_MAJOR, n, a, lda, ipiv);
+            check_info("getri", info);
+        });
+    });
+    return done;
+}
+
+sycl::event getri(sycl::queue &queue, std::int64_t n, std::complex<double> *a, std::int64_t lda,
+                  std::int64_t *ipiv, std::complex<double> *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgetri_usm>(cgh, [=]() {
+            auto info = LAPACKE_zgetri(LAPACK_COL_MAJOR, n, a, lda, ipiv);
+            check_info("getri", info);
+        });
+    });
+    return done;
+}
+
+sycl::event getrs(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                  std::int64_t nrhs, std::complex<float> *a, std::int64_t lda, std::int64_t *ipiv,
+                  std::complex<float> *b, std::int64_t ldb, std::complex<float> *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgetrs_usm>(cgh, [=]() {
+            auto info = LAPACKE_cgetrs(LAPACK_COL_MAJOR,
+                                       convert_to_lapack_trans<std::complex<float>>(trans), n, nrhs,
+                                       a, lda, ipiv, b, ldb);
+            check_info("getrs", info);
+        });
+    });
+    return done;
+}
+
+sycl::event getrs(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                  std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t *ipiv, double *b,
+                  std::int64_t ldb, double *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgetrs_usm>(cgh, [=]() {
+            auto info = LAPACKE_dgetrs(LAPACK_COL_MAJOR, convert_to_lapack_trans<double>(trans), n,
+                                       nrhs, a, lda, ipiv, b, ldb);
+            check_info("getrs", info);
+        });
+    });
+    return done;
+}
+
+sycl::event getrs(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                  std::int64_t nrhs, float *a, std::int64_t lda, std::int64_t *ipiv, float *b,
+                  std::int64_t ldb, float *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgetrs_usm>(cgh, [=]() {
+            auto info = LAPACKE_sgetrs(LAPACK_COL_MAJOR, convert_to_lapack_trans<float>(trans), n,
+                                       nrhs, a, lda, ipiv, b, ldb);
+            check_info("getrs", info);
+        });
+    });
+    return done;
+}
+
+sycl::event getrs(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
+                  std::int64_t nrhs, std::complex<double> *a, std::int64_t lda, std::int64_t *ipiv,
+                  std::complex<double> *b, std::int64_t ldb, std::complex<double> *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgetrs_usm>(cgh, [=]() {
+            auto info = LAPACKE_zgetrs(LAPACK_COL_MAJOR,
+                                       convert_to_lapack_trans<std::complex<double>>(trans), n,
+                                       nrhs, a, lda, ipiv, b, ldb);
+            check_info("getrs", info);
+        });
+    });
+    return done;
+}
+
+sycl::event gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, float *a, std::int64_t lda,
+                 std::int64_t *ipiv, float *b, std::int64_t ldb, float *scratchpad,
+                 std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgesv_usm>(cgh, [=]() {
+            auto info = LAPACKE_sgesv(LAPACK_COL_MAJOR, n, nrhs, a, lda, ipiv, b, ldb);
+            check_info("gesv", info);
+        });
+    });
+    return done;
+}
+
+sycl::event gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda,
+                 std::int64_t *ipiv, double *b, std::int64_t ldb, double *scratchpad,
+                 std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgesv_usm>(cgh, [=]() {
+            auto info = LAPACKE_dgesv(LAPACK_COL_MAJOR, n, nrhs, a, lda, ipiv, b, ldb);
+            check_info("gesv", info);
+        });
+    });
+    return done;
+}
+
+sycl::event gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::complex<float> *a,
+                 std::int64_t lda, std::int64_t *ipiv, std::complex<float> *b, std::int64_t ldb,
+                 std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgesv_usm>(cgh, [=]() {
+            auto info = LAPACKE_cgesv(LAPACK_COL_MAJOR, n, nrhs, a, lda, ipiv, b, ldb);
+            check_info("gesv", info);
+        });
+    });
+    return done;
+}
+
+sycl::event gesv(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::complex<double> *a,
+                 std::int64_t lda, std::int64_t *ipiv, std::complex<double> *b, std::int64_t ldb,
+                 std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgesv_usm>(cgh, [=]() {
+            auto info = LAPACKE_zgesv(LAPACK_COL_MAJOR, n, nrhs, a, lda, ipiv, b, ldb);
+            check_info("gesv", info);
+        });
+    });
+    return done;
+}
+
+sycl::event gesvd(sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt,
+                  std::int64_t m, std::int64_t n, double *a, std::int64_t lda, double *s, double *u,
+                  std::int64_t ldu, double *vt, std::int64_t ldvt, double *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgesvd_usm>(cgh, [=]() {
+            std::vector<double> superb(std::max<std::int64_t>(1, std::min(m, n) - 1));
+            auto info = LAPACKE_dgesvd(LAPACK_COL_MAJOR, convert_to_lapack_jobsvd(jobu),
+                                       convert_to_lapack_jobsvd(jobvt), m, n, a, lda, s, u, ldu, vt,
+                                       ldvt, superb.data());
+            check_info("gesvd", info);
+        });
+    });
+    return done;
+}
+
+sycl::event gesvd(sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt,
+                  std::int64_t m, std::int64_t n, float *a, std::int64_t lda, float *s, float *u,
+                  std::int64_t ldu, float *vt, std::int64_t ldvt, float *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgesvd_usm>(cgh, [=]() {
+            std::vector<float> superb(std::max<std::int64_t>(1, std::min(m, n) - 1));
+            auto info = LAPACKE_sgesvd(LAPACK_COL_MAJOR, convert_to_lapack_jobsvd(jobu),
+                                       convert_to_lapack_jobsvd(jobvt), m, n, a, lda, s, u, ldu, vt,
+                                       ldvt, superb.data());
+            check_info("gesvd", info);
+        });
+    });
+    return done;
+}
+
+sycl::event gesvd(sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt,
+                  std::int64_t m, std::int64_t n, std::complex<float> *a, std::int64_t lda,
+                  float *s, std::complex<float> *u, std::int64_t ldu, std::complex<float> *vt,
+                  std::int64_t ldvt, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgesvd_usm>(cgh, [=]() {
+            std::vector<float> superb(std::max<std::int64_t>(1, std::min(m, n) - 1));
+            auto info = LAPACKE_cgesvd(LAPACK_COL_MAJOR, convert_to_lapack_jobsvd(jobu),
+                                       convert_to_lapack_jobsvd(jobvt), m, n, a, lda, s, u, ldu, vt,
+                                       ldvt, superb.data());
+            check_info("gesvd", info);
+        });
+    });
+    return done;
+}
+
+sycl::event gesvd(sycl::queue &queue, oneapi::mkl::jobsvd jobu, oneapi::mkl::jobsvd jobvt,
+                  std::int64_t m, std::int64_t n, std::complex<double> *a, std::int64_t lda,
+                  double *s, std::complex<double> *u, std::int64_t ldu, std::complex<double> *vt,
+                  std::int64_t ldvt, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgesvd_usm>(cgh, [=]() {
+            std::vector<double> superb(std::max<std::int64_t>(1, std::min(m, n) - 1));
+            auto info = LAPACKE_zgesvd(LAPACK_COL_MAJOR, convert_to_lapack_jobsvd(jobu),
+                                       convert_to_lapack_jobsvd(jobvt), m, n, a, lda, s, u, ldu, vt,
+                                       ldvt, superb.data());
+            check_info("gesvd", info);
+        });
+    });
+    return done;
+}
+
+sycl::event heevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                  std::complex<float> *a, std::int64_t lda, float *w,
+                  std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cheevd_usm>(cgh, [=]() {
+            auto info = LAPACKE_cheevd(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_uplo(uplo), n, a, lda, w);
+            check_info("heevd", info);
+        });
+    });
+    return done;
+}
+
+sycl::event heevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                  std::complex<double> *a, std::int64_t lda, double *w,
+                  std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zheevd_usm>(cgh, [=]() {
+            auto info = LAPACKE_zheevd(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_uplo(uplo), n, a, lda, w);
+            check_info("heevd", info);
+        });
+    });
+    return done;
+}
+
+sycl::event heevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a, std::int64_t lda,
+                  float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+                  std::int64_t *m, float *w, std::complex<float> *z, std::int64_t ldz,
+                  std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cheevr_usm>(cgh, [=]() {
+            std::vector<lapack_int> isuppz(2 * std::max<std::int64_t>(1, n));
+            auto info = LAPACKE_cheevr(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, a, lda, vl, vu, il, iu,
+                                       abstol, m, w, z, ldz, isuppz.data());
+            check_info("heevr", info);
+        });
+    });
+    return done;
+}
+
+sycl::event heevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a, std::int64_t lda,
+                  double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+                  std::int64_t *m, double *w, std::complex<double> *z, std::int64_t ldz,
+                  std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zheevr_usm>(cgh, [=]() {
+            std::vector<lapack_int> isuppz(2 * std::max<std::int64_t>(1, n));
+            auto info = LAPACKE_zheevr(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, a, lda, vl, vu, il, iu,
+                                       abstol, m, w, z, ldz, isuppz.data());
+            check_info("heevr", info);
+        });
+    });
+    return done;
+}
+
+sycl::event heevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a, std::int64_t lda,
+                  float vl, float vu, std::int64_t il, std::int64_t iu, float abstol,
+                  std::int64_t *m, float *w, std::complex<float> *z, std::int64_t ldz,
+                  std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cheevx_usm>(cgh, [=]() {
+            std::vector<lapack_int> ifail(std::max<std::int64_t>(1, n));
+            auto info = LAPACKE_cheevx(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, a, lda, vl, vu, il, iu,
+                                       abstol, m, w, z, ldz, ifail.data());
+            check_info("heevx", info);
+        });
+    });
+    return done;
+}
+
+sycl::event heevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a, std::int64_t lda,
+                  double vl, double vu, std::int64_t il, std::int64_t iu, double abstol,
+                  std::int64_t *m, double *w, std::complex<double> *z, std::int64_t ldz,
+                  std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zheevx_usm>(cgh, [=]() {
+            std::vector<lapack_int> ifail(std::max<std::int64_t>(1, n));
+            auto info = LAPACKE_zheevx(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, a, lda, vl, vu, il, iu,
+                                       abstol, m, w, z, ldz, ifail.data());
+            check_info("heevx", info);
+        });
+    });
+    return done;
+}
+
+sycl::event hegvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
+                  oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a, std::int64_t lda,
+                  std::complex<float> *b, std::int64_t ldb, float *w,
+                  std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_chegvd_usm>(cgh, [=]() {
+            auto info = LAPACKE_chegvd(LAPACK_COL_MAJOR, itype, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_uplo(uplo), n, a, lda, b, ldb, w);
+            check_info("hegvd", info);
+        });
+    });
+    return done;
+}
+
+sycl::event hegvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
+                  oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a, std::int64_t lda,
+                  std::complex<double> *b, std::int64_t ldb, double *w,
+                  std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zhegvd_usm>(cgh, [=]() {
+            auto info = LAPACKE_zhegvd(LAPACK_COL_MAJOR, itype, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_uplo(uplo), n, a, lda, b, ldb, w);
+            check_info("hegvd", info);
+        });
+    });
+    return done;
+}
+
+sycl::event hetrd(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                  std::complex<float> *a, std::int64_t lda, float *d, float *e,
+                  std::complex<float> *tau, std::complex<float> *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_chetrd_usm>(cgh, [=]() {
+            auto info = LAPACKE_chetrd(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, a, lda, d,
+                                       e, tau);
+            check_info("hetrd", info);
+        });
+    });
+    return done;
+}
+
+sycl::event hetrd(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                  std::complex<double> *a, std::int64_t lda, double *d, double *e,
+                  std::complex<double> *tau, std::complex<double> *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zhetrd_usm>(cgh, [=]() {
+            auto info = LAPACKE_zhetrd(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, a, lda, d,
+                                       e, tau);
+            check_info("hetrd", info);
+        });
+    });
+    return done;
+}
+
+sycl::event hetrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                  std::complex<float> *a, std::int64_t lda, std::int64_t *ipiv,
+                  std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_chetrf_usm>(cgh, [=]() {
+            auto info = LAPACKE_chetrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, a, lda,
+                                       ipiv);
+            check_info("hetrf", info);
+        });
+    });
+    return done;
+}
+
+sycl::event hetrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                  std::complex<double> *a, std::int64_t lda, std::int64_t *ipiv,
+                  std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zhetrf_usm>(cgh, [=]() {
+            auto info = LAPACKE_zhetrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, a, lda,
+                                       ipiv);
+            check_info("hetrf", info);
+        });
+    });
+    return done;
+}
+
+sycl::event orgbr(sycl::queue &queue, oneapi::mkl::generate vec, std::int64_t m, std::int64_t n,
+                  std::int64_t k, float *a, std::int64_t lda, float *tau, float *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sorgbr_usm>(cgh, [=]() {
+            auto info = LAPACKE_sorgbr(LAPACK_COL_MAJOR, convert_to_lapack_generate(vec), m, n, k,
+                                       a, lda, tau);
+            check_info("orgbr", info);
+        });
+    });
+    return done;
+}
+
+sycl::event orgbr(sycl::queue &queue, oneapi::mkl::generate vec, std::int64_t m, std::int64_t n,
+                  std::int64_t k, double *a, std::int64_t lda, double *tau, double *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dorgbr_usm>(cgh, [=]() {
+            auto info = LAPACKE_dorgbr(LAPACK_COL_MAJOR, convert_to_lapack_generate(vec), m, n, k,
+                                       a, lda, tau);
+            check_info("orgbr", info);
+        });
+    });
+    return done;
+}
+
+sycl::event orgqr(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k, double *a,
+                  std::int64_t lda, double *tau, double *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dorgqr_usm>(cgh, [=]() {
+            auto info = tsqr::orgqr(m, n, k, a, lda, tau);
+            check_info("orgqr", info);
+        });
+    });
+    return done;
+}
+
+sycl::event orgqr(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k, float *a,
+                  std::int64_t lda, float *tau, float *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sorgqr_usm>(cgh, [=]() {
+            auto info = tsqr::orgqr(m, n, k, a, lda, tau);
+            check_info("orgqr", info);
+        });
+    });
+    return done;
+}
+
+sycl::event orgtr(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, float *a,
+                  std::int64_t lda, float *tau, float *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sorgtr_usm>(cgh, [=]() {
+            auto info = LAPACKE_sorgtr(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, a, lda,
+                                       tau);
+            check_info("orgtr", info);
+        });
+    });
+    return done;
+}
+
+sycl::event orgtr(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, double *a,
+                  std::int64_t lda, double *tau, double *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dorgtr_usm>(cgh, [=]() {
+            auto info = LAPACKE_dorgtr(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, a, lda,
+                                       tau);
+            check_info("orgtr", info);
+        });
+    });
+    return done;
+}
+
+sycl::event ormtr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+                  oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, float *a,
+                  std::int64_t lda, float *tau, float *c, std::int64_t ldc, float *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sormtr_usm>(cgh, [=]() {
+            auto info = LAPACKE_sormtr(LAPACK_COL_MAJOR, convert_to_lapack_side(side),
+                                       convert_to_lapack_uplo(uplo),
+                                       convert_to_lapack_trans<float>(trans), m, n, a, lda, tau, c,
+                                       ldc);
+            check_info("ormtr", info);
+        });
+    });
+    return done;
+}
+
+sycl::event ormtr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+                  oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, double *a,
+                  std::int64_t lda, double *tau, double *c, std::int64_t ldc, double *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dormtr_usm>(cgh, [=]() {
+            auto info = LAPACKE_dormtr(LAPACK_COL_MAJOR, convert_to_lapack_side(side),
+                                       convert_to_lapack_uplo(uplo),
+                                       convert_to_lapack_trans<double>(trans), m, n, a, lda, tau, c,
+                                       ldc);
+            check_info("ormtr", info);
+        });
+    });
+    return done;
+}
+
+sycl::event ormrq(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+                  std::int64_t m, std::int64_t n, std::int64_t k, float *a, std::int64_t lda,
+                  float *tau, float *c, std::int64_t ldc, float *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sormrq_usm>(cgh, [=]() {
+            auto info = LAPACKE_sormrq(LAPACK_COL_MAJOR, convert_to_lapack_side(side),
+                                       convert_to_lapack_trans<float>(trans), m, n, k, a, lda, tau,
+                                       c, ldc);
+            check_info("ormrq", info);
+        });
+    });
+    return done;
+}
+
+sycl::event ormrq(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+                  std::int64_t m, std::int64_t n, std::int64_t k, double *a, std::int64_t lda,
+                  double *tau, double *c, std::int64_t ldc, double *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dormrq_usm>(cgh, [=]() {
+            auto info = LAPACKE_dormrq(LAPACK_COL_MAJOR, convert_to_lapack_side(side),
+                                       convert_to_lapack_trans<double>(trans), m, n, k, a, lda, tau,
+                                       c, ldc);
+            check_info("ormrq", info);
+        });
+    });
+    return done;
+}
+
+sycl::event ormqr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+                  std::int64_t m, std::int64_t n, std::int64_t k, double *a, std::int64_t lda,
+                  double *tau, double *c, std::int64_t ldc, double *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dormqr_usm>(cgh, [=]() {
+            auto info = LAPACKE_dormqr(LAPACK_COL_MAJOR, convert_to_lapack_side(side),
+                                       convert_to_lapack_trans<double>(trans), m, n, k, a, lda, tau,
+                                       c, ldc);
+            check_info("ormqr", info);
+        });
+    });
+    return done;
+}
+
+sycl::event ormqr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+                  std::int64_t m, std::int64_t n, std::int64_t k, float *a, std::int64_t lda,
+                  float *tau, float *c, std::int64_t ldc, float *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sormqr_usm>(cgh, [=]() {
+            auto info = LAPACKE_sormqr(LAPACK_COL_MAJOR, convert_to_lapack_side(side),
+                                       convert_to_lapack_trans<float>(trans), m, n, k, a, lda, tau,
+                                       c, ldc);
+            check_info("ormqr", info);
+        });
+    });
+    return done;
+}
+
+sycl::event potrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, float *a,
+                  std::int64_t lda, float *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_spotrf_usm>(cgh, [=]() {
+            auto info = LAPACKE_spotrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, a, lda);
+            check_info("potrf", info);
+        });
+    });
+    return done;
+}
+
+sycl::event potrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, double *a,
+                  std::int64_t lda, double *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dpotrf_usm>(cgh, [=]() {
+            auto info = LAPACKE_dpotrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, a, lda);
+            check_info("potrf", info);
+        });
+    });
+    return done;
+}
+
+sycl::event potrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                  std::complex<float> *a, std::int64_t lda, std::complex<float> *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cpotrf_usm>(cgh, [=]() {
+            auto info = LAPACKE_cpotrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, a, lda);
+            check_info("potrf", info);
+        });
+    });
+    return done;
+}
+
+sycl::event potrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                  std::complex<double> *a, std::int64_t lda, std::complex<double> *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zpotrf_usm>(cgh, [=]() {
+            auto info = LAPACKE_zpotrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, a, lda);
+            check_info("potrf", info);
+        });
+    });
+    return done;
+}
+
+sycl::event potri(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, float *a,
+                  std::int64_t lda, float *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_spotri_usm>(cgh, [=]() {
+            auto info = LAPACKE_spotri(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, a, lda);
+            check_info("potri", info);
+        });
+    });
+    return done;
+}
+
+sycl::event potri(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, double *a,
+                  std::int64_t lda, double *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dpotri_usm>(cgh, [=]() {
+            auto info = LAPACKE_dpotri(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, a, lda);
+            check_info("potri", info);
+        });
+    });
+    return done;
+}
+
+sycl::event potri(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                  std::complex<float> *a, std::int64_t lda, std::complex<float> *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cpotri_usm>(cgh, [=]() {
+            auto info = LAPACKE_cpotri(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, a, lda);
+            check_info("potri", info);
+        });
+    });
+    return done;
+}
+
+sycl::event potri(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                  std::complex<double> *a, std::int64_t lda, std::complex<double> *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zpotri_usm>(cgh, [=]() {
+            auto info = LAPACKE_zpotri(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, a, lda);
+            check_info("potri", info);
+        });
+    });
+    return done;
+}
+
+sycl::event potrs(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                  float *a, std::int64_t lda, float *b, std::int64_t ldb, float *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_spotrs_usm>(cgh, [=]() {
+            auto info = LAPACKE_spotrs(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs, a,
+                                       lda, b, ldb);
+            check_info("potrs", info);
+        });
+    });
+    return done;
+}
+
+sycl::event potrs(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                  double *a, std::int64_t lda, double *b, std::int64_t ldb, double *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dpotrs_usm>(cgh, [=]() {
+            auto info = LAPACKE_dpotrs(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs, a,
+                                       lda, b, ldb);
+            check_info("potrs", info);
+        });
+    });
+    return done;
+}
+
+sycl::event potrs(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                  std::complex<float> *a, std::int64_t lda, std::complex<float> *b,
+                  std::int64_t ldb, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cpotrs_usm>(cgh, [=]() {
+            auto info = LAPACKE_cpotrs(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs, a,
+                                       lda, b, ldb);
+            check_info("potrs", info);
+        });
+    });
+    return done;
+}
+
+sycl::event potrs(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                  std::complex<double> *a, std::int64_t lda, std::complex<double> *b,
+                  std::int64_t ldb, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zpotrs_usm>(cgh, [=]() {
+            auto info = LAPACKE_zpotrs(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs, a,
+                                       lda, b, ldb);
+            check_info("potrs", info);
+        });
+    });
+    return done;
+}
+
+sycl::event posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                 float *a, std::int64_t lda, float *b, std::int64_t ldb, float *scratchpad,
+                 std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sposv_usm>(cgh, [=]() {
+            auto info = LAPACKE_sposv(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs, a,
+                                      lda, b, ldb);
+            check_info("posv", info);
+        });
+    });
+    return done;
+}
+
+sycl::event posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                 double *a, std::int64_t lda, double *b, std::int64_t ldb, double *scratchpad,
+                 std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dposv_usm>(cgh, [=]() {
+            auto info = LAPACKE_dposv(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs, a,
+                                      lda, b, ldb);
+            check_info("posv", info);
+        });
+    });
+    return done;
+}
+
+sycl::event posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                 std::complex<float> *a, std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
+                 std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cposv_usm>(cgh, [=]() {
+            auto info = LAPACKE_cposv(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs, a,
+                                      lda, b, ldb);
+            check_info("posv", info);
+        });
+    });
+    return done;
+}
+
+sycl::event posv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                 std::complex<double> *a, std::int64_t lda, std::complex<double> *b,
+                 std::int64_t ldb, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zposv_usm>(cgh, [=]() {
+            auto info = LAPACKE_zposv(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs, a,
+                                      lda, b, ldb);
+            check_info("posv", info);
+        });
+    });
+    return done;
+}
+
+sycl::event syevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                  double *a, std::int64_t lda, double *w, double *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dsyevd_usm>(cgh, [=]() {
+            auto info = LAPACKE_dsyevd(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_uplo(uplo), n, a, lda, w);
+            check_info("syevd", info);
+        });
+    });
+    return done;
+}
+
+sycl::event syevd(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+                  float *a, std::int64_t lda, float *w, float *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ssyevd_usm>(cgh, [=]() {
+            auto info = LAPACKE_ssyevd(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_uplo(uplo), n, a, lda, w);
+            check_info("syevd", info);
+        });
+    });
+    return done;
+}
+
+sycl::event syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda, float vl,
+                  float vu, std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m,
+                  float *w, float *z, std::int64_t ldz, float *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ssyevr_usm>(cgh, [=]() {
+            std::vector<lapack_int> isuppz(2 * std::max<std::int64_t>(1, n));
+            auto info = LAPACKE_ssyevr(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, a, lda, vl, vu, il, iu,
+                                       abstol, m, w, z, ldz, isuppz.data());
+            check_info("syevr", info);
+        });
+    });
+    return done;
+}
+
+sycl::event syevr(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda, double vl,
+                  double vu, std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+                  double *w, double *z, std::int64_t ldz, double *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dsyevr_usm>(cgh, [=]() {
+            std::vector<lapack_int> isuppz(2 * std::max<std::int64_t>(1, n));
+            auto info = LAPACKE_dsyevr(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, a, lda, vl, vu, il, iu,
+                                       abstol, m, w, z, ldz, isuppz.data());
+            check_info("syevr", info);
+        });
+    });
+    return done;
+}
+
+sycl::event syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda, float vl,
+                  float vu, std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m,
+                  float *w, float *z, std::int64_t ldz, float *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ssyevx_usm>(cgh, [=]() {
+            std::vector<lapack_int> ifail(std::max<std::int64_t>(1, n));
+            auto info = LAPACKE_ssyevx(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, a, lda, vl, vu, il, iu,
+                                       abstol, m, w, z, ldz, ifail.data());
+            check_info("syevx", info);
+        });
+    });
+    return done;
+}
+
+sycl::event syevx(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                  oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda, double vl,
+                  double vu, std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+                  double *w, double *z, std::int64_t ldz, double *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dsyevx_usm>(cgh, [=]() {
+            std::vector<lapack_int> ifail(std::max<std::int64_t>(1, n));
+            auto info = LAPACKE_dsyevx(LAPACK_COL_MAJOR, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_rangev(range),
+                                       convert_to_lapack_uplo(uplo), n, a, lda, vl, vu, il, iu,
+                                       abstol, m, w, z, ldz, ifail.data());
+            check_info("syevx", info);
+        });
+    });
+    return done;
+}
+
+sycl::event sygvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
+                  oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda, double *b,
+                  std::int64_t ldb, double *w, double *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dsygvd_usm>(cgh, [=]() {
+            auto info = LAPACKE_dsygvd(LAPACK_COL_MAJOR, itype, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_uplo(uplo), n, a, lda, b, ldb, w);
+            check_info("sygvd", info);
+        });
+    });
+    return done;
+}
+
+sycl::event sygvd(sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
+                  oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda, float *b,
+                  std::int64_t ldb, float *w, float *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ssygvd_usm>(cgh, [=]() {
+            auto info = LAPACKE_ssygvd(LAPACK_COL_MAJOR, itype, convert_to_lapack_job(jobz),
+                                       convert_to_lapack_uplo(uplo), n, a, lda, b, ldb, w);
+            check_info("sygvd", info);
+        });
+    });
+    return done;
+}
+
+sycl::event sytrd(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, double *a,
+                  std::int64_t lda, double *d, double *e, double *tau, double *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dsytrd_usm>(cgh, [=]() {
+            auto info = LAPACKE_dsytrd(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, a, lda, d,
+                                       e, tau);
+            check_info("sytrd", info);
+        });
+    });
+    return done;
+}
+
+sycl::event sytrd(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, float *a,
+                  std::int64_t lda, float *d, float *e, float *tau, float *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ssytrd_usm>(cgh, [=]() {
+            auto info = LAPACKE_ssytrd(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, a, lda, d,
+                                       e, tau);
+            check_info("sytrd", info);
+        });
+    });
+    return done;
+}
+
+sycl::event sytrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, float *a,
+                  std::int64_t lda, std::int64_t *ipiv, float *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ssytrf_usm>(cgh, [=]() {
+            auto info = LAPACKE_ssytrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, a, lda,
+                                       ipiv);
+            check_info("sytrf", info);
+        });
+    });
+    return done;
+}
+
+sycl::event sytrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, double *a,
+                  std::int64_t lda, std::int64_t *ipiv, double *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dsytrf_usm>(cgh, [=]() {
+            auto info = LAPACKE_dsytrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, a, lda,
+                                       ipiv);
+            check_info("sytrf", info);
+        });
+    });
+    return done;
+}
+
+sycl::event sytrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                  std::complex<float> *a, std::int64_t lda, std::int64_t *ipiv,
+                  std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_csytrf_usm>(cgh, [=]() {
+            auto info = LAPACKE_csytrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, a, lda,
+                                       ipiv);
+            check_info("sytrf", info);
+        });
+    });
+    return done;
+}
+
+sycl::event sytrf(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                  std::complex<double> *a, std::int64_t lda, std::int64_t *ipiv,
+                  std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zsytrf_usm>(cgh, [=]() {
+            auto info = LAPACKE_zsytrf(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, a, lda,
+                                       ipiv);
+            check_info("sytrf", info);
+        });
+    });
+    return done;
+}
+
+sycl::event sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                 float *a, std::int64_t lda, std::int64_t *ipiv, float *b, std::int64_t ldb,
+                 float *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ssysv_usm>(cgh, [=]() {
+            auto info = LAPACKE_ssysv(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs, a,
+                                      lda, ipiv, b, ldb);
+            check_info("sysv", info);
+        });
+    });
+    return done;
+}
+
+sycl::event sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                 double *a, std::int64_t lda, std::int64_t *ipiv, double *b, std::int64_t ldb,
+                 double *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dsysv_usm>(cgh, [=]() {
+            auto info = LAPACKE_dsysv(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs, a,
+                                      lda, ipiv, b, ldb);
+            check_info("sysv", info);
+        });
+    });
+    return done;
+}
+
+sycl::event sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                 std::complex<float> *a, std::int64_t lda, std::int64_t *ipiv,
+                 std::complex<float> *b, std::int64_t ldb, std::complex<float> *scratchpad,
+                 std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_csysv_usm>(cgh, [=]() {
+            auto info = LAPACKE_csysv(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs, a,
+                                      lda, ipiv, b, ldb);
+            check_info("sysv", info);
+        });
+    });
+    return done;
+}
+
+sycl::event sysv(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                 std::complex<double> *a, std::int64_t lda, std::int64_t *ipiv,
+                 std::complex<double> *b, std::int64_t ldb, std::complex<double> *scratchpad,
+                 std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zsysv_usm>(cgh, [=]() {
+            auto info = LAPACKE_zsysv(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, nrhs, a,
+                                      lda, ipiv, b, ldb);
+            check_info("sysv", info);
+        });
+    });
+    return done;
+}
+
+sycl::event trtrs(sycl::queue &queue, oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans,
+                  oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs, std::complex<float> *a,
+                  std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
+                  std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ctrtrs_usm>(cgh, [=]() {
+            auto info = LAPACKE_ctrtrs(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo),
+                                       convert_to_lapack_trans<std::complex<float>>(trans),
+                                       convert_to_lapack_diag(diag), n, nrhs, a, lda, b, ldb);
+            check_info("trtrs", info);
+        });
+    });
+    return done;
+}
+
+sycl::event trtrs(sycl::queue &queue, oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans,
+                  oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs, double *a,
+                  std::int64_t lda, double *b, std::int64_t ldb, double *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dtrtrs_usm>(cgh, [=]() {
+            auto info = LAPACKE_dtrtrs(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo),
+                                       convert_to_lapack_trans<double>(trans),
+                                       convert_to_lapack_diag(diag), n, nrhs, a, lda, b, ldb);
+            check_info("trtrs", info);
+        });
+    });
+    return done;
+}
+
+sycl::event trtrs(sycl::queue &queue, oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans,
+                  oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs, float *a,
+                  std::int64_t lda, float *b, std::int64_t ldb, float *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_strtrs_usm>(cgh, [=]() {
+            auto info = LAPACKE_strtrs(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo),
+                                       convert_to_lapack_trans<float>(trans),
+                                       convert_to_lapack_diag(diag), n, nrhs, a, lda, b, ldb);
+            check_info("trtrs", info);
+        });
+    });
+    return done;
+}
+
+sycl::event trtrs(sycl::queue &queue, oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans,
+                  oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs,
+                  std::complex<double> *a, std::int64_t lda, std::complex<double> *b,
+                  std::int64_t ldb, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ztrtrs_usm>(cgh, [=]() {
+            auto info = LAPACKE_ztrtrs(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo),
+                                       convert_to_lapack_trans<std::complex<double>>(trans),
+                                       convert_to_lapack_diag(diag), n, nrhs, a, lda, b, ldb);
+            check_info("trtrs", info);
+        });
+    });
+    return done;
+}
+
+sycl::event ungbr(sycl::queue &queue, oneapi::mkl::generate vec, std::int64_t m, std::int64_t n,
+                  std::int64_t k, std::complex<float> *a, std::int64_t lda,
+                  std::complex<float> *tau, std::complex<float> *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cungbr_usm>(cgh, [=]() {
+            auto info = LAPACKE_cungbr(LAPACK_COL_MAJOR, convert_to_lapack_generate(vec), m, n, k,
+                                       a, lda, tau);
+            check_info("ungbr", info);
+        });
+    });
+    return done;
+}
+
+sycl::event ungbr(sycl::queue &queue, oneapi::mkl::generate vec, std::int64_t m, std::int64_t n,
+                  std::int64_t k, std::complex<double> *a, std::int64_t lda,
+                  std::complex<double> *tau, std::complex<double> *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zungbr_usm>(cgh, [=]() {
+            auto info = LAPACKE_zungbr(LAPACK_COL_MAJOR, convert_to_lapack_generate(vec), m, n, k,
+                                       a, lda, tau);
+            check_info("ungbr", info);
+        });
+    });
+    return done;
+}
+
+sycl::event ungqr(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
+                  std::complex<float> *a, std::int64_t lda, std::complex<float> *tau,
+                  std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cungqr_usm>(cgh, [=]() {
+            auto info = tsqr::orgqr(m, n, k, a, lda, tau);
+            check_info("ungqr", info);
+        });
+    });
+    return done;
+}
+
+sycl::event ungqr(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
+                  std::complex<double> *a, std::int64_t lda, std::complex<double> *tau,
+                  std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zungqr_usm>(cgh, [=]() {
+            auto info = tsqr::orgqr(m, n, k, a, lda, tau);
+            check_info("ungqr", info);
+        });
+    });
+    return done;
+}
+
+sycl::event ungtr(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                  std::complex<float> *a, std::int64_t lda, std::complex<float> *tau,
+                  std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cungtr_usm>(cgh, [=]() {
+            auto info = LAPACKE_cungtr(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, a, lda,
+                                       tau);
+            check_info("ungtr", info);
+        });
+    });
+    return done;
+}
+
+sycl::event ungtr(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                  std::complex<double> *a, std::int64_t lda, std::complex<double> *tau,
+                  std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zungtr_usm>(cgh, [=]() {
+            auto info = LAPACKE_zungtr(LAPACK_COL_MAJOR, convert_to_lapack_uplo(uplo), n, a, lda,
+                                       tau);
+            check_info("ungtr", info);
+        });
+    });
+    return done;
+}
+
+sycl::event unmrq(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+                  std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> *a,
+                  std::int64_t lda, std::complex<float> *tau, std::complex<float> *c,
+                  std::int64_t ldc, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cunmrq_usm>(cgh, [=]() {
+            auto info = LAPACKE_cunmrq(LAPACK_COL_MAJOR, convert_to_lapack_side(side),
+                                       convert_to_lapack_trans<std::complex<float>>(trans), m, n, k,
+                                       a, lda, tau, c, ldc);
+            check_info("unmrq", info);
+        });
+    });
+    return done;
+}
+
+sycl::event unmrq(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+                  std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> *a,
+                  std::int64_t lda, std::complex<double> *tau, std::complex<double> *c,
+                  std::int64_t ldc, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zunmrq_usm>(cgh, [=]() {
+            auto info = LAPACKE_zunmrq(LAPACK_COL_MAJOR, convert_to_lapack_side(side),
+                                       convert_to_lapack_trans<std::complex<double>>(trans), m, n,
+                                       k, a, lda, tau, c, ldc);
+            check_info("unmrq", info);
+        });
+    });
+    return done;
+}
+
+sycl::event unmqr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+                  std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> *a,
+                  std::int64_t lda, std::complex<float> *tau, std::complex<float> *c,
+                  std::int64_t ldc, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cunmqr_usm>(cgh, [=]() {
+            auto info = LAPACKE_cunmqr(LAPACK_COL_MAJOR, convert_to_lapack_side(side),
+                                       convert_to_lapack_trans<std::complex<float>>(trans), m, n, k,
+                                       a, lda, tau, c, ldc);
+            check_info("unmqr", info);
+        });
+    });
+    return done;
+}
+
+sycl::event unmqr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::transpose trans,
+                  std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> *a,
+                  std::int64_t lda, std::complex<double> *tau, std::complex<double> *c,
+                  std::int64_t ldc, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zunmqr_usm>(cgh, [=]() {
+            auto info = LAPACKE_zunmqr(LAPACK_COL_MAJOR, convert_to_lapack_side(side),
+                                       convert_to_lapack_trans<std::complex<double>>(trans), m, n,
+                                       k, a, lda, tau, c, ldc);
+            check_info("unmqr", info);
+        });
+    });
+    return done;
+}
+
+sycl::event unmtr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+                  oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                  std::complex<float> *a, std::int64_t lda, std::complex<float> *tau,
+                  std::complex<float> *c, std::int64_t ldc, std::complex<float> *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cunmtr_usm>(cgh, [=]() {
+            auto info = LAPACKE_cunmtr(LAPACK_COL_MAJOR, convert_to_lapack_side(side),
+                                       convert_to_lapack_uplo(uplo),
+                                       convert_to_lapack_trans<std::complex<float>>(trans), m, n, a,
+                                       lda, tau, c, ldc);
+            check_info("unmtr", info);
+        });
+    });
+    return done;
+}
+
+sycl::event unmtr(sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
+                  oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                  std::complex<double> *a, std::int64_t lda, std::complex<double> *tau,
+                  std::complex<double> *c, std::int64_t ldc, std::complex<double> *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    auto done = submit(queue, [&](auto &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zunmtr_usm>(cgh, [=]() {
+            auto info = LAPACKE_zunmtr(LAPACK_COL_MAJOR, convert_to_lapack_side(side),
+                                       convert_to_lapack_uplo(uplo),
+                                       convert_to_lapack_trans<std::complex<double>>(trans), m, n,
+                                       a, lda, tau, c, ldc);
+            check_info("unmtr", info);
+        });
+    });
+    return done;
+}
+
+} // namespace netlib
+} // namespace lapack
+} // namespace mkl
+} // namespace oneapi
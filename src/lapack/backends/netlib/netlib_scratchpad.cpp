@@ -0,0 +1,1471 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <CL/sycl.hpp>
+
+#include "netlib_common.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace lapack {
+namespace netlib {
+
+// LAPACKE allocates and releases its own workspace on every call, so the
+// scratchpad only has to be a valid non-empty allocation.
+
+template <>
+std::int64_t gebrd_scratchpad_size<float>(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                          std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t gebrd_scratchpad_size<double>(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                           std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t gebrd_scratchpad_size<std::complex<float>>(sycl::queue &queue, std::int64_t m,
+                                                        std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t gebrd_scratchpad_size<std::complex<double>>(sycl::queue &queue, std::int64_t m,
+                                                         std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t gels_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::transpose trans,
+                                         std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                                         std::int64_t lda, std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t gels_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::transpose trans,
+                                          std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                                          std::int64_t lda, std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t gels_scratchpad_size<std::complex<float>>(sycl::queue &queue,
+                                                       oneapi::mkl::transpose trans, std::int64_t m,
+                                                       std::int64_t n, std::int64_t nrhs,
+                                                       std::int64_t lda, std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t gels_scratchpad_size<std::complex<double>>(sycl::queue &queue,
+                                                        oneapi::mkl::transpose trans,
+                                                        std::int64_t m, std::int64_t n,
+                                                        std::int64_t nrhs, std::int64_t lda,
+                                                        std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t gelsd_scratchpad_size<float>(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                          std::int64_t nrhs, std::int64_t lda, std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t gelsd_scratchpad_size<double>(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                           std::int64_t nrhs, std::int64_t lda, std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t gelsd_scratchpad_size<std::complex<float>>(sycl::queue &queue, std::int64_t m,
+                                                        std::int64_t n, std::int64_t nrhs,
+                                                        std::int64_t lda, std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t gelsd_scratchpad_size<std::complex<double>>(sycl::queue &queue, std::int64_t m,
+                                                         std::int64_t n, std::int64_t nrhs,
+                                                         std::int64_t lda, std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t gerqf_scratchpad_size<float>(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                          std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t gerqf_scratchpad_size<double>(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                           std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t gerqf_scratchpad_size<std::complex<float>>(sycl::queue &queue, std::int64_t m,
+                                                        std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t gerqf_scratchpad_size<std::complex<double>>(sycl::queue &queue, std::int64_t m,
+                                                         std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t geqrf_scratchpad_size<float>(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                          std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t geqrf_scratchpad_size<double>(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                           std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t geqrf_scratchpad_size<std::complex<float>>(sycl::queue &queue, std::int64_t m,
+                                                        std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t geqrf_scratchpad_size<std::complex<double>>(sycl::queue &queue, std::int64_t m,
+                                                         std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t gesvd_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+                                          oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n,
+                                          std::int64_t lda, std::int64_t ldu, std::int64_t ldvt) {
+    return 1;
+}
+
+template <>
+std::int64_t gesvd_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::jobsvd jobu,
+                                           oneapi::mkl::jobsvd jobvt, std::int64_t m,
+                                           std::int64_t n, std::int64_t lda, std::int64_t ldu,
+                                           std::int64_t ldvt) {
+    return 1;
+}
+
+template <>
+std::int64_t gesvd_scratchpad_size<std::complex<float>>(sycl::queue &queue,
+                                                        oneapi::mkl::jobsvd jobu,
+                                                        oneapi::mkl::jobsvd jobvt, std::int64_t m,
+                                                        std::int64_t n, std::int64_t lda,
+                                                        std::int64_t ldu, std::int64_t ldvt) {
+    return 1;
+}
+
+template <>
+std::int64_t gesvd_scratchpad_size<std::complex<double>>(sycl::queue &queue,
+                                                         oneapi::mkl::jobsvd jobu,
+                                                         oneapi::mkl::jobsvd jobvt, std::int64_t m,
+                                                         std::int64_t n, std::int64_t lda,
+                                                         std::int64_t ldu, std::int64_t ldvt) {
+    return 1;
+}
+
+template <>
+std::int64_t getrf_scratchpad_size<float>(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                          std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t getrf_scratchpad_size<double>(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                           std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t getrf_scratchpad_size<std::complex<float>>(sycl::queue &queue, std::int64_t m,
+                                                        std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t getrf_scratchpad_size<std::complex<double>>(sycl::queue &queue, std::int64_t m,
+                                                         std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t getri_scratchpad_size<float>(sycl::queue &queue, std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t getri_scratchpad_size<double>(sycl::queue &queue, std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t getri_scratchpad_size<std::complex<float>>(sycl::queue &queue, std::int64_t n,
+                                                        std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t getri_scratchpad_size<std::complex<double>>(sycl::queue &queue, std::int64_t n,
+                                                         std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t getrs_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::transpose trans,
+                                          std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                          std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t getrs_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::transpose trans,
+                                           std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                           std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t getrs_scratchpad_size<std::complex<float>>(sycl::queue &queue,
+                                                        oneapi::mkl::transpose trans,
+                                                        std::int64_t n, std::int64_t nrhs,
+                                                        std::int64_t lda, std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t getrs_scratchpad_size<std::complex<double>>(sycl::queue &queue,
+                                                         oneapi::mkl::transpose trans,
+                                                         std::int64_t n, std::int64_t nrhs,
+                                                         std::int64_t lda, std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t gesv_scratchpad_size<float>(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                                         std::int64_t lda, std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t gesv_scratchpad_size<double>(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                                          std::int64_t lda, std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t gesv_scratchpad_size<std::complex<float>>(sycl::queue &queue, std::int64_t n,
+                                                       std::int64_t nrhs, std::int64_t lda,
+                                                       std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t gesv_scratchpad_size<std::complex<double>>(sycl::queue &queue, std::int64_t n,
+                                                        std::int64_t nrhs, std::int64_t lda,
+                                                        std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t heevd_scratchpad_size<std::complex<float>>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                        oneapi::mkl::uplo uplo, std::int64_t n,
+                                                        std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t heevd_scratchpad_size<std::complex<double>>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                         oneapi::mkl::uplo uplo, std::int64_t n,
+                                                         std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t heevr_scratchpad_size<std::complex<float>>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                        oneapi::mkl::rangev range,
+                                                        oneapi::mkl::uplo uplo, std::int64_t n,
+                                                        std::int64_t lda, std::int64_t ldz) {
+    return 1;
+}
+
+template <>
+std::int64_t heevr_scratchpad_size<std::complex<double>>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                         oneapi::mkl::rangev range,
+                                                         oneapi::mkl::uplo uplo, std::int64_t n,
+                                                         std::int64_t lda, std::int64_t ldz) {
+    return 1;
+}
+
+template <>
+std::int64_t heevx_scratchpad_size<std::complex<float>>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                        oneapi::mkl::rangev range,
+                                                        oneapi::mkl::uplo uplo, std::int64_t n,
+                                                        std::int64_t lda, std::int64_t ldz) {
+    return 1;
+}
+
+template <>
+std::int64_t heevx_scratchpad_size<std::complex<double>>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                         oneapi::mkl::rangev range,
+                                                         oneapi::mkl::uplo uplo, std::int64_t n,
+                                                         std::int64_t lda, std::int64_t ldz) {
+    return 1;
+}
+
+template <>
+std::int64_t hegvd_scratchpad_size<std::complex<float>>(sycl::queue &queue, std::int64_t itype,
+                                                        oneapi::mkl::job jobz,
+                                                        oneapi::mkl::uplo uplo, std::int64_t n,
+                                                        std::int64_t lda, std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t hegvd_scratchpad_size<std::complex<double>>(sycl::queue &queue, std::int64_t itype,
+                                                         oneapi::mkl::job jobz,
+                                                         oneapi::mkl::uplo uplo, std::int64_t n,
+                                                         std::int64_t lda, std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t hetrd_scratchpad_size<std::complex<float>>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                        std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t hetrd_scratchpad_size<std::complex<double>>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                         std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t hetrf_scratchpad_size<std::complex<float>>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                        std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t hetrf_scratchpad_size<std::complex<double>>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                         std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t orgbr_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::generate vect,
+                                          std::int64_t m, std::int64_t n, std::int64_t k,
+                                          std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t orgbr_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::generate vect,
+                                           std::int64_t m, std::int64_t n, std::int64_t k,
+                                           std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t orgtr_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                          std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t orgtr_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                           std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t orgqr_scratchpad_size<float>(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                          std::int64_t k, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t orgqr_scratchpad_size<double>(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                           std::int64_t k, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t ormrq_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::side side,
+                                          oneapi::mkl::transpose trans, std::int64_t m,
+                                          std::int64_t n, std::int64_t k, std::int64_t lda,
+                                          std::int64_t ldc) {
+    return 1;
+}
+
+template <>
+std::int64_t ormrq_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::side side,
+                                           oneapi::mkl::transpose trans, std::int64_t m,
+                                           std::int64_t n, std::int64_t k, std::int64_t lda,
+                                           std::int64_t ldc) {
+    return 1;
+}
+
+template <>
+std::int64_t ormqr_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::side side,
+                                          oneapi::mkl::transpose trans, std::int64_t m,
+                                          std::int64_t n, std::int64_t k, std::int64_t lda,
+                                          std::int64_t ldc) {
+    return 1;
+}
+
+template <>
+std::int64_t ormqr_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::side side,
+                                           oneapi::mkl::transpose trans, std::int64_t m,
+                                           std::int64_t n, std::int64_t k, std::int64_t lda,
+                                           std::int64_t ldc) {
+    return 1;
+}
+
+template <>
+std::int64_t ormtr_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::side side,
+                                          oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans,
+                                          std::int64_t m, std::int64_t n, std::int64_t lda,
+                                          std::int64_t ldc) {
+    return 1;
+}
+
+template <>
+std::int64_t ormtr_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::side side,
+                                           oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans,
+                                           std::int64_t m, std::int64_t n, std::int64_t lda,
+                                           std::int64_t ldc) {
+    return 1;
+}
+
+template <>
+std::int64_t potrf_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                          std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t potrf_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                           std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t potrf_scratchpad_size<std::complex<float>>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                        std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t potrf_scratchpad_size<std::complex<double>>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                         std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t potrs_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                          std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                          std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t potrs_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                           std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                           std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t potrs_scratchpad_size<std::complex<float>>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                        std::int64_t n, std::int64_t nrhs,
+                                                        std::int64_t lda, std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t potrs_scratchpad_size<std::complex<double>>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                         std::int64_t n, std::int64_t nrhs,
+                                                         std::int64_t lda, std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t posv_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                         std::int64_t nrhs, std::int64_t lda, std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t posv_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                          std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                          std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t posv_scratchpad_size<std::complex<float>>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                       std::int64_t n, std::int64_t nrhs,
+                                                       std::int64_t lda, std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t posv_scratchpad_size<std::complex<double>>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                        std::int64_t n, std::int64_t nrhs,
+                                                        std::int64_t lda, std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t potri_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                          std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t potri_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                           std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t potri_scratchpad_size<std::complex<float>>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                        std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t potri_scratchpad_size<std::complex<double>>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                         std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t sytrf_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                          std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t sytrf_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                           std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t sytrf_scratchpad_size<std::complex<float>>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                        std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t sytrf_scratchpad_size<std::complex<double>>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                         std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t sysv_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                         std::int64_t nrhs, std::int64_t lda, std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t sysv_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                          std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                          std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t sysv_scratchpad_size<std::complex<float>>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                       std::int64_t n, std::int64_t nrhs,
+                                                       std::int64_t lda, std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t sysv_scratchpad_size<std::complex<double>>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                        std::int64_t n, std::int64_t nrhs,
+                                                        std::int64_t lda, std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t syevd_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                          oneapi::mkl::uplo uplo, std::int64_t n,
+                                          std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t syevd_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                           oneapi::mkl::uplo uplo, std::int64_t n,
+                                           std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t syevr_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                          oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                          std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    return 1;
+}
+
+template <>
+std::int64_t syevr_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                           std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    return 1;
+}
+
+template <>
+std::int64_t syevx_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                          oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                          std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    return 1;
+}
+
+template <>
+std::int64_t syevx_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                           std::int64_t n, std::int64_t lda, std::int64_t ldz) {
+    return 1;
+}
+
+template <>
+std::int64_t sygvd_scratchpad_size<float>(sycl::queue &queue, std::int64_t itype,
+                                          oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                                          std::int64_t n, std::int64_t lda, std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t sygvd_scratchpad_size<double>(sycl::queue &queue, std::int64_t itype,
+                                           oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                                           std::int64_t n, std::int64_t lda, std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t sytrd_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                          std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t sytrd_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                           std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t trtrs_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                          oneapi::mkl::transpose trans, oneapi::mkl::diag diag,
+                                          std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                          std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t trtrs_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                           oneapi::mkl::transpose trans, oneapi::mkl::diag diag,
+                                           std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                           std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t trtrs_scratchpad_size<std::complex<float>>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                        oneapi::mkl::transpose trans,
+                                                        oneapi::mkl::diag diag, std::int64_t n,
+                                                        std::int64_t nrhs, std::int64_t lda,
+                                                        std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t trtrs_scratchpad_size<std::complex<double>>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                         oneapi::mkl::transpose trans,
+                                                         oneapi::mkl::diag diag, std::int64_t n,
+                                                         std::int64_t nrhs, std::int64_t lda,
+                                                         std::int64_t ldb) {
+    return 1;
+}
+
+template <>
+std::int64_t ungbr_scratchpad_size<std::complex<float>>(sycl::queue &queue,
+                                                        oneapi::mkl::generate vect, std::int64_t m,
+                                                        std::int64_t n, std::int64_t k,
+                                                        std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t ungbr_scratchpad_size<std::complex<double>>(sycl::queue &queue,
+                                                         oneapi::mkl::generate vect, std::int64_t m,
+                                                         std::int64_t n, std::int64_t k,
+                                                         std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t ungqr_scratchpad_size<std::complex<float>>(sycl::queue &queue, std::int64_t m,
+                                                        std::int64_t n, std::int64_t k,
+                                                        std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t ungqr_scratchpad_size<std::complex<double>>(sycl::queue &queue, std::int64_t m,
+                                                         std::int64_t n, std::int64_t k,
+                                                         std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t ungtr_scratchpad_size<std::complex<float>>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                        std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t ungtr_scratchpad_size<std::complex<double>>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                         std::int64_t n, std::int64_t lda) {
+    return 1;
+}
+
+template <>
+std::int64_t unmrq_scratchpad_size<std::complex<float>>(sycl::queue &queue, oneapi::mkl::side side,
+                                                        oneapi::mkl::transpose trans,
+                                                        std::int64_t m, std::int64_t n,
+                                                        std::int64_t k, std::int64_t lda,
+                                                        std::int64_t ldc) {
+    return 1;
+}
+
+template <>
+std::int64_t unmrq_scratchpad_size<std::complex<double>>(sycl::queue &queue, oneapi::mkl::side side,
+                                                         oneapi::mkl::transpose trans,
+                                                         std::int64_t m, std::int64_t n,
+                                                         std::int64_t k, std::int64_t lda,
+                                                         std::int64_t ldc) {
+    return 1;
+}
+
+template <>
+std::int64_t unmqr_scratchpad_size<std::complex<float>>(sycl::queue &queue, oneapi::mkl::side side,
+                                                        oneapi::mkl::transpose trans,
+                                                        std::int64_t m, std::int64_t n,
+                                                        std::int64_t k, std::int64_t lda,
+                                                        std::int64_t ldc) {
+    return 1;
+}
+
+template <>
+std::int64_t unmqr_scratchpad_size<std::complex<double>>(sycl::queue &queue, oneapi::mkl::side side,
+                                                         oneapi::mkl::transpose trans,
+                                                         std::int64_t m, std::int64_t n,
+                                                         std::int64_t k, std::int64_t lda,
+                                                         std::int64_t ldc) {
+    return 1;
+}
+
+template <>
+std::int64_t unmtr_scratchpad_size<std::complex<float>>(sycl::queue &queue, oneapi::mkl::side side,
+                                                        oneapi::mkl::uplo uplo,
+                                                        oneapi::mkl::transpose trans,
+                                                        std::int64_t m, std::int64_t n,
+                                                        std::int64_t lda, std::int64_t ldc) {
+    return 1;
+}
+
+template <>
+std::int64_t unmtr_scratchpad_size<std::complex<double>>(sycl::queue &queue, oneapi::mkl::side side,
+                                                         oneapi::mkl::uplo uplo,
+                                                         oneapi::mkl::transpose trans,
+                                                         std::int64_t m, std::int64_t n,
+                                                         std::int64_t lda, std::int64_t ldc) {
+    return 1;
+}
+
+template <>
+std::int64_t getrf_batch_scratchpad_size<float>(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                                std::int64_t lda, std::int64_t stride_a,
+                                                std::int64_t stride_ipiv, std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t getrf_batch_scratchpad_size<double>(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                                 std::int64_t lda, std::int64_t stride_a,
+                                                 std::int64_t stride_ipiv,
+                                                 std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t getrf_batch_scratchpad_size<std::complex<float>>(sycl::queue &queue, std::int64_t m,
+                                                              std::int64_t n, std::int64_t lda,
+                                                              std::int64_t stride_a,
+                                                              std::int64_t stride_ipiv,
+                                                              std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t getrf_batch_scratchpad_size<std::complex<double>>(sycl::queue &queue, std::int64_t m,
+                                                               std::int64_t n, std::int64_t lda,
+                                                               std::int64_t stride_a,
+                                                               std::int64_t stride_ipiv,
+                                                               std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t getri_batch_scratchpad_size<float>(sycl::queue &queue, std::int64_t n,
+                                                std::int64_t lda, std::int64_t stride_a,
+                                                std::int64_t stride_ipiv, std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t getri_batch_scratchpad_size<double>(sycl::queue &queue, std::int64_t n,
+                                                 std::int64_t lda, std::int64_t stride_a,
+                                                 std::int64_t stride_ipiv,
+                                                 std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t getri_batch_scratchpad_size<std::complex<float>>(sycl::queue &queue, std::int64_t n,
+                                                              std::int64_t lda,
+                                                              std::int64_t stride_a,
+                                                              std::int64_t stride_ipiv,
+                                                              std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t getri_batch_scratchpad_size<std::complex<double>>(sycl::queue &queue, std::int64_t n,
+                                                               std::int64_t lda,
+                                                               std::int64_t stride_a,
+                                                               std::int64_t stride_ipiv,
+                                                               std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t getrs_batch_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::transpose trans,
+                                                std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                                std::int64_t stride_a, std::int64_t stride_ipiv,
+                                                std::int64_t ldb, std::int64_t stride_b,
+                                                std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t getrs_batch_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::transpose trans,
+                                                 std::int64_t n, std::int64_t nrhs,
+                                                 std::int64_t lda, std::int64_t stride_a,
+                                                 std::int64_t stride_ipiv, std::int64_t ldb,
+                                                 std::int64_t stride_b, std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t getrs_batch_scratchpad_size<std::complex<float>>(sycl::queue &queue,
+                                                              oneapi::mkl::transpose trans,
+                                                              std::int64_t n, std::int64_t nrhs,
+                                                              std::int64_t lda,
+                                                              std::int64_t stride_a,
+                                                              std::int64_t stride_ipiv,
+                                                              std::int64_t ldb,
+                                                              std::int64_t stride_b,
+                                                              std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t getrs_batch_scratchpad_size<std::complex<double>>(sycl::queue &queue,
+                                                               oneapi::mkl::transpose trans,
+                                                               std::int64_t n, std::int64_t nrhs,
+                                                               std::int64_t lda,
+                                                               std::int64_t stride_a,
+                                                               std::int64_t stride_ipiv,
+                                                               std::int64_t ldb,
+                                                               std::int64_t stride_b,
+                                                               std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t gesv_batch_scratchpad_size<float>(sycl::queue &queue, std::int64_t n,
+                                               std::int64_t nrhs, std::int64_t lda,
+                                               std::int64_t stride_a, std::int64_t stride_ipiv,
+                                               std::int64_t ldb, std::int64_t stride_b,
+                                               std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t gesv_batch_scratchpad_size<double>(sycl::queue &queue, std::int64_t n,
+                                                std::int64_t nrhs, std::int64_t lda,
+                                                std::int64_t stride_a, std::int64_t stride_ipiv,
+                                                std::int64_t ldb, std::int64_t stride_b,
+                                                std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t gesv_batch_scratchpad_size<std::complex<float>>(sycl::queue &queue, std::int64_t n,
+                                                             std::int64_t nrhs, std::int64_t lda,
+                                                             std::int64_t stride_a,
+                                                             std::int64_t stride_ipiv,
+                                                             std::int64_t ldb,
+                                                             std::int64_t stride_b,
+                                                             std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t gesv_batch_scratchpad_size<std::complex<double>>(sycl::queue &queue, std::int64_t n,
+                                                              std::int64_t nrhs, std::int64_t lda,
+                                                              std::int64_t stride_a,
+                                                              std::int64_t stride_ipiv,
+                                                              std::int64_t ldb,
+                                                              std::int64_t stride_b,
+                                                              std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t gels_batch_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::transpose trans,
+                                               std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                                               std::int64_t lda, std::int64_t stride_a,
+                                               std::int64_t ldb, std::int64_t stride_b,
+                                               std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t gels_batch_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::transpose trans,
+                                                std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                                                std::int64_t lda, std::int64_t stride_a,
+                                                std::int64_t ldb, std::int64_t stride_b,
+                                                std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t gels_batch_scratchpad_size<std::complex<float>>(sycl::queue &queue,
+                                                             oneapi::mkl::transpose trans,
+                                                             std::int64_t m, std::int64_t n,
+                                                             std::int64_t nrhs, std::int64_t lda,
+                                                             std::int64_t stride_a,
+                                                             std::int64_t ldb,
+                                                             std::int64_t stride_b,
+                                                             std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t gels_batch_scratchpad_size<std::complex<double>>(sycl::queue &queue,
+                                                              oneapi::mkl::transpose trans,
+                                                              std::int64_t m, std::int64_t n,
+                                                              std::int64_t nrhs, std::int64_t lda,
+                                                              std::int64_t stride_a,
+                                                              std::int64_t ldb,
+                                                              std::int64_t stride_b,
+                                                              std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t heevd_batch_scratchpad_size<std::complex<float>>(sycl::queue &queue,
+                                                              oneapi::mkl::job jobz,
+                                                              oneapi::mkl::uplo uplo,
+                                                              std::int64_t n, std::int64_t lda,
+                                                              std::int64_t stride_a,
+                                                              std::int64_t stride_w,
+                                                              std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t heevd_batch_scratchpad_size<std::complex<double>>(sycl::queue &queue,
+                                                               oneapi::mkl::job jobz,
+                                                               oneapi::mkl::uplo uplo,
+                                                               std::int64_t n, std::int64_t lda,
+                                                               std::int64_t stride_a,
+                                                               std::int64_t stride_w,
+                                                               std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t geqrf_batch_scratchpad_size<float>(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                                std::int64_t lda, std::int64_t stride_a,
+                                                std::int64_t stride_tau, std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t geqrf_batch_scratchpad_size<double>(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                                 std::int64_t lda, std::int64_t stride_a,
+                                                 std::int64_t stride_tau, std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t geqrf_batch_scratchpad_size<std::complex<float>>(sycl::queue &queue, std::int64_t m,
+                                                              std::int64_t n, std::int64_t lda,
+                                                              std::int64_t stride_a,
+                                                              std::int64_t stride_tau,
+                                                              std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t geqrf_batch_scratchpad_size<std::complex<double>>(sycl::queue &queue, std::int64_t m,
+                                                               std::int64_t n, std::int64_t lda,
+                                                               std::int64_t stride_a,
+                                                               std::int64_t stride_tau,
+                                                               std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t potrf_batch_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                std::int64_t n, std::int64_t lda,
+                                                std::int64_t stride_a, std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t potrf_batch_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                 std::int64_t n, std::int64_t lda,
+                                                 std::int64_t stride_a, std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t potrf_batch_scratchpad_size<std::complex<float>>(sycl::queue &queue,
+                                                              oneapi::mkl::uplo uplo,
+                                                              std::int64_t n, std::int64_t lda,
+                                                              std::int64_t stride_a,
+                                                              std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t potrf_batch_scratchpad_size<std::complex<double>>(sycl::queue &queue,
+                                                               oneapi::mkl::uplo uplo,
+                                                               std::int64_t n, std::int64_t lda,
+                                                               std::int64_t stride_a,
+                                                               std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t potrs_batch_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                                std::int64_t stride_a, std::int64_t ldb,
+                                                std::int64_t stride_b, std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t potrs_batch_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                 std::int64_t n, std::int64_t nrhs,
+                                                 std::int64_t lda, std::int64_t stride_a,
+                                                 std::int64_t ldb, std::int64_t stride_b,
+                                                 std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t potrs_batch_scratchpad_size<std::complex<float>>(sycl::queue &queue,
+                                                              oneapi::mkl::uplo uplo,
+                                                              std::int64_t n, std::int64_t nrhs,
+                                                              std::int64_t lda,
+                                                              std::int64_t stride_a,
+                                                              std::int64_t ldb,
+                                                              std::int64_t stride_b,
+                                                              std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t potrs_batch_scratchpad_size<std::complex<double>>(sycl::queue &queue,
+                                                               oneapi::mkl::uplo uplo,
+                                                               std::int64_t n, std::int64_t nrhs,
+                                                               std::int64_t lda,
+                                                               std::int64_t stride_a,
+                                                               std::int64_t ldb,
+                                                               std::int64_t stride_b,
+                                                               std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t posv_batch_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                               std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                               std::int64_t stride_a, std::int64_t ldb,
+                                               std::int64_t stride_b, std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t posv_batch_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                                std::int64_t stride_a, std::int64_t ldb,
+                                                std::int64_t stride_b, std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t posv_batch_scratchpad_size<std::complex<float>>(sycl::queue &queue,
+                                                             oneapi::mkl::uplo uplo, std::int64_t n,
+                                                             std::int64_t nrhs, std::int64_t lda,
+                                                             std::int64_t stride_a,
+                                                             std::int64_t ldb,
+                                                             std::int64_t stride_b,
+                                                             std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t posv_batch_scratchpad_size<std::complex<double>>(sycl::queue &queue,
+                                                              oneapi::mkl::uplo uplo,
+                                                              std::int64_t n, std::int64_t nrhs,
+                                                              std::int64_t lda,
+                                                              std::int64_t stride_a,
+                                                              std::int64_t ldb,
+                                                              std::int64_t stride_b,
+                                                              std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t syevd_batch_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                oneapi::mkl::uplo uplo, std::int64_t n,
+                                                std::int64_t lda, std::int64_t stride_a,
+                                                std::int64_t stride_w, std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t syevd_batch_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                 oneapi::mkl::uplo uplo, std::int64_t n,
+                                                 std::int64_t lda, std::int64_t stride_a,
+                                                 std::int64_t stride_w, std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t orgqr_batch_scratchpad_size<float>(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                                std::int64_t k, std::int64_t lda,
+                                                std::int64_t stride_a, std::int64_t stride_tau,
+                                                std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t orgqr_batch_scratchpad_size<double>(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                                 std::int64_t k, std::int64_t lda,
+                                                 std::int64_t stride_a, std::int64_t stride_tau,
+                                                 std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t ungqr_batch_scratchpad_size<std::complex<float>>(sycl::queue &queue, std::int64_t m,
+                                                              std::int64_t n, std::int64_t k,
+                                                              std::int64_t lda,
+                                                              std::int64_t stride_a,
+                                                              std::int64_t stride_tau,
+                                                              std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t ungqr_batch_scratchpad_size<std::complex<double>>(sycl::queue &queue, std::int64_t m,
+                                                               std::int64_t n, std::int64_t k,
+                                                               std::int64_t lda,
+                                                               std::int64_t stride_a,
+                                                               std::int64_t stride_tau,
+                                                               std::int64_t batch_size) {
+    return 1;
+}
+
+template <>
+std::int64_t getrf_batch_scratchpad_size<float>(sycl::queue &queue, std::int64_t *m,
+                                                std::int64_t *n, std::int64_t *lda,
+                                                std::int64_t group_count,
+                                                std::int64_t *group_sizes) {
+    return 1;
+}
+
+template <>
+std::int64_t getrf_batch_scratchpad_size<double>(sycl::queue &queue, std::int64_t *m,
+                                                 std::int64_t *n, std::int64_t *lda,
+                                                 std::int64_t group_count,
+                                                 std::int64_t *group_sizes) {
+    return 1;
+}
+
+template <>
+std::int64_t getrf_batch_scratchpad_size<std::complex<float>>(sycl::queue &queue, std::int64_t *m,
+                                                              std::int64_t *n, std::int64_t *lda,
+                                                              std::int64_t group_count,
+                                                              std::int64_t *group_sizes) {
+    return 1;
+}
+
+template <>
+std::int64_t getrf_batch_scratchpad_size<std::complex<double>>(sycl::queue &queue, std::int64_t *m,
+                                                               std::int64_t *n, std::int64_t *lda,
+                                                               std::int64_t group_count,
+                                                               std::int64_t *group_sizes) {
+    return 1;
+}
+
+template <>
+std::int64_t getri_batch_scratchpad_size<float>(sycl::queue &queue, std::int64_t *n,
+                                                std::int64_t *lda, std::int64_t group_count,
+                                                std::int64_t *group_sizes) {
+    return 1;
+}
+
+template <>
+std::int64_t getri_batch_scratchpad_size<double>(sycl::queue &queue, std::int64_t *n,
+                                                 std::int64_t *lda, std::int64_t group_count,
+                                                 std::int64_t *group_sizes) {
+    return 1;
+}
+
+template <>
+std::int64_t getri_batch_scratchpad_size<std::complex<float>>(sycl::queue &queue, std::int64_t *n,
+                                                              std::int64_t *lda,
+                                                              std::int64_t group_count,
+                                                              std::int64_t *group_sizes) {
+    return 1;
+}
+
+template <>
+std::int64_t getri_batch_scratchpad_size<std::complex<double>>(sycl::queue &queue, std::int64_t *n,
+                                                               std::int64_t *lda,
+                                                               std::int64_t group_count,
+                                                               std::int64_t *group_sizes) {
+    return 1;
+}
+
+template <>
+std::int64_t getrs_batch_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::transpose *trans,
+                                                std::int64_t *n, std::int64_t *nrhs,
+                                                std::int64_t *lda, std::int64_t *ldb,
+                                                std::int64_t group_count,
+                                                std::int64_t *group_sizes) {
+    return 1;
+}
+
+template <>
+std::int64_t getrs_batch_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::transpose *trans,
+                                                 std::int64_t *n, std::int64_t *nrhs,
+                                                 std::int64_t *lda, std::int64_t *ldb,
+                                                 std::int64_t group_count,
+                                                 std::int64_t *group_sizes) {
+    return 1;
+}
+
+template <>
+std::int64_t getrs_batch_scratchpad_size<std::complex<float>>(sycl::queue &queue,
+                                                              oneapi::mkl::transpose *trans,
+                                                              std::int64_t *n, std::int64_t *nrhs,
+                                                              std::int64_t *lda, std::int64_t *ldb,
+                                                              std::int64_t group_count,
+                                                              std::int64_t *group_sizes) {
+    return 1;
+}
+
+template <>
+std::int64_t getrs_batch_scratchpad_size<std::complex<double>>(sycl::queue &queue,
+                                                               oneapi::mkl::transpose *trans,
+                                                               std::int64_t *n, std::int64_t *nrhs,
+                                                               std::int64_t *lda, std::int64_t *ldb,
+                                                               std::int64_t group_count,
+                                                               std::int64_t *group_sizes) {
+    return 1;
+}
+
+template <>
+std::int64_t geqrf_batch_scratchpad_size<float>(sycl::queue &queue, std::int64_t *m,
+                                                std::int64_t *n, std::int64_t *lda,
+                                                std::int64_t group_count,
+                                                std::int64_t *group_sizes) {
+    return 1;
+}
+
+template <>
+std::int64_t geqrf_batch_scratchpad_size<double>(sycl::queue &queue, std::int64_t *m,
+                                                 std::int64_t *n, std::int64_t *lda,
+                                                 std::int64_t group_count,
+                                                 std::int64_t *group_sizes) {
+    return 1;
+}
+
+template <>
+std::int64_t geqrf_batch_scratchpad_size<std::complex<float>>(sycl::queue &queue, std::int64_t *m,
+                                                              std::int64_t *n, std::int64_t *lda,
+                                                              std::int64_t group_count,
+                                                              std::int64_t *group_sizes) {
+    return 1;
+}
+
+template <>
+std::int64_t geqrf_batch_scratchpad_size<std::complex<double>>(sycl::queue &queue, std::int64_t *m,
+                                                               std::int64_t *n, std::int64_t *lda,
+                                                               std::int64_t group_count,
+                                                               std::int64_t *group_sizes) {
+    return 1;
+}
+
+template <>
+std::int64_t orgqr_batch_scratchpad_size<float>(sycl::queue &queue, std::int64_t *m,
+                                                std::int64_t *n, std::int64_t *k, std::int64_t *lda,
+                                                std::int64_t group_count,
+                                                std::int64_t *group_sizes) {
+    return 1;
+}
+
+template <>
+std::int64_t orgqr_batch_scratchpad_size<double>(sycl::queue &queue, std::int64_t *m,
+                                                 std::int64_t *n, std::int64_t *k,
+                                                 std::int64_t *lda, std::int64_t group_count,
+                                                 std::int64_t *group_sizes) {
+    return 1;
+}
+
+template <>
+std::int64_t potrf_batch_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::uplo *uplo,
+                                                std::int64_t *n, std::int64_t *lda,
+                                                std::int64_t group_count,
+                                                std::int64_t *group_sizes) {
+    return 1;
+}
+
+template <>
+std::int64_t potrf_batch_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::uplo *uplo,
+                                                 std::int64_t *n, std::int64_t *lda,
+                                                 std::int64_t group_count,
+                                                 std::int64_t *group_sizes) {
+    return 1;
+}
+
+template <>
+std::int64_t potrf_batch_scratchpad_size<std::complex<float>>(sycl::queue &queue,
+                                                              oneapi::mkl::uplo *uplo,
+                                                              std::int64_t *n, std::int64_t *lda,
+                                                              std::int64_t group_count,
+                                                              std::int64_t *group_sizes) {
+    return 1;
+}
+
+template <>
+std::int64_t potrf_batch_scratchpad_size<std::complex<double>>(sycl::queue &queue,
+                                                               oneapi::mkl::uplo *uplo,
+                                                               std::int64_t *n, std::int64_t *lda,
+                                                               std::int64_t group_count,
+                                                               std::int64_t *group_sizes) {
+    return 1;
+}
+
+template <>
+std::int64_t potrs_batch_scratchpad_size<float>(sycl::queue &queue, oneapi::mkl::uplo *uplo,
+                                                std::int64_t *n, std::int64_t *nrhs,
+                                                std::int64_t *lda, std::int64_t *ldb,
+                                                std::int64_t group_count,
+                                                std::int64_t *group_sizes) {
+    return 1;
+}
+
+template <>
+std::int64_t potrs_batch_scratchpad_size<double>(sycl::queue &queue, oneapi::mkl::uplo *uplo,
+                                                 std::int64_t *n, std::int64_t *nrhs,
+                                                 std::int64_t *lda, std::int64_t *ldb,
+                                                 std::int64_t group_count,
+                                                 std::int64_t *group_sizes) {
+    return 1;
+}
+
+template <>
+std::int64_t potrs_batch_scratchpad_size<std::complex<float>>(sycl::queue &queue,
+                                                              oneapi::mkl::uplo *uplo,
+                                                              std::int64_t *n, std::int64_t *nrhs,
+                                                              std::int64_t *lda, std::int64_t *ldb,
+                                                              std::int64_t group_count,
+                                                              std::int64_t *group_sizes) {
+    return 1;
+}
+
+template <>
+std::int64_t potrs_batch_scratchpad_size<std::complex<double>>(sycl::queue &queue,
+                                                               oneapi::mkl::uplo *uplo,
+                                                               std::int64_t *n, std::int64_t *nrhs,
+                                                               std::int64_t *lda, std::int64_t *ldb,
+                                                               std::int64_t group_count,
+                                                               std::int64_t *group_sizes) {
+    return 1;
+}
+
+template <>
+std::int64_t ungqr_batch_scratchpad_size<std::complex<float>>(sycl::queue &queue, std::int64_t *m,
+                                                              std::int64_t *n, std::int64_t *k,
+                                                              std::int64_t *lda,
+                                                              std::int64_t group_count,
+                                                              std::int64_t *group_sizes) {
+    return 1;
+}
+
+template <>
+std::int64_t ungqr_batch_scratchpad_size<std::complex<double>>(sycl::queue &queue, std::int64_t *m,
+                                                               std::int64_t *n, std::int64_t *k,
+                                                               std::int64_t *lda,
+                                                               std::int64_t group_count,
+                                                               std::int64_t *group_sizes) {
+    return 1;
+}
+
+} // namespace netlib
+} // namespace lapack
+} // namespace mkl
+} // namespace oneapi
@@ -0,0 +1,910 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_LAPACK_SMALL_BATCH_HPP_
+#define _NETLIB_LAPACK_SMALL_BATCH_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "netlib_common.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace lapack {
+namespace netlib {
+namespace small_batch {
+
+/**
+ * Size-specialized kernels for strided batches of small square matrices.
+ *
+ * For n up to max_size the LU, Cholesky and QR factorizations are done by
+ * templates with the matrix order as a compile-time constant, so that the
+ * compiler fully unrolls and vectorizes them. Kernels are picked at run time
+ * from a table indexed by n.
+ *
+ * Two layouts are available. The native layout factors every matrix in place.
+ * The interleaved layout copies lanes<T>() matrices into a batch-innermost
+ * buffer, element (i, j) of lane l being at (i + j * n) * lanes + l, so that
+ * every scalar operation of the algorithm becomes one SIMD operation across
+ * the lanes. Batches are split across host threads in both cases.
+ *
+ * The results follow the reference LAPACK conventions (1-based pivots,
+ * unit lower L, Householder vectors with tau as in ?larfg) so that they can be
+ * consumed by the generic getrs, potrs and orgqr/ungqr routines.
+ *
+ * Hermitian eigenproblems up to max_eigen_size are solved by cyclic Jacobi
+ * with the same two layouts.
+ */
+
+constexpr int max_size = 32;
+
+template <typename T>
+constexpr int lanes() {
+    return 64 / sizeof(T) < 1 ? 1 : int(64 / sizeof(T));
+}
+
+// The cut-off order and the layout can be tuned through
+// ONEMKL_LAPACK_SMALL_BATCH_CUTOFF (0 disables the specialized kernels) and
+// ONEMKL_LAPACK_SMALL_BATCH_LAYOUT=native|interleaved, read at each batch call.
+inline std::int64_t cutoff() {
+    const char *env = std::getenv("ONEMKL_LAPACK_SMALL_BATCH_CUTOFF");
+    if (env == nullptr)
+        return max_size;
+    return std::min<std::int64_t>(std::max<std::int64_t>(std::atoll(env), 0), max_size);
+}
+
+inline bool interleaved_layout() {
+    const char *env = std::getenv("ONEMKL_LAPACK_SMALL_BATCH_LAYOUT");
+    return env == nullptr || std::strcmp(env, "native") != 0;
+}
+
+template <typename T>
+struct scalar_traits {
+    using real_t = T;
+    static T conj(T x) {
+        return x;
+    }
+    static real_t real(T x) {
+        return x;
+    }
+    static real_t imag(T) {
+        return real_t(0);
+    }
+    static real_t abs1(T x) {
+        return std::abs(x);
+    }
+    static real_t norm(T x) {
+        return x * x;
+    }
+    static T make(real_t re, real_t) {
+        return re;
+    }
+};
+
+template <typename R>
+struct scalar_traits<std::complex<R>> {
+    using real_t = R;
+    static std::complex<R> conj(std::complex<R> x) {
+        return std::conj(x);
+    }
+    static real_t real(std::complex<R> x) {
+        return x.real();
+    }
+    static real_t imag(std::complex<R> x) {
+        return x.imag();
+    }
+    // |re| + |im|, the magnitude used by LAPACK to choose pivots
+    static real_t abs1(std::complex<R> x) {
+        return std::abs(x.real()) + std::abs(x.imag());
+    }
+    static real_t norm(std::complex<R> x) {
+        return x.real() * x.real() + x.imag() * x.imag();
+    }
+    static std::complex<R> make(real_t re, real_t im) {
+        return std::complex<R>(re, im);
+    }
+};
+
+/* LU with partial pivoting, as ?getf2 */
+
+template <typename T, int N>
+lapack_int getrf_native(T *a, std::int64_t lda, std::int64_t *ipiv) {
+    using traits = scalar_traits<T>;
+    lapack_int info = 0;
+    for (int j = 0; j < N; j++) {
+        int p = j;
+        auto max_val = traits::abs1(a[j + j * lda]);
+        for (int i = j + 1; i < N; i++) {
+            const auto val = traits::abs1(a[i + j * lda]);
+            if (val > max_val) {
+                p = i;
+                max_val = val;
+            }
+        }
+        ipiv[j] = p + 1;
+        if (a[p + j * lda] != T(0)) {
+            if (p != j) {
+                for (int c = 0; c < N; c++)
+                    std::swap(a[j + c * lda], a[p + c * lda]);
+            }
+            const T r = T(1) / a[j + j * lda];
+            for (int i = j + 1; i < N; i++)
+                a[i + j * lda] *= r;
+        }
+        else if (info == 0) {
+            info = j + 1;
+        }
+        for (int c = j + 1; c < N; c++) {
+            const T t = a[j + c * lda];
+            for (int i = j + 1; i < N; i++)
+                a[i + c * lda] -= a[i + j * lda] * t;
+        }
+    }
+    return info;
+}
+
+template <typename T, int N>
+void getrf_interleaved(T *w, std::int64_t *ipiv, lapack_int *info) {
+    using traits = scalar_traits<T>;
+    using real_t = typename traits::real_t;
+    constexpr int W = lanes<T>();
+    int p[W];
+    real_t max_val[W];
+    T r[W];
+    for (int l = 0; l < W; l++)
+        info[l] = 0;
+    for (int j = 0; j < N; j++) {
+        for (int l = 0; l < W; l++) {
+            p[l] = j;
+            max_val[l] = traits::abs1(w[(j + j * N) * W + l]);
+        }
+        for (int i = j + 1; i < N; i++) {
+            for (int l = 0; l < W; l++) {
+                const real_t val = traits::abs1(w[(i + j * N) * W + l]);
+                p[l] = val > max_val[l] ? i : p[l];
+                max_val[l] = val > max_val[l] ? val : max_val[l];
+            }
+        }
+        for (int l = 0; l < W; l++) {
+            ipiv[j * W + l] = p[l] + 1;
+            if (p[l] != j) {
+                for (int c = 0; c < N; c++)
+                    std::swap(w[(j + c * N) * W + l], w[(p[l] + c * N) * W + l]);
+            }
+            const T pivot = w[(j + j * N) * W + l];
+            if (pivot == T(0) && info[l] == 0)
+                info[l] = j + 1;
+            r[l] = pivot != T(0) ? T(1) / pivot : T(1);
+        }
+        for (int i = j + 1; i < N; i++) {
+            for (int l = 0; l < W; l++)
+                w[(i + j * N) * W + l] *= r[l];
+        }
+        for (int c = j + 1; c < N; c++) {
+            for (int i = j + 1; i < N; i++) {
+                for (int l = 0; l < W; l++)
+                    w[(i + c * N) * W + l] -= w[(i + j * N) * W + l] * w[(j + c * N) * W + l];
+            }
+        }
+    }
+}
+
+/* Cholesky, as ?potf2. The upper case factors A = U^H U by computing the
+ * lower factor L = U^H on the conjugate transposed storage. */
+
+template <bool Upper>
+inline std::int64_t tri_index(int i, int k, std::int64_t ld) {
+    return Upper ? k + i * ld : i + k * ld;
+}
+
+template <typename T, int N, bool Upper>
+lapack_int potrf_native(T *a, std::int64_t lda) {
+    using traits = scalar_traits<T>;
+    using real_t = typename traits::real_t;
+    auto load = [&](int i, int k) {
+        const T v = a[tri_index<Upper>(i, k, lda)];
+        return Upper ? traits::conj(v) : v;
+    };
+    for (int j = 0; j < N; j++) {
+        real_t ajj = traits::real(a[j + j * lda]);
+        for (int k = 0; k < j; k++)
+            ajj -= traits::norm(a[tri_index<Upper>(j, k, lda)]);
+        if (!(ajj > real_t(0))) {
+            a[j + j * lda] = T(ajj);
+            return j + 1;
+        }
+        ajj = std::sqrt(ajj);
+        a[j + j * lda] = T(ajj);
+        const real_t r = real_t(1) / ajj;
+        for (int i = j + 1; i < N; i++) {
+            T s = load(i, j);
+            for (int k = 0; k < j; k++)
+                s -= load(i, k) * traits::conj(load(j, k));
+            s *= r;
+            a[tri_index<Upper>(i, j, lda)] = Upper ? traits::conj(s) : s;
+        }
+    }
+    return 0;
+}
+
+// Lanes that are not positive definite are only flagged here; their results
+// are recomputed by the native kernel so that the matrix is left exactly as
+// ?potf2 leaves it.
+template <typename T, int N, bool Upper>
+void potrf_interleaved(T *w, lapack_int *info) {
+    using traits = scalar_traits<T>;
+    using real_t = typename traits::real_t;
+    constexpr int W = lanes<T>();
+    real_t ajj[W];
+    T s[W];
+    auto at = [&](int i, int k, int l) -> T & { return w[tri_index<Upper>(i, k, N) * W + l]; };
+    auto load = [&](int i, int k, int l) {
+        return Upper ? traits::conj(at(i, k, l)) : at(i, k, l);
+    };
+    for (int l = 0; l < W; l++)
+        info[l] = 0;
+    for (int j = 0; j < N; j++) {
+        for (int l = 0; l < W; l++)
+            ajj[l] = traits::real(at(j, j, l));
+        for (int k = 0; k < j; k++) {
+            for (int l = 0; l < W; l++)
+                ajj[l] -= traits::norm(at(j, k, l));
+        }
+        for (int l = 0; l < W; l++) {
+            if (!(ajj[l] > real_t(0)) && info[l] == 0)
+                info[l] = j + 1;
+            ajj[l] = ajj[l] > real_t(0) ? std::sqrt(ajj[l]) : real_t(1);
+            at(j, j, l) = T(ajj[l]);
+            ajj[l] = real_t(1) / ajj[l];
+        }
+        for (int i = j + 1; i < N; i++) {
+            for (int l = 0; l < W; l++)
+                s[l] = load(i, j, l);
+            for (int k = 0; k < j; k++) {
+                for (int l = 0; l < W; l++)
+                    s[l] -= load(i, k, l) * traits::conj(load(j, k, l));
+            }
+            for (int l = 0; l < W; l++) {
+                const T v = s[l] * ajj[l];
+                at(i, j, l) = Upper ? traits::conj(v) : v;
+            }
+        }
+    }
+}
+
+/* Householder QR, as ?geqr2 with reflectors generated as in ?larfg */
+
+template <typename T, int N>
+void geqrf_native(T *a, std::int64_t lda, T *tau) {
+    using traits = scalar_traits<T>;
+    using real_t = typename traits::real_t;
+    for (int j = 0; j < N; j++) {
+        const T alpha = a[j + j * lda];
+        real_t xnorm2 = real_t(0);
+        for (int i = j + 1; i < N; i++)
+            xnorm2 += traits::norm(a[i + j * lda]);
+        const real_t alphr = traits::real(alpha);
+        const real_t alphi = traits::imag(alpha);
+        if (xnorm2 == real_t(0) && alphi == real_t(0)) {
+            tau[j] = T(0);
+            continue;
+        }
+        const real_t beta =
+            -std::copysign(std::sqrt(alphr * alphr + alphi * alphi + xnorm2), alphr);
+        const T t = traits::make((beta - alphr) / beta, -alphi / beta);
+        const T scale = T(1) / (alpha - T(beta));
+        for (int i = j + 1; i < N; i++)
+            a[i + j * lda] *= scale;
+        a[j + j * lda] = T(beta);
+        tau[j] = t;
+
+        // Apply H^H = I - conj(tau) v v^H, v = (1, a[j+1:N, j]), to the trailing columns
+        const T ct = traits::conj(t);
+        for (int c = j + 1; c < N; c++) {
+            T s = a[j + c * lda];
+            for (int i = j + 1; i < N; i++)
+                s += traits::conj(a[i + j * lda]) * a[i + c * lda];
+            s *= ct;
+            a[j + c * lda] -= s;
+            for (int i = j + 1; i < N; i++)
+                a[i + c * lda] -= a[i + j * lda] * s;
+        }
+    }
+}
+
+template <typename T, int N>
+void geqrf_interleaved(T *w, T *tau) {
+    using traits = scalar_traits<T>;
+    using real_t = typename traits::real_t;
+    constexpr int W = lanes<T>();
+    real_t xnorm2[W];
+    T ct[W];
+    T scale[W];
+    T s[W];
+    for (int j = 0; j < N; j++) {
+        for (int l = 0; l < W; l++)
+            xnorm2[l] = real_t(0);
+        for (int i = j + 1; i < N; i++) {
+            for (int l = 0; l < W; l++)
+                xnorm2[l] += traits::norm(w[(i + j * N) * W + l]);
+        }
+        for (int l = 0; l < W; l++) {
+            const T alpha = w[(j + j * N) * W + l];
+            const real_t alphr = traits::real(alpha);
+            const real_t alphi = traits::imag(alpha);
+            if (xnorm2[l] == real_t(0) && alphi == real_t(0)) {
+                tau[j * W + l] = T(0);
+                ct[l] = T(0);
+                scale[l] = T(1);
+                continue;
+            }
+            const real_t beta =
+                -std::copysign(std::sqrt(alphr * alphr + alphi * alphi + xnorm2[l]), alphr);
+            const T t = traits::make((beta - alphr) / beta, -alphi / beta);
+            tau[j * W + l] = t;
+            ct[l] = traits::conj(t);
+            scale[l] = T(1) / (alpha - T(beta));
+            w[(j + j * N) * W + l] = T(beta);
+        }
+        for (int i = j + 1; i < N; i++) {
+            for (int l = 0; l < W; l++)
+                w[(i + j * N) * W + l] *= scale[l];
+        }
+        for (int c = j + 1; c < N; c++) {
+            for (int l = 0; l < W; l++)
+                s[l] = w[(j + c * N) * W + l];
+            for (int i = j + 1; i < N; i++) {
+                for (int l = 0; l < W; l++)
+                    s[l] += traits::conj(w[(i + j * N) * W + l]) * w[(i + c * N) * W + l];
+            }
+            for (int l = 0; l < W; l++) {
+                s[l] *= ct[l];
+                w[(j + c * N) * W + l] -= s[l];
+            }
+            for (int i = j + 1; i < N; i++) {
+                for (int l = 0; l < W; l++)
+                    w[(i + c * N) * W + l] -= w[(i + j * N) * W + l] * s[l];
+            }
+        }
+    }
+}
+
+/* Cyclic Jacobi for Hermitian eigenproblems, replacing ?syevd/?heevd.
+ *
+ * Each rotation is computed on the real pair obtained by moving the phase of
+ * a(p, q) into column q, so the same code serves the real and the complex
+ * case. The full matrix is iterated on, since one rotation touches two rows
+ * and two columns. Eigenvalues are returned in ascending order with the
+ * eigenvectors in the matching columns, as ?syevd returns them. */
+
+constexpr int max_eigen_size = 16;
+constexpr int max_sweeps = 30;
+
+template <typename T>
+void jacobi_rotation(T app, T aqq, T apq, typename scalar_traits<T>::real_t &c,
+                     typename scalar_traits<T>::real_t &s, T &omega) {
+    using traits = scalar_traits<T>;
+    using real_t = typename traits::real_t;
+    const real_t mag = std::sqrt(traits::norm(apq));
+    if (mag == real_t(0)) {
+        c = real_t(1);
+        s = real_t(0);
+        omega = T(1);
+        return;
+    }
+    omega = traits::conj(apq) / mag;
+    const real_t theta = (traits::real(aqq) - traits::real(app)) / (2 * mag);
+    const real_t t =
+        std::copysign(real_t(1), theta) / (std::abs(theta) + std::sqrt(theta * theta + 1));
+    c = real_t(1) / std::sqrt(t * t + 1);
+    s = t * c;
+}
+
+// Copies the referenced triangle of a Hermitian matrix into a full n x n matrix.
+template <typename T>
+void hermitian_to_full(const T *a, std::int64_t lda, bool upper, int n, T *m) {
+    using traits = scalar_traits<T>;
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < n; i++) {
+            const bool stored = upper ? i <= j : i >= j;
+            m[i + j * n] = stored ? a[i + j * lda] : traits::conj(a[j + i * lda]);
+        }
+        m[j + j * n] = T(traits::real(m[j + j * n]));
+    }
+}
+
+template <typename T, int N, bool Vectors>
+lapack_int heevd_native(T *a, std::int64_t lda, typename scalar_traits<T>::real_t *w,
+                        bool upper) {
+    using traits = scalar_traits<T>;
+    using real_t = typename traits::real_t;
+    const real_t eps = std::numeric_limits<real_t>::epsilon();
+    T m[N * N];
+    T v[Vectors ? N * N : 1];
+    hermitian_to_full(a, lda, upper, N, m);
+    if (Vectors) {
+        for (int j = 0; j < N; j++) {
+            for (int i = 0; i < N; i++)
+                v[i + j * N] = T(i == j ? 1 : 0);
+        }
+    }
+    real_t total = real_t(0);
+    for (int i = 0; i < N * N; i++)
+        total += traits::norm(m[i]);
+
+    bool converged = false;
+    for (int sweep = 0; sweep < max_sweeps && !converged; sweep++) {
+        real_t off = real_t(0);
+        for (int q = 1; q < N; q++) {
+            for (int p = 0; p < q; p++)
+                off += traits::norm(m[p + q * N]);
+        }
+        converged = off <= eps * eps * total;
+        if (converged)
+            break;
+        for (int p = 0; p < N - 1; p++) {
+            for (int q = p + 1; q < N; q++) {
+                real_t c, s;
+                T omega;
+                jacobi_rotation(m[p + p * N], m[q + q * N], m[p + q * N], c, s, omega);
+                const T phase = traits::conj(omega);
+                for (int k = 0; k < N; k++) {
+                    const T x = m[k + p * N];
+                    const T y = m[k + q * N];
+                    m[k + p * N] = c * x - s * omega * y;
+                    m[k + q * N] = s * x + c * omega * y;
+                }
+                for (int k = 0; k < N; k++) {
+                    const T x = m[p + k * N];
+                    const T y = m[q + k * N];
+                    m[p + k * N] = c * x - s * phase * y;
+                    m[q + k * N] = s * x + c * phase * y;
+                }
+                m[p + q * N] = T(0);
+                m[q + p * N] = T(0);
+                if (Vectors) {
+                    for (int k = 0; k < N; k++) {
+                        const T x = v[k + p * N];
+                        const T y = v[k + q * N];
+                        v[k + p * N] = c * x - s * omega * y;
+                        v[k + q * N] = s * x + c * omega * y;
+                    }
+                }
+            }
+        }
+    }
+    if (!converged)
+        return 1;
+
+    // Selection sort of the eigenvalues, moving the eigenvectors along
+    int order[N];
+    real_t d[N];
+    for (int i = 0; i < N; i++) {
+        order[i] = i;
+        d[i] = traits::real(m[i + i * N]);
+    }
+    for (int i = 0; i < N - 1; i++) {
+        int k = i;
+        for (int j = i + 1; j < N; j++)
+            k = d[j] < d[k] ? j : k;
+        std::swap(d[i], d[k]);
+        std::swap(order[i], order[k]);
+    }
+    for (int j = 0; j < N; j++) {
+        w[j] = d[j];
+        if (Vectors) {
+            for (int i = 0; i < N; i++)
+                a[i + j * lda] = v[i + order[j] * N];
+        }
+    }
+    return 0;
+}
+
+// Lanes that do not converge within max_sweeps are only flagged; the caller
+// recomputes them with the full ?syevd/?heevd.
+template <typename T, int N, bool Vectors>
+void heevd_interleaved(T *m, typename scalar_traits<T>::real_t *w, lapack_int *info) {
+    using traits = scalar_traits<T>;
+    using real_t = typename traits::real_t;
+    constexpr int W = lanes<T>();
+    const real_t eps = std::numeric_limits<real_t>::epsilon();
+    T v[Vectors ? N * N * W : 1];
+    real_t total[W];
+    real_t off[W];
+    real_t c[W];
+    real_t s[W];
+    T omega[W];
+    if (Vectors) {
+        for (int j = 0; j < N; j++) {
+            for (int i = 0; i < N; i++) {
+                for (int l = 0; l < W; l++)
+                    v[(i + j * N) * W + l] = T(i == j ? 1 : 0);
+            }
+        }
+    }
+    for (int l = 0; l < W; l++)
+        total[l] = real_t(0);
+    for (int i = 0; i < N * N; i++) {
+        for (int l = 0; l < W; l++)
+            total[l] += traits::norm(m[i * W + l]);
+    }
+
+    bool converged = false;
+    for (int sweep = 0; sweep < max_sweeps && !converged; sweep++) {
+        for (int l = 0; l < W; l++)
+            off[l] = real_t(0);
+        for (int q = 1; q < N; q++) {
+            for (int p = 0; p < q; p++) {
+                for (int l = 0; l < W; l++)
+                    off[l] += traits::norm(m[(p + q * N) * W + l]);
+            }
+        }
+        converged = true;
+        for (int l = 0; l < W; l++)
+            converged = converged && off[l] <= eps * eps * total[l];
+        if (converged)
+            break;
+        for (int p = 0; p < N - 1; p++) {
+            for (int q = p + 1; q < N; q++) {
+                for (int l = 0; l < W; l++) {
+                    jacobi_rotation(m[(p + p * N) * W + l], m[(q + q * N) * W + l],
+                                    m[(p + q * N) * W + l], c[l], s[l], omega[l]);
+                }
+                for (int k = 0; k < N; k++) {
+                    for (int l = 0; l < W; l++) {
+                        const T x = m[(k + p * N) * W + l];
+                        const T y = m[(k + q * N) * W + l];
+                        m[(k + p * N) * W + l] = c[l] * x - s[l] * omega[l] * y;
+                        m[(k + q * N) * W + l] = s[l] * x + c[l] * omega[l] * y;
+                    }
+                }
+                for (int k = 0; k < N; k++) {
+                    for (int l = 0; l < W; l++) {
+                        const T phase = traits::conj(omega[l]);
+                        const T x = m[(p + k * N) * W + l];
+                        const T y = m[(q + k * N) * W + l];
+                        m[(p + k * N) * W + l] = c[l] * x - s[l] * phase * y;
+                        m[(q + k * N) * W + l] = s[l] * x + c[l] * phase * y;
+                    }
+                }
+                for (int l = 0; l < W; l++) {
+                    m[(p + q * N) * W + l] = T(0);
+                    m[(q + p * N) * W + l] = T(0);
+                }
+                if (Vectors) {
+                    for (int k = 0; k < N; k++) {
+                        for (int l = 0; l < W; l++) {
+                            const T x = v[(k + p * N) * W + l];
+                            const T y = v[(k + q * N) * W + l];
+                            v[(k + p * N) * W + l] = c[l] * x - s[l] * omega[l] * y;
+                            v[(k + q * N) * W + l] = s[l] * x + c[l] * omega[l] * y;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    for (int l = 0; l < W; l++) {
+        info[l] = off[l] <= eps * eps * total[l] ? 0 : 1;
+        int order[N];
+        real_t d[N];
+        for (int i = 0; i < N; i++) {
+            order[i] = i;
+            d[i] = traits::real(m[(i + i * N) * W + l]);
+        }
+        for (int i = 0; i < N - 1; i++) {
+            int k = i;
+            for (int j = i + 1; j < N; j++)
+                k = d[j] < d[k] ? j : k;
+            std::swap(d[i], d[k]);
+            std::swap(order[i], order[k]);
+        }
+        for (int j = 0; j < N; j++) {
+            w[j * W + l] = d[j];
+            if (Vectors) {
+                for (int i = 0; i < N; i++)
+                    m[(i + j * N) * W + l] = v[(i + order[j] * N) * W + l];
+            }
+        }
+    }
+}
+
+/* Dispatch table */
+
+template <typename T>
+struct kernels {
+    lapack_int (*getrf)(T *, std::int64_t, std::int64_t *);
+    void (*getrf_interleaved)(T *, std::int64_t *, lapack_int *);
+    lapack_int (*potrf_lower)(T *, std::int64_t);
+    lapack_int (*potrf_upper)(T *, std::int64_t);
+    void (*potrf_lower_interleaved)(T *, lapack_int *);
+    void (*potrf_upper_interleaved)(T *, lapack_int *);
+    void (*geqrf)(T *, std::int64_t, T *);
+    void (*geqrf_interleaved)(T *, T *);
+};
+
+template <typename T, int N>
+constexpr kernels<T> make_kernels() {
+    return { &getrf_native<T, N>,          &getrf_interleaved<T, N>,
+             &potrf_native<T, N, false>,   &potrf_native<T, N, true>,
+             &potrf_interleaved<T, N, false>, &potrf_interleaved<T, N, true>,
+             &geqrf_native<T, N>,          &geqrf_interleaved<T, N> };
+}
+
+template <typename T, std::size_t... I>
+const kernels<T> &kernels_for(std::int64_t n, std::index_sequence<I...>) {
+    static const kernels<T> table[] = { make_kernels<T, int(I) + 1>()... };
+    return table[n - 1];
+}
+
+template <typename T>
+const kernels<T> &kernels_for(std::int64_t n) {
+    return kernels_for<T>(n, std::make_index_sequence<max_size>());
+}
+
+template <typename T>
+struct eigen_kernels {
+    using real_t = typename scalar_traits<T>::real_t;
+    lapack_int (*heevd)(T *, std::int64_t, real_t *, bool);
+    lapack_int (*heevd_novec)(T *, std::int64_t, real_t *, bool);
+    void (*heevd_interleaved)(T *, real_t *, lapack_int *);
+    void (*heevd_novec_interleaved)(T *, real_t *, lapack_int *);
+};
+
+template <typename T, int N>
+constexpr eigen_kernels<T> make_eigen_kernels() {
+    return { &heevd_native<T, N, true>, &heevd_native<T, N, false>,
+             &heevd_interleaved<T, N, true>, &heevd_interleaved<T, N, false> };
+}
+
+template <typename T, std::size_t... I>
+const eigen_kernels<T> &eigen_kernels_for(std::int64_t n, std::index_sequence<I...>) {
+    static const eigen_kernels<T> table[] = { make_eigen_kernels<T, int(I) + 1>()... };
+    return table[n - 1];
+}
+
+template <typename T>
+const eigen_kernels<T> &eigen_kernels_for(std::int64_t n) {
+    return eigen_kernels_for<T>(n, std::make_index_sequence<max_eigen_size>());
+}
+
+inline bool applicable(std::int64_t m, std::int64_t n, std::int64_t lda, std::int64_t batch_size) {
+    return m == n && n >= 1 && n <= cutoff() && lda >= n && batch_size > 0;
+}
+
+// Runs a strided batch in chunks of lanes<T>() problems spread over the host
+// threads. Full chunks go through interleaved(work, first, infos) when the
+// interleaved layout is selected, the others through native(i).
+template <typename T, typename Interleaved, typename Native>
+void run_chunks(const std::string &function, std::int64_t n, std::int64_t batch_size,
+                Interleaved interleaved, Native native) {
+    constexpr int W = lanes<T>();
+    const bool use_interleaved = interleaved_layout();
+    const std::int64_t num_chunks = (batch_size + W - 1) / W;
+    batch_failures failures(num_chunks);
+    parallel_for_blocks(num_chunks, [&](std::int64_t t, std::int64_t begin, std::int64_t end) {
+        std::vector<T> work(use_interleaved ? n * n * W : 0);
+        lapack_int infos[W];
+        for (std::int64_t chunk = begin; chunk < end; chunk++) {
+            const std::int64_t first = chunk * W;
+            const std::int64_t count = std::min<std::int64_t>(W, batch_size - first);
+            if (use_interleaved && count == W) {
+                interleaved(work.data(), first, infos);
+                for (int l = 0; l < W; l++) {
+                    if (infos[l] != 0)
+                        failures.add(t, first + l, infos[l]);
+                }
+            }
+            else {
+                for (std::int64_t i = first; i < first + count; i++) {
+                    const lapack_int info = native(i);
+                    if (info != 0)
+                        failures.add(t, i, info);
+                }
+            }
+        }
+    });
+    failures.throw_if_any(function);
+}
+
+template <typename T>
+void pack(const T *a, std::int64_t n, std::int64_t lda, std::int64_t stride_a, T *w) {
+    constexpr int W = lanes<T>();
+    for (std::int64_t j = 0; j < n; j++) {
+        for (std::int64_t i = 0; i < n; i++) {
+            for (int l = 0; l < W; l++)
+                w[(i + j * n) * W + l] = a[l * stride_a + i + j * lda];
+        }
+    }
+}
+
+template <typename T>
+void unpack(const T *w, std::int64_t n, std::int64_t lda, std::int64_t stride_a, T *a,
+            const bool *skip = nullptr) {
+    constexpr int W = lanes<T>();
+    for (std::int64_t j = 0; j < n; j++) {
+        for (std::int64_t i = 0; i < n; i++) {
+            for (int l = 0; l < W; l++) {
+                if (skip == nullptr || !skip[l])
+                    a[l * stride_a + i + j * lda] = w[(i + j * n) * W + l];
+            }
+        }
+    }
+}
+
+template <typename T>
+void pack_hermitian(const T *a, std::int64_t n, std::int64_t lda, std::int64_t stride_a, bool upper,
+                    T *w) {
+    using traits = scalar_traits<T>;
+    constexpr int W = lanes<T>();
+    for (std::int64_t j = 0; j < n; j++) {
+        for (std::int64_t i = 0; i < n; i++) {
+            const bool stored = upper ? i <= j : i >= j;
+            const std::int64_t src = stored ? i + j * lda : j + i * lda;
+            for (int l = 0; l < W; l++) {
+                const T x = a[l * stride_a + src];
+                w[(i + j * n) * W + l] = i == j ? T(traits::real(x)) : stored ? x : traits::conj(x);
+            }
+        }
+    }
+}
+
+/* Entry points used by the strided batch routines. They return false when the
+ * problem is not covered by the specialized kernels. */
+
+template <typename T>
+bool getrf_batch(const std::string &function, std::int64_t m, std::int64_t n, T *a,
+                 std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
+                 std::int64_t stride_ipiv, std::int64_t batch_size) {
+    if (!applicable(m, n, lda, batch_size))
+        return false;
+    constexpr int W = lanes<T>();
+    const kernels<T> &k = kernels_for<T>(n);
+    run_chunks<T>(
+        function, n, batch_size,
+        [&](T *work, std::int64_t first, lapack_int *infos) {
+            std::int64_t piv[max_size * W];
+            pack(a + first * stride_a, n, lda, stride_a, work);
+            k.getrf_interleaved(work, piv, infos);
+            unpack(work, n, lda, stride_a, a + first * stride_a);
+            for (std::int64_t j = 0; j < n; j++) {
+                for (int l = 0; l < W; l++)
+                    ipiv[(first + l) * stride_ipiv + j] = piv[j * W + l];
+            }
+        },
+        [&](std::int64_t i) { return k.getrf(a + i * stride_a, lda, ipiv + i * stride_ipiv); });
+    return true;
+}
+
+template <typename T>
+bool potrf_batch(const std::string &function, bool upper, std::int64_t n, T *a,
+                 std::int64_t lda, std::int64_t stride_a, std::int64_t batch_size) {
+    if (!applicable(n, n, lda, batch_size))
+        return false;
+    constexpr int W = lanes<T>();
+    const kernels<T> &k = kernels_for<T>(n);
+    auto native = upper ? k.potrf_upper : k.potrf_lower;
+    auto interleaved = upper ? k.potrf_upper_interleaved : k.potrf_lower_interleaved;
+    run_chunks<T>(
+        function, n, batch_size,
+        [&](T *work, std::int64_t first, lapack_int *infos) {
+            bool failed[W];
+            pack(a + first * stride_a, n, lda, stride_a, work);
+            interleaved(work, infos);
+            for (int l = 0; l < W; l++)
+                failed[l] = infos[l] != 0;
+            unpack(work, n, lda, stride_a, a + first * stride_a, failed);
+            for (int l = 0; l < W; l++) {
+                if (failed[l])
+                    infos[l] = native(a + (first + l) * stride_a, lda);
+            }
+        },
+        [&](std::int64_t i) { return native(a + i * stride_a, lda); });
+    return true;
+}
+
+template <typename T>
+bool geqrf_batch(const std::string &function, std::int64_t m, std::int64_t n, T *a,
+                 std::int64_t lda, std::int64_t stride_a, T *tau, std::int64_t stride_tau,
+                 std::int64_t batch_size) {
+    if (!applicable(m, n, lda, batch_size))
+        return false;
+    constexpr int W = lanes<T>();
+    const kernels<T> &k = kernels_for<T>(n);
+    run_chunks<T>(
+        function, n, batch_size,
+        [&](T *work, std::int64_t first, lapack_int *infos) {
+            T t[max_size * W];
+            pack(a + first * stride_a, n, lda, stride_a, work);
+            k.geqrf_interleaved(work, t);
+            unpack(work, n, lda, stride_a, a + first * stride_a);
+            for (std::int64_t j = 0; j < n; j++) {
+                for (int l = 0; l < W; l++)
+                    tau[(first + l) * stride_tau + j] = t[j * W + l];
+            }
+            for (int l = 0; l < W; l++)
+                infos[l] = 0;
+        },
+        [&](std::int64_t i) {
+            k.geqrf(a + i * stride_a, lda, tau + i * stride_tau);
+            return lapack_int(0);
+        });
+    return true;
+}
+
+// fallback(i) solves problem i with the full ?syevd/?heevd; it is used for
+// the problems on which the Jacobi iteration does not converge.
+template <typename T, typename Fallback>
+bool heevd_batch(const std::string &function, bool vectors, bool upper, std::int64_t n, T *a,
+                 std::int64_t lda, std::int64_t stride_a, typename scalar_traits<T>::real_t *w,
+                 std::int64_t stride_w, std::int64_t batch_size, Fallback fallback) {
+    using real_t = typename scalar_traits<T>::real_t;
+    if (!applicable(n, n, lda, batch_size) || n > max_eigen_size)
+        return false;
+    constexpr int W = lanes<T>();
+    const eigen_kernels<T> &k = eigen_kernels_for<T>(n);
+    auto native = vectors ? k.heevd : k.heevd_novec;
+    auto interleaved = vectors ? k.heevd_interleaved : k.heevd_novec_interleaved;
+    auto solve = [=](std::int64_t i) {
+        const lapack_int info = native(a + i * stride_a, lda, w + i * stride_w, upper);
+        return info == 0 ? info : fallback(i);
+    };
+    run_chunks<T>(
+        function, n, batch_size,
+        [&](T *work, std::int64_t first, lapack_int *infos) {
+            real_t values[max_eigen_size * W];
+            bool failed[W];
+            pack_hermitian(a + first * stride_a, n, lda, stride_a, upper, work);
+            interleaved(work, values, infos);
+            for (int l = 0; l < W; l++)
+                failed[l] = infos[l] != 0;
+            if (vectors)
+                unpack(work, n, lda, stride_a, a + first * stride_a, failed);
+            for (std::int64_t j = 0; j < n; j++) {
+                for (int l = 0; l < W; l++) {
+                    if (!failed[l])
+                        w[(first + l) * stride_w + j] = values[j * W + l];
+                }
+            }
+            for (int l = 0; l < W; l++) {
+                if (failed[l])
+                    infos[l] = fallback(first + l);
+            }
+        },
+        solve);
+    return true;
+}
+
+} // namespace small_batch
+} // namespace netlib
+} // namespace lapack
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_NETLIB_LAPACK_SMALL_BATCH_HPP_
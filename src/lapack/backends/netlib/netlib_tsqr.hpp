@@ -0,0 +1,356 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_LAPACK_TSQR_HPP_
+#define _NETLIB_LAPACK_TSQR_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include "netlib_common.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace lapack {
+namespace netlib {
+namespace tsqr {
+
+/**
+ * Tall-skinny QR (TSQR) for geqrf and orgqr/ungqr when m is much larger than n.
+ *
+ * The rows of A are split into one block per host thread. Every block is
+ * factored by LAPACKE in parallel, the stacked n x n R factors are factored
+ * once more, and the explicit Q of the whole matrix is formed block by block.
+ * The Householder vectors are then reconstructed from Q by an LU factorization
+ * of Q - S without pivoting, S being a diagonal of signs (Ballard et al.,
+ * "Reconstructing Householder vectors from Tall-Skinny QR"). The output is
+ * therefore exactly in the geqrf format (unit lower V below the diagonal, R on
+ * and above it, tau the diagonal of the triangular factor of the compact WY
+ * form) and can be consumed by the generic ormqr/orgqr routines.
+ *
+ * orgqr/ungqr with k = n forms Q = [I; 0] - V T V1^H, T being computed from
+ * the Gram matrix V^H V, so that every row block is processed independently.
+ */
+
+// Smallest m / n for which the row-parallel path is used. It can be tuned
+// through ONEMKL_LAPACK_TSQR_RATIO, 0 disabling it.
+constexpr std::int64_t default_ratio = 16;
+
+// Smallest number of rows of a block, in multiples of n, and rows of a block
+// processed at once by the row kernels.
+constexpr std::int64_t min_block_factor = 4;
+constexpr std::int64_t row_chunk = 256;
+
+inline std::int64_t ratio() {
+    static const std::int64_t value = [] {
+        const char *env = std::getenv("ONEMKL_LAPACK_TSQR_RATIO");
+        if (env == nullptr)
+            return default_ratio;
+        return std::max<std::int64_t>(std::atoll(env), 0);
+    }();
+    return value;
+}
+
+// Number of row blocks for an m x n problem, TSQR being used when it is at
+// least two.
+inline std::int64_t num_blocks(std::int64_t m, std::int64_t n) {
+    if (ratio() == 0 || n < 1 || m < ratio() * n)
+        return 1;
+    return batch_threads(m / (min_block_factor * n));
+}
+
+inline lapack_int lapacke_geqrf(lapack_int m, lapack_int n, float *a, lapack_int lda, float *tau) {
+    return LAPACKE_sgeqrf(LAPACK_COL_MAJOR, m, n, a, lda, tau);
+}
+inline lapack_int lapacke_geqrf(lapack_int m, lapack_int n, double *a, lapack_int lda,
+                                double *tau) {
+    return LAPACKE_dgeqrf(LAPACK_COL_MAJOR, m, n, a, lda, tau);
+}
+inline lapack_int lapacke_geqrf(lapack_int m, lapack_int n, std::complex<float> *a,
+                                lapack_int lda, std::complex<float> *tau) {
+    return LAPACKE_cgeqrf(LAPACK_COL_MAJOR, m, n, a, lda, tau);
+}
+inline lapack_int lapacke_geqrf(lapack_int m, lapack_int n, std::complex<double> *a,
+                                lapack_int lda, std::complex<double> *tau) {
+    return LAPACKE_zgeqrf(LAPACK_COL_MAJOR, m, n, a, lda, tau);
+}
+
+inline lapack_int lapacke_orgqr(lapack_int m, lapack_int n, lapack_int k, float *a, lapack_int lda,
+                                const float *tau) {
+    return LAPACKE_sorgqr(LAPACK_COL_MAJOR, m, n, k, a, lda, tau);
+}
+inline lapack_int lapacke_orgqr(lapack_int m, lapack_int n, lapack_int k, double *a,
+                                lapack_int lda, const double *tau) {
+    return LAPACKE_dorgqr(LAPACK_COL_MAJOR, m, n, k, a, lda, tau);
+}
+inline lapack_int lapacke_orgqr(lapack_int m, lapack_int n, lapack_int k, std::complex<float> *a,
+                                lapack_int lda, const std::complex<float> *tau) {
+    return LAPACKE_cungqr(LAPACK_COL_MAJOR, m, n, k, a, lda, tau);
+}
+inline lapack_int lapacke_orgqr(lapack_int m, lapack_int n, lapack_int k, std::complex<double> *a,
+                                lapack_int lda, const std::complex<double> *tau) {
+    return LAPACKE_zungqr(LAPACK_COL_MAJOR, m, n, k, a, lda, tau);
+}
+
+inline float conjugate(float x) {
+    return x;
+}
+inline double conjugate(double x) {
+    return x;
+}
+template <typename R>
+inline std::complex<R> conjugate(std::complex<R> x) {
+    return std::conj(x);
+}
+
+// Unit-modulus d such that |1 - d * x| = 1 + |x|.
+inline float opposite_sign(float x) {
+    return x < 0.0f ? 1.0f : -1.0f;
+}
+inline double opposite_sign(double x) {
+    return x < 0.0 ? 1.0 : -1.0;
+}
+template <typename R>
+inline std::complex<R> opposite_sign(std::complex<R> x) {
+    const R r = std::abs(x);
+    return r == R(0) ? std::complex<R>(-1) : -std::conj(x) / r;
+}
+
+// a <- a * m for the rows x n matrix a, m being n x n.
+template <typename T>
+void right_multiply(std::int64_t rows, std::int64_t n, T *a, std::int64_t lda, const T *m) {
+    std::vector<T> chunk(row_chunk * n);
+    for (std::int64_t r0 = 0; r0 < rows; r0 += row_chunk) {
+        const std::int64_t nr = std::min(row_chunk, rows - r0);
+        for (std::int64_t k = 0; k < n; k++)
+            std::copy(a + r0 + k * lda, a + r0 + nr + k * lda, chunk.data() + k * nr);
+        for (std::int64_t j = 0; j < n; j++) {
+            T *out = a + r0 + j * lda;
+            std::fill(out, out + nr, T(0));
+            for (std::int64_t k = 0; k < n; k++) {
+                const T mkj = m[k + j * n];
+                const T *in = chunk.data() + k * nr;
+                for (std::int64_t i = 0; i < nr; i++)
+                    out[i] += in[i] * mkj;
+            }
+        }
+    }
+}
+
+// Runs f(block, first_row, rows) for every row block, returning the first
+// non-zero info.
+template <typename F>
+lapack_int for_each_block(std::int64_t m, std::int64_t p, F f) {
+    std::vector<lapack_int> infos(p, 0);
+    parallel_for_blocks(p, [&](std::int64_t, std::int64_t begin, std::int64_t end) {
+        for (std::int64_t b = begin; b < end; b++)
+            infos[b] = f(b, m * b / p, m * (b + 1) / p - m * b / p);
+    });
+    for (auto info : infos) {
+        if (info != 0)
+            return info;
+    }
+    return 0;
+}
+
+template <typename T>
+lapack_int geqrf(std::int64_t m, std::int64_t n, T *a, std::int64_t lda, T *tau) {
+    const std::int64_t p = num_blocks(m, n);
+    if (p < 2)
+        return lapacke_geqrf(m, n, a, lda, tau);
+
+    // Factor every row block.
+    std::vector<T> block_tau(p * n);
+    lapack_int info =
+        for_each_block(m, p, [&](std::int64_t b, std::int64_t first, std::int64_t rows) {
+            return lapacke_geqrf(rows, n, a + first, lda, block_tau.data() + b * n);
+        });
+    if (info != 0)
+        return info;
+
+    // Factor the stacked R factors and form their Q, whose n x n block b is
+    // the coefficient C_b of the Q of row block b.
+    const std::int64_t lds = p * n;
+    std::vector<T> s(lds * n, T(0));
+    for (std::int64_t b = 0; b < p; b++) {
+        const T *r = a + m * b / p;
+        for (std::int64_t j = 0; j < n; j++)
+            std::copy(r + j * lda, r + j * lda + j + 1, s.data() + b * n + j * lds);
+    }
+    std::vector<T> s_tau(n);
+    info = lapacke_geqrf(lds, n, s.data(), lds, s_tau.data());
+    std::vector<T> r(n * n, T(0));
+    for (std::int64_t j = 0; j < n && info == 0; j++)
+        std::copy(s.data() + j * lds, s.data() + j * lds + j + 1, r.data() + j * n);
+    if (info == 0)
+        info = lapacke_orgqr(lds, n, n, s.data(), lds, s_tau.data());
+    if (info == 0) {
+        info = for_each_block(m, p, [&](std::int64_t b, std::int64_t first, std::int64_t rows) {
+            return lapacke_orgqr(rows, n, n, a + first, lda, block_tau.data() + b * n);
+        });
+    }
+    if (info != 0)
+        return info;
+
+    // LU factorization of [I; 0] - Q D, the signs d being picked column by
+    // column so that every pivot is 1 + |x| >= 1. Q1 is the top n x n of Q.
+    std::vector<T> q1(n * n, T(0));
+    for (std::int64_t j = 0; j < n; j++) {
+        for (std::int64_t k = 0; k < n; k++) {
+            const T ckj = s[k + j * lds];
+            for (std::int64_t i = 0; i < n; i++)
+                q1[i + j * n] += a[i + k * lda] * ckj;
+        }
+    }
+    std::vector<T> l(n * n, T(0)), u(n * n, T(0)), d(n);
+    for (std::int64_t j = 0; j < n; j++) {
+        T *x = q1.data() + j * n;
+        for (std::int64_t k = 0; k < j; k++) {
+            for (std::int64_t i = k + 1; i < n; i++)
+                x[i] -= l[i + k * n] * x[k];
+        }
+        d[j] = opposite_sign(x[j]);
+        for (std::int64_t i = 0; i < j; i++)
+            u[i + j * n] = -d[j] * x[i];
+        u[j + j * n] = T(1) - d[j] * x[j];
+        for (std::int64_t i = j + 1; i < n; i++)
+            l[i + j * n] = -d[j] * x[i] / u[j + j * n];
+    }
+
+    // V of row block b is Q_b C_b D (-U^-1), Q_b being its explicit Q.
+    std::vector<T> coefficients(p * n * n);
+    for (std::int64_t b = 0; b < p; b++) {
+        T *mb = coefficients.data() + b * n * n;
+        for (std::int64_t j = 0; j < n; j++) {
+            for (std::int64_t i = 0; i < n; i++) {
+                T y = -s[b * n + i + j * lds] * d[j];
+                for (std::int64_t k = 0; k < j; k++)
+                    y -= mb[i + k * n] * u[k + j * n];
+                mb[i + j * n] = y / u[j + j * n];
+            }
+        }
+    }
+    for_each_block(m, p, [&](std::int64_t b, std::int64_t first, std::int64_t rows) {
+        right_multiply(rows, n, a + first, lda, coefficients.data() + b * n * n);
+        return lapack_int(0);
+    });
+
+    // A = (Q D) (D^H R): the top rows hold V1 below the diagonal and D^H R.
+    for (std::int64_t j = 0; j < n; j++) {
+        for (std::int64_t i = 0; i <= j; i++)
+            a[i + j * lda] = conjugate(d[i]) * r[i + j * n];
+        for (std::int64_t i = j + 1; i < n; i++)
+            a[i + j * lda] = l[i + j * n];
+        tau[j] = u[j + j * n];
+    }
+    return 0;
+}
+
+template <typename T>
+lapack_int orgqr(std::int64_t m, std::int64_t n, std::int64_t k, T *a, std::int64_t lda,
+                 const T *tau) {
+    const std::int64_t p = num_blocks(m, n);
+    if (p < 2 || k != n)
+        return lapacke_orgqr(m, n, k, a, lda, tau);
+
+    // V1, the unit lower top n x n block of V.
+    std::vector<T> v1(n * n, T(0));
+    for (std::int64_t j = 0; j < n; j++) {
+        v1[j + j * n] = T(1);
+        std::copy(a + j + 1 + j * lda, a + n + j * lda, v1.data() + j + 1 + j * n);
+    }
+
+    // Gram matrix G = V^H V, accumulated per row block below V1.
+    std::vector<T> partial(p * n * n, T(0));
+    for_each_block(m - n, p, [&](std::int64_t b, std::int64_t first, std::int64_t rows) {
+        T *g = partial.data() + b * n * n;
+        const T *v = a + n + first;
+        for (std::int64_t r0 = 0; r0 < rows; r0 += row_chunk) {
+            const std::int64_t nr = std::min(row_chunk, rows - r0);
+            for (std::int64_t j = 0; j < n; j++) {
+                for (std::int64_t i = 0; i <= j; i++) {
+                    T sum(0);
+                    for (std::int64_t r = r0; r < r0 + nr; r++)
+                        sum += conjugate(v[r + i * lda]) * v[r + j * lda];
+                    g[i + j * n] += sum;
+                }
+            }
+        }
+        return lapack_int(0);
+    });
+    std::vector<T> g(n * n, T(0));
+    for (std::int64_t j = 0; j < n; j++) {
+        for (std::int64_t i = 0; i <= j; i++) {
+            T sum(0);
+            for (std::int64_t r = j; r < n; r++)
+                sum += conjugate(v1[r + i * n]) * v1[r + j * n];
+            for (std::int64_t b = 0; b < p; b++)
+                sum += partial[b * n * n + i + j * n];
+            g[i + j * n] = sum;
+        }
+    }
+
+    // T of the compact WY form, as in ?larft: T(0:j, j) = -tau(j) T(0:j, 0:j) G(0:j, j).
+    std::vector<T> t(n * n, T(0));
+    for (std::int64_t j = 0; j < n; j++) {
+        for (std::int64_t i = 0; i < j; i++) {
+            T sum(0);
+            for (std::int64_t q = i; q < j; q++)
+                sum += t[i + q * n] * g[q + j * n];
+            t[i + j * n] = -tau[j] * sum;
+        }
+        t[j + j * n] = tau[j];
+    }
+
+    // W = T V1^H, so that Q = [I; 0] - V W.
+    std::vector<T> w(n * n, T(0));
+    for (std::int64_t j = 0; j < n; j++) {
+        for (std::int64_t i = 0; i < n; i++) {
+            T sum(0);
+            for (std::int64_t q = i; q <= j; q++)
+                sum += t[i + q * n] * conjugate(v1[j + q * n]);
+            w[i + j * n] = -sum;
+        }
+    }
+    for_each_block(m - n, p, [&](std::int64_t, std::int64_t first, std::int64_t rows) {
+        right_multiply(rows, n, a + n + first, lda, w.data());
+        return lapack_int(0);
+    });
+    for (std::int64_t j = 0; j < n; j++) {
+        for (std::int64_t i = 0; i < n; i++) {
+            T sum(i == j ? T(1) : T(0));
+            for (std::int64_t q = 0; q <= i; q++)
+                sum += v1[i + q * n] * w[q + j * n];
+            a[i + j * lda] = sum;
+        }
+    }
+    return 0;
+}
+
+} // namespace tsqr
+} // namespace netlib
+} // namespace lapack
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_NETLIB_LAPACK_TSQR_HPP_
@@ -1831,5 +1831,639 @@ typedef struct {
                                                       std::int64_t *n, std::int64_t *k,
                                                       std::int64_t *lda, std::int64_t group_count,
                                                       std::int64_t *group_sizes);
+    void (*sgesv_sycl)(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                       sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+                       sycl::buffer<float> &b, std::int64_t ldb, sycl::buffer<float> &scratchpad,
+                       std::int64_t scratchpad_size);
+    void (*dgesv_sycl)(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                       sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+                       sycl::buffer<double> &b, std::int64_t ldb, sycl::buffer<double> &scratchpad,
+                       std::int64_t scratchpad_size);
+    void (*cgesv_sycl)(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                       sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                       sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<float>> &b,
+                       std::int64_t ldb, sycl::buffer<std::complex<float>> &scratchpad,
+                       std::int64_t scratchpad_size);
+    void (*zgesv_sycl)(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                       sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                       sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<double>> &b,
+                       std::int64_t ldb, sycl::buffer<std::complex<double>> &scratchpad,
+                       std::int64_t scratchpad_size);
+    sycl::event (*sgesv_usm_sycl)(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, float *a,
+                                  std::int64_t lda, std::int64_t *ipiv, float *b, std::int64_t ldb,
+                                  float *scratchpad, std::int64_t scratchpad_size,
+                                  const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*dgesv_usm_sycl)(sycl::queue &queue, std::int64_t n, std::int64_t nrhs, double *a,
+                                  std::int64_t lda, std::int64_t *ipiv, double *b, std::int64_t ldb,
+                                  double *scratchpad, std::int64_t scratchpad_size,
+                                  const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*cgesv_usm_sycl)(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                                  std::complex<float> *a, std::int64_t lda, std::int64_t *ipiv,
+                                  std::complex<float> *b, std::int64_t ldb,
+                                  std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                                  const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*zgesv_usm_sycl)(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                                  std::complex<double> *a, std::int64_t lda, std::int64_t *ipiv,
+                                  std::complex<double> *b, std::int64_t ldb,
+                                  std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                                  const sycl::vector_class<sycl::event> &dependencies);
+    void (*sposv_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                       std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                       sycl::buffer<float> &b, std::int64_t ldb, sycl::buffer<float> &scratchpad,
+                       std::int64_t scratchpad_size);
+    void (*dposv_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                       std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                       sycl::buffer<double> &b, std::int64_t ldb, sycl::buffer<double> &scratchpad,
+                       std::int64_t scratchpad_size);
+    void (*cposv_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                       std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                       sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                       sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size);
+    void (*zposv_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                       std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                       sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                       sycl::buffer<std::complex<double>> &scratchpad,
+                       std::int64_t scratchpad_size);
+    sycl::event (*sposv_usm_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                  std::int64_t nrhs, float *a, std::int64_t lda, float *b,
+                                  std::int64_t ldb, float *scratchpad, std::int64_t scratchpad_size,
+                                  const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*dposv_usm_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                  std::int64_t nrhs, double *a, std::int64_t lda, double *b,
+                                  std::int64_t ldb, double *scratchpad,
+                                  std::int64_t scratchpad_size,
+                                  const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*cposv_usm_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                  std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                                  std::complex<float> *b, std::int64_t ldb,
+                                  std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                                  const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*zposv_usm_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                  std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                                  std::complex<double> *b, std::int64_t ldb,
+                                  std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                                  const sycl::vector_class<sycl::event> &dependencies);
+    void (*ssysv_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                       std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                       sycl::buffer<std::int64_t> &ipiv, sycl::buffer<float> &b, std::int64_t ldb,
+                       sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size);
+    void (*dsysv_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                       std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                       sycl::buffer<std::int64_t> &ipiv, sycl::buffer<double> &b, std::int64_t ldb,
+                       sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+    void (*csysv_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                       std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                       sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<float>> &b,
+                       std::int64_t ldb, sycl::buffer<std::complex<float>> &scratchpad,
+                       std::int64_t scratchpad_size);
+    void (*zsysv_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                       std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                       sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<double>> &b,
+                       std::int64_t ldb, sycl::buffer<std::complex<double>> &scratchpad,
+                       std::int64_t scratchpad_size);
+    sycl::event (*ssysv_usm_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                  std::int64_t nrhs, float *a, std::int64_t lda, std::int64_t *ipiv,
+                                  float *b, std::int64_t ldb, float *scratchpad,
+                                  std::int64_t scratchpad_size,
+                                  const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*dsysv_usm_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                  std::int64_t nrhs, double *a, std::int64_t lda,
+                                  std::int64_t *ipiv, double *b, std::int64_t ldb,
+                                  double *scratchpad, std::int64_t scratchpad_size,
+                                  const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*csysv_usm_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                  std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                                  std::int64_t *ipiv, std::complex<float> *b, std::int64_t ldb,
+                                  std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                                  const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*zsysv_usm_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                  std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                                  std::int64_t *ipiv, std::complex<double> *b, std::int64_t ldb,
+                                  std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                                  const sycl::vector_class<sycl::event> &dependencies);
+    void (*sgesv_batch_sycl)(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                             sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                             sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                             sycl::buffer<float> &b, std::int64_t ldb, std::int64_t stride_b,
+                             std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                             std::int64_t scratchpad_size);
+    void (*dgesv_batch_sycl)(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                             sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                             sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                             sycl::buffer<double> &b, std::int64_t ldb, std::int64_t stride_b,
+                             std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                             std::int64_t scratchpad_size);
+    void (*cgesv_batch_sycl)(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                             sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                             std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+                             std::int64_t stride_ipiv, sycl::buffer<std::complex<float>> &b,
+                             std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                             sycl::buffer<std::complex<float>> &scratchpad,
+                             std::int64_t scratchpad_size);
+    void (*zgesv_batch_sycl)(sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                             sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                             std::int64_t stride_a, sycl::buffer<std::int64_t> &ipiv,
+                             std::int64_t stride_ipiv, sycl::buffer<std::complex<double>> &b,
+                             std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                             sycl::buffer<std::complex<double>> &scratchpad,
+                             std::int64_t scratchpad_size);
+    sycl::event (*sgesv_batch_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, std::int64_t nrhs, float *a, std::int64_t lda,
+        std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv, float *b,
+        std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, float *scratchpad,
+        std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*dgesv_batch_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda,
+        std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv, double *b,
+        std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, double *scratchpad,
+        std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*cgesv_batch_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::complex<float> *a,
+        std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv,
+        std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+        std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+        const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*zgesv_batch_usm_sycl)(
+        sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::complex<double> *a,
+        std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv,
+        std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+        std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+        const sycl::vector_class<sycl::event> &dependencies);
+    void (*sposv_batch_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                             std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                             std::int64_t stride_a, sycl::buffer<float> &b, std::int64_t ldb,
+                             std::int64_t stride_b, std::int64_t batch_size,
+                             sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size);
+    void (*dposv_batch_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                             std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                             std::int64_t stride_a, sycl::buffer<double> &b, std::int64_t ldb,
+                             std::int64_t stride_b, std::int64_t batch_size,
+                             sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+    void (*cposv_batch_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                             std::int64_t nrhs, sycl::buffer<std::complex<float>> &a,
+                             std::int64_t lda, std::int64_t stride_a,
+                             sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                             std::int64_t stride_b, std::int64_t batch_size,
+                             sycl::buffer<std::complex<float>> &scratchpad,
+                             std::int64_t scratchpad_size);
+    void (*zposv_batch_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                             std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
+                             std::int64_t lda, std::int64_t stride_a,
+                             sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                             std::int64_t stride_b, std::int64_t batch_size,
+                             sycl::buffer<std::complex<double>> &scratchpad,
+                             std::int64_t scratchpad_size);
+    sycl::event (*sposv_batch_usm_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                        std::int64_t nrhs, float *a, std::int64_t lda,
+                                        std::int64_t stride_a, float *b, std::int64_t ldb,
+                                        std::int64_t stride_b, std::int64_t batch_size,
+                                        float *scratchpad, std::int64_t scratchpad_size,
+                                        const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*dposv_batch_usm_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                        std::int64_t nrhs, double *a, std::int64_t lda,
+                                        std::int64_t stride_a, double *b, std::int64_t ldb,
+                                        std::int64_t stride_b, std::int64_t batch_size,
+                                        double *scratchpad, std::int64_t scratchpad_size,
+                                        const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*cposv_batch_usm_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+                                        std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                                        std::int64_t stride_a, std::complex<float> *b,
+                                        std::int64_t ldb, std::int64_t stride_b,
+                                        std::int64_t batch_size, std::complex<float> *scratchpad,
+                                        std::int64_t scratchpad_size,
+                                        const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*zposv_batch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+        std::complex<double> *a, std::int64_t lda, std::int64_t stride_a, std::complex<double> *b,
+        std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+        std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+        const sycl::vector_class<sycl::event> &dependencies);
+    std::int64_t (*sgesv_scratchpad_size_sycl)(sycl::queue &queue, std::int64_t n,
+                                               std::int64_t nrhs, std::int64_t lda,
+                                               std::int64_t ldb);
+    std::int64_t (*dgesv_scratchpad_size_sycl)(sycl::queue &queue, std::int64_t n,
+                                               std::int64_t nrhs, std::int64_t lda,
+                                               std::int64_t ldb);
+    std::int64_t (*cgesv_scratchpad_size_sycl)(sycl::queue &queue, std::int64_t n,
+                                               std::int64_t nrhs, std::int64_t lda,
+                                               std::int64_t ldb);
+    std::int64_t (*zgesv_scratchpad_size_sycl)(sycl::queue &queue, std::int64_t n,
+                                               std::int64_t nrhs, std::int64_t lda,
+                                               std::int64_t ldb);
+    std::int64_t (*sposv_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                               std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                               std::int64_t ldb);
+    std::int64_t (*dposv_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                               std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                               std::int64_t ldb);
+    std::int64_t (*cposv_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                               std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                               std::int64_t ldb);
+    std::int64_t (*zposv_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                               std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                               std::int64_t ldb);
+    std::int64_t (*ssysv_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                               std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                               std::int64_t ldb);
+    std::int64_t (*dsysv_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                               std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                               std::int64_t ldb);
+    std::int64_t (*csysv_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                               std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                               std::int64_t ldb);
+    std::int64_t (*zsysv_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                               std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                               std::int64_t ldb);
+    std::int64_t (*sgesv_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+        std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t ldb, std::int64_t stride_b,
+        std::int64_t batch_size);
+    std::int64_t (*dgesv_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+        std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t ldb, std::int64_t stride_b,
+        std::int64_t batch_size);
+    std::int64_t (*cgesv_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+        std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t ldb, std::int64_t stride_b,
+        std::int64_t batch_size);
+    std::int64_t (*zgesv_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+        std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t ldb, std::int64_t stride_b,
+        std::int64_t batch_size);
+    std::int64_t (*sposv_batch_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                     std::int64_t n, std::int64_t nrhs,
+                                                     std::int64_t lda, std::int64_t stride_a,
+                                                     std::int64_t ldb, std::int64_t stride_b,
+                                                     std::int64_t batch_size);
+    std::int64_t (*dposv_batch_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                     std::int64_t n, std::int64_t nrhs,
+                                                     std::int64_t lda, std::int64_t stride_a,
+                                                     std::int64_t ldb, std::int64_t stride_b,
+                                                     std::int64_t batch_size);
+    std::int64_t (*cposv_batch_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                     std::int64_t n, std::int64_t nrhs,
+                                                     std::int64_t lda, std::int64_t stride_a,
+                                                     std::int64_t ldb, std::int64_t stride_b,
+                                                     std::int64_t batch_size);
+    std::int64_t (*zposv_batch_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                     std::int64_t n, std::int64_t nrhs,
+                                                     std::int64_t lda, std::int64_t stride_a,
+                                                     std::int64_t ldb, std::int64_t stride_b,
+                                                     std::int64_t batch_size);
+    void (*sgels_sycl)(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                       std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                       sycl::buffer<float> &b, std::int64_t ldb, sycl::buffer<float> &scratchpad,
+                       std::int64_t scratchpad_size);
+    void (*dgels_sycl)(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                       std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                       sycl::buffer<double> &b, std::int64_t ldb, sycl::buffer<double> &scratchpad,
+                       std::int64_t scratchpad_size);
+    void (*cgels_sycl)(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                       std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<float>> &a,
+                       std::int64_t lda, sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                       sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size);
+    void (*zgels_sycl)(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                       std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
+                       std::int64_t lda, sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                       sycl::buffer<std::complex<double>> &scratchpad,
+                       std::int64_t scratchpad_size);
+    sycl::event (*sgels_usm_sycl)(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                                  std::int64_t n, std::int64_t nrhs, float *a, std::int64_t lda,
+                                  float *b, std::int64_t ldb, float *scratchpad,
+                                  std::int64_t scratchpad_size,
+                                  const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*dgels_usm_sycl)(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                                  std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda,
+                                  double *b, std::int64_t ldb, double *scratchpad,
+                                  std::int64_t scratchpad_size,
+                                  const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*cgels_usm_sycl)(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                                  std::int64_t n, std::int64_t nrhs, std::complex<float> *a,
+                                  std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
+                                  std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                                  const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*zgels_usm_sycl)(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                                  std::int64_t n, std::int64_t nrhs, std::complex<double> *a,
+                                  std::int64_t lda, std::complex<double> *b, std::int64_t ldb,
+                                  std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                                  const sycl::vector_class<sycl::event> &dependencies);
+    void (*sgelsd_sycl)(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                        sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &b,
+                        std::int64_t ldb, sycl::buffer<float> &s, float rcond,
+                        sycl::buffer<std::int64_t> &rank, sycl::buffer<float> &scratchpad,
+                        std::int64_t scratchpad_size);
+    void (*dgelsd_sycl)(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                        sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b,
+                        std::int64_t ldb, sycl::buffer<double> &s, double rcond,
+                        sycl::buffer<std::int64_t> &rank, sycl::buffer<double> &scratchpad,
+                        std::int64_t scratchpad_size);
+    void (*cgelsd_sycl)(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                        sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                        sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+                        sycl::buffer<float> &s, float rcond, sycl::buffer<std::int64_t> &rank,
+                        sycl::buffer<std::complex<float>> &scratchpad,
+                        std::int64_t scratchpad_size);
+    void (*zgelsd_sycl)(sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                        sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                        sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+                        sycl::buffer<double> &s, double rcond, sycl::buffer<std::int64_t> &rank,
+                        sycl::buffer<std::complex<double>> &scratchpad,
+                        std::int64_t scratchpad_size);
+    sycl::event (*sgelsd_usm_sycl)(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                   std::int64_t nrhs, float *a, std::int64_t lda, float *b,
+                                   std::int64_t ldb, float *s, float rcond, std::int64_t *rank,
+                                   float *scratchpad, std::int64_t scratchpad_size,
+                                   const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*dgelsd_usm_sycl)(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                   std::int64_t nrhs, double *a, std::int64_t lda, double *b,
+                                   std::int64_t ldb, double *s, double rcond, std::int64_t *rank,
+                                   double *scratchpad, std::int64_t scratchpad_size,
+                                   const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*cgelsd_usm_sycl)(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                   std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                                   std::complex<float> *b, std::int64_t ldb, float *s, float rcond,
+                                   std::int64_t *rank, std::complex<float> *scratchpad,
+                                   std::int64_t scratchpad_size,
+                                   const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*zgelsd_usm_sycl)(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                   std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                                   std::complex<double> *b, std::int64_t ldb, double *s,
+                                   double rcond, std::int64_t *rank,
+                                   std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                                   const sycl::vector_class<sycl::event> &dependencies);
+    void (*sgels_batch_sycl)(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                             std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a,
+                             std::int64_t lda, std::int64_t stride_a, sycl::buffer<float> &b,
+                             std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                             sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size);
+    void (*dgels_batch_sycl)(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                             std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a,
+                             std::int64_t lda, std::int64_t stride_a, sycl::buffer<double> &b,
+                             std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                             sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size);
+    void (*cgels_batch_sycl)(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                             std::int64_t n, std::int64_t nrhs,
+                             sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+                             std::int64_t stride_a, sycl::buffer<std::complex<float>> &b,
+                             std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                             sycl::buffer<std::complex<float>> &scratchpad,
+                             std::int64_t scratchpad_size);
+    void (*zgels_batch_sycl)(sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+                             std::int64_t n, std::int64_t nrhs,
+                             sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+                             std::int64_t stride_a, sycl::buffer<std::complex<double>> &b,
+                             std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                             sycl::buffer<std::complex<double>> &scratchpad,
+                             std::int64_t scratchpad_size);
+    sycl::event (*sgels_batch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        std::int64_t nrhs, float *a, std::int64_t lda, std::int64_t stride_a, float *b,
+        std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, float *scratchpad,
+        std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*dgels_batch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t stride_a, double *b,
+        std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, double *scratchpad,
+        std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*cgels_batch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        std::int64_t nrhs, std::complex<float> *a, std::int64_t lda, std::int64_t stride_a,
+        std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+        std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+        const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*zgels_batch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        std::int64_t nrhs, std::complex<double> *a, std::int64_t lda, std::int64_t stride_a,
+        std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+        std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+        const sycl::vector_class<sycl::event> &dependencies);
+    std::int64_t (*sgels_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::transpose trans,
+                                               std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                                               std::int64_t lda, std::int64_t ldb);
+    std::int64_t (*dgels_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::transpose trans,
+                                               std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                                               std::int64_t lda, std::int64_t ldb);
+    std::int64_t (*cgels_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::transpose trans,
+                                               std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                                               std::int64_t lda, std::int64_t ldb);
+    std::int64_t (*zgels_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::transpose trans,
+                                               std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                                               std::int64_t lda, std::int64_t ldb);
+    std::int64_t (*sgelsd_scratchpad_size_sycl)(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                                std::int64_t nrhs, std::int64_t lda,
+                                                std::int64_t ldb);
+    std::int64_t (*dgelsd_scratchpad_size_sycl)(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                                std::int64_t nrhs, std::int64_t lda,
+                                                std::int64_t ldb);
+    std::int64_t (*cgelsd_scratchpad_size_sycl)(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                                std::int64_t nrhs, std::int64_t lda,
+                                                std::int64_t ldb);
+    std::int64_t (*zgelsd_scratchpad_size_sycl)(sycl::queue &queue, std::int64_t m, std::int64_t n,
+                                                std::int64_t nrhs, std::int64_t lda,
+                                                std::int64_t ldb);
+    std::int64_t (*sgels_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+        std::int64_t stride_b, std::int64_t batch_size);
+    std::int64_t (*dgels_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+        std::int64_t stride_b, std::int64_t batch_size);
+    std::int64_t (*cgels_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+        std::int64_t stride_b, std::int64_t batch_size);
+    std::int64_t (*zgels_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+        std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+        std::int64_t stride_b, std::int64_t batch_size);
+    void (*ssyevr_sycl)(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                        oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+                        std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu,
+                        float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                        sycl::buffer<float> &z, std::int64_t ldz, sycl::buffer<float> &scratchpad,
+                        std::int64_t scratchpad_size);
+    void (*dsyevr_sycl)(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                        oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
+                        std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu,
+                        double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                        sycl::buffer<double> &z, std::int64_t ldz, sycl::buffer<double> &scratchpad,
+                        std::int64_t scratchpad_size);
+    sycl::event (*ssyevr_usm_sycl)(sycl::queue &queue, oneapi::mkl::job jobz,
+                                   oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                   std::int64_t n, float *a, std::int64_t lda, float vl, float vu,
+                                   std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m,
+                                   float *w, float *z, std::int64_t ldz, float *scratchpad,
+                                   std::int64_t scratchpad_size,
+                                   const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*dsyevr_usm_sycl)(sycl::queue &queue, oneapi::mkl::job jobz,
+                                   oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                   std::int64_t n, double *a, std::int64_t lda, double vl,
+                                   double vu, std::int64_t il, std::int64_t iu, double abstol,
+                                   std::int64_t *m, double *w, double *z, std::int64_t ldz,
+                                   double *scratchpad, std::int64_t scratchpad_size,
+                                   const sycl::vector_class<sycl::event> &dependencies);
+    void (*ssyevx_sycl)(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                        oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
+                        std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu,
+                        float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                        sycl::buffer<float> &z, std::int64_t ldz, sycl::buffer<float> &scratchpad,
+                        std::int64_t scratchpad_size);
+    void (*dsyevx_sycl)(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                        oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
+                        std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu,
+                        double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                        sycl::buffer<double> &z, std::int64_t ldz, sycl::buffer<double> &scratchpad,
+                        std::int64_t scratchpad_size);
+    sycl::event (*ssyevx_usm_sycl)(sycl::queue &queue, oneapi::mkl::job jobz,
+                                   oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                   std::int64_t n, float *a, std::int64_t lda, float vl, float vu,
+                                   std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m,
+                                   float *w, float *z, std::int64_t ldz, float *scratchpad,
+                                   std::int64_t scratchpad_size,
+                                   const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*dsyevx_usm_sycl)(sycl::queue &queue, oneapi::mkl::job jobz,
+                                   oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                   std::int64_t n, double *a, std::int64_t lda, double vl,
+                                   double vu, std::int64_t il, std::int64_t iu, double abstol,
+                                   std::int64_t *m, double *w, double *z, std::int64_t ldz,
+                                   double *scratchpad, std::int64_t scratchpad_size,
+                                   const sycl::vector_class<sycl::event> &dependencies);
+    std::int64_t (*ssyevr_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                                std::int64_t n, std::int64_t lda, std::int64_t ldz);
+    std::int64_t (*dsyevr_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                                std::int64_t n, std::int64_t lda, std::int64_t ldz);
+    std::int64_t (*ssyevx_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                                std::int64_t n, std::int64_t lda, std::int64_t ldz);
+    std::int64_t (*dsyevx_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                                std::int64_t n, std::int64_t lda, std::int64_t ldz);
+    void (*cheevr_sycl)(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                        oneapi::mkl::uplo uplo, std::int64_t n,
+                        sycl::buffer<std::complex<float>> &a, std::int64_t lda, float vl, float vu,
+                        std::int64_t il, std::int64_t iu, float abstol,
+                        sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                        sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+                        sycl::buffer<std::complex<float>> &scratchpad,
+                        std::int64_t scratchpad_size);
+    void (*zheevr_sycl)(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                        oneapi::mkl::uplo uplo, std::int64_t n,
+                        sycl::buffer<std::complex<double>> &a, std::int64_t lda, double vl,
+                        double vu, std::int64_t il, std::int64_t iu, double abstol,
+                        sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                        sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+                        sycl::buffer<std::complex<double>> &scratchpad,
+                        std::int64_t scratchpad_size);
+    sycl::event (*cheevr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a, std::int64_t lda, float vl,
+        float vu, std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m, float *w,
+        std::complex<float> *z, std::int64_t ldz, std::complex<float> *scratchpad,
+        std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*zheevr_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a, std::int64_t lda,
+        double vl, double vu, std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+        double *w, std::complex<double> *z, std::int64_t ldz, std::complex<double> *scratchpad,
+        std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies);
+    void (*cheevx_sycl)(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                        oneapi::mkl::uplo uplo, std::int64_t n,
+                        sycl::buffer<std::complex<float>> &a, std::int64_t lda, float vl, float vu,
+                        std::int64_t il, std::int64_t iu, float abstol,
+                        sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+                        sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+                        sycl::buffer<std::complex<float>> &scratchpad,
+                        std::int64_t scratchpad_size);
+    void (*zheevx_sycl)(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                        oneapi::mkl::uplo uplo, std::int64_t n,
+                        sycl::buffer<std::complex<double>> &a, std::int64_t lda, double vl,
+                        double vu, std::int64_t il, std::int64_t iu, double abstol,
+                        sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+                        sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+                        sycl::buffer<std::complex<double>> &scratchpad,
+                        std::int64_t scratchpad_size);
+    sycl::event (*cheevx_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a, std::int64_t lda, float vl,
+        float vu, std::int64_t il, std::int64_t iu, float abstol, std::int64_t *m, float *w,
+        std::complex<float> *z, std::int64_t ldz, std::complex<float> *scratchpad,
+        std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*zheevx_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+        oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a, std::int64_t lda,
+        double vl, double vu, std::int64_t il, std::int64_t iu, double abstol, std::int64_t *m,
+        double *w, std::complex<double> *z, std::int64_t ldz, std::complex<double> *scratchpad,
+        std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies);
+    std::int64_t (*cheevr_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                                std::int64_t n, std::int64_t lda, std::int64_t ldz);
+    std::int64_t (*zheevr_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                                std::int64_t n, std::int64_t lda, std::int64_t ldz);
+    std::int64_t (*cheevx_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                                std::int64_t n, std::int64_t lda, std::int64_t ldz);
+    std::int64_t (*zheevx_scratchpad_size_sycl)(sycl::queue &queue, oneapi::mkl::job jobz,
+                                                oneapi::mkl::rangev range, oneapi::mkl::uplo uplo,
+                                                std::int64_t n, std::int64_t lda, std::int64_t ldz);
+    void (*ssyevd_batch_sycl)(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                              std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<float> &w, std::int64_t stride_w,
+                              std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                              std::int64_t scratchpad_size);
+    void (*dsyevd_batch_sycl)(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                              std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+                              std::int64_t stride_a, sycl::buffer<double> &w, std::int64_t stride_w,
+                              std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                              std::int64_t scratchpad_size);
+    sycl::event (*ssyevd_batch_usm_sycl)(sycl::queue &queue, oneapi::mkl::job jobz,
+                                         oneapi::mkl::uplo uplo, std::int64_t n, float *a,
+                                         std::int64_t lda, std::int64_t stride_a, float *w,
+                                         std::int64_t stride_w, std::int64_t batch_size,
+                                         float *scratchpad, std::int64_t scratchpad_size,
+                                         const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*dsyevd_batch_usm_sycl)(sycl::queue &queue, oneapi::mkl::job jobz,
+                                         oneapi::mkl::uplo uplo, std::int64_t n, double *a,
+                                         std::int64_t lda, std::int64_t stride_a, double *w,
+                                         std::int64_t stride_w, std::int64_t batch_size,
+                                         double *scratchpad, std::int64_t scratchpad_size,
+                                         const sycl::vector_class<sycl::event> &dependencies);
+    std::int64_t (*ssyevd_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+        std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w, std::int64_t batch_size);
+    std::int64_t (*dsyevd_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+        std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w, std::int64_t batch_size);
+    void (*cheevd_batch_sycl)(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                              std::int64_t n, sycl::buffer<std::complex<float>> &a,
+                              std::int64_t lda, std::int64_t stride_a, sycl::buffer<float> &w,
+                              std::int64_t stride_w, std::int64_t batch_size,
+                              sycl::buffer<std::complex<float>> &scratchpad,
+                              std::int64_t scratchpad_size);
+    void (*zheevd_batch_sycl)(sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                              std::int64_t n, sycl::buffer<std::complex<double>> &a,
+                              std::int64_t lda, std::int64_t stride_a, sycl::buffer<double> &w,
+                              std::int64_t stride_w, std::int64_t batch_size,
+                              sycl::buffer<std::complex<double>> &scratchpad,
+                              std::int64_t scratchpad_size);
+    sycl::event (*cheevd_batch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+        std::complex<float> *a, std::int64_t lda, std::int64_t stride_a, float *w,
+        std::int64_t stride_w, std::int64_t batch_size, std::complex<float> *scratchpad,
+        std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies);
+    sycl::event (*zheevd_batch_usm_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+        std::complex<double> *a, std::int64_t lda, std::int64_t stride_a, double *w,
+        std::int64_t stride_w, std::int64_t batch_size, std::complex<double> *scratchpad,
+        std::int64_t scratchpad_size, const sycl::vector_class<sycl::event> &dependencies);
+    std::int64_t (*cheevd_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+        std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w, std::int64_t batch_size);
+    std::int64_t (*zheevd_batch_scratchpad_size_sycl)(
+        sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
+        std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w, std::int64_t batch_size);
 
 } lapack_function_table_t;
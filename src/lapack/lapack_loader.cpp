@@ -17,6 +17,16 @@
 * SPDX-License-Identifier: Apache-2.0
 *******************************************************************************/
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include "oneapi/mkl/lapack/detail/lapack_loader.hpp"
 
 #include "function_table_initializer.hpp"
@@ -30,167 +40,574 @@ namespace detail {
 static oneapi::mkl::detail::table_initializer<domain::lapack, lapack_function_table_t>
     function_tables;
 
+namespace verbose = oneapi::mkl::detail::verbose;
+namespace stats = oneapi::mkl::detail::stats;
+static constexpr verbose::site trace_site{ domain::lapack, "column_major" };
+
+// Scratchpad sizes only depend on the routine, the device and the problem
+// shape, so the answers of the backends are memoized for the whole process.
+// Sizes queried while autotuning cover every CPU backend and are kept apart.
+// The memo keeps the most recently used sizes, up to its capacity.
+class scratchpad_size_cache {
+public:
+    template <typename Query>
+    std::int64_t get(const char *routine, oneapi::mkl::device libkey, sycl::queue &queue,
+                     std::vector<std::int64_t> &shape, Query query) {
+        key k{ routine, libkey, oneapi::mkl::detail::autotune::enabled(), queue.get_device(),
+               std::move(shape) };
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = index_.find(k);
+            if (it != index_.end()) {
+                hits_++;
+                entries_.splice(entries_.begin(), entries_, it->second);
+                return it->second->second;
+            }
+        }
+        misses_++;
+        const std::int64_t size = query();
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (capacity_ > 0 && index_.find(k) == index_.end()) {
+            entries_.emplace_front(k, size);
+            index_.emplace(std::move(k), entries_.begin());
+            trim();
+        }
+        return size;
+    }
+
+    scratchpad_cache_stats stats() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return { hits_.load(), misses_.load(), static_cast<std::int64_t>(index_.size()) };
+    }
+
+    void set_capacity(std::int64_t entries) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        capacity_ = std::max<std::int64_t>(entries, 0);
+        trim();
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        index_.clear();
+        entries_.clear();
+        hits_ = 0;
+        misses_ = 0;
+    }
+
+private:
+    // Routines are told apart by the contents of their name, so call sites do
+    // not depend on the pooling of string literals. Names are literals, which
+    // outlive the memo.
+    struct key {
+        const char *routine;
+        oneapi::mkl::device libkey;
+        bool tuned;
+        sycl::device device;
+        std::vector<std::int64_t> shape;
+
+        bool operator==(const key &other) const {
+            return std::strcmp(routine, other.routine) == 0 && libkey == other.libkey &&
+                   tuned == other.tuned && device == other.device && shape == other.shape;
+        }
+    };
+
+    struct key_hash {
+        std::size_t operator()(const key &k) const {
+            std::size_t seed = 0;
+            auto combine = [&seed](std::size_t value) {
+                seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+            };
+            for (const char *c = k.routine; *c != '\0'; c++)
+                combine(static_cast<std::size_t>(*c));
+            combine(static_cast<std::size_t>(k.libkey));
+            combine(static_cast<std::size_t>(k.tuned));
+            combine(std::hash<sycl::device>()(k.device));
+            for (auto value : k.shape)
+                combine(std::hash<std::int64_t>()(value));
+            return seed;
+        }
+    };
+
+    using entry_list = std::list<std::pair<key, std::int64_t>>;
+
+    // Evicts the least recently used sizes beyond the capacity.
+    void trim() {
+        while (static_cast<std::int64_t>(index_.size()) > capacity_) {
+            index_.erase(entries_.back().first);
+            entries_.pop_back();
+        }
+    }
+
+    std::mutex mutex_;
+    entry_list entries_;
+    std::unordered_map<key, entry_list::iterator, key_hash> index_;
+    std::int64_t capacity_ = default_scratchpad_cache_capacity;
+    std::atomic<std::int64_t> hits_{ 0 };
+    std::atomic<std::int64_t> misses_{ 0 };
+};
+
+static scratchpad_size_cache scratchpad_sizes;
+
+template <typename... Args>
+static std::vector<std::int64_t> make_shape(Args... args) {
+    return { static_cast<std::int64_t>(args)... };
+}
+
+// Group problems are keyed on every per-group parameter.
+template <typename... Arrays>
+static std::vector<std::int64_t> make_group_shape(std::int64_t group_count,
+                                                  std::int64_t *group_sizes, Arrays *... arrays) {
+    std::vector<std::int64_t> shape{ group_count };
+    shape.insert(shape.end(), group_sizes, group_sizes + group_count);
+    auto append = [&shape, group_count](const auto *values) {
+        for (std::int64_t g = 0; g < group_count; g++)
+            shape.push_back(static_cast<std::int64_t>(values[g]));
+    };
+    int expand[] = { 0, (append(arrays), 0)... };
+    (void)expand;
+    return shape;
+}
+
 void gebrd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
            sycl::buffer<std::complex<float>> &a, std::int64_t lda, sycl::buffer<float> &d,
            sycl::buffer<float> &e, sycl::buffer<std::complex<float>> &tauq,
            sycl::buffer<std::complex<float>> &taup, sycl::buffer<std::complex<float>> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].cgebrd_sycl(queue, m, n, a, lda, d, e, tauq, taup, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "cgebrd", "m n lda scratchpad_size",
+                                   { stats::work::gebrd, stats::c32 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cgebrd_sycl)(queue, m, n, a, lda, d, e, tauq, taup, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void gebrd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
            sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &d,
            sycl::buffer<double> &e, sycl::buffer<double> &tauq, sycl::buffer<double> &taup,
            sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].dgebrd_sycl(queue, m, n, a, lda, d, e, tauq, taup, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "dgebrd", "m n lda scratchpad_size",
+                                   { stats::work::gebrd, stats::f64 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dgebrd_sycl)(queue, m, n, a, lda, d, e, tauq, taup, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void gebrd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
            sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &d, sycl::buffer<float> &e,
            sycl::buffer<float> &tauq, sycl::buffer<float> &taup, sycl::buffer<float> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].sgebrd_sycl(queue, m, n, a, lda, d, e, tauq, taup, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "sgebrd", "m n lda scratchpad_size",
+                                   { stats::work::gebrd, stats::f32 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.sgebrd_sycl)(queue, m, n, a, lda, d, e, tauq, taup, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void gebrd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
            sycl::buffer<std::complex<double>> &a, std::int64_t lda, sycl::buffer<double> &d,
            sycl::buffer<double> &e, sycl::buffer<std::complex<double>> &tauq,
            sycl::buffer<std::complex<double>> &taup, sycl::buffer<std::complex<double>> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].zgebrd_sycl(queue, m, n, a, lda, d, e, tauq, taup, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "zgebrd", "m n lda scratchpad_size",
+                                   { stats::work::gebrd, stats::c64 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zgebrd_sycl)(queue, m, n, a, lda, d, e, tauq, taup, scratchpad,
+                                           scratchpad_size);
+    });
+}
+void gels(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
+          std::int64_t m, std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a,
+          std::int64_t lda, sycl::buffer<float> &b, std::int64_t ldb,
+          sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "sgels", "trans m n nrhs lda ldb scratchpad_size",
+                                   { stats::work::gels, stats::f32 } };
+    auto shape = verbose::make_dims(trans, m, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.sgels_sycl)(queue, trans, m, n, nrhs, a, lda, b, ldb, scratchpad,
+                                          scratchpad_size);
+    });
+}
+void gels(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
+          std::int64_t m, std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a,
+          std::int64_t lda, sycl::buffer<double> &b, std::int64_t ldb,
+          sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "dgels", "trans m n nrhs lda ldb scratchpad_size",
+                                   { stats::work::gels, stats::f64 } };
+    auto shape = verbose::make_dims(trans, m, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dgels_sycl)(queue, trans, m, n, nrhs, a, lda, b, ldb, scratchpad,
+                                          scratchpad_size);
+    });
+}
+void gels(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
+          std::int64_t m, std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<float>> &a,
+          std::int64_t lda, sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+          sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "cgels", "trans m n nrhs lda ldb scratchpad_size",
+                                   { stats::work::gels, stats::c32 } };
+    auto shape = verbose::make_dims(trans, m, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cgels_sycl)(queue, trans, m, n, nrhs, a, lda, b, ldb, scratchpad,
+                                          scratchpad_size);
+    });
+}
+void gels(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
+          std::int64_t m, std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
+          std::int64_t lda, sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+          sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "zgels", "trans m n nrhs lda ldb scratchpad_size",
+                                   { stats::work::gels, stats::c64 } };
+    auto shape = verbose::make_dims(trans, m, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zgels_sycl)(queue, trans, m, n, nrhs, a, lda, b, ldb, scratchpad,
+                                          scratchpad_size);
+    });
+}
+void gelsd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
+           std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &b,
+           std::int64_t ldb, sycl::buffer<float> &s, float rcond, sycl::buffer<std::int64_t> &rank,
+           sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "sgelsd", "m n nrhs lda ldb scratchpad_size",
+                                   { stats::work::gels, stats::f32 } };
+    auto shape = verbose::make_dims(m, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.sgelsd_sycl)(queue, m, n, nrhs, a, lda, b, ldb, s, rcond, rank,
+                                           scratchpad, scratchpad_size);
+    });
+}
+void gelsd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
+           std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b,
+           std::int64_t ldb, sycl::buffer<double> &s, double rcond,
+           sycl::buffer<std::int64_t> &rank, sycl::buffer<double> &scratchpad,
+           std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "dgelsd", "m n nrhs lda ldb scratchpad_size",
+                                   { stats::work::gels, stats::f64 } };
+    auto shape = verbose::make_dims(m, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dgelsd_sycl)(queue, m, n, nrhs, a, lda, b, ldb, s, rcond, rank,
+                                           scratchpad, scratchpad_size);
+    });
+}
+void gelsd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
+           std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<float>> &b, std::int64_t ldb, sycl::buffer<float> &s,
+           float rcond, sycl::buffer<std::int64_t> &rank,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "cgelsd", "m n nrhs lda ldb scratchpad_size",
+                                   { stats::work::gels, stats::c32 } };
+    auto shape = verbose::make_dims(m, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cgelsd_sycl)(queue, m, n, nrhs, a, lda, b, ldb, s, rcond, rank,
+                                           scratchpad, scratchpad_size);
+    });
+}
+void gelsd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
+           std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+           sycl::buffer<std::complex<double>> &b, std::int64_t ldb, sycl::buffer<double> &s,
+           double rcond, sycl::buffer<std::int64_t> &rank,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "zgelsd", "m n nrhs lda ldb scratchpad_size",
+                                   { stats::work::gels, stats::c64 } };
+    auto shape = verbose::make_dims(m, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zgelsd_sycl)(queue, m, n, nrhs, a, lda, b, ldb, s, rcond, rank,
+                                           scratchpad, scratchpad_size);
+    });
 }
 void gerqf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
            sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &tau,
            sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].sgerqf_sycl(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "sgerqf", "m n lda scratchpad_size",
+                                   { stats::work::geqrf, stats::f32 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.sgerqf_sycl)(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+    });
 }
 void gerqf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
            sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &tau,
            sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].dgerqf_sycl(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "dgerqf", "m n lda scratchpad_size",
+                                   { stats::work::geqrf, stats::f64 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dgerqf_sycl)(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+    });
 }
 void gerqf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
            sycl::buffer<std::complex<float>> &a, std::int64_t lda,
            sycl::buffer<std::complex<float>> &tau, sycl::buffer<std::complex<float>> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].cgerqf_sycl(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "cgerqf", "m n lda scratchpad_size",
+                                   { stats::work::geqrf, stats::c32 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cgerqf_sycl)(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+    });
 }
 void gerqf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
            sycl::buffer<std::complex<double>> &a, std::int64_t lda,
            sycl::buffer<std::complex<double>> &tau, sycl::buffer<std::complex<double>> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].zgerqf_sycl(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "zgerqf", "m n lda scratchpad_size",
+                                   { stats::work::geqrf, stats::c64 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zgerqf_sycl)(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+    });
 }
 void geqrf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
            sycl::buffer<std::complex<float>> &a, std::int64_t lda,
            sycl::buffer<std::complex<float>> &tau, sycl::buffer<std::complex<float>> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].cgeqrf_sycl(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "cgeqrf", "m n lda scratchpad_size",
+                                   { stats::work::geqrf, stats::c32 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cgeqrf_sycl)(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+    });
 }
 void geqrf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
            sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &tau,
            sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].dgeqrf_sycl(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "dgeqrf", "m n lda scratchpad_size",
+                                   { stats::work::geqrf, stats::f64 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dgeqrf_sycl)(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+    });
 }
 void geqrf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
            sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &tau,
            sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].sgeqrf_sycl(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "sgeqrf", "m n lda scratchpad_size",
+                                   { stats::work::geqrf, stats::f32 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.sgeqrf_sycl)(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+    });
 }
 void geqrf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
            sycl::buffer<std::complex<double>> &a, std::int64_t lda,
            sycl::buffer<std::complex<double>> &tau, sycl::buffer<std::complex<double>> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].zgeqrf_sycl(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "zgeqrf", "m n lda scratchpad_size",
+                                   { stats::work::geqrf, stats::c64 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zgeqrf_sycl)(queue, m, n, a, lda, tau, scratchpad, scratchpad_size);
+    });
 }
 void getrf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
            sycl::buffer<std::complex<float>> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
            sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].cgetrf_sycl(queue, m, n, a, lda, ipiv, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "cgetrf", "m n lda scratchpad_size",
+                                   { stats::work::getrf, stats::c32 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cgetrf_sycl)(queue, m, n, a, lda, ipiv, scratchpad, scratchpad_size);
+    });
 }
 void getrf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
            sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
            sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].dgetrf_sycl(queue, m, n, a, lda, ipiv, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "dgetrf", "m n lda scratchpad_size",
+                                   { stats::work::getrf, stats::f64 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dgetrf_sycl)(queue, m, n, a, lda, ipiv, scratchpad, scratchpad_size);
+    });
 }
 void getrf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
            sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
            sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].sgetrf_sycl(queue, m, n, a, lda, ipiv, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "sgetrf", "m n lda scratchpad_size",
+                                   { stats::work::getrf, stats::f32 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.sgetrf_sycl)(queue, m, n, a, lda, ipiv, scratchpad, scratchpad_size);
+    });
 }
 void getrf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
            sycl::buffer<std::complex<double>> &a, std::int64_t lda,
            sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<double>> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].zgetrf_sycl(queue, m, n, a, lda, ipiv, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "zgetrf", "m n lda scratchpad_size",
+                                   { stats::work::getrf, stats::c64 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zgetrf_sycl)(queue, m, n, a, lda, ipiv, scratchpad, scratchpad_size);
+    });
 }
 void getri(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
            sycl::buffer<std::complex<float>> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
            sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].cgetri_sycl(queue, n, a, lda, ipiv, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "cgetri", "n lda scratchpad_size",
+                                   { stats::work::getri, stats::c32 } };
+    auto shape = verbose::make_dims(n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cgetri_sycl)(queue, n, a, lda, ipiv, scratchpad, scratchpad_size);
+    });
 }
 void getri(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<double> &a,
            std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, sycl::buffer<double> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].dgetri_sycl(queue, n, a, lda, ipiv, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "dgetri", "n lda scratchpad_size",
+                                   { stats::work::getri, stats::f64 } };
+    auto shape = verbose::make_dims(n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dgetri_sycl)(queue, n, a, lda, ipiv, scratchpad, scratchpad_size);
+    });
 }
 void getri(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float> &a,
            std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, sycl::buffer<float> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].sgetri_sycl(queue, n, a, lda, ipiv, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "sgetri", "n lda scratchpad_size",
+                                   { stats::work::getri, stats::f32 } };
+    auto shape = verbose::make_dims(n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.sgetri_sycl)(queue, n, a, lda, ipiv, scratchpad, scratchpad_size);
+    });
 }
 void getri(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
            sycl::buffer<std::complex<double>> &a, std::int64_t lda,
            sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<double>> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].zgetri_sycl(queue, n, a, lda, ipiv, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "zgetri", "n lda scratchpad_size",
+                                   { stats::work::getri, stats::c64 } };
+    auto shape = verbose::make_dims(n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zgetri_sycl)(queue, n, a, lda, ipiv, scratchpad, scratchpad_size);
+    });
 }
 void getrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
            std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<float>> &a,
            std::int64_t lda, sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<float>> &b,
            std::int64_t ldb, sycl::buffer<std::complex<float>> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].cgetrs_sycl(queue, trans, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "cgetrs", "trans n nrhs lda ldb scratchpad_size",
+                                   { stats::work::getrs, stats::c32 } };
+    auto shape = verbose::make_dims(trans, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cgetrs_sycl)(queue, trans, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void getrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
            std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
            sycl::buffer<std::int64_t> &ipiv, sycl::buffer<double> &b, std::int64_t ldb,
            sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].dgetrs_sycl(queue, trans, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "dgetrs", "trans n nrhs lda ldb scratchpad_size",
+                                   { stats::work::getrs, stats::f64 } };
+    auto shape = verbose::make_dims(trans, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dgetrs_sycl)(queue, trans, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void getrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
            std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
            sycl::buffer<std::int64_t> &ipiv, sycl::buffer<float> &b, std::int64_t ldb,
            sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].sgetrs_sycl(queue, trans, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "sgetrs", "trans n nrhs lda ldb scratchpad_size",
+                                   { stats::work::getrs, stats::f32 } };
+    auto shape = verbose::make_dims(trans, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.sgetrs_sycl)(queue, trans, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void getrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
            std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
            std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
            sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
            sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].zgetrs_sycl(queue, trans, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "zgetrs", "trans n nrhs lda ldb scratchpad_size",
+                                   { stats::work::getrs, stats::c64 } };
+    auto shape = verbose::make_dims(trans, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zgetrs_sycl)(queue, trans, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                                           scratchpad_size);
+    });
+}
+void gesv(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+          sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+          sycl::buffer<float> &b, std::int64_t ldb, sycl::buffer<float> &scratchpad,
+          std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "sgesv", "n nrhs lda ldb scratchpad_size",
+                                   { stats::work::gesv, stats::f32 } };
+    auto shape = verbose::make_dims(n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.sgesv_sycl)(queue, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                                          scratchpad_size);
+    });
+}
+void gesv(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+          sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+          sycl::buffer<double> &b, std::int64_t ldb, sycl::buffer<double> &scratchpad,
+          std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "dgesv", "n nrhs lda ldb scratchpad_size",
+                                   { stats::work::gesv, stats::f64 } };
+    auto shape = verbose::make_dims(n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dgesv_sycl)(queue, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                                          scratchpad_size);
+    });
+}
+void gesv(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+          sycl::buffer<std::complex<float>> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+          sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+          sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "cgesv", "n nrhs lda ldb scratchpad_size",
+                                   { stats::work::gesv, stats::c32 } };
+    auto shape = verbose::make_dims(n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cgesv_sycl)(queue, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                                          scratchpad_size);
+    });
+}
+void gesv(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+          sycl::buffer<std::complex<double>> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
+          sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+          sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "zgesv", "n nrhs lda ldb scratchpad_size",
+                                   { stats::work::gesv, stats::c64 } };
+    auto shape = verbose::make_dims(n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zgesv_sycl)(queue, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                                          scratchpad_size);
+    });
 }
 void gesvd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
            oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, sycl::buffer<double> &a,
            std::int64_t lda, sycl::buffer<double> &s, sycl::buffer<double> &u, std::int64_t ldu,
            sycl::buffer<double> &vt, std::int64_t ldvt, sycl::buffer<double> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].dgesvd_sycl(queue, jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt,
-                                        scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "dgesvd",
+                                   "jobu jobvt m n lda ldu ldvt scratchpad_size",
+                                   { stats::work::gebrd, stats::f64 } };
+    auto shape = verbose::make_dims(jobu, jobvt, m, n, lda, ldu, ldvt, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dgesvd_sycl)(queue, jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt,
+                                           scratchpad, scratchpad_size);
+    });
 }
 void gesvd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
            oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, sycl::buffer<float> &a,
            std::int64_t lda, sycl::buffer<float> &s, sycl::buffer<float> &u, std::int64_t ldu,
            sycl::buffer<float> &vt, std::int64_t ldvt, sycl::buffer<float> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].sgesvd_sycl(queue, jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt,
-                                        scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "sgesvd",
+                                   "jobu jobvt m n lda ldu ldvt scratchpad_size",
+                                   { stats::work::gebrd, stats::f32 } };
+    auto shape = verbose::make_dims(jobu, jobvt, m, n, lda, ldu, ldvt, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.sgesvd_sycl)(queue, jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt,
+                                           scratchpad, scratchpad_size);
+    });
 }
 void gesvd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
            oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n,
@@ -198,8 +615,14 @@ void gesvd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd j
            sycl::buffer<std::complex<float>> &u, std::int64_t ldu,
            sycl::buffer<std::complex<float>> &vt, std::int64_t ldvt,
            sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].cgesvd_sycl(queue, jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt,
-                                        scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "cgesvd",
+                                   "jobu jobvt m n lda ldu ldvt scratchpad_size",
+                                   { stats::work::gebrd, stats::c32 } };
+    auto shape = verbose::make_dims(jobu, jobvt, m, n, lda, ldu, ldvt, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cgesvd_sycl)(queue, jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt,
+                                           scratchpad, scratchpad_size);
+    });
 }
 void gesvd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
            oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n,
@@ -207,341 +630,845 @@ void gesvd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd j
            sycl::buffer<std::complex<double>> &u, std::int64_t ldu,
            sycl::buffer<std::complex<double>> &vt, std::int64_t ldvt,
            sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].zgesvd_sycl(queue, jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt,
-                                        scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "zgesvd",
+                                   "jobu jobvt m n lda ldu ldvt scratchpad_size",
+                                   { stats::work::gebrd, stats::c64 } };
+    auto shape = verbose::make_dims(jobu, jobvt, m, n, lda, ldu, ldvt, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zgesvd_sycl)(queue, jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt,
+                                           scratchpad, scratchpad_size);
+    });
 }
 void heevd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
            oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<float>> &a,
            std::int64_t lda, sycl::buffer<float> &w, sycl::buffer<std::complex<float>> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].cheevd_sycl(queue, jobz, uplo, n, a, lda, w, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "cheevd", "jobz uplo n lda scratchpad_size",
+                                   { stats::work::syevd, stats::c32 } };
+    auto shape = verbose::make_dims(jobz, uplo, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cheevd_sycl)(queue, jobz, uplo, n, a, lda, w, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void heevd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
            oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<double>> &a,
            std::int64_t lda, sycl::buffer<double> &w,
            sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].zheevd_sycl(queue, jobz, uplo, n, a, lda, w, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "zheevd", "jobz uplo n lda scratchpad_size",
+                                   { stats::work::syevd, stats::c64 } };
+    auto shape = verbose::make_dims(jobz, uplo, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zheevd_sycl)(queue, jobz, uplo, n, a, lda, w, scratchpad,
+                                           scratchpad_size);
+    });
+}
+void heevr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<std::complex<float>> &a, std::int64_t lda, float vl, float vu,
+           std::int64_t il, std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m,
+           sycl::buffer<float> &w, sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "cheevr",
+                                   "jobz range uplo n lda il iu ldz scratchpad_size",
+                                   { stats::work::syevd, stats::c32 } };
+    auto shape = verbose::make_dims(jobz, range, uplo, n, lda, il, iu, ldz, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cheevr_sycl)(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                                           abstol, m, w, z, ldz, scratchpad, scratchpad_size);
+    });
+}
+void heevr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<std::complex<double>> &a, std::int64_t lda, double vl, double vu,
+           std::int64_t il, std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m,
+           sycl::buffer<double> &w, sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "zheevr",
+                                   "jobz range uplo n lda il iu ldz scratchpad_size",
+                                   { stats::work::syevd, stats::c64 } };
+    auto shape = verbose::make_dims(jobz, range, uplo, n, lda, il, iu, ldz, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zheevr_sycl)(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                                           abstol, m, w, z, ldz, scratchpad, scratchpad_size);
+    });
+}
+void heevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<std::complex<float>> &a, std::int64_t lda, float vl, float vu,
+           std::int64_t il, std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m,
+           sycl::buffer<float> &w, sycl::buffer<std::complex<float>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "cheevx",
+                                   "jobz range uplo n lda il iu ldz scratchpad_size",
+                                   { stats::work::syevd, stats::c32 } };
+    auto shape = verbose::make_dims(jobz, range, uplo, n, lda, il, iu, ldz, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cheevx_sycl)(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                                           abstol, m, w, z, ldz, scratchpad, scratchpad_size);
+    });
+}
+void heevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<std::complex<double>> &a, std::int64_t lda, double vl, double vu,
+           std::int64_t il, std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m,
+           sycl::buffer<double> &w, sycl::buffer<std::complex<double>> &z, std::int64_t ldz,
+           sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "zheevx",
+                                   "jobz range uplo n lda il iu ldz scratchpad_size",
+                                   { stats::work::syevd, stats::c64 } };
+    auto shape = verbose::make_dims(jobz, range, uplo, n, lda, il, iu, ldz, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zheevx_sycl)(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                                           abstol, m, w, z, ldz, scratchpad, scratchpad_size);
+    });
 }
 void hegvd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t itype,
            oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
            sycl::buffer<std::complex<float>> &a, std::int64_t lda,
            sycl::buffer<std::complex<float>> &b, std::int64_t ldb, sycl::buffer<float> &w,
            sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].chegvd_sycl(queue, itype, jobz, uplo, n, a, lda, b, ldb, w, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "chegvd",
+                                   "itype jobz uplo n lda ldb scratchpad_size",
+                                   { stats::work::sygvd, stats::c32 } };
+    auto shape = verbose::make_dims(itype, jobz, uplo, n, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.chegvd_sycl)(queue, itype, jobz, uplo, n, a, lda, b, ldb, w,
+                                           scratchpad, scratchpad_size);
+    });
 }
 void hegvd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t itype,
            oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
            sycl::buffer<std::complex<double>> &a, std::int64_t lda,
            sycl::buffer<std::complex<double>> &b, std::int64_t ldb, sycl::buffer<double> &w,
            sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].zhegvd_sycl(queue, itype, jobz, uplo, n, a, lda, b, ldb, w, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "zhegvd",
+                                   "itype jobz uplo n lda ldb scratchpad_size",
+                                   { stats::work::sygvd, stats::c64 } };
+    auto shape = verbose::make_dims(itype, jobz, uplo, n, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zhegvd_sycl)(queue, itype, jobz, uplo, n, a, lda, b, ldb, w,
+                                           scratchpad, scratchpad_size);
+    });
 }
 void hetrd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
            sycl::buffer<std::complex<float>> &a, std::int64_t lda, sycl::buffer<float> &d,
            sycl::buffer<float> &e, sycl::buffer<std::complex<float>> &tau,
            sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].chetrd_sycl(queue, uplo, n, a, lda, d, e, tau, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "chetrd", "uplo n lda scratchpad_size",
+                                   { stats::work::sytrd, stats::c32 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.chetrd_sycl)(queue, uplo, n, a, lda, d, e, tau, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void hetrd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
            sycl::buffer<std::complex<double>> &a, std::int64_t lda, sycl::buffer<double> &d,
            sycl::buffer<double> &e, sycl::buffer<std::complex<double>> &tau,
            sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].zhetrd_sycl(queue, uplo, n, a, lda, d, e, tau, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "zhetrd", "uplo n lda scratchpad_size",
+                                   { stats::work::sytrd, stats::c64 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zhetrd_sycl)(queue, uplo, n, a, lda, d, e, tau, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void hetrf(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
            sycl::buffer<std::complex<float>> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
            sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].chetrf_sycl(queue, uplo, n, a, lda, ipiv, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "chetrf", "uplo n lda scratchpad_size",
+                                   { stats::work::sytrf, stats::c32 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.chetrf_sycl)(queue, uplo, n, a, lda, ipiv, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void hetrf(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
            sycl::buffer<std::complex<double>> &a, std::int64_t lda,
            sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<double>> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].zhetrf_sycl(queue, uplo, n, a, lda, ipiv, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "zhetrf", "uplo n lda scratchpad_size",
+                                   { stats::work::sytrf, stats::c64 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zhetrf_sycl)(queue, uplo, n, a, lda, ipiv, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void orgbr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::generate vec,
            std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<float> &a, std::int64_t lda,
            sycl::buffer<float> &tau, sycl::buffer<float> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].sorgbr_sycl(queue, vec, m, n, k, a, lda, tau, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "sorgbr", "vec m n k lda scratchpad_size",
+                                   { stats::work::orgqr, stats::f32 } };
+    auto shape = verbose::make_dims(vec, m, n, k, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.sorgbr_sycl)(queue, vec, m, n, k, a, lda, tau, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void orgbr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::generate vec,
            std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<double> &a,
            std::int64_t lda, sycl::buffer<double> &tau, sycl::buffer<double> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].dorgbr_sycl(queue, vec, m, n, k, a, lda, tau, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "dorgbr", "vec m n k lda scratchpad_size",
+                                   { stats::work::orgqr, stats::f64 } };
+    auto shape = verbose::make_dims(vec, m, n, k, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dorgbr_sycl)(queue, vec, m, n, k, a, lda, tau, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void orgqr(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
            std::int64_t k, sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &tau,
            sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].dorgqr_sycl(queue, m, n, k, a, lda, tau, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "dorgqr", "m n k lda scratchpad_size",
+                                   { stats::work::orgqr, stats::f64 } };
+    auto shape = verbose::make_dims(m, n, k, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dorgqr_sycl)(queue, m, n, k, a, lda, tau, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void orgqr(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
            std::int64_t k, sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &tau,
            sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].sorgqr_sycl(queue, m, n, k, a, lda, tau, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "sorgqr", "m n k lda scratchpad_size",
+                                   { stats::work::orgqr, stats::f32 } };
+    auto shape = verbose::make_dims(m, n, k, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.sorgqr_sycl)(queue, m, n, k, a, lda, tau, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void orgtr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
            sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &tau,
            sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].sorgtr_sycl(queue, uplo, n, a, lda, tau, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "sorgtr", "uplo n lda scratchpad_size",
+                                   { stats::work::orgtr, stats::f32 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.sorgtr_sycl)(queue, uplo, n, a, lda, tau, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void orgtr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
            sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &tau,
            sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].dorgtr_sycl(queue, uplo, n, a, lda, tau, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "dorgtr", "uplo n lda scratchpad_size",
+                                   { stats::work::orgtr, stats::f64 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dorgtr_sycl)(queue, uplo, n, a, lda, tau, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void ormtr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
            oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
            sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &tau,
            sycl::buffer<float> &c, std::int64_t ldc, sycl::buffer<float> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].sormtr_sycl(queue, side, uplo, trans, m, n, a, lda, tau, c, ldc,
-                                        scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "sormtr",
+                                   "side uplo trans m n lda ldc scratchpad_size",
+                                   { stats::work::ormtr, stats::f32 } };
+    auto shape = verbose::make_dims(side, uplo, trans, m, n, lda, ldc, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.sormtr_sycl)(queue, side, uplo, trans, m, n, a, lda, tau, c, ldc,
+                                           scratchpad, scratchpad_size);
+    });
 }
 void ormtr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
            oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
            sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &tau,
            sycl::buffer<double> &c, std::int64_t ldc, sycl::buffer<double> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].dormtr_sycl(queue, side, uplo, trans, m, n, a, lda, tau, c, ldc,
-                                        scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "dormtr",
+                                   "side uplo trans m n lda ldc scratchpad_size",
+                                   { stats::work::ormtr, stats::f64 } };
+    auto shape = verbose::make_dims(side, uplo, trans, m, n, lda, ldc, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dormtr_sycl)(queue, side, uplo, trans, m, n, a, lda, tau, c, ldc,
+                                           scratchpad, scratchpad_size);
+    });
 }
 void ormrq(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
            oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
            sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &tau,
            sycl::buffer<float> &c, std::int64_t ldc, sycl::buffer<float> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].sormrq_sycl(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
-                                        scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "sormrq", "side trans m n k lda ldc scratchpad_size",
+                                   { stats::work::ormqr, stats::f32 } };
+    auto shape = verbose::make_dims(side, trans, m, n, k, lda, ldc, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.sormrq_sycl)(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
+                                           scratchpad, scratchpad_size);
+    });
 }
 void ormrq(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
            oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
            sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &tau,
            sycl::buffer<double> &c, std::int64_t ldc, sycl::buffer<double> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].dormrq_sycl(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
-                                        scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "dormrq", "side trans m n k lda ldc scratchpad_size",
+                                   { stats::work::ormqr, stats::f64 } };
+    auto shape = verbose::make_dims(side, trans, m, n, k, lda, ldc, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dormrq_sycl)(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
+                                           scratchpad, scratchpad_size);
+    });
 }
 void ormqr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
            oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
            sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &tau,
            sycl::buffer<double> &c, std::int64_t ldc, sycl::buffer<double> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].dormqr_sycl(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
-                                        scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "dormqr", "side trans m n k lda ldc scratchpad_size",
+                                   { stats::work::ormqr, stats::f64 } };
+    auto shape = verbose::make_dims(side, trans, m, n, k, lda, ldc, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dormqr_sycl)(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
+                                           scratchpad, scratchpad_size);
+    });
 }
 void ormqr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
            oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
            sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &tau,
            sycl::buffer<float> &c, std::int64_t ldc, sycl::buffer<float> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].sormqr_sycl(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
-                                        scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "sormqr", "side trans m n k lda ldc scratchpad_size",
+                                   { stats::work::ormqr, stats::f32 } };
+    auto shape = verbose::make_dims(side, trans, m, n, k, lda, ldc, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.sormqr_sycl)(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
+                                           scratchpad, scratchpad_size);
+    });
 }
 void potrf(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
            sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].spotrf_sycl(queue, uplo, n, a, lda, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "spotrf", "uplo n lda scratchpad_size",
+                                   { stats::work::potrf, stats::f32 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.spotrf_sycl)(queue, uplo, n, a, lda, scratchpad, scratchpad_size);
+    });
 }
 void potrf(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
            sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].dpotrf_sycl(queue, uplo, n, a, lda, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "dpotrf", "uplo n lda scratchpad_size",
+                                   { stats::work::potrf, stats::f64 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dpotrf_sycl)(queue, uplo, n, a, lda, scratchpad, scratchpad_size);
+    });
 }
 void potrf(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
            sycl::buffer<std::complex<float>> &a, std::int64_t lda,
            sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].cpotrf_sycl(queue, uplo, n, a, lda, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "cpotrf", "uplo n lda scratchpad_size",
+                                   { stats::work::potrf, stats::c32 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cpotrf_sycl)(queue, uplo, n, a, lda, scratchpad, scratchpad_size);
+    });
 }
 void potrf(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
            sycl::buffer<std::complex<double>> &a, std::int64_t lda,
            sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].zpotrf_sycl(queue, uplo, n, a, lda, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "zpotrf", "uplo n lda scratchpad_size",
+                                   { stats::work::potrf, stats::c64 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zpotrf_sycl)(queue, uplo, n, a, lda, scratchpad, scratchpad_size);
+    });
 }
 void potri(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
            sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].spotri_sycl(queue, uplo, n, a, lda, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "spotri", "uplo n lda scratchpad_size",
+                                   { stats::work::potri, stats::f32 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.spotri_sycl)(queue, uplo, n, a, lda, scratchpad, scratchpad_size);
+    });
 }
 void potri(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
            sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].dpotri_sycl(queue, uplo, n, a, lda, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "dpotri", "uplo n lda scratchpad_size",
+                                   { stats::work::potri, stats::f64 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dpotri_sycl)(queue, uplo, n, a, lda, scratchpad, scratchpad_size);
+    });
 }
 void potri(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
            sycl::buffer<std::complex<float>> &a, std::int64_t lda,
            sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].cpotri_sycl(queue, uplo, n, a, lda, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "cpotri", "uplo n lda scratchpad_size",
+                                   { stats::work::potri, stats::c32 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cpotri_sycl)(queue, uplo, n, a, lda, scratchpad, scratchpad_size);
+    });
 }
 void potri(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
            sycl::buffer<std::complex<double>> &a, std::int64_t lda,
            sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].zpotri_sycl(queue, uplo, n, a, lda, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "zpotri", "uplo n lda scratchpad_size",
+                                   { stats::work::potri, stats::c64 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zpotri_sycl)(queue, uplo, n, a, lda, scratchpad, scratchpad_size);
+    });
 }
 void potrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
            std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &b,
            std::int64_t ldb, sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].spotrs_sycl(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "spotrs", "uplo n nrhs lda ldb scratchpad_size",
+                                   { stats::work::getrs, stats::f32 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.spotrs_sycl)(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void potrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
            std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b,
            std::int64_t ldb, sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].dpotrs_sycl(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "dpotrs", "uplo n nrhs lda ldb scratchpad_size",
+                                   { stats::work::getrs, stats::f64 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dpotrs_sycl)(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void potrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
            std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
            sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
            sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].cpotrs_sycl(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "cpotrs", "uplo n nrhs lda ldb scratchpad_size",
+                                   { stats::work::getrs, stats::c32 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cpotrs_sycl)(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void potrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
            std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
            sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
            sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].zpotrs_sycl(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "zpotrs", "uplo n nrhs lda ldb scratchpad_size",
+                                   { stats::work::getrs, stats::c64 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zpotrs_sycl)(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
+                                           scratchpad_size);
+    });
+}
+void posv(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+          std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &b,
+          std::int64_t ldb, sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "sposv", "uplo n nrhs lda ldb scratchpad_size",
+                                   { stats::work::posv, stats::f32 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.sposv_sycl)(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
+                                          scratchpad_size);
+    });
+}
+void posv(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+          std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b,
+          std::int64_t ldb, sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "dposv", "uplo n nrhs lda ldb scratchpad_size",
+                                   { stats::work::posv, stats::f64 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dposv_sycl)(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
+                                          scratchpad_size);
+    });
+}
+void posv(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+          std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+          sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+          sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "cposv", "uplo n nrhs lda ldb scratchpad_size",
+                                   { stats::work::posv, stats::c32 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cposv_sycl)(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
+                                          scratchpad_size);
+    });
+}
+void posv(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+          std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+          sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+          sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "zposv", "uplo n nrhs lda ldb scratchpad_size",
+                                   { stats::work::posv, stats::c64 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zposv_sycl)(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
+                                          scratchpad_size);
+    });
 }
 void syevd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
            oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
            sycl::buffer<double> &w, sycl::buffer<double> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].dsyevd_sycl(queue, jobz, uplo, n, a, lda, w, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "dsyevd", "jobz uplo n lda scratchpad_size",
+                                   { stats::work::syevd, stats::f64 } };
+    auto shape = verbose::make_dims(jobz, uplo, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dsyevd_sycl)(queue, jobz, uplo, n, a, lda, w, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void syevd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
            oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
            sycl::buffer<float> &w, sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].ssyevd_sycl(queue, jobz, uplo, n, a, lda, w, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "ssyevd", "jobz uplo n lda scratchpad_size",
+                                   { stats::work::syevd, stats::f32 } };
+    auto shape = verbose::make_dims(jobz, uplo, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.ssyevd_sycl)(queue, jobz, uplo, n, a, lda, w, scratchpad,
+                                           scratchpad_size);
+    });
+}
+void syevr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<float> &a, std::int64_t lda, float vl, float vu, std::int64_t il,
+           std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+           sycl::buffer<float> &z, std::int64_t ldz, sycl::buffer<float> &scratchpad,
+           std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "ssyevr",
+                                   "jobz range uplo n lda il iu ldz scratchpad_size",
+                                   { stats::work::syevd, stats::f32 } };
+    auto shape = verbose::make_dims(jobz, range, uplo, n, lda, il, iu, ldz, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.ssyevr_sycl)(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                                           abstol, m, w, z, ldz, scratchpad, scratchpad_size);
+    });
+}
+void syevr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<double> &a, std::int64_t lda, double vl, double vu, std::int64_t il,
+           std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+           sycl::buffer<double> &z, std::int64_t ldz, sycl::buffer<double> &scratchpad,
+           std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "dsyevr",
+                                   "jobz range uplo n lda il iu ldz scratchpad_size",
+                                   { stats::work::syevd, stats::f64 } };
+    auto shape = verbose::make_dims(jobz, range, uplo, n, lda, il, iu, ldz, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dsyevr_sycl)(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                                           abstol, m, w, z, ldz, scratchpad, scratchpad_size);
+    });
+}
+void syevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<float> &a, std::int64_t lda, float vl, float vu, std::int64_t il,
+           std::int64_t iu, float abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<float> &w,
+           sycl::buffer<float> &z, std::int64_t ldz, sycl::buffer<float> &scratchpad,
+           std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "ssyevx",
+                                   "jobz range uplo n lda il iu ldz scratchpad_size",
+                                   { stats::work::syevd, stats::f32 } };
+    auto shape = verbose::make_dims(jobz, range, uplo, n, lda, il, iu, ldz, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.ssyevx_sycl)(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                                           abstol, m, w, z, ldz, scratchpad, scratchpad_size);
+    });
+}
+void syevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+           oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+           sycl::buffer<double> &a, std::int64_t lda, double vl, double vu, std::int64_t il,
+           std::int64_t iu, double abstol, sycl::buffer<std::int64_t> &m, sycl::buffer<double> &w,
+           sycl::buffer<double> &z, std::int64_t ldz, sycl::buffer<double> &scratchpad,
+           std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "dsyevx",
+                                   "jobz range uplo n lda il iu ldz scratchpad_size",
+                                   { stats::work::syevd, stats::f64 } };
+    auto shape = verbose::make_dims(jobz, range, uplo, n, lda, il, iu, ldz, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dsyevx_sycl)(queue, jobz, range, uplo, n, a, lda, vl, vu, il, iu,
+                                           abstol, m, w, z, ldz, scratchpad, scratchpad_size);
+    });
 }
 void sygvd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t itype,
            oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a,
            std::int64_t lda, sycl::buffer<double> &b, std::int64_t ldb, sycl::buffer<double> &w,
            sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].dsygvd_sycl(queue, itype, jobz, uplo, n, a, lda, b, ldb, w, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "dsygvd",
+                                   "itype jobz uplo n lda ldb scratchpad_size",
+                                   { stats::work::sygvd, stats::f64 } };
+    auto shape = verbose::make_dims(itype, jobz, uplo, n, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dsygvd_sycl)(queue, itype, jobz, uplo, n, a, lda, b, ldb, w,
+                                           scratchpad, scratchpad_size);
+    });
 }
 void sygvd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t itype,
            oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a,
            std::int64_t lda, sycl::buffer<float> &b, std::int64_t ldb, sycl::buffer<float> &w,
            sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].ssygvd_sycl(queue, itype, jobz, uplo, n, a, lda, b, ldb, w, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "ssygvd",
+                                   "itype jobz uplo n lda ldb scratchpad_size",
+                                   { stats::work::sygvd, stats::f32 } };
+    auto shape = verbose::make_dims(itype, jobz, uplo, n, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.ssygvd_sycl)(queue, itype, jobz, uplo, n, a, lda, b, ldb, w,
+                                           scratchpad, scratchpad_size);
+    });
 }
 void sytrd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
            sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &d,
            sycl::buffer<double> &e, sycl::buffer<double> &tau, sycl::buffer<double> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].dsytrd_sycl(queue, uplo, n, a, lda, d, e, tau, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "dsytrd", "uplo n lda scratchpad_size",
+                                   { stats::work::sytrd, stats::f64 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dsytrd_sycl)(queue, uplo, n, a, lda, d, e, tau, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void sytrd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
            sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &d, sycl::buffer<float> &e,
            sycl::buffer<float> &tau, sycl::buffer<float> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].ssytrd_sycl(queue, uplo, n, a, lda, d, e, tau, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "ssytrd", "uplo n lda scratchpad_size",
+                                   { stats::work::sytrd, stats::f32 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.ssytrd_sycl)(queue, uplo, n, a, lda, d, e, tau, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void sytrf(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
            sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
            sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].ssytrf_sycl(queue, uplo, n, a, lda, ipiv, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "ssytrf", "uplo n lda scratchpad_size",
+                                   { stats::work::sytrf, stats::f32 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.ssytrf_sycl)(queue, uplo, n, a, lda, ipiv, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void sytrf(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
            sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
            sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].dsytrf_sycl(queue, uplo, n, a, lda, ipiv, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "dsytrf", "uplo n lda scratchpad_size",
+                                   { stats::work::sytrf, stats::f64 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dsytrf_sycl)(queue, uplo, n, a, lda, ipiv, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void sytrf(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
            sycl::buffer<std::complex<float>> &a, std::int64_t lda, sycl::buffer<std::int64_t> &ipiv,
            sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].csytrf_sycl(queue, uplo, n, a, lda, ipiv, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "csytrf", "uplo n lda scratchpad_size",
+                                   { stats::work::sytrf, stats::c32 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.csytrf_sycl)(queue, uplo, n, a, lda, ipiv, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void sytrf(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
            sycl::buffer<std::complex<double>> &a, std::int64_t lda,
            sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<double>> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].zsytrf_sycl(queue, uplo, n, a, lda, ipiv, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "zsytrf", "uplo n lda scratchpad_size",
+                                   { stats::work::sytrf, stats::c64 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zsytrf_sycl)(queue, uplo, n, a, lda, ipiv, scratchpad,
+                                           scratchpad_size);
+    });
+}
+void sysv(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+          std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+          sycl::buffer<std::int64_t> &ipiv, sycl::buffer<float> &b, std::int64_t ldb,
+          sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "ssysv", "uplo n nrhs lda ldb scratchpad_size",
+                                   { stats::work::posv, stats::f32 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.ssysv_sycl)(queue, uplo, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                                          scratchpad_size);
+    });
+}
+void sysv(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+          std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+          sycl::buffer<std::int64_t> &ipiv, sycl::buffer<double> &b, std::int64_t ldb,
+          sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "dsysv", "uplo n nrhs lda ldb scratchpad_size",
+                                   { stats::work::posv, stats::f64 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dsysv_sycl)(queue, uplo, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                                          scratchpad_size);
+    });
+}
+void sysv(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+          std::int64_t nrhs, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
+          sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
+          sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "csysv", "uplo n nrhs lda ldb scratchpad_size",
+                                   { stats::work::posv, stats::c32 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.csysv_sycl)(queue, uplo, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                                          scratchpad_size);
+    });
+}
+void sysv(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+          std::int64_t nrhs, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
+          sycl::buffer<std::int64_t> &ipiv, sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
+          sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "zsysv", "uplo n nrhs lda ldb scratchpad_size",
+                                   { stats::work::posv, stats::c64 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zsysv_sycl)(queue, uplo, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                                          scratchpad_size);
+    });
 }
 void trtrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
            oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs,
            sycl::buffer<std::complex<float>> &a, std::int64_t lda,
            sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
            sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].ctrtrs_sycl(queue, uplo, trans, diag, n, nrhs, a, lda, b, ldb,
-                                        scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "ctrtrs",
+                                   "uplo trans diag n nrhs lda ldb scratchpad_size",
+                                   { stats::work::trtrs, stats::c32 } };
+    auto shape = verbose::make_dims(uplo, trans, diag, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.ctrtrs_sycl)(queue, uplo, trans, diag, n, nrhs, a, lda, b, ldb,
+                                           scratchpad, scratchpad_size);
+    });
 }
 void trtrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
            oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs,
            sycl::buffer<double> &a, std::int64_t lda, sycl::buffer<double> &b, std::int64_t ldb,
            sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].dtrtrs_sycl(queue, uplo, trans, diag, n, nrhs, a, lda, b, ldb,
-                                        scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "dtrtrs",
+                                   "uplo trans diag n nrhs lda ldb scratchpad_size",
+                                   { stats::work::trtrs, stats::f64 } };
+    auto shape = verbose::make_dims(uplo, trans, diag, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dtrtrs_sycl)(queue, uplo, trans, diag, n, nrhs, a, lda, b, ldb,
+                                           scratchpad, scratchpad_size);
+    });
 }
 void trtrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
            oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs,
            sycl::buffer<float> &a, std::int64_t lda, sycl::buffer<float> &b, std::int64_t ldb,
            sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].strtrs_sycl(queue, uplo, trans, diag, n, nrhs, a, lda, b, ldb,
-                                        scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "strtrs",
+                                   "uplo trans diag n nrhs lda ldb scratchpad_size",
+                                   { stats::work::trtrs, stats::f32 } };
+    auto shape = verbose::make_dims(uplo, trans, diag, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.strtrs_sycl)(queue, uplo, trans, diag, n, nrhs, a, lda, b, ldb,
+                                           scratchpad, scratchpad_size);
+    });
 }
 void trtrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
            oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs,
            sycl::buffer<std::complex<double>> &a, std::int64_t lda,
            sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
            sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].ztrtrs_sycl(queue, uplo, trans, diag, n, nrhs, a, lda, b, ldb,
-                                        scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "ztrtrs",
+                                   "uplo trans diag n nrhs lda ldb scratchpad_size",
+                                   { stats::work::trtrs, stats::c64 } };
+    auto shape = verbose::make_dims(uplo, trans, diag, n, nrhs, lda, ldb, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.ztrtrs_sycl)(queue, uplo, trans, diag, n, nrhs, a, lda, b, ldb,
+                                           scratchpad, scratchpad_size);
+    });
 }
 void ungbr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::generate vec,
            std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<std::complex<float>> &a,
            std::int64_t lda, sycl::buffer<std::complex<float>> &tau,
            sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].cungbr_sycl(queue, vec, m, n, k, a, lda, tau, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "cungbr", "vec m n k lda scratchpad_size",
+                                   { stats::work::orgqr, stats::c32 } };
+    auto shape = verbose::make_dims(vec, m, n, k, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cungbr_sycl)(queue, vec, m, n, k, a, lda, tau, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void ungbr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::generate vec,
            std::int64_t m, std::int64_t n, std::int64_t k, sycl::buffer<std::complex<double>> &a,
            std::int64_t lda, sycl::buffer<std::complex<double>> &tau,
            sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].zungbr_sycl(queue, vec, m, n, k, a, lda, tau, scratchpad,
-                                        scratchpad_size);
+    static stats::routine routine{ trace_site, "zungbr", "vec m n k lda scratchpad_size",
+                                   { stats::work::orgqr, stats::c64 } };
+    auto shape = verbose::make_dims(vec, m, n, k, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zungbr_sycl)(queue, vec, m, n, k, a, lda, tau, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void ungqr(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
            std::int64_t k, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
            sycl::buffer<std::complex<float>> &tau, sycl::buffer<std::complex<float>> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].cungqr_sycl(queue, m, n, k, a, lda, tau, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "cungqr", "m n k lda scratchpad_size",
+                                   { stats::work::orgqr, stats::c32 } };
+    auto shape = verbose::make_dims(m, n, k, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cungqr_sycl)(queue, m, n, k, a, lda, tau, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void ungqr(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
            std::int64_t k, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
            sycl::buffer<std::complex<double>> &tau, sycl::buffer<std::complex<double>> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].zungqr_sycl(queue, m, n, k, a, lda, tau, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "zungqr", "m n k lda scratchpad_size",
+                                   { stats::work::orgqr, stats::c64 } };
+    auto shape = verbose::make_dims(m, n, k, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zungqr_sycl)(queue, m, n, k, a, lda, tau, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void ungtr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
            sycl::buffer<std::complex<float>> &a, std::int64_t lda,
            sycl::buffer<std::complex<float>> &tau, sycl::buffer<std::complex<float>> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].cungtr_sycl(queue, uplo, n, a, lda, tau, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "cungtr", "uplo n lda scratchpad_size",
+                                   { stats::work::orgtr, stats::c32 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cungtr_sycl)(queue, uplo, n, a, lda, tau, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void ungtr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
            sycl::buffer<std::complex<double>> &a, std::int64_t lda,
            sycl::buffer<std::complex<double>> &tau, sycl::buffer<std::complex<double>> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].zungtr_sycl(queue, uplo, n, a, lda, tau, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "zungtr", "uplo n lda scratchpad_size",
+                                   { stats::work::orgtr, stats::c64 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zungtr_sycl)(queue, uplo, n, a, lda, tau, scratchpad,
+                                           scratchpad_size);
+    });
 }
 void unmrq(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
            oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
@@ -549,8 +1476,13 @@ void unmrq(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side sid
            sycl::buffer<std::complex<float>> &tau, sycl::buffer<std::complex<float>> &c,
            std::int64_t ldc, sycl::buffer<std::complex<float>> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].cunmrq_sycl(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
-                                        scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "cunmrq", "side trans m n k lda ldc scratchpad_size",
+                                   { stats::work::ormqr, stats::c32 } };
+    auto shape = verbose::make_dims(side, trans, m, n, k, lda, ldc, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cunmrq_sycl)(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
+                                           scratchpad, scratchpad_size);
+    });
 }
 void unmrq(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
            oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
@@ -558,8 +1490,13 @@ void unmrq(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side sid
            sycl::buffer<std::complex<double>> &tau, sycl::buffer<std::complex<double>> &c,
            std::int64_t ldc, sycl::buffer<std::complex<double>> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].zunmrq_sycl(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
-                                        scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "zunmrq", "side trans m n k lda ldc scratchpad_size",
+                                   { stats::work::ormqr, stats::c64 } };
+    auto shape = verbose::make_dims(side, trans, m, n, k, lda, ldc, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zunmrq_sycl)(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
+                                           scratchpad, scratchpad_size);
+    });
 }
 void unmqr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
            oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
@@ -567,8 +1504,13 @@ void unmqr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side sid
            sycl::buffer<std::complex<float>> &tau, sycl::buffer<std::complex<float>> &c,
            std::int64_t ldc, sycl::buffer<std::complex<float>> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].cunmqr_sycl(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
-                                        scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "cunmqr", "side trans m n k lda ldc scratchpad_size",
+                                   { stats::work::ormqr, stats::c32 } };
+    auto shape = verbose::make_dims(side, trans, m, n, k, lda, ldc, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cunmqr_sycl)(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
+                                           scratchpad, scratchpad_size);
+    });
 }
 void unmqr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
            oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
@@ -576,8 +1518,13 @@ void unmqr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side sid
            sycl::buffer<std::complex<double>> &tau, sycl::buffer<std::complex<double>> &c,
            std::int64_t ldc, sycl::buffer<std::complex<double>> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].zunmqr_sycl(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
-                                        scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "zunmqr", "side trans m n k lda ldc scratchpad_size",
+                                   { stats::work::ormqr, stats::c64 } };
+    auto shape = verbose::make_dims(side, trans, m, n, k, lda, ldc, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zunmqr_sycl)(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
+                                           scratchpad, scratchpad_size);
+    });
 }
 void unmtr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
            oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
@@ -585,8 +1532,14 @@ void unmtr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side sid
            sycl::buffer<std::complex<float>> &tau, sycl::buffer<std::complex<float>> &c,
            std::int64_t ldc, sycl::buffer<std::complex<float>> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].cunmtr_sycl(queue, side, uplo, trans, m, n, a, lda, tau, c, ldc,
-                                        scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "cunmtr",
+                                   "side uplo trans m n lda ldc scratchpad_size",
+                                   { stats::work::ormtr, stats::c32 } };
+    auto shape = verbose::make_dims(side, uplo, trans, m, n, lda, ldc, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cunmtr_sycl)(queue, side, uplo, trans, m, n, a, lda, tau, c, ldc,
+                                           scratchpad, scratchpad_size);
+    });
 }
 void unmtr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
            oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
@@ -594,197 +1547,498 @@ void unmtr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side sid
            sycl::buffer<std::complex<double>> &tau, sycl::buffer<std::complex<double>> &c,
            std::int64_t ldc, sycl::buffer<std::complex<double>> &scratchpad,
            std::int64_t scratchpad_size) {
-    function_tables[libkey].zunmtr_sycl(queue, side, uplo, trans, m, n, a, lda, tau, c, ldc,
-                                        scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "zunmtr",
+                                   "side uplo trans m n lda ldc scratchpad_size",
+                                   { stats::work::ormtr, stats::c64 } };
+    auto shape = verbose::make_dims(side, uplo, trans, m, n, lda, ldc, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zunmtr_sycl)(queue, side, uplo, trans, m, n, a, lda, tau, c, ldc,
+                                           scratchpad, scratchpad_size);
+    });
 }
 sycl::event gebrd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                   std::complex<float> *a, std::int64_t lda, float *d, float *e,
                   std::complex<float> *tauq, std::complex<float> *taup,
                   std::complex<float> *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cgebrd_usm_sycl(queue, m, n, a, lda, d, e, tauq, taup,
-                                                   scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "cgebrd_usm", "m n lda scratchpad_size",
+                                   { stats::work::gebrd, stats::c32 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cgebrd_usm_sycl)(queue, m, n, a, lda, d, e, tauq, taup,
+                                                      scratchpad, scratchpad_size, dependencies);
+    });
 }
 sycl::event gebrd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                   double *a, std::int64_t lda, double *d, double *e, double *tauq, double *taup,
                   double *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dgebrd_usm_sycl(queue, m, n, a, lda, d, e, tauq, taup,
-                                                   scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dgebrd_usm", "m n lda scratchpad_size",
+                                   { stats::work::gebrd, stats::f64 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dgebrd_usm_sycl)(queue, m, n, a, lda, d, e, tauq, taup,
+                                                      scratchpad, scratchpad_size, dependencies);
+    });
 }
 sycl::event gebrd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                   float *a, std::int64_t lda, float *d, float *e, float *tauq, float *taup,
                   float *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].sgebrd_usm_sycl(queue, m, n, a, lda, d, e, tauq, taup,
-                                                   scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "sgebrd_usm", "m n lda scratchpad_size",
+                                   { stats::work::gebrd, stats::f32 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sgebrd_usm_sycl)(queue, m, n, a, lda, d, e, tauq, taup,
+                                                      scratchpad, scratchpad_size, dependencies);
+    });
 }
 sycl::event gebrd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                   std::complex<double> *a, std::int64_t lda, double *d, double *e,
                   std::complex<double> *tauq, std::complex<double> *taup,
                   std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zgebrd_usm_sycl(queue, m, n, a, lda, d, e, tauq, taup,
-                                                   scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zgebrd_usm", "m n lda scratchpad_size",
+                                   { stats::work::gebrd, stats::c64 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zgebrd_usm_sycl)(queue, m, n, a, lda, d, e, tauq, taup,
+                                                      scratchpad, scratchpad_size, dependencies);
+    });
+}
+sycl::event gels(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
+                 std::int64_t m, std::int64_t n, std::int64_t nrhs, float *a, std::int64_t lda,
+                 float *b, std::int64_t ldb, float *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "sgels_usm",
+                                   "trans m n nrhs lda ldb scratchpad_size",
+                                   { stats::work::gels, stats::f32 } };
+    auto shape = verbose::make_dims(trans, m, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sgels_usm_sycl)(queue, trans, m, n, nrhs, a, lda, b, ldb,
+                                                     scratchpad, scratchpad_size, dependencies);
+    });
+}
+sycl::event gels(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
+                 std::int64_t m, std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda,
+                 double *b, std::int64_t ldb, double *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "dgels_usm",
+                                   "trans m n nrhs lda ldb scratchpad_size",
+                                   { stats::work::gels, stats::f64 } };
+    auto shape = verbose::make_dims(trans, m, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dgels_usm_sycl)(queue, trans, m, n, nrhs, a, lda, b, ldb,
+                                                     scratchpad, scratchpad_size, dependencies);
+    });
+}
+sycl::event gels(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
+                 std::int64_t m, std::int64_t n, std::int64_t nrhs, std::complex<float> *a,
+                 std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
+                 std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "cgels_usm",
+                                   "trans m n nrhs lda ldb scratchpad_size",
+                                   { stats::work::gels, stats::c32 } };
+    auto shape = verbose::make_dims(trans, m, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cgels_usm_sycl)(queue, trans, m, n, nrhs, a, lda, b, ldb,
+                                                     scratchpad, scratchpad_size, dependencies);
+    });
+}
+sycl::event gels(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
+                 std::int64_t m, std::int64_t n, std::int64_t nrhs, std::complex<double> *a,
+                 std::int64_t lda, std::complex<double> *b, std::int64_t ldb,
+                 std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "zgels_usm",
+                                   "trans m n nrhs lda ldb scratchpad_size",
+                                   { stats::work::gels, stats::c64 } };
+    auto shape = verbose::make_dims(trans, m, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zgels_usm_sycl)(queue, trans, m, n, nrhs, a, lda, b, ldb,
+                                                     scratchpad, scratchpad_size, dependencies);
+    });
+}
+sycl::event gelsd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
+                  std::int64_t nrhs, float *a, std::int64_t lda, float *b, std::int64_t ldb,
+                  float *s, float rcond, std::int64_t *rank, float *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "sgelsd_usm", "m n nrhs lda ldb scratchpad_size",
+                                   { stats::work::gels, stats::f32 } };
+    auto shape = verbose::make_dims(m, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sgelsd_usm_sycl)(queue, m, n, nrhs, a, lda, b, ldb, s, rcond,
+                                                      rank, scratchpad, scratchpad_size,
+                                                      dependencies);
+    });
+}
+sycl::event gelsd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
+                  std::int64_t nrhs, double *a, std::int64_t lda, double *b, std::int64_t ldb,
+                  double *s, double rcond, std::int64_t *rank, double *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "dgelsd_usm", "m n nrhs lda ldb scratchpad_size",
+                                   { stats::work::gels, stats::f64 } };
+    auto shape = verbose::make_dims(m, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dgelsd_usm_sycl)(queue, m, n, nrhs, a, lda, b, ldb, s, rcond,
+                                                      rank, scratchpad, scratchpad_size,
+                                                      dependencies);
+    });
+}
+sycl::event gelsd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
+                  std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                  std::complex<float> *b, std::int64_t ldb, float *s, float rcond,
+                  std::int64_t *rank, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "cgelsd_usm", "m n nrhs lda ldb scratchpad_size",
+                                   { stats::work::gels, stats::c32 } };
+    auto shape = verbose::make_dims(m, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cgelsd_usm_sycl)(queue, m, n, nrhs, a, lda, b, ldb, s, rcond,
+                                                      rank, scratchpad, scratchpad_size,
+                                                      dependencies);
+    });
+}
+sycl::event gelsd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
+                  std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                  std::complex<double> *b, std::int64_t ldb, double *s, double rcond,
+                  std::int64_t *rank, std::complex<double> *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "zgelsd_usm", "m n nrhs lda ldb scratchpad_size",
+                                   { stats::work::gels, stats::c64 } };
+    auto shape = verbose::make_dims(m, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zgelsd_usm_sycl)(queue, m, n, nrhs, a, lda, b, ldb, s, rcond,
+                                                      rank, scratchpad, scratchpad_size,
+                                                      dependencies);
+    });
 }
 sycl::event gerqf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                   float *a, std::int64_t lda, float *tau, float *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].sgerqf_usm_sycl(queue, m, n, a, lda, tau, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "sgerqf_usm", "m n lda scratchpad_size",
+                                   { stats::work::geqrf, stats::f32 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sgerqf_usm_sycl)(queue, m, n, a, lda, tau, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event gerqf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                   double *a, std::int64_t lda, double *tau, double *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dgerqf_usm_sycl(queue, m, n, a, lda, tau, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dgerqf_usm", "m n lda scratchpad_size",
+                                   { stats::work::geqrf, stats::f64 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dgerqf_usm_sycl)(queue, m, n, a, lda, tau, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event gerqf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                   std::complex<float> *a, std::int64_t lda, std::complex<float> *tau,
                   std::complex<float> *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cgerqf_usm_sycl(queue, m, n, a, lda, tau, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "cgerqf_usm", "m n lda scratchpad_size",
+                                   { stats::work::geqrf, stats::c32 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cgerqf_usm_sycl)(queue, m, n, a, lda, tau, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event gerqf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                   std::complex<double> *a, std::int64_t lda, std::complex<double> *tau,
                   std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zgerqf_usm_sycl(queue, m, n, a, lda, tau, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zgerqf_usm", "m n lda scratchpad_size",
+                                   { stats::work::geqrf, stats::c64 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zgerqf_usm_sycl)(queue, m, n, a, lda, tau, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event geqrf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                   std::complex<float> *a, std::int64_t lda, std::complex<float> *tau,
                   std::complex<float> *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cgeqrf_usm_sycl(queue, m, n, a, lda, tau, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "cgeqrf_usm", "m n lda scratchpad_size",
+                                   { stats::work::geqrf, stats::c32 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cgeqrf_usm_sycl)(queue, m, n, a, lda, tau, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event geqrf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                   double *a, std::int64_t lda, double *tau, double *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dgeqrf_usm_sycl(queue, m, n, a, lda, tau, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dgeqrf_usm", "m n lda scratchpad_size",
+                                   { stats::work::geqrf, stats::f64 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dgeqrf_usm_sycl)(queue, m, n, a, lda, tau, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event geqrf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                   float *a, std::int64_t lda, float *tau, float *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].sgeqrf_usm_sycl(queue, m, n, a, lda, tau, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "sgeqrf_usm", "m n lda scratchpad_size",
+                                   { stats::work::geqrf, stats::f32 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sgeqrf_usm_sycl)(queue, m, n, a, lda, tau, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event geqrf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                   std::complex<double> *a, std::int64_t lda, std::complex<double> *tau,
                   std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zgeqrf_usm_sycl(queue, m, n, a, lda, tau, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zgeqrf_usm", "m n lda scratchpad_size",
+                                   { stats::work::geqrf, stats::c64 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zgeqrf_usm_sycl)(queue, m, n, a, lda, tau, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event getrf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                   std::complex<float> *a, std::int64_t lda, std::int64_t *ipiv,
                   std::complex<float> *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cgetrf_usm_sycl(queue, m, n, a, lda, ipiv, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "cgetrf_usm", "m n lda scratchpad_size",
+                                   { stats::work::getrf, stats::c32 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cgetrf_usm_sycl)(queue, m, n, a, lda, ipiv, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event getrf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                   double *a, std::int64_t lda, std::int64_t *ipiv, double *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dgetrf_usm_sycl(queue, m, n, a, lda, ipiv, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dgetrf_usm", "m n lda scratchpad_size",
+                                   { stats::work::getrf, stats::f64 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dgetrf_usm_sycl)(queue, m, n, a, lda, ipiv, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event getrf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                   float *a, std::int64_t lda, std::int64_t *ipiv, float *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].sgetrf_usm_sycl(queue, m, n, a, lda, ipiv, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "sgetrf_usm", "m n lda scratchpad_size",
+                                   { stats::work::getrf, stats::f32 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sgetrf_usm_sycl)(queue, m, n, a, lda, ipiv, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event getrf(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                   std::complex<double> *a, std::int64_t lda, std::int64_t *ipiv,
                   std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zgetrf_usm_sycl(queue, m, n, a, lda, ipiv, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zgetrf_usm", "m n lda scratchpad_size",
+                                   { stats::work::getrf, stats::c64 } };
+    auto shape = verbose::make_dims(m, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zgetrf_usm_sycl)(queue, m, n, a, lda, ipiv, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event getri(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                   std::complex<float> *a, std::int64_t lda, std::int64_t *ipiv,
                   std::complex<float> *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cgetri_usm_sycl(queue, n, a, lda, ipiv, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "cgetri_usm", "n lda scratchpad_size",
+                                   { stats::work::getri, stats::c32 } };
+    auto shape = verbose::make_dims(n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cgetri_usm_sycl)(queue, n, a, lda, ipiv, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event getri(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double *a,
                   std::int64_t lda, std::int64_t *ipiv, double *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dgetri_usm_sycl(queue, n, a, lda, ipiv, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dgetri_usm", "n lda scratchpad_size",
+                                   { stats::work::getri, stats::f64 } };
+    auto shape = verbose::make_dims(n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dgetri_usm_sycl)(queue, n, a, lda, ipiv, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event getri(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float *a,
                   std::int64_t lda, std::int64_t *ipiv, float *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].sgetri_usm_sycl(queue, n, a, lda, ipiv, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "sgetri_usm", "n lda scratchpad_size",
+                                   { stats::work::getri, stats::f32 } };
+    auto shape = verbose::make_dims(n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sgetri_usm_sycl)(queue, n, a, lda, ipiv, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event getri(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                   std::complex<double> *a, std::int64_t lda, std::int64_t *ipiv,
                   std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zgetri_usm_sycl(queue, n, a, lda, ipiv, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zgetri_usm", "n lda scratchpad_size",
+                                   { stats::work::getri, stats::c64 } };
+    auto shape = verbose::make_dims(n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zgetri_usm_sycl)(queue, n, a, lda, ipiv, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event getrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
                   std::int64_t n, std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
                   std::int64_t *ipiv, std::complex<float> *b, std::int64_t ldb,
                   std::complex<float> *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cgetrs_usm_sycl(queue, trans, n, nrhs, a, lda, ipiv, b, ldb,
-                                                   scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "cgetrs_usm", "trans n nrhs lda ldb scratchpad_size",
+                                   { stats::work::getrs, stats::c32 } };
+    auto shape = verbose::make_dims(trans, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cgetrs_usm_sycl)(queue, trans, n, nrhs, a, lda, ipiv, b, ldb,
+                                                      scratchpad, scratchpad_size, dependencies);
+    });
 }
 sycl::event getrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
                   std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda,
                   std::int64_t *ipiv, double *b, std::int64_t ldb, double *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dgetrs_usm_sycl(queue, trans, n, nrhs, a, lda, ipiv, b, ldb,
-                                                   scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dgetrs_usm", "trans n nrhs lda ldb scratchpad_size",
+                                   { stats::work::getrs, stats::f64 } };
+    auto shape = verbose::make_dims(trans, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dgetrs_usm_sycl)(queue, trans, n, nrhs, a, lda, ipiv, b, ldb,
+                                                      scratchpad, scratchpad_size, dependencies);
+    });
 }
 sycl::event getrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
                   std::int64_t n, std::int64_t nrhs, float *a, std::int64_t lda, std::int64_t *ipiv,
                   float *b, std::int64_t ldb, float *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].sgetrs_usm_sycl(queue, trans, n, nrhs, a, lda, ipiv, b, ldb,
-                                                   scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "sgetrs_usm", "trans n nrhs lda ldb scratchpad_size",
+                                   { stats::work::getrs, stats::f32 } };
+    auto shape = verbose::make_dims(trans, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sgetrs_usm_sycl)(queue, trans, n, nrhs, a, lda, ipiv, b, ldb,
+                                                      scratchpad, scratchpad_size, dependencies);
+    });
 }
 sycl::event getrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
                   std::int64_t n, std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
                   std::int64_t *ipiv, std::complex<double> *b, std::int64_t ldb,
                   std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zgetrs_usm_sycl(queue, trans, n, nrhs, a, lda, ipiv, b, ldb,
-                                                   scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zgetrs_usm", "trans n nrhs lda ldb scratchpad_size",
+                                   { stats::work::getrs, stats::c64 } };
+    auto shape = verbose::make_dims(trans, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zgetrs_usm_sycl)(queue, trans, n, nrhs, a, lda, ipiv, b, ldb,
+                                                      scratchpad, scratchpad_size, dependencies);
+    });
+}
+sycl::event gesv(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                 float *a, std::int64_t lda, std::int64_t *ipiv, float *b, std::int64_t ldb,
+                 float *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "sgesv_usm", "n nrhs lda ldb scratchpad_size",
+                                   { stats::work::gesv, stats::f32 } };
+    auto shape = verbose::make_dims(n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sgesv_usm_sycl)(queue, n, nrhs, a, lda, ipiv, b, ldb,
+                                                     scratchpad, scratchpad_size, dependencies);
+    });
+}
+sycl::event gesv(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                 double *a, std::int64_t lda, std::int64_t *ipiv, double *b, std::int64_t ldb,
+                 double *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "dgesv_usm", "n nrhs lda ldb scratchpad_size",
+                                   { stats::work::gesv, stats::f64 } };
+    auto shape = verbose::make_dims(n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dgesv_usm_sycl)(queue, n, nrhs, a, lda, ipiv, b, ldb,
+                                                     scratchpad, scratchpad_size, dependencies);
+    });
+}
+sycl::event gesv(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                 std::complex<float> *a, std::int64_t lda, std::int64_t *ipiv,
+                 std::complex<float> *b, std::int64_t ldb, std::complex<float> *scratchpad,
+                 std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "cgesv_usm", "n nrhs lda ldb scratchpad_size",
+                                   { stats::work::gesv, stats::c32 } };
+    auto shape = verbose::make_dims(n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cgesv_usm_sycl)(queue, n, nrhs, a, lda, ipiv, b, ldb,
+                                                     scratchpad, scratchpad_size, dependencies);
+    });
+}
+sycl::event gesv(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                 std::complex<double> *a, std::int64_t lda, std::int64_t *ipiv,
+                 std::complex<double> *b, std::int64_t ldb, std::complex<double> *scratchpad,
+                 std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "zgesv_usm", "n nrhs lda ldb scratchpad_size",
+                                   { stats::work::gesv, stats::c64 } };
+    auto shape = verbose::make_dims(n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zgesv_usm_sycl)(queue, n, nrhs, a, lda, ipiv, b, ldb,
+                                                     scratchpad, scratchpad_size, dependencies);
+    });
 }
 sycl::event gesvd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
                   oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, double *a,
                   std::int64_t lda, double *s, double *u, std::int64_t ldu, double *vt,
                   std::int64_t ldvt, double *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dgesvd_usm_sycl(queue, jobu, jobvt, m, n, a, lda, s, u, ldu, vt,
-                                                   ldvt, scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dgesvd_usm",
+                                   "jobu jobvt m n lda ldu ldvt scratchpad_size",
+                                   { stats::work::gebrd, stats::f64 } };
+    auto shape = verbose::make_dims(jobu, jobvt, m, n, lda, ldu, ldvt, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dgesvd_usm_sycl)(queue, jobu, jobvt, m, n, a, lda, s, u, ldu,
+                                                      vt, ldvt, scratchpad, scratchpad_size,
+                                                      dependencies);
+    });
 }
 sycl::event gesvd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
                   oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, float *a,
                   std::int64_t lda, float *s, float *u, std::int64_t ldu, float *vt,
                   std::int64_t ldvt, float *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].sgesvd_usm_sycl(queue, jobu, jobvt, m, n, a, lda, s, u, ldu, vt,
-                                                   ldvt, scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "sgesvd_usm",
+                                   "jobu jobvt m n lda ldu ldvt scratchpad_size",
+                                   { stats::work::gebrd, stats::f32 } };
+    auto shape = verbose::make_dims(jobu, jobvt, m, n, lda, ldu, ldvt, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sgesvd_usm_sycl)(queue, jobu, jobvt, m, n, a, lda, s, u, ldu,
+                                                      vt, ldvt, scratchpad, scratchpad_size,
+                                                      dependencies);
+    });
 }
 sycl::event gesvd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
                   oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::complex<float> *a,
@@ -792,8 +2046,15 @@ sycl::event gesvd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::j
                   std::complex<float> *vt, std::int64_t ldvt, std::complex<float> *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cgesvd_usm_sycl(queue, jobu, jobvt, m, n, a, lda, s, u, ldu, vt,
-                                                   ldvt, scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "cgesvd_usm",
+                                   "jobu jobvt m n lda ldu ldvt scratchpad_size",
+                                   { stats::work::gebrd, stats::c32 } };
+    auto shape = verbose::make_dims(jobu, jobvt, m, n, lda, ldu, ldvt, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cgesvd_usm_sycl)(queue, jobu, jobvt, m, n, a, lda, s, u, ldu,
+                                                      vt, ldvt, scratchpad, scratchpad_size,
+                                                      dependencies);
+    });
 }
 sycl::event gesvd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
                   oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n,
@@ -801,22 +2062,105 @@ sycl::event gesvd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::j
                   std::int64_t ldu, std::complex<double> *vt, std::int64_t ldvt,
                   std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zgesvd_usm_sycl(queue, jobu, jobvt, m, n, a, lda, s, u, ldu, vt,
-                                                   ldvt, scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zgesvd_usm",
+                                   "jobu jobvt m n lda ldu ldvt scratchpad_size",
+                                   { stats::work::gebrd, stats::c64 } };
+    auto shape = verbose::make_dims(jobu, jobvt, m, n, lda, ldu, ldvt, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zgesvd_usm_sycl)(queue, jobu, jobvt, m, n, a, lda, s, u, ldu,
+                                                      vt, ldvt, scratchpad, scratchpad_size,
+                                                      dependencies);
+    });
 }
 sycl::event heevd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
                   oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a, std::int64_t lda,
                   float *w, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cheevd_usm_sycl(queue, jobz, uplo, n, a, lda, w, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "cheevd_usm", "jobz uplo n lda scratchpad_size",
+                                   { stats::work::syevd, stats::c32 } };
+    auto shape = verbose::make_dims(jobz, uplo, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cheevd_usm_sycl)(queue, jobz, uplo, n, a, lda, w, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event heevd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
                   oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a, std::int64_t lda,
                   double *w, std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zheevd_usm_sycl(queue, jobz, uplo, n, a, lda, w, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zheevd_usm", "jobz uplo n lda scratchpad_size",
+                                   { stats::work::syevd, stats::c64 } };
+    auto shape = verbose::make_dims(jobz, uplo, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zheevd_usm_sycl)(queue, jobz, uplo, n, a, lda, w, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
+}
+sycl::event heevr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                  std::complex<float> *a, std::int64_t lda, float vl, float vu, std::int64_t il,
+                  std::int64_t iu, float abstol, std::int64_t *m, float *w, std::complex<float> *z,
+                  std::int64_t ldz, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "cheevr_usm",
+                                   "jobz range uplo n lda il iu ldz scratchpad_size",
+                                   { stats::work::syevd, stats::c32 } };
+    auto shape = verbose::make_dims(jobz, range, uplo, n, lda, il, iu, ldz, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cheevr_usm_sycl)(queue, jobz, range, uplo, n, a, lda, vl, vu,
+                                                      il, iu, abstol, m, w, z, ldz, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
+}
+sycl::event heevr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                  std::complex<double> *a, std::int64_t lda, double vl, double vu, std::int64_t il,
+                  std::int64_t iu, double abstol, std::int64_t *m, double *w,
+                  std::complex<double> *z, std::int64_t ldz, std::complex<double> *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "zheevr_usm",
+                                   "jobz range uplo n lda il iu ldz scratchpad_size",
+                                   { stats::work::syevd, stats::c64 } };
+    auto shape = verbose::make_dims(jobz, range, uplo, n, lda, il, iu, ldz, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zheevr_usm_sycl)(queue, jobz, range, uplo, n, a, lda, vl, vu,
+                                                      il, iu, abstol, m, w, z, ldz, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
+}
+sycl::event heevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                  std::complex<float> *a, std::int64_t lda, float vl, float vu, std::int64_t il,
+                  std::int64_t iu, float abstol, std::int64_t *m, float *w, std::complex<float> *z,
+                  std::int64_t ldz, std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "cheevx_usm",
+                                   "jobz range uplo n lda il iu ldz scratchpad_size",
+                                   { stats::work::syevd, stats::c32 } };
+    auto shape = verbose::make_dims(jobz, range, uplo, n, lda, il, iu, ldz, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cheevx_usm_sycl)(queue, jobz, range, uplo, n, a, lda, vl, vu,
+                                                      il, iu, abstol, m, w, z, ldz, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
+}
+sycl::event heevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n,
+                  std::complex<double> *a, std::int64_t lda, double vl, double vu, std::int64_t il,
+                  std::int64_t iu, double abstol, std::int64_t *m, double *w,
+                  std::complex<double> *z, std::int64_t ldz, std::complex<double> *scratchpad,
+                  std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "zheevx_usm",
+                                   "jobz range uplo n lda il iu ldz scratchpad_size",
+                                   { stats::work::syevd, stats::c64 } };
+    auto shape = verbose::make_dims(jobz, range, uplo, n, lda, il, iu, ldz, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zheevx_usm_sycl)(queue, jobz, range, uplo, n, a, lda, vl, vu,
+                                                      il, iu, abstol, m, w, z, ldz, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event hegvd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t itype,
                   oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
@@ -824,8 +2168,14 @@ sycl::event hegvd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t i
                   std::int64_t ldb, float *w, std::complex<float> *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].chegvd_usm_sycl(queue, itype, jobz, uplo, n, a, lda, b, ldb, w,
-                                                   scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "chegvd_usm",
+                                   "itype jobz uplo n lda ldb scratchpad_size",
+                                   { stats::work::sygvd, stats::c32 } };
+    auto shape = verbose::make_dims(itype, jobz, uplo, n, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.chegvd_usm_sycl)(queue, itype, jobz, uplo, n, a, lda, b, ldb,
+                                                      w, scratchpad, scratchpad_size, dependencies);
+    });
 }
 sycl::event hegvd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t itype,
                   oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n,
@@ -833,286 +2183,660 @@ sycl::event hegvd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t i
                   std::int64_t ldb, double *w, std::complex<double> *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zhegvd_usm_sycl(queue, itype, jobz, uplo, n, a, lda, b, ldb, w,
-                                                   scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zhegvd_usm",
+                                   "itype jobz uplo n lda ldb scratchpad_size",
+                                   { stats::work::sygvd, stats::c64 } };
+    auto shape = verbose::make_dims(itype, jobz, uplo, n, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zhegvd_usm_sycl)(queue, itype, jobz, uplo, n, a, lda, b, ldb,
+                                                      w, scratchpad, scratchpad_size, dependencies);
+    });
 }
 sycl::event hetrd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   std::int64_t n, std::complex<float> *a, std::int64_t lda, float *d, float *e,
                   std::complex<float> *tau, std::complex<float> *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].chetrd_usm_sycl(queue, uplo, n, a, lda, d, e, tau, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "chetrd_usm", "uplo n lda scratchpad_size",
+                                   { stats::work::sytrd, stats::c32 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.chetrd_usm_sycl)(queue, uplo, n, a, lda, d, e, tau, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event hetrd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   std::int64_t n, std::complex<double> *a, std::int64_t lda, double *d, double *e,
                   std::complex<double> *tau, std::complex<double> *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zhetrd_usm_sycl(queue, uplo, n, a, lda, d, e, tau, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zhetrd_usm", "uplo n lda scratchpad_size",
+                                   { stats::work::sytrd, stats::c64 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zhetrd_usm_sycl)(queue, uplo, n, a, lda, d, e, tau, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event hetrf(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   std::int64_t n, std::complex<float> *a, std::int64_t lda, std::int64_t *ipiv,
                   std::complex<float> *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].chetrf_usm_sycl(queue, uplo, n, a, lda, ipiv, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "chetrf_usm", "uplo n lda scratchpad_size",
+                                   { stats::work::sytrf, stats::c32 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.chetrf_usm_sycl)(queue, uplo, n, a, lda, ipiv, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event hetrf(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   std::int64_t n, std::complex<double> *a, std::int64_t lda, std::int64_t *ipiv,
                   std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zhetrf_usm_sycl(queue, uplo, n, a, lda, ipiv, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zhetrf_usm", "uplo n lda scratchpad_size",
+                                   { stats::work::sytrf, stats::c64 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zhetrf_usm_sycl)(queue, uplo, n, a, lda, ipiv, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event orgbr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::generate vec,
                   std::int64_t m, std::int64_t n, std::int64_t k, float *a, std::int64_t lda,
                   float *tau, float *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].sorgbr_usm_sycl(queue, vec, m, n, k, a, lda, tau, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "sorgbr_usm", "vec m n k lda scratchpad_size",
+                                   { stats::work::orgqr, stats::f32 } };
+    auto shape = verbose::make_dims(vec, m, n, k, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sorgbr_usm_sycl)(queue, vec, m, n, k, a, lda, tau, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event orgbr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::generate vec,
                   std::int64_t m, std::int64_t n, std::int64_t k, double *a, std::int64_t lda,
                   double *tau, double *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dorgbr_usm_sycl(queue, vec, m, n, k, a, lda, tau, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dorgbr_usm", "vec m n k lda scratchpad_size",
+                                   { stats::work::orgqr, stats::f64 } };
+    auto shape = verbose::make_dims(vec, m, n, k, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dorgbr_usm_sycl)(queue, vec, m, n, k, a, lda, tau, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event orgqr(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                   std::int64_t k, double *a, std::int64_t lda, double *tau, double *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dorgqr_usm_sycl(queue, m, n, k, a, lda, tau, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dorgqr_usm", "m n k lda scratchpad_size",
+                                   { stats::work::orgqr, stats::f64 } };
+    auto shape = verbose::make_dims(m, n, k, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dorgqr_usm_sycl)(queue, m, n, k, a, lda, tau, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event orgqr(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                   std::int64_t k, float *a, std::int64_t lda, float *tau, float *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].sorgqr_usm_sycl(queue, m, n, k, a, lda, tau, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "sorgqr_usm", "m n k lda scratchpad_size",
+                                   { stats::work::orgqr, stats::f32 } };
+    auto shape = verbose::make_dims(m, n, k, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sorgqr_usm_sycl)(queue, m, n, k, a, lda, tau, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event orgtr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   std::int64_t n, float *a, std::int64_t lda, float *tau, float *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].sorgtr_usm_sycl(queue, uplo, n, a, lda, tau, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "sorgtr_usm", "uplo n lda scratchpad_size",
+                                   { stats::work::orgtr, stats::f32 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sorgtr_usm_sycl)(queue, uplo, n, a, lda, tau, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event orgtr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   std::int64_t n, double *a, std::int64_t lda, double *tau, double *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dorgtr_usm_sycl(queue, uplo, n, a, lda, tau, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dorgtr_usm", "uplo n lda scratchpad_size",
+                                   { stats::work::orgtr, stats::f64 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dorgtr_usm_sycl)(queue, uplo, n, a, lda, tau, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event ormtr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
                   oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans, std::int64_t m,
                   std::int64_t n, float *a, std::int64_t lda, float *tau, float *c,
                   std::int64_t ldc, float *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].sormtr_usm_sycl(queue, side, uplo, trans, m, n, a, lda, tau, c,
-                                                   ldc, scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "sormtr_usm",
+                                   "side uplo trans m n lda ldc scratchpad_size",
+                                   { stats::work::ormtr, stats::f32 } };
+    auto shape = verbose::make_dims(side, uplo, trans, m, n, lda, ldc, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sormtr_usm_sycl)(queue, side, uplo, trans, m, n, a, lda, tau,
+                                                      c, ldc, scratchpad, scratchpad_size,
+                                                      dependencies);
+    });
 }
 sycl::event ormtr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
                   oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans, std::int64_t m,
                   std::int64_t n, double *a, std::int64_t lda, double *tau, double *c,
                   std::int64_t ldc, double *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dormtr_usm_sycl(queue, side, uplo, trans, m, n, a, lda, tau, c,
-                                                   ldc, scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dormtr_usm",
+                                   "side uplo trans m n lda ldc scratchpad_size",
+                                   { stats::work::ormtr, stats::f64 } };
+    auto shape = verbose::make_dims(side, uplo, trans, m, n, lda, ldc, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dormtr_usm_sycl)(queue, side, uplo, trans, m, n, a, lda, tau,
+                                                      c, ldc, scratchpad, scratchpad_size,
+                                                      dependencies);
+    });
 }
 sycl::event ormrq(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
                   oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
                   float *a, std::int64_t lda, float *tau, float *c, std::int64_t ldc,
                   float *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].sormrq_usm_sycl(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
-                                                   scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "sormrq_usm",
+                                   "side trans m n k lda ldc scratchpad_size",
+                                   { stats::work::ormqr, stats::f32 } };
+    auto shape = verbose::make_dims(side, trans, m, n, k, lda, ldc, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sormrq_usm_sycl)(queue, side, trans, m, n, k, a, lda, tau, c,
+                                                      ldc, scratchpad, scratchpad_size,
+                                                      dependencies);
+    });
 }
 sycl::event ormrq(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
                   oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
                   double *a, std::int64_t lda, double *tau, double *c, std::int64_t ldc,
                   double *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dormrq_usm_sycl(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
-                                                   scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dormrq_usm",
+                                   "side trans m n k lda ldc scratchpad_size",
+                                   { stats::work::ormqr, stats::f64 } };
+    auto shape = verbose::make_dims(side, trans, m, n, k, lda, ldc, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dormrq_usm_sycl)(queue, side, trans, m, n, k, a, lda, tau, c,
+                                                      ldc, scratchpad, scratchpad_size,
+                                                      dependencies);
+    });
 }
 sycl::event ormqr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
                   oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
                   double *a, std::int64_t lda, double *tau, double *c, std::int64_t ldc,
                   double *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dormqr_usm_sycl(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
-                                                   scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dormqr_usm",
+                                   "side trans m n k lda ldc scratchpad_size",
+                                   { stats::work::ormqr, stats::f64 } };
+    auto shape = verbose::make_dims(side, trans, m, n, k, lda, ldc, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dormqr_usm_sycl)(queue, side, trans, m, n, k, a, lda, tau, c,
+                                                      ldc, scratchpad, scratchpad_size,
+                                                      dependencies);
+    });
 }
 sycl::event ormqr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
                   oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
                   float *a, std::int64_t lda, float *tau, float *c, std::int64_t ldc,
                   float *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].sormqr_usm_sycl(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
-                                                   scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "sormqr_usm",
+                                   "side trans m n k lda ldc scratchpad_size",
+                                   { stats::work::ormqr, stats::f32 } };
+    auto shape = verbose::make_dims(side, trans, m, n, k, lda, ldc, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sormqr_usm_sycl)(queue, side, trans, m, n, k, a, lda, tau, c,
+                                                      ldc, scratchpad, scratchpad_size,
+                                                      dependencies);
+    });
 }
 sycl::event potrf(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   std::int64_t n, float *a, std::int64_t lda, float *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].spotrf_usm_sycl(queue, uplo, n, a, lda, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "spotrf_usm", "uplo n lda scratchpad_size",
+                                   { stats::work::potrf, stats::f32 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.spotrf_usm_sycl)(queue, uplo, n, a, lda, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event potrf(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   std::int64_t n, double *a, std::int64_t lda, double *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dpotrf_usm_sycl(queue, uplo, n, a, lda, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dpotrf_usm", "uplo n lda scratchpad_size",
+                                   { stats::work::potrf, stats::f64 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dpotrf_usm_sycl)(queue, uplo, n, a, lda, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event potrf(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   std::int64_t n, std::complex<float> *a, std::int64_t lda,
                   std::complex<float> *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cpotrf_usm_sycl(queue, uplo, n, a, lda, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "cpotrf_usm", "uplo n lda scratchpad_size",
+                                   { stats::work::potrf, stats::c32 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cpotrf_usm_sycl)(queue, uplo, n, a, lda, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event potrf(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   std::int64_t n, std::complex<double> *a, std::int64_t lda,
                   std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zpotrf_usm_sycl(queue, uplo, n, a, lda, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zpotrf_usm", "uplo n lda scratchpad_size",
+                                   { stats::work::potrf, stats::c64 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zpotrf_usm_sycl)(queue, uplo, n, a, lda, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event potri(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   std::int64_t n, float *a, std::int64_t lda, float *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].spotri_usm_sycl(queue, uplo, n, a, lda, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "spotri_usm", "uplo n lda scratchpad_size",
+                                   { stats::work::potri, stats::f32 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.spotri_usm_sycl)(queue, uplo, n, a, lda, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event potri(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   std::int64_t n, double *a, std::int64_t lda, double *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dpotri_usm_sycl(queue, uplo, n, a, lda, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dpotri_usm", "uplo n lda scratchpad_size",
+                                   { stats::work::potri, stats::f64 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dpotri_usm_sycl)(queue, uplo, n, a, lda, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event potri(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   std::int64_t n, std::complex<float> *a, std::int64_t lda,
                   std::complex<float> *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cpotri_usm_sycl(queue, uplo, n, a, lda, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "cpotri_usm", "uplo n lda scratchpad_size",
+                                   { stats::work::potri, stats::c32 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cpotri_usm_sycl)(queue, uplo, n, a, lda, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event potri(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   std::int64_t n, std::complex<double> *a, std::int64_t lda,
                   std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zpotri_usm_sycl(queue, uplo, n, a, lda, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zpotri_usm", "uplo n lda scratchpad_size",
+                                   { stats::work::potri, stats::c64 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zpotri_usm_sycl)(queue, uplo, n, a, lda, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event potrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   std::int64_t n, std::int64_t nrhs, float *a, std::int64_t lda, float *b,
                   std::int64_t ldb, float *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].spotrs_usm_sycl(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "spotrs_usm", "uplo n nrhs lda ldb scratchpad_size",
+                                   { stats::work::getrs, stats::f32 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.spotrs_usm_sycl)(queue, uplo, n, nrhs, a, lda, b, ldb,
+                                                      scratchpad, scratchpad_size, dependencies);
+    });
 }
 sycl::event potrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda, double *b,
                   std::int64_t ldb, double *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dpotrs_usm_sycl(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dpotrs_usm", "uplo n nrhs lda ldb scratchpad_size",
+                                   { stats::work::getrs, stats::f64 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dpotrs_usm_sycl)(queue, uplo, n, nrhs, a, lda, b, ldb,
+                                                      scratchpad, scratchpad_size, dependencies);
+    });
 }
 sycl::event potrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   std::int64_t n, std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
                   std::complex<float> *b, std::int64_t ldb, std::complex<float> *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cpotrs_usm_sycl(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "cpotrs_usm", "uplo n nrhs lda ldb scratchpad_size",
+                                   { stats::work::getrs, stats::c32 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cpotrs_usm_sycl)(queue, uplo, n, nrhs, a, lda, b, ldb,
+                                                      scratchpad, scratchpad_size, dependencies);
+    });
 }
 sycl::event potrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   std::int64_t n, std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
                   std::complex<double> *b, std::int64_t ldb, std::complex<double> *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zpotrs_usm_sycl(queue, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zpotrs_usm", "uplo n nrhs lda ldb scratchpad_size",
+                                   { stats::work::getrs, stats::c64 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zpotrs_usm_sycl)(queue, uplo, n, nrhs, a, lda, b, ldb,
+                                                      scratchpad, scratchpad_size, dependencies);
+    });
+}
+sycl::event posv(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                 std::int64_t n, std::int64_t nrhs, float *a, std::int64_t lda, float *b,
+                 std::int64_t ldb, float *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "sposv_usm", "uplo n nrhs lda ldb scratchpad_size",
+                                   { stats::work::posv, stats::f32 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sposv_usm_sycl)(queue, uplo, n, nrhs, a, lda, b, ldb,
+                                                     scratchpad, scratchpad_size, dependencies);
+    });
+}
+sycl::event posv(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                 std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda, double *b,
+                 std::int64_t ldb, double *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "dposv_usm", "uplo n nrhs lda ldb scratchpad_size",
+                                   { stats::work::posv, stats::f64 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dposv_usm_sycl)(queue, uplo, n, nrhs, a, lda, b, ldb,
+                                                     scratchpad, scratchpad_size, dependencies);
+    });
+}
+sycl::event posv(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                 std::int64_t n, std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                 std::complex<float> *b, std::int64_t ldb, std::complex<float> *scratchpad,
+                 std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "cposv_usm", "uplo n nrhs lda ldb scratchpad_size",
+                                   { stats::work::posv, stats::c32 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cposv_usm_sycl)(queue, uplo, n, nrhs, a, lda, b, ldb,
+                                                     scratchpad, scratchpad_size, dependencies);
+    });
+}
+sycl::event posv(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                 std::int64_t n, std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                 std::complex<double> *b, std::int64_t ldb, std::complex<double> *scratchpad,
+                 std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "zposv_usm", "uplo n nrhs lda ldb scratchpad_size",
+                                   { stats::work::posv, stats::c64 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zposv_usm_sycl)(queue, uplo, n, nrhs, a, lda, b, ldb,
+                                                     scratchpad, scratchpad_size, dependencies);
+    });
 }
 sycl::event syevd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
                   oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda, double *w,
                   double *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dsyevd_usm_sycl(queue, jobz, uplo, n, a, lda, w, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dsyevd_usm", "jobz uplo n lda scratchpad_size",
+                                   { stats::work::syevd, stats::f64 } };
+    auto shape = verbose::make_dims(jobz, uplo, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dsyevd_usm_sycl)(queue, jobz, uplo, n, a, lda, w, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event syevd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
                   oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda, float *w,
                   float *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].ssyevd_usm_sycl(queue, jobz, uplo, n, a, lda, w, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "ssyevd_usm", "jobz uplo n lda scratchpad_size",
+                                   { stats::work::syevd, stats::f32 } };
+    auto shape = verbose::make_dims(jobz, uplo, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.ssyevd_usm_sycl)(queue, jobz, uplo, n, a, lda, w, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
+}
+sycl::event syevr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, float *a,
+                  std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu,
+                  float abstol, std::int64_t *m, float *w, float *z, std::int64_t ldz,
+                  float *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "ssyevr_usm",
+                                   "jobz range uplo n lda il iu ldz scratchpad_size",
+                                   { stats::work::syevd, stats::f32 } };
+    auto shape = verbose::make_dims(jobz, range, uplo, n, lda, il, iu, ldz, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.ssyevr_usm_sycl)(queue, jobz, range, uplo, n, a, lda, vl, vu,
+                                                      il, iu, abstol, m, w, z, ldz, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
+}
+sycl::event syevr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, double *a,
+                  std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu,
+                  double abstol, std::int64_t *m, double *w, double *z, std::int64_t ldz,
+                  double *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "dsyevr_usm",
+                                   "jobz range uplo n lda il iu ldz scratchpad_size",
+                                   { stats::work::syevd, stats::f64 } };
+    auto shape = verbose::make_dims(jobz, range, uplo, n, lda, il, iu, ldz, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dsyevr_usm_sycl)(queue, jobz, range, uplo, n, a, lda, vl, vu,
+                                                      il, iu, abstol, m, w, z, ldz, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
+}
+sycl::event syevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, float *a,
+                  std::int64_t lda, float vl, float vu, std::int64_t il, std::int64_t iu,
+                  float abstol, std::int64_t *m, float *w, float *z, std::int64_t ldz,
+                  float *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "ssyevx_usm",
+                                   "jobz range uplo n lda il iu ldz scratchpad_size",
+                                   { stats::work::syevd, stats::f32 } };
+    auto shape = verbose::make_dims(jobz, range, uplo, n, lda, il, iu, ldz, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.ssyevx_usm_sycl)(queue, jobz, range, uplo, n, a, lda, vl, vu,
+                                                      il, iu, abstol, m, w, z, ldz, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
+}
+sycl::event syevx(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                  oneapi::mkl::rangev range, oneapi::mkl::uplo uplo, std::int64_t n, double *a,
+                  std::int64_t lda, double vl, double vu, std::int64_t il, std::int64_t iu,
+                  double abstol, std::int64_t *m, double *w, double *z, std::int64_t ldz,
+                  double *scratchpad, std::int64_t scratchpad_size,
+                  const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "dsyevx_usm",
+                                   "jobz range uplo n lda il iu ldz scratchpad_size",
+                                   { stats::work::syevd, stats::f64 } };
+    auto shape = verbose::make_dims(jobz, range, uplo, n, lda, il, iu, ldz, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dsyevx_usm_sycl)(queue, jobz, range, uplo, n, a, lda, vl, vu,
+                                                      il, iu, abstol, m, w, z, ldz, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event sygvd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t itype,
                   oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n, double *a,
                   std::int64_t lda, double *b, std::int64_t ldb, double *w, double *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dsygvd_usm_sycl(queue, itype, jobz, uplo, n, a, lda, b, ldb, w,
-                                                   scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dsygvd_usm",
+                                   "itype jobz uplo n lda ldb scratchpad_size",
+                                   { stats::work::sygvd, stats::f64 } };
+    auto shape = verbose::make_dims(itype, jobz, uplo, n, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dsygvd_usm_sycl)(queue, itype, jobz, uplo, n, a, lda, b, ldb,
+                                                      w, scratchpad, scratchpad_size, dependencies);
+    });
 }
 sycl::event sygvd(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t itype,
                   oneapi::mkl::job jobz, oneapi::mkl::uplo uplo, std::int64_t n, float *a,
                   std::int64_t lda, float *b, std::int64_t ldb, float *w, float *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].ssygvd_usm_sycl(queue, itype, jobz, uplo, n, a, lda, b, ldb, w,
-                                                   scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "ssygvd_usm",
+                                   "itype jobz uplo n lda ldb scratchpad_size",
+                                   { stats::work::sygvd, stats::f32 } };
+    auto shape = verbose::make_dims(itype, jobz, uplo, n, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.ssygvd_usm_sycl)(queue, itype, jobz, uplo, n, a, lda, b, ldb,
+                                                      w, scratchpad, scratchpad_size, dependencies);
+    });
 }
 sycl::event sytrd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   std::int64_t n, double *a, std::int64_t lda, double *d, double *e, double *tau,
                   double *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dsytrd_usm_sycl(queue, uplo, n, a, lda, d, e, tau, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dsytrd_usm", "uplo n lda scratchpad_size",
+                                   { stats::work::sytrd, stats::f64 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dsytrd_usm_sycl)(queue, uplo, n, a, lda, d, e, tau, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event sytrd(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   std::int64_t n, float *a, std::int64_t lda, float *d, float *e, float *tau,
                   float *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].ssytrd_usm_sycl(queue, uplo, n, a, lda, d, e, tau, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "ssytrd_usm", "uplo n lda scratchpad_size",
+                                   { stats::work::sytrd, stats::f32 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.ssytrd_usm_sycl)(queue, uplo, n, a, lda, d, e, tau, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event sytrf(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   std::int64_t n, float *a, std::int64_t lda, std::int64_t *ipiv, float *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].ssytrf_usm_sycl(queue, uplo, n, a, lda, ipiv, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "ssytrf_usm", "uplo n lda scratchpad_size",
+                                   { stats::work::sytrf, stats::f32 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.ssytrf_usm_sycl)(queue, uplo, n, a, lda, ipiv, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event sytrf(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   std::int64_t n, double *a, std::int64_t lda, std::int64_t *ipiv,
                   double *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dsytrf_usm_sycl(queue, uplo, n, a, lda, ipiv, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dsytrf_usm", "uplo n lda scratchpad_size",
+                                   { stats::work::sytrf, stats::f64 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dsytrf_usm_sycl)(queue, uplo, n, a, lda, ipiv, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event sytrf(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   std::int64_t n, std::complex<float> *a, std::int64_t lda, std::int64_t *ipiv,
                   std::complex<float> *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].csytrf_usm_sycl(queue, uplo, n, a, lda, ipiv, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "csytrf_usm", "uplo n lda scratchpad_size",
+                                   { stats::work::sytrf, stats::c32 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.csytrf_usm_sycl)(queue, uplo, n, a, lda, ipiv, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event sytrf(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   std::int64_t n, std::complex<double> *a, std::int64_t lda, std::int64_t *ipiv,
                   std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zsytrf_usm_sycl(queue, uplo, n, a, lda, ipiv, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zsytrf_usm", "uplo n lda scratchpad_size",
+                                   { stats::work::sytrf, stats::c64 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zsytrf_usm_sycl)(queue, uplo, n, a, lda, ipiv, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
+}
+sycl::event sysv(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                 std::int64_t n, std::int64_t nrhs, float *a, std::int64_t lda, std::int64_t *ipiv,
+                 float *b, std::int64_t ldb, float *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "ssysv_usm", "uplo n nrhs lda ldb scratchpad_size",
+                                   { stats::work::posv, stats::f32 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.ssysv_usm_sycl)(queue, uplo, n, nrhs, a, lda, ipiv, b, ldb,
+                                                     scratchpad, scratchpad_size, dependencies);
+    });
+}
+sycl::event sysv(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                 std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t *ipiv,
+                 double *b, std::int64_t ldb, double *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "dsysv_usm", "uplo n nrhs lda ldb scratchpad_size",
+                                   { stats::work::posv, stats::f64 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dsysv_usm_sycl)(queue, uplo, n, nrhs, a, lda, ipiv, b, ldb,
+                                                     scratchpad, scratchpad_size, dependencies);
+    });
+}
+sycl::event sysv(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                 std::int64_t n, std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                 std::int64_t *ipiv, std::complex<float> *b, std::int64_t ldb,
+                 std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "csysv_usm", "uplo n nrhs lda ldb scratchpad_size",
+                                   { stats::work::posv, stats::c32 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.csysv_usm_sycl)(queue, uplo, n, nrhs, a, lda, ipiv, b, ldb,
+                                                     scratchpad, scratchpad_size, dependencies);
+    });
+}
+sycl::event sysv(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                 std::int64_t n, std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                 std::int64_t *ipiv, std::complex<double> *b, std::int64_t ldb,
+                 std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                 const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "zsysv_usm", "uplo n nrhs lda ldb scratchpad_size",
+                                   { stats::work::posv, stats::c64 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zsysv_usm_sycl)(queue, uplo, n, nrhs, a, lda, ipiv, b, ldb,
+                                                     scratchpad, scratchpad_size, dependencies);
+    });
 }
 sycl::event trtrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t n,
@@ -1120,24 +2844,45 @@ sycl::event trtrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::u
                   std::complex<float> *b, std::int64_t ldb, std::complex<float> *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].ctrtrs_usm_sycl(queue, uplo, trans, diag, n, nrhs, a, lda, b,
-                                                   ldb, scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "ctrtrs_usm",
+                                   "uplo trans diag n nrhs lda ldb scratchpad_size",
+                                   { stats::work::trtrs, stats::c32 } };
+    auto shape = verbose::make_dims(uplo, trans, diag, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.ctrtrs_usm_sycl)(queue, uplo, trans, diag, n, nrhs, a, lda, b,
+                                                      ldb, scratchpad, scratchpad_size,
+                                                      dependencies);
+    });
 }
 sycl::event trtrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t n,
                   std::int64_t nrhs, double *a, std::int64_t lda, double *b, std::int64_t ldb,
                   double *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dtrtrs_usm_sycl(queue, uplo, trans, diag, n, nrhs, a, lda, b,
-                                                   ldb, scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dtrtrs_usm",
+                                   "uplo trans diag n nrhs lda ldb scratchpad_size",
+                                   { stats::work::trtrs, stats::f64 } };
+    auto shape = verbose::make_dims(uplo, trans, diag, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dtrtrs_usm_sycl)(queue, uplo, trans, diag, n, nrhs, a, lda, b,
+                                                      ldb, scratchpad, scratchpad_size,
+                                                      dependencies);
+    });
 }
 sycl::event trtrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t n,
                   std::int64_t nrhs, float *a, std::int64_t lda, float *b, std::int64_t ldb,
                   float *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].strtrs_usm_sycl(queue, uplo, trans, diag, n, nrhs, a, lda, b,
-                                                   ldb, scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "strtrs_usm",
+                                   "uplo trans diag n nrhs lda ldb scratchpad_size",
+                                   { stats::work::trtrs, stats::f32 } };
+    auto shape = verbose::make_dims(uplo, trans, diag, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.strtrs_usm_sycl)(queue, uplo, trans, diag, n, nrhs, a, lda, b,
+                                                      ldb, scratchpad, scratchpad_size,
+                                                      dependencies);
+    });
 }
 sycl::event trtrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t n,
@@ -1145,56 +2890,93 @@ sycl::event trtrs(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::u
                   std::complex<double> *b, std::int64_t ldb, std::complex<double> *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].ztrtrs_usm_sycl(queue, uplo, trans, diag, n, nrhs, a, lda, b,
-                                                   ldb, scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "ztrtrs_usm",
+                                   "uplo trans diag n nrhs lda ldb scratchpad_size",
+                                   { stats::work::trtrs, stats::c64 } };
+    auto shape = verbose::make_dims(uplo, trans, diag, n, nrhs, lda, ldb, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.ztrtrs_usm_sycl)(queue, uplo, trans, diag, n, nrhs, a, lda, b,
+                                                      ldb, scratchpad, scratchpad_size,
+                                                      dependencies);
+    });
 }
 sycl::event ungbr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::generate vec,
                   std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> *a,
                   std::int64_t lda, std::complex<float> *tau, std::complex<float> *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cungbr_usm_sycl(queue, vec, m, n, k, a, lda, tau, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "cungbr_usm", "vec m n k lda scratchpad_size",
+                                   { stats::work::orgqr, stats::c32 } };
+    auto shape = verbose::make_dims(vec, m, n, k, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cungbr_usm_sycl)(queue, vec, m, n, k, a, lda, tau, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event ungbr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::generate vec,
                   std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> *a,
                   std::int64_t lda, std::complex<double> *tau, std::complex<double> *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zungbr_usm_sycl(queue, vec, m, n, k, a, lda, tau, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zungbr_usm", "vec m n k lda scratchpad_size",
+                                   { stats::work::orgqr, stats::c64 } };
+    auto shape = verbose::make_dims(vec, m, n, k, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zungbr_usm_sycl)(queue, vec, m, n, k, a, lda, tau, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event ungqr(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                   std::int64_t k, std::complex<float> *a, std::int64_t lda,
                   std::complex<float> *tau, std::complex<float> *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cungqr_usm_sycl(queue, m, n, k, a, lda, tau, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "cungqr_usm", "m n k lda scratchpad_size",
+                                   { stats::work::orgqr, stats::c32 } };
+    auto shape = verbose::make_dims(m, n, k, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cungqr_usm_sycl)(queue, m, n, k, a, lda, tau, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event ungqr(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                   std::int64_t k, std::complex<double> *a, std::int64_t lda,
                   std::complex<double> *tau, std::complex<double> *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zungqr_usm_sycl(queue, m, n, k, a, lda, tau, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zungqr_usm", "m n k lda scratchpad_size",
+                                   { stats::work::orgqr, stats::c64 } };
+    auto shape = verbose::make_dims(m, n, k, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zungqr_usm_sycl)(queue, m, n, k, a, lda, tau, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event ungtr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   std::int64_t n, std::complex<float> *a, std::int64_t lda,
                   std::complex<float> *tau, std::complex<float> *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cungtr_usm_sycl(queue, uplo, n, a, lda, tau, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "cungtr_usm", "uplo n lda scratchpad_size",
+                                   { stats::work::orgtr, stats::c32 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cungtr_usm_sycl)(queue, uplo, n, a, lda, tau, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event ungtr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                   std::int64_t n, std::complex<double> *a, std::int64_t lda,
                   std::complex<double> *tau, std::complex<double> *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zungtr_usm_sycl(queue, uplo, n, a, lda, tau, scratchpad,
-                                                   scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zungtr_usm", "uplo n lda scratchpad_size",
+                                   { stats::work::orgtr, stats::c64 } };
+    auto shape = verbose::make_dims(uplo, n, lda, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zungtr_usm_sycl)(queue, uplo, n, a, lda, tau, scratchpad,
+                                                      scratchpad_size, dependencies);
+    });
 }
 sycl::event unmrq(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
                   oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
@@ -1202,8 +2984,15 @@ sycl::event unmrq(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::s
                   std::complex<float> *c, std::int64_t ldc, std::complex<float> *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cunmrq_usm_sycl(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
-                                                   scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "cunmrq_usm",
+                                   "side trans m n k lda ldc scratchpad_size",
+                                   { stats::work::ormqr, stats::c32 } };
+    auto shape = verbose::make_dims(side, trans, m, n, k, lda, ldc, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cunmrq_usm_sycl)(queue, side, trans, m, n, k, a, lda, tau, c,
+                                                      ldc, scratchpad, scratchpad_size,
+                                                      dependencies);
+    });
 }
 sycl::event unmrq(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
                   oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
@@ -1211,8 +3000,15 @@ sycl::event unmrq(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::s
                   std::complex<double> *c, std::int64_t ldc, std::complex<double> *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zunmrq_usm_sycl(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
-                                                   scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zunmrq_usm",
+                                   "side trans m n k lda ldc scratchpad_size",
+                                   { stats::work::ormqr, stats::c64 } };
+    auto shape = verbose::make_dims(side, trans, m, n, k, lda, ldc, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zunmrq_usm_sycl)(queue, side, trans, m, n, k, a, lda, tau, c,
+                                                      ldc, scratchpad, scratchpad_size,
+                                                      dependencies);
+    });
 }
 sycl::event unmqr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
                   oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
@@ -1220,8 +3016,15 @@ sycl::event unmqr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::s
                   std::complex<float> *c, std::int64_t ldc, std::complex<float> *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cunmqr_usm_sycl(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
-                                                   scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "cunmqr_usm",
+                                   "side trans m n k lda ldc scratchpad_size",
+                                   { stats::work::ormqr, stats::c32 } };
+    auto shape = verbose::make_dims(side, trans, m, n, k, lda, ldc, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cunmqr_usm_sycl)(queue, side, trans, m, n, k, a, lda, tau, c,
+                                                      ldc, scratchpad, scratchpad_size,
+                                                      dependencies);
+    });
 }
 sycl::event unmqr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
                   oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
@@ -1229,8 +3032,15 @@ sycl::event unmqr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::s
                   std::complex<double> *c, std::int64_t ldc, std::complex<double> *scratchpad,
                   std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zunmqr_usm_sycl(queue, side, trans, m, n, k, a, lda, tau, c, ldc,
-                                                   scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zunmqr_usm",
+                                   "side trans m n k lda ldc scratchpad_size",
+                                   { stats::work::ormqr, stats::c64 } };
+    auto shape = verbose::make_dims(side, trans, m, n, k, lda, ldc, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zunmqr_usm_sycl)(queue, side, trans, m, n, k, a, lda, tau, c,
+                                                      ldc, scratchpad, scratchpad_size,
+                                                      dependencies);
+    });
 }
 sycl::event unmtr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
                   oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans, std::int64_t m,
@@ -1238,8 +3048,15 @@ sycl::event unmtr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::s
                   std::complex<float> *tau, std::complex<float> *c, std::int64_t ldc,
                   std::complex<float> *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cunmtr_usm_sycl(queue, side, uplo, trans, m, n, a, lda, tau, c,
-                                                   ldc, scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "cunmtr_usm",
+                                   "side uplo trans m n lda ldc scratchpad_size",
+                                   { stats::work::ormtr, stats::c32 } };
+    auto shape = verbose::make_dims(side, uplo, trans, m, n, lda, ldc, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cunmtr_usm_sycl)(queue, side, uplo, trans, m, n, a, lda, tau,
+                                                      c, ldc, scratchpad, scratchpad_size,
+                                                      dependencies);
+    });
 }
 sycl::event unmtr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
                   oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans, std::int64_t m,
@@ -1247,70 +3064,125 @@ sycl::event unmtr(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::s
                   std::complex<double> *tau, std::complex<double> *c, std::int64_t ldc,
                   std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                   const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zunmtr_usm_sycl(queue, side, uplo, trans, m, n, a, lda, tau, c,
-                                                   ldc, scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zunmtr_usm",
+                                   "side uplo trans m n lda ldc scratchpad_size",
+                                   { stats::work::ormtr, stats::c64 } };
+    auto shape = verbose::make_dims(side, uplo, trans, m, n, lda, ldc, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zunmtr_usm_sycl)(queue, side, uplo, trans, m, n, a, lda, tau,
+                                                      c, ldc, scratchpad, scratchpad_size,
+                                                      dependencies);
+    });
 }
 void geqrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                  sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
                  sycl::buffer<float> &tau, std::int64_t stride_tau, std::int64_t batch_size,
                  sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].sgeqrf_batch_sycl(queue, m, n, a, lda, stride_a, tau, stride_tau,
-                                              batch_size, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "sgeqrf_batch",
+                                   "m n lda stride_a stride_tau batch_size scratchpad_size",
+                                   { stats::work::geqrf, stats::f32 } };
+    auto shape = verbose::make_dims(m, n, lda, stride_a, stride_tau, batch_size, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.sgeqrf_batch_sycl)(queue, m, n, a, lda, stride_a, tau, stride_tau,
+                                                 batch_size, scratchpad, scratchpad_size);
+    });
 }
 void geqrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                  sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
                  sycl::buffer<double> &tau, std::int64_t stride_tau, std::int64_t batch_size,
                  sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].dgeqrf_batch_sycl(queue, m, n, a, lda, stride_a, tau, stride_tau,
-                                              batch_size, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "dgeqrf_batch",
+                                   "m n lda stride_a stride_tau batch_size scratchpad_size",
+                                   { stats::work::geqrf, stats::f64 } };
+    auto shape = verbose::make_dims(m, n, lda, stride_a, stride_tau, batch_size, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dgeqrf_batch_sycl)(queue, m, n, a, lda, stride_a, tau, stride_tau,
+                                                 batch_size, scratchpad, scratchpad_size);
+    });
 }
 void geqrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                  sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
                  sycl::buffer<std::complex<float>> &tau, std::int64_t stride_tau,
                  std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
                  std::int64_t scratchpad_size) {
-    function_tables[libkey].cgeqrf_batch_sycl(queue, m, n, a, lda, stride_a, tau, stride_tau,
-                                              batch_size, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "cgeqrf_batch",
+                                   "m n lda stride_a stride_tau batch_size scratchpad_size",
+                                   { stats::work::geqrf, stats::c32 } };
+    auto shape = verbose::make_dims(m, n, lda, stride_a, stride_tau, batch_size, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cgeqrf_batch_sycl)(queue, m, n, a, lda, stride_a, tau, stride_tau,
+                                                 batch_size, scratchpad, scratchpad_size);
+    });
 }
 void geqrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                  sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
                  sycl::buffer<std::complex<double>> &tau, std::int64_t stride_tau,
                  std::int64_t batch_size, sycl::buffer<std::complex<double>> &scratchpad,
                  std::int64_t scratchpad_size) {
-    function_tables[libkey].zgeqrf_batch_sycl(queue, m, n, a, lda, stride_a, tau, stride_tau,
-                                              batch_size, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "zgeqrf_batch",
+                                   "m n lda stride_a stride_tau batch_size scratchpad_size",
+                                   { stats::work::geqrf, stats::c64 } };
+    auto shape = verbose::make_dims(m, n, lda, stride_a, stride_tau, batch_size, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zgeqrf_batch_sycl)(queue, m, n, a, lda, stride_a, tau, stride_tau,
+                                                 batch_size, scratchpad, scratchpad_size);
+    });
 }
 void getri_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
                  sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
                  std::int64_t batch_size, sycl::buffer<float> &scratchpad,
                  std::int64_t scratchpad_size) {
-    function_tables[libkey].sgetri_batch_sycl(queue, n, a, lda, stride_a, ipiv, stride_ipiv,
-                                              batch_size, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "sgetri_batch",
+                                   "n lda stride_a stride_ipiv batch_size scratchpad_size",
+                                   { stats::work::getri, stats::f32 } };
+    auto shape = verbose::make_dims(n, lda, stride_a, stride_ipiv, batch_size, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.sgetri_batch_sycl)(queue, n, a, lda, stride_a, ipiv, stride_ipiv,
+                                                 batch_size, scratchpad, scratchpad_size);
+    });
 }
 void getri_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
                  sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
                  std::int64_t batch_size, sycl::buffer<double> &scratchpad,
                  std::int64_t scratchpad_size) {
-    function_tables[libkey].dgetri_batch_sycl(queue, n, a, lda, stride_a, ipiv, stride_ipiv,
-                                              batch_size, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "dgetri_batch",
+                                   "n lda stride_a stride_ipiv batch_size scratchpad_size",
+                                   { stats::work::getri, stats::f64 } };
+    auto shape = verbose::make_dims(n, lda, stride_a, stride_ipiv, batch_size, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dgetri_batch_sycl)(queue, n, a, lda, stride_a, ipiv, stride_ipiv,
+                                                 batch_size, scratchpad, scratchpad_size);
+    });
 }
 void getri_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
                  sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
                  std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
                  std::int64_t scratchpad_size) {
-    function_tables[libkey].cgetri_batch_sycl(queue, n, a, lda, stride_a, ipiv, stride_ipiv,
-                                              batch_size, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "cgetri_batch",
+                                   "n lda stride_a stride_ipiv batch_size scratchpad_size",
+                                   { stats::work::getri, stats::c32 } };
+    auto shape = verbose::make_dims(n, lda, stride_a, stride_ipiv, batch_size, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cgetri_batch_sycl)(queue, n, a, lda, stride_a, ipiv, stride_ipiv,
+                                                 batch_size, scratchpad, scratchpad_size);
+    });
 }
 void getri_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
                  sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
                  std::int64_t batch_size, sycl::buffer<std::complex<double>> &scratchpad,
                  std::int64_t scratchpad_size) {
-    function_tables[libkey].zgetri_batch_sycl(queue, n, a, lda, stride_a, ipiv, stride_ipiv,
-                                              batch_size, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "zgetri_batch",
+                                   "n lda stride_a stride_ipiv batch_size scratchpad_size",
+                                   { stats::work::getri, stats::c64 } };
+    auto shape = verbose::make_dims(n, lda, stride_a, stride_ipiv, batch_size, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zgetri_batch_sycl)(queue, n, a, lda, stride_a, ipiv, stride_ipiv,
+                                                 batch_size, scratchpad, scratchpad_size);
+    });
 }
 void getrs_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
                  std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
@@ -1318,9 +3190,16 @@ void getrs_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::tr
                  sycl::buffer<float> &b, std::int64_t ldb, std::int64_t stride_b,
                  std::int64_t batch_size, sycl::buffer<float> &scratchpad,
                  std::int64_t scratchpad_size) {
-    function_tables[libkey].sgetrs_batch_sycl(queue, trans, n, nrhs, a, lda, stride_a, ipiv,
-                                              stride_ipiv, b, ldb, stride_b, batch_size, scratchpad,
-                                              scratchpad_size);
+    static stats::routine routine{ trace_site, "sgetrs_batch",
+        "trans n nrhs lda stride_a stride_ipiv ldb stride_b batch_size scratchpad_size",
+        { stats::work::getrs, stats::f32 } };
+    auto shape = verbose::make_dims(trans, n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b,
+                                    batch_size, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.sgetrs_batch_sycl)(queue, trans, n, nrhs, a, lda, stride_a, ipiv,
+                                                 stride_ipiv, b, ldb, stride_b, batch_size,
+                                                 scratchpad, scratchpad_size);
+    });
 }
 void getrs_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
                  std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
@@ -1328,9 +3207,16 @@ void getrs_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::tr
                  sycl::buffer<double> &b, std::int64_t ldb, std::int64_t stride_b,
                  std::int64_t batch_size, sycl::buffer<double> &scratchpad,
                  std::int64_t scratchpad_size) {
-    function_tables[libkey].dgetrs_batch_sycl(queue, trans, n, nrhs, a, lda, stride_a, ipiv,
-                                              stride_ipiv, b, ldb, stride_b, batch_size, scratchpad,
-                                              scratchpad_size);
+    static stats::routine routine{ trace_site, "dgetrs_batch",
+        "trans n nrhs lda stride_a stride_ipiv ldb stride_b batch_size scratchpad_size",
+        { stats::work::getrs, stats::f64 } };
+    auto shape = verbose::make_dims(trans, n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b,
+                                    batch_size, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dgetrs_batch_sycl)(queue, trans, n, nrhs, a, lda, stride_a, ipiv,
+                                                 stride_ipiv, b, ldb, stride_b, batch_size,
+                                                 scratchpad, scratchpad_size);
+    });
 }
 void getrs_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
                  std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<float>> &a,
@@ -1338,9 +3224,16 @@ void getrs_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::tr
                  std::int64_t stride_ipiv, sycl::buffer<std::complex<float>> &b, std::int64_t ldb,
                  std::int64_t stride_b, std::int64_t batch_size,
                  sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].cgetrs_batch_sycl(queue, trans, n, nrhs, a, lda, stride_a, ipiv,
-                                              stride_ipiv, b, ldb, stride_b, batch_size, scratchpad,
-                                              scratchpad_size);
+    static stats::routine routine{ trace_site, "cgetrs_batch",
+        "trans n nrhs lda stride_a stride_ipiv ldb stride_b batch_size scratchpad_size",
+        { stats::work::getrs, stats::c32 } };
+    auto shape = verbose::make_dims(trans, n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b,
+                                    batch_size, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cgetrs_batch_sycl)(queue, trans, n, nrhs, a, lda, stride_a, ipiv,
+                                                 stride_ipiv, b, ldb, stride_b, batch_size,
+                                                 scratchpad, scratchpad_size);
+    });
 }
 void getrs_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
                  std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
@@ -1348,149 +3241,520 @@ void getrs_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::tr
                  std::int64_t stride_ipiv, sycl::buffer<std::complex<double>> &b, std::int64_t ldb,
                  std::int64_t stride_b, std::int64_t batch_size,
                  sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].zgetrs_batch_sycl(queue, trans, n, nrhs, a, lda, stride_a, ipiv,
-                                              stride_ipiv, b, ldb, stride_b, batch_size, scratchpad,
-                                              scratchpad_size);
+    static stats::routine routine{ trace_site, "zgetrs_batch",
+        "trans n nrhs lda stride_a stride_ipiv ldb stride_b batch_size scratchpad_size",
+        { stats::work::getrs, stats::c64 } };
+    auto shape = verbose::make_dims(trans, n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b,
+                                    batch_size, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zgetrs_batch_sycl)(queue, trans, n, nrhs, a, lda, stride_a, ipiv,
+                                                 stride_ipiv, b, ldb, stride_b, batch_size,
+                                                 scratchpad, scratchpad_size);
+    });
+}
+void gesv_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv, sycl::buffer<float> &b,
+                std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "sgesv_batch",
+        "n nrhs lda stride_a stride_ipiv ldb stride_b batch_size scratchpad_size",
+        { stats::work::gesv, stats::f32 } };
+    auto shape = verbose::make_dims(n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.sgesv_batch_sycl)(queue, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv,
+                                                b, ldb, stride_b, batch_size, scratchpad,
+                                                scratchpad_size);
+    });
+}
+void gesv_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv, sycl::buffer<double> &b,
+                std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "dgesv_batch",
+        "n nrhs lda stride_a stride_ipiv ldb stride_b batch_size scratchpad_size",
+        { stats::work::gesv, stats::f64 } };
+    auto shape = verbose::make_dims(n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dgesv_batch_sycl)(queue, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv,
+                                                b, ldb, stride_b, batch_size, scratchpad,
+                                                scratchpad_size);
+    });
+}
+void gesv_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                sycl::buffer<std::complex<float>> &b, std::int64_t ldb, std::int64_t stride_b,
+                std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
+                std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "cgesv_batch",
+        "n nrhs lda stride_a stride_ipiv ldb stride_b batch_size scratchpad_size",
+        { stats::work::gesv, stats::c32 } };
+    auto shape = verbose::make_dims(n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cgesv_batch_sycl)(queue, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv,
+                                                b, ldb, stride_b, batch_size, scratchpad,
+                                                scratchpad_size);
+    });
+}
+void gesv_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
+                sycl::buffer<std::complex<double>> &b, std::int64_t ldb, std::int64_t stride_b,
+                std::int64_t batch_size, sycl::buffer<std::complex<double>> &scratchpad,
+                std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "zgesv_batch",
+        "n nrhs lda stride_a stride_ipiv ldb stride_b batch_size scratchpad_size",
+        { stats::work::gesv, stats::c64 } };
+    auto shape = verbose::make_dims(n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zgesv_batch_sycl)(queue, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv,
+                                                b, ldb, stride_b, batch_size, scratchpad,
+                                                scratchpad_size);
+    });
+}
+void gels_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
+                std::int64_t m, std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a,
+                std::int64_t lda, std::int64_t stride_a, sycl::buffer<float> &b, std::int64_t ldb,
+                std::int64_t stride_b, std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "sgels_batch",
+        "trans m n nrhs lda stride_a ldb stride_b batch_size scratchpad_size",
+        { stats::work::gels, stats::f32 } };
+    auto shape = verbose::make_dims(trans, m, n, nrhs, lda, stride_a, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.sgels_batch_sycl)(queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb,
+                                                stride_b, batch_size, scratchpad, scratchpad_size);
+    });
+}
+void gels_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
+                std::int64_t m, std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a,
+                std::int64_t lda, std::int64_t stride_a, sycl::buffer<double> &b, std::int64_t ldb,
+                std::int64_t stride_b, std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "dgels_batch",
+        "trans m n nrhs lda stride_a ldb stride_b batch_size scratchpad_size",
+        { stats::work::gels, stats::f64 } };
+    auto shape = verbose::make_dims(trans, m, n, nrhs, lda, stride_a, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dgels_batch_sycl)(queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb,
+                                                stride_b, batch_size, scratchpad, scratchpad_size);
+    });
+}
+void gels_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
+                std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<std::complex<float>> &b, std::int64_t ldb, std::int64_t stride_b,
+                std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
+                std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "cgels_batch",
+        "trans m n nrhs lda stride_a ldb stride_b batch_size scratchpad_size",
+        { stats::work::gels, stats::c32 } };
+    auto shape = verbose::make_dims(trans, m, n, nrhs, lda, stride_a, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cgels_batch_sycl)(queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb,
+                                                stride_b, batch_size, scratchpad, scratchpad_size);
+    });
+}
+void gels_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
+                std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<std::complex<double>> &b, std::int64_t ldb, std::int64_t stride_b,
+                std::int64_t batch_size, sycl::buffer<std::complex<double>> &scratchpad,
+                std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "zgels_batch",
+        "trans m n nrhs lda stride_a ldb stride_b batch_size scratchpad_size",
+        { stats::work::gels, stats::c64 } };
+    auto shape = verbose::make_dims(trans, m, n, nrhs, lda, stride_a, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zgels_batch_sycl)(queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb,
+                                                stride_b, batch_size, scratchpad, scratchpad_size);
+    });
+}
+void heevd_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                 oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<float>> &a,
+                 std::int64_t lda, std::int64_t stride_a, sycl::buffer<float> &w,
+                 std::int64_t stride_w, std::int64_t batch_size,
+                 sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "cheevd_batch",
+                                   "jobz uplo n lda stride_a stride_w batch_size scratchpad_size",
+                                   { stats::work::syevd, stats::c32 } };
+    auto shape = verbose::make_dims(jobz, uplo, n, lda, stride_a, stride_w, batch_size,
+                                    scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cheevd_batch_sycl)(queue, jobz, uplo, n, a, lda, stride_a, w,
+                                                 stride_w, batch_size, scratchpad, scratchpad_size);
+    });
+}
+void heevd_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                 oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<std::complex<double>> &a,
+                 std::int64_t lda, std::int64_t stride_a, sycl::buffer<double> &w,
+                 std::int64_t stride_w, std::int64_t batch_size,
+                 sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "zheevd_batch",
+                                   "jobz uplo n lda stride_a stride_w batch_size scratchpad_size",
+                                   { stats::work::syevd, stats::c64 } };
+    auto shape = verbose::make_dims(jobz, uplo, n, lda, stride_a, stride_w, batch_size,
+                                    scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zheevd_batch_sycl)(queue, jobz, uplo, n, a, lda, stride_a, w,
+                                                 stride_w, batch_size, scratchpad, scratchpad_size);
+    });
 }
 void getrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                  sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
                  sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
                  std::int64_t batch_size, sycl::buffer<float> &scratchpad,
                  std::int64_t scratchpad_size) {
-    function_tables[libkey].sgetrf_batch_sycl(queue, m, n, a, lda, stride_a, ipiv, stride_ipiv,
-                                              batch_size, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "sgetrf_batch",
+                                   "m n lda stride_a stride_ipiv batch_size scratchpad_size",
+                                   { stats::work::getrf, stats::f32 } };
+    auto shape = verbose::make_dims(m, n, lda, stride_a, stride_ipiv, batch_size, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.sgetrf_batch_sycl)(queue, m, n, a, lda, stride_a, ipiv, stride_ipiv,
+                                                 batch_size, scratchpad, scratchpad_size);
+    });
 }
 void getrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                  sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
                  sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
                  std::int64_t batch_size, sycl::buffer<double> &scratchpad,
                  std::int64_t scratchpad_size) {
-    function_tables[libkey].dgetrf_batch_sycl(queue, m, n, a, lda, stride_a, ipiv, stride_ipiv,
-                                              batch_size, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "dgetrf_batch",
+                                   "m n lda stride_a stride_ipiv batch_size scratchpad_size",
+                                   { stats::work::getrf, stats::f64 } };
+    auto shape = verbose::make_dims(m, n, lda, stride_a, stride_ipiv, batch_size, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dgetrf_batch_sycl)(queue, m, n, a, lda, stride_a, ipiv, stride_ipiv,
+                                                 batch_size, scratchpad, scratchpad_size);
+    });
 }
 void getrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                  sycl::buffer<std::complex<float>> &a, std::int64_t lda, std::int64_t stride_a,
                  sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
                  std::int64_t batch_size, sycl::buffer<std::complex<float>> &scratchpad,
                  std::int64_t scratchpad_size) {
-    function_tables[libkey].cgetrf_batch_sycl(queue, m, n, a, lda, stride_a, ipiv, stride_ipiv,
-                                              batch_size, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "cgetrf_batch",
+                                   "m n lda stride_a stride_ipiv batch_size scratchpad_size",
+                                   { stats::work::getrf, stats::c32 } };
+    auto shape = verbose::make_dims(m, n, lda, stride_a, stride_ipiv, batch_size, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cgetrf_batch_sycl)(queue, m, n, a, lda, stride_a, ipiv, stride_ipiv,
+                                                 batch_size, scratchpad, scratchpad_size);
+    });
 }
 void getrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                  sycl::buffer<std::complex<double>> &a, std::int64_t lda, std::int64_t stride_a,
                  sycl::buffer<std::int64_t> &ipiv, std::int64_t stride_ipiv,
                  std::int64_t batch_size, sycl::buffer<std::complex<double>> &scratchpad,
                  std::int64_t scratchpad_size) {
-    function_tables[libkey].zgetrf_batch_sycl(queue, m, n, a, lda, stride_a, ipiv, stride_ipiv,
-                                              batch_size, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "zgetrf_batch",
+                                   "m n lda stride_a stride_ipiv batch_size scratchpad_size",
+                                   { stats::work::getrf, stats::c64 } };
+    auto shape = verbose::make_dims(m, n, lda, stride_a, stride_ipiv, batch_size, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zgetrf_batch_sycl)(queue, m, n, a, lda, stride_a, ipiv, stride_ipiv,
+                                                 batch_size, scratchpad, scratchpad_size);
+    });
 }
 void orgqr_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                  std::int64_t k, sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
                  sycl::buffer<float> &tau, std::int64_t stride_tau, std::int64_t batch_size,
                  sycl::buffer<float> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].sorgqr_batch_sycl(queue, m, n, k, a, lda, stride_a, tau, stride_tau,
-                                              batch_size, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "sorgqr_batch",
+                                   "m n k lda stride_a stride_tau batch_size scratchpad_size",
+                                   { stats::work::orgqr, stats::f32 } };
+    auto shape = verbose::make_dims(m, n, k, lda, stride_a, stride_tau, batch_size,
+                                    scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.sorgqr_batch_sycl)(queue, m, n, k, a, lda, stride_a, tau, stride_tau,
+                                                 batch_size, scratchpad, scratchpad_size);
+    });
 }
 void orgqr_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                  std::int64_t k, sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
                  sycl::buffer<double> &tau, std::int64_t stride_tau, std::int64_t batch_size,
                  sycl::buffer<double> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].dorgqr_batch_sycl(queue, m, n, k, a, lda, stride_a, tau, stride_tau,
-                                              batch_size, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "dorgqr_batch",
+                                   "m n k lda stride_a stride_tau batch_size scratchpad_size",
+                                   { stats::work::orgqr, stats::f64 } };
+    auto shape = verbose::make_dims(m, n, k, lda, stride_a, stride_tau, batch_size,
+                                    scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dorgqr_batch_sycl)(queue, m, n, k, a, lda, stride_a, tau, stride_tau,
+                                                 batch_size, scratchpad, scratchpad_size);
+    });
 }
 void potrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                  std::int64_t n, sycl::buffer<float> &a, std::int64_t lda, std::int64_t stride_a,
                  std::int64_t batch_size, sycl::buffer<float> &scratchpad,
                  std::int64_t scratchpad_size) {
-    function_tables[libkey].spotrf_batch_sycl(queue, uplo, n, a, lda, stride_a, batch_size,
-                                              scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "spotrf_batch",
+                                   "uplo n lda stride_a batch_size scratchpad_size",
+                                   { stats::work::potrf, stats::f32 } };
+    auto shape = verbose::make_dims(uplo, n, lda, stride_a, batch_size, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.spotrf_batch_sycl)(queue, uplo, n, a, lda, stride_a, batch_size,
+                                                 scratchpad, scratchpad_size);
+    });
 }
 void potrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                  std::int64_t n, sycl::buffer<double> &a, std::int64_t lda, std::int64_t stride_a,
                  std::int64_t batch_size, sycl::buffer<double> &scratchpad,
                  std::int64_t scratchpad_size) {
-    function_tables[libkey].dpotrf_batch_sycl(queue, uplo, n, a, lda, stride_a, batch_size,
-                                              scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "dpotrf_batch",
+                                   "uplo n lda stride_a batch_size scratchpad_size",
+                                   { stats::work::potrf, stats::f64 } };
+    auto shape = verbose::make_dims(uplo, n, lda, stride_a, batch_size, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dpotrf_batch_sycl)(queue, uplo, n, a, lda, stride_a, batch_size,
+                                                 scratchpad, scratchpad_size);
+    });
 }
 void potrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                  std::int64_t n, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
                  std::int64_t stride_a, std::int64_t batch_size,
                  sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].cpotrf_batch_sycl(queue, uplo, n, a, lda, stride_a, batch_size,
-                                              scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "cpotrf_batch",
+                                   "uplo n lda stride_a batch_size scratchpad_size",
+                                   { stats::work::potrf, stats::c32 } };
+    auto shape = verbose::make_dims(uplo, n, lda, stride_a, batch_size, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cpotrf_batch_sycl)(queue, uplo, n, a, lda, stride_a, batch_size,
+                                                 scratchpad, scratchpad_size);
+    });
 }
 void potrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                  std::int64_t n, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
                  std::int64_t stride_a, std::int64_t batch_size,
                  sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].zpotrf_batch_sycl(queue, uplo, n, a, lda, stride_a, batch_size,
-                                              scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "zpotrf_batch",
+                                   "uplo n lda stride_a batch_size scratchpad_size",
+                                   { stats::work::potrf, stats::c64 } };
+    auto shape = verbose::make_dims(uplo, n, lda, stride_a, batch_size, scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zpotrf_batch_sycl)(queue, uplo, n, a, lda, stride_a, batch_size,
+                                                 scratchpad, scratchpad_size);
+    });
 }
 void potrs_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                  std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
                  std::int64_t stride_a, sycl::buffer<float> &b, std::int64_t ldb,
                  std::int64_t stride_b, std::int64_t batch_size, sycl::buffer<float> &scratchpad,
                  std::int64_t scratchpad_size) {
-    function_tables[libkey].spotrs_batch_sycl(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
-                                              stride_b, batch_size, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "spotrs_batch",
+        "uplo n nrhs lda stride_a ldb stride_b batch_size scratchpad_size",
+        { stats::work::getrs, stats::f32 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.spotrs_batch_sycl)(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                                                 stride_b, batch_size, scratchpad, scratchpad_size);
+    });
 }
 void potrs_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                  std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
                  std::int64_t stride_a, sycl::buffer<double> &b, std::int64_t ldb,
                  std::int64_t stride_b, std::int64_t batch_size, sycl::buffer<double> &scratchpad,
                  std::int64_t scratchpad_size) {
-    function_tables[libkey].dpotrs_batch_sycl(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
-                                              stride_b, batch_size, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "dpotrs_batch",
+        "uplo n nrhs lda stride_a ldb stride_b batch_size scratchpad_size",
+        { stats::work::getrs, stats::f64 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dpotrs_batch_sycl)(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                                                 stride_b, batch_size, scratchpad, scratchpad_size);
+    });
 }
 void potrs_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                  std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<float>> &a,
                  std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::complex<float>> &b,
                  std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
                  sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].cpotrs_batch_sycl(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
-                                              stride_b, batch_size, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "cpotrs_batch",
+        "uplo n nrhs lda stride_a ldb stride_b batch_size scratchpad_size",
+        { stats::work::getrs, stats::c32 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cpotrs_batch_sycl)(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                                                 stride_b, batch_size, scratchpad, scratchpad_size);
+    });
 }
 void potrs_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                  std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
                  std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::complex<double>> &b,
                  std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
                  sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].zpotrs_batch_sycl(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
-                                              stride_b, batch_size, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "zpotrs_batch",
+        "uplo n nrhs lda stride_a ldb stride_b batch_size scratchpad_size",
+        { stats::work::getrs, stats::c64 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zpotrs_batch_sycl)(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                                                 stride_b, batch_size, scratchpad, scratchpad_size);
+    });
+}
+void posv_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                std::int64_t n, std::int64_t nrhs, sycl::buffer<float> &a, std::int64_t lda,
+                std::int64_t stride_a, sycl::buffer<float> &b, std::int64_t ldb,
+                std::int64_t stride_b, std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "sposv_batch",
+        "uplo n nrhs lda stride_a ldb stride_b batch_size scratchpad_size",
+        { stats::work::posv, stats::f32 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.sposv_batch_sycl)(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                                                stride_b, batch_size, scratchpad, scratchpad_size);
+    });
+}
+void posv_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                std::int64_t n, std::int64_t nrhs, sycl::buffer<double> &a, std::int64_t lda,
+                std::int64_t stride_a, sycl::buffer<double> &b, std::int64_t ldb,
+                std::int64_t stride_b, std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "dposv_batch",
+        "uplo n nrhs lda stride_a ldb stride_b batch_size scratchpad_size",
+        { stats::work::posv, stats::f64 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dposv_batch_sycl)(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                                                stride_b, batch_size, scratchpad, scratchpad_size);
+    });
+}
+void posv_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<float>> &a,
+                std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::complex<float>> &b,
+                std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "cposv_batch",
+        "uplo n nrhs lda stride_a ldb stride_b batch_size scratchpad_size",
+        { stats::work::posv, stats::c32 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cposv_batch_sycl)(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                                                stride_b, batch_size, scratchpad, scratchpad_size);
+    });
+}
+void posv_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                std::int64_t n, std::int64_t nrhs, sycl::buffer<std::complex<double>> &a,
+                std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::complex<double>> &b,
+                std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "zposv_batch",
+        "uplo n nrhs lda stride_a ldb stride_b batch_size scratchpad_size",
+        { stats::work::posv, stats::c64 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zposv_batch_sycl)(queue, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                                                stride_b, batch_size, scratchpad, scratchpad_size);
+    });
+}
+void syevd_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                 oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<float> &a, std::int64_t lda,
+                 std::int64_t stride_a, sycl::buffer<float> &w, std::int64_t stride_w,
+                 std::int64_t batch_size, sycl::buffer<float> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "ssyevd_batch",
+                                   "jobz uplo n lda stride_a stride_w batch_size scratchpad_size",
+                                   { stats::work::syevd, stats::f32 } };
+    auto shape = verbose::make_dims(jobz, uplo, n, lda, stride_a, stride_w, batch_size,
+                                    scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.ssyevd_batch_sycl)(queue, jobz, uplo, n, a, lda, stride_a, w,
+                                                 stride_w, batch_size, scratchpad, scratchpad_size);
+    });
+}
+void syevd_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                 oneapi::mkl::uplo uplo, std::int64_t n, sycl::buffer<double> &a, std::int64_t lda,
+                 std::int64_t stride_a, sycl::buffer<double> &w, std::int64_t stride_w,
+                 std::int64_t batch_size, sycl::buffer<double> &scratchpad,
+                 std::int64_t scratchpad_size) {
+    static stats::routine routine{ trace_site, "dsyevd_batch",
+                                   "jobz uplo n lda stride_a stride_w batch_size scratchpad_size",
+                                   { stats::work::syevd, stats::f64 } };
+    auto shape = verbose::make_dims(jobz, uplo, n, lda, stride_a, stride_w, batch_size,
+                                    scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.dsyevd_batch_sycl)(queue, jobz, uplo, n, a, lda, stride_a, w,
+                                                 stride_w, batch_size, scratchpad, scratchpad_size);
+    });
 }
 void ungqr_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                  std::int64_t k, sycl::buffer<std::complex<float>> &a, std::int64_t lda,
                  std::int64_t stride_a, sycl::buffer<std::complex<float>> &tau,
                  std::int64_t stride_tau, std::int64_t batch_size,
                  sycl::buffer<std::complex<float>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].cungqr_batch_sycl(queue, m, n, k, a, lda, stride_a, tau, stride_tau,
-                                              batch_size, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "cungqr_batch",
+                                   "m n k lda stride_a stride_tau batch_size scratchpad_size",
+                                   { stats::work::orgqr, stats::c32 } };
+    auto shape = verbose::make_dims(m, n, k, lda, stride_a, stride_tau, batch_size,
+                                    scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.cungqr_batch_sycl)(queue, m, n, k, a, lda, stride_a, tau, stride_tau,
+                                                 batch_size, scratchpad, scratchpad_size);
+    });
 }
 void ungqr_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                  std::int64_t k, sycl::buffer<std::complex<double>> &a, std::int64_t lda,
                  std::int64_t stride_a, sycl::buffer<std::complex<double>> &tau,
                  std::int64_t stride_tau, std::int64_t batch_size,
                  sycl::buffer<std::complex<double>> &scratchpad, std::int64_t scratchpad_size) {
-    function_tables[libkey].zungqr_batch_sycl(queue, m, n, k, a, lda, stride_a, tau, stride_tau,
-                                              batch_size, scratchpad, scratchpad_size);
+    static stats::routine routine{ trace_site, "zungqr_batch",
+                                   "m n k lda stride_a stride_tau batch_size scratchpad_size",
+                                   { stats::work::orgqr, stats::c64 } };
+    auto shape = verbose::make_dims(m, n, k, lda, stride_a, stride_tau, batch_size,
+                                    scratchpad_size);
+    function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        routine.require(table.zungqr_batch_sycl)(queue, m, n, k, a, lda, stride_a, tau, stride_tau,
+                                                 batch_size, scratchpad, scratchpad_size);
+    });
 }
 sycl::event geqrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
                         std::int64_t n, float *a, std::int64_t lda, std::int64_t stride_a,
                         float *tau, std::int64_t stride_tau, std::int64_t batch_size,
                         float *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].sgeqrf_batch_usm_sycl(queue, m, n, a, lda, stride_a, tau,
-                                                         stride_tau, batch_size, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "sgeqrf_batch_usm",
+                                   "m n lda stride_a stride_tau batch_size scratchpad_size",
+                                   { stats::work::geqrf, stats::f32 } };
+    auto shape = verbose::make_dims(m, n, lda, stride_a, stride_tau, batch_size, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sgeqrf_batch_usm_sycl)(queue, m, n, a, lda, stride_a, tau,
+                                                            stride_tau, batch_size, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event geqrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
                         std::int64_t n, double *a, std::int64_t lda, std::int64_t stride_a,
                         double *tau, std::int64_t stride_tau, std::int64_t batch_size,
                         double *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dgeqrf_batch_usm_sycl(queue, m, n, a, lda, stride_a, tau,
-                                                         stride_tau, batch_size, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dgeqrf_batch_usm",
+                                   "m n lda stride_a stride_tau batch_size scratchpad_size",
+                                   { stats::work::geqrf, stats::f64 } };
+    auto shape = verbose::make_dims(m, n, lda, stride_a, stride_tau, batch_size, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dgeqrf_batch_usm_sycl)(queue, m, n, a, lda, stride_a, tau,
+                                                            stride_tau, batch_size, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event geqrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
                         std::int64_t n, std::complex<float> *a, std::int64_t lda,
@@ -1498,9 +3762,15 @@ sycl::event geqrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int
                         std::int64_t batch_size, std::complex<float> *scratchpad,
                         std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cgeqrf_batch_usm_sycl(queue, m, n, a, lda, stride_a, tau,
-                                                         stride_tau, batch_size, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "cgeqrf_batch_usm",
+                                   "m n lda stride_a stride_tau batch_size scratchpad_size",
+                                   { stats::work::geqrf, stats::c32 } };
+    auto shape = verbose::make_dims(m, n, lda, stride_a, stride_tau, batch_size, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cgeqrf_batch_usm_sycl)(queue, m, n, a, lda, stride_a, tau,
+                                                            stride_tau, batch_size, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event geqrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
                         std::int64_t n, std::complex<double> *a, std::int64_t lda,
@@ -1508,27 +3778,45 @@ sycl::event geqrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int
                         std::int64_t batch_size, std::complex<double> *scratchpad,
                         std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zgeqrf_batch_usm_sycl(queue, m, n, a, lda, stride_a, tau,
-                                                         stride_tau, batch_size, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zgeqrf_batch_usm",
+                                   "m n lda stride_a stride_tau batch_size scratchpad_size",
+                                   { stats::work::geqrf, stats::c64 } };
+    auto shape = verbose::make_dims(m, n, lda, stride_a, stride_tau, batch_size, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zgeqrf_batch_usm_sycl)(queue, m, n, a, lda, stride_a, tau,
+                                                            stride_tau, batch_size, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event getrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
                         std::int64_t n, float *a, std::int64_t lda, std::int64_t stride_a,
                         std::int64_t *ipiv, std::int64_t stride_ipiv, std::int64_t batch_size,
                         float *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].sgetrf_batch_usm_sycl(queue, m, n, a, lda, stride_a, ipiv,
-                                                         stride_ipiv, batch_size, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "sgetrf_batch_usm",
+                                   "m n lda stride_a stride_ipiv batch_size scratchpad_size",
+                                   { stats::work::getrf, stats::f32 } };
+    auto shape = verbose::make_dims(m, n, lda, stride_a, stride_ipiv, batch_size, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sgetrf_batch_usm_sycl)(queue, m, n, a, lda, stride_a, ipiv,
+                                                            stride_ipiv, batch_size, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event getrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
                         std::int64_t n, double *a, std::int64_t lda, std::int64_t stride_a,
                         std::int64_t *ipiv, std::int64_t stride_ipiv, std::int64_t batch_size,
                         double *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dgetrf_batch_usm_sycl(queue, m, n, a, lda, stride_a, ipiv,
-                                                         stride_ipiv, batch_size, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dgetrf_batch_usm",
+                                   "m n lda stride_a stride_ipiv batch_size scratchpad_size",
+                                   { stats::work::getrf, stats::f64 } };
+    auto shape = verbose::make_dims(m, n, lda, stride_a, stride_ipiv, batch_size, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dgetrf_batch_usm_sycl)(queue, m, n, a, lda, stride_a, ipiv,
+                                                            stride_ipiv, batch_size, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event getrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
                         std::int64_t n, std::complex<float> *a, std::int64_t lda,
@@ -1536,9 +3824,15 @@ sycl::event getrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int
                         std::int64_t batch_size, std::complex<float> *scratchpad,
                         std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cgetrf_batch_usm_sycl(queue, m, n, a, lda, stride_a, ipiv,
-                                                         stride_ipiv, batch_size, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "cgetrf_batch_usm",
+                                   "m n lda stride_a stride_ipiv batch_size scratchpad_size",
+                                   { stats::work::getrf, stats::c32 } };
+    auto shape = verbose::make_dims(m, n, lda, stride_a, stride_ipiv, batch_size, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cgetrf_batch_usm_sycl)(queue, m, n, a, lda, stride_a, ipiv,
+                                                            stride_ipiv, batch_size, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event getrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
                         std::int64_t n, std::complex<double> *a, std::int64_t lda,
@@ -1546,45 +3840,75 @@ sycl::event getrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int
                         std::int64_t batch_size, std::complex<double> *scratchpad,
                         std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zgetrf_batch_usm_sycl(queue, m, n, a, lda, stride_a, ipiv,
-                                                         stride_ipiv, batch_size, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zgetrf_batch_usm",
+                                   "m n lda stride_a stride_ipiv batch_size scratchpad_size",
+                                   { stats::work::getrf, stats::c64 } };
+    auto shape = verbose::make_dims(m, n, lda, stride_a, stride_ipiv, batch_size, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zgetrf_batch_usm_sycl)(queue, m, n, a, lda, stride_a, ipiv,
+                                                            stride_ipiv, batch_size, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event getri_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float *a,
                         std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
                         std::int64_t stride_ipiv, std::int64_t batch_size, float *scratchpad,
                         std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].sgetri_batch_usm_sycl(queue, n, a, lda, stride_a, ipiv,
-                                                         stride_ipiv, batch_size, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "sgetri_batch_usm",
+                                   "n lda stride_a stride_ipiv batch_size scratchpad_size",
+                                   { stats::work::getri, stats::f32 } };
+    auto shape = verbose::make_dims(n, lda, stride_a, stride_ipiv, batch_size, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sgetri_batch_usm_sycl)(queue, n, a, lda, stride_a, ipiv,
+                                                            stride_ipiv, batch_size, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event getri_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double *a,
                         std::int64_t lda, std::int64_t stride_a, std::int64_t *ipiv,
                         std::int64_t stride_ipiv, std::int64_t batch_size, double *scratchpad,
                         std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dgetri_batch_usm_sycl(queue, n, a, lda, stride_a, ipiv,
-                                                         stride_ipiv, batch_size, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dgetri_batch_usm",
+                                   "n lda stride_a stride_ipiv batch_size scratchpad_size",
+                                   { stats::work::getri, stats::f64 } };
+    auto shape = verbose::make_dims(n, lda, stride_a, stride_ipiv, batch_size, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dgetri_batch_usm_sycl)(queue, n, a, lda, stride_a, ipiv,
+                                                            stride_ipiv, batch_size, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event getri_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                         std::complex<float> *a, std::int64_t lda, std::int64_t stride_a,
                         std::int64_t *ipiv, std::int64_t stride_ipiv, std::int64_t batch_size,
                         std::complex<float> *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cgetri_batch_usm_sycl(queue, n, a, lda, stride_a, ipiv,
-                                                         stride_ipiv, batch_size, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "cgetri_batch_usm",
+                                   "n lda stride_a stride_ipiv batch_size scratchpad_size",
+                                   { stats::work::getri, stats::c32 } };
+    auto shape = verbose::make_dims(n, lda, stride_a, stride_ipiv, batch_size, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cgetri_batch_usm_sycl)(queue, n, a, lda, stride_a, ipiv,
+                                                            stride_ipiv, batch_size, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event getri_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                         std::complex<double> *a, std::int64_t lda, std::int64_t stride_a,
                         std::int64_t *ipiv, std::int64_t stride_ipiv, std::int64_t batch_size,
                         std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zgetri_batch_usm_sycl(queue, n, a, lda, stride_a, ipiv,
-                                                         stride_ipiv, batch_size, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zgetri_batch_usm",
+                                   "n lda stride_a stride_ipiv batch_size scratchpad_size",
+                                   { stats::work::getri, stats::c64 } };
+    auto shape = verbose::make_dims(n, lda, stride_a, stride_ipiv, batch_size, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zgetri_batch_usm_sycl)(queue, n, a, lda, stride_a, ipiv,
+                                                            stride_ipiv, batch_size, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event getrs_batch(oneapi::mkl::device libkey, sycl::queue &queue,
                         oneapi::mkl::transpose trans, std::int64_t n, std::int64_t nrhs, float *a,
@@ -1592,9 +3916,16 @@ sycl::event getrs_batch(oneapi::mkl::device libkey, sycl::queue &queue,
                         std::int64_t stride_ipiv, float *b, std::int64_t ldb, std::int64_t stride_b,
                         std::int64_t batch_size, float *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].sgetrs_batch_usm_sycl(
-        queue, trans, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b, ldb, stride_b, batch_size,
-        scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "sgetrs_batch_usm",
+        "trans n nrhs lda stride_a stride_ipiv ldb stride_b batch_size scratchpad_size",
+        { stats::work::getrs, stats::f32 } };
+    auto shape = verbose::make_dims(trans, n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b,
+                                    batch_size, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sgetrs_batch_usm_sycl)(
+            queue, trans, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b, ldb, stride_b,
+            batch_size, scratchpad, scratchpad_size, dependencies);
+    });
 }
 sycl::event getrs_batch(oneapi::mkl::device libkey, sycl::queue &queue,
                         oneapi::mkl::transpose trans, std::int64_t n, std::int64_t nrhs, double *a,
@@ -1603,9 +3934,16 @@ sycl::event getrs_batch(oneapi::mkl::device libkey, sycl::queue &queue,
                         std::int64_t stride_b, std::int64_t batch_size, double *scratchpad,
                         std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dgetrs_batch_usm_sycl(
-        queue, trans, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b, ldb, stride_b, batch_size,
-        scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dgetrs_batch_usm",
+        "trans n nrhs lda stride_a stride_ipiv ldb stride_b batch_size scratchpad_size",
+        { stats::work::getrs, stats::f64 } };
+    auto shape = verbose::make_dims(trans, n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b,
+                                    batch_size, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dgetrs_batch_usm_sycl)(
+            queue, trans, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b, ldb, stride_b,
+            batch_size, scratchpad, scratchpad_size, dependencies);
+    });
 }
 sycl::event getrs_batch(oneapi::mkl::device libkey, sycl::queue &queue,
                         oneapi::mkl::transpose trans, std::int64_t n, std::int64_t nrhs,
@@ -1614,9 +3952,16 @@ sycl::event getrs_batch(oneapi::mkl::device libkey, sycl::queue &queue,
                         std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
                         std::complex<float> *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cgetrs_batch_usm_sycl(
-        queue, trans, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b, ldb, stride_b, batch_size,
-        scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "cgetrs_batch_usm",
+        "trans n nrhs lda stride_a stride_ipiv ldb stride_b batch_size scratchpad_size",
+        { stats::work::getrs, stats::c32 } };
+    auto shape = verbose::make_dims(trans, n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b,
+                                    batch_size, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cgetrs_batch_usm_sycl)(
+            queue, trans, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b, ldb, stride_b,
+            batch_size, scratchpad, scratchpad_size, dependencies);
+    });
 }
 sycl::event getrs_batch(oneapi::mkl::device libkey, sycl::queue &queue,
                         oneapi::mkl::transpose trans, std::int64_t n, std::int64_t nrhs,
@@ -1625,75 +3970,310 @@ sycl::event getrs_batch(oneapi::mkl::device libkey, sycl::queue &queue,
                         std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
                         std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zgetrs_batch_usm_sycl(
-        queue, trans, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b, ldb, stride_b, batch_size,
-        scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zgetrs_batch_usm",
+        "trans n nrhs lda stride_a stride_ipiv ldb stride_b batch_size scratchpad_size",
+        { stats::work::getrs, stats::c64 } };
+    auto shape = verbose::make_dims(trans, n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b,
+                                    batch_size, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zgetrs_batch_usm_sycl)(
+            queue, trans, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b, ldb, stride_b,
+            batch_size, scratchpad, scratchpad_size, dependencies);
+    });
+}
+sycl::event gesv_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                       std::int64_t nrhs, float *a, std::int64_t lda, std::int64_t stride_a,
+                       std::int64_t *ipiv, std::int64_t stride_ipiv, float *b, std::int64_t ldb,
+                       std::int64_t stride_b, std::int64_t batch_size, float *scratchpad,
+                       std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "sgesv_batch_usm",
+        "n nrhs lda stride_a stride_ipiv ldb stride_b batch_size scratchpad_size",
+        { stats::work::gesv, stats::f32 } };
+    auto shape = verbose::make_dims(n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sgesv_batch_usm_sycl)(
+            queue, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b, ldb, stride_b, batch_size,
+            scratchpad, scratchpad_size, dependencies);
+    });
+}
+sycl::event gesv_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                       std::int64_t nrhs, double *a, std::int64_t lda, std::int64_t stride_a,
+                       std::int64_t *ipiv, std::int64_t stride_ipiv, double *b, std::int64_t ldb,
+                       std::int64_t stride_b, std::int64_t batch_size, double *scratchpad,
+                       std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "dgesv_batch_usm",
+        "n nrhs lda stride_a stride_ipiv ldb stride_b batch_size scratchpad_size",
+        { stats::work::gesv, stats::f64 } };
+    auto shape = verbose::make_dims(n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dgesv_batch_usm_sycl)(
+            queue, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b, ldb, stride_b, batch_size,
+            scratchpad, scratchpad_size, dependencies);
+    });
+}
+sycl::event gesv_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                       std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                       std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv,
+                       std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
+                       std::int64_t batch_size, std::complex<float> *scratchpad,
+                       std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "cgesv_batch_usm",
+        "n nrhs lda stride_a stride_ipiv ldb stride_b batch_size scratchpad_size",
+        { stats::work::gesv, stats::c32 } };
+    auto shape = verbose::make_dims(n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cgesv_batch_usm_sycl)(
+            queue, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b, ldb, stride_b, batch_size,
+            scratchpad, scratchpad_size, dependencies);
+    });
+}
+sycl::event gesv_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
+                       std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                       std::int64_t stride_a, std::int64_t *ipiv, std::int64_t stride_ipiv,
+                       std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
+                       std::int64_t batch_size, std::complex<double> *scratchpad,
+                       std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "zgesv_batch_usm",
+        "n nrhs lda stride_a stride_ipiv ldb stride_b batch_size scratchpad_size",
+        { stats::work::gesv, stats::c64 } };
+    auto shape = verbose::make_dims(n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zgesv_batch_usm_sycl)(
+            queue, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b, ldb, stride_b, batch_size,
+            scratchpad, scratchpad_size, dependencies);
+    });
+}
+sycl::event gels_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
+                       std::int64_t m, std::int64_t n, std::int64_t nrhs, float *a,
+                       std::int64_t lda, std::int64_t stride_a, float *b, std::int64_t ldb,
+                       std::int64_t stride_b, std::int64_t batch_size, float *scratchpad,
+                       std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "sgels_batch_usm",
+        "trans m n nrhs lda stride_a ldb stride_b batch_size scratchpad_size",
+        { stats::work::gels, stats::f32 } };
+    auto shape = verbose::make_dims(trans, m, n, nrhs, lda, stride_a, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sgels_batch_usm_sycl)(
+            queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb, stride_b, batch_size, scratchpad,
+            scratchpad_size, dependencies);
+    });
+}
+sycl::event gels_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
+                       std::int64_t m, std::int64_t n, std::int64_t nrhs, double *a,
+                       std::int64_t lda, std::int64_t stride_a, double *b, std::int64_t ldb,
+                       std::int64_t stride_b, std::int64_t batch_size, double *scratchpad,
+                       std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "dgels_batch_usm",
+        "trans m n nrhs lda stride_a ldb stride_b batch_size scratchpad_size",
+        { stats::work::gels, stats::f64 } };
+    auto shape = verbose::make_dims(trans, m, n, nrhs, lda, stride_a, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dgels_batch_usm_sycl)(
+            queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb, stride_b, batch_size, scratchpad,
+            scratchpad_size, dependencies);
+    });
+}
+sycl::event gels_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
+                       std::int64_t m, std::int64_t n, std::int64_t nrhs, std::complex<float> *a,
+                       std::int64_t lda, std::int64_t stride_a, std::complex<float> *b,
+                       std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                       std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "cgels_batch_usm",
+        "trans m n nrhs lda stride_a ldb stride_b batch_size scratchpad_size",
+        { stats::work::gels, stats::c32 } };
+    auto shape = verbose::make_dims(trans, m, n, nrhs, lda, stride_a, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cgels_batch_usm_sycl)(
+            queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb, stride_b, batch_size, scratchpad,
+            scratchpad_size, dependencies);
+    });
+}
+sycl::event gels_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans,
+                       std::int64_t m, std::int64_t n, std::int64_t nrhs, std::complex<double> *a,
+                       std::int64_t lda, std::int64_t stride_a, std::complex<double> *b,
+                       std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                       std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "zgels_batch_usm",
+        "trans m n nrhs lda stride_a ldb stride_b batch_size scratchpad_size",
+        { stats::work::gels, stats::c64 } };
+    auto shape = verbose::make_dims(trans, m, n, nrhs, lda, stride_a, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zgels_batch_usm_sycl)(
+            queue, trans, m, n, nrhs, a, lda, stride_a, b, ldb, stride_b, batch_size, scratchpad,
+            scratchpad_size, dependencies);
+    });
+}
+sycl::event heevd_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                        oneapi::mkl::uplo uplo, std::int64_t n, std::complex<float> *a,
+                        std::int64_t lda, std::int64_t stride_a, float *w, std::int64_t stride_w,
+                        std::int64_t batch_size, std::complex<float> *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "cheevd_batch_usm",
+                                   "jobz uplo n lda stride_a stride_w batch_size scratchpad_size",
+                                   { stats::work::syevd, stats::c32 } };
+    auto shape = verbose::make_dims(jobz, uplo, n, lda, stride_a, stride_w, batch_size,
+                                    scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cheevd_batch_usm_sycl)(queue, jobz, uplo, n, a, lda, stride_a,
+                                                            w, stride_w, batch_size, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
+}
+sycl::event heevd_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                        oneapi::mkl::uplo uplo, std::int64_t n, std::complex<double> *a,
+                        std::int64_t lda, std::int64_t stride_a, double *w, std::int64_t stride_w,
+                        std::int64_t batch_size, std::complex<double> *scratchpad,
+                        std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "zheevd_batch_usm",
+                                   "jobz uplo n lda stride_a stride_w batch_size scratchpad_size",
+                                   { stats::work::syevd, stats::c64 } };
+    auto shape = verbose::make_dims(jobz, uplo, n, lda, stride_a, stride_w, batch_size,
+                                    scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zheevd_batch_usm_sycl)(queue, jobz, uplo, n, a, lda, stride_a,
+                                                            w, stride_w, batch_size, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event orgqr_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
                         std::int64_t n, std::int64_t k, float *a, std::int64_t lda,
                         std::int64_t stride_a, float *tau, std::int64_t stride_tau,
                         std::int64_t batch_size, float *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].sorgqr_batch_usm_sycl(queue, m, n, k, a, lda, stride_a, tau,
-                                                         stride_tau, batch_size, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "sorgqr_batch_usm",
+                                   "m n k lda stride_a stride_tau batch_size scratchpad_size",
+                                   { stats::work::orgqr, stats::f32 } };
+    auto shape = verbose::make_dims(m, n, k, lda, stride_a, stride_tau, batch_size,
+                                    scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sorgqr_batch_usm_sycl)(queue, m, n, k, a, lda, stride_a, tau,
+                                                            stride_tau, batch_size, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event orgqr_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
                         std::int64_t n, std::int64_t k, double *a, std::int64_t lda,
                         std::int64_t stride_a, double *tau, std::int64_t stride_tau,
                         std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dorgqr_batch_usm_sycl(queue, m, n, k, a, lda, stride_a, tau,
-                                                         stride_tau, batch_size, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dorgqr_batch_usm",
+                                   "m n k lda stride_a stride_tau batch_size scratchpad_size",
+                                   { stats::work::orgqr, stats::f64 } };
+    auto shape = verbose::make_dims(m, n, k, lda, stride_a, stride_tau, batch_size,
+                                    scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dorgqr_batch_usm_sycl)(queue, m, n, k, a, lda, stride_a, tau,
+                                                            stride_tau, batch_size, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event potrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                         std::int64_t n, float *a, std::int64_t lda, std::int64_t stride_a,
                         std::int64_t batch_size, float *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].spotrf_batch_usm_sycl(
-        queue, uplo, n, a, lda, stride_a, batch_size, scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "spotrf_batch_usm",
+                                   "uplo n lda stride_a batch_size scratchpad_size",
+                                   { stats::work::potrf, stats::f32 } };
+    auto shape = verbose::make_dims(uplo, n, lda, stride_a, batch_size, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.spotrf_batch_usm_sycl)(queue, uplo, n, a, lda, stride_a,
+                                                            batch_size, scratchpad, scratchpad_size,
+                                                            dependencies);
+    });
 }
 sycl::event potrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                         std::int64_t n, double *a, std::int64_t lda, std::int64_t stride_a,
                         std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dpotrf_batch_usm_sycl(
-        queue, uplo, n, a, lda, stride_a, batch_size, scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dpotrf_batch_usm",
+                                   "uplo n lda stride_a batch_size scratchpad_size",
+                                   { stats::work::potrf, stats::f64 } };
+    auto shape = verbose::make_dims(uplo, n, lda, stride_a, batch_size, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dpotrf_batch_usm_sycl)(queue, uplo, n, a, lda, stride_a,
+                                                            batch_size, scratchpad, scratchpad_size,
+                                                            dependencies);
+    });
 }
 sycl::event potrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                         std::int64_t n, std::complex<float> *a, std::int64_t lda,
                         std::int64_t stride_a, std::int64_t batch_size,
                         std::complex<float> *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cpotrf_batch_usm_sycl(
-        queue, uplo, n, a, lda, stride_a, batch_size, scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "cpotrf_batch_usm",
+                                   "uplo n lda stride_a batch_size scratchpad_size",
+                                   { stats::work::potrf, stats::c32 } };
+    auto shape = verbose::make_dims(uplo, n, lda, stride_a, batch_size, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cpotrf_batch_usm_sycl)(queue, uplo, n, a, lda, stride_a,
+                                                            batch_size, scratchpad, scratchpad_size,
+                                                            dependencies);
+    });
 }
 sycl::event potrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                         std::int64_t n, std::complex<double> *a, std::int64_t lda,
                         std::int64_t stride_a, std::int64_t batch_size,
                         std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zpotrf_batch_usm_sycl(
-        queue, uplo, n, a, lda, stride_a, batch_size, scratchpad, scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zpotrf_batch_usm",
+                                   "uplo n lda stride_a batch_size scratchpad_size",
+                                   { stats::work::potrf, stats::c64 } };
+    auto shape = verbose::make_dims(uplo, n, lda, stride_a, batch_size, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zpotrf_batch_usm_sycl)(queue, uplo, n, a, lda, stride_a,
+                                                            batch_size, scratchpad, scratchpad_size,
+                                                            dependencies);
+    });
 }
 sycl::event potrs_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                         std::int64_t n, std::int64_t nrhs, float *a, std::int64_t lda,
                         std::int64_t stride_a, float *b, std::int64_t ldb, std::int64_t stride_b,
                         std::int64_t batch_size, float *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].spotrs_batch_usm_sycl(queue, uplo, n, nrhs, a, lda, stride_a, b,
-                                                         ldb, stride_b, batch_size, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "spotrs_batch_usm",
+        "uplo n nrhs lda stride_a ldb stride_b batch_size scratchpad_size",
+        { stats::work::getrs, stats::f32 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.spotrs_batch_usm_sycl)(
+            queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b, batch_size, scratchpad,
+            scratchpad_size, dependencies);
+    });
 }
 sycl::event potrs_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                         std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda,
                         std::int64_t stride_a, double *b, std::int64_t ldb, std::int64_t stride_b,
                         std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dpotrs_batch_usm_sycl(queue, uplo, n, nrhs, a, lda, stride_a, b,
-                                                         ldb, stride_b, batch_size, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dpotrs_batch_usm",
+        "uplo n nrhs lda stride_a ldb stride_b batch_size scratchpad_size",
+        { stats::work::getrs, stats::f64 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dpotrs_batch_usm_sycl)(
+            queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b, batch_size, scratchpad,
+            scratchpad_size, dependencies);
+    });
 }
 sycl::event potrs_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                         std::int64_t n, std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
@@ -1701,9 +4281,16 @@ sycl::event potrs_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::
                         std::int64_t stride_b, std::int64_t batch_size,
                         std::complex<float> *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cpotrs_batch_usm_sycl(queue, uplo, n, nrhs, a, lda, stride_a, b,
-                                                         ldb, stride_b, batch_size, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "cpotrs_batch_usm",
+        "uplo n nrhs lda stride_a ldb stride_b batch_size scratchpad_size",
+        { stats::work::getrs, stats::c32 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cpotrs_batch_usm_sycl)(
+            queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b, batch_size, scratchpad,
+            scratchpad_size, dependencies);
+    });
 }
 sycl::event potrs_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
                         std::int64_t n, std::int64_t nrhs, std::complex<double> *a,
@@ -1711,9 +4298,114 @@ sycl::event potrs_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::
                         std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
                         std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zpotrs_batch_usm_sycl(queue, uplo, n, nrhs, a, lda, stride_a, b,
-                                                         ldb, stride_b, batch_size, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zpotrs_batch_usm",
+        "uplo n nrhs lda stride_a ldb stride_b batch_size scratchpad_size",
+        { stats::work::getrs, stats::c64 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zpotrs_batch_usm_sycl)(
+            queue, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b, batch_size, scratchpad,
+            scratchpad_size, dependencies);
+    });
+}
+sycl::event posv_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                       std::int64_t n, std::int64_t nrhs, float *a, std::int64_t lda,
+                       std::int64_t stride_a, float *b, std::int64_t ldb, std::int64_t stride_b,
+                       std::int64_t batch_size, float *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "sposv_batch_usm",
+        "uplo n nrhs lda stride_a ldb stride_b batch_size scratchpad_size",
+        { stats::work::posv, stats::f32 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sposv_batch_usm_sycl)(queue, uplo, n, nrhs, a, lda, stride_a,
+                                                           b, ldb, stride_b, batch_size, scratchpad,
+                                                           scratchpad_size, dependencies);
+    });
+}
+sycl::event posv_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                       std::int64_t n, std::int64_t nrhs, double *a, std::int64_t lda,
+                       std::int64_t stride_a, double *b, std::int64_t ldb, std::int64_t stride_b,
+                       std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "dposv_batch_usm",
+        "uplo n nrhs lda stride_a ldb stride_b batch_size scratchpad_size",
+        { stats::work::posv, stats::f64 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dposv_batch_usm_sycl)(queue, uplo, n, nrhs, a, lda, stride_a,
+                                                           b, ldb, stride_b, batch_size, scratchpad,
+                                                           scratchpad_size, dependencies);
+    });
+}
+sycl::event posv_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                       std::int64_t n, std::int64_t nrhs, std::complex<float> *a, std::int64_t lda,
+                       std::int64_t stride_a, std::complex<float> *b, std::int64_t ldb,
+                       std::int64_t stride_b, std::int64_t batch_size,
+                       std::complex<float> *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "cposv_batch_usm",
+        "uplo n nrhs lda stride_a ldb stride_b batch_size scratchpad_size",
+        { stats::work::posv, stats::c32 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cposv_batch_usm_sycl)(queue, uplo, n, nrhs, a, lda, stride_a,
+                                                           b, ldb, stride_b, batch_size, scratchpad,
+                                                           scratchpad_size, dependencies);
+    });
+}
+sycl::event posv_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
+                       std::int64_t n, std::int64_t nrhs, std::complex<double> *a, std::int64_t lda,
+                       std::int64_t stride_a, std::complex<double> *b, std::int64_t ldb,
+                       std::int64_t stride_b, std::int64_t batch_size,
+                       std::complex<double> *scratchpad, std::int64_t scratchpad_size,
+                       const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "zposv_batch_usm",
+        "uplo n nrhs lda stride_a ldb stride_b batch_size scratchpad_size",
+        { stats::work::posv, stats::c64 } };
+    auto shape = verbose::make_dims(uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size,
+                                    scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zposv_batch_usm_sycl)(queue, uplo, n, nrhs, a, lda, stride_a,
+                                                           b, ldb, stride_b, batch_size, scratchpad,
+                                                           scratchpad_size, dependencies);
+    });
+}
+sycl::event syevd_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                        oneapi::mkl::uplo uplo, std::int64_t n, float *a, std::int64_t lda,
+                        std::int64_t stride_a, float *w, std::int64_t stride_w,
+                        std::int64_t batch_size, float *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "ssyevd_batch_usm",
+                                   "jobz uplo n lda stride_a stride_w batch_size scratchpad_size",
+                                   { stats::work::syevd, stats::f32 } };
+    auto shape = verbose::make_dims(jobz, uplo, n, lda, stride_a, stride_w, batch_size,
+                                    scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.ssyevd_batch_usm_sycl)(queue, jobz, uplo, n, a, lda, stride_a,
+                                                            w, stride_w, batch_size, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
+}
+sycl::event syevd_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz,
+                        oneapi::mkl::uplo uplo, std::int64_t n, double *a, std::int64_t lda,
+                        std::int64_t stride_a, double *w, std::int64_t stride_w,
+                        std::int64_t batch_size, double *scratchpad, std::int64_t scratchpad_size,
+                        const sycl::vector_class<sycl::event> &dependencies) {
+    static stats::routine routine{ trace_site, "dsyevd_batch_usm",
+                                   "jobz uplo n lda stride_a stride_w batch_size scratchpad_size",
+                                   { stats::work::syevd, stats::f64 } };
+    auto shape = verbose::make_dims(jobz, uplo, n, lda, stride_a, stride_w, batch_size,
+                                    scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dsyevd_batch_usm_sycl)(queue, jobz, uplo, n, a, lda, stride_a,
+                                                            w, stride_w, batch_size, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event ungqr_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
                         std::int64_t n, std::int64_t k, std::complex<float> *a, std::int64_t lda,
@@ -1721,9 +4413,16 @@ sycl::event ungqr_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int
                         std::int64_t batch_size, std::complex<float> *scratchpad,
                         std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cungqr_batch_usm_sycl(queue, m, n, k, a, lda, stride_a, tau,
-                                                         stride_tau, batch_size, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "cungqr_batch_usm",
+                                   "m n k lda stride_a stride_tau batch_size scratchpad_size",
+                                   { stats::work::orgqr, stats::c32 } };
+    auto shape = verbose::make_dims(m, n, k, lda, stride_a, stride_tau, batch_size,
+                                    scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cungqr_batch_usm_sycl)(queue, m, n, k, a, lda, stride_a, tau,
+                                                            stride_tau, batch_size, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event ungqr_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m,
                         std::int64_t n, std::int64_t k, std::complex<double> *a, std::int64_t lda,
@@ -1731,27 +4430,44 @@ sycl::event ungqr_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int
                         std::int64_t batch_size, std::complex<double> *scratchpad,
                         std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zungqr_batch_usm_sycl(queue, m, n, k, a, lda, stride_a, tau,
-                                                         stride_tau, batch_size, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zungqr_batch_usm",
+                                   "m n k lda stride_a stride_tau batch_size scratchpad_size",
+                                   { stats::work::orgqr, stats::c64 } };
+    auto shape = verbose::make_dims(m, n, k, lda, stride_a, stride_tau, batch_size,
+                                    scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zungqr_batch_usm_sycl)(queue, m, n, k, a, lda, stride_a, tau,
+                                                            stride_tau, batch_size, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event geqrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *m,
                         std::int64_t *n, float **a, std::int64_t *lda, float **tau,
                         std::int64_t group_count, std::int64_t *group_sizes, float *scratchpad,
                         std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].sgeqrf_group_usm_sycl(queue, m, n, a, lda, tau, group_count,
-                                                         group_sizes, scratchpad, scratchpad_size,
-                                                         dependencies);
+    static stats::routine routine{ trace_site, "sgeqrf_group_usm", "group_count scratchpad_size",
+                                   { stats::work::geqrf, stats::f32 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sgeqrf_group_usm_sycl)(queue, m, n, a, lda, tau, group_count,
+                                                            group_sizes, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event geqrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *m,
                         std::int64_t *n, double **a, std::int64_t *lda, double **tau,
                         std::int64_t group_count, std::int64_t *group_sizes, double *scratchpad,
                         std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dgeqrf_group_usm_sycl(queue, m, n, a, lda, tau, group_count,
-                                                         group_sizes, scratchpad, scratchpad_size,
-                                                         dependencies);
+    static stats::routine routine{ trace_site, "dgeqrf_group_usm", "group_count scratchpad_size",
+                                   { stats::work::geqrf, stats::f64 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dgeqrf_group_usm_sycl)(queue, m, n, a, lda, tau, group_count,
+                                                            group_sizes, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event geqrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *m,
                         std::int64_t *n, std::complex<float> **a, std::int64_t *lda,
@@ -1759,9 +4475,14 @@ sycl::event geqrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int
                         std::int64_t *group_sizes, std::complex<float> *scratchpad,
                         std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cgeqrf_group_usm_sycl(queue, m, n, a, lda, tau, group_count,
-                                                         group_sizes, scratchpad, scratchpad_size,
-                                                         dependencies);
+    static stats::routine routine{ trace_site, "cgeqrf_group_usm", "group_count scratchpad_size",
+                                   { stats::work::geqrf, stats::c32 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cgeqrf_group_usm_sycl)(queue, m, n, a, lda, tau, group_count,
+                                                            group_sizes, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event geqrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *m,
                         std::int64_t *n, std::complex<double> **a, std::int64_t *lda,
@@ -1769,79 +4490,124 @@ sycl::event geqrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int
                         std::int64_t *group_sizes, std::complex<double> *scratchpad,
                         std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zgeqrf_group_usm_sycl(queue, m, n, a, lda, tau, group_count,
-                                                         group_sizes, scratchpad, scratchpad_size,
-                                                         dependencies);
+    static stats::routine routine{ trace_site, "zgeqrf_group_usm", "group_count scratchpad_size",
+                                   { stats::work::geqrf, stats::c64 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zgeqrf_group_usm_sycl)(queue, m, n, a, lda, tau, group_count,
+                                                            group_sizes, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event getrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *m,
                         std::int64_t *n, float **a, std::int64_t *lda, std::int64_t **ipiv,
                         std::int64_t group_count, std::int64_t *group_sizes, float *scratchpad,
                         std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].sgetrf_group_usm_sycl(queue, m, n, a, lda, ipiv, group_count,
-                                                         group_sizes, scratchpad, scratchpad_size,
-                                                         dependencies);
+    static stats::routine routine{ trace_site, "sgetrf_group_usm", "group_count scratchpad_size",
+                                   { stats::work::getrf, stats::f32 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sgetrf_group_usm_sycl)(queue, m, n, a, lda, ipiv, group_count,
+                                                            group_sizes, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event getrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *m,
                         std::int64_t *n, double **a, std::int64_t *lda, std::int64_t **ipiv,
                         std::int64_t group_count, std::int64_t *group_sizes, double *scratchpad,
                         std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dgetrf_group_usm_sycl(queue, m, n, a, lda, ipiv, group_count,
-                                                         group_sizes, scratchpad, scratchpad_size,
-                                                         dependencies);
+    static stats::routine routine{ trace_site, "dgetrf_group_usm", "group_count scratchpad_size",
+                                   { stats::work::getrf, stats::f64 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dgetrf_group_usm_sycl)(queue, m, n, a, lda, ipiv, group_count,
+                                                            group_sizes, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event getrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *m,
                         std::int64_t *n, std::complex<float> **a, std::int64_t *lda,
                         std::int64_t **ipiv, std::int64_t group_count, std::int64_t *group_sizes,
                         std::complex<float> *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cgetrf_group_usm_sycl(queue, m, n, a, lda, ipiv, group_count,
-                                                         group_sizes, scratchpad, scratchpad_size,
-                                                         dependencies);
+    static stats::routine routine{ trace_site, "cgetrf_group_usm", "group_count scratchpad_size",
+                                   { stats::work::getrf, stats::c32 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cgetrf_group_usm_sycl)(queue, m, n, a, lda, ipiv, group_count,
+                                                            group_sizes, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event getrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *m,
                         std::int64_t *n, std::complex<double> **a, std::int64_t *lda,
                         std::int64_t **ipiv, std::int64_t group_count, std::int64_t *group_sizes,
                         std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zgetrf_group_usm_sycl(queue, m, n, a, lda, ipiv, group_count,
-                                                         group_sizes, scratchpad, scratchpad_size,
-                                                         dependencies);
+    static stats::routine routine{ trace_site, "zgetrf_group_usm", "group_count scratchpad_size",
+                                   { stats::work::getrf, stats::c64 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zgetrf_group_usm_sycl)(queue, m, n, a, lda, ipiv, group_count,
+                                                            group_sizes, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event getri_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n, float **a,
                         std::int64_t *lda, std::int64_t **ipiv, std::int64_t group_count,
                         std::int64_t *group_sizes, float *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].sgetri_group_usm_sycl(queue, n, a, lda, ipiv, group_count,
-                                                         group_sizes, scratchpad, scratchpad_size,
-                                                         dependencies);
+    static stats::routine routine{ trace_site, "sgetri_group_usm", "group_count scratchpad_size",
+                                   { stats::work::getri, stats::f32 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sgetri_group_usm_sycl)(queue, n, a, lda, ipiv, group_count,
+                                                            group_sizes, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event getri_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n, double **a,
                         std::int64_t *lda, std::int64_t **ipiv, std::int64_t group_count,
                         std::int64_t *group_sizes, double *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dgetri_group_usm_sycl(queue, n, a, lda, ipiv, group_count,
-                                                         group_sizes, scratchpad, scratchpad_size,
-                                                         dependencies);
+    static stats::routine routine{ trace_site, "dgetri_group_usm", "group_count scratchpad_size",
+                                   { stats::work::getri, stats::f64 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dgetri_group_usm_sycl)(queue, n, a, lda, ipiv, group_count,
+                                                            group_sizes, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event getri_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
                         std::complex<float> **a, std::int64_t *lda, std::int64_t **ipiv,
                         std::int64_t group_count, std::int64_t *group_sizes,
                         std::complex<float> *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cgetri_group_usm_sycl(queue, n, a, lda, ipiv, group_count,
-                                                         group_sizes, scratchpad, scratchpad_size,
-                                                         dependencies);
+    static stats::routine routine{ trace_site, "cgetri_group_usm", "group_count scratchpad_size",
+                                   { stats::work::getri, stats::c32 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cgetri_group_usm_sycl)(queue, n, a, lda, ipiv, group_count,
+                                                            group_sizes, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event getri_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
                         std::complex<double> **a, std::int64_t *lda, std::int64_t **ipiv,
                         std::int64_t group_count, std::int64_t *group_sizes,
                         std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zgetri_group_usm_sycl(queue, n, a, lda, ipiv, group_count,
-                                                         group_sizes, scratchpad, scratchpad_size,
-                                                         dependencies);
+    static stats::routine routine{ trace_site, "zgetri_group_usm", "group_count scratchpad_size",
+                                   { stats::work::getri, stats::c64 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zgetri_group_usm_sycl)(queue, n, a, lda, ipiv, group_count,
+                                                            group_sizes, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event getrs_batch(oneapi::mkl::device libkey, sycl::queue &queue,
                         oneapi::mkl::transpose *trans, std::int64_t *n, std::int64_t *nrhs,
@@ -1849,9 +4615,14 @@ sycl::event getrs_batch(oneapi::mkl::device libkey, sycl::queue &queue,
                         std::int64_t *ldb, std::int64_t group_count, std::int64_t *group_sizes,
                         float *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].sgetrs_group_usm_sycl(queue, trans, n, nrhs, a, lda, ipiv, b,
-                                                         ldb, group_count, group_sizes, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "sgetrs_group_usm", "group_count scratchpad_size",
+                                   { stats::work::getrs, stats::f32 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sgetrs_group_usm_sycl)(
+            queue, trans, n, nrhs, a, lda, ipiv, b, ldb, group_count, group_sizes, scratchpad,
+            scratchpad_size, dependencies);
+    });
 }
 sycl::event getrs_batch(oneapi::mkl::device libkey, sycl::queue &queue,
                         oneapi::mkl::transpose *trans, std::int64_t *n, std::int64_t *nrhs,
@@ -1859,9 +4630,14 @@ sycl::event getrs_batch(oneapi::mkl::device libkey, sycl::queue &queue,
                         std::int64_t *ldb, std::int64_t group_count, std::int64_t *group_sizes,
                         double *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dgetrs_group_usm_sycl(queue, trans, n, nrhs, a, lda, ipiv, b,
-                                                         ldb, group_count, group_sizes, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dgetrs_group_usm", "group_count scratchpad_size",
+                                   { stats::work::getrs, stats::f64 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dgetrs_group_usm_sycl)(
+            queue, trans, n, nrhs, a, lda, ipiv, b, ldb, group_count, group_sizes, scratchpad,
+            scratchpad_size, dependencies);
+    });
 }
 sycl::event getrs_batch(oneapi::mkl::device libkey, sycl::queue &queue,
                         oneapi::mkl::transpose *trans, std::int64_t *n, std::int64_t *nrhs,
@@ -1870,9 +4646,14 @@ sycl::event getrs_batch(oneapi::mkl::device libkey, sycl::queue &queue,
                         std::int64_t *group_sizes, std::complex<float> *scratchpad,
                         std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cgetrs_group_usm_sycl(queue, trans, n, nrhs, a, lda, ipiv, b,
-                                                         ldb, group_count, group_sizes, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "cgetrs_group_usm", "group_count scratchpad_size",
+                                   { stats::work::getrs, stats::c32 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cgetrs_group_usm_sycl)(
+            queue, trans, n, nrhs, a, lda, ipiv, b, ldb, group_count, group_sizes, scratchpad,
+            scratchpad_size, dependencies);
+    });
 }
 sycl::event getrs_batch(oneapi::mkl::device libkey, sycl::queue &queue,
                         oneapi::mkl::transpose *trans, std::int64_t *n, std::int64_t *nrhs,
@@ -1881,79 +4662,124 @@ sycl::event getrs_batch(oneapi::mkl::device libkey, sycl::queue &queue,
                         std::int64_t *group_sizes, std::complex<double> *scratchpad,
                         std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zgetrs_group_usm_sycl(queue, trans, n, nrhs, a, lda, ipiv, b,
-                                                         ldb, group_count, group_sizes, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zgetrs_group_usm", "group_count scratchpad_size",
+                                   { stats::work::getrs, stats::c64 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zgetrs_group_usm_sycl)(
+            queue, trans, n, nrhs, a, lda, ipiv, b, ldb, group_count, group_sizes, scratchpad,
+            scratchpad_size, dependencies);
+    });
 }
 sycl::event orgqr_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *m,
                         std::int64_t *n, std::int64_t *k, float **a, std::int64_t *lda, float **tau,
                         std::int64_t group_count, std::int64_t *group_sizes, float *scratchpad,
                         std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].sorgqr_group_usm_sycl(queue, m, n, k, a, lda, tau, group_count,
-                                                         group_sizes, scratchpad, scratchpad_size,
-                                                         dependencies);
+    static stats::routine routine{ trace_site, "sorgqr_group_usm", "group_count scratchpad_size",
+                                   { stats::work::orgqr, stats::f32 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.sorgqr_group_usm_sycl)(queue, m, n, k, a, lda, tau,
+                                                            group_count, group_sizes, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event orgqr_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *m,
                         std::int64_t *n, std::int64_t *k, double **a, std::int64_t *lda,
                         double **tau, std::int64_t group_count, std::int64_t *group_sizes,
                         double *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dorgqr_group_usm_sycl(queue, m, n, k, a, lda, tau, group_count,
-                                                         group_sizes, scratchpad, scratchpad_size,
-                                                         dependencies);
+    static stats::routine routine{ trace_site, "dorgqr_group_usm", "group_count scratchpad_size",
+                                   { stats::work::orgqr, stats::f64 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dorgqr_group_usm_sycl)(queue, m, n, k, a, lda, tau,
+                                                            group_count, group_sizes, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event potrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo *uplo,
                         std::int64_t *n, float **a, std::int64_t *lda, std::int64_t group_count,
                         std::int64_t *group_sizes, float *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].spotrf_group_usm_sycl(queue, uplo, n, a, lda, group_count,
-                                                         group_sizes, scratchpad, scratchpad_size,
-                                                         dependencies);
+    static stats::routine routine{ trace_site, "spotrf_group_usm", "group_count scratchpad_size",
+                                   { stats::work::potrf, stats::f32 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.spotrf_group_usm_sycl)(queue, uplo, n, a, lda, group_count,
+                                                            group_sizes, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event potrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo *uplo,
                         std::int64_t *n, double **a, std::int64_t *lda, std::int64_t group_count,
                         std::int64_t *group_sizes, double *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dpotrf_group_usm_sycl(queue, uplo, n, a, lda, group_count,
-                                                         group_sizes, scratchpad, scratchpad_size,
-                                                         dependencies);
+    static stats::routine routine{ trace_site, "dpotrf_group_usm", "group_count scratchpad_size",
+                                   { stats::work::potrf, stats::f64 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dpotrf_group_usm_sycl)(queue, uplo, n, a, lda, group_count,
+                                                            group_sizes, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event potrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo *uplo,
                         std::int64_t *n, std::complex<float> **a, std::int64_t *lda,
                         std::int64_t group_count, std::int64_t *group_sizes,
                         std::complex<float> *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cpotrf_group_usm_sycl(queue, uplo, n, a, lda, group_count,
-                                                         group_sizes, scratchpad, scratchpad_size,
-                                                         dependencies);
+    static stats::routine routine{ trace_site, "cpotrf_group_usm", "group_count scratchpad_size",
+                                   { stats::work::potrf, stats::c32 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cpotrf_group_usm_sycl)(queue, uplo, n, a, lda, group_count,
+                                                            group_sizes, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event potrf_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo *uplo,
                         std::int64_t *n, std::complex<double> **a, std::int64_t *lda,
                         std::int64_t group_count, std::int64_t *group_sizes,
                         std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zpotrf_group_usm_sycl(queue, uplo, n, a, lda, group_count,
-                                                         group_sizes, scratchpad, scratchpad_size,
-                                                         dependencies);
+    static stats::routine routine{ trace_site, "zpotrf_group_usm", "group_count scratchpad_size",
+                                   { stats::work::potrf, stats::c64 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zpotrf_group_usm_sycl)(queue, uplo, n, a, lda, group_count,
+                                                            group_sizes, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event potrs_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo *uplo,
                         std::int64_t *n, std::int64_t *nrhs, float **a, std::int64_t *lda,
                         float **b, std::int64_t *ldb, std::int64_t group_count,
                         std::int64_t *group_sizes, float *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].spotrs_group_usm_sycl(queue, uplo, n, nrhs, a, lda, b, ldb,
-                                                         group_count, group_sizes, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "spotrs_group_usm", "group_count scratchpad_size",
+                                   { stats::work::getrs, stats::f32 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.spotrs_group_usm_sycl)(queue, uplo, n, nrhs, a, lda, b, ldb,
+                                                            group_count, group_sizes, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event potrs_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo *uplo,
                         std::int64_t *n, std::int64_t *nrhs, double **a, std::int64_t *lda,
                         double **b, std::int64_t *ldb, std::int64_t group_count,
                         std::int64_t *group_sizes, double *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].dpotrs_group_usm_sycl(queue, uplo, n, nrhs, a, lda, b, ldb,
-                                                         group_count, group_sizes, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "dpotrs_group_usm", "group_count scratchpad_size",
+                                   { stats::work::getrs, stats::f64 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.dpotrs_group_usm_sycl)(queue, uplo, n, nrhs, a, lda, b, ldb,
+                                                            group_count, group_sizes, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event potrs_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo *uplo,
                         std::int64_t *n, std::int64_t *nrhs, std::complex<float> **a,
@@ -1961,9 +4787,14 @@ sycl::event potrs_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::
                         std::int64_t group_count, std::int64_t *group_sizes,
                         std::complex<float> *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cpotrs_group_usm_sycl(queue, uplo, n, nrhs, a, lda, b, ldb,
-                                                         group_count, group_sizes, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "cpotrs_group_usm", "group_count scratchpad_size",
+                                   { stats::work::getrs, stats::c32 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cpotrs_group_usm_sycl)(queue, uplo, n, nrhs, a, lda, b, ldb,
+                                                            group_count, group_sizes, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event potrs_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo *uplo,
                         std::int64_t *n, std::int64_t *nrhs, std::complex<double> **a,
@@ -1971,9 +4802,14 @@ sycl::event potrs_batch(oneapi::mkl::device libkey, sycl::queue &queue, oneapi::
                         std::int64_t group_count, std::int64_t *group_sizes,
                         std::complex<double> *scratchpad, std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zpotrs_group_usm_sycl(queue, uplo, n, nrhs, a, lda, b, ldb,
-                                                         group_count, group_sizes, scratchpad,
-                                                         scratchpad_size, dependencies);
+    static stats::routine routine{ trace_site, "zpotrs_group_usm", "group_count scratchpad_size",
+                                   { stats::work::getrs, stats::c64 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zpotrs_group_usm_sycl)(queue, uplo, n, nrhs, a, lda, b, ldb,
+                                                            group_count, group_sizes, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event ungqr_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *m,
                         std::int64_t *n, std::int64_t *k, std::complex<float> **a,
@@ -1981,9 +4817,14 @@ sycl::event ungqr_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int
                         std::int64_t *group_sizes, std::complex<float> *scratchpad,
                         std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].cungqr_group_usm_sycl(queue, m, n, k, a, lda, tau, group_count,
-                                                         group_sizes, scratchpad, scratchpad_size,
-                                                         dependencies);
+    static stats::routine routine{ trace_site, "cungqr_group_usm", "group_count scratchpad_size",
+                                   { stats::work::orgqr, stats::c32 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.cungqr_group_usm_sycl)(queue, m, n, k, a, lda, tau,
+                                                            group_count, group_sizes, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 sycl::event ungqr_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *m,
                         std::int64_t *n, std::int64_t *k, std::complex<double> **a,
@@ -1991,22 +4832,37 @@ sycl::event ungqr_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int
                         std::int64_t *group_sizes, std::complex<double> *scratchpad,
                         std::int64_t scratchpad_size,
                         const sycl::vector_class<sycl::event> &dependencies) {
-    return function_tables[libkey].zungqr_group_usm_sycl(queue, m, n, k, a, lda, tau, group_count,
-                                                         group_sizes, scratchpad, scratchpad_size,
-                                                         dependencies);
+    static stats::routine routine{ trace_site, "zungqr_group_usm", "group_count scratchpad_size",
+                                   { stats::work::orgqr, stats::c64 } };
+    auto shape = verbose::make_dims(group_count, scratchpad_size);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.zungqr_group_usm_sycl)(queue, m, n, k, a, lda, tau,
+                                                            group_count, group_sizes, scratchpad,
+                                                            scratchpad_size, dependencies);
+    });
 }
 
 template <>
 std::int64_t gebrd_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                         sycl::queue &queue, std::int64_t m,
                                                         std::int64_t n, std::int64_t lda) {
-    return function_tables[libkey].sgebrd_scratchpad_size_sycl(queue, m, n, lda);
+    auto shape = make_shape(m, n, lda);
+    return scratchpad_sizes.get("sgebrd_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sgebrd_scratchpad_size_sycl(queue, m, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t gebrd_scratchpad_size<double>(oneapi::mkl::device libkey,
                                                          sycl::queue &queue, std::int64_t m,
                                                          std::int64_t n, std::int64_t lda) {
-    return function_tables[libkey].dgebrd_scratchpad_size_sycl(queue, m, n, lda);
+    auto shape = make_shape(m, n, lda);
+    return scratchpad_sizes.get("dgebrd_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dgebrd_scratchpad_size_sycl(queue, m, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t gebrd_scratchpad_size<std::complex<float>>(oneapi::mkl::device libkey,
@@ -2014,7 +4870,12 @@ std::int64_t gebrd_scratchpad_size<std::complex<float>>(oneapi::mkl::device libk
                                                                       std::int64_t m,
                                                                       std::int64_t n,
                                                                       std::int64_t lda) {
-    return function_tables[libkey].cgebrd_scratchpad_size_sycl(queue, m, n, lda);
+    auto shape = make_shape(m, n, lda);
+    return scratchpad_sizes.get("cgebrd_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cgebrd_scratchpad_size_sycl(queue, m, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t gebrd_scratchpad_size<std::complex<double>>(oneapi::mkl::device libkey,
@@ -2022,19 +4883,126 @@ std::int64_t gebrd_scratchpad_size<std::complex<double>>(oneapi::mkl::device lib
                                                                        std::int64_t m,
                                                                        std::int64_t n,
                                                                        std::int64_t lda) {
-    return function_tables[libkey].zgebrd_scratchpad_size_sycl(queue, m, n, lda);
+    auto shape = make_shape(m, n, lda);
+    return scratchpad_sizes.get("zgebrd_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zgebrd_scratchpad_size_sycl(queue, m, n, lda);
+        });
+    });
+}
+template <>
+std::int64_t gels_scratchpad_size<float>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                         oneapi::mkl::transpose trans, std::int64_t m,
+                                         std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                         std::int64_t ldb) {
+    auto shape = make_shape(trans, m, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("sgels_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sgels_scratchpad_size_sycl(queue, trans, m, n, nrhs, lda, ldb);
+        });
+    });
+}
+template <>
+std::int64_t gels_scratchpad_size<double>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                          oneapi::mkl::transpose trans, std::int64_t m,
+                                          std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                          std::int64_t ldb) {
+    auto shape = make_shape(trans, m, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("dgels_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dgels_scratchpad_size_sycl(queue, trans, m, n, nrhs, lda, ldb);
+        });
+    });
+}
+template <>
+std::int64_t gels_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t ldb) {
+    auto shape = make_shape(trans, m, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("cgels_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cgels_scratchpad_size_sycl(queue, trans, m, n, nrhs, lda, ldb);
+        });
+    });
+}
+template <>
+std::int64_t gels_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t ldb) {
+    auto shape = make_shape(trans, m, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("zgels_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zgels_scratchpad_size_sycl(queue, trans, m, n, nrhs, lda, ldb);
+        });
+    });
+}
+template <>
+std::int64_t gelsd_scratchpad_size<float>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                          std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                                          std::int64_t lda, std::int64_t ldb) {
+    auto shape = make_shape(m, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("sgelsd_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sgelsd_scratchpad_size_sycl(queue, m, n, nrhs, lda, ldb);
+        });
+    });
+}
+template <>
+std::int64_t gelsd_scratchpad_size<double>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                           std::int64_t m, std::int64_t n, std::int64_t nrhs,
+                                           std::int64_t lda, std::int64_t ldb) {
+    auto shape = make_shape(m, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("dgelsd_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dgelsd_scratchpad_size_sycl(queue, m, n, nrhs, lda, ldb);
+        });
+    });
+}
+template <>
+std::int64_t gelsd_scratchpad_size<std::complex<float>>(oneapi::mkl::device libkey,
+                                                        sycl::queue &queue, std::int64_t m,
+                                                        std::int64_t n, std::int64_t nrhs,
+                                                        std::int64_t lda, std::int64_t ldb) {
+    auto shape = make_shape(m, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("cgelsd_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cgelsd_scratchpad_size_sycl(queue, m, n, nrhs, lda, ldb);
+        });
+    });
+}
+template <>
+std::int64_t gelsd_scratchpad_size<std::complex<double>>(oneapi::mkl::device libkey,
+                                                         sycl::queue &queue, std::int64_t m,
+                                                         std::int64_t n, std::int64_t nrhs,
+                                                         std::int64_t lda, std::int64_t ldb) {
+    auto shape = make_shape(m, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("zgelsd_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zgelsd_scratchpad_size_sycl(queue, m, n, nrhs, lda, ldb);
+        });
+    });
 }
 template <>
 std::int64_t gerqf_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                         sycl::queue &queue, std::int64_t m,
                                                         std::int64_t n, std::int64_t lda) {
-    return function_tables[libkey].sgerqf_scratchpad_size_sycl(queue, m, n, lda);
+    auto shape = make_shape(m, n, lda);
+    return scratchpad_sizes.get("sgerqf_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sgerqf_scratchpad_size_sycl(queue, m, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t gerqf_scratchpad_size<double>(oneapi::mkl::device libkey,
                                                          sycl::queue &queue, std::int64_t m,
                                                          std::int64_t n, std::int64_t lda) {
-    return function_tables[libkey].dgerqf_scratchpad_size_sycl(queue, m, n, lda);
+    auto shape = make_shape(m, n, lda);
+    return scratchpad_sizes.get("dgerqf_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dgerqf_scratchpad_size_sycl(queue, m, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t gerqf_scratchpad_size<std::complex<float>>(oneapi::mkl::device libkey,
@@ -2042,7 +5010,12 @@ std::int64_t gerqf_scratchpad_size<std::complex<float>>(oneapi::mkl::device libk
                                                                       std::int64_t m,
                                                                       std::int64_t n,
                                                                       std::int64_t lda) {
-    return function_tables[libkey].cgerqf_scratchpad_size_sycl(queue, m, n, lda);
+    auto shape = make_shape(m, n, lda);
+    return scratchpad_sizes.get("cgerqf_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cgerqf_scratchpad_size_sycl(queue, m, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t gerqf_scratchpad_size<std::complex<double>>(oneapi::mkl::device libkey,
@@ -2050,19 +5023,34 @@ std::int64_t gerqf_scratchpad_size<std::complex<double>>(oneapi::mkl::device lib
                                                                        std::int64_t m,
                                                                        std::int64_t n,
                                                                        std::int64_t lda) {
-    return function_tables[libkey].zgerqf_scratchpad_size_sycl(queue, m, n, lda);
+    auto shape = make_shape(m, n, lda);
+    return scratchpad_sizes.get("zgerqf_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zgerqf_scratchpad_size_sycl(queue, m, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t geqrf_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                         sycl::queue &queue, std::int64_t m,
                                                         std::int64_t n, std::int64_t lda) {
-    return function_tables[libkey].sgeqrf_scratchpad_size_sycl(queue, m, n, lda);
+    auto shape = make_shape(m, n, lda);
+    return scratchpad_sizes.get("sgeqrf_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sgeqrf_scratchpad_size_sycl(queue, m, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t geqrf_scratchpad_size<double>(oneapi::mkl::device libkey,
                                                          sycl::queue &queue, std::int64_t m,
                                                          std::int64_t n, std::int64_t lda) {
-    return function_tables[libkey].dgeqrf_scratchpad_size_sycl(queue, m, n, lda);
+    auto shape = make_shape(m, n, lda);
+    return scratchpad_sizes.get("dgeqrf_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dgeqrf_scratchpad_size_sycl(queue, m, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t geqrf_scratchpad_size<std::complex<float>>(oneapi::mkl::device libkey,
@@ -2070,7 +5058,12 @@ std::int64_t geqrf_scratchpad_size<std::complex<float>>(oneapi::mkl::device libk
                                                                       std::int64_t m,
                                                                       std::int64_t n,
                                                                       std::int64_t lda) {
-    return function_tables[libkey].cgeqrf_scratchpad_size_sycl(queue, m, n, lda);
+    auto shape = make_shape(m, n, lda);
+    return scratchpad_sizes.get("cgeqrf_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cgeqrf_scratchpad_size_sycl(queue, m, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t geqrf_scratchpad_size<std::complex<double>>(oneapi::mkl::device libkey,
@@ -2078,7 +5071,12 @@ std::int64_t geqrf_scratchpad_size<std::complex<double>>(oneapi::mkl::device lib
                                                                        std::int64_t m,
                                                                        std::int64_t n,
                                                                        std::int64_t lda) {
-    return function_tables[libkey].zgeqrf_scratchpad_size_sycl(queue, m, n, lda);
+    auto shape = make_shape(m, n, lda);
+    return scratchpad_sizes.get("zgeqrf_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zgeqrf_scratchpad_size_sycl(queue, m, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t gesvd_scratchpad_size<float>(oneapi::mkl::device libkey,
@@ -2087,8 +5085,12 @@ std::int64_t gesvd_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                         oneapi::mkl::jobsvd jobvt, std::int64_t m,
                                                         std::int64_t n, std::int64_t lda,
                                                         std::int64_t ldu, std::int64_t ldvt) {
-    return function_tables[libkey].sgesvd_scratchpad_size_sycl(queue, jobu, jobvt, m, n, lda, ldu,
-                                                               ldvt);
+    auto shape = make_shape(jobu, jobvt, m, n, lda, ldu, ldvt);
+    return scratchpad_sizes.get("sgesvd_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sgesvd_scratchpad_size_sycl(queue, jobu, jobvt, m, n, lda, ldu, ldvt);
+        });
+    });
 }
 template <>
 std::int64_t gesvd_scratchpad_size<double>(oneapi::mkl::device libkey,
@@ -2097,36 +5099,58 @@ std::int64_t gesvd_scratchpad_size<double>(oneapi::mkl::device libkey,
                                                          oneapi::mkl::jobsvd jobvt, std::int64_t m,
                                                          std::int64_t n, std::int64_t lda,
                                                          std::int64_t ldu, std::int64_t ldvt) {
-    return function_tables[libkey].dgesvd_scratchpad_size_sycl(queue, jobu, jobvt, m, n, lda, ldu,
-                                                               ldvt);
+    auto shape = make_shape(jobu, jobvt, m, n, lda, ldu, ldvt);
+    return scratchpad_sizes.get("dgesvd_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dgesvd_scratchpad_size_sycl(queue, jobu, jobvt, m, n, lda, ldu, ldvt);
+        });
+    });
 }
 template <>
 std::int64_t gesvd_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
     oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::int64_t lda, std::int64_t ldu,
     std::int64_t ldvt) {
-    return function_tables[libkey].cgesvd_scratchpad_size_sycl(queue, jobu, jobvt, m, n, lda, ldu,
-                                                               ldvt);
+    auto shape = make_shape(jobu, jobvt, m, n, lda, ldu, ldvt);
+    return scratchpad_sizes.get("cgesvd_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cgesvd_scratchpad_size_sycl(queue, jobu, jobvt, m, n, lda, ldu, ldvt);
+        });
+    });
 }
 template <>
 std::int64_t gesvd_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::jobsvd jobu,
     oneapi::mkl::jobsvd jobvt, std::int64_t m, std::int64_t n, std::int64_t lda, std::int64_t ldu,
     std::int64_t ldvt) {
-    return function_tables[libkey].zgesvd_scratchpad_size_sycl(queue, jobu, jobvt, m, n, lda, ldu,
-                                                               ldvt);
+    auto shape = make_shape(jobu, jobvt, m, n, lda, ldu, ldvt);
+    return scratchpad_sizes.get("zgesvd_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zgesvd_scratchpad_size_sycl(queue, jobu, jobvt, m, n, lda, ldu, ldvt);
+        });
+    });
 }
 template <>
 std::int64_t getrf_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                         sycl::queue &queue, std::int64_t m,
                                                         std::int64_t n, std::int64_t lda) {
-    return function_tables[libkey].sgetrf_scratchpad_size_sycl(queue, m, n, lda);
+    auto shape = make_shape(m, n, lda);
+    return scratchpad_sizes.get("sgetrf_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sgetrf_scratchpad_size_sycl(queue, m, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t getrf_scratchpad_size<double>(oneapi::mkl::device libkey,
                                                          sycl::queue &queue, std::int64_t m,
                                                          std::int64_t n, std::int64_t lda) {
-    return function_tables[libkey].dgetrf_scratchpad_size_sycl(queue, m, n, lda);
+    auto shape = make_shape(m, n, lda);
+    return scratchpad_sizes.get("dgetrf_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dgetrf_scratchpad_size_sycl(queue, m, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t getrf_scratchpad_size<std::complex<float>>(oneapi::mkl::device libkey,
@@ -2134,7 +5158,12 @@ std::int64_t getrf_scratchpad_size<std::complex<float>>(oneapi::mkl::device libk
                                                                       std::int64_t m,
                                                                       std::int64_t n,
                                                                       std::int64_t lda) {
-    return function_tables[libkey].cgetrf_scratchpad_size_sycl(queue, m, n, lda);
+    auto shape = make_shape(m, n, lda);
+    return scratchpad_sizes.get("cgetrf_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cgetrf_scratchpad_size_sycl(queue, m, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t getrf_scratchpad_size<std::complex<double>>(oneapi::mkl::device libkey,
@@ -2142,33 +5171,58 @@ std::int64_t getrf_scratchpad_size<std::complex<double>>(oneapi::mkl::device lib
                                                                        std::int64_t m,
                                                                        std::int64_t n,
                                                                        std::int64_t lda) {
-    return function_tables[libkey].zgetrf_scratchpad_size_sycl(queue, m, n, lda);
+    auto shape = make_shape(m, n, lda);
+    return scratchpad_sizes.get("zgetrf_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zgetrf_scratchpad_size_sycl(queue, m, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t getri_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                         sycl::queue &queue, std::int64_t n,
                                                         std::int64_t lda) {
-    return function_tables[libkey].sgetri_scratchpad_size_sycl(queue, n, lda);
+    auto shape = make_shape(n, lda);
+    return scratchpad_sizes.get("sgetri_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sgetri_scratchpad_size_sycl(queue, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t getri_scratchpad_size<double>(oneapi::mkl::device libkey,
                                                          sycl::queue &queue, std::int64_t n,
                                                          std::int64_t lda) {
-    return function_tables[libkey].dgetri_scratchpad_size_sycl(queue, n, lda);
+    auto shape = make_shape(n, lda);
+    return scratchpad_sizes.get("dgetri_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dgetri_scratchpad_size_sycl(queue, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t getri_scratchpad_size<std::complex<float>>(oneapi::mkl::device libkey,
                                                                       sycl::queue &queue,
                                                                       std::int64_t n,
                                                                       std::int64_t lda) {
-    return function_tables[libkey].cgetri_scratchpad_size_sycl(queue, n, lda);
+    auto shape = make_shape(n, lda);
+    return scratchpad_sizes.get("cgetri_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cgetri_scratchpad_size_sycl(queue, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t getri_scratchpad_size<std::complex<double>>(oneapi::mkl::device libkey,
                                                                        sycl::queue &queue,
                                                                        std::int64_t n,
                                                                        std::int64_t lda) {
-    return function_tables[libkey].zgetri_scratchpad_size_sycl(queue, n, lda);
+    auto shape = make_shape(n, lda);
+    return scratchpad_sizes.get("zgetri_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zgetri_scratchpad_size_sycl(queue, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t getrs_scratchpad_size<float>(oneapi::mkl::device libkey,
@@ -2176,7 +5230,12 @@ std::int64_t getrs_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                         oneapi::mkl::transpose trans,
                                                         std::int64_t n, std::int64_t nrhs,
                                                         std::int64_t lda, std::int64_t ldb) {
-    return function_tables[libkey].sgetrs_scratchpad_size_sycl(queue, trans, n, nrhs, lda, ldb);
+    auto shape = make_shape(trans, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("sgetrs_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sgetrs_scratchpad_size_sycl(queue, trans, n, nrhs, lda, ldb);
+        });
+    });
 }
 template <>
 std::int64_t getrs_scratchpad_size<double>(oneapi::mkl::device libkey,
@@ -2184,45 +5243,176 @@ std::int64_t getrs_scratchpad_size<double>(oneapi::mkl::device libkey,
                                                          oneapi::mkl::transpose trans,
                                                          std::int64_t n, std::int64_t nrhs,
                                                          std::int64_t lda, std::int64_t ldb) {
-    return function_tables[libkey].dgetrs_scratchpad_size_sycl(queue, trans, n, nrhs, lda, ldb);
+    auto shape = make_shape(trans, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("dgetrs_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dgetrs_scratchpad_size_sycl(queue, trans, n, nrhs, lda, ldb);
+        });
+    });
 }
 template <>
 std::int64_t getrs_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
     std::int64_t nrhs, std::int64_t lda, std::int64_t ldb) {
-    return function_tables[libkey].cgetrs_scratchpad_size_sycl(queue, trans, n, nrhs, lda, ldb);
+    auto shape = make_shape(trans, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("cgetrs_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cgetrs_scratchpad_size_sycl(queue, trans, n, nrhs, lda, ldb);
+        });
+    });
 }
 template <>
 std::int64_t getrs_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
     std::int64_t nrhs, std::int64_t lda, std::int64_t ldb) {
-    return function_tables[libkey].zgetrs_scratchpad_size_sycl(queue, trans, n, nrhs, lda, ldb);
+    auto shape = make_shape(trans, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("zgetrs_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zgetrs_scratchpad_size_sycl(queue, trans, n, nrhs, lda, ldb);
+        });
+    });
+}
+template <>
+std::int64_t gesv_scratchpad_size<float>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                         std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                         std::int64_t ldb) {
+    auto shape = make_shape(n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("sgesv_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sgesv_scratchpad_size_sycl(queue, n, nrhs, lda, ldb);
+        });
+    });
+}
+template <>
+std::int64_t gesv_scratchpad_size<double>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                          std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                          std::int64_t ldb) {
+    auto shape = make_shape(n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("dgesv_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dgesv_scratchpad_size_sycl(queue, n, nrhs, lda, ldb);
+        });
+    });
+}
+template <>
+std::int64_t gesv_scratchpad_size<std::complex<float>>(oneapi::mkl::device libkey,
+                                                       sycl::queue &queue, std::int64_t n,
+                                                       std::int64_t nrhs, std::int64_t lda,
+                                                       std::int64_t ldb) {
+    auto shape = make_shape(n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("cgesv_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cgesv_scratchpad_size_sycl(queue, n, nrhs, lda, ldb);
+        });
+    });
+}
+template <>
+std::int64_t gesv_scratchpad_size<std::complex<double>>(oneapi::mkl::device libkey,
+                                                        sycl::queue &queue, std::int64_t n,
+                                                        std::int64_t nrhs, std::int64_t lda,
+                                                        std::int64_t ldb) {
+    auto shape = make_shape(n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("zgesv_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zgesv_scratchpad_size_sycl(queue, n, nrhs, lda, ldb);
+        });
+    });
 }
 template <>
 std::int64_t heevd_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
     std::int64_t n, std::int64_t lda) {
-    return function_tables[libkey].cheevd_scratchpad_size_sycl(queue, jobz, uplo, n, lda);
+    auto shape = make_shape(jobz, uplo, n, lda);
+    return scratchpad_sizes.get("cheevd_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cheevd_scratchpad_size_sycl(queue, jobz, uplo, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t heevd_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
     std::int64_t n, std::int64_t lda) {
-    return function_tables[libkey].zheevd_scratchpad_size_sycl(queue, jobz, uplo, n, lda);
+    auto shape = make_shape(jobz, uplo, n, lda);
+    return scratchpad_sizes.get("zheevd_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zheevd_scratchpad_size_sycl(queue, jobz, uplo, n, lda);
+        });
+    });
+}
+template <>
+std::int64_t heevr_scratchpad_size<std::complex<float>>(oneapi::mkl::device libkey,
+                                                        sycl::queue &queue, oneapi::mkl::job jobz,
+                                                        oneapi::mkl::rangev range,
+                                                        oneapi::mkl::uplo uplo, std::int64_t n,
+                                                        std::int64_t lda, std::int64_t ldz) {
+    auto shape = make_shape(jobz, range, uplo, n, lda, ldz);
+    return scratchpad_sizes.get("cheevr_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cheevr_scratchpad_size_sycl(queue, jobz, range, uplo, n, lda, ldz);
+        });
+    });
+}
+template <>
+std::int64_t heevr_scratchpad_size<std::complex<double>>(oneapi::mkl::device libkey,
+                                                         sycl::queue &queue, oneapi::mkl::job jobz,
+                                                         oneapi::mkl::rangev range,
+                                                         oneapi::mkl::uplo uplo, std::int64_t n,
+                                                         std::int64_t lda, std::int64_t ldz) {
+    auto shape = make_shape(jobz, range, uplo, n, lda, ldz);
+    return scratchpad_sizes.get("zheevr_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zheevr_scratchpad_size_sycl(queue, jobz, range, uplo, n, lda, ldz);
+        });
+    });
+}
+template <>
+std::int64_t heevx_scratchpad_size<std::complex<float>>(oneapi::mkl::device libkey,
+                                                        sycl::queue &queue, oneapi::mkl::job jobz,
+                                                        oneapi::mkl::rangev range,
+                                                        oneapi::mkl::uplo uplo, std::int64_t n,
+                                                        std::int64_t lda, std::int64_t ldz) {
+    auto shape = make_shape(jobz, range, uplo, n, lda, ldz);
+    return scratchpad_sizes.get("cheevx_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cheevx_scratchpad_size_sycl(queue, jobz, range, uplo, n, lda, ldz);
+        });
+    });
+}
+template <>
+std::int64_t heevx_scratchpad_size<std::complex<double>>(oneapi::mkl::device libkey,
+                                                         sycl::queue &queue, oneapi::mkl::job jobz,
+                                                         oneapi::mkl::rangev range,
+                                                         oneapi::mkl::uplo uplo, std::int64_t n,
+                                                         std::int64_t lda, std::int64_t ldz) {
+    auto shape = make_shape(jobz, range, uplo, n, lda, ldz);
+    return scratchpad_sizes.get("zheevx_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zheevx_scratchpad_size_sycl(queue, jobz, range, uplo, n, lda, ldz);
+        });
+    });
 }
 template <>
 std::int64_t hegvd_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
     oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda, std::int64_t ldb) {
-    return function_tables[libkey].chegvd_scratchpad_size_sycl(queue, itype, jobz, uplo, n, lda,
-                                                               ldb);
+    auto shape = make_shape(itype, jobz, uplo, n, lda, ldb);
+    return scratchpad_sizes.get("chegvd_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.chegvd_scratchpad_size_sycl(queue, itype, jobz, uplo, n, lda, ldb);
+        });
+    });
 }
 template <>
 std::int64_t hegvd_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t itype, oneapi::mkl::job jobz,
     oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda, std::int64_t ldb) {
-    return function_tables[libkey].zhegvd_scratchpad_size_sycl(queue, itype, jobz, uplo, n, lda,
-                                                               ldb);
+    auto shape = make_shape(itype, jobz, uplo, n, lda, ldb);
+    return scratchpad_sizes.get("zhegvd_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zhegvd_scratchpad_size_sycl(queue, itype, jobz, uplo, n, lda, ldb);
+        });
+    });
 }
 template <>
 std::int64_t hetrd_scratchpad_size<std::complex<float>>(oneapi::mkl::device libkey,
@@ -2230,7 +5420,12 @@ std::int64_t hetrd_scratchpad_size<std::complex<float>>(oneapi::mkl::device libk
                                                                       oneapi::mkl::uplo uplo,
                                                                       std::int64_t n,
                                                                       std::int64_t lda) {
-    return function_tables[libkey].chetrd_scratchpad_size_sycl(queue, uplo, n, lda);
+    auto shape = make_shape(uplo, n, lda);
+    return scratchpad_sizes.get("chetrd_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.chetrd_scratchpad_size_sycl(queue, uplo, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t hetrd_scratchpad_size<std::complex<double>>(oneapi::mkl::device libkey,
@@ -2238,7 +5433,12 @@ std::int64_t hetrd_scratchpad_size<std::complex<double>>(oneapi::mkl::device lib
                                                                        oneapi::mkl::uplo uplo,
                                                                        std::int64_t n,
                                                                        std::int64_t lda) {
-    return function_tables[libkey].zhetrd_scratchpad_size_sycl(queue, uplo, n, lda);
+    auto shape = make_shape(uplo, n, lda);
+    return scratchpad_sizes.get("zhetrd_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zhetrd_scratchpad_size_sycl(queue, uplo, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t hetrf_scratchpad_size<std::complex<float>>(oneapi::mkl::device libkey,
@@ -2246,7 +5446,12 @@ std::int64_t hetrf_scratchpad_size<std::complex<float>>(oneapi::mkl::device libk
                                                                       oneapi::mkl::uplo uplo,
                                                                       std::int64_t n,
                                                                       std::int64_t lda) {
-    return function_tables[libkey].chetrf_scratchpad_size_sycl(queue, uplo, n, lda);
+    auto shape = make_shape(uplo, n, lda);
+    return scratchpad_sizes.get("chetrf_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.chetrf_scratchpad_size_sycl(queue, uplo, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t hetrf_scratchpad_size<std::complex<double>>(oneapi::mkl::device libkey,
@@ -2254,7 +5459,12 @@ std::int64_t hetrf_scratchpad_size<std::complex<double>>(oneapi::mkl::device lib
                                                                        oneapi::mkl::uplo uplo,
                                                                        std::int64_t n,
                                                                        std::int64_t lda) {
-    return function_tables[libkey].zhetrf_scratchpad_size_sycl(queue, uplo, n, lda);
+    auto shape = make_shape(uplo, n, lda);
+    return scratchpad_sizes.get("zhetrf_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zhetrf_scratchpad_size_sycl(queue, uplo, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t orgbr_scratchpad_size<float>(oneapi::mkl::device libkey,
@@ -2262,7 +5472,12 @@ std::int64_t orgbr_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                         oneapi::mkl::generate vect, std::int64_t m,
                                                         std::int64_t n, std::int64_t k,
                                                         std::int64_t lda) {
-    return function_tables[libkey].sorgbr_scratchpad_size_sycl(queue, vect, m, n, k, lda);
+    auto shape = make_shape(vect, m, n, k, lda);
+    return scratchpad_sizes.get("sorgbr_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sorgbr_scratchpad_size_sycl(queue, vect, m, n, k, lda);
+        });
+    });
 }
 template <>
 std::int64_t orgbr_scratchpad_size<double>(oneapi::mkl::device libkey,
@@ -2270,33 +5485,58 @@ std::int64_t orgbr_scratchpad_size<double>(oneapi::mkl::device libkey,
                                                          oneapi::mkl::generate vect, std::int64_t m,
                                                          std::int64_t n, std::int64_t k,
                                                          std::int64_t lda) {
-    return function_tables[libkey].dorgbr_scratchpad_size_sycl(queue, vect, m, n, k, lda);
+    auto shape = make_shape(vect, m, n, k, lda);
+    return scratchpad_sizes.get("dorgbr_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dorgbr_scratchpad_size_sycl(queue, vect, m, n, k, lda);
+        });
+    });
 }
 template <>
 std::int64_t orgtr_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                         sycl::queue &queue, oneapi::mkl::uplo uplo,
                                                         std::int64_t n, std::int64_t lda) {
-    return function_tables[libkey].sorgtr_scratchpad_size_sycl(queue, uplo, n, lda);
+    auto shape = make_shape(uplo, n, lda);
+    return scratchpad_sizes.get("sorgtr_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sorgtr_scratchpad_size_sycl(queue, uplo, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t orgtr_scratchpad_size<double>(oneapi::mkl::device libkey,
                                                          sycl::queue &queue, oneapi::mkl::uplo uplo,
                                                          std::int64_t n, std::int64_t lda) {
-    return function_tables[libkey].dorgtr_scratchpad_size_sycl(queue, uplo, n, lda);
+    auto shape = make_shape(uplo, n, lda);
+    return scratchpad_sizes.get("dorgtr_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dorgtr_scratchpad_size_sycl(queue, uplo, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t orgqr_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                         sycl::queue &queue, std::int64_t m,
                                                         std::int64_t n, std::int64_t k,
                                                         std::int64_t lda) {
-    return function_tables[libkey].sorgqr_scratchpad_size_sycl(queue, m, n, k, lda);
+    auto shape = make_shape(m, n, k, lda);
+    return scratchpad_sizes.get("sorgqr_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sorgqr_scratchpad_size_sycl(queue, m, n, k, lda);
+        });
+    });
 }
 template <>
 std::int64_t orgqr_scratchpad_size<double>(oneapi::mkl::device libkey,
                                                          sycl::queue &queue, std::int64_t m,
                                                          std::int64_t n, std::int64_t k,
                                                          std::int64_t lda) {
-    return function_tables[libkey].dorgqr_scratchpad_size_sycl(queue, m, n, k, lda);
+    auto shape = make_shape(m, n, k, lda);
+    return scratchpad_sizes.get("dorgqr_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dorgqr_scratchpad_size_sycl(queue, m, n, k, lda);
+        });
+    });
 }
 template <>
 std::int64_t ormrq_scratchpad_size<float>(oneapi::mkl::device libkey,
@@ -2305,8 +5545,12 @@ std::int64_t ormrq_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                         std::int64_t m, std::int64_t n,
                                                         std::int64_t k, std::int64_t lda,
                                                         std::int64_t ldc) {
-    return function_tables[libkey].sormrq_scratchpad_size_sycl(queue, side, trans, m, n, k, lda,
-                                                               ldc);
+    auto shape = make_shape(side, trans, m, n, k, lda, ldc);
+    return scratchpad_sizes.get("sormrq_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sormrq_scratchpad_size_sycl(queue, side, trans, m, n, k, lda, ldc);
+        });
+    });
 }
 template <>
 std::int64_t ormrq_scratchpad_size<double>(oneapi::mkl::device libkey,
@@ -2315,8 +5559,12 @@ std::int64_t ormrq_scratchpad_size<double>(oneapi::mkl::device libkey,
                                                          std::int64_t m, std::int64_t n,
                                                          std::int64_t k, std::int64_t lda,
                                                          std::int64_t ldc) {
-    return function_tables[libkey].dormrq_scratchpad_size_sycl(queue, side, trans, m, n, k, lda,
-                                                               ldc);
+    auto shape = make_shape(side, trans, m, n, k, lda, ldc);
+    return scratchpad_sizes.get("dormrq_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dormrq_scratchpad_size_sycl(queue, side, trans, m, n, k, lda, ldc);
+        });
+    });
 }
 template <>
 std::int64_t ormqr_scratchpad_size<float>(oneapi::mkl::device libkey,
@@ -2325,8 +5573,12 @@ std::int64_t ormqr_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                         std::int64_t m, std::int64_t n,
                                                         std::int64_t k, std::int64_t lda,
                                                         std::int64_t ldc) {
-    return function_tables[libkey].sormqr_scratchpad_size_sycl(queue, side, trans, m, n, k, lda,
-                                                               ldc);
+    auto shape = make_shape(side, trans, m, n, k, lda, ldc);
+    return scratchpad_sizes.get("sormqr_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sormqr_scratchpad_size_sycl(queue, side, trans, m, n, k, lda, ldc);
+        });
+    });
 }
 template <>
 std::int64_t ormqr_scratchpad_size<double>(oneapi::mkl::device libkey,
@@ -2335,8 +5587,12 @@ std::int64_t ormqr_scratchpad_size<double>(oneapi::mkl::device libkey,
                                                          std::int64_t m, std::int64_t n,
                                                          std::int64_t k, std::int64_t lda,
                                                          std::int64_t ldc) {
-    return function_tables[libkey].dormqr_scratchpad_size_sycl(queue, side, trans, m, n, k, lda,
-                                                               ldc);
+    auto shape = make_shape(side, trans, m, n, k, lda, ldc);
+    return scratchpad_sizes.get("dormqr_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dormqr_scratchpad_size_sycl(queue, side, trans, m, n, k, lda, ldc);
+        });
+    });
 }
 template <>
 std::int64_t ormtr_scratchpad_size<float>(oneapi::mkl::device libkey,
@@ -2345,8 +5601,12 @@ std::int64_t ormtr_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                         oneapi::mkl::transpose trans,
                                                         std::int64_t m, std::int64_t n,
                                                         std::int64_t lda, std::int64_t ldc) {
-    return function_tables[libkey].sormtr_scratchpad_size_sycl(queue, side, uplo, trans, m, n, lda,
-                                                               ldc);
+    auto shape = make_shape(side, uplo, trans, m, n, lda, ldc);
+    return scratchpad_sizes.get("sormtr_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sormtr_scratchpad_size_sycl(queue, side, uplo, trans, m, n, lda, ldc);
+        });
+    });
 }
 template <>
 std::int64_t ormtr_scratchpad_size<double>(oneapi::mkl::device libkey,
@@ -2355,20 +5615,34 @@ std::int64_t ormtr_scratchpad_size<double>(oneapi::mkl::device libkey,
                                                          oneapi::mkl::transpose trans,
                                                          std::int64_t m, std::int64_t n,
                                                          std::int64_t lda, std::int64_t ldc) {
-    return function_tables[libkey].dormtr_scratchpad_size_sycl(queue, side, uplo, trans, m, n, lda,
-                                                               ldc);
+    auto shape = make_shape(side, uplo, trans, m, n, lda, ldc);
+    return scratchpad_sizes.get("dormtr_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dormtr_scratchpad_size_sycl(queue, side, uplo, trans, m, n, lda, ldc);
+        });
+    });
 }
 template <>
 std::int64_t potrf_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                         sycl::queue &queue, oneapi::mkl::uplo uplo,
                                                         std::int64_t n, std::int64_t lda) {
-    return function_tables[libkey].spotrf_scratchpad_size_sycl(queue, uplo, n, lda);
+    auto shape = make_shape(uplo, n, lda);
+    return scratchpad_sizes.get("spotrf_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.spotrf_scratchpad_size_sycl(queue, uplo, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t potrf_scratchpad_size<double>(oneapi::mkl::device libkey,
                                                          sycl::queue &queue, oneapi::mkl::uplo uplo,
                                                          std::int64_t n, std::int64_t lda) {
-    return function_tables[libkey].dpotrf_scratchpad_size_sycl(queue, uplo, n, lda);
+    auto shape = make_shape(uplo, n, lda);
+    return scratchpad_sizes.get("dpotrf_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dpotrf_scratchpad_size_sycl(queue, uplo, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t potrf_scratchpad_size<std::complex<float>>(oneapi::mkl::device libkey,
@@ -2376,7 +5650,12 @@ std::int64_t potrf_scratchpad_size<std::complex<float>>(oneapi::mkl::device libk
                                                                       oneapi::mkl::uplo uplo,
                                                                       std::int64_t n,
                                                                       std::int64_t lda) {
-    return function_tables[libkey].cpotrf_scratchpad_size_sycl(queue, uplo, n, lda);
+    auto shape = make_shape(uplo, n, lda);
+    return scratchpad_sizes.get("cpotrf_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cpotrf_scratchpad_size_sycl(queue, uplo, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t potrf_scratchpad_size<std::complex<double>>(oneapi::mkl::device libkey,
@@ -2384,45 +5663,126 @@ std::int64_t potrf_scratchpad_size<std::complex<double>>(oneapi::mkl::device lib
                                                                        oneapi::mkl::uplo uplo,
                                                                        std::int64_t n,
                                                                        std::int64_t lda) {
-    return function_tables[libkey].zpotrf_scratchpad_size_sycl(queue, uplo, n, lda);
+    auto shape = make_shape(uplo, n, lda);
+    return scratchpad_sizes.get("zpotrf_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zpotrf_scratchpad_size_sycl(queue, uplo, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t potrs_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                         sycl::queue &queue, oneapi::mkl::uplo uplo,
                                                         std::int64_t n, std::int64_t nrhs,
                                                         std::int64_t lda, std::int64_t ldb) {
-    return function_tables[libkey].spotrs_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, ldb);
+    auto shape = make_shape(uplo, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("spotrs_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.spotrs_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, ldb);
+        });
+    });
 }
 template <>
 std::int64_t potrs_scratchpad_size<double>(oneapi::mkl::device libkey,
                                                          sycl::queue &queue, oneapi::mkl::uplo uplo,
                                                          std::int64_t n, std::int64_t nrhs,
                                                          std::int64_t lda, std::int64_t ldb) {
-    return function_tables[libkey].dpotrs_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, ldb);
+    auto shape = make_shape(uplo, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("dpotrs_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dpotrs_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, ldb);
+        });
+    });
 }
 template <>
 std::int64_t potrs_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
     std::int64_t nrhs, std::int64_t lda, std::int64_t ldb) {
-    return function_tables[libkey].cpotrs_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, ldb);
+    auto shape = make_shape(uplo, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("cpotrs_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cpotrs_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, ldb);
+        });
+    });
 }
 template <>
 std::int64_t potrs_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
     std::int64_t nrhs, std::int64_t lda, std::int64_t ldb) {
-    return function_tables[libkey].zpotrs_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, ldb);
+    auto shape = make_shape(uplo, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("zpotrs_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zpotrs_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, ldb);
+        });
+    });
+}
+template <>
+std::int64_t posv_scratchpad_size<float>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                         oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                                         std::int64_t lda, std::int64_t ldb) {
+    auto shape = make_shape(uplo, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("sposv_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sposv_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, ldb);
+        });
+    });
+}
+template <>
+std::int64_t posv_scratchpad_size<double>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                          oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                                          std::int64_t lda, std::int64_t ldb) {
+    auto shape = make_shape(uplo, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("dposv_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dposv_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, ldb);
+        });
+    });
+}
+template <>
+std::int64_t posv_scratchpad_size<std::complex<float>>(oneapi::mkl::device libkey,
+                                                       sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                       std::int64_t n, std::int64_t nrhs,
+                                                       std::int64_t lda, std::int64_t ldb) {
+    auto shape = make_shape(uplo, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("cposv_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cposv_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, ldb);
+        });
+    });
+}
+template <>
+std::int64_t posv_scratchpad_size<std::complex<double>>(oneapi::mkl::device libkey,
+                                                        sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                        std::int64_t n, std::int64_t nrhs,
+                                                        std::int64_t lda, std::int64_t ldb) {
+    auto shape = make_shape(uplo, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("zposv_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zposv_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, ldb);
+        });
+    });
 }
 template <>
 std::int64_t potri_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                         sycl::queue &queue, oneapi::mkl::uplo uplo,
                                                         std::int64_t n, std::int64_t lda) {
-    return function_tables[libkey].spotri_scratchpad_size_sycl(queue, uplo, n, lda);
+    auto shape = make_shape(uplo, n, lda);
+    return scratchpad_sizes.get("spotri_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.spotri_scratchpad_size_sycl(queue, uplo, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t potri_scratchpad_size<double>(oneapi::mkl::device libkey,
                                                          sycl::queue &queue, oneapi::mkl::uplo uplo,
                                                          std::int64_t n, std::int64_t lda) {
-    return function_tables[libkey].dpotri_scratchpad_size_sycl(queue, uplo, n, lda);
+    auto shape = make_shape(uplo, n, lda);
+    return scratchpad_sizes.get("dpotri_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dpotri_scratchpad_size_sycl(queue, uplo, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t potri_scratchpad_size<std::complex<float>>(oneapi::mkl::device libkey,
@@ -2430,7 +5790,12 @@ std::int64_t potri_scratchpad_size<std::complex<float>>(oneapi::mkl::device libk
                                                                       oneapi::mkl::uplo uplo,
                                                                       std::int64_t n,
                                                                       std::int64_t lda) {
-    return function_tables[libkey].cpotri_scratchpad_size_sycl(queue, uplo, n, lda);
+    auto shape = make_shape(uplo, n, lda);
+    return scratchpad_sizes.get("cpotri_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cpotri_scratchpad_size_sycl(queue, uplo, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t potri_scratchpad_size<std::complex<double>>(oneapi::mkl::device libkey,
@@ -2438,19 +5803,34 @@ std::int64_t potri_scratchpad_size<std::complex<double>>(oneapi::mkl::device lib
                                                                        oneapi::mkl::uplo uplo,
                                                                        std::int64_t n,
                                                                        std::int64_t lda) {
-    return function_tables[libkey].zpotri_scratchpad_size_sycl(queue, uplo, n, lda);
+    auto shape = make_shape(uplo, n, lda);
+    return scratchpad_sizes.get("zpotri_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zpotri_scratchpad_size_sycl(queue, uplo, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t sytrf_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                         sycl::queue &queue, oneapi::mkl::uplo uplo,
                                                         std::int64_t n, std::int64_t lda) {
-    return function_tables[libkey].ssytrf_scratchpad_size_sycl(queue, uplo, n, lda);
+    auto shape = make_shape(uplo, n, lda);
+    return scratchpad_sizes.get("ssytrf_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.ssytrf_scratchpad_size_sycl(queue, uplo, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t sytrf_scratchpad_size<double>(oneapi::mkl::device libkey,
                                                          sycl::queue &queue, oneapi::mkl::uplo uplo,
                                                          std::int64_t n, std::int64_t lda) {
-    return function_tables[libkey].dsytrf_scratchpad_size_sycl(queue, uplo, n, lda);
+    auto shape = make_shape(uplo, n, lda);
+    return scratchpad_sizes.get("dsytrf_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dsytrf_scratchpad_size_sycl(queue, uplo, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t sytrf_scratchpad_size<std::complex<float>>(oneapi::mkl::device libkey,
@@ -2458,7 +5838,12 @@ std::int64_t sytrf_scratchpad_size<std::complex<float>>(oneapi::mkl::device libk
                                                                       oneapi::mkl::uplo uplo,
                                                                       std::int64_t n,
                                                                       std::int64_t lda) {
-    return function_tables[libkey].csytrf_scratchpad_size_sycl(queue, uplo, n, lda);
+    auto shape = make_shape(uplo, n, lda);
+    return scratchpad_sizes.get("csytrf_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.csytrf_scratchpad_size_sycl(queue, uplo, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t sytrf_scratchpad_size<std::complex<double>>(oneapi::mkl::device libkey,
@@ -2466,21 +5851,130 @@ std::int64_t sytrf_scratchpad_size<std::complex<double>>(oneapi::mkl::device lib
                                                                        oneapi::mkl::uplo uplo,
                                                                        std::int64_t n,
                                                                        std::int64_t lda) {
-    return function_tables[libkey].zsytrf_scratchpad_size_sycl(queue, uplo, n, lda);
+    auto shape = make_shape(uplo, n, lda);
+    return scratchpad_sizes.get("zsytrf_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zsytrf_scratchpad_size_sycl(queue, uplo, n, lda);
+        });
+    });
+}
+template <>
+std::int64_t sysv_scratchpad_size<float>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                         oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                                         std::int64_t lda, std::int64_t ldb) {
+    auto shape = make_shape(uplo, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("ssysv_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.ssysv_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, ldb);
+        });
+    });
+}
+template <>
+std::int64_t sysv_scratchpad_size<double>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                          oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t nrhs,
+                                          std::int64_t lda, std::int64_t ldb) {
+    auto shape = make_shape(uplo, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("dsysv_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dsysv_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, ldb);
+        });
+    });
+}
+template <>
+std::int64_t sysv_scratchpad_size<std::complex<float>>(oneapi::mkl::device libkey,
+                                                       sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                       std::int64_t n, std::int64_t nrhs,
+                                                       std::int64_t lda, std::int64_t ldb) {
+    auto shape = make_shape(uplo, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("csysv_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.csysv_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, ldb);
+        });
+    });
+}
+template <>
+std::int64_t sysv_scratchpad_size<std::complex<double>>(oneapi::mkl::device libkey,
+                                                        sycl::queue &queue, oneapi::mkl::uplo uplo,
+                                                        std::int64_t n, std::int64_t nrhs,
+                                                        std::int64_t lda, std::int64_t ldb) {
+    auto shape = make_shape(uplo, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("zsysv_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zsysv_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, ldb);
+        });
+    });
 }
 template <>
 std::int64_t syevd_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                         sycl::queue &queue, oneapi::mkl::job jobz,
                                                         oneapi::mkl::uplo uplo, std::int64_t n,
                                                         std::int64_t lda) {
-    return function_tables[libkey].ssyevd_scratchpad_size_sycl(queue, jobz, uplo, n, lda);
+    auto shape = make_shape(jobz, uplo, n, lda);
+    return scratchpad_sizes.get("ssyevd_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.ssyevd_scratchpad_size_sycl(queue, jobz, uplo, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t syevd_scratchpad_size<double>(oneapi::mkl::device libkey,
                                                          sycl::queue &queue, oneapi::mkl::job jobz,
                                                          oneapi::mkl::uplo uplo, std::int64_t n,
                                                          std::int64_t lda) {
-    return function_tables[libkey].dsyevd_scratchpad_size_sycl(queue, jobz, uplo, n, lda);
+    auto shape = make_shape(jobz, uplo, n, lda);
+    return scratchpad_sizes.get("dsyevd_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dsyevd_scratchpad_size_sycl(queue, jobz, uplo, n, lda);
+        });
+    });
+}
+template <>
+std::int64_t syevr_scratchpad_size<float>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                          oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                          oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                          std::int64_t ldz) {
+    auto shape = make_shape(jobz, range, uplo, n, lda, ldz);
+    return scratchpad_sizes.get("ssyevr_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.ssyevr_scratchpad_size_sycl(queue, jobz, range, uplo, n, lda, ldz);
+        });
+    });
+}
+template <>
+std::int64_t syevr_scratchpad_size<double>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                           oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                           oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                           std::int64_t ldz) {
+    auto shape = make_shape(jobz, range, uplo, n, lda, ldz);
+    return scratchpad_sizes.get("dsyevr_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dsyevr_scratchpad_size_sycl(queue, jobz, range, uplo, n, lda, ldz);
+        });
+    });
+}
+template <>
+std::int64_t syevx_scratchpad_size<float>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                          oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                          oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                          std::int64_t ldz) {
+    auto shape = make_shape(jobz, range, uplo, n, lda, ldz);
+    return scratchpad_sizes.get("ssyevx_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.ssyevx_scratchpad_size_sycl(queue, jobz, range, uplo, n, lda, ldz);
+        });
+    });
+}
+template <>
+std::int64_t syevx_scratchpad_size<double>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                           oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                                           oneapi::mkl::uplo uplo, std::int64_t n, std::int64_t lda,
+                                           std::int64_t ldz) {
+    auto shape = make_shape(jobz, range, uplo, n, lda, ldz);
+    return scratchpad_sizes.get("dsyevx_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dsyevx_scratchpad_size_sycl(queue, jobz, range, uplo, n, lda, ldz);
+        });
+    });
 }
 template <>
 std::int64_t sygvd_scratchpad_size<float>(oneapi::mkl::device libkey,
@@ -2488,8 +5982,12 @@ std::int64_t sygvd_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                         oneapi::mkl::job jobz,
                                                         oneapi::mkl::uplo uplo, std::int64_t n,
                                                         std::int64_t lda, std::int64_t ldb) {
-    return function_tables[libkey].ssygvd_scratchpad_size_sycl(queue, itype, jobz, uplo, n, lda,
-                                                               ldb);
+    auto shape = make_shape(itype, jobz, uplo, n, lda, ldb);
+    return scratchpad_sizes.get("ssygvd_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.ssygvd_scratchpad_size_sycl(queue, itype, jobz, uplo, n, lda, ldb);
+        });
+    });
 }
 template <>
 std::int64_t sygvd_scratchpad_size<double>(oneapi::mkl::device libkey,
@@ -2497,20 +5995,34 @@ std::int64_t sygvd_scratchpad_size<double>(oneapi::mkl::device libkey,
                                                          oneapi::mkl::job jobz,
                                                          oneapi::mkl::uplo uplo, std::int64_t n,
                                                          std::int64_t lda, std::int64_t ldb) {
-    return function_tables[libkey].dsygvd_scratchpad_size_sycl(queue, itype, jobz, uplo, n, lda,
-                                                               ldb);
+    auto shape = make_shape(itype, jobz, uplo, n, lda, ldb);
+    return scratchpad_sizes.get("dsygvd_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dsygvd_scratchpad_size_sycl(queue, itype, jobz, uplo, n, lda, ldb);
+        });
+    });
 }
 template <>
 std::int64_t sytrd_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                         sycl::queue &queue, oneapi::mkl::uplo uplo,
                                                         std::int64_t n, std::int64_t lda) {
-    return function_tables[libkey].ssytrd_scratchpad_size_sycl(queue, uplo, n, lda);
+    auto shape = make_shape(uplo, n, lda);
+    return scratchpad_sizes.get("ssytrd_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.ssytrd_scratchpad_size_sycl(queue, uplo, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t sytrd_scratchpad_size<double>(oneapi::mkl::device libkey,
                                                          sycl::queue &queue, oneapi::mkl::uplo uplo,
                                                          std::int64_t n, std::int64_t lda) {
-    return function_tables[libkey].dsytrd_scratchpad_size_sycl(queue, uplo, n, lda);
+    auto shape = make_shape(uplo, n, lda);
+    return scratchpad_sizes.get("dsytrd_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dsytrd_scratchpad_size_sycl(queue, uplo, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t trtrs_scratchpad_size<float>(oneapi::mkl::device libkey,
@@ -2519,8 +6031,12 @@ std::int64_t trtrs_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                         oneapi::mkl::diag diag, std::int64_t n,
                                                         std::int64_t nrhs, std::int64_t lda,
                                                         std::int64_t ldb) {
-    return function_tables[libkey].strtrs_scratchpad_size_sycl(queue, uplo, trans, diag, n, nrhs,
-                                                               lda, ldb);
+    auto shape = make_shape(uplo, trans, diag, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("strtrs_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.strtrs_scratchpad_size_sycl(queue, uplo, trans, diag, n, nrhs, lda, ldb);
+        });
+    });
 }
 template <>
 std::int64_t trtrs_scratchpad_size<double>(oneapi::mkl::device libkey,
@@ -2529,48 +6045,80 @@ std::int64_t trtrs_scratchpad_size<double>(oneapi::mkl::device libkey,
                                                          oneapi::mkl::diag diag, std::int64_t n,
                                                          std::int64_t nrhs, std::int64_t lda,
                                                          std::int64_t ldb) {
-    return function_tables[libkey].dtrtrs_scratchpad_size_sycl(queue, uplo, trans, diag, n, nrhs,
-                                                               lda, ldb);
+    auto shape = make_shape(uplo, trans, diag, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("dtrtrs_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dtrtrs_scratchpad_size_sycl(queue, uplo, trans, diag, n, nrhs, lda, ldb);
+        });
+    });
 }
 template <>
 std::int64_t trtrs_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
     oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs,
     std::int64_t lda, std::int64_t ldb) {
-    return function_tables[libkey].ctrtrs_scratchpad_size_sycl(queue, uplo, trans, diag, n, nrhs,
-                                                               lda, ldb);
+    auto shape = make_shape(uplo, trans, diag, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("ctrtrs_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.ctrtrs_scratchpad_size_sycl(queue, uplo, trans, diag, n, nrhs, lda, ldb);
+        });
+    });
 }
 template <>
 std::int64_t trtrs_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo,
     oneapi::mkl::transpose trans, oneapi::mkl::diag diag, std::int64_t n, std::int64_t nrhs,
     std::int64_t lda, std::int64_t ldb) {
-    return function_tables[libkey].ztrtrs_scratchpad_size_sycl(queue, uplo, trans, diag, n, nrhs,
-                                                               lda, ldb);
+    auto shape = make_shape(uplo, trans, diag, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("ztrtrs_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.ztrtrs_scratchpad_size_sycl(queue, uplo, trans, diag, n, nrhs, lda, ldb);
+        });
+    });
 }
 template <>
 std::int64_t ungbr_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::generate vect, std::int64_t m,
     std::int64_t n, std::int64_t k, std::int64_t lda) {
-    return function_tables[libkey].cungbr_scratchpad_size_sycl(queue, vect, m, n, k, lda);
+    auto shape = make_shape(vect, m, n, k, lda);
+    return scratchpad_sizes.get("cungbr_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cungbr_scratchpad_size_sycl(queue, vect, m, n, k, lda);
+        });
+    });
 }
 template <>
 std::int64_t ungbr_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::generate vect, std::int64_t m,
     std::int64_t n, std::int64_t k, std::int64_t lda) {
-    return function_tables[libkey].zungbr_scratchpad_size_sycl(queue, vect, m, n, k, lda);
+    auto shape = make_shape(vect, m, n, k, lda);
+    return scratchpad_sizes.get("zungbr_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zungbr_scratchpad_size_sycl(queue, vect, m, n, k, lda);
+        });
+    });
 }
 template <>
 std::int64_t ungqr_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
     std::int64_t lda) {
-    return function_tables[libkey].cungqr_scratchpad_size_sycl(queue, m, n, k, lda);
+    auto shape = make_shape(m, n, k, lda);
+    return scratchpad_sizes.get("cungqr_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cungqr_scratchpad_size_sycl(queue, m, n, k, lda);
+        });
+    });
 }
 template <>
 std::int64_t ungqr_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
     std::int64_t lda) {
-    return function_tables[libkey].zungqr_scratchpad_size_sycl(queue, m, n, k, lda);
+    auto shape = make_shape(m, n, k, lda);
+    return scratchpad_sizes.get("zungqr_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zungqr_scratchpad_size_sycl(queue, m, n, k, lda);
+        });
+    });
 }
 template <>
 std::int64_t ungtr_scratchpad_size<std::complex<float>>(oneapi::mkl::device libkey,
@@ -2578,7 +6126,12 @@ std::int64_t ungtr_scratchpad_size<std::complex<float>>(oneapi::mkl::device libk
                                                                       oneapi::mkl::uplo uplo,
                                                                       std::int64_t n,
                                                                       std::int64_t lda) {
-    return function_tables[libkey].cungtr_scratchpad_size_sycl(queue, uplo, n, lda);
+    auto shape = make_shape(uplo, n, lda);
+    return scratchpad_sizes.get("cungtr_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cungtr_scratchpad_size_sycl(queue, uplo, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t ungtr_scratchpad_size<std::complex<double>>(oneapi::mkl::device libkey,
@@ -2586,259 +6139,644 @@ std::int64_t ungtr_scratchpad_size<std::complex<double>>(oneapi::mkl::device lib
                                                                        oneapi::mkl::uplo uplo,
                                                                        std::int64_t n,
                                                                        std::int64_t lda) {
-    return function_tables[libkey].zungtr_scratchpad_size_sycl(queue, uplo, n, lda);
+    auto shape = make_shape(uplo, n, lda);
+    return scratchpad_sizes.get("zungtr_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zungtr_scratchpad_size_sycl(queue, uplo, n, lda);
+        });
+    });
 }
 template <>
 std::int64_t unmrq_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
     oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, std::int64_t k, std::int64_t lda,
     std::int64_t ldc) {
-    return function_tables[libkey].cunmrq_scratchpad_size_sycl(queue, side, trans, m, n, k, lda,
-                                                               ldc);
+    auto shape = make_shape(side, trans, m, n, k, lda, ldc);
+    return scratchpad_sizes.get("cunmrq_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cunmrq_scratchpad_size_sycl(queue, side, trans, m, n, k, lda, ldc);
+        });
+    });
 }
 template <>
 std::int64_t unmrq_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
     oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, std::int64_t k, std::int64_t lda,
     std::int64_t ldc) {
-    return function_tables[libkey].zunmrq_scratchpad_size_sycl(queue, side, trans, m, n, k, lda,
-                                                               ldc);
+    auto shape = make_shape(side, trans, m, n, k, lda, ldc);
+    return scratchpad_sizes.get("zunmrq_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zunmrq_scratchpad_size_sycl(queue, side, trans, m, n, k, lda, ldc);
+        });
+    });
 }
 template <>
 std::int64_t unmqr_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
     oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, std::int64_t k, std::int64_t lda,
     std::int64_t ldc) {
-    return function_tables[libkey].cunmqr_scratchpad_size_sycl(queue, side, trans, m, n, k, lda,
-                                                               ldc);
+    auto shape = make_shape(side, trans, m, n, k, lda, ldc);
+    return scratchpad_sizes.get("cunmqr_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cunmqr_scratchpad_size_sycl(queue, side, trans, m, n, k, lda, ldc);
+        });
+    });
 }
 template <>
 std::int64_t unmqr_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side,
     oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, std::int64_t k, std::int64_t lda,
     std::int64_t ldc) {
-    return function_tables[libkey].zunmqr_scratchpad_size_sycl(queue, side, trans, m, n, k, lda,
-                                                               ldc);
+    auto shape = make_shape(side, trans, m, n, k, lda, ldc);
+    return scratchpad_sizes.get("zunmqr_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zunmqr_scratchpad_size_sycl(queue, side, trans, m, n, k, lda, ldc);
+        });
+    });
 }
 template <>
 std::int64_t unmtr_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
     oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, std::int64_t lda,
     std::int64_t ldc) {
-    return function_tables[libkey].cunmtr_scratchpad_size_sycl(queue, side, uplo, trans, m, n, lda,
-                                                               ldc);
+    auto shape = make_shape(side, uplo, trans, m, n, lda, ldc);
+    return scratchpad_sizes.get("cunmtr_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cunmtr_scratchpad_size_sycl(queue, side, uplo, trans, m, n, lda, ldc);
+        });
+    });
 }
 template <>
 std::int64_t unmtr_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::side side, oneapi::mkl::uplo uplo,
     oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n, std::int64_t lda,
     std::int64_t ldc) {
-    return function_tables[libkey].zunmtr_scratchpad_size_sycl(queue, side, uplo, trans, m, n, lda,
-                                                               ldc);
+    auto shape = make_shape(side, uplo, trans, m, n, lda, ldc);
+    return scratchpad_sizes.get("zunmtr_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zunmtr_scratchpad_size_sycl(queue, side, uplo, trans, m, n, lda, ldc);
+        });
+    });
 }
 template <>
 std::int64_t getrf_batch_scratchpad_size<float>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
     std::int64_t lda, std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t batch_size) {
-    return function_tables[libkey].sgetrf_batch_scratchpad_size_sycl(queue, m, n, lda, stride_a,
-                                                                     stride_ipiv, batch_size);
+    auto shape = make_shape(m, n, lda, stride_a, stride_ipiv, batch_size);
+    return scratchpad_sizes.get("sgetrf_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sgetrf_batch_scratchpad_size_sycl(queue, m, n, lda, stride_a, stride_ipiv,
+                                                           batch_size);
+        });
+    });
 }
 template <>
 std::int64_t getrf_batch_scratchpad_size<double>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
     std::int64_t lda, std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t batch_size) {
-    return function_tables[libkey].dgetrf_batch_scratchpad_size_sycl(queue, m, n, lda, stride_a,
-                                                                     stride_ipiv, batch_size);
+    auto shape = make_shape(m, n, lda, stride_a, stride_ipiv, batch_size);
+    return scratchpad_sizes.get("dgetrf_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dgetrf_batch_scratchpad_size_sycl(queue, m, n, lda, stride_a, stride_ipiv,
+                                                           batch_size);
+        });
+    });
 }
 template <>
 std::int64_t getrf_batch_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
     std::int64_t lda, std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t batch_size) {
-    return function_tables[libkey].cgetrf_batch_scratchpad_size_sycl(queue, m, n, lda, stride_a,
-                                                                     stride_ipiv, batch_size);
+    auto shape = make_shape(m, n, lda, stride_a, stride_ipiv, batch_size);
+    return scratchpad_sizes.get("cgetrf_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cgetrf_batch_scratchpad_size_sycl(queue, m, n, lda, stride_a, stride_ipiv,
+                                                           batch_size);
+        });
+    });
 }
 template <>
 std::int64_t getrf_batch_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
     std::int64_t lda, std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t batch_size) {
-    return function_tables[libkey].zgetrf_batch_scratchpad_size_sycl(queue, m, n, lda, stride_a,
-                                                                     stride_ipiv, batch_size);
+    auto shape = make_shape(m, n, lda, stride_a, stride_ipiv, batch_size);
+    return scratchpad_sizes.get("zgetrf_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zgetrf_batch_scratchpad_size_sycl(queue, m, n, lda, stride_a, stride_ipiv,
+                                                           batch_size);
+        });
+    });
 }
 template <>
 std::int64_t getri_batch_scratchpad_size<float>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t lda,
     std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t batch_size) {
-    return function_tables[libkey].sgetri_batch_scratchpad_size_sycl(queue, n, lda, stride_a,
-                                                                     stride_ipiv, batch_size);
+    auto shape = make_shape(n, lda, stride_a, stride_ipiv, batch_size);
+    return scratchpad_sizes.get("sgetri_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sgetri_batch_scratchpad_size_sycl(queue, n, lda, stride_a, stride_ipiv,
+                                                           batch_size);
+        });
+    });
 }
 template <>
 std::int64_t getri_batch_scratchpad_size<double>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t lda,
     std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t batch_size) {
-    return function_tables[libkey].dgetri_batch_scratchpad_size_sycl(queue, n, lda, stride_a,
-                                                                     stride_ipiv, batch_size);
+    auto shape = make_shape(n, lda, stride_a, stride_ipiv, batch_size);
+    return scratchpad_sizes.get("dgetri_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dgetri_batch_scratchpad_size_sycl(queue, n, lda, stride_a, stride_ipiv,
+                                                           batch_size);
+        });
+    });
 }
 template <>
 std::int64_t getri_batch_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t lda,
     std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t batch_size) {
-    return function_tables[libkey].cgetri_batch_scratchpad_size_sycl(queue, n, lda, stride_a,
-                                                                     stride_ipiv, batch_size);
+    auto shape = make_shape(n, lda, stride_a, stride_ipiv, batch_size);
+    return scratchpad_sizes.get("cgetri_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cgetri_batch_scratchpad_size_sycl(queue, n, lda, stride_a, stride_ipiv,
+                                                           batch_size);
+        });
+    });
 }
 template <>
 std::int64_t getri_batch_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t lda,
     std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t batch_size) {
-    return function_tables[libkey].zgetri_batch_scratchpad_size_sycl(queue, n, lda, stride_a,
-                                                                     stride_ipiv, batch_size);
+    auto shape = make_shape(n, lda, stride_a, stride_ipiv, batch_size);
+    return scratchpad_sizes.get("zgetri_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zgetri_batch_scratchpad_size_sycl(queue, n, lda, stride_a, stride_ipiv,
+                                                           batch_size);
+        });
+    });
 }
 template <>
 std::int64_t getrs_batch_scratchpad_size<float>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
     std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_ipiv,
     std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
-    return function_tables[libkey].sgetrs_batch_scratchpad_size_sycl(
-        queue, trans, n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, batch_size);
+    auto shape = make_shape(trans, n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, batch_size);
+    return scratchpad_sizes.get("sgetrs_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sgetrs_batch_scratchpad_size_sycl(queue, trans, n, nrhs, lda, stride_a,
+                                                           stride_ipiv, ldb, stride_b, batch_size);
+        });
+    });
 }
 template <>
 std::int64_t getrs_batch_scratchpad_size<double>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
     std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_ipiv,
     std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
-    return function_tables[libkey].dgetrs_batch_scratchpad_size_sycl(
-        queue, trans, n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, batch_size);
+    auto shape = make_shape(trans, n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, batch_size);
+    return scratchpad_sizes.get("dgetrs_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dgetrs_batch_scratchpad_size_sycl(queue, trans, n, nrhs, lda, stride_a,
+                                                           stride_ipiv, ldb, stride_b, batch_size);
+        });
+    });
 }
 template <>
 std::int64_t getrs_batch_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
     std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_ipiv,
     std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
-    return function_tables[libkey].cgetrs_batch_scratchpad_size_sycl(
-        queue, trans, n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, batch_size);
+    auto shape = make_shape(trans, n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, batch_size);
+    return scratchpad_sizes.get("cgetrs_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cgetrs_batch_scratchpad_size_sycl(queue, trans, n, nrhs, lda, stride_a,
+                                                           stride_ipiv, ldb, stride_b, batch_size);
+        });
+    });
 }
 template <>
 std::int64_t getrs_batch_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t n,
     std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_ipiv,
     std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
-    return function_tables[libkey].zgetrs_batch_scratchpad_size_sycl(
-        queue, trans, n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, batch_size);
+    auto shape = make_shape(trans, n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, batch_size);
+    return scratchpad_sizes.get("zgetrs_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zgetrs_batch_scratchpad_size_sycl(queue, trans, n, nrhs, lda, stride_a,
+                                                           stride_ipiv, ldb, stride_b, batch_size);
+        });
+    });
+}
+template <>
+std::int64_t gesv_batch_scratchpad_size<float>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                               std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                               std::int64_t stride_a, std::int64_t stride_ipiv,
+                                               std::int64_t ldb, std::int64_t stride_b,
+                                               std::int64_t batch_size) {
+    auto shape = make_shape(n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, batch_size);
+    return scratchpad_sizes.get("sgesv_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sgesv_batch_scratchpad_size_sycl(queue, n, nrhs, lda, stride_a,
+                                                          stride_ipiv, ldb, stride_b, batch_size);
+        });
+    });
+}
+template <>
+std::int64_t gesv_batch_scratchpad_size<double>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                                std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                                std::int64_t stride_a, std::int64_t stride_ipiv,
+                                                std::int64_t ldb, std::int64_t stride_b,
+                                                std::int64_t batch_size) {
+    auto shape = make_shape(n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, batch_size);
+    return scratchpad_sizes.get("dgesv_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dgesv_batch_scratchpad_size_sycl(queue, n, nrhs, lda, stride_a,
+                                                          stride_ipiv, ldb, stride_b, batch_size);
+        });
+    });
+}
+template <>
+std::int64_t gesv_batch_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size) {
+    auto shape = make_shape(n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, batch_size);
+    return scratchpad_sizes.get("cgesv_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cgesv_batch_scratchpad_size_sycl(queue, n, nrhs, lda, stride_a,
+                                                          stride_ipiv, ldb, stride_b, batch_size);
+        });
+    });
+}
+template <>
+std::int64_t gesv_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::int64_t nrhs,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t stride_ipiv, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size) {
+    auto shape = make_shape(n, nrhs, lda, stride_a, stride_ipiv, ldb, stride_b, batch_size);
+    return scratchpad_sizes.get("zgesv_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zgesv_batch_scratchpad_size_sycl(queue, n, nrhs, lda, stride_a,
+                                                          stride_ipiv, ldb, stride_b, batch_size);
+        });
+    });
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<float>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                               oneapi::mkl::transpose trans, std::int64_t m,
+                                               std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                               std::int64_t stride_a, std::int64_t ldb,
+                                               std::int64_t stride_b, std::int64_t batch_size) {
+    auto shape = make_shape(trans, m, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    return scratchpad_sizes.get("sgels_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sgels_batch_scratchpad_size_sycl(queue, trans, m, n, nrhs, lda, stride_a,
+                                                          ldb, stride_b, batch_size);
+        });
+    });
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<double>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                                oneapi::mkl::transpose trans, std::int64_t m,
+                                                std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                                std::int64_t stride_a, std::int64_t ldb,
+                                                std::int64_t stride_b, std::int64_t batch_size) {
+    auto shape = make_shape(trans, m, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    return scratchpad_sizes.get("dgels_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dgels_batch_scratchpad_size_sycl(queue, trans, m, n, nrhs, lda, stride_a,
+                                                          ldb, stride_b, batch_size);
+        });
+    });
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size) {
+    auto shape = make_shape(trans, m, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    return scratchpad_sizes.get("cgels_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cgels_batch_scratchpad_size_sycl(queue, trans, m, n, nrhs, lda, stride_a,
+                                                          ldb, stride_b, batch_size);
+        });
+    });
+}
+template <>
+std::int64_t gels_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size) {
+    auto shape = make_shape(trans, m, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    return scratchpad_sizes.get("zgels_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zgels_batch_scratchpad_size_sycl(queue, trans, m, n, nrhs, lda, stride_a,
+                                                          ldb, stride_b, batch_size);
+        });
+    });
+}
+template <>
+std::int64_t heevd_batch_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t batch_size) {
+    auto shape = make_shape(jobz, uplo, n, lda, stride_a, stride_w, batch_size);
+    return scratchpad_sizes.get("cheevd_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cheevd_batch_scratchpad_size_sycl(queue, jobz, uplo, n, lda, stride_a,
+                                                           stride_w, batch_size);
+        });
+    });
+}
+template <>
+std::int64_t heevd_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+    std::int64_t n, std::int64_t lda, std::int64_t stride_a, std::int64_t stride_w,
+    std::int64_t batch_size) {
+    auto shape = make_shape(jobz, uplo, n, lda, stride_a, stride_w, batch_size);
+    return scratchpad_sizes.get("zheevd_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zheevd_batch_scratchpad_size_sycl(queue, jobz, uplo, n, lda, stride_a,
+                                                           stride_w, batch_size);
+        });
+    });
 }
 template <>
 std::int64_t geqrf_batch_scratchpad_size<float>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
     std::int64_t lda, std::int64_t stride_a, std::int64_t stride_tau, std::int64_t batch_size) {
-    return function_tables[libkey].sgeqrf_batch_scratchpad_size_sycl(queue, m, n, lda, stride_a,
-                                                                     stride_tau, batch_size);
+    auto shape = make_shape(m, n, lda, stride_a, stride_tau, batch_size);
+    return scratchpad_sizes.get("sgeqrf_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sgeqrf_batch_scratchpad_size_sycl(queue, m, n, lda, stride_a, stride_tau,
+                                                           batch_size);
+        });
+    });
 }
 template <>
 std::int64_t geqrf_batch_scratchpad_size<double>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
     std::int64_t lda, std::int64_t stride_a, std::int64_t stride_tau, std::int64_t batch_size) {
-    return function_tables[libkey].dgeqrf_batch_scratchpad_size_sycl(queue, m, n, lda, stride_a,
-                                                                     stride_tau, batch_size);
+    auto shape = make_shape(m, n, lda, stride_a, stride_tau, batch_size);
+    return scratchpad_sizes.get("dgeqrf_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dgeqrf_batch_scratchpad_size_sycl(queue, m, n, lda, stride_a, stride_tau,
+                                                           batch_size);
+        });
+    });
 }
 template <>
 std::int64_t geqrf_batch_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
     std::int64_t lda, std::int64_t stride_a, std::int64_t stride_tau, std::int64_t batch_size) {
-    return function_tables[libkey].cgeqrf_batch_scratchpad_size_sycl(queue, m, n, lda, stride_a,
-                                                                     stride_tau, batch_size);
+    auto shape = make_shape(m, n, lda, stride_a, stride_tau, batch_size);
+    return scratchpad_sizes.get("cgeqrf_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cgeqrf_batch_scratchpad_size_sycl(queue, m, n, lda, stride_a, stride_tau,
+                                                           batch_size);
+        });
+    });
 }
 template <>
 std::int64_t geqrf_batch_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
     std::int64_t lda, std::int64_t stride_a, std::int64_t stride_tau, std::int64_t batch_size) {
-    return function_tables[libkey].zgeqrf_batch_scratchpad_size_sycl(queue, m, n, lda, stride_a,
-                                                                     stride_tau, batch_size);
+    auto shape = make_shape(m, n, lda, stride_a, stride_tau, batch_size);
+    return scratchpad_sizes.get("zgeqrf_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zgeqrf_batch_scratchpad_size_sycl(queue, m, n, lda, stride_a, stride_tau,
+                                                           batch_size);
+        });
+    });
 }
 template <>
 std::int64_t potrf_batch_scratchpad_size<float>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
     std::int64_t lda, std::int64_t stride_a, std::int64_t batch_size) {
-    return function_tables[libkey].spotrf_batch_scratchpad_size_sycl(queue, uplo, n, lda, stride_a,
-                                                                     batch_size);
+    auto shape = make_shape(uplo, n, lda, stride_a, batch_size);
+    return scratchpad_sizes.get("spotrf_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.spotrf_batch_scratchpad_size_sycl(queue, uplo, n, lda, stride_a,
+                                                           batch_size);
+        });
+    });
 }
 template <>
 std::int64_t potrf_batch_scratchpad_size<double>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
     std::int64_t lda, std::int64_t stride_a, std::int64_t batch_size) {
-    return function_tables[libkey].dpotrf_batch_scratchpad_size_sycl(queue, uplo, n, lda, stride_a,
-                                                                     batch_size);
+    auto shape = make_shape(uplo, n, lda, stride_a, batch_size);
+    return scratchpad_sizes.get("dpotrf_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dpotrf_batch_scratchpad_size_sycl(queue, uplo, n, lda, stride_a,
+                                                           batch_size);
+        });
+    });
 }
 template <>
 std::int64_t potrf_batch_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
     std::int64_t lda, std::int64_t stride_a, std::int64_t batch_size) {
-    return function_tables[libkey].cpotrf_batch_scratchpad_size_sycl(queue, uplo, n, lda, stride_a,
-                                                                     batch_size);
+    auto shape = make_shape(uplo, n, lda, stride_a, batch_size);
+    return scratchpad_sizes.get("cpotrf_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cpotrf_batch_scratchpad_size_sycl(queue, uplo, n, lda, stride_a,
+                                                           batch_size);
+        });
+    });
 }
 template <>
 std::int64_t potrf_batch_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
     std::int64_t lda, std::int64_t stride_a, std::int64_t batch_size) {
-    return function_tables[libkey].zpotrf_batch_scratchpad_size_sycl(queue, uplo, n, lda, stride_a,
-                                                                     batch_size);
+    auto shape = make_shape(uplo, n, lda, stride_a, batch_size);
+    return scratchpad_sizes.get("zpotrf_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zpotrf_batch_scratchpad_size_sycl(queue, uplo, n, lda, stride_a,
+                                                           batch_size);
+        });
+    });
 }
 template <>
 std::int64_t potrs_batch_scratchpad_size<float>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
     std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
     std::int64_t stride_b, std::int64_t batch_size) {
-    return function_tables[libkey].spotrs_batch_scratchpad_size_sycl(
-        queue, uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    auto shape = make_shape(uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    return scratchpad_sizes.get("spotrs_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.spotrs_batch_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, stride_a, ldb,
+                                                           stride_b, batch_size);
+        });
+    });
 }
 template <>
 std::int64_t potrs_batch_scratchpad_size<double>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
     std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
     std::int64_t stride_b, std::int64_t batch_size) {
-    return function_tables[libkey].dpotrs_batch_scratchpad_size_sycl(
-        queue, uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    auto shape = make_shape(uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    return scratchpad_sizes.get("dpotrs_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dpotrs_batch_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, stride_a, ldb,
+                                                           stride_b, batch_size);
+        });
+    });
 }
 template <>
 std::int64_t potrs_batch_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
     std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
     std::int64_t stride_b, std::int64_t batch_size) {
-    return function_tables[libkey].cpotrs_batch_scratchpad_size_sycl(
-        queue, uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    auto shape = make_shape(uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    return scratchpad_sizes.get("cpotrs_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cpotrs_batch_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, stride_a, ldb,
+                                                           stride_b, batch_size);
+        });
+    });
 }
 template <>
 std::int64_t potrs_batch_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
     std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
     std::int64_t stride_b, std::int64_t batch_size) {
-    return function_tables[libkey].zpotrs_batch_scratchpad_size_sycl(
-        queue, uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    auto shape = make_shape(uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    return scratchpad_sizes.get("zpotrs_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zpotrs_batch_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, stride_a, ldb,
+                                                           stride_b, batch_size);
+        });
+    });
+}
+template <>
+std::int64_t posv_batch_scratchpad_size<float>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                               oneapi::mkl::uplo uplo, std::int64_t n,
+                                               std::int64_t nrhs, std::int64_t lda,
+                                               std::int64_t stride_a, std::int64_t ldb,
+                                               std::int64_t stride_b, std::int64_t batch_size) {
+    auto shape = make_shape(uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    return scratchpad_sizes.get("sposv_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sposv_batch_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, stride_a, ldb,
+                                                          stride_b, batch_size);
+        });
+    });
+}
+template <>
+std::int64_t posv_batch_scratchpad_size<double>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                                oneapi::mkl::uplo uplo, std::int64_t n,
+                                                std::int64_t nrhs, std::int64_t lda,
+                                                std::int64_t stride_a, std::int64_t ldb,
+                                                std::int64_t stride_b, std::int64_t batch_size) {
+    auto shape = make_shape(uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    return scratchpad_sizes.get("dposv_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dposv_batch_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, stride_a, ldb,
+                                                          stride_b, batch_size);
+        });
+    });
+}
+template <>
+std::int64_t posv_batch_scratchpad_size<std::complex<float>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size) {
+    auto shape = make_shape(uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    return scratchpad_sizes.get("cposv_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cposv_batch_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, stride_a, ldb,
+                                                          stride_b, batch_size);
+        });
+    });
+}
+template <>
+std::int64_t posv_batch_scratchpad_size<std::complex<double>>(
+    oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo uplo, std::int64_t n,
+    std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a, std::int64_t ldb,
+    std::int64_t stride_b, std::int64_t batch_size) {
+    auto shape = make_shape(uplo, n, nrhs, lda, stride_a, ldb, stride_b, batch_size);
+    return scratchpad_sizes.get("zposv_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zposv_batch_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, stride_a, ldb,
+                                                          stride_b, batch_size);
+        });
+    });
+}
+template <>
+std::int64_t syevd_batch_scratchpad_size<float>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                                oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                                                std::int64_t n, std::int64_t lda,
+                                                std::int64_t stride_a, std::int64_t stride_w,
+                                                std::int64_t batch_size) {
+    auto shape = make_shape(jobz, uplo, n, lda, stride_a, stride_w, batch_size);
+    return scratchpad_sizes.get("ssyevd_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.ssyevd_batch_scratchpad_size_sycl(queue, jobz, uplo, n, lda, stride_a,
+                                                           stride_w, batch_size);
+        });
+    });
+}
+template <>
+std::int64_t syevd_batch_scratchpad_size<double>(oneapi::mkl::device libkey, sycl::queue &queue,
+                                                 oneapi::mkl::job jobz, oneapi::mkl::uplo uplo,
+                                                 std::int64_t n, std::int64_t lda,
+                                                 std::int64_t stride_a, std::int64_t stride_w,
+                                                 std::int64_t batch_size) {
+    auto shape = make_shape(jobz, uplo, n, lda, stride_a, stride_w, batch_size);
+    return scratchpad_sizes.get("dsyevd_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dsyevd_batch_scratchpad_size_sycl(queue, jobz, uplo, n, lda, stride_a,
+                                                           stride_w, batch_size);
+        });
+    });
 }
 template <>
 std::int64_t orgqr_batch_scratchpad_size<float>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
     std::int64_t lda, std::int64_t stride_a, std::int64_t stride_tau, std::int64_t batch_size) {
-    return function_tables[libkey].sorgqr_batch_scratchpad_size_sycl(queue, m, n, k, lda, stride_a,
-                                                                     stride_tau, batch_size);
+    auto shape = make_shape(m, n, k, lda, stride_a, stride_tau, batch_size);
+    return scratchpad_sizes.get("sorgqr_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sorgqr_batch_scratchpad_size_sycl(queue, m, n, k, lda, stride_a,
+                                                           stride_tau, batch_size);
+        });
+    });
 }
 template <>
 std::int64_t orgqr_batch_scratchpad_size<double>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
     std::int64_t lda, std::int64_t stride_a, std::int64_t stride_tau, std::int64_t batch_size) {
-    return function_tables[libkey].dorgqr_batch_scratchpad_size_sycl(queue, m, n, k, lda, stride_a,
-                                                                     stride_tau, batch_size);
+    auto shape = make_shape(m, n, k, lda, stride_a, stride_tau, batch_size);
+    return scratchpad_sizes.get("dorgqr_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dorgqr_batch_scratchpad_size_sycl(queue, m, n, k, lda, stride_a,
+                                                           stride_tau, batch_size);
+        });
+    });
 }
 template <>
 std::int64_t ungqr_batch_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
     std::int64_t lda, std::int64_t stride_a, std::int64_t stride_tau, std::int64_t batch_size) {
-    return function_tables[libkey].cungqr_batch_scratchpad_size_sycl(queue, m, n, k, lda, stride_a,
-                                                                     stride_tau, batch_size);
+    auto shape = make_shape(m, n, k, lda, stride_a, stride_tau, batch_size);
+    return scratchpad_sizes.get("cungqr_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cungqr_batch_scratchpad_size_sycl(queue, m, n, k, lda, stride_a,
+                                                           stride_tau, batch_size);
+        });
+    });
 }
 template <>
 std::int64_t ungqr_batch_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k,
     std::int64_t lda, std::int64_t stride_a, std::int64_t stride_tau, std::int64_t batch_size) {
-    return function_tables[libkey].zungqr_batch_scratchpad_size_sycl(queue, m, n, k, lda, stride_a,
-                                                                     stride_tau, batch_size);
+    auto shape = make_shape(m, n, k, lda, stride_a, stride_tau, batch_size);
+    return scratchpad_sizes.get("zungqr_batch_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zungqr_batch_scratchpad_size_sycl(queue, m, n, k, lda, stride_a,
+                                                           stride_tau, batch_size);
+        });
+    });
 }
 template <>
 std::int64_t getrf_batch_scratchpad_size<float>(oneapi::mkl::device libkey,
@@ -2846,8 +6784,13 @@ std::int64_t getrf_batch_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                               std::int64_t *n, std::int64_t *lda,
                                                               std::int64_t group_count,
                                                               std::int64_t *group_sizes) {
-    return function_tables[libkey].sgetrf_group_scratchpad_size_sycl(queue, m, n, lda, group_count,
-                                                                     group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, m, n, lda);
+    return scratchpad_sizes.get("sgetrf_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sgetrf_group_scratchpad_size_sycl(queue, m, n, lda, group_count,
+                                                           group_sizes);
+        });
+    });
 }
 template <>
 std::int64_t getrf_batch_scratchpad_size<double>(oneapi::mkl::device libkey,
@@ -2855,22 +6798,37 @@ std::int64_t getrf_batch_scratchpad_size<double>(oneapi::mkl::device libkey,
                                                                std::int64_t *n, std::int64_t *lda,
                                                                std::int64_t group_count,
                                                                std::int64_t *group_sizes) {
-    return function_tables[libkey].dgetrf_group_scratchpad_size_sycl(queue, m, n, lda, group_count,
-                                                                     group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, m, n, lda);
+    return scratchpad_sizes.get("dgetrf_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dgetrf_group_scratchpad_size_sycl(queue, m, n, lda, group_count,
+                                                           group_sizes);
+        });
+    });
 }
 template <>
 std::int64_t getrf_batch_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *m, std::int64_t *n,
     std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {
-    return function_tables[libkey].cgetrf_group_scratchpad_size_sycl(queue, m, n, lda, group_count,
-                                                                     group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, m, n, lda);
+    return scratchpad_sizes.get("cgetrf_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cgetrf_group_scratchpad_size_sycl(queue, m, n, lda, group_count,
+                                                           group_sizes);
+        });
+    });
 }
 template <>
 std::int64_t getrf_batch_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *m, std::int64_t *n,
     std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {
-    return function_tables[libkey].zgetrf_group_scratchpad_size_sycl(queue, m, n, lda, group_count,
-                                                                     group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, m, n, lda);
+    return scratchpad_sizes.get("zgetrf_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zgetrf_group_scratchpad_size_sycl(queue, m, n, lda, group_count,
+                                                           group_sizes);
+        });
+    });
 }
 template <>
 std::int64_t getri_batch_scratchpad_size<float>(oneapi::mkl::device libkey,
@@ -2878,8 +6836,12 @@ std::int64_t getri_batch_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                               std::int64_t *lda,
                                                               std::int64_t group_count,
                                                               std::int64_t *group_sizes) {
-    return function_tables[libkey].sgetri_group_scratchpad_size_sycl(queue, n, lda, group_count,
-                                                                     group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, n, lda);
+    return scratchpad_sizes.get("sgetri_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sgetri_group_scratchpad_size_sycl(queue, n, lda, group_count, group_sizes);
+        });
+    });
 }
 template <>
 std::int64_t getri_batch_scratchpad_size<double>(oneapi::mkl::device libkey,
@@ -2887,54 +6849,86 @@ std::int64_t getri_batch_scratchpad_size<double>(oneapi::mkl::device libkey,
                                                                std::int64_t *lda,
                                                                std::int64_t group_count,
                                                                std::int64_t *group_sizes) {
-    return function_tables[libkey].dgetri_group_scratchpad_size_sycl(queue, n, lda, group_count,
-                                                                     group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, n, lda);
+    return scratchpad_sizes.get("dgetri_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dgetri_group_scratchpad_size_sycl(queue, n, lda, group_count, group_sizes);
+        });
+    });
 }
 template <>
 std::int64_t getri_batch_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n, std::int64_t *lda,
     std::int64_t group_count, std::int64_t *group_sizes) {
-    return function_tables[libkey].cgetri_group_scratchpad_size_sycl(queue, n, lda, group_count,
-                                                                     group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, n, lda);
+    return scratchpad_sizes.get("cgetri_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cgetri_group_scratchpad_size_sycl(queue, n, lda, group_count, group_sizes);
+        });
+    });
 }
 template <>
 std::int64_t getri_batch_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n, std::int64_t *lda,
     std::int64_t group_count, std::int64_t *group_sizes) {
-    return function_tables[libkey].zgetri_group_scratchpad_size_sycl(queue, n, lda, group_count,
-                                                                     group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, n, lda);
+    return scratchpad_sizes.get("zgetri_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zgetri_group_scratchpad_size_sycl(queue, n, lda, group_count, group_sizes);
+        });
+    });
 }
 template <>
 std::int64_t getrs_batch_scratchpad_size<float>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *n,
     std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb, std::int64_t group_count,
     std::int64_t *group_sizes) {
-    return function_tables[libkey].sgetrs_group_scratchpad_size_sycl(queue, trans, n, nrhs, lda,
-                                                                     ldb, group_count, group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, trans, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("sgetrs_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sgetrs_group_scratchpad_size_sycl(queue, trans, n, nrhs, lda, ldb,
+                                                           group_count, group_sizes);
+        });
+    });
 }
 template <>
 std::int64_t getrs_batch_scratchpad_size<double>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *n,
     std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb, std::int64_t group_count,
     std::int64_t *group_sizes) {
-    return function_tables[libkey].dgetrs_group_scratchpad_size_sycl(queue, trans, n, nrhs, lda,
-                                                                     ldb, group_count, group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, trans, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("dgetrs_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dgetrs_group_scratchpad_size_sycl(queue, trans, n, nrhs, lda, ldb,
+                                                           group_count, group_sizes);
+        });
+    });
 }
 template <>
 std::int64_t getrs_batch_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *n,
     std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb, std::int64_t group_count,
     std::int64_t *group_sizes) {
-    return function_tables[libkey].cgetrs_group_scratchpad_size_sycl(queue, trans, n, nrhs, lda,
-                                                                     ldb, group_count, group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, trans, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("cgetrs_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cgetrs_group_scratchpad_size_sycl(queue, trans, n, nrhs, lda, ldb,
+                                                           group_count, group_sizes);
+        });
+    });
 }
 template <>
 std::int64_t getrs_batch_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::transpose *trans, std::int64_t *n,
     std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb, std::int64_t group_count,
     std::int64_t *group_sizes) {
-    return function_tables[libkey].zgetrs_group_scratchpad_size_sycl(queue, trans, n, nrhs, lda,
-                                                                     ldb, group_count, group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, trans, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("zgetrs_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zgetrs_group_scratchpad_size_sycl(queue, trans, n, nrhs, lda, ldb,
+                                                           group_count, group_sizes);
+        });
+    });
 }
 template <>
 std::int64_t geqrf_batch_scratchpad_size<float>(oneapi::mkl::device libkey,
@@ -2942,8 +6936,13 @@ std::int64_t geqrf_batch_scratchpad_size<float>(oneapi::mkl::device libkey,
                                                               std::int64_t *n, std::int64_t *lda,
                                                               std::int64_t group_count,
                                                               std::int64_t *group_sizes) {
-    return function_tables[libkey].sgeqrf_group_scratchpad_size_sycl(queue, m, n, lda, group_count,
-                                                                     group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, m, n, lda);
+    return scratchpad_sizes.get("sgeqrf_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sgeqrf_group_scratchpad_size_sycl(queue, m, n, lda, group_count,
+                                                           group_sizes);
+        });
+    });
 }
 template <>
 std::int64_t geqrf_batch_scratchpad_size<double>(oneapi::mkl::device libkey,
@@ -2951,113 +6950,201 @@ std::int64_t geqrf_batch_scratchpad_size<double>(oneapi::mkl::device libkey,
                                                                std::int64_t *n, std::int64_t *lda,
                                                                std::int64_t group_count,
                                                                std::int64_t *group_sizes) {
-    return function_tables[libkey].dgeqrf_group_scratchpad_size_sycl(queue, m, n, lda, group_count,
-                                                                     group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, m, n, lda);
+    return scratchpad_sizes.get("dgeqrf_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dgeqrf_group_scratchpad_size_sycl(queue, m, n, lda, group_count,
+                                                           group_sizes);
+        });
+    });
 }
 template <>
 std::int64_t geqrf_batch_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *m, std::int64_t *n,
     std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {
-    return function_tables[libkey].cgeqrf_group_scratchpad_size_sycl(queue, m, n, lda, group_count,
-                                                                     group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, m, n, lda);
+    return scratchpad_sizes.get("cgeqrf_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cgeqrf_group_scratchpad_size_sycl(queue, m, n, lda, group_count,
+                                                           group_sizes);
+        });
+    });
 }
 template <>
 std::int64_t geqrf_batch_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *m, std::int64_t *n,
     std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {
-    return function_tables[libkey].zgeqrf_group_scratchpad_size_sycl(queue, m, n, lda, group_count,
-                                                                     group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, m, n, lda);
+    return scratchpad_sizes.get("zgeqrf_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zgeqrf_group_scratchpad_size_sycl(queue, m, n, lda, group_count,
+                                                           group_sizes);
+        });
+    });
 }
 template <>
 std::int64_t orgqr_batch_scratchpad_size<float>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *m, std::int64_t *n,
     std::int64_t *k, std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {
-    return function_tables[libkey].sorgqr_group_scratchpad_size_sycl(queue, m, n, k, lda,
-                                                                     group_count, group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, m, n, k, lda);
+    return scratchpad_sizes.get("sorgqr_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.sorgqr_group_scratchpad_size_sycl(queue, m, n, k, lda, group_count,
+                                                           group_sizes);
+        });
+    });
 }
 template <>
 std::int64_t orgqr_batch_scratchpad_size<double>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *m, std::int64_t *n,
     std::int64_t *k, std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {
-    return function_tables[libkey].dorgqr_group_scratchpad_size_sycl(queue, m, n, k, lda,
-                                                                     group_count, group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, m, n, k, lda);
+    return scratchpad_sizes.get("dorgqr_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dorgqr_group_scratchpad_size_sycl(queue, m, n, k, lda, group_count,
+                                                           group_sizes);
+        });
+    });
 }
 template <>
 std::int64_t potrf_batch_scratchpad_size<float>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
     std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {
-    return function_tables[libkey].spotrf_group_scratchpad_size_sycl(queue, uplo, n, lda,
-                                                                     group_count, group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, uplo, n, lda);
+    return scratchpad_sizes.get("spotrf_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.spotrf_group_scratchpad_size_sycl(queue, uplo, n, lda, group_count,
+                                                           group_sizes);
+        });
+    });
 }
 template <>
 std::int64_t potrf_batch_scratchpad_size<double>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
     std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {
-    return function_tables[libkey].dpotrf_group_scratchpad_size_sycl(queue, uplo, n, lda,
-                                                                     group_count, group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, uplo, n, lda);
+    return scratchpad_sizes.get("dpotrf_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dpotrf_group_scratchpad_size_sycl(queue, uplo, n, lda, group_count,
+                                                           group_sizes);
+        });
+    });
 }
 template <>
 std::int64_t potrf_batch_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
     std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {
-    return function_tables[libkey].cpotrf_group_scratchpad_size_sycl(queue, uplo, n, lda,
-                                                                     group_count, group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, uplo, n, lda);
+    return scratchpad_sizes.get("cpotrf_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cpotrf_group_scratchpad_size_sycl(queue, uplo, n, lda, group_count,
+                                                           group_sizes);
+        });
+    });
 }
 template <>
 std::int64_t potrf_batch_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
     std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {
-    return function_tables[libkey].zpotrf_group_scratchpad_size_sycl(queue, uplo, n, lda,
-                                                                     group_count, group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, uplo, n, lda);
+    return scratchpad_sizes.get("zpotrf_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zpotrf_group_scratchpad_size_sycl(queue, uplo, n, lda, group_count,
+                                                           group_sizes);
+        });
+    });
 }
 template <>
 std::int64_t potrs_batch_scratchpad_size<float>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
     std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb, std::int64_t group_count,
     std::int64_t *group_sizes) {
-    return function_tables[libkey].spotrs_group_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, ldb,
-                                                                     group_count, group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, uplo, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("spotrs_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.spotrs_group_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, ldb,
+                                                           group_count, group_sizes);
+        });
+    });
 }
 template <>
 std::int64_t potrs_batch_scratchpad_size<double>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
     std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb, std::int64_t group_count,
     std::int64_t *group_sizes) {
-    return function_tables[libkey].dpotrs_group_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, ldb,
-                                                                     group_count, group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, uplo, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("dpotrs_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.dpotrs_group_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, ldb,
+                                                           group_count, group_sizes);
+        });
+    });
 }
 template <>
 std::int64_t potrs_batch_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
     std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb, std::int64_t group_count,
     std::int64_t *group_sizes) {
-    return function_tables[libkey].cpotrs_group_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, ldb,
-                                                                     group_count, group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, uplo, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("cpotrs_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cpotrs_group_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, ldb,
+                                                           group_count, group_sizes);
+        });
+    });
 }
 template <>
 std::int64_t potrs_batch_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, oneapi::mkl::uplo *uplo, std::int64_t *n,
     std::int64_t *nrhs, std::int64_t *lda, std::int64_t *ldb, std::int64_t group_count,
     std::int64_t *group_sizes) {
-    return function_tables[libkey].zpotrs_group_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, ldb,
-                                                                     group_count, group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, uplo, n, nrhs, lda, ldb);
+    return scratchpad_sizes.get("zpotrs_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zpotrs_group_scratchpad_size_sycl(queue, uplo, n, nrhs, lda, ldb,
+                                                           group_count, group_sizes);
+        });
+    });
 }
 template <>
 std::int64_t ungqr_batch_scratchpad_size<std::complex<float>>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *m, std::int64_t *n,
     std::int64_t *k, std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {
-    return function_tables[libkey].cungqr_group_scratchpad_size_sycl(queue, m, n, k, lda,
-                                                                     group_count, group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, m, n, k, lda);
+    return scratchpad_sizes.get("cungqr_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.cungqr_group_scratchpad_size_sycl(queue, m, n, k, lda, group_count,
+                                                           group_sizes);
+        });
+    });
 }
 template <>
 std::int64_t ungqr_batch_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *m, std::int64_t *n,
     std::int64_t *k, std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes) {
-    return function_tables[libkey].zungqr_group_scratchpad_size_sycl(queue, m, n, k, lda,
-                                                                     group_count, group_sizes);
+    auto shape = make_group_shape(group_count, group_sizes, m, n, k, lda);
+    return scratchpad_sizes.get("zungqr_group_scratchpad_size_sycl", libkey, queue, shape, [&]() {
+        return function_tables.largest(libkey, [&](auto &table) {
+            return table.zungqr_group_scratchpad_size_sycl(queue, m, n, k, lda, group_count,
+                                                           group_sizes);
+        });
+    });
 }
 
 } //namespace detail
+
+scratchpad_cache_stats get_scratchpad_cache_stats() {
+    return detail::scratchpad_sizes.stats();
+}
+
+void set_scratchpad_cache_capacity(std::int64_t entries) {
+    detail::scratchpad_sizes.set_capacity(entries);
+}
+
+void clear_scratchpad_cache() {
+    detail::scratchpad_sizes.clear();
+}
+
 } //namespace lapack
 } //namespace mkl
 } //namespace oneapi
@@ -0,0 +1,209 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/lapack/detail/workspace_pool.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace lapack {
+namespace detail {
+
+namespace {
+
+constexpr std::int64_t min_block_bytes = 256;
+constexpr std::int64_t default_limit_bytes = std::int64_t(256) << 20;
+
+// Requests are rounded up to a power of two so that blocks of neighbouring
+// sizes can be shared between calls.
+std::int64_t size_class(std::int64_t bytes) {
+    std::int64_t block = min_block_bytes;
+    while (block < bytes)
+        block <<= 1;
+    return block;
+}
+
+struct usm_block {
+    void *ptr;
+    sycl::event last_use;
+};
+
+struct queue_workspace {
+    std::map<std::int64_t, std::vector<sycl::buffer<std::uint8_t, 1>>> buffers;
+    std::map<std::int64_t, std::vector<usm_block>> usm_blocks;
+};
+
+// The pool is never destroyed: the SYCL runtime may be gone by the time static
+// objects are destroyed, and freeing its USM blocks or buffers then could
+// crash at exit.
+class workspace_pool {
+public:
+    static workspace_pool &instance() {
+        static workspace_pool *pool = new workspace_pool();
+        return *pool;
+    }
+
+    sycl::buffer<std::uint8_t, 1> acquire_buffer(sycl::queue &queue, std::int64_t bytes) {
+        const std::int64_t block = size_class(bytes);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto &free_list = pools_[queue].buffers[block];
+            if (!free_list.empty()) {
+                auto workspace = free_list.back();
+                free_list.pop_back();
+                cached_bytes_ -= block;
+                return workspace;
+            }
+        }
+        return sycl::buffer<std::uint8_t, 1>(sycl::range<1>(block));
+    }
+
+    void return_buffer(sycl::queue &queue, sycl::buffer<std::uint8_t, 1> &workspace) {
+        const std::int64_t block = workspace.get_count();
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (cached_bytes_ + block > limit_)
+            return;
+        pools_[queue].buffers[block].push_back(workspace);
+        cached_bytes_ += block;
+    }
+
+    void *acquire_usm(sycl::queue &queue, std::int64_t bytes,
+                      sycl::vector_class<sycl::event> &dependencies) {
+        const std::int64_t block = size_class(bytes);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto &free_list = pools_[queue].usm_blocks[block];
+            if (!free_list.empty()) {
+                usm_block workspace = free_list.back();
+                free_list.pop_back();
+                cached_bytes_ -= block;
+                dependencies.push_back(workspace.last_use);
+                return workspace.ptr;
+            }
+        }
+        void *ptr = sycl::malloc_device(block, queue);
+        if (ptr == nullptr)
+            throw oneapi::mkl::exception("LAPACK", "workspace", "failed to allocate workspace");
+        return ptr;
+    }
+
+    void return_usm(sycl::queue &queue, void *workspace, std::int64_t bytes,
+                    sycl::event last_use) {
+        const std::int64_t block = size_class(bytes);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (cached_bytes_ + block <= limit_) {
+                pools_[queue].usm_blocks[block].push_back({ workspace, last_use });
+                cached_bytes_ += block;
+                return;
+            }
+        }
+        last_use.wait();
+        sycl::free(workspace, queue);
+    }
+
+    void release(sycl::queue &queue) {
+        queue_workspace workspace;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = pools_.find(queue);
+            if (it == pools_.end())
+                return;
+            workspace = std::move(it->second);
+            pools_.erase(it);
+            for (auto &list : workspace.buffers)
+                cached_bytes_ -= list.first * list.second.size();
+            for (auto &list : workspace.usm_blocks)
+                cached_bytes_ -= list.first * list.second.size();
+        }
+        for (auto &list : workspace.usm_blocks) {
+            for (auto &block : list.second) {
+                block.last_use.wait();
+                sycl::free(block.ptr, queue);
+            }
+        }
+    }
+
+    void set_limit(std::int64_t bytes) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        limit_ = std::max<std::int64_t>(bytes, 0);
+    }
+
+    std::int64_t get_limit() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return limit_;
+    }
+
+private:
+    workspace_pool() : limit_(default_limit_bytes), cached_bytes_(0) {
+        if (const char *env = std::getenv("ONEMKL_LAPACK_WORKSPACE_LIMIT"))
+            limit_ = std::max<std::int64_t>(std::atoll(env), 0);
+    }
+
+    std::mutex mutex_;
+    std::unordered_map<sycl::queue, queue_workspace> pools_;
+    std::int64_t limit_;
+    std::int64_t cached_bytes_;
+};
+
+} // namespace
+
+sycl::buffer<std::uint8_t, 1> acquire_workspace_buffer(sycl::queue &queue, std::int64_t bytes) {
+    return workspace_pool::instance().acquire_buffer(queue, bytes);
+}
+
+void return_workspace_buffer(sycl::queue &queue, sycl::buffer<std::uint8_t, 1> &workspace) {
+    workspace_pool::instance().return_buffer(queue, workspace);
+}
+
+void *acquire_workspace_usm(sycl::queue &queue, std::int64_t bytes,
+                            sycl::vector_class<sycl::event> &dependencies) {
+    return workspace_pool::instance().acquire_usm(queue, bytes, dependencies);
+}
+
+void return_workspace_usm(sycl::queue &queue, void *workspace, std::int64_t bytes,
+                          sycl::event last_use) {
+    workspace_pool::instance().return_usm(queue, workspace, bytes, last_use);
+}
+
+} // namespace detail
+
+void release_workspace(sycl::queue &queue) {
+    detail::workspace_pool::instance().release(queue);
+}
+
+void set_workspace_limit(std::int64_t bytes) {
+    detail::workspace_pool::instance().set_limit(bytes);
+}
+
+std::int64_t get_workspace_limit() {
+    return detail::workspace_pool::instance().get_limit();
+}
+
+} // namespace lapack
+} // namespace mkl
+} // namespace oneapi
@@ -0,0 +1,225 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <istream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "oneapi/mkl/detail/export.hpp"
+#include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/numa.hpp"
+#include "numa_helper.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace detail {
+namespace numa {
+
+namespace {
+
+// Numbers of a list such as "0-7,16-23".
+std::vector<int> parse_list(std::istream &ranges) {
+    std::vector<int> list;
+    std::string range;
+    while (std::getline(ranges, range, ',')) {
+        std::istringstream in(range);
+        int first = 0, last = 0;
+        char dash = 0;
+        if (!(in >> first))
+            continue;
+        last = first;
+        if (in >> dash)
+            in >> last;
+        for (int i = first; i <= last; i++)
+            list.push_back(i);
+    }
+    return list;
+}
+
+// Numbers of a sysfs list.
+std::vector<int> read_list(const std::string &path) {
+    std::ifstream file(path);
+    return parse_list(file);
+}
+
+std::atomic<int> active{ 0 };
+std::mutex registry_mutex;
+std::map<const char *, shared_allocation> registry;
+
+#ifdef __linux__
+// Memory policies and flags of mbind, see <numaif.h>.
+constexpr int mpol_preferred = 1;
+constexpr int mpol_interleave = 3;
+constexpr unsigned mpol_mf_move = 1u << 1;
+
+// Sets the memory policy of [p, p + bytes) to mode over nodes, moving the
+// pages already touched.
+bool bind(const char *p, std::size_t bytes, int mode, const std::vector<std::int64_t> &nodes) {
+    constexpr std::size_t bits = 8 * sizeof(unsigned long);
+    std::int64_t last = 0;
+    for (auto node : nodes)
+        last = std::max(last, node);
+    std::vector<unsigned long> mask(last / bits + 1, 0);
+    for (auto node : nodes)
+        mask[node / bits] |= 1ul << (node % bits);
+    return syscall(SYS_mbind, p, bytes, mode, mask.data(), mask.size() * bits + 1,
+                   mpol_mf_move) == 0;
+}
+#endif
+
+} // namespace
+
+const char *listed_nodes() {
+    return std::getenv("ONEMKL_NUMA_NODES");
+}
+
+std::vector<std::int64_t> nodes() {
+    std::vector<std::int64_t> found;
+#ifdef __linux__
+    if (const char *listed = listed_nodes()) {
+        std::istringstream ranges(listed);
+        for (int node : parse_list(ranges))
+            found.push_back(node);
+        return found;
+    }
+    for (int node : read_list("/sys/devices/system/node/online")) {
+        if (!node_cpus(node).empty())
+            found.push_back(node);
+    }
+#endif
+    return found;
+}
+
+std::vector<int> node_cpus(std::int64_t node) {
+#ifdef __linux__
+    return read_list("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+#else
+    return {};
+#endif
+}
+
+} // namespace numa
+} // namespace detail
+
+std::int64_t numa_node_count() {
+    return std::max<std::int64_t>(1, detail::numa::nodes().size());
+}
+
+void *numa_malloc_shared(std::size_t bytes, sycl::queue &queue, numa_policy policy) {
+    if (!queue.get_device().is_cpu())
+        throw oneapi::mkl::unsupported_device("", "numa_malloc_shared", queue.get_device());
+#ifdef __linux__
+    const std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#else
+    const std::size_t page = 4096;
+#endif
+    // Whole pages, so that placing them does not move the pages of other data.
+    const std::size_t size = (std::max<std::size_t>(bytes, 1) + page - 1) / page * page;
+    auto p = static_cast<char *>(sycl::aligned_alloc_shared(page, size, queue));
+    if (p == nullptr || policy == numa_policy::none)
+        return p;
+
+#ifdef __linux__
+    const auto nodes = detail::numa::nodes();
+    if (nodes.size() < 2)
+        return p;
+    auto placed = std::make_shared<detail::numa::allocation>();
+    placed->begin = p;
+    placed->bytes = size;
+    placed->policy = policy;
+    for (auto node : nodes) {
+        execution_policy cpus;
+        cpus.numa_node = node;
+        cpus.cpus = detail::numa::node_cpus(node);
+        cpus.threads = cpus.cpus.size();
+        placed->nodes.push_back(std::move(cpus));
+    }
+
+    bool bound = true;
+    if (policy == numa_policy::interleave) {
+        bound = detail::numa::bind(p, size, detail::numa::mpol_interleave, nodes);
+    }
+    else {
+        const std::size_t pages = size / page;
+        for (std::size_t k = 0; k <= nodes.size(); k++)
+            placed->bounds.push_back(pages * k / nodes.size() * page);
+        for (std::size_t k = 0; k < nodes.size() && bound; k++) {
+            const std::size_t block = placed->bounds[k + 1] - placed->bounds[k];
+            if (block > 0)
+                bound = detail::numa::bind(p + placed->bounds[k], block,
+                                           detail::numa::mpol_preferred, { nodes[k] });
+        }
+    }
+    // Pages the kernel could not place are left where they are, and calls on
+    // them are not split, unless the nodes were listed to test the splits.
+    if (!bound && detail::numa::listed_nodes() == nullptr)
+        return p;
+
+    std::lock_guard<std::mutex> lock(detail::numa::registry_mutex);
+    detail::numa::registry[p] = std::move(placed);
+    detail::numa::active.fetch_add(1);
+#endif
+    return p;
+}
+
+void numa_free(void *ptr, sycl::queue &queue) {
+    if (ptr == nullptr)
+        return;
+    {
+        std::lock_guard<std::mutex> lock(detail::numa::registry_mutex);
+        if (detail::numa::registry.erase(static_cast<const char *>(ptr)) > 0)
+            detail::numa::active.fetch_sub(1);
+    }
+    sycl::free(ptr, queue);
+}
+
+} // namespace mkl
+} // namespace oneapi
+
+// Looked up by the CPU backends, see numa_helper.hpp.
+extern "C" ONEMKL_EXPORT void onemkl_numa_allocation(
+    const void *p, oneapi::mkl::detail::numa::shared_allocation *found) {
+    namespace numa = oneapi::mkl::detail::numa;
+    if (numa::active.load(std::memory_order_relaxed) == 0)
+        return;
+    std::lock_guard<std::mutex> lock(numa::registry_mutex);
+    auto it = numa::registry.upper_bound(static_cast<const char *>(p));
+    if (it == numa::registry.begin())
+        return;
+    --it;
+    if (static_cast<const char *>(p) < it->first + it->second->bytes)
+        *found = it->second;
+}
@@ -323,6 +323,28 @@ public:
             .wait_and_throw();
     }
 
+    virtual void generate(const bernoulli_v<std::int32_t, bernoulli_v_method::icdf>& distr,
+                          std::int64_t n, cl::sycl::buffer<std::int32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "bernoulli_v", "unsupported by cuRAND backend");
+    }
+
+    virtual void generate(const bernoulli_v<std::uint32_t, bernoulli_v_method::icdf>& distr,
+                          std::int64_t n, cl::sycl::buffer<std::uint32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "bernoulli_v", "unsupported by cuRAND backend");
+    }
+
+    virtual void generate(
+        const poisson_v<std::int32_t, poisson_v_method::gaussian_icdf_based>& distr,
+        std::int64_t n, cl::sycl::buffer<std::int32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "poisson_v", "unsupported by cuRAND backend");
+    }
+
+    virtual void generate(
+        const poisson_v<std::uint32_t, poisson_v_method::gaussian_icdf_based>& distr,
+        std::int64_t n, cl::sycl::buffer<std::uint32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "poisson_v", "unsupported by cuRAND backend");
+    }
+
     // USM APIs
 
     virtual cl::sycl::event generate(
@@ -554,6 +576,32 @@ public:
         });
     }
 
+    virtual cl::sycl::event generate(
+        const bernoulli_v<std::int32_t, bernoulli_v_method::icdf>& distr, std::int64_t n,
+        std::int32_t* r, const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "bernoulli_v", "unsupported by cuRAND backend");
+    }
+
+    virtual cl::sycl::event generate(
+        const bernoulli_v<std::uint32_t, bernoulli_v_method::icdf>& distr, std::int64_t n,
+        std::uint32_t* r, const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "bernoulli_v", "unsupported by cuRAND backend");
+    }
+
+    virtual cl::sycl::event generate(
+        const poisson_v<std::int32_t, poisson_v_method::gaussian_icdf_based>& distr,
+        std::int64_t n, std::int32_t* r,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "poisson_v", "unsupported by cuRAND backend");
+    }
+
+    virtual cl::sycl::event generate(
+        const poisson_v<std::uint32_t, poisson_v_method::gaussian_icdf_based>& distr,
+        std::int64_t n, std::uint32_t* r,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "poisson_v", "unsupported by cuRAND backend");
+    }
+
     virtual oneapi::mkl::rng::detail::engine_impl* copy_state() override {
         return new mrg32k3a_impl(this);
     }
@@ -702,6 +750,28 @@ public:
         throw oneapi::mkl::unimplemented("rng", "mrg32ka engine");
     }
 
+    virtual void generate(const bernoulli_v<std::int32_t, bernoulli_v_method::icdf>& distr,
+                          std::int64_t n, cl::sycl::buffer<std::int32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "bernoulli_v", "unsupported by cuRAND backend");
+    }
+
+    virtual void generate(const bernoulli_v<std::uint32_t, bernoulli_v_method::icdf>& distr,
+                          std::int64_t n, cl::sycl::buffer<std::uint32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "bernoulli_v", "unsupported by cuRAND backend");
+    }
+
+    virtual void generate(
+        const poisson_v<std::int32_t, poisson_v_method::gaussian_icdf_based>& distr,
+        std::int64_t n, cl::sycl::buffer<std::int32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "poisson_v", "unsupported by cuRAND backend");
+    }
+
+    virtual void generate(
+        const poisson_v<std::uint32_t, poisson_v_method::gaussian_icdf_based>& distr,
+        std::int64_t n, cl::sycl::buffer<std::uint32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "poisson_v", "unsupported by cuRAND backend");
+    }
+
     // USM APIs
 
     virtual cl::sycl::event generate(
@@ -848,6 +918,32 @@ public:
         return cl::sycl::event{};
     }
 
+    virtual cl::sycl::event generate(
+        const bernoulli_v<std::int32_t, bernoulli_v_method::icdf>& distr, std::int64_t n,
+        std::int32_t* r, const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "bernoulli_v", "unsupported by cuRAND backend");
+    }
+
+    virtual cl::sycl::event generate(
+        const bernoulli_v<std::uint32_t, bernoulli_v_method::icdf>& distr, std::int64_t n,
+        std::uint32_t* r, const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "bernoulli_v", "unsupported by cuRAND backend");
+    }
+
+    virtual cl::sycl::event generate(
+        const poisson_v<std::int32_t, poisson_v_method::gaussian_icdf_based>& distr,
+        std::int64_t n, std::int32_t* r,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "poisson_v", "unsupported by cuRAND backend");
+    }
+
+    virtual cl::sycl::event generate(
+        const poisson_v<std::uint32_t, poisson_v_method::gaussian_icdf_based>& distr,
+        std::int64_t n, std::uint32_t* r,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "poisson_v", "unsupported by cuRAND backend");
+    }
+
     virtual oneapi::mkl::rng::detail::engine_impl* copy_state() override {
         throw oneapi::mkl::unimplemented("rng", "mrg32ka engine");
         return nullptr;
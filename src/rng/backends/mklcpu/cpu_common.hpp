@@ -20,8 +20,12 @@
 #ifndef _RNG_CPU_COMMON_HPP_
 #define _RNG_CPU_COMMON_HPP_
 
+#include <cstdint>
+#include <cstring>
 #include <CL/sycl.hpp>
 
+#include "mkl_vsl.h"
+
 namespace oneapi {
 namespace mkl {
 namespace rng {
@@ -44,6 +48,25 @@ static inline void host_task(H &cgh, F f) {
     (void)host_task_internal<K>(cgh, f, 0);
 }
 
+// VSL provides no vector-parameter Bernoulli method. Uniform numbers are generated in place
+//  of r and the i-th of them is turned into a trial with success probability p[i].
+template <typename IntType>
+static inline int bernoulli_v_icdf(VSLStreamStatePtr stream, std::int64_t n, IntType* r,
+                                   const float* p) {
+    static_assert(sizeof(IntType) == sizeof(float), "rng bernoulli_v type is not supported");
+    int status = vsRngUniform(VSL_RNG_METHOD_UNIFORM_STD, stream, n, reinterpret_cast<float*>(r),
+                              0.0f, 1.0f);
+    if (status != VSL_STATUS_OK) {
+        return status;
+    }
+    for (std::int64_t i = 0; i < n; i++) {
+        float u;
+        std::memcpy(&u, r + i, sizeof(float));
+        r[i] = (u < p[i]) ? 1 : 0;
+    }
+    return VSL_STATUS_OK;
+}
+
 template <typename Engine, typename Distr>
 class kernel_name {};
 
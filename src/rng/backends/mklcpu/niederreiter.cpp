@@ -0,0 +1,117 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <vector>
+#include <CL/sycl.hpp>
+
+#include "mkl_vsl.h"
+
+#include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/rng/detail/engine_impl.hpp"
+#include "oneapi/mkl/rng/detail/mklcpu/onemkl_rng_mklcpu.hpp"
+
+#include "cpu_common.hpp"
+#include "vsl_engine_impl.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace rng {
+namespace mklcpu {
+
+class niederreiter_impl : public vsl_stream_engine_impl<niederreiter_impl> {
+public:
+    niederreiter_impl(cl::sycl::queue queue, std::uint32_t dimensions)
+            : vsl_stream_engine_impl<niederreiter_impl>(queue) {
+        if (dimensions == 0) {
+            throw oneapi::mkl::invalid_argument("rng", "niederreiter", "dimensions is 0");
+        }
+        if (vslNewStream(&stream_, VSL_BRNG_NIEDERR, dimensions) != VSL_STATUS_OK) {
+            throw oneapi::mkl::invalid_argument("rng", "niederreiter",
+                                                "dimensions is not supported by the engine");
+        }
+        state_size_ = vslGetStreamSize(stream_);
+    }
+
+    // direction_numbers holds the user-defined direction numbers of each dimension in turn.
+    //  VSL takes the dimensions, the flags VSL_USER_QRNG_INITIAL_VALUES and
+    //  VSL_USER_DIRECTION_NUMBERS as separate parameters, then the table
+    niederreiter_impl(cl::sycl::queue queue, std::uint32_t dimensions,
+                      const std::vector<std::uint32_t>& direction_numbers)
+            : vsl_stream_engine_impl<niederreiter_impl>(queue) {
+        if (dimensions == 0 || direction_numbers.empty() ||
+            direction_numbers.size() % dimensions != 0) {
+            throw oneapi::mkl::invalid_argument(
+                "rng", "niederreiter",
+                "direction_numbers size must be a non-zero multiple of dimensions");
+        }
+        std::vector<std::uint32_t> params = { dimensions, VSL_USER_QRNG_INITIAL_VALUES,
+                                              VSL_USER_DIRECTION_NUMBERS };
+        params.insert(params.end(), direction_numbers.begin(), direction_numbers.end());
+        int status = vslNewStreamEx(&stream_, VSL_BRNG_NIEDERR, params.size(), params.data());
+        if (status != VSL_STATUS_OK) {
+            throw oneapi::mkl::invalid_argument("rng", "niederreiter",
+                                                "direction_numbers are rejected by the engine");
+        }
+        state_size_ = vslGetStreamSize(stream_);
+    }
+
+    niederreiter_impl(const niederreiter_impl* other)
+            : vsl_stream_engine_impl<niederreiter_impl>(*other) {
+        check_vsl_status(vslCopyStream(&stream_, other->stream_), "niederreiter");
+        state_size_ = vslGetStreamSize(stream_);
+    }
+
+    virtual oneapi::mkl::rng::detail::engine_impl* copy_state() override {
+        return new niederreiter_impl(this);
+    }
+
+    virtual void skip_ahead(std::uint64_t num_to_skip) override {
+        check_vsl_status(vslSkipAheadStream(stream_, num_to_skip), "skip_ahead");
+    }
+
+    virtual void skip_ahead(std::initializer_list<std::uint64_t> num_to_skip) override {
+        check_vsl_status(vslSkipAheadStreamEx(stream_, num_to_skip.size(),
+                                              (unsigned long long*)num_to_skip.begin()),
+                         "skip_ahead");
+    }
+
+    virtual void leapfrog(std::uint64_t idx, std::uint64_t stride) override {
+        throw oneapi::mkl::unimplemented("rng", "leapfrog");
+    }
+
+    virtual ~niederreiter_impl() override {
+        vslDeleteStream(&stream_);
+    }
+};
+
+oneapi::mkl::rng::detail::engine_impl* create_niederreiter(cl::sycl::queue queue,
+                                                            std::uint32_t dimensions) {
+    return new niederreiter_impl(queue, dimensions);
+}
+
+oneapi::mkl::rng::detail::engine_impl* create_niederreiter(
+    cl::sycl::queue queue, std::uint32_t dimensions,
+    const std::vector<std::uint32_t>& direction_numbers) {
+    return new niederreiter_impl(queue, dimensions, direction_numbers);
+}
+
+} // namespace mklcpu
+} // namespace rng
+} // namespace mkl
+} // namespace oneapi
@@ -0,0 +1,118 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <vector>
+#include <CL/sycl.hpp>
+
+#include "mkl_vsl.h"
+
+#include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/rng/detail/engine_impl.hpp"
+#include "oneapi/mkl/rng/detail/mklcpu/onemkl_rng_mklcpu.hpp"
+
+#include "cpu_common.hpp"
+#include "vsl_engine_impl.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace rng {
+namespace mklcpu {
+
+class sobol_impl : public vsl_stream_engine_impl<sobol_impl> {
+public:
+    sobol_impl(cl::sycl::queue queue, std::uint32_t dimensions)
+            : vsl_stream_engine_impl<sobol_impl>(queue) {
+        if (dimensions == 0) {
+            throw oneapi::mkl::invalid_argument("rng", "sobol", "dimensions is 0");
+        }
+        if (vslNewStream(&stream_, VSL_BRNG_SOBOL, dimensions) != VSL_STATUS_OK) {
+            throw oneapi::mkl::invalid_argument("rng", "sobol",
+                                                "dimensions is not supported by the engine");
+        }
+        state_size_ = vslGetStreamSize(stream_);
+    }
+
+    // direction_numbers holds a dimensions x maxdeg table of user-defined direction numbers.
+    //  VSL takes the dimensions, the flags VSL_USER_QRNG_INITIAL_VALUES and
+    //  VSL_USER_DIRECTION_NUMBERS as separate parameters, then maxdeg and the table
+    sobol_impl(cl::sycl::queue queue, std::uint32_t dimensions,
+               const std::vector<std::uint32_t>& direction_numbers)
+            : vsl_stream_engine_impl<sobol_impl>(queue) {
+        if (dimensions == 0 || direction_numbers.empty() ||
+            direction_numbers.size() % dimensions != 0) {
+            throw oneapi::mkl::invalid_argument(
+                "rng", "sobol",
+                "direction_numbers size must be a non-zero multiple of dimensions");
+        }
+        std::vector<std::uint32_t> params = { dimensions, VSL_USER_QRNG_INITIAL_VALUES,
+                                              VSL_USER_DIRECTION_NUMBERS,
+                                              static_cast<std::uint32_t>(
+                                                  direction_numbers.size() / dimensions) };
+        params.insert(params.end(), direction_numbers.begin(), direction_numbers.end());
+        int status = vslNewStreamEx(&stream_, VSL_BRNG_SOBOL, params.size(), params.data());
+        if (status != VSL_STATUS_OK) {
+            throw oneapi::mkl::invalid_argument("rng", "sobol",
+                                                "direction_numbers are rejected by the engine");
+        }
+        state_size_ = vslGetStreamSize(stream_);
+    }
+
+    sobol_impl(const sobol_impl* other) : vsl_stream_engine_impl<sobol_impl>(*other) {
+        check_vsl_status(vslCopyStream(&stream_, other->stream_), "sobol");
+        state_size_ = vslGetStreamSize(stream_);
+    }
+
+    virtual oneapi::mkl::rng::detail::engine_impl* copy_state() override {
+        return new sobol_impl(this);
+    }
+
+    virtual void skip_ahead(std::uint64_t num_to_skip) override {
+        check_vsl_status(vslSkipAheadStream(stream_, num_to_skip), "skip_ahead");
+    }
+
+    virtual void skip_ahead(std::initializer_list<std::uint64_t> num_to_skip) override {
+        check_vsl_status(vslSkipAheadStreamEx(stream_, num_to_skip.size(),
+                                              (unsigned long long*)num_to_skip.begin()),
+                         "skip_ahead");
+    }
+
+    virtual void leapfrog(std::uint64_t idx, std::uint64_t stride) override {
+        throw oneapi::mkl::unimplemented("rng", "leapfrog");
+    }
+
+    virtual ~sobol_impl() override {
+        vslDeleteStream(&stream_);
+    }
+};
+
+oneapi::mkl::rng::detail::engine_impl* create_sobol(cl::sycl::queue queue,
+                                                     std::uint32_t dimensions) {
+    return new sobol_impl(queue, dimensions);
+}
+
+oneapi::mkl::rng::detail::engine_impl* create_sobol(
+    cl::sycl::queue queue, std::uint32_t dimensions,
+    const std::vector<std::uint32_t>& direction_numbers) {
+    return new sobol_impl(queue, dimensions, direction_numbers);
+}
+
+} // namespace mklcpu
+} // namespace rng
+} // namespace mkl
+} // namespace oneapi
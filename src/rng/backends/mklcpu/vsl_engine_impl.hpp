@@ -0,0 +1,875 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _RNG_CPU_VSL_ENGINE_IMPL_HPP_
+#define _RNG_CPU_VSL_ENGINE_IMPL_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+#include <CL/sycl.hpp>
+
+#include "mkl_vsl.h"
+
+#include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/rng/detail/engine_impl.hpp"
+
+#include "cpu_common.hpp"
+#include "thread_pool_helper.hpp"
+#include "threading_layer_helper.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace rng {
+namespace mklcpu {
+
+// Throws if a VSL call failed. Inside host tasks the exception reaches the queue's
+//  asynchronous handler, as other errors of the computation do.
+static inline void check_vsl_status(int status, const std::string& function) {
+    if (status != VSL_STATUS_OK) {
+        throw oneapi::mkl::exception("rng", function, "VSL error " + std::to_string(status));
+    }
+}
+
+// vsl_generate maps each distribution object to the corresponding VSL generation call and
+//  returns its status
+
+static inline int vsl_generate(VSLStreamStatePtr stream,
+                               const uniform<float, uniform_method::standard>& distr,
+                               std::int64_t n, float* r) {
+    return vsRngUniform(VSL_RNG_METHOD_UNIFORM_STD, stream, n, r, distr.a(), distr.b());
+}
+
+static inline int vsl_generate(VSLStreamStatePtr stream,
+                               const uniform<double, uniform_method::standard>& distr,
+                               std::int64_t n, double* r) {
+    return vdRngUniform(VSL_RNG_METHOD_UNIFORM_STD, stream, n, r, distr.a(), distr.b());
+}
+
+static inline int vsl_generate(VSLStreamStatePtr stream,
+                               const uniform<std::int32_t, uniform_method::standard>& distr,
+                               std::int64_t n, std::int32_t* r) {
+    return viRngUniform(VSL_RNG_METHOD_UNIFORM_STD, stream, n, r, distr.a(), distr.b());
+}
+
+static inline int vsl_generate(VSLStreamStatePtr stream,
+                               const uniform<float, uniform_method::accurate>& distr,
+                               std::int64_t n, float* r) {
+    return vsRngUniform(VSL_RNG_METHOD_UNIFORM_STD_ACCURATE, stream, n, r, distr.a(), distr.b());
+}
+
+static inline int vsl_generate(VSLStreamStatePtr stream,
+                               const uniform<double, uniform_method::accurate>& distr,
+                               std::int64_t n, double* r) {
+    return vdRngUniform(VSL_RNG_METHOD_UNIFORM_STD_ACCURATE, stream, n, r, distr.a(), distr.b());
+}
+
+static inline int vsl_generate(VSLStreamStatePtr stream,
+                               const gaussian<float, gaussian_method::box_muller2>& distr,
+                               std::int64_t n, float* r) {
+    return vsRngGaussian(VSL_RNG_METHOD_GAUSSIAN_BOXMULLER2, stream, n, r, distr.mean(),
+                         distr.stddev());
+}
+
+static inline int vsl_generate(VSLStreamStatePtr stream,
+                               const gaussian<double, gaussian_method::box_muller2>& distr,
+                               std::int64_t n, double* r) {
+    return vdRngGaussian(VSL_RNG_METHOD_GAUSSIAN_BOXMULLER2, stream, n, r, distr.mean(),
+                         distr.stddev());
+}
+
+static inline int vsl_generate(VSLStreamStatePtr stream,
+                               const gaussian<float, gaussian_method::icdf>& distr,
+                               std::int64_t n, float* r) {
+    return vsRngGaussian(VSL_RNG_METHOD_GAUSSIAN_ICDF, stream, n, r, distr.mean(), distr.stddev());
+}
+
+static inline int vsl_generate(VSLStreamStatePtr stream,
+                               const gaussian<double, gaussian_method::icdf>& distr,
+                               std::int64_t n, double* r) {
+    return vdRngGaussian(VSL_RNG_METHOD_GAUSSIAN_ICDF, stream, n, r, distr.mean(), distr.stddev());
+}
+
+static inline int vsl_generate(VSLStreamStatePtr stream,
+                               const lognormal<float, lognormal_method::box_muller2>& distr,
+                               std::int64_t n, float* r) {
+    return vsRngLognormal(VSL_RNG_METHOD_LOGNORMAL_BOXMULLER2, stream, n, r, distr.m(), distr.s(),
+                          distr.displ(), distr.scale());
+}
+
+static inline int vsl_generate(VSLStreamStatePtr stream,
+                               const lognormal<double, lognormal_method::box_muller2>& distr,
+                               std::int64_t n, double* r) {
+    return vdRngLognormal(VSL_RNG_METHOD_LOGNORMAL_BOXMULLER2, stream, n, r, distr.m(), distr.s(),
+                          distr.displ(), distr.scale());
+}
+
+static inline int vsl_generate(VSLStreamStatePtr stream,
+                               const lognormal<float, lognormal_method::icdf>& distr,
+                               std::int64_t n, float* r) {
+    return vsRngLognormal(VSL_RNG_METHOD_LOGNORMAL_ICDF, stream, n, r, distr.m(), distr.s(),
+                          distr.displ(), distr.scale());
+}
+
+static inline int vsl_generate(VSLStreamStatePtr stream,
+                               const lognormal<double, lognormal_method::icdf>& distr,
+                               std::int64_t n, double* r) {
+    return vdRngLognormal(VSL_RNG_METHOD_LOGNORMAL_ICDF, stream, n, r, distr.m(), distr.s(),
+                          distr.displ(), distr.scale());
+}
+
+static inline int vsl_generate(VSLStreamStatePtr stream,
+                               const bernoulli<std::int32_t, bernoulli_method::icdf>& distr,
+                               std::int64_t n, std::int32_t* r) {
+    return viRngBernoulli(VSL_RNG_METHOD_BERNOULLI_ICDF, stream, n, r, distr.p());
+}
+
+static inline int vsl_generate(VSLStreamStatePtr stream,
+                               const bernoulli<std::uint32_t, bernoulli_method::icdf>& distr,
+                               std::int64_t n, std::uint32_t* r) {
+    return viRngBernoulli(VSL_RNG_METHOD_BERNOULLI_ICDF, stream, n,
+                          reinterpret_cast<std::int32_t*>(r), distr.p());
+}
+
+static inline int vsl_generate(
+    VSLStreamStatePtr stream,
+    const poisson<std::int32_t, poisson_method::gaussian_icdf_based>& distr, std::int64_t n,
+    std::int32_t* r) {
+    return viRngPoisson(VSL_RNG_METHOD_POISSON_POISNORM, stream, n, r, distr.lambda());
+}
+
+static inline int vsl_generate(
+    VSLStreamStatePtr stream,
+    const poisson<std::uint32_t, poisson_method::gaussian_icdf_based>& distr, std::int64_t n,
+    std::uint32_t* r) {
+    return viRngPoisson(VSL_RNG_METHOD_POISSON_POISNORM, stream, n,
+                        reinterpret_cast<std::int32_t*>(r), distr.lambda());
+}
+
+static inline int vsl_generate(VSLStreamStatePtr stream, const bits<std::uint32_t>& distr,
+                               std::int64_t n, std::uint32_t* r) {
+    return viRngUniformBits(VSL_RNG_METHOD_UNIFORMBITS_STD, stream, n, r);
+}
+
+// vsl_generate_v generates from the vector-parameter distributions, the type of the
+//  parameter array selects the distribution: probabilities of bernoulli_v or means of poisson_v
+
+template <typename IntType>
+static inline int vsl_generate_v(VSLStreamStatePtr stream, std::int64_t n, IntType* r,
+                                 const float* p) {
+    return bernoulli_v_icdf(stream, n, r, p);
+}
+
+template <typename IntType>
+static inline int vsl_generate_v(VSLStreamStatePtr stream, std::int64_t n, IntType* r,
+                                 const double* lambda) {
+    static_assert(sizeof(IntType) == sizeof(std::int32_t), "rng poisson_v type is not supported");
+    return viRngPoissonV(VSL_RNG_METHOD_POISSONV_POISNORM, stream, n,
+                         reinterpret_cast<std::int32_t*>(r), lambda);
+}
+
+// Generates n numbers from each of streams into r[i * stride], the streams are spread
+//  over the threads of the shared host pool in contiguous blocks
+template <typename Distr, typename T>
+static inline void generate_batch_host(const Distr& distr,
+                                       const std::vector<VSLStreamStatePtr>& streams,
+                                       std::int64_t n, T* r, std::int64_t stride) {
+    std::int64_t batch_size = streams.size();
+    std::int64_t n_threads = std::min<std::int64_t>(
+        batch_size, std::max<std::int64_t>(1, std::thread::hardware_concurrency()));
+    // Exceptions must not leave the worker threads, so statuses are checked once all are done
+    std::vector<int> status(std::max<std::int64_t>(n_threads, 1), VSL_STATUS_OK);
+    auto work = [&](std::int64_t thread_id) {
+        std::int64_t first = batch_size * thread_id / n_threads;
+        std::int64_t last = batch_size * (thread_id + 1) / n_threads;
+        for (std::int64_t i = first; i < last && status[thread_id] == VSL_STATUS_OK; i++) {
+            status[thread_id] = vsl_generate(streams[i], distr, n, r + i * stride);
+        }
+    };
+    if (n_threads > 1) {
+        oneapi::mkl::detail::host_thread_pool::instance().run(n_threads, work);
+    }
+    else if (n_threads == 1) {
+        work(0);
+    }
+    for (int s : status) {
+        check_vsl_status(s, "generate_batch");
+    }
+}
+
+template <typename Engine, typename Distr>
+class kernel_name_batch {};
+
+template <typename Engine, typename Distr>
+class kernel_name_batch_usm {};
+
+// Common base of the mklcpu engines, which all keep their state in a VSL stream.
+//  It implements the batch APIs for any mix of mklcpu engines.
+class vsl_engine_impl : public oneapi::mkl::rng::detail::engine_impl {
+public:
+    // Every MKL call of an engine follows its construction, which selects the
+    // MKL threading layer.
+    vsl_engine_impl(cl::sycl::queue queue) : oneapi::mkl::rng::detail::engine_impl(queue) {
+        oneapi::mkl::detail::threading::ensure_mkl_layers();
+    }
+
+    vsl_engine_impl(const vsl_engine_impl& other)
+            : oneapi::mkl::rng::detail::engine_impl(other) {}
+
+    // Batch APIs
+
+    virtual void generate_batch(const uniform<float, uniform_method::standard>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<float, 1>& r, std::int64_t stride) override {
+        generate_batch_impl(distr, engines, n, r, stride);
+    }
+
+    virtual void generate_batch(const uniform<double, uniform_method::standard>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<double, 1>& r, std::int64_t stride) override {
+        generate_batch_impl(distr, engines, n, r, stride);
+    }
+
+    virtual void generate_batch(const uniform<std::int32_t, uniform_method::standard>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<std::int32_t, 1>& r,
+                                std::int64_t stride) override {
+        generate_batch_impl(distr, engines, n, r, stride);
+    }
+
+    virtual void generate_batch(const uniform<float, uniform_method::accurate>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<float, 1>& r, std::int64_t stride) override {
+        generate_batch_impl(distr, engines, n, r, stride);
+    }
+
+    virtual void generate_batch(const uniform<double, uniform_method::accurate>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<double, 1>& r, std::int64_t stride) override {
+        generate_batch_impl(distr, engines, n, r, stride);
+    }
+
+    virtual void generate_batch(const gaussian<float, gaussian_method::box_muller2>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<float, 1>& r, std::int64_t stride) override {
+        generate_batch_impl(distr, engines, n, r, stride);
+    }
+
+    virtual void generate_batch(const gaussian<double, gaussian_method::box_muller2>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<double, 1>& r, std::int64_t stride) override {
+        generate_batch_impl(distr, engines, n, r, stride);
+    }
+
+    virtual void generate_batch(const gaussian<float, gaussian_method::icdf>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<float, 1>& r, std::int64_t stride) override {
+        generate_batch_impl(distr, engines, n, r, stride);
+    }
+
+    virtual void generate_batch(const gaussian<double, gaussian_method::icdf>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<double, 1>& r, std::int64_t stride) override {
+        generate_batch_impl(distr, engines, n, r, stride);
+    }
+
+    virtual void generate_batch(const lognormal<float, lognormal_method::box_muller2>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<float, 1>& r, std::int64_t stride) override {
+        generate_batch_impl(distr, engines, n, r, stride);
+    }
+
+    virtual void generate_batch(const lognormal<double, lognormal_method::box_muller2>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<double, 1>& r, std::int64_t stride) override {
+        generate_batch_impl(distr, engines, n, r, stride);
+    }
+
+    virtual void generate_batch(const lognormal<float, lognormal_method::icdf>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<float, 1>& r, std::int64_t stride) override {
+        generate_batch_impl(distr, engines, n, r, stride);
+    }
+
+    virtual void generate_batch(const lognormal<double, lognormal_method::icdf>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<double, 1>& r, std::int64_t stride) override {
+        generate_batch_impl(distr, engines, n, r, stride);
+    }
+
+    virtual void generate_batch(const bernoulli<std::int32_t, bernoulli_method::icdf>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<std::int32_t, 1>& r,
+                                std::int64_t stride) override {
+        generate_batch_impl(distr, engines, n, r, stride);
+    }
+
+    virtual void generate_batch(const bernoulli<std::uint32_t, bernoulli_method::icdf>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<std::uint32_t, 1>& r,
+                                std::int64_t stride) override {
+        generate_batch_impl(distr, engines, n, r, stride);
+    }
+
+    virtual void generate_batch(
+        const poisson<std::int32_t, poisson_method::gaussian_icdf_based>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n,
+        cl::sycl::buffer<std::int32_t, 1>& r, std::int64_t stride) override {
+        generate_batch_impl(distr, engines, n, r, stride);
+    }
+
+    virtual void generate_batch(
+        const poisson<std::uint32_t, poisson_method::gaussian_icdf_based>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n,
+        cl::sycl::buffer<std::uint32_t, 1>& r, std::int64_t stride) override {
+        generate_batch_impl(distr, engines, n, r, stride);
+    }
+
+    virtual void generate_batch(const bits<std::uint32_t>& distr,
+                                const std::vector<engine_impl*>& engines, std::int64_t n,
+                                cl::sycl::buffer<std::uint32_t, 1>& r,
+                                std::int64_t stride) override {
+        generate_batch_impl(distr, engines, n, r, stride);
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const uniform<float, uniform_method::standard>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, float* r, std::int64_t stride,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_batch_impl(distr, engines, n, r, stride, dependencies);
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const uniform<double, uniform_method::standard>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, double* r, std::int64_t stride,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_batch_impl(distr, engines, n, r, stride, dependencies);
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const uniform<std::int32_t, uniform_method::standard>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, std::int32_t* r,
+        std::int64_t stride, const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_batch_impl(distr, engines, n, r, stride, dependencies);
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const uniform<float, uniform_method::accurate>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, float* r, std::int64_t stride,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_batch_impl(distr, engines, n, r, stride, dependencies);
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const uniform<double, uniform_method::accurate>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, double* r, std::int64_t stride,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_batch_impl(distr, engines, n, r, stride, dependencies);
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const gaussian<float, gaussian_method::box_muller2>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, float* r, std::int64_t stride,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_batch_impl(distr, engines, n, r, stride, dependencies);
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const gaussian<double, gaussian_method::box_muller2>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, double* r, std::int64_t stride,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_batch_impl(distr, engines, n, r, stride, dependencies);
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const gaussian<float, gaussian_method::icdf>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, float* r, std::int64_t stride,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_batch_impl(distr, engines, n, r, stride, dependencies);
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const gaussian<double, gaussian_method::icdf>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, double* r, std::int64_t stride,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_batch_impl(distr, engines, n, r, stride, dependencies);
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const lognormal<float, lognormal_method::box_muller2>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, float* r, std::int64_t stride,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_batch_impl(distr, engines, n, r, stride, dependencies);
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const lognormal<double, lognormal_method::box_muller2>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, double* r, std::int64_t stride,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_batch_impl(distr, engines, n, r, stride, dependencies);
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const lognormal<float, lognormal_method::icdf>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, float* r, std::int64_t stride,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_batch_impl(distr, engines, n, r, stride, dependencies);
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const lognormal<double, lognormal_method::icdf>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, double* r, std::int64_t stride,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_batch_impl(distr, engines, n, r, stride, dependencies);
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const bernoulli<std::int32_t, bernoulli_method::icdf>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, std::int32_t* r,
+        std::int64_t stride, const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_batch_impl(distr, engines, n, r, stride, dependencies);
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const bernoulli<std::uint32_t, bernoulli_method::icdf>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, std::uint32_t* r,
+        std::int64_t stride, const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_batch_impl(distr, engines, n, r, stride, dependencies);
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const poisson<std::int32_t, poisson_method::gaussian_icdf_based>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, std::int32_t* r,
+        std::int64_t stride, const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_batch_impl(distr, engines, n, r, stride, dependencies);
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const poisson<std::uint32_t, poisson_method::gaussian_icdf_based>& distr,
+        const std::vector<engine_impl*>& engines, std::int64_t n, std::uint32_t* r,
+        std::int64_t stride, const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_batch_impl(distr, engines, n, r, stride, dependencies);
+    }
+
+    virtual cl::sycl::event generate_batch(
+        const bits<std::uint32_t>& distr, const std::vector<engine_impl*>& engines, std::int64_t n,
+        std::uint32_t* r, std::int64_t stride,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_batch_impl(distr, engines, n, r, stride, dependencies);
+    }
+
+protected:
+    VSLStreamStatePtr stream_;
+    std::int32_t state_size_;
+
+private:
+    static std::vector<VSLStreamStatePtr> get_streams(
+        const std::vector<oneapi::mkl::rng::detail::engine_impl*>& engines) {
+        std::vector<VSLStreamStatePtr> streams(engines.size());
+        for (std::size_t i = 0; i < engines.size(); i++) {
+            auto engine = dynamic_cast<vsl_engine_impl*>(engines[i]);
+            if (engine == nullptr) {
+                throw oneapi::mkl::invalid_argument("rng", "generate_batch",
+                                                    "engines belong to different backends");
+            }
+            streams[i] = engine->stream_;
+        }
+        // Two entries of one engine would generate from the same stream concurrently
+        auto sorted = streams;
+        std::sort(sorted.begin(), sorted.end());
+        if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end()) {
+            throw oneapi::mkl::invalid_argument("rng", "generate_batch",
+                                                "the same engine appears twice in the batch");
+        }
+        return streams;
+    }
+
+    template <typename Distr, typename T>
+    void generate_batch_impl(const Distr& distr,
+                             const std::vector<oneapi::mkl::rng::detail::engine_impl*>& engines,
+                             std::int64_t n, cl::sycl::buffer<T, 1>& r, std::int64_t stride) {
+        auto streams = get_streams(engines);
+        // As in the non-batched buffer API, the state of every engine is accessed through a
+        //  buffer, so failed VSL calls reach the queue's asynchronous handler
+        using stream_accessor =
+            cl::sycl::accessor<char, 1, cl::sycl::access::mode::read_write,
+                               cl::sycl::access::target::global_buffer>;
+        std::vector<cl::sycl::buffer<char, 1>> stream_bufs;
+        stream_bufs.reserve(engines.size());
+        for (std::size_t i = 0; i < engines.size(); i++) {
+            auto engine = static_cast<vsl_engine_impl*>(engines[i]);
+            stream_bufs.emplace_back(static_cast<char*>(streams[i]), engine->state_size_);
+        }
+        queue_.submit([&](cl::sycl::handler& cgh) {
+            std::vector<stream_accessor> acc_streams;
+            for (auto& stream_buf : stream_bufs) {
+                acc_streams.push_back(
+                    stream_buf.get_access<cl::sycl::access::mode::read_write>(cgh));
+            }
+            auto acc_r = r.template get_access<cl::sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name_batch<vsl_engine_impl, Distr>>(cgh, [=]() {
+                std::vector<VSLStreamStatePtr> states(acc_streams.size());
+                for (std::size_t i = 0; i < acc_streams.size(); i++) {
+                    states[i] = static_cast<VSLStreamStatePtr>(
+                        acc_streams[i].get_pointer().get());
+                }
+                generate_batch_host(distr, states, n, acc_r.get_pointer().get(), stride);
+            });
+        });
+    }
+
+    template <typename Distr, typename T>
+    cl::sycl::event generate_batch_impl(
+        const Distr& distr, const std::vector<oneapi::mkl::rng::detail::engine_impl*>& engines,
+        std::int64_t n, T* r, std::int64_t stride,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) {
+        auto streams = get_streams(engines);
+        cl::sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](cl::sycl::handler& cgh) {
+            host_task<kernel_name_batch_usm<vsl_engine_impl, Distr>>(
+                cgh, [=]() { generate_batch_host(distr, streams, n, r, stride); });
+        });
+    }
+};
+
+
+// Single-engine APIs of an mklcpu engine whose state is one VSL stream, Engine is the derived
+//  class and names the kernels. Failed VSL calls throw through the queue.
+template <typename Engine>
+class vsl_stream_engine_impl : public vsl_engine_impl {
+public:
+    vsl_stream_engine_impl(cl::sycl::queue queue) : vsl_engine_impl(queue) {}
+
+    vsl_stream_engine_impl(const vsl_stream_engine_impl& other) : vsl_engine_impl(other) {}
+
+    // Buffers APIs
+
+    virtual void generate(const uniform<float, uniform_method::standard>& distr, std::int64_t n,
+                          cl::sycl::buffer<float, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const uniform<double, uniform_method::standard>& distr, std::int64_t n,
+                          cl::sycl::buffer<double, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const uniform<std::int32_t, uniform_method::standard>& distr,
+                          std::int64_t n, cl::sycl::buffer<std::int32_t, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const uniform<float, uniform_method::accurate>& distr, std::int64_t n,
+                          cl::sycl::buffer<float, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const uniform<double, uniform_method::accurate>& distr, std::int64_t n,
+                          cl::sycl::buffer<double, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const gaussian<float, gaussian_method::box_muller2>& distr,
+                          std::int64_t n, cl::sycl::buffer<float, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const gaussian<double, gaussian_method::box_muller2>& distr,
+                          std::int64_t n, cl::sycl::buffer<double, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const gaussian<float, gaussian_method::icdf>& distr, std::int64_t n,
+                          cl::sycl::buffer<float, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const gaussian<double, gaussian_method::icdf>& distr, std::int64_t n,
+                          cl::sycl::buffer<double, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const lognormal<float, lognormal_method::box_muller2>& distr,
+                          std::int64_t n, cl::sycl::buffer<float, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const lognormal<double, lognormal_method::box_muller2>& distr,
+                          std::int64_t n, cl::sycl::buffer<double, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const lognormal<float, lognormal_method::icdf>& distr, std::int64_t n,
+                          cl::sycl::buffer<float, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const lognormal<double, lognormal_method::icdf>& distr, std::int64_t n,
+                          cl::sycl::buffer<double, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const bernoulli<std::int32_t, bernoulli_method::icdf>& distr,
+                          std::int64_t n, cl::sycl::buffer<std::int32_t, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const bernoulli<std::uint32_t, bernoulli_method::icdf>& distr,
+                          std::int64_t n, cl::sycl::buffer<std::uint32_t, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const poisson<std::int32_t, poisson_method::gaussian_icdf_based>& distr,
+                          std::int64_t n, cl::sycl::buffer<std::int32_t, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const poisson<std::uint32_t, poisson_method::gaussian_icdf_based>& distr,
+                          std::int64_t n, cl::sycl::buffer<std::uint32_t, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const bits<std::uint32_t>& distr, std::int64_t n,
+                          cl::sycl::buffer<std::uint32_t, 1>& r) override {
+        generate_impl(distr, n, r);
+    }
+
+    virtual void generate(const bernoulli_v<std::int32_t, bernoulli_v_method::icdf>& distr,
+                          std::int64_t n, cl::sycl::buffer<std::int32_t, 1>& r) override {
+        generate_v_impl(distr, n, r, *distr.p_buffer());
+    }
+
+    virtual void generate(const bernoulli_v<std::uint32_t, bernoulli_v_method::icdf>& distr,
+                          std::int64_t n, cl::sycl::buffer<std::uint32_t, 1>& r) override {
+        generate_v_impl(distr, n, r, *distr.p_buffer());
+    }
+
+    virtual void generate(
+        const poisson_v<std::int32_t, poisson_v_method::gaussian_icdf_based>& distr,
+        std::int64_t n, cl::sycl::buffer<std::int32_t, 1>& r) override {
+        generate_v_impl(distr, n, r, *distr.lambda_buffer());
+    }
+
+    virtual void generate(
+        const poisson_v<std::uint32_t, poisson_v_method::gaussian_icdf_based>& distr,
+        std::int64_t n, cl::sycl::buffer<std::uint32_t, 1>& r) override {
+        generate_v_impl(distr, n, r, *distr.lambda_buffer());
+    }
+
+    // USM APIs
+
+    virtual cl::sycl::event generate(
+        const uniform<float, uniform_method::standard>& distr, std::int64_t n, float* r,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual cl::sycl::event generate(
+        const uniform<double, uniform_method::standard>& distr, std::int64_t n, double* r,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual cl::sycl::event generate(
+        const uniform<std::int32_t, uniform_method::standard>& distr, std::int64_t n,
+        std::int32_t* r, const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual cl::sycl::event generate(
+        const uniform<float, uniform_method::accurate>& distr, std::int64_t n, float* r,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual cl::sycl::event generate(
+        const uniform<double, uniform_method::accurate>& distr, std::int64_t n, double* r,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual cl::sycl::event generate(
+        const gaussian<float, gaussian_method::box_muller2>& distr, std::int64_t n, float* r,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual cl::sycl::event generate(
+        const gaussian<double, gaussian_method::box_muller2>& distr, std::int64_t n, double* r,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual cl::sycl::event generate(
+        const gaussian<float, gaussian_method::icdf>& distr, std::int64_t n, float* r,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual cl::sycl::event generate(
+        const gaussian<double, gaussian_method::icdf>& distr, std::int64_t n, double* r,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual cl::sycl::event generate(
+        const lognormal<float, lognormal_method::box_muller2>& distr, std::int64_t n, float* r,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual cl::sycl::event generate(
+        const lognormal<double, lognormal_method::box_muller2>& distr, std::int64_t n, double* r,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual cl::sycl::event generate(
+        const lognormal<float, lognormal_method::icdf>& distr, std::int64_t n, float* r,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual cl::sycl::event generate(
+        const lognormal<double, lognormal_method::icdf>& distr, std::int64_t n, double* r,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual cl::sycl::event generate(
+        const bernoulli<std::int32_t, bernoulli_method::icdf>& distr, std::int64_t n,
+        std::int32_t* r, const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual cl::sycl::event generate(
+        const bernoulli<std::uint32_t, bernoulli_method::icdf>& distr, std::int64_t n,
+        std::uint32_t* r, const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual cl::sycl::event generate(
+        const poisson<std::int32_t, poisson_method::gaussian_icdf_based>& distr, std::int64_t n,
+        std::int32_t* r, const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual cl::sycl::event generate(
+        const poisson<std::uint32_t, poisson_method::gaussian_icdf_based>& distr, std::int64_t n,
+        std::uint32_t* r, const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual cl::sycl::event generate(
+        const bits<std::uint32_t>& distr, std::int64_t n, std::uint32_t* r,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_impl(distr, n, r, dependencies);
+    }
+
+    virtual cl::sycl::event generate(
+        const bernoulli_v<std::int32_t, bernoulli_v_method::icdf>& distr, std::int64_t n,
+        std::int32_t* r, const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_v_impl(distr, n, r, distr.p(), dependencies);
+    }
+
+    virtual cl::sycl::event generate(
+        const bernoulli_v<std::uint32_t, bernoulli_v_method::icdf>& distr, std::int64_t n,
+        std::uint32_t* r, const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_v_impl(distr, n, r, distr.p(), dependencies);
+    }
+
+    virtual cl::sycl::event generate(
+        const poisson_v<std::int32_t, poisson_v_method::gaussian_icdf_based>& distr,
+        std::int64_t n, std::int32_t* r,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_v_impl(distr, n, r, distr.lambda(), dependencies);
+    }
+
+    virtual cl::sycl::event generate(
+        const poisson_v<std::uint32_t, poisson_v_method::gaussian_icdf_based>& distr,
+        std::int64_t n, std::uint32_t* r,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        return generate_v_impl(distr, n, r, distr.lambda(), dependencies);
+    }
+
+private:
+    template <typename Distr, typename T>
+    void generate_impl(const Distr& distr, std::int64_t n, cl::sycl::buffer<T, 1>& r) {
+        cl::sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](cl::sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<cl::sycl::access::mode::read_write>(cgh);
+            auto acc_r = r.template get_access<cl::sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<Engine, Distr>>(cgh, [=]() {
+                auto stream = static_cast<VSLStreamStatePtr>(acc_stream.get_pointer().get());
+                check_vsl_status(vsl_generate(stream, distr, n, acc_r.get_pointer().get()),
+                                 "generate");
+            });
+        });
+    }
+
+    template <typename Distr, typename T, typename P>
+    void generate_v_impl(const Distr&, std::int64_t n, cl::sycl::buffer<T, 1>& r,
+                         cl::sycl::buffer<P, 1>& params) {
+        cl::sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
+        queue_.submit([&](cl::sycl::handler& cgh) {
+            auto acc_stream = stream_buf.get_access<cl::sycl::access::mode::read_write>(cgh);
+            auto acc_params = params.template get_access<cl::sycl::access::mode::read>(cgh);
+            auto acc_r = r.template get_access<cl::sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<Engine, Distr>>(cgh, [=]() {
+                auto stream = static_cast<VSLStreamStatePtr>(acc_stream.get_pointer().get());
+                const P* params_ptr = acc_params.get_pointer().get();
+                check_vsl_status(vsl_generate_v(stream, n, acc_r.get_pointer().get(), params_ptr),
+                                 "generate");
+            });
+        });
+    }
+
+    template <typename Distr, typename T>
+    cl::sycl::event generate_impl(const Distr& distr, std::int64_t n, T* r,
+                                  const cl::sycl::vector_class<cl::sycl::event>& dependencies) {
+        cl::sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](cl::sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<Engine, Distr>>(cgh, [=]() {
+                check_vsl_status(vsl_generate(stream, distr, n, r), "generate");
+            });
+        });
+    }
+
+    template <typename Distr, typename T, typename P>
+    cl::sycl::event generate_v_impl(const Distr&, std::int64_t n, T* r, const P* params,
+                                    const cl::sycl::vector_class<cl::sycl::event>& dependencies) {
+        cl::sycl::event::wait_and_throw(dependencies);
+        return queue_.submit([&](cl::sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<Engine, Distr>>(cgh, [=]() {
+                check_vsl_status(vsl_generate_v(stream, n, r, params), "generate");
+            });
+        });
+    }
+};
+
+} // namespace mklcpu
+} // namespace rng
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_RNG_CPU_VSL_ENGINE_IMPL_HPP_
@@ -25,5 +25,7 @@
 extern "C" ONEMKL_EXPORT rng_function_table_t mkl_rng_table = {
     WRAPPER_VERSION, oneapi::mkl::rng::mklgpu::create_philox4x32x10,
     oneapi::mkl::rng::mklgpu::create_philox4x32x10, oneapi::mkl::rng::mklgpu::create_mrg32k3a,
-    oneapi::mkl::rng::mklgpu::create_mrg32k3a
+    oneapi::mkl::rng::mklgpu::create_mrg32k3a, oneapi::mkl::rng::mklgpu::create_sobol,
+    oneapi::mkl::rng::mklgpu::create_sobol, oneapi::mkl::rng::mklgpu::create_niederreiter,
+    oneapi::mkl::rng::mklgpu::create_niederreiter
 };
@@ -0,0 +1,46 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <vector>
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/rng/detail/engine_impl.hpp"
+#include "oneapi/mkl/rng/detail/mklgpu/onemkl_rng_mklgpu.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace rng {
+namespace mklgpu {
+
+oneapi::mkl::rng::detail::engine_impl* create_niederreiter(cl::sycl::queue queue,
+                                                            std::uint32_t dimensions) {
+    throw oneapi::mkl::unimplemented("rng", "niederreiter engine");
+}
+
+oneapi::mkl::rng::detail::engine_impl* create_niederreiter(
+    cl::sycl::queue queue, std::uint32_t dimensions,
+    const std::vector<std::uint32_t>& direction_numbers) {
+    throw oneapi::mkl::unimplemented("rng", "niederreiter engine");
+}
+
+} // namespace mklgpu
+} // namespace rng
+} // namespace mkl
+} // namespace oneapi
@@ -161,6 +161,28 @@ public:
         oneapi::mkl::rng::detail::gpu::generate(queue_, distr, engine_, n, r);
     }
 
+    virtual void generate(const bernoulli_v<std::int32_t, bernoulli_v_method::icdf>& distr,
+                          std::int64_t n, cl::sycl::buffer<std::int32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "bernoulli_v");
+    }
+
+    virtual void generate(const bernoulli_v<std::uint32_t, bernoulli_v_method::icdf>& distr,
+                          std::int64_t n, cl::sycl::buffer<std::uint32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "bernoulli_v");
+    }
+
+    virtual void generate(
+        const poisson_v<std::int32_t, poisson_v_method::gaussian_icdf_based>& distr,
+        std::int64_t n, cl::sycl::buffer<std::int32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "poisson_v");
+    }
+
+    virtual void generate(
+        const poisson_v<std::uint32_t, poisson_v_method::gaussian_icdf_based>& distr,
+        std::int64_t n, cl::sycl::buffer<std::uint32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "poisson_v");
+    }
+
     // USM APIs
 
     virtual cl::sycl::event generate(
@@ -290,6 +312,32 @@ public:
         return oneapi::mkl::rng::detail::gpu::generate(queue_, distr, engine_, n, r, dependencies);
     }
 
+    virtual cl::sycl::event generate(
+        const bernoulli_v<std::int32_t, bernoulli_v_method::icdf>& distr, std::int64_t n,
+        std::int32_t* r, const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "bernoulli_v");
+    }
+
+    virtual cl::sycl::event generate(
+        const bernoulli_v<std::uint32_t, bernoulli_v_method::icdf>& distr, std::int64_t n,
+        std::uint32_t* r, const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "bernoulli_v");
+    }
+
+    virtual cl::sycl::event generate(
+        const poisson_v<std::int32_t, poisson_v_method::gaussian_icdf_based>& distr,
+        std::int64_t n, std::int32_t* r,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "poisson_v");
+    }
+
+    virtual cl::sycl::event generate(
+        const poisson_v<std::uint32_t, poisson_v_method::gaussian_icdf_based>& distr,
+        std::int64_t n, std::uint32_t* r,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "poisson_v");
+    }
+
     virtual oneapi::mkl::rng::detail::engine_impl* copy_state() override {
         return new philox4x32x10_impl(this);
     }
@@ -436,6 +484,28 @@ public:
         throw oneapi::mkl::unimplemented("rng", "philox4x32x10 engine");
     }
 
+    virtual void generate(const bernoulli_v<std::int32_t, bernoulli_v_method::icdf>& distr,
+                          std::int64_t n, cl::sycl::buffer<std::int32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "bernoulli_v");
+    }
+
+    virtual void generate(const bernoulli_v<std::uint32_t, bernoulli_v_method::icdf>& distr,
+                          std::int64_t n, cl::sycl::buffer<std::uint32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "bernoulli_v");
+    }
+
+    virtual void generate(
+        const poisson_v<std::int32_t, poisson_v_method::gaussian_icdf_based>& distr,
+        std::int64_t n, cl::sycl::buffer<std::int32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "poisson_v");
+    }
+
+    virtual void generate(
+        const poisson_v<std::uint32_t, poisson_v_method::gaussian_icdf_based>& distr,
+        std::int64_t n, cl::sycl::buffer<std::uint32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "poisson_v");
+    }
+
     // USM APIs
 
     virtual cl::sycl::event generate(
@@ -582,6 +652,32 @@ public:
         return cl::sycl::event{};
     }
 
+    virtual cl::sycl::event generate(
+        const bernoulli_v<std::int32_t, bernoulli_v_method::icdf>& distr, std::int64_t n,
+        std::int32_t* r, const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "bernoulli_v");
+    }
+
+    virtual cl::sycl::event generate(
+        const bernoulli_v<std::uint32_t, bernoulli_v_method::icdf>& distr, std::int64_t n,
+        std::uint32_t* r, const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "bernoulli_v");
+    }
+
+    virtual cl::sycl::event generate(
+        const poisson_v<std::int32_t, poisson_v_method::gaussian_icdf_based>& distr,
+        std::int64_t n, std::int32_t* r,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "poisson_v");
+    }
+
+    virtual cl::sycl::event generate(
+        const poisson_v<std::uint32_t, poisson_v_method::gaussian_icdf_based>& distr,
+        std::int64_t n, std::uint32_t* r,
+        const cl::sycl::vector_class<cl::sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "poisson_v");
+    }
+
     virtual oneapi::mkl::rng::detail::engine_impl* copy_state() override {
         throw oneapi::mkl::unimplemented("rng", "philox4x32x10 engine");
         return nullptr;
@@ -21,6 +21,7 @@
 #define _RNG_FUNCTION_TABLE_HPP_
 
 #include <cstdint>
+#include <vector>
 #include <CL/sycl.hpp>
 
 #include "oneapi/mkl/rng/detail/engine_impl.hpp"
@@ -37,6 +38,18 @@ typedef struct {
                                                                    std::uint32_t seed);
     oneapi::mkl::rng::detail::engine_impl* (*create_mrg32k3a_ex_sycl)(
         cl::sycl::queue queue, std::initializer_list<std::uint32_t> seed);
+
+    oneapi::mkl::rng::detail::engine_impl* (*create_sobol_sycl)(cl::sycl::queue queue,
+                                                                std::uint32_t dimensions);
+    oneapi::mkl::rng::detail::engine_impl* (*create_sobol_ex_sycl)(
+        cl::sycl::queue queue, std::uint32_t dimensions,
+        const std::vector<std::uint32_t>& direction_numbers);
+
+    oneapi::mkl::rng::detail::engine_impl* (*create_niederreiter_sycl)(cl::sycl::queue queue,
+                                                                       std::uint32_t dimensions);
+    oneapi::mkl::rng::detail::engine_impl* (*create_niederreiter_ex_sycl)(
+        cl::sycl::queue queue, std::uint32_t dimensions,
+        const std::vector<std::uint32_t>& direction_numbers);
 } rng_function_table_t;
 
 #endif //_RNG_FUNCTION_TABLE_HPP_
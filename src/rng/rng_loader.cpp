@@ -29,24 +29,83 @@ namespace detail {
 
 static oneapi::mkl::detail::table_initializer<domain::rng, rng_function_table_t> function_tables;
 
+namespace verbose = oneapi::mkl::detail::verbose;
+namespace stats = oneapi::mkl::detail::stats;
+static constexpr verbose::site trace_site{ domain::rng, nullptr };
+
 engine_impl* create_philox4x32x10(oneapi::mkl::device libkey, cl::sycl::queue queue,
                                   std::uint64_t seed) {
-    return function_tables[libkey].create_philox4x32x10_sycl(queue, seed);
+    static stats::routine routine{ trace_site, "create_philox4x32x10", "seed" };
+    auto shape = verbose::make_dims(seed);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.create_philox4x32x10_sycl)(queue, seed);
+    });
 }
 
 engine_impl* create_philox4x32x10(oneapi::mkl::device libkey, cl::sycl::queue queue,
                                   std::initializer_list<std::uint64_t> seed) {
-    return function_tables[libkey].create_philox4x32x10_ex_sycl(queue, seed);
+    static stats::routine routine{ trace_site, "create_philox4x32x10_ex", "" };
+    auto shape = verbose::make_dims();
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.create_philox4x32x10_ex_sycl)(queue, seed);
+    });
 }
 
 engine_impl* create_mrg32k3a(oneapi::mkl::device libkey, cl::sycl::queue queue,
                              std::uint32_t seed) {
-    return function_tables[libkey].create_mrg32k3a_sycl(queue, seed);
+    static stats::routine routine{ trace_site, "create_mrg32k3a", "seed" };
+    auto shape = verbose::make_dims(seed);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.create_mrg32k3a_sycl)(queue, seed);
+    });
 }
 
 engine_impl* create_mrg32k3a(oneapi::mkl::device libkey, cl::sycl::queue queue,
                              std::initializer_list<std::uint32_t> seed) {
-    return function_tables[libkey].create_mrg32k3a_ex_sycl(queue, seed);
+    static stats::routine routine{ trace_site, "create_mrg32k3a_ex", "" };
+    auto shape = verbose::make_dims();
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.create_mrg32k3a_ex_sycl)(queue, seed);
+    });
+}
+
+engine_impl* create_sobol(oneapi::mkl::device libkey, cl::sycl::queue queue,
+                          std::uint32_t dimensions) {
+    static stats::routine routine{ trace_site, "create_sobol", "dimensions" };
+    auto shape = verbose::make_dims(dimensions);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.create_sobol_sycl)(queue, dimensions);
+    });
+}
+
+engine_impl* create_sobol(oneapi::mkl::device libkey, cl::sycl::queue queue,
+                          std::uint32_t dimensions,
+                          const std::vector<std::uint32_t>& direction_numbers) {
+    static stats::routine routine{ trace_site, "create_sobol_ex", "dimensions" };
+    auto shape = verbose::make_dims(dimensions);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.create_sobol_ex_sycl)(queue, dimensions, direction_numbers);
+    });
+}
+
+engine_impl* create_niederreiter(oneapi::mkl::device libkey, cl::sycl::queue queue,
+                                 std::uint32_t dimensions) {
+    static stats::routine routine{ trace_site, "create_niederreiter", "dimensions" };
+    auto shape = verbose::make_dims(dimensions);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.create_niederreiter_sycl)(queue, dimensions);
+    });
+}
+
+engine_impl* create_niederreiter(oneapi::mkl::device libkey, cl::sycl::queue queue,
+                                 std::uint32_t dimensions,
+                                 const std::vector<std::uint32_t>& direction_numbers) {
+    static stats::routine routine{ trace_site, "create_niederreiter_ex", "dimensions" };
+    auto shape = verbose::make_dims(dimensions);
+    return function_tables.call(routine, libkey, queue, shape, [&](auto &table) {
+        return routine.require(table.create_niederreiter_ex_sycl)(queue, dimensions,
+                                                                  direction_numbers);
+    });
 }
 
 } // namespace detail
@@ -0,0 +1,235 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "oneapi/mkl/stats.hpp"
+#include "stats_helper.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace detail {
+namespace stats {
+
+namespace {
+
+std::atomic<routine *> routines{ nullptr };
+
+// Libraries of the backends after the first one of each device, by domain,
+// device and backend.
+std::mutex backends_mutex;
+std::map<std::tuple<oneapi::mkl::domain, oneapi::mkl::device, int>, std::string> backends;
+
+std::string backend_name(oneapi::mkl::domain domain, oneapi::mkl::device libkey, int backend) {
+    if (backend == 0)
+        return verbose::backend_name(domain, libkey);
+    std::lock_guard<std::mutex> lock(backends_mutex);
+    auto found = backends.find({ domain, libkey, backend });
+    return found != backends.end() ? found->second : std::string();
+}
+
+} // namespace
+
+void estimate(work kind, const shape &s, double &flops, double &elements) {
+    const double m = s.m, n = s.n, k = s.k, nrhs = s.nrhs;
+    const double lo = std::min(m, n), hi = std::max(m, n);
+    const double side = s.left ? m : n;
+    switch (kind) {
+        case work::asum: flops = n, elements = n; break;
+        case work::axpy: flops = 2 * n, elements = 3 * n; break;
+        case work::copy: flops = 0, elements = 2 * n; break;
+        case work::dot: flops = 2 * n, elements = 2 * n; break;
+        case work::iamax: flops = n, elements = n; break;
+        case work::nrm2: flops = 2 * n, elements = n; break;
+        case work::rot: flops = 6 * n, elements = 4 * n; break;
+        case work::scal: flops = n, elements = 2 * n; break;
+        case work::swap: flops = 0, elements = 4 * n; break;
+        case work::gemv: flops = 2 * m * n, elements = m * n + n + 2 * m; break;
+        case work::gbmv:
+            flops = 2 * n * (s.kl + s.ku + 1);
+            elements = n * (s.kl + s.ku + 1) + n + 2 * m;
+            break;
+        case work::ger: flops = 2 * m * n, elements = 2 * m * n + m + n; break;
+        case work::symv: flops = 2 * n * n, elements = n * n / 2 + 3 * n; break;
+        case work::sbmv: flops = 2 * n * (2 * k + 1), elements = n * (k + 1) + 3 * n; break;
+        case work::syr: flops = n * n, elements = n * n + n; break;
+        case work::syr2: flops = 2 * n * n, elements = n * n + 2 * n; break;
+        case work::trmv: flops = n * n, elements = n * n / 2 + 2 * n; break;
+        case work::tbmv: flops = n * (2 * k + 1), elements = n * (k + 1) + 2 * n; break;
+        case work::gemm: flops = 2 * m * n * k, elements = m * k + k * n + 2 * m * n; break;
+        case work::gemmt: flops = n * n * k, elements = 2 * n * k + n * n; break;
+        case work::symm: flops = 2 * m * n * side, elements = side * side + 3 * m * n; break;
+        case work::syrk: flops = n * n * k, elements = n * k + n * n; break;
+        case work::syr2k: flops = 2 * n * n * k, elements = 2 * n * k + n * n; break;
+        case work::trmm: flops = m * n * side, elements = side * side / 2 + 2 * m * n; break;
+        case work::getrf: flops = hi * lo * lo - lo * lo * lo / 3, elements = 2 * m * n; break;
+        case work::getrs: flops = 2 * n * n * nrhs, elements = n * n + 2 * n * nrhs; break;
+        case work::getri: flops = 4 * n * n * n / 3, elements = 2 * n * n; break;
+        case work::potrf: flops = n * n * n / 3, elements = n * n; break;
+        case work::potri: flops = 2 * n * n * n / 3, elements = n * n; break;
+        case work::trtrs: flops = n * n * nrhs, elements = n * n / 2 + 2 * n * nrhs; break;
+        case work::geqrf:
+            flops = 2 * hi * lo * lo - 2 * lo * lo * lo / 3;
+            elements = 2 * m * n;
+            break;
+        case work::orgqr:
+            flops = 4 * m * n * k - 2 * (m + n) * k * k + 4 * k * k * k / 3;
+            elements = 2 * m * n;
+            break;
+        case work::orgtr: flops = 4 * n * n * n / 3, elements = 2 * n * n; break;
+        case work::ormqr:
+            flops = 4 * m * n * k - 2 * (s.left ? n : m) * k * k;
+            elements = 2 * m * n + side * k;
+            break;
+        case work::ormtr: flops = 2 * m * n * side, elements = 2 * m * n + side * side; break;
+        case work::sytrd: flops = 4 * n * n * n / 3, elements = n * n; break;
+        case work::gebrd:
+            flops = 4 * hi * lo * lo - 4 * lo * lo * lo / 3;
+            elements = 2 * m * n;
+            break;
+        case work::sytrf: flops = n * n * n / 3, elements = n * n; break;
+        case work::syevd:
+            flops = (s.vectors ? 9.0 : 4.0 / 3) * n * n * n;
+            elements = n * n + n;
+            break;
+        case work::sygvd:
+            flops = (s.vectors ? 9.0 : 4.0 / 3) * n * n * n + 4 * n * n * n / 3;
+            elements = 2 * n * n + n;
+            break;
+        case work::gesv:
+            flops = 2 * n * n * n / 3 + 2 * n * n * nrhs;
+            elements = n * n + 2 * n * nrhs;
+            break;
+        case work::posv:
+            flops = n * n * n / 3 + 2 * n * n * nrhs;
+            elements = n * n + 2 * n * nrhs;
+            break;
+        case work::gels:
+            flops = 2 * hi * lo * lo - 2 * lo * lo * lo / 3 + 4 * hi * lo * nrhs;
+            elements = m * n + 2 * hi * nrhs;
+            break;
+        default: flops = 0, elements = 0; break;
+    }
+}
+
+void register_backend(oneapi::mkl::domain domain, oneapi::mkl::device libkey, int backend,
+                      const char *library) {
+    std::lock_guard<std::mutex> lock(backends_mutex);
+    backends[{ domain, libkey, backend }] = library;
+}
+
+routine::routine(const verbose::site &where, const char *name, const char *dims, kind k)
+        : verbose::routine_info{ where, name, dims },
+          kind_(k) {
+    static const struct {
+        const char *name;
+        arg a;
+    } names[] = { { "m", arg_m },           { "n", arg_n },       { "k", arg_k },
+                  { "nrhs", arg_nrhs },     { "kl", arg_kl },     { "ku", arg_ku },
+                  { "side", arg_side },     { "left_right", arg_side },
+                  { "jobz", arg_job },      { "batch_size", arg_batch } };
+    std::fill(slots_, slots_ + num_args, std::int8_t(-1));
+    std::int8_t position = 0;
+    for (const char *p = dims; *p != '\0'; position++) {
+        while (*p == ' ')
+            p++;
+        const char *last = p;
+        while (*last != ' ' && *last != '\0')
+            last++;
+        for (const auto &n : names) {
+            if (std::strlen(n.name) == std::size_t(last - p) &&
+                std::strncmp(n.name, p, last - p) == 0)
+                slots_[n.a] = position;
+        }
+        p = last;
+    }
+    sized_ = slots_[arg_m] >= 0 || slots_[arg_n] >= 0 || slots_[arg_k] >= 0;
+    clear();
+    for (auto &c : choices_)
+        c.store(-1, std::memory_order_relaxed);
+
+    next_ = routines.load(std::memory_order_relaxed);
+    while (!routines.compare_exchange_weak(next_, this, std::memory_order_release,
+                                           std::memory_order_relaxed))
+        ;
+}
+
+void routine::clear() {
+    for (auto &device : counters_) {
+        for (auto &c : device) {
+            c.calls.store(0, std::memory_order_relaxed);
+            c.flops.store(0, std::memory_order_relaxed);
+            c.bytes.store(0, std::memory_order_relaxed);
+            for (auto &h : c.histogram)
+                h.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+} // namespace stats
+} // namespace detail
+
+namespace stats {
+
+std::vector<routine_stats> snapshot() {
+    std::vector<routine_stats> result;
+    auto *r = detail::stats::routines.load(std::memory_order_acquire);
+    for (; r != nullptr; r = r->next()) {
+        for (int device = 0; device < detail::stats::num_devices; device++) {
+            for (int backend = 0; backend < detail::stats::max_backends; backend++) {
+                auto &c = r->get(device, backend);
+                const std::int64_t calls = c.calls.load(std::memory_order_relaxed);
+                if (calls == 0)
+                    continue;
+                const auto libkey = static_cast<oneapi::mkl::device>(device);
+                routine_stats s;
+                s.domain = detail::verbose::domain_name(r->where.domain);
+                s.routine = r->name;
+                s.layout = r->where.layout != nullptr ? r->where.layout : "";
+                s.device = detail::verbose::device_name(libkey);
+                s.backend = detail::stats::backend_name(r->where.domain, libkey, backend);
+                s.calls = calls;
+                s.flops = static_cast<double>(c.flops.load(std::memory_order_relaxed));
+                s.bytes = static_cast<double>(c.bytes.load(std::memory_order_relaxed));
+                for (int b = 0; b < size_buckets; b++)
+                    s.size_histogram[b] = c.histogram[b].load(std::memory_order_relaxed);
+                result.push_back(std::move(s));
+            }
+        }
+    }
+    return result;
+}
+
+void reset() {
+    auto *r = detail::stats::routines.load(std::memory_order_acquire);
+    for (; r != nullptr; r = r->next())
+        r->clear();
+}
+
+} // namespace stats
+} // namespace mkl
+} // namespace oneapi
@@ -0,0 +1,83 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+#include "oneapi/mkl/detail/export.hpp"
+#include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/threading_layer.hpp"
+#include "threading_layer_helper.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace detail {
+namespace threading {
+
+namespace {
+
+threading_layer layer_from_environment() {
+    const char *env = std::getenv("ONEMKL_THREADING_LAYER");
+    if (env == nullptr)
+        return threading_layer::mkl_default;
+    if (std::strcmp(env, "sequential") == 0)
+        return threading_layer::sequential;
+    if (std::strcmp(env, "intel") == 0)
+        return threading_layer::intel;
+    if (std::strcmp(env, "gnu") == 0)
+        return threading_layer::gnu;
+    if (std::strcmp(env, "tbb") == 0)
+        return threading_layer::tbb;
+    return threading_layer::mkl_default;
+}
+
+std::mutex mutex;
+threading_layer selected = layer_from_environment();
+
+// Whether a backend has read the selected layer.
+bool taken = false;
+
+} // namespace
+
+} // namespace threading
+} // namespace detail
+
+void set_threading_layer(threading_layer layer) {
+    std::lock_guard<std::mutex> lock(detail::threading::mutex);
+    if (detail::threading::taken && layer != detail::threading::selected)
+        throw oneapi::mkl::invalid_argument(
+            "", "set_threading_layer", "an MKL CPU backend already runs with another layer");
+    detail::threading::selected = layer;
+}
+
+threading_layer get_threading_layer() {
+    std::lock_guard<std::mutex> lock(detail::threading::mutex);
+    return detail::threading::selected;
+}
+
+} // namespace mkl
+} // namespace oneapi
+
+// Looked up by the MKL CPU backends, see threading_layer_helper.hpp.
+extern "C" ONEMKL_EXPORT int onemkl_threading_layer() {
+    std::lock_guard<std::mutex> lock(oneapi::mkl::detail::threading::mutex);
+    oneapi::mkl::detail::threading::taken = true;
+    return static_cast<int>(oneapi::mkl::detail::threading::selected);
+}
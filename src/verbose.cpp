@@ -0,0 +1,345 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN64
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl/verbose.hpp"
+#include "verbose_helper.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace detail {
+namespace verbose {
+
+std::atomic<int> active{ 0 };
+
+namespace {
+
+// Pending records are written out, without waiting on their events, once
+// there are this many of them.
+constexpr std::size_t write_threshold = 4096;
+
+// Thread id of the device execution track in the trace.
+constexpr std::uint32_t device_track = 0;
+
+// A recorded call. The names are copied out of the routine, whose loader
+// static may be destroyed before the trace; they point to string literals.
+struct entry {
+    const char *name;
+    const char *arg_names;
+    oneapi::mkl::domain domain;
+    const char *layout;
+    oneapi::mkl::device libkey;
+    dims args;
+    std::int64_t start;
+    std::int64_t end;
+    std::uint32_t thread;
+    bool profiled;
+    sycl::event event;
+};
+
+int process_id() {
+#ifdef _WIN64
+    return _getpid();
+#else
+    return getpid();
+#endif
+}
+
+std::uint32_t thread_id() {
+    static std::atomic<std::uint32_t> next{ device_track + 1 };
+    thread_local const std::uint32_t id = next++;
+    return id;
+}
+
+void write_string(std::FILE *file, const char *s) {
+    std::fputc('"', file);
+    for (; *s != '\0'; s++) {
+        if (*s == '"' || *s == '\\')
+            std::fputc('\\', file);
+        std::fputc(*s, file);
+    }
+    std::fputc('"', file);
+}
+
+class trace_log;
+trace_log &trace();
+
+class trace_log {
+public:
+    trace_log() : origin_(std::chrono::steady_clock::now()), pid_(process_id()) {
+        const char *env = std::getenv("ONEMKL_VERBOSE");
+        if (env != nullptr && std::atoi(env) > 0)
+            start("");
+    }
+
+    // The SYCL runtime may be gone by the time static objects are destroyed, so
+    // the records left are written without their device execution. Records of
+    // profiled events are flushed earlier, by an exit handler.
+    ~trace_log() {
+        active.fetch_and(~trace_sink);
+        std::lock_guard<std::mutex> lock(mutex_);
+        write(pending::host_only);
+        close();
+    }
+
+    std::int64_t now() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now() - origin_)
+            .count();
+    }
+
+    void start(const std::string &path) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        write(pending::wait);
+        close();
+        path_ = path;
+        if (path_.empty()) {
+            const char *env = std::getenv("ONEMKL_VERBOSE_OUTPUT");
+            path_ = env != nullptr ? std::string(env)
+                                   : "onemkl_trace." + std::to_string(pid_) + ".json";
+        }
+        active.fetch_or(trace_sink);
+    }
+
+    void stop() {
+        active.fetch_and(~trace_sink);
+        std::lock_guard<std::mutex> lock(mutex_);
+        write(pending::wait);
+        close();
+    }
+
+    void flush() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        write(pending::wait);
+        if (file_ != nullptr)
+            std::fflush(file_);
+    }
+
+    // The exit handler is registered with the first profiled record, once the
+    // SYCL runtime is up, so that it runs before the runtime is torn down.
+    void add(entry &&e) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (e.profiled && !exit_handler_) {
+            exit_handler_ = true;
+            std::atexit([] { trace().stop(); });
+        }
+        entries_.push_back(std::move(e));
+        if (entries_.size() >= write_threshold)
+            write(pending::keep);
+    }
+
+    void register_backend(oneapi::mkl::domain domain, oneapi::mkl::device libkey,
+                          const char *library) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        backends_[{ domain, libkey }] = library;
+    }
+
+    std::string backend_name(oneapi::mkl::domain domain, oneapi::mkl::device libkey) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto backend = backends_.find({ domain, libkey });
+        return backend != backends_.end() ? backend->second : std::string();
+    }
+
+private:
+    void close() {
+        if (file_ != nullptr)
+            std::fclose(file_);
+        file_ = nullptr;
+    }
+
+    // The file is created on the first write. The closing bracket of the JSON
+    // array is optional in the Chrome trace format, so records are appended.
+    bool open() {
+        if (file_ != nullptr)
+            return true;
+        file_ = std::fopen(path_.c_str(), "w");
+        if (file_ == nullptr)
+            return false;
+        std::fprintf(file_,
+                     "[\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%u,"
+                     "\"args\":{\"name\":\"device\"}}",
+                     pid_, device_track);
+        return true;
+    }
+
+    // What a write does with records whose profiled event has not completed:
+    // keep them for a later write, wait for them, or write their host side only
+    // and never touch their events.
+    enum class pending { keep, wait, host_only };
+
+    void write(pending mode) {
+        if (entries_.empty() || !open()) {
+            entries_.clear();
+            return;
+        }
+        std::vector<entry> kept;
+        for (auto &e : entries_) {
+            if (e.profiled && mode == pending::keep &&
+                e.event.get_info<sycl::info::event::command_execution_status>() !=
+                    sycl::info::event_command_status::complete) {
+                kept.push_back(std::move(e));
+                continue;
+            }
+            write_entry(e, e.thread, e.start, e.end - e.start);
+            if (e.profiled && mode != pending::host_only)
+                write_execution(e);
+        }
+        if (mode == pending::host_only) {
+            // Destroying the events would call into the runtime as well, so the
+            // records are leaked.
+            static_cast<void>(new std::vector<entry>(std::move(entries_)));
+        }
+        entries_ = std::move(kept);
+    }
+
+    // Device execution of a profiled event, placed on the host clock by its
+    // delay since submission.
+    void write_execution(entry &e) {
+        std::int64_t submit, start, end;
+        try {
+            e.event.wait();
+            submit = e.event.get_profiling_info<sycl::info::event_profiling::command_submit>();
+            start = e.event.get_profiling_info<sycl::info::event_profiling::command_start>();
+            end = e.event.get_profiling_info<sycl::info::event_profiling::command_end>();
+        }
+        catch (const sycl::exception &) {
+            return;
+        }
+        write_entry(e, device_track, e.start + (start - submit), end - start);
+    }
+
+    void write_entry(const entry &e, std::uint32_t thread, std::int64_t ts, std::int64_t dur) {
+        std::fputs(",\n{\"name\":", file_);
+        write_string(file_, e.name);
+        std::fprintf(file_, ",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":%d,\"tid\":%u,",
+                     domain_name(e.domain), pid_, thread);
+        std::fprintf(file_, "\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"backend\":", ts * 1e-3,
+                     dur * 1e-3);
+        auto backend = backends_.find({ e.domain, e.libkey });
+        write_string(file_, backend != backends_.end() ? backend->second.c_str() : "");
+        std::fprintf(file_, ",\"device\":\"%s\"", device_name(e.libkey));
+        if (e.layout != nullptr)
+            std::fprintf(file_, ",\"layout\":\"%s\"", e.layout);
+        const char *name = e.arg_names;
+        for (int i = 0; i < e.args.count; i++) {
+            while (*name == ' ')
+                name++;
+            const char *last = name;
+            while (*last != ' ' && *last != '\0')
+                last++;
+            std::fprintf(file_, ",\"%.*s\":%lld", int(last - name), name,
+                         static_cast<long long>(e.args.values[i]));
+            name = last;
+        }
+        std::fputs("}}", file_);
+    }
+
+    const std::chrono::steady_clock::time_point origin_;
+    const int pid_;
+    std::mutex mutex_;
+    std::string path_;
+    std::FILE *file_ = nullptr;
+    bool exit_handler_ = false;
+    std::vector<entry> entries_;
+    std::map<std::pair<oneapi::mkl::domain, oneapi::mkl::device>, std::string> backends_;
+};
+
+trace_log &trace() {
+    static trace_log instance;
+    return instance;
+}
+
+// Creates the trace, and so reads ONEMKL_VERBOSE, when the library is loaded.
+const bool trace_created = (trace(), true);
+
+} // namespace
+
+std::int64_t now() {
+    return trace().now();
+}
+
+void record(const routine_info &routine, oneapi::mkl::device libkey, sycl::queue &queue,
+            const dims &args, std::int64_t start, const sycl::event *event) {
+    const std::int64_t end = trace().now();
+    const int sinks = active.load(std::memory_order_relaxed);
+    if (sinks & capture_sink)
+        capture(routine, libkey, args, start, end);
+    if (!(sinks & trace_sink))
+        return;
+    entry e{ routine.name, routine.dims, routine.where.domain, routine.where.layout,
+             libkey,       args,         start,                end,
+             thread_id(),  false,        sycl::event() };
+    if (event != nullptr && queue.has_property<sycl::property::queue::enable_profiling>()) {
+        e.profiled = true;
+        e.event = *event;
+    }
+    trace().add(std::move(e));
+}
+
+void register_backend(oneapi::mkl::domain domain, oneapi::mkl::device libkey,
+                      const char *library) {
+    trace().register_backend(domain, libkey, library);
+}
+
+std::string backend_name(oneapi::mkl::domain domain, oneapi::mkl::device libkey) {
+    return trace().backend_name(domain, libkey);
+}
+
+} // namespace verbose
+} // namespace detail
+
+namespace verbose {
+
+void enable(const std::string &path) {
+    detail::verbose::trace().start(path);
+}
+
+void disable() {
+    detail::verbose::trace().stop();
+}
+
+void flush() {
+    detail::verbose::trace().flush();
+}
+
+bool is_enabled() {
+    return (detail::verbose::active.load() & detail::verbose::trace_sink) != 0;
+}
+
+} // namespace verbose
+} // namespace mkl
+} // namespace oneapi
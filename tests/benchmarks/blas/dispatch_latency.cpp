@@ -0,0 +1,147 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Latency of small BLAS calls made through the run-time dispatcher on a CPU queue, with inline
+// calls disabled (threshold 0) and enabled at each given threshold (see
+// oneapi/mkl/inline_calls.hpp).
+//
+// Usage: benchmark_blas_dispatch_latency [--n 4,16,64,256] [--threshold 0,64,256]
+//                                        [--calls 1000] [--reps 10] [--output file.json]
+//
+// A sample makes --calls calls of a routine, each depending on the previous one, and waits for
+// the last; the latency is the median sample time divided by the number of calls.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl.hpp"
+
+#include "benchmark_common.hpp"
+
+namespace {
+
+namespace blas = oneapi::mkl::blas::column_major;
+using oneapi::mkl::transpose;
+
+struct context {
+    sycl::queue queue;
+    std::int64_t calls;
+    int reps;
+    benchmark::report& out;
+};
+
+// USM array of n floats set to value.
+class array {
+public:
+    array(sycl::queue& queue, std::int64_t n, float value)
+            : queue_(queue),
+              data_(sycl::malloc_shared<float>(n, queue)) {
+        queue_.fill(data_, value, n).wait();
+    }
+
+    array(const array&) = delete;
+    array& operator=(const array&) = delete;
+
+    ~array() {
+        sycl::free(data_, queue_);
+    }
+
+    float* get() const {
+        return data_;
+    }
+
+private:
+    sycl::queue& queue_;
+    float* data_;
+};
+
+// Runs the chain of calls made by call(dependencies) and reports its latency per call.
+template <typename Call>
+void measure(context& ctx, const std::string& routine, std::int64_t n, std::int64_t threshold,
+             Call call) {
+    const double seconds = benchmark::median_time(ctx.reps, [&] {
+        sycl::event last;
+        for (std::int64_t i = 0; i < ctx.calls; i++)
+            last = call(std::vector<sycl::event>{ last });
+        last.wait_and_throw();
+    });
+    const double latency = seconds / ctx.calls;
+    ctx.out.add("results", benchmark::record()
+                               .add("routine", routine)
+                               .add("n", n)
+                               .add("threshold", threshold)
+                               .add("inline", threshold > 0 && n < threshold ? "yes" : "no")
+                               .add("latency_us", latency * 1e6)
+                               .add("calls_per_s", 1.0 / latency));
+}
+
+void run(context& ctx, std::int64_t n, std::int64_t threshold) {
+    sycl::queue& queue = ctx.queue;
+    array x(queue, n * n, 1.0f), y(queue, n * n, 1.0f), c(queue, n * n, 0.0f);
+    array result(queue, 1, 0.0f);
+
+    measure(ctx, "saxpy", n, threshold, [&](const std::vector<sycl::event>& dependencies) {
+        return blas::axpy(queue, n, 1e-3f, x.get(), 1, y.get(), 1, dependencies);
+    });
+    measure(ctx, "sdot", n, threshold, [&](const std::vector<sycl::event>& dependencies) {
+        return blas::dot(queue, n, x.get(), 1, y.get(), 1, result.get(), dependencies);
+    });
+    measure(ctx, "sgemm", n, threshold, [&](const std::vector<sycl::event>& dependencies) {
+        return blas::gemm(queue, transpose::nontrans, transpose::nontrans, n, n, n, 1.0f,
+                          x.get(), n, y.get(), n, 0.0f, c.get(), n, dependencies);
+    });
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv) {
+    benchmark::options opts(argc, argv);
+    benchmark::report out("blas_dispatch_latency");
+
+    auto sizes = opts.get_list("n", { 4, 16, 64, 256 });
+    auto thresholds = opts.get_list("threshold", { 0, oneapi::mkl::inline_calls::default_threshold,
+                                                   256 });
+    try {
+        context ctx{ sycl::queue(sycl::cpu_selector{}), opts.get("calls", std::int64_t(1000)),
+                     static_cast<int>(opts.get("reps", std::int64_t(10))), out };
+        out.set("device", ctx.queue.get_device().get_info<sycl::info::device::name>());
+        for (auto threshold : thresholds) {
+            if (threshold > 0)
+                oneapi::mkl::inline_calls::enable(threshold);
+            else
+                oneapi::mkl::inline_calls::disable();
+            for (auto n : sizes)
+                run(ctx, n, threshold);
+        }
+    }
+    catch (const oneapi::mkl::exception& e) {
+        std::cerr << "oneMKL exception: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (const sycl::exception& e) {
+        std::cerr << "SYCL exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    out.write(opts.get("output", std::string()));
+    return 0;
+}
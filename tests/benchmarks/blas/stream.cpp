@@ -0,0 +1,133 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// STREAM-style bandwidth of the level 1 BLAS on a CPU queue for each NUMA placement of the
+// arrays (see oneapi/mkl/numa.hpp): copy, scal, axpy and dot in double precision.
+//
+// Usage: benchmark_blas_stream [--n 16777216] [--reps 10] [--output file.json]
+//
+// Bandwidth counts the bytes each routine must move: 16 per element for copy, scal and dot,
+// 24 for axpy. On a single-node machine all placements are plain shared USM.
+
+#include <cstdint>
+#include <iostream>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl.hpp"
+
+#include "benchmark_common.hpp"
+
+namespace {
+
+namespace blas = oneapi::mkl::blas::column_major;
+using oneapi::mkl::numa_policy;
+
+const std::vector<std::pair<std::string, numa_policy>> policy_names = {
+    { "none", numa_policy::none },
+    { "interleave", numa_policy::interleave },
+    { "partitioned", numa_policy::partitioned },
+};
+
+// NUMA-placed USM array of n values set to value.
+class array {
+public:
+    array(sycl::queue& queue, std::int64_t n, numa_policy policy, double value)
+            : queue_(queue),
+              data_(oneapi::mkl::numa_malloc_shared<double>(n, queue, policy)) {
+        if (data_ == nullptr)
+            throw std::bad_alloc();
+        queue_.fill(data_, value, n).wait();
+    }
+
+    array(const array&) = delete;
+    array& operator=(const array&) = delete;
+
+    ~array() {
+        oneapi::mkl::numa_free(data_, queue_);
+    }
+
+    double* get() const {
+        return data_;
+    }
+
+private:
+    sycl::queue& queue_;
+    double* data_;
+};
+
+template <typename Call>
+void measure(benchmark::report& out, const std::string& policy, int reps,
+             const std::string& routine, std::int64_t n, double bytes, Call call) {
+    const double seconds = benchmark::median_time(reps, [&] { call().wait_and_throw(); });
+    out.add("results", benchmark::record()
+                           .add("policy", policy)
+                           .add("routine", routine)
+                           .add("n", n)
+                           .add("time_ms", seconds * 1e3)
+                           .add("gbytes_per_s", bytes / seconds * 1e-9));
+}
+
+void run(benchmark::report& out, sycl::queue& queue, const std::string& policy_name,
+         numa_policy policy, int reps, std::int64_t n) {
+    const double bytes = static_cast<double>(n) * sizeof(double);
+    array x(queue, n, policy, 1.0), y(queue, n, policy, 2.0);
+    array result(queue, 1, numa_policy::none, 0.0);
+
+    measure(out, policy_name, reps, "dcopy", n, 2 * bytes,
+            [&] { return blas::copy(queue, n, x.get(), 1, y.get(), 1); });
+    measure(out, policy_name, reps, "dscal", n, 2 * bytes,
+            [&] { return blas::scal(queue, n, 1.0000001, y.get(), 1); });
+    measure(out, policy_name, reps, "daxpy", n, 3 * bytes,
+            [&] { return blas::axpy(queue, n, 1e-3, x.get(), 1, y.get(), 1); });
+    measure(out, policy_name, reps, "ddot", n, 2 * bytes,
+            [&] { return blas::dot(queue, n, x.get(), 1, y.get(), 1, result.get()); });
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv) {
+    benchmark::options opts(argc, argv);
+    const std::int64_t n = opts.get("n", std::int64_t(1) << 24);
+    const int reps = static_cast<int>(opts.get("reps", std::int64_t(10)));
+
+    benchmark::report out("blas_stream");
+    try {
+        sycl::queue queue(sycl::cpu_selector{});
+        out.set("device", queue.get_device().get_info<sycl::info::device::name>());
+        out.set("numa_nodes", std::to_string(oneapi::mkl::numa_node_count()));
+        for (const auto& policy : policy_names)
+            run(out, queue, policy.first, policy.second, reps, n);
+    }
+    catch (const oneapi::mkl::exception& e) {
+        std::cerr << "oneMKL exception: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (const sycl::exception& e) {
+        std::cerr << "SYCL exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    out.write(opts.get("output", std::string()));
+    return 0;
+}
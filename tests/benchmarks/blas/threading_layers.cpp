@@ -0,0 +1,213 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Performance of the BLAS suite on a CPU queue under each MKL threading layer (see
+// oneapi/mkl/threading_layer.hpp). MKL loads its threading layer once per process, so each layer
+// is measured by a run of this benchmark in a child process, selected with --layer.
+//
+// Usage: benchmark_blas_threading_layers [--layers sequential,intel,tbb] [--n 256,1024]
+//                                        [--reps 10] [--output file.json]
+//
+// The layers only differ if oneMKL is configured with ENABLE_MKLCPU_THREAD_RUNTIME. Level 1
+// routines run on n * n elements, so that every routine of a size touches as much memory.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl.hpp"
+
+#include "benchmark_common.hpp"
+
+#ifdef _WIN32
+#define popen  _popen
+#define pclose _pclose
+#endif
+
+namespace {
+
+namespace blas = oneapi::mkl::blas::column_major;
+using oneapi::mkl::diag;
+using oneapi::mkl::side;
+using oneapi::mkl::transpose;
+using oneapi::mkl::uplo;
+
+const std::vector<std::pair<std::string, oneapi::mkl::threading_layer>> layer_names = {
+    { "sequential", oneapi::mkl::threading_layer::sequential },
+    { "intel", oneapi::mkl::threading_layer::intel },
+    { "gnu", oneapi::mkl::threading_layer::gnu },
+    { "tbb", oneapi::mkl::threading_layer::tbb },
+};
+
+std::vector<std::string> split(const std::string& list) {
+    std::vector<std::string> items;
+    std::stringstream ss(list);
+    std::string item;
+    while (std::getline(ss, item, ','))
+        items.push_back(item);
+    return items;
+}
+
+// USM array of n values set to value.
+template <typename T>
+class array {
+public:
+    array(sycl::queue& queue, std::int64_t n, T value)
+            : queue_(queue),
+              data_(sycl::malloc_shared<T>(n, queue)) {
+        queue_.fill(data_, value, n).wait();
+    }
+
+    array(const array&) = delete;
+    array& operator=(const array&) = delete;
+
+    ~array() {
+        sycl::free(data_, queue_);
+    }
+
+    T* get() const {
+        return data_;
+    }
+
+private:
+    sycl::queue& queue_;
+    T* data_;
+};
+
+// Times call() and writes its record to stdout, one line for the parent process to collect.
+template <typename Call>
+void measure(const std::string& layer, int reps, const std::string& routine, std::int64_t n,
+             double flops, Call call) {
+    const double seconds = benchmark::median_time(reps, [&] { call().wait_and_throw(); });
+    std::cout << benchmark::record()
+                     .add("layer", layer)
+                     .add("routine", routine)
+                     .add("n", n)
+                     .add("time_ms", seconds * 1e3)
+                     .add("gflops", flops / seconds * 1e-9)
+                     .str()
+              << std::endl;
+}
+
+void run(sycl::queue& queue, const std::string& layer, int reps, std::int64_t n) {
+    const double nn = static_cast<double>(n) * n;
+    array<float> a(queue, n * n, 1.0f), b(queue, n * n, 1.0f), c(queue, n * n, 0.0f);
+    array<double> da(queue, n * n, 1.0), db(queue, n * n, 1.0), dc(queue, n * n, 0.0);
+    array<float> x(queue, n, 1.0f), y(queue, n, 0.0f), result(queue, 1, 0.0f);
+    for (std::int64_t i = 0; i < n; i++)
+        a.get()[i + i * n] = static_cast<float>(n);
+
+    measure(layer, reps, "saxpy", n, 2 * nn,
+            [&] { return blas::axpy(queue, n * n, 1e-3f, b.get(), 1, c.get(), 1); });
+    measure(layer, reps, "sdot", n, 2 * nn,
+            [&] { return blas::dot(queue, n * n, b.get(), 1, c.get(), 1, result.get()); });
+    measure(layer, reps, "sgemv", n, 2 * nn, [&] {
+        return blas::gemv(queue, transpose::nontrans, n, n, 1.0f, b.get(), n, x.get(), 1, 0.0f,
+                          y.get(), 1);
+    });
+    measure(layer, reps, "sgemm", n, 2 * nn * n, [&] {
+        return blas::gemm(queue, transpose::nontrans, transpose::nontrans, n, n, n, 1.0f, b.get(),
+                          n, b.get(), n, 0.0f, c.get(), n);
+    });
+    measure(layer, reps, "dgemm", n, 2 * nn * n, [&] {
+        return blas::gemm(queue, transpose::nontrans, transpose::nontrans, n, n, n, 1.0, da.get(),
+                          n, db.get(), n, 0.0, dc.get(), n);
+    });
+    measure(layer, reps, "ssyrk", n, nn * n, [&] {
+        return blas::syrk(queue, uplo::lower, transpose::nontrans, n, n, 1.0f, b.get(), n, 0.0f,
+                          c.get(), n);
+    });
+    measure(layer, reps, "strsm", n, nn * n, [&] {
+        return blas::trsm(queue, side::left, uplo::lower, transpose::nontrans, diag::nonunit, n, n,
+                          1.0f, a.get(), n, c.get(), n);
+    });
+}
+
+// Measures one layer in this process.
+int run_layer(const benchmark::options& opts, const std::string& layer) {
+    auto it = std::find_if(layer_names.begin(), layer_names.end(),
+                           [&](const auto& l) { return l.first == layer; });
+    if (it == layer_names.end()) {
+        std::cerr << "unknown threading layer: " << layer << std::endl;
+        return 1;
+    }
+    try {
+        oneapi::mkl::set_threading_layer(it->second);
+        sycl::queue queue(sycl::cpu_selector{});
+        const int reps = static_cast<int>(opts.get("reps", std::int64_t(10)));
+        for (auto n : opts.get_list("n", { 256, 1024 }))
+            run(queue, layer, reps, n);
+    }
+    catch (const oneapi::mkl::exception& e) {
+        std::cerr << "oneMKL exception: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (const sycl::exception& e) {
+        std::cerr << "SYCL exception: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv) {
+    benchmark::options opts(argc, argv);
+    const std::string layer = opts.get("layer", std::string());
+    if (!layer.empty())
+        return run_layer(opts, layer);
+
+    benchmark::report out("blas_threading_layers");
+    out.set("device", sycl::queue(sycl::cpu_selector{})
+                          .get_device()
+                          .get_info<sycl::info::device::name>());
+    int status = 0;
+    for (const auto& name : split(opts.get("layers", std::string("sequential,intel,tbb")))) {
+        const std::string command = std::string("\"") + argv[0] + "\" --layer " + name +
+                                    " --n " + opts.get("n", std::string("256,1024")) +
+                                    " --reps " + opts.get("reps", std::string("10"));
+        FILE* child = popen(command.c_str(), "r");
+        if (child == nullptr) {
+            std::cerr << "cannot run " << command << std::endl;
+            return 1;
+        }
+        char line[4096];
+        while (std::fgets(line, sizeof(line), child) != nullptr) {
+            std::string record(line);
+            while (!record.empty() && (record.back() == '\n' || record.back() == '\r'))
+                record.pop_back();
+            if (!record.empty() && record.front() == '{')
+                out.add_json("results", record);
+        }
+        if (pclose(child) != 0) {
+            std::cerr << "layer " << name << " failed" << std::endl;
+            status = 1;
+        }
+    }
+
+    out.write(opts.get("output", std::string()));
+    return status;
+}
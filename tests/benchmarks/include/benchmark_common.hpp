@@ -0,0 +1,191 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _BENCHMARK_COMMON_HPP__
+#define _BENCHMARK_COMMON_HPP__
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace benchmark {
+
+// Runs f() once to warm up and returns the median wall time of reps further runs in seconds.
+template <typename F>
+double median_time(int reps, F f) {
+    f();
+    std::vector<double> times(std::max(reps, 1));
+    for (auto& t : times) {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        auto stop = std::chrono::steady_clock::now();
+        t = std::chrono::duration<double>(stop - start).count();
+    }
+    std::nth_element(times.begin(), times.begin() + times.size() / 2, times.end());
+    return times[times.size() / 2];
+}
+
+// One flat JSON object, fields are written in insertion order.
+class record {
+public:
+    record& add(const std::string& key, const std::string& value) {
+        fields_.emplace_back(key, quote(value));
+        return *this;
+    }
+
+    record& add(const std::string& key, const char* value) {
+        return add(key, std::string(value));
+    }
+
+    template <typename T>
+    record& add(const std::string& key, T value) {
+        std::ostringstream os;
+        os << std::setprecision(6) << value;
+        fields_.emplace_back(key, os.str());
+        return *this;
+    }
+
+    std::string str() const {
+        std::string out = "{";
+        for (std::size_t i = 0; i < fields_.size(); i++) {
+            out += (i ? ", " : "") + quote(fields_[i].first) + ": " + fields_[i].second;
+        }
+        return out + "}";
+    }
+
+private:
+    static std::string quote(const std::string& s) {
+        std::string out = "\"";
+        for (char c : s) {
+            if (c == '"' || c == '\\')
+                out += '\\';
+            out += c;
+        }
+        return out + "\"";
+    }
+
+    std::vector<std::pair<std::string, std::string>> fields_;
+};
+
+// Collects records into named arrays and writes them as a single JSON document.
+class report {
+public:
+    explicit report(std::string name) : name_(std::move(name)) {}
+
+    void set(const std::string& key, const std::string& value) {
+        header_.add(key, value);
+    }
+
+    void add(const std::string& section, const record& r) {
+        add_json(section, r.str());
+    }
+
+    // Adds a record already written as JSON, such as one read from another process.
+    void add_json(const std::string& section, const std::string& json) {
+        auto it = std::find_if(sections_.begin(), sections_.end(),
+                               [&](const auto& s) { return s.first == section; });
+        if (it == sections_.end()) {
+            sections_.emplace_back(section, std::vector<std::string>{});
+            it = sections_.end() - 1;
+        }
+        it->second.push_back(json);
+        std::cerr << section << ": " << json << std::endl;
+    }
+
+    void write(std::ostream& os) const {
+        os << "{\n  \"benchmark\": \"" << name_ << "\",\n  \"context\": " << header_.str();
+        for (const auto& section : sections_) {
+            os << ",\n  \"" << section.first << "\": [";
+            for (std::size_t i = 0; i < section.second.size(); i++) {
+                os << (i ? ",\n    " : "\n    ") << section.second[i];
+            }
+            os << "\n  ]";
+        }
+        os << "\n}\n";
+    }
+
+    // Writes to the file given by path, or to stdout if path is empty.
+    void write(const std::string& path) const {
+        if (path.empty()) {
+            write(std::cout);
+            return;
+        }
+        std::ofstream out(path);
+        write(out);
+    }
+
+private:
+    std::string name_;
+    record header_;
+    std::vector<std::pair<std::string, std::vector<std::string>>> sections_;
+};
+
+// Minimal "--key value" command line parser.
+class options {
+public:
+    options(int argc, char** argv) {
+        for (int i = 1; i + 1 < argc; i += 2) {
+            std::string key = argv[i];
+            if (key.rfind("--", 0) == 0)
+                values_.emplace_back(key.substr(2), argv[i + 1]);
+        }
+    }
+
+    std::string get(const std::string& key, const std::string& default_value) const {
+        for (const auto& v : values_) {
+            if (v.first == key)
+                return v.second;
+        }
+        return default_value;
+    }
+
+    std::int64_t get(const std::string& key, std::int64_t default_value) const {
+        auto v = get(key, std::string());
+        return v.empty() ? default_value : std::stoll(v);
+    }
+
+    // Comma separated list of integers, e.g. "--n 1000,1000000".
+    std::vector<std::int64_t> get_list(const std::string& key,
+                                       const std::vector<std::int64_t>& default_value) const {
+        auto v = get(key, std::string());
+        if (v.empty())
+            return default_value;
+        std::vector<std::int64_t> list;
+        std::stringstream ss(v);
+        std::string item;
+        while (std::getline(ss, item, ',')) {
+            list.push_back(std::stoll(item));
+        }
+        return list;
+    }
+
+private:
+    std::vector<std::pair<std::string, std::string>> values_;
+};
+
+} // namespace benchmark
+
+#endif // _BENCHMARK_COMMON_HPP__
@@ -0,0 +1,657 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Replays a capture of oneMKL calls (see oneapi/mkl/capture.hpp) on synthetic data and reports
+// the time of each replayed call next to the time it took when it was captured.
+//
+// Usage: onemkl_replay --trace file [--device cpu|gpu] [--repeat 1] [--output file.json]
+//
+// Every call is replayed through the USM API of its routine and layout, on arrays of the captured
+// sizes filled with random values, and timed from submission to completion of its event. With
+// --repeat, the best time of the repeats is reported. Routines the replayer does not know are
+// counted as skipped.
+
+#include <algorithm>
+#include <chrono>
+#include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl.hpp"
+
+#include "benchmark_common.hpp"
+
+namespace {
+
+using oneapi::mkl::transpose;
+
+struct routine_decl {
+    int domain;
+    std::string layout;
+    std::string name;
+    std::vector<std::string> dims;
+};
+
+struct call_record {
+    std::uint64_t routine;
+    int device;
+    std::vector<std::int64_t> values;
+    std::int64_t duration;
+};
+
+// Reads the records of a capture file.
+class trace_reader {
+public:
+    explicit trace_reader(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            throw std::runtime_error("cannot open " + path);
+        data_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        const std::string magic = oneapi::mkl::capture::format_magic;
+        if (data_.compare(0, magic.size(), magic) != 0)
+            throw std::runtime_error(path + " is not a oneMKL capture");
+        pos_ = magic.size();
+    }
+
+    void read(std::vector<routine_decl>& routines, std::vector<call_record>& calls) {
+        while (pos_ < data_.size()) {
+            const char tag = data_[pos_++];
+            if (tag == 'R') {
+                const std::uint64_t id = get();
+                routine_decl r;
+                r.domain = static_cast<unsigned char>(byte());
+                r.layout = get_string();
+                r.name = get_string();
+                std::istringstream dims(get_string());
+                r.dims.assign(std::istream_iterator<std::string>(dims),
+                              std::istream_iterator<std::string>());
+                if (id != routines.size())
+                    throw std::runtime_error("routine declared out of order");
+                routines.push_back(std::move(r));
+            }
+            else if (tag == 'C') {
+                call_record c;
+                c.routine = get();
+                c.device = static_cast<unsigned char>(byte());
+                c.values.resize(get());
+                for (auto& value : c.values)
+                    value = get_signed();
+                get_signed();
+                c.duration = static_cast<std::int64_t>(get());
+                if (c.routine >= routines.size())
+                    throw std::runtime_error("call of an undeclared routine");
+                calls.push_back(std::move(c));
+            }
+            else {
+                throw std::runtime_error("corrupt capture");
+            }
+        }
+    }
+
+private:
+    char byte() {
+        if (pos_ >= data_.size())
+            throw std::runtime_error("truncated capture");
+        return data_[pos_++];
+    }
+
+    std::uint64_t get() {
+        std::uint64_t value = 0;
+        for (int shift = 0;; shift += 7) {
+            const auto b = static_cast<unsigned char>(byte());
+            value |= static_cast<std::uint64_t>(b & 0x7f) << shift;
+            if (!(b & 0x80))
+                return value;
+        }
+    }
+
+    std::int64_t get_signed() {
+        const std::uint64_t value = get();
+        return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+    }
+
+    std::string get_string() {
+        const std::uint64_t length = get();
+        if (pos_ + length > data_.size())
+            throw std::runtime_error("truncated capture");
+        std::string s = data_.substr(pos_, length);
+        pos_ += length;
+        return s;
+    }
+
+    std::string data_;
+    std::size_t pos_ = 0;
+};
+
+// Scalar arguments of a call, by the names its routine gives them.
+class call_args {
+public:
+    call_args(const routine_decl& routine, const call_record& call)
+            : routine_(routine),
+              call_(call) {}
+
+    std::int64_t operator[](const char* name) const {
+        for (std::size_t i = 0; i < routine_.dims.size() && i < call_.values.size(); i++) {
+            if (routine_.dims[i] == name)
+                return call_.values[i];
+        }
+        throw std::runtime_error(routine_.name + " was captured without " + name);
+    }
+
+    template <typename Enum>
+    Enum get(const char* name) const {
+        return static_cast<Enum>((*this)[name]);
+    }
+
+private:
+    const routine_decl& routine_;
+    const call_record& call_;
+};
+
+template <typename T>
+struct real_type {
+    using type = T;
+};
+
+template <typename T>
+struct real_type<std::complex<T>> {
+    using type = T;
+};
+
+std::mt19937_64 generator(777);
+
+template <typename T>
+T random_value() {
+    std::uniform_real_distribution<T> dist(0, 1);
+    return dist(generator);
+}
+
+template <typename T>
+std::complex<T> random_complex() {
+    return { random_value<T>(), random_value<T>() };
+}
+
+template <typename fp>
+std::vector<fp> random_data(std::int64_t count) {
+    std::vector<fp> data(std::max<std::int64_t>(count, 1));
+    for (auto& x : data) {
+        if constexpr (std::is_same<fp, typename real_type<fp>::type>::value)
+            x = random_value<fp>();
+        else
+            x = random_complex<typename real_type<fp>::type>();
+    }
+    return data;
+}
+
+// Adds n to the diagonal of an n x n matrix, for the solvers and factorizations to run on a
+// well conditioned (and, read as a triangle, positive definite) matrix.
+template <typename fp>
+std::vector<fp> dominant_data(std::int64_t count, std::int64_t n, std::int64_t ld) {
+    auto data = random_data<fp>(count);
+    for (std::int64_t i = 0; i < n; i++)
+        data[i * ld + i] += static_cast<typename real_type<fp>::type>(n);
+    return data;
+}
+
+// USM device copy of host data.
+template <typename T>
+class device_array {
+public:
+    device_array(sycl::queue& queue, const std::vector<T>& host)
+            : queue_(queue),
+              data_(sycl::malloc_device<T>(host.size(), queue)) {
+        if (data_ == nullptr)
+            throw std::runtime_error("cannot allocate replay data");
+        queue_.memcpy(data_, host.data(), host.size() * sizeof(T)).wait();
+    }
+
+    device_array(const device_array&) = delete;
+    device_array& operator=(const device_array&) = delete;
+
+    ~device_array() {
+        sycl::free(data_, queue_);
+    }
+
+    T* get() const {
+        return data_;
+    }
+
+private:
+    sycl::queue& queue_;
+    T* data_;
+};
+
+template <typename fp>
+device_array<fp> random_array(sycl::queue& queue, std::int64_t count) {
+    return device_array<fp>(queue, random_data<fp>(count));
+}
+
+// Pivots of an LU factorization that leaves the rows in place.
+device_array<std::int64_t> pivots(sycl::queue& queue, std::int64_t n) {
+    std::vector<std::int64_t> ipiv(std::max<std::int64_t>(n, 1));
+    for (std::int64_t i = 0; i < n; i++)
+        ipiv[i] = i + 1;
+    return device_array<std::int64_t>(queue, ipiv);
+}
+
+// Elements of a matrix stored with rows x cols entries and leading dimension ld.
+std::int64_t matrix_elements(bool row_major, std::int64_t rows, std::int64_t cols,
+                             std::int64_t ld) {
+    return std::max<std::int64_t>(1, ld * (row_major ? rows : cols));
+}
+
+std::int64_t vector_elements(std::int64_t n, std::int64_t inc) {
+    return std::max<std::int64_t>(1, 1 + (n - 1) * std::abs(inc));
+}
+
+// Seconds from the submission of a call to the completion of its event.
+template <typename F>
+double timed(sycl::queue& queue, F f) {
+    queue.wait_and_throw();
+    const auto start = std::chrono::steady_clock::now();
+    sycl::event done = f();
+    done.wait_and_throw();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+#define BLAS_CALL(row_major, routine, ...)                              \
+    ((row_major) ? oneapi::mkl::blas::row_major::routine(__VA_ARGS__) \
+                 : oneapi::mkl::blas::column_major::routine(__VA_ARGS__))
+
+using replayer = std::function<double(sycl::queue&, const call_args&, bool)>;
+
+template <typename fp>
+double replay_gemm(sycl::queue& queue, const call_args& args, bool row_major) {
+    const auto transa = args.get<transpose>("transa");
+    const auto transb = args.get<transpose>("transb");
+    const std::int64_t m = args["m"], n = args["n"], k = args["k"];
+    const std::int64_t lda = args["lda"], ldb = args["ldb"], ldc = args["ldc"];
+    const bool ta = transa != transpose::nontrans, tb = transb != transpose::nontrans;
+    auto a = random_array<fp>(queue, matrix_elements(row_major, ta ? k : m, ta ? m : k, lda));
+    auto b = random_array<fp>(queue, matrix_elements(row_major, tb ? n : k, tb ? k : n, ldb));
+    auto c = random_array<fp>(queue, matrix_elements(row_major, m, n, ldc));
+    return timed(queue, [&] {
+        return BLAS_CALL(row_major, gemm, queue, transa, transb, m, n, k, fp(1), a.get(), lda,
+                         b.get(), ldb, fp(0), c.get(), ldc);
+    });
+}
+
+template <typename fp>
+double replay_gemm_batch(sycl::queue& queue, const call_args& args, bool row_major) {
+    const auto transa = args.get<transpose>("transa");
+    const auto transb = args.get<transpose>("transb");
+    const std::int64_t m = args["m"], n = args["n"], k = args["k"];
+    const std::int64_t lda = args["lda"], ldb = args["ldb"], ldc = args["ldc"];
+    const std::int64_t stride_a = args["stride_a"], stride_b = args["stride_b"],
+                       stride_c = args["stride_c"], batch_size = args["batch_size"];
+    const bool ta = transa != transpose::nontrans, tb = transb != transpose::nontrans;
+    const std::int64_t size_a = matrix_elements(row_major, ta ? k : m, ta ? m : k, lda);
+    const std::int64_t size_b = matrix_elements(row_major, tb ? n : k, tb ? k : n, ldb);
+    const std::int64_t size_c = matrix_elements(row_major, m, n, ldc);
+    auto a = random_array<fp>(queue, std::max(size_a, stride_a * batch_size));
+    auto b = random_array<fp>(queue, std::max(size_b, stride_b * batch_size));
+    auto c = random_array<fp>(queue, std::max(size_c, stride_c * batch_size));
+    return timed(queue, [&] {
+        return BLAS_CALL(row_major, gemm_batch, queue, transa, transb, m, n, k, fp(1), a.get(), lda,
+                         stride_a, b.get(), ldb, stride_b, fp(0), c.get(), ldc, stride_c,
+                         batch_size);
+    });
+}
+
+template <typename fp>
+double replay_symm(sycl::queue& queue, const call_args& args, bool row_major) {
+    const auto left_right = args.get<oneapi::mkl::side>("left_right");
+    const auto upper_lower = args.get<oneapi::mkl::uplo>("upper_lower");
+    const std::int64_t m = args["m"], n = args["n"];
+    const std::int64_t lda = args["lda"], ldb = args["ldb"], ldc = args["ldc"];
+    const std::int64_t ka = left_right == oneapi::mkl::side::left ? m : n;
+    auto a = random_array<fp>(queue, matrix_elements(row_major, ka, ka, lda));
+    auto b = random_array<fp>(queue, matrix_elements(row_major, m, n, ldb));
+    auto c = random_array<fp>(queue, matrix_elements(row_major, m, n, ldc));
+    return timed(queue, [&] {
+        return BLAS_CALL(row_major, symm, queue, left_right, upper_lower, m, n, fp(1), a.get(),
+                         lda, b.get(), ldb, fp(0), c.get(), ldc);
+    });
+}
+
+template <typename fp>
+double replay_syrk(sycl::queue& queue, const call_args& args, bool row_major) {
+    const auto upper_lower = args.get<oneapi::mkl::uplo>("upper_lower");
+    const auto trans = args.get<transpose>("trans");
+    const std::int64_t n = args["n"], k = args["k"], lda = args["lda"], ldc = args["ldc"];
+    const bool t = trans != transpose::nontrans;
+    auto a = random_array<fp>(queue, matrix_elements(row_major, t ? k : n, t ? n : k, lda));
+    auto c = random_array<fp>(queue, matrix_elements(row_major, n, n, ldc));
+    return timed(queue, [&] {
+        return BLAS_CALL(row_major, syrk, queue, upper_lower, trans, n, k, fp(1), a.get(), lda,
+                         fp(0), c.get(), ldc);
+    });
+}
+
+// trsm and trmm, which share their arguments.
+template <typename fp, bool solve>
+double replay_triangular(sycl::queue& queue, const call_args& args, bool row_major) {
+    const auto left_right = args.get<oneapi::mkl::side>("left_right");
+    const auto upper_lower = args.get<oneapi::mkl::uplo>("upper_lower");
+    const auto trans = args.get<transpose>("trans");
+    const auto unit_diag = args.get<oneapi::mkl::diag>("unit_diag");
+    const std::int64_t m = args["m"], n = args["n"], lda = args["lda"], ldb = args["ldb"];
+    const std::int64_t ka = left_right == oneapi::mkl::side::left ? m : n;
+    device_array<fp> a(queue, dominant_data<fp>(matrix_elements(row_major, ka, ka, lda), ka, lda));
+    auto b = random_array<fp>(queue, matrix_elements(row_major, m, n, ldb));
+    return timed(queue, [&] {
+        if (solve)
+            return BLAS_CALL(row_major, trsm, queue, left_right, upper_lower, trans, unit_diag, m,
+                             n, fp(1), a.get(), lda, b.get(), ldb);
+        return BLAS_CALL(row_major, trmm, queue, left_right, upper_lower, trans, unit_diag, m, n,
+                         fp(1), a.get(), lda, b.get(), ldb);
+    });
+}
+
+template <typename fp>
+double replay_gemv(sycl::queue& queue, const call_args& args, bool row_major) {
+    const auto trans = args.get<transpose>("trans");
+    const std::int64_t m = args["m"], n = args["n"], lda = args["lda"];
+    const std::int64_t incx = args["incx"], incy = args["incy"];
+    const bool t = trans != transpose::nontrans;
+    auto a = random_array<fp>(queue, matrix_elements(row_major, m, n, lda));
+    auto x = random_array<fp>(queue, vector_elements(t ? m : n, incx));
+    auto y = random_array<fp>(queue, vector_elements(t ? n : m, incy));
+    return timed(queue, [&] {
+        return BLAS_CALL(row_major, gemv, queue, trans, m, n, fp(1), a.get(), lda, x.get(), incx,
+                         fp(0), y.get(), incy);
+    });
+}
+
+template <typename fp>
+double replay_axpy(sycl::queue& queue, const call_args& args, bool row_major) {
+    const std::int64_t n = args["n"], incx = args["incx"], incy = args["incy"];
+    auto x = random_array<fp>(queue, vector_elements(n, incx));
+    auto y = random_array<fp>(queue, vector_elements(n, incy));
+    return timed(queue, [&] {
+        return BLAS_CALL(row_major, axpy, queue, n, fp(1), x.get(), incx, y.get(), incy);
+    });
+}
+
+template <typename fp>
+double replay_scal(sycl::queue& queue, const call_args& args, bool row_major) {
+    const std::int64_t n = args["n"], incx = args["incx"];
+    auto x = random_array<fp>(queue, vector_elements(n, incx));
+    return timed(queue,
+                 [&] { return BLAS_CALL(row_major, scal, queue, n, fp(1), x.get(), incx); });
+}
+
+template <typename fp>
+double replay_dot(sycl::queue& queue, const call_args& args, bool row_major) {
+    const std::int64_t n = args["n"], incx = args["incx"], incy = args["incy"];
+    auto x = random_array<fp>(queue, vector_elements(n, incx));
+    auto y = random_array<fp>(queue, vector_elements(n, incy));
+    auto result = random_array<fp>(queue, 1);
+    return timed(queue, [&] {
+        return BLAS_CALL(row_major, dot, queue, n, x.get(), incx, y.get(), incy, result.get());
+    });
+}
+
+template <typename fp>
+double replay_getrf(sycl::queue& queue, const call_args& args, bool) {
+    const std::int64_t m = args["m"], n = args["n"], lda = args["lda"];
+    auto a = random_array<fp>(queue, matrix_elements(false, m, n, lda));
+    auto ipiv = pivots(queue, std::min(m, n));
+    const auto size = oneapi::mkl::lapack::getrf_scratchpad_size<fp>(queue, m, n, lda);
+    auto scratchpad = random_array<fp>(queue, size);
+    return timed(queue, [&] {
+        return oneapi::mkl::lapack::getrf(queue, m, n, a.get(), lda, ipiv.get(), scratchpad.get(),
+                                          size);
+    });
+}
+
+template <typename fp>
+double replay_getrs(sycl::queue& queue, const call_args& args, bool) {
+    const auto trans = args.get<transpose>("trans");
+    const std::int64_t n = args["n"], nrhs = args["nrhs"], lda = args["lda"], ldb = args["ldb"];
+    device_array<fp> a(queue, dominant_data<fp>(matrix_elements(false, n, n, lda), n, lda));
+    auto ipiv = pivots(queue, n);
+    auto b = random_array<fp>(queue, matrix_elements(false, n, nrhs, ldb));
+    const auto size =
+        oneapi::mkl::lapack::getrs_scratchpad_size<fp>(queue, trans, n, nrhs, lda, ldb);
+    auto scratchpad = random_array<fp>(queue, size);
+    return timed(queue, [&] {
+        return oneapi::mkl::lapack::getrs(queue, trans, n, nrhs, a.get(), lda, ipiv.get(),
+                                          b.get(), ldb, scratchpad.get(), size);
+    });
+}
+
+template <typename fp>
+double replay_potrf(sycl::queue& queue, const call_args& args, bool) {
+    const auto uplo = args.get<oneapi::mkl::uplo>("uplo");
+    const std::int64_t n = args["n"], lda = args["lda"];
+    device_array<fp> a(queue, dominant_data<fp>(matrix_elements(false, n, n, lda), n, lda));
+    const auto size = oneapi::mkl::lapack::potrf_scratchpad_size<fp>(queue, uplo, n, lda);
+    auto scratchpad = random_array<fp>(queue, size);
+    return timed(queue, [&] {
+        return oneapi::mkl::lapack::potrf(queue, uplo, n, a.get(), lda, scratchpad.get(), size);
+    });
+}
+
+template <typename fp>
+double replay_potrs(sycl::queue& queue, const call_args& args, bool) {
+    const auto uplo = args.get<oneapi::mkl::uplo>("uplo");
+    const std::int64_t n = args["n"], nrhs = args["nrhs"], lda = args["lda"], ldb = args["ldb"];
+    device_array<fp> a(queue, dominant_data<fp>(matrix_elements(false, n, n, lda), n, lda));
+    auto b = random_array<fp>(queue, matrix_elements(false, n, nrhs, ldb));
+    const auto size =
+        oneapi::mkl::lapack::potrs_scratchpad_size<fp>(queue, uplo, n, nrhs, lda, ldb);
+    auto scratchpad = random_array<fp>(queue, size);
+    return timed(queue, [&] {
+        return oneapi::mkl::lapack::potrs(queue, uplo, n, nrhs, a.get(), lda, b.get(), ldb,
+                                          scratchpad.get(), size);
+    });
+}
+
+template <typename fp>
+double replay_geqrf(sycl::queue& queue, const call_args& args, bool) {
+    const std::int64_t m = args["m"], n = args["n"], lda = args["lda"];
+    auto a = random_array<fp>(queue, matrix_elements(false, m, n, lda));
+    auto tau = random_array<fp>(queue, std::min(m, n));
+    const auto size = oneapi::mkl::lapack::geqrf_scratchpad_size<fp>(queue, m, n, lda);
+    auto scratchpad = random_array<fp>(queue, size);
+    return timed(queue, [&] {
+        return oneapi::mkl::lapack::geqrf(queue, m, n, a.get(), lda, tau.get(), scratchpad.get(),
+                                          size);
+    });
+}
+
+// syevd for real types and heevd for complex ones.
+template <typename fp>
+double replay_eigen(sycl::queue& queue, const call_args& args, bool) {
+    using fp_real = typename real_type<fp>::type;
+    const auto jobz = args.get<oneapi::mkl::job>("jobz");
+    const auto uplo = args.get<oneapi::mkl::uplo>("uplo");
+    const std::int64_t n = args["n"], lda = args["lda"];
+    auto a = random_array<fp>(queue, matrix_elements(false, n, n, lda));
+    auto w = random_array<fp_real>(queue, n);
+    if constexpr (std::is_same<fp, fp_real>::value) {
+        const auto size = oneapi::mkl::lapack::syevd_scratchpad_size<fp>(queue, jobz, uplo, n, lda);
+        auto scratchpad = random_array<fp>(queue, size);
+        return timed(queue, [&] {
+            return oneapi::mkl::lapack::syevd(queue, jobz, uplo, n, a.get(), lda, w.get(),
+                                              scratchpad.get(), size);
+        });
+    }
+    else {
+        const auto size = oneapi::mkl::lapack::heevd_scratchpad_size<fp>(queue, jobz, uplo, n, lda);
+        auto scratchpad = random_array<fp>(queue, size);
+        return timed(queue, [&] {
+            return oneapi::mkl::lapack::heevd(queue, jobz, uplo, n, a.get(), lda, w.get(),
+                                              scratchpad.get(), size);
+        });
+    }
+}
+
+template <typename fp>
+void add_replayers(std::map<std::string, replayer>& replayers, const std::string& prefix) {
+    replayers[prefix + "gemm"] = replay_gemm<fp>;
+    replayers[prefix + "gemm_batch_strided"] = replay_gemm_batch<fp>;
+    replayers[prefix + "symm"] = replay_symm<fp>;
+    replayers[prefix + "syrk"] = replay_syrk<fp>;
+    replayers[prefix + "trsm"] = replay_triangular<fp, true>;
+    replayers[prefix + "trmm"] = replay_triangular<fp, false>;
+    replayers[prefix + "gemv"] = replay_gemv<fp>;
+    replayers[prefix + "axpy"] = replay_axpy<fp>;
+    replayers[prefix + "scal"] = replay_scal<fp>;
+    replayers[prefix + "getrf"] = replay_getrf<fp>;
+    replayers[prefix + "getrs"] = replay_getrs<fp>;
+    replayers[prefix + "potrf"] = replay_potrf<fp>;
+    replayers[prefix + "potrs"] = replay_potrs<fp>;
+    replayers[prefix + "geqrf"] = replay_geqrf<fp>;
+    if constexpr (std::is_same<fp, typename real_type<fp>::type>::value) {
+        replayers[prefix + "dot"] = replay_dot<fp>;
+        replayers[prefix + "syevd"] = replay_eigen<fp>;
+    }
+    else {
+        replayers[prefix + "heevd"] = replay_eigen<fp>;
+    }
+}
+
+// Routine of the capture without the _usm suffix of the USM APIs, which are the ones replayed.
+std::string replayed_name(const std::string& name) {
+    const std::string usm = "_usm";
+    if (name.size() > usm.size() && name.compare(name.size() - usm.size(), usm.size(), usm) == 0)
+        return name.substr(0, name.size() - usm.size());
+    return name;
+}
+
+struct totals {
+    std::int64_t calls = 0;
+    double captured = 0;
+    double replayed = 0;
+};
+
+} // anonymous namespace
+
+int main(int argc, char** argv) {
+    benchmark::options opts(argc, argv);
+    benchmark::report out("onemkl_replay");
+
+    const std::string path = opts.get("trace", std::string());
+    if (path.empty()) {
+        std::cerr << "usage: onemkl_replay --trace file [--device cpu|gpu] [--repeat 1]"
+                  << " [--output file.json]" << std::endl;
+        return 1;
+    }
+    const std::string device = opts.get("device", std::string("default"));
+    const int repeat = static_cast<int>(std::max<std::int64_t>(1, opts.get("repeat", 1)));
+
+    std::vector<routine_decl> routines;
+    std::vector<call_record> calls;
+    try {
+        trace_reader(path).read(routines, calls);
+    }
+    catch (const std::runtime_error& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    std::map<std::string, replayer> replayers;
+    add_replayers<float>(replayers, "s");
+    add_replayers<double>(replayers, "d");
+    add_replayers<std::complex<float>>(replayers, "c");
+    add_replayers<std::complex<double>>(replayers, "z");
+
+    sycl::queue queue = device == "cpu"   ? sycl::queue(sycl::cpu_selector{})
+                        : device == "gpu" ? sycl::queue(sycl::gpu_selector{})
+                                          : sycl::queue(sycl::default_selector{});
+    out.set("trace", path);
+    out.set("device", queue.get_device().get_info<sycl::info::device::name>());
+
+    totals all, skipped;
+    std::map<std::string, totals> by_routine;
+    try {
+        for (std::size_t i = 0; i < calls.size(); i++) {
+            const call_record& call = calls[i];
+            const routine_decl& routine = routines[call.routine];
+            const double captured = call.duration * 1e-9;
+            auto replay = replayers.find(replayed_name(routine.name));
+            if (replay == replayers.end()) {
+                skipped.calls++;
+                skipped.captured += captured;
+                continue;
+            }
+
+            const call_args args(routine, call);
+            const bool row_major = routine.layout == "row_major";
+            double best = replay->second(queue, args, row_major);
+            for (int r = 1; r < repeat; r++)
+                best = std::min(best, replay->second(queue, args, row_major));
+
+            benchmark::record r;
+            r.add("index", static_cast<std::int64_t>(i))
+                .add("routine", routine.name)
+                .add("layout", routine.layout);
+            for (std::size_t d = 0; d < routine.dims.size() && d < call.values.size(); d++)
+                r.add(routine.dims[d], call.values[d]);
+            r.add("captured_s", captured).add("replayed_s", best);
+            out.add("calls", r);
+
+            for (totals* t : { &all, &by_routine[routine.name] }) {
+                t->calls++;
+                t->captured += captured;
+                t->replayed += best;
+            }
+        }
+    }
+    catch (const oneapi::mkl::exception& e) {
+        std::cerr << "oneMKL exception: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (const sycl::exception& e) {
+        std::cerr << "SYCL exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    for (const auto& routine : by_routine) {
+        out.add("routines", benchmark::record()
+                                .add("routine", routine.first)
+                                .add("calls", routine.second.calls)
+                                .add("captured_s", routine.second.captured)
+                                .add("replayed_s", routine.second.replayed));
+    }
+    out.add("total", benchmark::record()
+                         .add("calls", all.calls)
+                         .add("captured_s", all.captured)
+                         .add("replayed_s", all.replayed)
+                         .add("skipped_calls", skipped.calls)
+                         .add("skipped_captured_s", skipped.captured));
+
+    out.write(opts.get("output", std::string()));
+    return 0;
+}
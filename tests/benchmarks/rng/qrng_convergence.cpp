@@ -0,0 +1,148 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Convergence of quasi-Monte Carlo integration with the sobol and niederreiter
+// engines compared to the philox4x32x10 pseudorandom engine.
+//
+// Two integrals with known value 1 are estimated for growing number of samples:
+//      uniform  - Sobol' g-function, prod_j (|4 * u_j - 2| + a_j) / (1 + a_j), a_j = j + 1
+//      gaussian - mean of z_j^2 over all dimensions, z drawn with the icdf gaussian method
+//
+// Usage: benchmark_rng_qrng_convergence [dimensions] [max_log2_samples]
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl.hpp"
+
+namespace {
+
+constexpr std::uint64_t seed = 777;
+
+oneapi::mkl::rng::philox4x32x10 make_engine(oneapi::mkl::rng::philox4x32x10*, sycl::queue& queue,
+                                            std::uint32_t) {
+    return oneapi::mkl::rng::philox4x32x10(queue, seed);
+}
+
+oneapi::mkl::rng::sobol make_engine(oneapi::mkl::rng::sobol*, sycl::queue& queue,
+                                    std::uint32_t dimensions) {
+    return oneapi::mkl::rng::sobol(queue, dimensions);
+}
+
+oneapi::mkl::rng::niederreiter make_engine(oneapi::mkl::rng::niederreiter*, sycl::queue& queue,
+                                           std::uint32_t dimensions) {
+    return oneapi::mkl::rng::niederreiter(queue, dimensions);
+}
+
+template <typename Engine, typename Distr>
+std::vector<double> generate_points(sycl::queue& queue, const Distr& distr,
+                                    std::uint32_t dimensions, std::int64_t n_points) {
+    auto engine = make_engine(static_cast<Engine*>(nullptr), queue, dimensions);
+    std::vector<double> r(n_points * dimensions);
+    {
+        sycl::buffer<double, 1> r_buf(r.data(), r.size());
+        oneapi::mkl::rng::generate(distr, engine, r.size(), r_buf);
+    }
+    return r;
+}
+
+template <typename Engine>
+double uniform_error(sycl::queue& queue, std::uint32_t dimensions, std::int64_t n_points) {
+    oneapi::mkl::rng::uniform<double> distr(0.0, 1.0);
+    auto r = generate_points<Engine>(queue, distr, dimensions, n_points);
+    double sum = 0.0;
+    for (std::int64_t i = 0; i < n_points; i++) {
+        double prod = 1.0;
+        for (std::uint32_t j = 0; j < dimensions; j++) {
+            double a = j + 1.0;
+            prod *= (std::fabs(4.0 * r[i * dimensions + j] - 2.0) + a) / (1.0 + a);
+        }
+        sum += prod;
+    }
+    return std::fabs(sum / n_points - 1.0);
+}
+
+template <typename Engine>
+double gaussian_error(sycl::queue& queue, std::uint32_t dimensions, std::int64_t n_points) {
+    oneapi::mkl::rng::gaussian<double, oneapi::mkl::rng::gaussian_method::icdf> distr(0.0, 1.0);
+    auto r = generate_points<Engine>(queue, distr, dimensions, n_points);
+    double sum = 0.0;
+    for (std::int64_t i = 0; i < n_points * dimensions; i++) {
+        sum += r[i] * r[i];
+    }
+    return std::fabs(sum / (n_points * dimensions) - 1.0);
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv) {
+    std::uint32_t dimensions = (argc > 1) ? std::stoul(argv[1]) : 8;
+    int max_log2_samples = (argc > 2) ? std::stoi(argv[2]) : 20;
+
+    sycl::queue queue(sycl::cpu_selector{});
+
+    std::cout << "# device: " << queue.get_device().get_info<sycl::info::device::name>()
+              << std::endl;
+    std::cout << "# dimensions: " << dimensions << std::endl;
+    std::cout << "# absolute error of the estimated integral" << std::endl;
+    std::cout << std::setw(10) << "samples" << std::setw(14) << "philox_u" << std::setw(14)
+              << "sobol_u" << std::setw(14) << "niederr_u" << std::setw(14) << "philox_g"
+              << std::setw(14) << "sobol_g" << std::setw(14) << "niederr_g" << std::endl;
+
+    try {
+        for (int log2_n = 10; log2_n <= max_log2_samples; log2_n++) {
+            std::int64_t n_points = std::int64_t(1) << log2_n;
+            std::cout << std::setw(10) << n_points << std::scientific << std::setprecision(4)
+                      << std::setw(14)
+                      << uniform_error<oneapi::mkl::rng::philox4x32x10>(queue, dimensions,
+                                                                        n_points)
+                      << std::setw(14)
+                      << uniform_error<oneapi::mkl::rng::sobol>(queue, dimensions, n_points)
+                      << std::setw(14)
+                      << uniform_error<oneapi::mkl::rng::niederreiter>(queue, dimensions,
+                                                                       n_points)
+                      << std::setw(14)
+                      << gaussian_error<oneapi::mkl::rng::philox4x32x10>(queue, dimensions,
+                                                                         n_points)
+                      << std::setw(14)
+                      << gaussian_error<oneapi::mkl::rng::sobol>(queue, dimensions, n_points)
+                      << std::setw(14)
+                      << gaussian_error<oneapi::mkl::rng::niederreiter>(queue, dimensions,
+                                                                        n_points)
+                      << std::defaultfloat << std::endl;
+        }
+    }
+    catch (const oneapi::mkl::exception& e) {
+        std::cerr << "oneMKL exception: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (const sycl::exception& e) {
+        std::cerr << "SYCL exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,238 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Throughput of oneapi::mkl::rng::generate over engine x distribution x method x n x API
+// (buffer/USM), together with the cost of engine construction and skip_ahead.
+//
+// Usage: benchmark_rng_throughput [--n 1000,100000,10000000] [--reps 10] [--output file.json]
+//
+// Results are written as JSON, samples/s and bytes/s are derived from the median time.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl.hpp"
+
+#include "benchmark_common.hpp"
+
+namespace {
+
+namespace rng = oneapi::mkl::rng;
+
+constexpr std::uint64_t seed = 777;
+
+struct context {
+    sycl::queue queue;
+    std::vector<std::int64_t> sizes;
+    int reps;
+    benchmark::report& out;
+};
+
+template <typename Engine>
+struct engine_info;
+
+template <>
+struct engine_info<rng::philox4x32x10> {
+    static constexpr const char* name = "philox4x32x10";
+    static rng::philox4x32x10 create(sycl::queue& queue) {
+        return rng::philox4x32x10(queue, seed);
+    }
+};
+
+template <>
+struct engine_info<rng::mrg32k3a> {
+    static constexpr const char* name = "mrg32k3a";
+    static rng::mrg32k3a create(sycl::queue& queue) {
+        return rng::mrg32k3a(queue, seed);
+    }
+};
+
+template <>
+struct engine_info<rng::sobol> {
+    static constexpr const char* name = "sobol";
+    static rng::sobol create(sycl::queue& queue) {
+        return rng::sobol(queue);
+    }
+};
+
+template <>
+struct engine_info<rng::niederreiter> {
+    static constexpr const char* name = "niederreiter";
+    static rng::niederreiter create(sycl::queue& queue) {
+        return rng::niederreiter(queue);
+    }
+};
+
+template <typename T>
+const char* type_name();
+template <>
+const char* type_name<float>() {
+    return "float";
+}
+template <>
+const char* type_name<double>() {
+    return "double";
+}
+template <>
+const char* type_name<std::int32_t>() {
+    return "int32";
+}
+template <>
+const char* type_name<std::uint32_t>() {
+    return "uint32";
+}
+
+template <typename Engine>
+void report_entry(context& ctx, const char* section, const char* distr_name,
+                  const char* method_name, const char* type, const char* api, std::int64_t n,
+                  std::size_t elem_size, double time) {
+    benchmark::record r;
+    r.add("engine", engine_info<Engine>::name)
+        .add("distribution", distr_name)
+        .add("method", method_name)
+        .add("type", type)
+        .add("api", api)
+        .add("n", n)
+        .add("time_s", time)
+        .add("samples_per_s", n / time)
+        .add("bytes_per_s", n * elem_size / time);
+    ctx.out.add(section, r);
+}
+
+template <typename Engine, typename Distr>
+void bench_generate(context& ctx, const Distr& distr, const char* distr_name,
+                    const char* method_name) {
+    using T = typename Distr::result_type;
+    auto engine = engine_info<Engine>::create(ctx.queue);
+    for (auto n : ctx.sizes) {
+        try {
+            sycl::buffer<T, 1> r_buf{ sycl::range<1>(n) };
+            double t_buf = benchmark::median_time(ctx.reps, [&]() {
+                rng::generate(distr, engine, n, r_buf);
+                ctx.queue.wait_and_throw();
+            });
+            report_entry<Engine>(ctx, "generate", distr_name, method_name, type_name<T>(),
+                                 "buffer", n, sizeof(T), t_buf);
+
+            T* r_usm = sycl::malloc_device<T>(n, ctx.queue);
+            double t_usm = benchmark::median_time(
+                ctx.reps, [&]() { rng::generate(distr, engine, n, r_usm).wait_and_throw(); });
+            sycl::free(r_usm, ctx.queue);
+            report_entry<Engine>(ctx, "generate", distr_name, method_name, type_name<T>(), "usm",
+                                 n, sizeof(T), t_usm);
+        }
+        catch (const oneapi::mkl::unimplemented&) {
+            return;
+        }
+    }
+}
+
+template <typename Engine>
+void bench_engine(context& ctx) {
+    double t_create = benchmark::median_time(
+        ctx.reps, [&]() { auto engine = engine_info<Engine>::create(ctx.queue); });
+    ctx.out.add("engine_creation", benchmark::record()
+                                       .add("engine", engine_info<Engine>::name)
+                                       .add("time_s", t_create));
+
+    try {
+        auto engine = engine_info<Engine>::create(ctx.queue);
+        for (auto n : ctx.sizes) {
+            double t_skip = benchmark::median_time(ctx.reps, [&]() { rng::skip_ahead(engine, n); });
+            ctx.out.add("skip_ahead", benchmark::record()
+                                          .add("engine", engine_info<Engine>::name)
+                                          .add("num_to_skip", n)
+                                          .add("time_s", t_skip));
+        }
+    }
+    catch (const oneapi::mkl::unimplemented&) {
+    }
+
+    bench_generate<Engine>(ctx, rng::uniform<float, rng::uniform_method::standard>{}, "uniform",
+                           "standard");
+    bench_generate<Engine>(ctx, rng::uniform<double, rng::uniform_method::standard>{}, "uniform",
+                           "standard");
+    bench_generate<Engine>(ctx, rng::uniform<std::int32_t, rng::uniform_method::standard>{},
+                           "uniform", "standard");
+    bench_generate<Engine>(ctx, rng::uniform<float, rng::uniform_method::accurate>{}, "uniform",
+                           "accurate");
+    bench_generate<Engine>(ctx, rng::uniform<double, rng::uniform_method::accurate>{}, "uniform",
+                           "accurate");
+    bench_generate<Engine>(ctx, rng::gaussian<float, rng::gaussian_method::box_muller2>{},
+                           "gaussian", "box_muller2");
+    bench_generate<Engine>(ctx, rng::gaussian<double, rng::gaussian_method::box_muller2>{},
+                           "gaussian", "box_muller2");
+    bench_generate<Engine>(ctx, rng::gaussian<float, rng::gaussian_method::icdf>{}, "gaussian",
+                           "icdf");
+    bench_generate<Engine>(ctx, rng::gaussian<double, rng::gaussian_method::icdf>{}, "gaussian",
+                           "icdf");
+    bench_generate<Engine>(ctx, rng::lognormal<float, rng::lognormal_method::box_muller2>{},
+                           "lognormal", "box_muller2");
+    bench_generate<Engine>(ctx, rng::lognormal<double, rng::lognormal_method::box_muller2>{},
+                           "lognormal", "box_muller2");
+    bench_generate<Engine>(ctx, rng::lognormal<float, rng::lognormal_method::icdf>{},
+                           "lognormal", "icdf");
+    bench_generate<Engine>(ctx, rng::lognormal<double, rng::lognormal_method::icdf>{},
+                           "lognormal", "icdf");
+    bench_generate<Engine>(ctx, rng::bernoulli<std::int32_t, rng::bernoulli_method::icdf>{},
+                           "bernoulli", "icdf");
+    bench_generate<Engine>(ctx, rng::bernoulli<std::uint32_t, rng::bernoulli_method::icdf>{},
+                           "bernoulli", "icdf");
+    bench_generate<Engine>(
+        ctx, rng::poisson<std::int32_t, rng::poisson_method::gaussian_icdf_based>{}, "poisson",
+        "gaussian_icdf_based");
+    bench_generate<Engine>(
+        ctx, rng::poisson<std::uint32_t, rng::poisson_method::gaussian_icdf_based>{}, "poisson",
+        "gaussian_icdf_based");
+    bench_generate<Engine>(ctx, rng::bits<std::uint32_t>{}, "bits", "standard");
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv) {
+    benchmark::options opts(argc, argv);
+    benchmark::report out("rng_throughput");
+
+    sycl::queue queue(sycl::default_selector{});
+    out.set("device", queue.get_device().get_info<sycl::info::device::name>());
+
+    context ctx{ queue, opts.get_list("n", { 1000, 100000, 10000000 }),
+                 static_cast<int>(opts.get("reps", std::int64_t(10))), out };
+
+    try {
+        bench_engine<rng::philox4x32x10>(ctx);
+        bench_engine<rng::mrg32k3a>(ctx);
+        bench_engine<rng::sobol>(ctx);
+        bench_engine<rng::niederreiter>(ctx);
+    }
+    catch (const oneapi::mkl::exception& e) {
+        std::cerr << "oneMKL exception: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (const sycl::exception& e) {
+        std::cerr << "SYCL exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    out.write(opts.get("output", std::string()));
+    return 0;
+}
@@ -0,0 +1,142 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "cblas.h"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device *> devices;
+
+namespace {
+
+// Runs a strided GEMM_BATCH, which the Netlib backend does not provide, on a
+// CPU device. The dispatcher must either take the entry from the next x86cpu
+// backend, in which case the result is checked and a call counted on Netlib
+// must be on a backend composed with another library, or report the routine
+// as unimplemented by all the loaded backends.
+template <typename fp>
+int test(device *dev, int64_t m, int64_t n, int64_t k, int64_t batch_size) {
+    if (!dev->is_cpu())
+        return test_skipped;
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during composed GEMM_BATCH:\n"
+                          << e.what() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(*dev, exception_handler);
+    context cxt = main_queue.get_context();
+    const auto layout = oneapi::mkl::layout::column_major;
+    const auto nontrans = oneapi::mkl::transpose::nontrans;
+    const int64_t lda = m, ldb = k, ldc = m;
+    const int64_t stride_a = lda * k, stride_b = ldb * n, stride_c = ldc * n;
+    const fp alpha = rand_scalar<fp>(), beta = rand_scalar<fp>();
+
+    // Prepare data.
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> A(ua), B(ua), C(ua);
+    rand_matrix(A, layout, nontrans, stride_a * batch_size, 1, stride_a * batch_size);
+    rand_matrix(B, layout, nontrans, stride_b * batch_size, 1, stride_b * batch_size);
+    rand_matrix(C, layout, nontrans, stride_c * batch_size, 1, stride_c * batch_size);
+
+    auto C_ref = C;
+
+    // Call Reference GEMM on each matrix of the batch.
+    using fp_ref = typename ref_type_info<fp>::type;
+    int m_ref = (int)m, n_ref = (int)n, k_ref = (int)k;
+    int lda_ref = (int)lda, ldb_ref = (int)ldb, ldc_ref = (int)ldc;
+    for (int64_t i = 0; i < batch_size; i++) {
+        ::gemm(convert_to_cblas_layout(layout), convert_to_cblas_trans(nontrans),
+               convert_to_cblas_trans(nontrans), &m_ref, &n_ref, &k_ref, (fp_ref *)&alpha,
+               (fp_ref *)(A.data() + stride_a * i), &lda_ref, (fp_ref *)(B.data() + stride_b * i),
+               &ldb_ref, (fp_ref *)&beta, (fp_ref *)(C_ref.data() + stride_c * i), &ldc_ref);
+    }
+
+    // Call DPC++ GEMM_BATCH.
+    oneapi::mkl::stats::reset();
+    try {
+        oneapi::mkl::blas::column_major::gemm_batch(main_queue, nontrans, nontrans, m, n, k, alpha,
+                                                    A.data(), lda, stride_a, B.data(), ldb,
+                                                    stride_b, beta, C.data(), ldc, stride_c,
+                                                    batch_size)
+            .wait_and_throw();
+    }
+    catch (const oneapi::mkl::unimplemented &e) {
+        // Only the dispatcher may report the entry missing: a backend stub
+        // throwing here means the entry was not composed.
+        if (std::string(e.what()).find("in the loaded backends") == std::string::npos) {
+            std::cout << "GEMM_BATCH not taken from another backend:\n" << e.what() << std::endl;
+            return false;
+        }
+        return true;
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during composed GEMM_BATCH:\n"
+                  << e.what() << std::endl;
+        return false;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good = check_equal_matrix(C, C_ref, layout, stride_c * batch_size, 1,
+                                   stride_c * batch_size, 10 * k, std::cout);
+    for (const auto &s : oneapi::mkl::stats::snapshot()) {
+        if (s.routine == "sgemm_batch_strided_usm" && s.calls != 0 &&
+            s.backend.find("netlib") != std::string::npos &&
+            s.backend.find('+') == std::string::npos) {
+            std::cout << "GEMM_BATCH counted on " << s.backend
+                      << ", which is not composed with another backend" << std::endl;
+            good = false;
+        }
+    }
+
+    return (int)good;
+}
+
+class GemmBatchStrideComposeTests : public ::testing::TestWithParam<cl::sycl::device *> {};
+
+TEST_P(GemmBatchStrideComposeTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 13, 9, 7, 5));
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmBatchStrideComposeTestSuite, GemmBatchStrideComposeTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
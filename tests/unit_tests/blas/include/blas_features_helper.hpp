@@ -0,0 +1,88 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef ONEMKL_BLAS_FEATURES_HELPER_HPP
+#define ONEMKL_BLAS_FEATURES_HELPER_HPP
+
+#include <cstdlib>
+#include <string>
+
+#include "oneapi/mkl.hpp"
+
+/* Helpers of the tests of the run-time dispatcher features on BLAS calls. The
+ * backends of a routine are known from the statistics of its calls. */
+
+/* Whether the calls of routine counted since the last reset ran on backends
+ * whose name contains one of the given names, and on at least one of them */
+template <typename... Names>
+bool ran_on(const std::string &routine, const Names &... names) {
+    bool found = false;
+    for (const auto &s : oneapi::mkl::stats::snapshot()) {
+        if (s.routine != routine || s.calls == 0)
+            continue;
+        bool matched = false;
+        for (const std::string name : { std::string(names)... })
+            matched = matched || s.backend.find(name) != std::string::npos;
+        if (!matched)
+            return false;
+        found = true;
+    }
+    return found;
+}
+
+/* Whether the calls of routine ran on a backend that runs them as host tasks,
+ * which inline calls, graphs and execution policies apply to */
+inline bool ran_as_host_tasks(const std::string &routine) {
+    return ran_on(routine, "mklcpu", "netlib");
+}
+
+/* Lists the first NUMA node twice while in scope, so that the CPU backends
+ * split their calls on partitioned arrays in two even on single-node machines
+ * (see oneapi/mkl/numa.hpp). The nodes can only be listed on Linux. */
+class two_numa_nodes {
+public:
+    two_numa_nodes() {
+#ifdef __linux__
+        const char *previous = std::getenv(variable);
+        restore_ = previous != nullptr;
+        if (restore_)
+            previous_ = previous;
+        setenv(variable, "0,0", 1);
+#endif
+    }
+
+    ~two_numa_nodes() {
+#ifdef __linux__
+        if (restore_)
+            setenv(variable, previous_.c_str(), 1);
+        else
+            unsetenv(variable);
+#endif
+    }
+
+    two_numa_nodes(const two_numa_nodes &) = delete;
+    two_numa_nodes &operator=(const two_numa_nodes &) = delete;
+
+private:
+    static constexpr const char *variable = "ONEMKL_NUMA_NODES";
+    bool restore_ = false;
+    std::string previous_;
+};
+
+#endif // ONEMKL_BLAS_FEATURES_HELPER_HPP
@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "cblas.h"
+#include "oneapi/mkl.hpp"
+#include "blas_features_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device *> devices;
+
+namespace {
+
+// Runs an AXPY below the inline threshold with inline calls enabled and checks
+// its result. On a backend that runs its calls as host tasks, the call must
+// have run on the calling thread: its event is complete as soon as it returns.
+template <typename fp>
+int test(device *dev, int N, fp alpha) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during inline AXPY:\n"
+                          << e.what() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(*dev, exception_handler);
+    context cxt = main_queue.get_context();
+
+    // Prepare data.
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> x(ua), y(ua);
+    rand_vector(x, N, 1);
+    rand_vector(y, N, 1);
+
+    auto y_ref = y;
+
+    // Call Reference AXPY.
+    using fp_ref = typename ref_type_info<fp>::type;
+    const int N_ref = N, inc_ref = 1;
+    ::axpy(&N_ref, (fp_ref *)&alpha, (fp_ref *)x.data(), &inc_ref, (fp_ref *)y_ref.data(),
+           &inc_ref);
+
+    // Call DPC++ AXPY inline.
+    const std::int64_t threshold = oneapi::mkl::inline_calls::get_threshold();
+    oneapi::mkl::inline_calls::enable(N + 1);
+    oneapi::mkl::stats::reset();
+    bool skipped = false, inlined = false;
+    try {
+        auto done = oneapi::mkl::blas::column_major::axpy(main_queue, N, alpha, x.data(), 1,
+                                                          y.data(), 1);
+        inlined = done.get_info<info::event::command_execution_status>() ==
+                  info::event_command_status::complete;
+        done.wait_and_throw();
+    }
+    catch (const oneapi::mkl::unimplemented &e) {
+        skipped = true;
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during inline AXPY:\n"
+                  << e.what() << std::endl;
+    }
+    if (threshold > 0)
+        oneapi::mkl::inline_calls::enable(threshold);
+    else
+        oneapi::mkl::inline_calls::disable();
+    if (skipped)
+        return test_skipped;
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good = check_equal_vector(y, y_ref, N, 1, N, std::cout);
+    if (dev->is_cpu() && ran_as_host_tasks("saxpy_usm") && !inlined) {
+        std::cout << "AXPY below the inline threshold was not run inline" << std::endl;
+        good = false;
+    }
+
+    return (int)good;
+}
+
+class AxpyInlineTests : public ::testing::TestWithParam<cl::sycl::device *> {};
+
+TEST_P(AxpyInlineTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 37, 2.0f));
+}
+
+INSTANTIATE_TEST_SUITE_P(AxpyInlineTestSuite, AxpyInlineTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,143 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "cblas.h"
+#include "oneapi/mkl.hpp"
+#include "blas_features_helper.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device *> devices;
+
+namespace {
+
+// Runs AXPY, SCAL, DOT and COPY on x and y in turn.
+template <typename fp>
+void run(queue &main_queue, int64_t n, fp alpha, fp *x, fp *y, fp *result) {
+    namespace blas = oneapi::mkl::blas::column_major;
+    auto added = blas::axpy(main_queue, n, alpha, x, 1, y, 1);
+    auto scaled = blas::scal(main_queue, n, alpha, y, 1, { added });
+    auto dotted = blas::dot(main_queue, n, x, 1, y, 1, result, { scaled });
+    blas::copy(main_queue, n, y, 1, x, 1, { dotted }).wait_and_throw();
+}
+
+// Runs the level-1 calls the CPU backends split over NUMA nodes on arrays
+// partitioned over two listed nodes, starting offset items into their
+// allocations, and compares them with the same calls on plain shared arrays.
+template <typename fp>
+int test(device *dev, int64_t n, int64_t offset) {
+    if (!dev->is_cpu())
+        return test_skipped;
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during NUMA split level 1:\n"
+                          << e.what() << std::endl;
+            }
+        }
+    };
+
+    two_numa_nodes nodes;
+    queue main_queue(*dev, exception_handler);
+    context cxt = main_queue.get_context();
+    if (oneapi::mkl::numa_node_count() != 2)
+        return test_skipped;
+
+    // Prepare data.
+    const auto partitioned = oneapi::mkl::numa_policy::partitioned;
+    fp *x_numa = oneapi::mkl::numa_malloc_shared<fp>(n + offset, main_queue, partitioned);
+    fp *y_numa = oneapi::mkl::numa_malloc_shared<fp>(n + offset, main_queue, partitioned);
+    if (x_numa == nullptr || y_numa == nullptr) {
+        std::cout << "Error cannot allocate partitioned arrays\n";
+        oneapi::mkl::numa_free(x_numa, main_queue);
+        oneapi::mkl::numa_free(y_numa, main_queue);
+        return false;
+    }
+    fp *x = x_numa + offset, *y = y_numa + offset;
+
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> x_ref(ua), y_ref(ua), result(ua);
+    rand_vector(x_ref, n, 1);
+    rand_vector(y_ref, n, 1);
+    result.resize(2);
+    std::copy(x_ref.begin(), x_ref.end(), x);
+    std::copy(y_ref.begin(), y_ref.end(), y);
+    const fp alpha = rand_scalar<fp>();
+
+    // Call DPC++ split and unsplit.
+    bool good = true;
+    try {
+        run(main_queue, n, alpha, x, y, &result[0]);
+        run(main_queue, n, alpha, x_ref.data(), y_ref.data(), &result[1]);
+    }
+    catch (const oneapi::mkl::unimplemented &e) {
+        oneapi::mkl::numa_free(x_numa, main_queue);
+        oneapi::mkl::numa_free(y_numa, main_queue);
+        return test_skipped;
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during NUMA split level 1:\n"
+                  << e.what() << std::endl;
+        good = false;
+    }
+
+    // Compare the results of the split and unsplit calls. The partial sums of
+    // DOT round differently.
+    good = check_equal_vector(x, x_ref, n, 1, 1, std::cout) && good;
+    good = check_equal_vector(y, y_ref, n, 1, 1, std::cout) && good;
+    good = check_equal(result[0], result[1], 10 * int(std::sqrt(double(n))), std::cout) && good;
+
+    oneapi::mkl::numa_free(x_numa, main_queue);
+    oneapi::mkl::numa_free(y_numa, main_queue);
+
+    return (int)good;
+}
+
+class NumaSplitLevel1Tests : public ::testing::TestWithParam<cl::sycl::device *> {};
+
+// Three MiB of floats per array, more than the smallest share a node is given.
+TEST_P(NumaSplitLevel1Tests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 3 << 18, 5));
+}
+
+TEST_P(NumaSplitLevel1Tests, RealDoublePrecision) {
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 3 << 17, 3));
+}
+
+INSTANTIATE_TEST_SUITE_P(NumaSplitLevel1TestSuite, NumaSplitLevel1Tests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,141 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "cblas.h"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device *> devices;
+
+namespace {
+
+// Records C = alpha * A * B + beta * C, C += 2 * D and C *= 0.5 into a graph,
+// checks that nothing ran before the graph runs, and checks the result of the
+// run. Graphs record CPU queues only; other devices are skipped.
+template <typename fp>
+int test(device *dev, int m, int n, int k, fp alpha, fp beta) {
+    if (!dev->is_cpu())
+        return test_skipped;
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during GEMM graph:\n"
+                          << e.what() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(*dev, exception_handler);
+    context cxt = main_queue.get_context();
+    const auto layout = oneapi::mkl::layout::column_major;
+    const auto nontrans = oneapi::mkl::transpose::nontrans;
+    const int lda = m, ldb = k, ldc = m, size = m * n, inc = 1;
+    fp two(2.0), half(0.5);
+
+    // Prepare data.
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> A(ua), B(ua), C(ua), D(ua);
+    rand_matrix(A, layout, nontrans, m, k, lda);
+    rand_matrix(B, layout, nontrans, k, n, ldb);
+    rand_matrix(C, layout, nontrans, m, n, ldc);
+    rand_matrix(D, layout, nontrans, m, n, ldc);
+
+    auto C_initial = C;
+    auto C_ref = C;
+
+    // Call the reference routines.
+    using fp_ref = typename ref_type_info<fp>::type;
+    ::gemm(convert_to_cblas_layout(layout), convert_to_cblas_trans(nontrans),
+           convert_to_cblas_trans(nontrans), &m, &n, &k, (fp_ref *)&alpha, (fp_ref *)A.data(),
+           &lda, (fp_ref *)B.data(), &ldb, (fp_ref *)&beta, (fp_ref *)C_ref.data(), &ldc);
+    ::axpy(&size, (fp_ref *)&two, (fp_ref *)D.data(), &inc, (fp_ref *)C_ref.data(), &inc);
+    ::scal(&size, (fp_ref *)&half, (fp_ref *)C_ref.data(), &inc);
+
+    // Record the DPC++ calls, then run them.
+    oneapi::mkl::graph graph;
+    bool good = true;
+    try {
+        graph.begin(main_queue);
+        auto multiplied = oneapi::mkl::blas::column_major::gemm(
+            main_queue, nontrans, nontrans, m, n, k, alpha, A.data(), lda, B.data(), ldb, beta,
+            C.data(), ldc);
+        auto added = oneapi::mkl::blas::column_major::axpy(main_queue, size, two, D.data(), inc,
+                                                           C.data(), inc, { multiplied });
+        oneapi::mkl::blas::column_major::scal(main_queue, size, half, C.data(), inc, { added });
+        graph.end();
+
+        if (graph.size() != 3) {
+            std::cout << "graph recorded " << graph.size() << " calls instead of 3" << std::endl;
+            good = false;
+        }
+        main_queue.wait_and_throw();
+        if (!check_equal_matrix(C, C_initial, layout, m, n, ldc, 1, std::cout)) {
+            std::cout << "recorded calls ran before the graph" << std::endl;
+            good = false;
+        }
+
+        graph.run().wait_and_throw();
+    }
+    catch (const oneapi::mkl::unimplemented &e) {
+        // Backends that submit their own kernels cannot be recorded.
+        if (graph.is_recording())
+            graph.end();
+        main_queue.wait();
+        return test_skipped;
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during GEMM graph:\n"
+                  << e.what() << std::endl;
+        good = false;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    good = check_equal_matrix(C, C_ref, layout, m, n, ldc, 10 * k, std::cout) && good;
+
+    return (int)good;
+}
+
+class GemmGraphTests : public ::testing::TestWithParam<cl::sycl::device *> {};
+
+TEST_P(GemmGraphTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 23, 17, 19, 2.0f, 3.0f));
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmGraphTestSuite, GemmGraphTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
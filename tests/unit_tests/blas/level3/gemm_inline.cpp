@@ -0,0 +1,129 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "cblas.h"
+#include "oneapi/mkl.hpp"
+#include "blas_features_helper.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device *> devices;
+
+namespace {
+
+// Runs a GEMM whose largest dimension is below the inline threshold with inline
+// calls enabled and checks its result. On a backend that runs its calls as host
+// tasks, the call must have run on the calling thread: its event is complete as
+// soon as it returns.
+template <typename fp>
+int test(device *dev, int m, int n, int k, fp alpha, fp beta) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during inline GEMM:\n"
+                          << e.what() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(*dev, exception_handler);
+    context cxt = main_queue.get_context();
+    const auto layout = oneapi::mkl::layout::column_major;
+    const auto nontrans = oneapi::mkl::transpose::nontrans;
+    const int lda = m, ldb = k, ldc = m;
+
+    // Prepare data.
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> A(ua), B(ua), C(ua);
+    rand_matrix(A, layout, nontrans, m, k, lda);
+    rand_matrix(B, layout, nontrans, k, n, ldb);
+    rand_matrix(C, layout, nontrans, m, n, ldc);
+
+    auto C_ref = C;
+
+    // Call Reference GEMM.
+    using fp_ref = typename ref_type_info<fp>::type;
+    ::gemm(convert_to_cblas_layout(layout), convert_to_cblas_trans(nontrans),
+           convert_to_cblas_trans(nontrans), &m, &n, &k, (fp_ref *)&alpha, (fp_ref *)A.data(),
+           &lda, (fp_ref *)B.data(), &ldb, (fp_ref *)&beta, (fp_ref *)C_ref.data(), &ldc);
+
+    // Call DPC++ GEMM inline.
+    const std::int64_t threshold = oneapi::mkl::inline_calls::get_threshold();
+    oneapi::mkl::inline_calls::enable(std::max({ m, n, k }) + 1);
+    oneapi::mkl::stats::reset();
+    bool skipped = false, inlined = false;
+    try {
+        auto done = oneapi::mkl::blas::column_major::gemm(main_queue, nontrans, nontrans, m, n, k,
+                                                          alpha, A.data(), lda, B.data(), ldb,
+                                                          beta, C.data(), ldc);
+        inlined = done.get_info<info::event::command_execution_status>() ==
+                  info::event_command_status::complete;
+        done.wait_and_throw();
+    }
+    catch (const oneapi::mkl::unimplemented &e) {
+        skipped = true;
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during inline GEMM:\n"
+                  << e.what() << std::endl;
+    }
+    if (threshold > 0)
+        oneapi::mkl::inline_calls::enable(threshold);
+    else
+        oneapi::mkl::inline_calls::disable();
+    if (skipped)
+        return test_skipped;
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    bool good = check_equal_matrix(C, C_ref, layout, m, n, ldc, 10 * k, std::cout);
+    if (dev->is_cpu() && ran_as_host_tasks("sgemm_usm") && !inlined) {
+        std::cout << "GEMM below the inline threshold was not run inline" << std::endl;
+        good = false;
+    }
+
+    return (int)good;
+}
+
+class GemmInlineTests : public ::testing::TestWithParam<cl::sycl::device *> {};
+
+TEST_P(GemmInlineTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 9, 7, 11, 2.0f, 3.0f));
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmInlineTestSuite, GemmInlineTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
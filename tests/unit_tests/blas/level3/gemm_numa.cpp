@@ -0,0 +1,162 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "cblas.h"
+#include "oneapi/mkl.hpp"
+#include "blas_features_helper.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device *> devices;
+
+namespace {
+
+template <typename fp>
+event gemm(queue &main_queue, oneapi::mkl::layout layout, oneapi::mkl::transpose transa,
+           oneapi::mkl::transpose transb, int64_t m, int64_t n, int64_t k, fp alpha, const fp *a,
+           int64_t lda, const fp *b, int64_t ldb, fp beta, fp *c, int64_t ldc) {
+    if (layout == oneapi::mkl::layout::column_major)
+        return oneapi::mkl::blas::column_major::gemm(main_queue, transa, transb, m, n, k, alpha, a,
+                                                     lda, b, ldb, beta, c, ldc);
+    return oneapi::mkl::blas::row_major::gemm(main_queue, transa, transb, m, n, k, alpha, a, lda,
+                                              b, ldb, beta, c, ldc);
+}
+
+// Runs a GEMM whose C is partitioned over two listed NUMA nodes, which the CPU
+// backends split into blocks of its columns in column-major layout and of its
+// rows in row-major layout, and compares it with the same GEMM on a plain
+// shared C. The leading dimensions are padded, and the rows or columns of C
+// are not a whole number of pages, so that the blocks of the nodes do not start
+// on a row or column of C.
+template <typename fp>
+int test(device *dev, oneapi::mkl::layout layout, oneapi::mkl::transpose transa,
+         oneapi::mkl::transpose transb, int64_t m, int64_t n, int64_t k) {
+    if (!dev->is_cpu())
+        return test_skipped;
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during NUMA split GEMM:\n"
+                          << e.what() << std::endl;
+            }
+        }
+    };
+
+    two_numa_nodes nodes;
+    queue main_queue(*dev, exception_handler);
+    context cxt = main_queue.get_context();
+    if (oneapi::mkl::numa_node_count() != 2)
+        return test_skipped;
+
+    // Prepare data.
+    const bool column_major = layout == oneapi::mkl::layout::column_major;
+    const bool trans_a = transa != oneapi::mkl::transpose::nontrans;
+    const bool trans_b = transb != oneapi::mkl::transpose::nontrans;
+    const int64_t rows_a = trans_a ? k : m, cols_a = trans_a ? m : k;
+    const int64_t rows_b = trans_b ? n : k, cols_b = trans_b ? k : n;
+    const int64_t lda = (column_major ? rows_a : cols_a) + 3;
+    const int64_t ldb = (column_major ? rows_b : cols_b) + 5;
+    const int64_t ldc = (column_major ? m : n) + 7;
+    const int64_t size_a = lda * (column_major ? cols_a : rows_a);
+    const int64_t size_b = ldb * (column_major ? cols_b : rows_b);
+    const int64_t size_c = ldc * (column_major ? n : m);
+
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> A(ua), B(ua), C_ref(ua);
+    rand_vector(A, size_a, 1);
+    rand_vector(B, size_b, 1);
+    rand_vector(C_ref, size_c, 1);
+
+    fp *C = oneapi::mkl::numa_malloc_shared<fp>(size_c, main_queue,
+                                                oneapi::mkl::numa_policy::partitioned);
+    if (C == nullptr) {
+        std::cout << "Error cannot allocate partitioned C\n";
+        return false;
+    }
+    std::copy(C_ref.begin(), C_ref.end(), C);
+    const fp alpha = rand_scalar<fp>(), beta = rand_scalar<fp>();
+
+    // Call DPC++ GEMM split and unsplit.
+    bool good = true;
+    try {
+        gemm(main_queue, layout, transa, transb, m, n, k, alpha, A.data(), lda, B.data(), ldb,
+             beta, C, ldc)
+            .wait_and_throw();
+        gemm(main_queue, layout, transa, transb, m, n, k, alpha, A.data(), lda, B.data(), ldb,
+             beta, C_ref.data(), ldc)
+            .wait_and_throw();
+    }
+    catch (const oneapi::mkl::unimplemented &e) {
+        oneapi::mkl::numa_free(C, main_queue);
+        return test_skipped;
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during NUMA split GEMM:\n"
+                  << e.what() << std::endl;
+        good = false;
+    }
+
+    // Compare the results of the split and unsplit calls.
+    good = check_equal_matrix(C, C_ref, layout, m, n, ldc, 10 * k, std::cout) && good;
+
+    oneapi::mkl::numa_free(C, main_queue);
+
+    return (int)good;
+}
+
+class GemmNumaTests
+        : public ::testing::TestWithParam<std::tuple<cl::sycl::device *, oneapi::mkl::layout>> {};
+
+// C spans 2.4 MB, more than the smallest share a node is given, over 300 rows
+// in column-major layout or 300 columns in row-major layout.
+TEST_P(GemmNumaTests, RealSinglePrecision) {
+    const auto layout = std::get<1>(GetParam());
+    const bool column_major = layout == oneapi::mkl::layout::column_major;
+    const int64_t m = column_major ? 300 : 2000, n = column_major ? 2000 : 300;
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), layout,
+                                  oneapi::mkl::transpose::nontrans,
+                                  oneapi::mkl::transpose::nontrans, m, n, 9));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), layout, oneapi::mkl::transpose::trans,
+                                  oneapi::mkl::transpose::trans, m, n, 9));
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmNumaTestSuite, GemmNumaTests,
+                         ::testing::Combine(testing::ValuesIn(devices),
+                                            testing::Values(oneapi::mkl::layout::column_major,
+                                                            oneapi::mkl::layout::row_major)),
+                         ::LayoutDeviceNamePrint());
+
+} // anonymous namespace
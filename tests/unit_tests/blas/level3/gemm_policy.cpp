@@ -0,0 +1,197 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <dirent.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <CL/sycl.hpp>
+#include "cblas.h"
+#include "oneapi/mkl.hpp"
+#include "blas_features_helper.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device *> devices;
+
+namespace {
+
+#ifdef __linux__
+// Number of threads of the process other than the calling one that are
+// running or runnable.
+int running_threads() {
+    DIR *tasks = opendir("/proc/self/task");
+    if (tasks == nullptr)
+        return 0;
+    const pid_t self = static_cast<pid_t>(syscall(SYS_gettid));
+    int running = 0;
+    while (dirent *task = readdir(tasks)) {
+        const pid_t tid = static_cast<pid_t>(std::atoi(task->d_name));
+        if (tid <= 0 || tid == self)
+            continue;
+        const std::string path = std::string("/proc/self/task/") + task->d_name + "/stat";
+        FILE *file = std::fopen(path.c_str(), "r");
+        if (file == nullptr)
+            continue;
+        char stat[512];
+        const std::size_t length = std::fread(stat, 1, sizeof(stat) - 1, file);
+        std::fclose(file);
+        stat[length] = '\0';
+        // The state follows the command name, which is in parentheses.
+        const char *end = std::strrchr(stat, ')');
+        if (end != nullptr && end[1] == ' ' && end[2] == 'R')
+            running++;
+    }
+    closedir(tasks);
+    return running;
+}
+#endif
+
+// Runs a GEMM on a queue with an execution policy of one thread, checks that
+// the policy reads back, and checks the result. On the MKL CPU backend the call
+// must run on that one thread: while it runs, the number of running threads of
+// the process is sampled, and its median must not exceed the host task thread
+// and one thread of the SYCL runtime. This is only observable with more CPUs
+// than that, on which MKL would otherwise use them all.
+template <typename fp>
+int test(device *dev, int n, fp alpha, fp beta) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during GEMM with a policy:\n"
+                          << e.what() << std::endl;
+            }
+        }
+    };
+
+    queue main_queue(*dev, exception_handler);
+    context cxt = main_queue.get_context();
+    const auto layout = oneapi::mkl::layout::column_major;
+    const auto nontrans = oneapi::mkl::transpose::nontrans;
+
+    // Prepare data.
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> A(ua), B(ua), C(ua);
+    rand_matrix(A, layout, nontrans, n, n, n);
+    rand_matrix(B, layout, nontrans, n, n, n);
+    rand_matrix(C, layout, nontrans, n, n, n);
+
+    auto C_ref = C;
+
+    // Call Reference GEMM.
+    using fp_ref = typename ref_type_info<fp>::type;
+    ::gemm(convert_to_cblas_layout(layout), convert_to_cblas_trans(nontrans),
+           convert_to_cblas_trans(nontrans), &n, &n, &n, (fp_ref *)&alpha, (fp_ref *)A.data(),
+           &n, (fp_ref *)B.data(), &n, (fp_ref *)&beta, (fp_ref *)C_ref.data(), &n);
+
+    // Call DPC++ GEMM under the policy.
+    oneapi::mkl::execution_policy policy;
+    policy.threads = 1;
+    bool observable = false;
+#ifdef __linux__
+    cpu_set_t allowed;
+    observable = sched_getaffinity(0, sizeof(allowed), &allowed) == 0 &&
+                 CPU_COUNT(&allowed) > policy.threads + 2;
+#endif
+    bool good = true;
+    oneapi::mkl::set_execution_policy(main_queue, policy);
+    if (oneapi::mkl::get_execution_policy(main_queue).threads != policy.threads) {
+        std::cout << "execution policy not set" << std::endl;
+        good = false;
+    }
+
+    oneapi::mkl::stats::reset();
+    bool skipped = false;
+    std::vector<int> samples;
+    try {
+        auto done = oneapi::mkl::blas::column_major::gemm(main_queue, nontrans, nontrans, n, n, n,
+                                                          alpha, A.data(), n, B.data(), n, beta,
+                                                          C.data(), n);
+#ifdef __linux__
+        while (observable && done.get_info<info::event::command_execution_status>() !=
+                                 info::event_command_status::complete)
+            samples.push_back(running_threads());
+#endif
+        done.wait_and_throw();
+    }
+    catch (const oneapi::mkl::unimplemented &e) {
+        skipped = true;
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during GEMM with a policy:\n"
+                  << e.what() << std::endl;
+        good = false;
+    }
+
+    oneapi::mkl::clear_execution_policy(main_queue);
+    if (oneapi::mkl::get_execution_policy(main_queue).threads != 0) {
+        std::cout << "execution policy not cleared" << std::endl;
+        good = false;
+    }
+    if (skipped)
+        return test_skipped;
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    good = check_equal_matrix(C, C_ref, layout, n, n, n, 10 * n, std::cout) && good;
+    if (dev->is_cpu() && ran_on("sgemm_usm", "mklcpu") && !samples.empty()) {
+        std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+        const int median = samples[samples.size() / 2];
+        if (median > policy.threads + 1) {
+            std::cout << median << " threads ran a GEMM limited to " << policy.threads
+                      << " thread" << std::endl;
+            good = false;
+        }
+    }
+
+    return (int)good;
+}
+
+class GemmPolicyTests : public ::testing::TestWithParam<cl::sycl::device *> {};
+
+TEST_P(GemmPolicyTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 1536, 1.0f, 0.0f));
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmPolicyTestSuite, GemmPolicyTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
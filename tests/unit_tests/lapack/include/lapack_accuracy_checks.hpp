@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdio>
 #include <complex>
 #include <vector>
@@ -445,6 +446,49 @@ bool check_potrs_accuracy(oneapi::mkl::uplo uplo, int64_t n, int64_t nrhs, fp* A
     return result;
 }
 
+template <typename fp>
+bool check_gels_accuracy(oneapi::mkl::transpose trans, int64_t m, int64_t n, int64_t nrhs, fp* B,
+                         int64_t ldb, fp* A_initial, int64_t lda, fp* B_initial) {
+    using fp_real = typename complex_info<fp>::real_type;
+    const bool nontrans = trans == oneapi::mkl::transpose::nontrans;
+    const int64_t rows = nontrans ? m : n;
+    const int64_t cols = nontrans ? n : m;
+    const auto trans_residual =
+        nontrans ? oneapi::mkl::transpose::conjtrans : oneapi::mkl::transpose::nontrans;
+
+    fp_real norm_A = reference::lange('1', m, n, A_initial, lda);
+    fp_real norm_B = reference::lange('1', rows, nrhs, B_initial, ldb);
+
+    // Compute R = B - op(A)*X. Store result in B_initial
+    reference::gemm(trans, oneapi::mkl::transpose::nontrans, rows, nrhs, cols, -1.0, A_initial, lda,
+                    B, ldb, 1.0, B_initial, ldb);
+
+    // The least squares residual is orthogonal to the range of op(A): compute op(A)^H * R
+    std::vector<fp> AR(cols * nrhs);
+    reference::gemm(trans_residual, oneapi::mkl::transpose::nontrans, cols, nrhs, rows, 1.0,
+                    A_initial, lda, B_initial, ldb, 0.0, AR.data(), cols);
+    fp_real norm_AR = reference::lange('1', cols, nrhs, AR.data(), cols);
+
+    fp_real ulp = reference::lamch<fp_real>('P');
+    fp_real denom = std::max({ m, n, nrhs }) * ulp * norm_A * norm_B;
+    denom = denom > 0.0 ? denom : ulp;
+    auto rel_err = norm_AR / denom;
+
+    fp_real threshold = 30.0;
+    bool result = rel_err < threshold;
+    if (!result) {
+        snprintf(global::buffer.data(), global::buffer.size(),
+                 "| op(A)^H (B - op(A)X) | / ( |A| |B| max(m,n,nrhs) ulp ) = "
+                 "|%e| / ( |%e| |%e| %d * %e ) = %e",
+                 norm_AR, norm_A, norm_B, static_cast<int>(std::max({ m, n, nrhs })), ulp,
+                 rel_err);
+        global::log << global::buffer.data() << std::endl;
+        global::log << "threshold = " << threshold << std::endl;
+    }
+
+    return result;
+}
+
 template <typename fp>
 bool check_gerqf_accuracy(fp* A, fp* A_initial, fp* tau, int64_t m, int64_t n, int64_t lda) {
     bool result = true;
@@ -526,6 +570,50 @@ bool check_gerqf_accuracy(fp* A, fp* A_initial, fp* tau, int64_t m, int64_t n, i
     return result;
 }
 
+/* checks eigenpairs first .. first+count-1 of a partial eigensolver against the full spectrum */
+template <typename fp>
+bool check_partial_eigen_accuracy(oneapi::mkl::job jobz, int64_t n, int64_t first, int64_t count,
+                                  int64_t m, const fp* A, int64_t lda,
+                                  const typename complex_info<fp>::real_type* w, const fp* Z,
+                                  int64_t ldz, const typename complex_info<fp>::real_type* D_ref) {
+    if (m != count) {
+        global::log << "Found " << m << " eigenvalues, expected " << count << std::endl;
+        return false;
+    }
+    bool result = true;
+
+    /* |D_ref - D| < |D_ref| O(eps) */
+    if (!rel_vec_err_check(count, D_ref + first, w, 10.0)) {
+        global::log << "Eigenvalue check failed" << std::endl;
+        result = false;
+    }
+
+    if (oneapi::mkl::job::vec == jobz) {
+        /* |A Z - Z D| < |Z D| O(eps) */
+        std::vector<fp> AZ(n * count);
+        std::vector<fp> ZD(n * count);
+        for (int64_t col = 0; col < count; col++)
+            for (int64_t row = 0; row < n; row++)
+                ZD[row + col * n] = Z[row + col * ldz] * w[col];
+        reference::gemm(oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::nontrans, n,
+                        count, n, 1.0, A, lda, Z, ldz, 0.0, AZ.data(), n);
+        if (!rel_mat_err_check(n, count, AZ.data(), n, ZD.data(), n)) {
+            global::log << "Eigenvector check failed" << std::endl;
+            result = false;
+        }
+
+        /* |I - Z' Z| < n O(eps) */
+        std::vector<fp> ZZ(count * count);
+        reference::gemm(oneapi::mkl::transpose::conjtrans, oneapi::mkl::transpose::nontrans, count,
+                        count, n, 1.0, Z, ldz, Z, ldz, 0.0, ZZ.data(), count);
+        if (!rel_id_err_check(count, ZZ.data(), count)) {
+            global::log << "Orthogonality check failed" << std::endl;
+            result = false;
+        }
+    }
+    return result;
+}
+
 template <typename fp>
 bool check_trtrs_accuracy(oneapi::mkl::uplo uplo, oneapi::mkl::transpose trans,
                           oneapi::mkl::diag diag, int64_t n, int64_t nrhs, fp* A, int64_t lda,
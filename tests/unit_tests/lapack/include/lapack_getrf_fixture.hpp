@@ -0,0 +1,145 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl.hpp"
+#include "lapack_common.hpp"
+#include "lapack_accuracy_checks.hpp"
+
+/* Shared fixture of the tests of the run-time dispatcher features: a random
+ * m x n matrix on a queue of the device, factorized with getrf. A feature test
+ * sets its feature up around run() and checks its effect next to check(). */
+template <typename data_T>
+struct getrf_fixture {
+    using fp = typename data_T_info<data_T>::value_type;
+    using array_t = decltype(device_alloc<data_T>(std::declval<sycl::queue>(), 0));
+    using ipiv_t = decltype(device_alloc<data_T, int64_t>(std::declval<sycl::queue>(), 0));
+
+    getrf_fixture(const sycl::device& dev, int64_t m, int64_t n, int64_t lda, uint64_t seed,
+                  const sycl::property_list& properties = {})
+            : m(m),
+              n(n),
+              lda(lda),
+              A_initial(lda * n),
+              A(lda * n),
+              ipiv(std::min(m, n)),
+              queue(dev, async_error_handler, properties),
+              A_dev(device_alloc<data_T>(queue, A.size())),
+              ipiv_dev(device_alloc<data_T, int64_t>(queue, ipiv.size())),
+              scratchpad_size(oneapi::mkl::lapack::getrf_scratchpad_size<fp>(queue, m, n, lda)),
+              scratchpad_dev(device_alloc<data_T>(queue, scratchpad_size)) {
+        rand_matrix(seed, oneapi::mkl::transpose::nontrans, m, n, A_initial, lda);
+        load();
+    }
+
+    ~getrf_fixture() {
+        queue.wait();
+        device_free(queue, A_dev);
+        device_free(queue, ipiv_dev);
+        device_free(queue, scratchpad_dev);
+    }
+
+    /* Copies the initial matrix to the device and waits for the copy */
+    void load() {
+        host_to_device_copy(queue, A_initial.data(), A_dev, A.size());
+        queue.wait_and_throw();
+    }
+
+    /* Factorizes the matrix without waiting, returning the event of USM calls */
+    auto run(const sycl::vector_class<sycl::event>& dependencies = {}) {
+        return run(dependencies, std::is_same<data_T, fp>{});
+    }
+
+    /* Name of the routine of run() in statistics, traces and captures */
+    static std::string routine() {
+        std::string name = "z";
+        if (std::is_same<fp, float>::value)
+            name = "s";
+        else if (std::is_same<fp, double>::value)
+            name = "d";
+        else if (std::is_same<fp, std::complex<float>>::value)
+            name = "c";
+        return name + (std::is_same<data_T, fp>::value ? "getrf_usm" : "getrf");
+    }
+
+    /* Waits for the queue, then checks the factorization on the device */
+    bool check() {
+        queue.wait_and_throw();
+        device_to_host_copy(queue, A_dev, A.data(), A.size());
+        device_to_host_copy(queue, ipiv_dev, ipiv.data(), ipiv.size());
+        queue.wait_and_throw();
+        return check_getrf_accuracy(m, n, A.data(), lda, ipiv.data(), A_initial.data());
+    }
+
+    const int64_t m, n, lda;
+    std::vector<fp> A_initial, A;
+    std::vector<int64_t> ipiv;
+    sycl::queue queue;
+    array_t A_dev;
+    ipiv_t ipiv_dev;
+    const int64_t scratchpad_size;
+    array_t scratchpad_dev;
+
+private:
+    sycl::event run(const sycl::vector_class<sycl::event>& dependencies, std::true_type) {
+        return oneapi::mkl::lapack::getrf(queue, m, n, A_dev, lda, ipiv_dev, scratchpad_dev,
+                                          scratchpad_size, dependencies);
+    }
+    void run(const sycl::vector_class<sycl::event>&, std::false_type) {
+        oneapi::mkl::lapack::getrf(queue, m, n, A_dev, lda, ipiv_dev, scratchpad_dev,
+                                   scratchpad_size);
+    }
+};
+
+/* Whether routine, as named by the statistics and traces, is a precision of
+ * getrf (or of its USM API) */
+inline bool is_getrf(const std::string& routine) {
+    return routine.size() > 1 && (routine.compare(1, std::string::npos, "getrf") == 0 ||
+                                  routine.compare(1, std::string::npos, "getrf_usm") == 0);
+}
+
+/* Statistics of the getrf calls, one entry per backend they ran on */
+inline std::vector<oneapi::mkl::stats::routine_stats> getrf_stats() {
+    std::vector<oneapi::mkl::stats::routine_stats> result;
+    for (auto& s : oneapi::mkl::stats::snapshot()) {
+        if (is_getrf(s.routine))
+            result.push_back(std::move(s));
+    }
+    return result;
+}
+
+/* Whether the getrf calls counted so far ran on a backend that runs them as
+ * host tasks, which the inline calls and execution policies apply to */
+inline bool getrf_runs_host_tasks() {
+    const auto stats = getrf_stats();
+    return !stats.empty() && std::all_of(stats.begin(), stats.end(), [](const auto& s) {
+        return s.backend.find("netlib") != std::string::npos;
+    });
+}
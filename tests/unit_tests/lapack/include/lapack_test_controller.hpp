@@ -64,6 +64,10 @@ inline std::ostream& operator<<(std::ostream& os, const oneapi::mkl::generate& t
     os << static_cast<int64_t>(t);
     return os;
 }
+inline std::ostream& operator<<(std::ostream& os, const oneapi::mkl::rangev& t) {
+    os << static_cast<int64_t>(t);
+    return os;
+}
 
 struct test_result {
     enum class type { fail, pass, exception };
@@ -32,20 +32,29 @@
 namespace {
 
 const char* accuracy_input = R"(
-31 50 37 27182
-30 30 34 27182
-50 37 54 27182
-31 22 37 27182
+31 50 37 27182 0
+30 30 34 27182 0
+50 37 54 27182 0
+31 22 37 27182 0
+2000 12 2003 27182 0
+2000 12 2003 27182 1e6
 )";
 
+/* A nonzero leading_imag sets A(0,0) to i * leading_imag in complex precisions,
+ * which makes the leading entry of Q nearly imaginary. */
 template <typename data_T>
-bool accuracy(const sycl::device& dev, int64_t m, int64_t n, int64_t lda, uint64_t seed) {
+bool accuracy(const sycl::device& dev, int64_t m, int64_t n, int64_t lda, uint64_t seed,
+              double leading_imag) {
     using fp = typename data_T_info<data_T>::value_type;
     using fp_real = typename complex_info<fp>::real_type;
 
     /* Initialize */
     std::vector<fp> A_initial(lda * n);
     rand_matrix(seed, oneapi::mkl::transpose::nontrans, m, n, A_initial, lda);
+    if constexpr (complex_info<fp>::is_complex) {
+        if (leading_imag != 0.0)
+            A_initial[0] = fp(0.0, static_cast<fp_real>(leading_imag));
+    }
 
     std::vector<fp> A = A_initial;
     std::vector<fp> tau(std::min(m, n));
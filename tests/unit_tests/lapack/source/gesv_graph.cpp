@@ -0,0 +1,105 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl.hpp"
+#include "lapack_common.hpp"
+#include "lapack_test_controller.hpp"
+#include "lapack_getrf_fixture.hpp"
+#include "test_helper.hpp"
+
+namespace {
+
+const char* accuracy_input = R"(
+0 27 13 29 31 27182
+)";
+
+/* Records a factorization and a solve into a graph, checks that nothing ran
+ * before the graph runs, and checks the solution of the run. Graphs record
+ * CPU queues only; other devices pass trivially. */
+template <typename data_T>
+bool accuracy(const sycl::device& dev, oneapi::mkl::transpose trans, int64_t n, int64_t nrhs,
+              int64_t lda, int64_t ldb, uint64_t seed) {
+    using fp = typename data_T_info<data_T>::value_type;
+    if (!dev.is_cpu())
+        return true;
+
+    getrf_fixture<data_T> f(dev, n, n, lda, seed);
+    std::vector<fp> B_initial(ldb * nrhs);
+    rand_matrix(seed, oneapi::mkl::transpose::nontrans, n, nrhs, B_initial, ldb);
+    std::vector<fp> B = B_initial;
+    bool result = true;
+
+    auto B_dev = device_alloc<data_T>(f.queue, B.size());
+    const auto getrs_size =
+        oneapi::mkl::lapack::getrs_scratchpad_size<fp>(f.queue, trans, n, nrhs, lda, ldb);
+    auto getrs_scratchpad_dev = device_alloc<data_T>(f.queue, getrs_size);
+    host_to_device_copy(f.queue, B.data(), B_dev, B.size());
+    f.queue.wait_and_throw();
+
+    oneapi::mkl::graph graph;
+    graph.begin(f.queue);
+    try {
+        auto factored = f.run();
+        oneapi::mkl::lapack::getrs(f.queue, trans, n, nrhs, f.A_dev, lda, f.ipiv_dev, B_dev, ldb,
+                                   getrs_scratchpad_dev, getrs_size, { factored });
+    }
+    catch (const oneapi::mkl::unimplemented&) {
+        /* Backends that submit their own kernels cannot be recorded */
+        graph.end();
+        f.queue.wait_and_throw();
+        device_free(f.queue, B_dev);
+        device_free(f.queue, getrs_scratchpad_dev);
+        return true;
+    }
+    graph.end();
+
+    if (graph.size() != 2) {
+        global::log << "graph recorded " << graph.size() << " calls instead of 2" << std::endl;
+        result = false;
+    }
+    device_to_host_copy(f.queue, B_dev, B.data(), B.size());
+    f.queue.wait_and_throw();
+    if (B != B_initial) {
+        global::log << "recorded solve ran before the graph" << std::endl;
+        result = false;
+    }
+
+    graph.run().wait_and_throw();
+
+    device_to_host_copy(f.queue, f.A_dev, f.A.data(), f.A.size());
+    device_to_host_copy(f.queue, f.ipiv_dev, f.ipiv.data(), f.ipiv.size());
+    device_to_host_copy(f.queue, B_dev, B.data(), B.size());
+    f.queue.wait_and_throw();
+    device_free(f.queue, B_dev);
+    device_free(f.queue, getrs_scratchpad_dev);
+
+    return check_getrs_accuracy(trans, n, nrhs, f.A.data(), lda, f.ipiv.data(), B.data(), ldb,
+                                f.A_initial.data(), B_initial.data()) &&
+           result;
+}
+
+InputTestController<decltype(::accuracy<void>)> accuracy_controller{ accuracy_input };
+
+} /* anonymous namespace */
+
+#include "lapack_gtest_suite.hpp"
+INSTANTIATE_GTEST_SUITE_ACCURACY_USM(GesvGraph);
@@ -0,0 +1,136 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cmath>
+#include <complex>
+#include <type_traits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl.hpp"
+#include "lapack_common.hpp"
+#include "lapack_test_controller.hpp"
+#include "lapack_accuracy_checks.hpp"
+#include "lapack_reference_wrappers.hpp"
+#include "test_helper.hpp"
+
+namespace {
+
+const char* accuracy_input = R"(
+27 13 29 31 31 27182 0
+131 4 131 140 133 27182 0
+27 13 29 31 31 27182 1
+)";
+
+/* The mixed-precision solvers take double-precision data only; the single
+ * precision instantiations of the suite pass trivially. */
+template <typename data_T>
+bool accuracy(const sycl::device& dev, int64_t n, int64_t nrhs, int64_t lda, int64_t ldb,
+              int64_t ldx, uint64_t seed, int64_t singular_in_float) {
+    using fp = typename data_T_info<data_T>::value_type;
+    using fp_real = typename complex_info<fp>::real_type;
+    if constexpr (!std::is_same_v<fp_real, double>) {
+        return true;
+    }
+    else {
+        /* Initialize */
+        std::vector<fp> A_initial(lda * n);
+        std::vector<fp> B_initial(ldb * nrhs);
+        rand_matrix(seed, oneapi::mkl::transpose::nontrans, n, n, A_initial, lda);
+        rand_matrix(seed, oneapi::mkl::transpose::nontrans, n, nrhs, B_initial, ldb);
+        for (int64_t i = 0; i < n; i++)
+            A_initial[i + i * lda] += static_cast<fp_real>(n);
+        if (singular_in_float) {
+            /* Decouple the two leading unknowns into a block that is nonsingular
+             * in double precision but rounds to [1 1; 1 1] in single precision */
+            for (int64_t i = 0; i < n; i++) {
+                for (int64_t j = 0; j < 2; j++)
+                    A_initial[i + j * lda] = A_initial[j + i * lda] = fp(0.0);
+            }
+            A_initial[0] = A_initial[1] = A_initial[lda] = fp(1.0);
+            A_initial[1 + lda] = fp(1.0 + std::ldexp(1.0, -30));
+        }
+
+        std::vector<fp> A = A_initial;
+        std::vector<fp> B = B_initial;
+        const fp padding = fp(-7.0);
+        std::vector<fp> X(ldx * nrhs, padding);
+        std::vector<int64_t> ipiv(n);
+        std::vector<int64_t> iter(1);
+
+        /* Compute on device */
+        {
+            sycl::queue queue{ dev, async_error_handler };
+
+            auto A_dev = device_alloc<data_T>(queue, A.size());
+            auto B_dev = device_alloc<data_T>(queue, B.size());
+            auto X_dev = device_alloc<data_T>(queue, X.size());
+            auto ipiv_dev = device_alloc<data_T, int64_t>(queue, ipiv.size());
+            auto iter_dev = device_alloc<data_T, int64_t>(queue, iter.size());
+
+            host_to_device_copy(queue, A.data(), A_dev, A.size());
+            host_to_device_copy(queue, B.data(), B_dev, B.size());
+            host_to_device_copy(queue, X.data(), X_dev, X.size());
+            queue.wait_and_throw();
+
+            oneapi::mkl::lapack::gesv_mixed(queue, n, nrhs, A_dev, lda, ipiv_dev, B_dev, ldb,
+                                            X_dev, ldx, iter_dev);
+            queue.wait_and_throw();
+
+            device_to_host_copy(queue, X_dev, X.data(), X.size());
+            device_to_host_copy(queue, iter_dev, iter.data(), iter.size());
+            queue.wait_and_throw();
+
+            device_free(queue, A_dev);
+            device_free(queue, B_dev);
+            device_free(queue, X_dev);
+            device_free(queue, ipiv_dev);
+            device_free(queue, iter_dev);
+        }
+
+        /* Rows of X past n are not part of the solution and keep their values */
+        for (int64_t col = 0; col < nrhs; col++) {
+            for (int64_t row = n; row < ldx; row++) {
+                if (X[row + col * ldx] != padding) {
+                    global::log << "padding of X overwritten at row " << row << ", column "
+                                << col << std::endl;
+                    return false;
+                }
+            }
+        }
+
+        /* The single-precision factorization fails on the singular block and
+         * falls back to double precision; otherwise no fallback is expected */
+        if (singular_in_float ? iter[0] != -3 : iter[0] < 0) {
+            global::log << "iterative refinement returned iter = " << iter[0] << std::endl;
+            return false;
+        }
+        return check_getrs_accuracy(oneapi::mkl::transpose::nontrans, n, nrhs, A.data(), lda,
+                                    ipiv.data(), X.data(), ldx, A_initial.data(),
+                                    B_initial.data());
+    }
+}
+
+InputTestController<decltype(::accuracy<void>)> accuracy_controller{ accuracy_input };
+
+} /* anonymous namespace */
+
+#include "lapack_gtest_suite.hpp"
+INSTANTIATE_GTEST_SUITE_ACCURACY(GesvMixed);
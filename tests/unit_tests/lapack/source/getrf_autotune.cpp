@@ -0,0 +1,105 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl.hpp"
+#include "lapack_common.hpp"
+#include "lapack_test_controller.hpp"
+#include "lapack_getrf_fixture.hpp"
+#include "test_helper.hpp"
+
+namespace {
+
+const char* accuracy_input = R"(
+24 15 29 27182
+)";
+
+/* Repeats a factorization with autotuning enabled on a profiling queue, so
+ * that calibration calls are timed on every installed CPU backend until a
+ * winner is picked, and checks every result and the winner saved for the size
+ * class of the call. A single backend is calibrated the same way. */
+template <typename data_T>
+bool accuracy(const sycl::device& dev, int64_t m, int64_t n, int64_t lda, uint64_t seed) {
+    const std::string path = "onemkl_autotune_test.txt";
+    const int repeats = 8;
+
+    std::remove(path.c_str());
+    oneapi::mkl::autotune::enable(path);
+    bool result = true;
+    {
+        getrf_fixture<data_T> f(dev, m, n, lda, seed,
+                                sycl::property_list{ sycl::property::queue::enable_profiling() });
+        for (int i = 0; i < repeats; i++) {
+            f.load();
+            f.run();
+            if (!f.check()) {
+                global::log << "wrong factorization on call " << i << std::endl;
+                result = false;
+            }
+        }
+    }
+    oneapi::mkl::autotune::save();
+    oneapi::mkl::autotune::disable();
+    if (oneapi::mkl::autotune::is_enabled()) {
+        global::log << "autotuning is still enabled" << std::endl;
+        result = false;
+    }
+
+    /* Only x86cpu calls are routed */
+    if (!dev.is_cpu()) {
+        std::remove(path.c_str());
+        return result;
+    }
+
+    /* Each entry names a size class and the library of its winner */
+    int bucket = 0;
+    for (int64_t size = std::max(m, n); size > 0; size >>= 1)
+        bucket++;
+    const std::string key = "lapack column_major " + getrf_fixture<data_T>::routine() + " " +
+                            std::to_string(bucket) + " ";
+    std::ifstream file(path);
+    std::string winner;
+    for (std::string line; std::getline(file, line);) {
+        if (line.compare(0, key.size(), key) == 0)
+            winner = line.substr(key.size());
+    }
+    file.close();
+    std::remove(path.c_str());
+
+    if (winner.find("onemkl_lapack_") == std::string::npos) {
+        global::log << "no winner saved for " << key << std::endl;
+        result = false;
+    }
+    return result;
+}
+
+InputTestController<decltype(::accuracy<void>)> accuracy_controller{ accuracy_input };
+
+} /* anonymous namespace */
+
+#include "lapack_gtest_suite.hpp"
+INSTANTIATE_GTEST_SUITE_ACCURACY_USM(GetrfAutotune);
@@ -0,0 +1,150 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl.hpp"
+#include "lapack_common.hpp"
+#include "lapack_test_controller.hpp"
+#include "lapack_accuracy_checks.hpp"
+#include "test_helper.hpp"
+
+namespace {
+
+const char* accuracy_input = R"(
+7 9 70 37 27182
+)";
+
+/* Sets an environment variable, or unsets it for a null value, and restores
+ * its previous value on destruction */
+class scoped_env {
+public:
+    scoped_env(const char* name, const char* value) : name(name) {
+        const char* previous = std::getenv(name);
+        if (previous != nullptr)
+            saved = previous;
+        had_value = previous != nullptr;
+        set(value);
+    }
+    ~scoped_env() {
+        set(had_value ? saved.c_str() : nullptr);
+    }
+
+private:
+    void set(const char* value) {
+#ifdef _WIN32
+        _putenv_s(name, value != nullptr ? value : "");
+#else
+        if (value != nullptr)
+            setenv(name, value, 1);
+        else
+            unsetenv(name);
+#endif
+    }
+
+    const char* name;
+    std::string saved;
+    bool had_value;
+};
+
+/* Factors the batch on the device with the small batch cutoff and layout of
+ * the netlib backend set to cutoff and layout, null for their default */
+template <typename data_T>
+void factor(const sycl::device& dev, const char* cutoff, const char* layout, int64_t n,
+            int64_t lda, int64_t stride_a, int64_t batch_size,
+            std::vector<typename data_T_info<data_T>::value_type>& A,
+            std::vector<int64_t>& ipiv) {
+    using fp = typename data_T_info<data_T>::value_type;
+    scoped_env cutoff_env("ONEMKL_LAPACK_SMALL_BATCH_CUTOFF", cutoff);
+    scoped_env layout_env("ONEMKL_LAPACK_SMALL_BATCH_LAYOUT", layout);
+
+    sycl::queue queue{ dev, async_error_handler };
+    auto A_dev = device_alloc<data_T>(queue, A.size());
+    auto ipiv_dev = device_alloc<data_T, int64_t>(queue, ipiv.size());
+    const auto scratchpad_size = oneapi::mkl::lapack::getrf_batch_scratchpad_size<fp>(
+        queue, n, n, lda, stride_a, n, batch_size);
+    auto scratchpad_dev = device_alloc<data_T>(queue, scratchpad_size);
+
+    host_to_device_copy(queue, A.data(), A_dev, A.size());
+    queue.wait_and_throw();
+    oneapi::mkl::lapack::getrf_batch(queue, n, n, A_dev, lda, stride_a, ipiv_dev, n, batch_size,
+                                     scratchpad_dev, scratchpad_size);
+    queue.wait_and_throw();
+
+    device_to_host_copy(queue, A_dev, A.data(), A.size());
+    device_to_host_copy(queue, ipiv_dev, ipiv.data(), ipiv.size());
+    queue.wait_and_throw();
+
+    device_free(queue, A_dev);
+    device_free(queue, ipiv_dev);
+    device_free(queue, scratchpad_dev);
+}
+
+/* Factors a strided batch of more problems than the lanes of the interleaved
+ * kernels, of an order below their cutoff, with the cutoff at 0 (one LAPACK
+ * call per problem), at its default with the interleaved layout and at its
+ * default with the native layout. Each run must be accurate, and the kernels
+ * must choose the pivots of LAPACK and agree with its factors. */
+template <typename data_T>
+bool accuracy(const sycl::device& dev, int64_t n, int64_t lda, int64_t stride_a,
+              int64_t batch_size, uint64_t seed) {
+    using fp = typename data_T_info<data_T>::value_type;
+
+    std::vector<fp> A_initial(stride_a * batch_size);
+    for (int64_t i = 0; i < batch_size; i++)
+        rand_matrix(seed, oneapi::mkl::transpose::nontrans, n, n, A_initial, lda, i * stride_a);
+
+    std::vector<fp> A_ref = A_initial;
+    std::vector<int64_t> ipiv_ref(n * batch_size);
+    factor<data_T>(dev, "0", nullptr, n, lda, stride_a, batch_size, A_ref, ipiv_ref);
+
+    bool result = true;
+    for (const char* layout : { "native", "interleaved" }) {
+        std::vector<fp> A = A_initial;
+        std::vector<int64_t> ipiv(n * batch_size);
+        factor<data_T>(dev, nullptr, layout, n, lda, stride_a, batch_size, A, ipiv);
+
+        for (int64_t i = 0; i < batch_size; i++) {
+            const auto a = A.data() + i * stride_a;
+            const auto a_ref = A_ref.data() + i * stride_a;
+            if (!check_getrf_accuracy(n, n, a, lda, ipiv.data() + i * n,
+                                      A_initial.data() + i * stride_a) ||
+                !std::equal(ipiv.begin() + i * n, ipiv.begin() + (i + 1) * n,
+                            ipiv_ref.begin() + i * n) ||
+                !rel_mat_err_check(n, n, a, lda, a_ref, lda)) {
+                global::log << layout << " layout: batch routine index " << i << " failed"
+                            << std::endl;
+                result = false;
+            }
+        }
+    }
+    return result;
+}
+
+InputTestController<decltype(::accuracy<void>)> accuracy_controller{ accuracy_input };
+
+} /* anonymous namespace */
+
+#include "lapack_gtest_suite.hpp"
+INSTANTIATE_GTEST_SUITE_ACCURACY(GetrfBatchSmall);
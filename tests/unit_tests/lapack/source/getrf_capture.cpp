@@ -0,0 +1,169 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl.hpp"
+#include "lapack_common.hpp"
+#include "lapack_test_controller.hpp"
+#include "lapack_getrf_fixture.hpp"
+#include "test_helper.hpp"
+
+namespace {
+
+const char* accuracy_input = R"(
+24 15 29 27182
+)";
+
+/* Reads the varints and strings of a capture, see oneapi/mkl/capture.hpp */
+class capture_reader {
+public:
+    capture_reader(const std::string& data, std::size_t pos) : data_(data), pos_(pos) {}
+
+    bool done() const {
+        return pos_ >= data_.size();
+    }
+
+    char byte() {
+        return pos_ < data_.size() ? data_[pos_++] : '\0';
+    }
+
+    uint64_t get() {
+        uint64_t value = 0;
+        for (int shift = 0; pos_ < data_.size() && shift < 64; shift += 7) {
+            const auto b = static_cast<unsigned char>(data_[pos_++]);
+            value |= static_cast<uint64_t>(b & 0x7f) << shift;
+            if ((b & 0x80) == 0)
+                break;
+        }
+        return value;
+    }
+
+    int64_t get_signed() {
+        const uint64_t value = get();
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    std::string get_string() {
+        const auto length = get();
+        const std::string s = data_.substr(pos_, length);
+        pos_ += length;
+        return s;
+    }
+
+private:
+    const std::string& data_;
+    std::size_t pos_;
+};
+
+/* Captures a factorization into a file, then makes another one with the
+ * capture stopped, and decodes the file: it must declare the routine with its
+ * layout and dimension names and hold one call with the dimensions of the
+ * factorization. */
+template <typename data_T>
+bool accuracy(const sycl::device& dev, int64_t m, int64_t n, int64_t lda, uint64_t seed) {
+    const std::string path = "onemkl_capture_test.bin";
+    getrf_fixture<data_T> f(dev, m, n, lda, seed);
+
+    oneapi::mkl::capture::start(path);
+    f.run();
+    bool result = f.check();
+    oneapi::mkl::capture::stop();
+    if (oneapi::mkl::capture::is_active()) {
+        global::log << "capture is still active" << std::endl;
+        result = false;
+    }
+    f.load();
+    f.run();
+    result = f.check() && result;
+
+    std::ifstream file(path, std::ios::binary);
+    std::stringstream capture;
+    capture << file.rdbuf();
+    file.close();
+    std::remove(path.c_str());
+
+    const std::string data = capture.str();
+    if (data.compare(0, 8, oneapi::mkl::capture::format_magic) != 0) {
+        global::log << "capture does not start with the format magic" << std::endl;
+        return false;
+    }
+    capture_reader reader(data, 8);
+    const uint64_t none = UINT64_MAX;
+    uint64_t getrf_id = none;
+    std::vector<std::vector<int64_t>> calls;
+    while (!reader.done()) {
+        const char tag = reader.byte();
+        if (tag == 'R') {
+            const uint64_t id = reader.get();
+            const char domain = reader.byte();
+            const std::string layout = reader.get_string();
+            const std::string name = reader.get_string();
+            const std::string dims = reader.get_string();
+            if (name != getrf_fixture<data_T>::routine())
+                continue;
+            getrf_id = id;
+            if (domain != 1 || layout != "column_major" || dims.compare(0, 8, "m n lda ") != 0) {
+                global::log << "unexpected declaration of " << name << ": domain "
+                            << int(domain) << " " << layout << " " << dims << std::endl;
+                result = false;
+            }
+        }
+        else if (tag == 'C') {
+            const uint64_t id = reader.get();
+            reader.byte();
+            std::vector<int64_t> values(reader.get());
+            for (auto& value : values)
+                value = reader.get_signed();
+            reader.get_signed();
+            reader.get();
+            if (id == getrf_id)
+                calls.push_back(values);
+        }
+        else {
+            global::log << "unknown capture record " << int(tag) << std::endl;
+            return false;
+        }
+    }
+
+    if (getrf_id == none || calls.size() != 1) {
+        global::log << "capture holds " << calls.size() << " getrf calls instead of 1"
+                    << std::endl;
+        return false;
+    }
+    if (calls[0].size() < 3 || calls[0][0] != m || calls[0][1] != n || calls[0][2] != lda) {
+        global::log << "captured call does not have the dimensions of the factorization"
+                    << std::endl;
+        result = false;
+    }
+    return result;
+}
+
+InputTestController<decltype(::accuracy<void>)> accuracy_controller{ accuracy_input };
+
+} /* anonymous namespace */
+
+#include "lapack_gtest_suite.hpp"
+INSTANTIATE_GTEST_SUITE_ACCURACY(GetrfCapture);
@@ -0,0 +1,73 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+#include <algorithm>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl.hpp"
+#include "lapack_common.hpp"
+#include "lapack_test_controller.hpp"
+#include "lapack_getrf_fixture.hpp"
+#include "test_helper.hpp"
+
+namespace {
+
+const char* accuracy_input = R"(
+24 15 29 27182
+)";
+
+/* Factors a matrix below the inline threshold with inline calls enabled and
+ * checks the factorization. On a backend that runs its calls as host tasks,
+ * the call must have run on the calling thread: its event is complete as soon
+ * as it returns. */
+template <typename data_T>
+bool accuracy(const sycl::device& dev, int64_t m, int64_t n, int64_t lda, uint64_t seed) {
+    getrf_fixture<data_T> f(dev, m, n, lda, seed);
+    bool result = true;
+
+    const auto threshold = oneapi::mkl::inline_calls::get_threshold();
+    oneapi::mkl::inline_calls::enable(std::max(m, n) + 1);
+    if (oneapi::mkl::inline_calls::get_threshold() != std::max(m, n) + 1) {
+        global::log << "inline threshold not set" << std::endl;
+        result = false;
+    }
+    oneapi::mkl::stats::reset();
+    auto done = f.run();
+    const auto status = done.template get_info<sycl::info::event::command_execution_status>();
+    done.wait_and_throw();
+    if (threshold > 0)
+        oneapi::mkl::inline_calls::enable(threshold);
+    else
+        oneapi::mkl::inline_calls::disable();
+
+    if (dev.is_cpu() && getrf_runs_host_tasks() &&
+        status != sycl::info::event_command_status::complete) {
+        global::log << "call was not run inline" << std::endl;
+        result = false;
+    }
+    return f.check() && result;
+}
+
+InputTestController<decltype(::accuracy<void>)> accuracy_controller{ accuracy_input };
+
+} /* anonymous namespace */
+
+#include "lapack_gtest_suite.hpp"
+INSTANTIATE_GTEST_SUITE_ACCURACY_USM(GetrfInline);
@@ -0,0 +1,137 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+#include <cstdlib>
+#include <vector>
+
+#ifdef __linux__
+#include <dirent.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl.hpp"
+#include "lapack_common.hpp"
+#include "lapack_test_controller.hpp"
+#include "lapack_getrf_fixture.hpp"
+#include "test_helper.hpp"
+
+namespace {
+
+const char* accuracy_input = R"(
+512 512 512 27182
+)";
+
+#ifdef __linux__
+/* Whether a thread of the process other than the calling one runs pinned to
+ * exactly the CPUs of mask */
+bool thread_pinned_to(const cpu_set_t& mask) {
+    DIR* tasks = opendir("/proc/self/task");
+    if (tasks == nullptr)
+        return false;
+    const pid_t self = static_cast<pid_t>(syscall(SYS_gettid));
+    bool found = false;
+    while (dirent* task = readdir(tasks)) {
+        const pid_t tid = static_cast<pid_t>(std::atoi(task->d_name));
+        cpu_set_t cpus;
+        if (tid > 0 && tid != self && sched_getaffinity(tid, sizeof(cpus), &cpus) == 0 &&
+            CPU_EQUAL(&cpus, &mask)) {
+            found = true;
+            break;
+        }
+    }
+    closedir(tasks);
+    return found;
+}
+#endif
+
+/* Factors a matrix on a queue with an execution policy of one thread on two
+ * CPUs, checks that the policy reads back, and checks the factorization. On a
+ * backend that runs its calls as host tasks, a thread must be seen pinned to
+ * the two CPUs while a call runs. The CPUs are the first and last ones the
+ * calling thread may use, which other threads are unlikely to be pinned to
+ * alone. */
+template <typename data_T>
+bool accuracy(const sycl::device& dev, int64_t m, int64_t n, int64_t lda, uint64_t seed) {
+    const int attempts = 10;
+    getrf_fixture<data_T> f(dev, m, n, lda, seed);
+    bool result = true;
+
+    oneapi::mkl::execution_policy policy;
+    policy.threads = 1;
+    bool observable = false;
+#ifdef __linux__
+    cpu_set_t allowed, mask;
+    CPU_ZERO(&mask);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0 && CPU_COUNT(&allowed) > 2) {
+        int first = -1, last = -1;
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (CPU_ISSET(cpu, &allowed)) {
+                first = first < 0 ? cpu : first;
+                last = cpu;
+            }
+        }
+        policy.cpus = { first, last };
+        CPU_SET(first, &mask);
+        CPU_SET(last, &mask);
+        observable = true;
+    }
+#endif
+    oneapi::mkl::set_execution_policy(f.queue, policy);
+    const auto set = oneapi::mkl::get_execution_policy(f.queue);
+    if (set.threads != policy.threads || set.cpus != policy.cpus) {
+        global::log << "execution policy not set" << std::endl;
+        result = false;
+    }
+
+    oneapi::mkl::stats::reset();
+    bool pinned = false;
+    for (int attempt = 0; attempt < (observable ? attempts : 1) && !pinned; attempt++) {
+        f.load();
+        auto done = f.run();
+#ifdef __linux__
+        while (observable && !pinned &&
+               done.template get_info<sycl::info::event::command_execution_status>() !=
+                   sycl::info::event_command_status::complete)
+            pinned = thread_pinned_to(mask);
+#endif
+        done.wait_and_throw();
+        result = f.check() && result;
+    }
+
+    oneapi::mkl::clear_execution_policy(f.queue);
+    if (oneapi::mkl::get_execution_policy(f.queue).threads != 0) {
+        global::log << "execution policy not cleared" << std::endl;
+        result = false;
+    }
+    if (observable && dev.is_cpu() && getrf_runs_host_tasks() && !pinned) {
+        global::log << "no thread was pinned to the CPUs of the policy" << std::endl;
+        result = false;
+    }
+    return result;
+}
+
+InputTestController<decltype(::accuracy<void>)> accuracy_controller{ accuracy_input };
+
+} /* anonymous namespace */
+
+#include "lapack_gtest_suite.hpp"
+INSTANTIATE_GTEST_SUITE_ACCURACY_USM(GetrfPolicy);
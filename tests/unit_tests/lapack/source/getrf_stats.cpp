@@ -0,0 +1,98 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl.hpp"
+#include "lapack_common.hpp"
+#include "lapack_test_controller.hpp"
+#include "lapack_getrf_fixture.hpp"
+#include "test_helper.hpp"
+
+namespace {
+
+const char* accuracy_input = R"(
+24 15 29 27182
+)";
+
+/* Counts two factorizations and checks that, without autotuning, both are
+ * counted on one named backend with their work estimate and size bucket. */
+template <typename data_T>
+bool accuracy(const sycl::device& dev, int64_t m, int64_t n, int64_t lda, uint64_t seed) {
+    using fp = typename data_T_info<data_T>::value_type;
+    const int64_t repeat = 2;
+    getrf_fixture<data_T> f(dev, m, n, lda, seed);
+
+    bool result = true;
+    oneapi::mkl::stats::reset();
+    for (int64_t r = 0; r < repeat; r++) {
+        f.load();
+        f.run();
+        result = f.check() && result;
+    }
+
+    const auto stats = getrf_stats();
+    if (stats.size() != 1) {
+        global::log << "getrf counted on " << stats.size() << " backends instead of 1"
+                    << std::endl;
+        return false;
+    }
+    const auto& entry = stats[0];
+    int bucket = 0;
+    for (int64_t size = std::max(m, n); size > 0; size >>= 1)
+        bucket++;
+    if (entry.domain != "lapack" || entry.layout != "column_major" || entry.calls != repeat) {
+        global::log << "unexpected statistics for " << entry.routine << ": " << entry.domain
+                    << " " << entry.layout << " " << entry.calls << " calls" << std::endl;
+        result = false;
+    }
+    if (entry.device.empty() || entry.backend.empty()) {
+        global::log << "statistics do not name the device and backend of the calls"
+                    << std::endl;
+        result = false;
+    }
+    if (entry.flops <= 0 || entry.bytes < repeat * m * n * sizeof(fp)) {
+        global::log << "missing work estimate: " << entry.flops << " flops " << entry.bytes
+                    << " bytes" << std::endl;
+        result = false;
+    }
+    if (entry.size_histogram[bucket] != repeat) {
+        global::log << "calls not counted in size bucket " << bucket << std::endl;
+        result = false;
+    }
+
+    oneapi::mkl::stats::reset();
+    if (!getrf_stats().empty()) {
+        global::log << "statistics not cleared by reset" << std::endl;
+        result = false;
+    }
+    return result;
+}
+
+InputTestController<decltype(::accuracy<void>)> accuracy_controller{ accuracy_input };
+
+} /* anonymous namespace */
+
+#include "lapack_gtest_suite.hpp"
+INSTANTIATE_GTEST_SUITE_ACCURACY(GetrfStats);
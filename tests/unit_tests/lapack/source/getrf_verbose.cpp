@@ -0,0 +1,104 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl.hpp"
+#include "lapack_common.hpp"
+#include "lapack_test_controller.hpp"
+#include "lapack_getrf_fixture.hpp"
+#include "test_helper.hpp"
+
+namespace {
+
+const char* accuracy_input = R"(
+24 15 29 27182
+)";
+
+/* Traces a factorization into a file, then makes another one with tracing
+ * disabled, and checks that the trace holds one complete record of the call
+ * with its routine, domain, backend and dimensions. */
+template <typename data_T>
+bool accuracy(const sycl::device& dev, int64_t m, int64_t n, int64_t lda, uint64_t seed) {
+    const std::string path = "onemkl_verbose_test.json";
+    getrf_fixture<data_T> f(dev, m, n, lda, seed);
+
+    std::remove(path.c_str());
+    oneapi::mkl::verbose::enable(path);
+    f.run();
+    bool result = f.check();
+    oneapi::mkl::verbose::disable();
+    if (oneapi::mkl::verbose::is_enabled()) {
+        global::log << "tracing is still enabled" << std::endl;
+        result = false;
+    }
+    f.load();
+    f.run();
+    result = f.check() && result;
+
+    /* Each record is a line of its own, starting with the routine name */
+    const std::string name_field = "{\"name\":\"";
+    std::ifstream file(path);
+    std::vector<std::string> records;
+    for (std::string line; std::getline(file, line);) {
+        if (line.compare(0, name_field.size(), name_field) != 0)
+            continue;
+        const auto end = line.find('"', name_field.size());
+        if (is_getrf(line.substr(name_field.size(), end - name_field.size())))
+            records.push_back(line);
+    }
+    file.close();
+    std::remove(path.c_str());
+
+    if (records.size() != 1) {
+        global::log << "trace holds " << records.size() << " getrf records instead of 1"
+                    << std::endl;
+        return false;
+    }
+    const std::string expected[] = { "\"cat\":\"lapack\"",
+                                     "\"ph\":\"X\"",
+                                     "\"layout\":\"column_major\"",
+                                     "\"m\":" + std::to_string(m) + ",",
+                                     "\"n\":" + std::to_string(n) + ",",
+                                     "\"lda\":" + std::to_string(lda) + "," };
+    for (const auto& text : expected) {
+        if (records[0].find(text) == std::string::npos) {
+            global::log << "trace record does not contain " << text << std::endl;
+            result = false;
+        }
+    }
+    if (records[0].find("\"backend\":\"\"") != std::string::npos) {
+        global::log << "trace record does not name its backend" << std::endl;
+        result = false;
+    }
+    return result;
+}
+
+InputTestController<decltype(::accuracy<void>)> accuracy_controller{ accuracy_input };
+
+} /* anonymous namespace */
+
+#include "lapack_gtest_suite.hpp"
+INSTANTIATE_GTEST_SUITE_ACCURACY(GetrfVerbose);
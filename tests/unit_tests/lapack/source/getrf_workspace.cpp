@@ -0,0 +1,69 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl.hpp"
+#include "lapack_common.hpp"
+#include "lapack_test_controller.hpp"
+#include "lapack_getrf_fixture.hpp"
+#include "test_helper.hpp"
+
+namespace {
+
+const char* accuracy_input = R"(
+24 15 29 27182
+82 39 85 27182
+329 329 329 27182
+)";
+
+/* Factorizes the same matrix several times through the overload without
+ * scratchpad arguments, so that later calls reuse the pooled workspace and
+ * the memoized scratchpad size. */
+template <typename data_T>
+bool accuracy(const sycl::device& dev, int64_t m, int64_t n, int64_t lda, uint64_t seed) {
+    const int64_t repeat = 3;
+    getrf_fixture<data_T> f(dev, m, n, lda, seed);
+    const auto stats_before = oneapi::mkl::lapack::get_scratchpad_cache_stats();
+
+    bool result = true;
+    for (int64_t r = 0; r < repeat; r++) {
+        f.load();
+        oneapi::mkl::lapack::getrf(f.queue, m, n, f.A_dev, lda, f.ipiv_dev);
+        result = f.check() && result;
+    }
+    oneapi::mkl::lapack::release_workspace(f.queue);
+
+    /* Every call after the first one must find its scratchpad size memoized */
+    const auto stats_after = oneapi::mkl::lapack::get_scratchpad_cache_stats();
+    if (stats_after.hits - stats_before.hits < repeat - 1) {
+        global::log << "scratchpad size queries were not memoized" << std::endl;
+        result = false;
+    }
+    return result;
+}
+
+InputTestController<decltype(::accuracy<void>)> accuracy_controller{ accuracy_input };
+
+} /* anonymous namespace */
+
+#include "lapack_gtest_suite.hpp"
+INSTANTIATE_GTEST_SUITE_ACCURACY(GetrfWorkspace);
@@ -38,6 +38,7 @@ const char* accuracy_input = R"(
 200 200 180 220 27182
 200 180 180 220 27182
 200 180 160 220 27182
+2000 12  12  2003 27182
 )";
 
 template <typename data_T>
@@ -0,0 +1,189 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <complex>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl.hpp"
+#include "lapack_common.hpp"
+#include "lapack_test_controller.hpp"
+#include "lapack_accuracy_checks.hpp"
+#include "lapack_reference_wrappers.hpp"
+#include "test_helper.hpp"
+
+namespace {
+
+const char* accuracy_input = R"(
+1 2 0 27 33 1 5 29 27182
+1 1 1 27 33 3 9 29 27182
+0 0 0 27 33 1 27 29 27182
+)";
+
+template <typename data_T>
+bool accuracy(const sycl::device& dev, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+              oneapi::mkl::uplo uplo, int64_t n, int64_t lda, int64_t il, int64_t iu, int64_t ldz,
+              uint64_t seed) {
+    using fp = typename data_T_info<data_T>::value_type;
+    using fp_real = typename complex_info<fp>::real_type;
+
+    /* Initialize */
+    std::vector<fp> A(lda * n);
+    rand_hermitian_matrix(seed, uplo, n, A, lda);
+
+    std::vector<fp> A_initial = A;
+    std::vector<int64_t> m(1);
+    std::vector<fp_real> w(n);
+    std::vector<fp> Z(ldz * n);
+
+    /* The reference spectrum gives the value range matching eigenvalues il..iu */
+    std::vector<fp_real> D_ref(n);
+    reference::syevd(oneapi::mkl::job::novec, uplo, n, std::vector<fp>(A_initial).data(), lda,
+                     D_ref.data());
+    const fp_real vl = il > 1 ? (D_ref[il - 2] + D_ref[il - 1]) / 2 : D_ref[0] - 1;
+    const fp_real vu = iu < n ? (D_ref[iu - 1] + D_ref[iu]) / 2 : D_ref[n - 1] + 1;
+    const fp_real abstol = 2 * reference::lamch<fp_real>('S');
+    const int64_t first = range == oneapi::mkl::rangev::all ? 0 : il - 1;
+    const int64_t count = range == oneapi::mkl::rangev::all ? n : iu - il + 1;
+
+    /* Compute on device */
+    {
+        sycl::queue queue{ dev, async_error_handler };
+        auto A_dev = device_alloc<data_T>(queue, A.size());
+        auto m_dev = device_alloc<data_T, int64_t>(queue, m.size());
+        auto w_dev = device_alloc<data_T, fp_real>(queue, w.size());
+        auto Z_dev = device_alloc<data_T>(queue, Z.size());
+#ifdef CALL_RT_API
+        const auto scratchpad_size = oneapi::mkl::lapack::syevr_scratchpad_size<fp>(
+            queue, jobz, range, uplo, n, lda, ldz);
+#else
+        int64_t scratchpad_size;
+        TEST_RUN_CT_SELECT(queue, scratchpad_size = oneapi::mkl::lapack::syevr_scratchpad_size<fp>,
+                           jobz, range, uplo, n, lda, ldz);
+#endif
+        auto scratchpad_dev = device_alloc<data_T>(queue, scratchpad_size);
+
+        host_to_device_copy(queue, A.data(), A_dev, A.size());
+        queue.wait_and_throw();
+
+#ifdef CALL_RT_API
+        oneapi::mkl::lapack::syevr(queue, jobz, range, uplo, n, A_dev, lda, vl, vu, il, iu, abstol,
+                                   m_dev, w_dev, Z_dev, ldz, scratchpad_dev, scratchpad_size);
+#else
+        TEST_RUN_CT_SELECT(queue, oneapi::mkl::lapack::syevr, jobz, range, uplo, n, A_dev, lda, vl,
+                           vu, il, iu, abstol, m_dev, w_dev, Z_dev, ldz, scratchpad_dev,
+                           scratchpad_size);
+#endif
+        queue.wait_and_throw();
+
+        device_to_host_copy(queue, m_dev, m.data(), m.size());
+        device_to_host_copy(queue, w_dev, w.data(), w.size());
+        device_to_host_copy(queue, Z_dev, Z.data(), Z.size());
+        queue.wait_and_throw();
+
+        device_free(queue, A_dev);
+        device_free(queue, m_dev);
+        device_free(queue, w_dev);
+        device_free(queue, Z_dev);
+        device_free(queue, scratchpad_dev);
+    }
+
+    hermitian_to_full(uplo, n, A_initial, lda);
+    return check_partial_eigen_accuracy(jobz, n, first, count, m[0], A_initial.data(), lda,
+                                        w.data(), Z.data(), ldz, D_ref.data());
+}
+
+const char* dependency_input = R"(
+1 0 1 1 1 1 1 1 1
+)";
+
+template <typename data_T>
+bool usm_dependency(const sycl::device& dev, oneapi::mkl::job jobz, oneapi::mkl::rangev range,
+                    oneapi::mkl::uplo uplo, int64_t n, int64_t lda, int64_t il, int64_t iu,
+                    int64_t ldz, uint64_t seed) {
+    using fp = typename data_T_info<data_T>::value_type;
+    using fp_real = typename complex_info<fp>::real_type;
+
+    /* Initialize */
+    std::vector<fp> A(lda * n);
+    rand_hermitian_matrix(seed, uplo, n, A, lda);
+
+    std::vector<int64_t> m(1);
+    std::vector<fp_real> w(n);
+    std::vector<fp> Z(ldz * n);
+    const fp_real vl = 0.0;
+    const fp_real vu = 0.0;
+    const fp_real abstol = 0.0;
+
+    /* Compute on device */
+    bool result;
+    {
+        sycl::queue queue{ dev, async_error_handler };
+        auto A_dev = device_alloc<data_T>(queue, A.size());
+        auto m_dev = device_alloc<data_T, int64_t>(queue, m.size());
+        auto w_dev = device_alloc<data_T, fp_real>(queue, w.size());
+        auto Z_dev = device_alloc<data_T>(queue, Z.size());
+#ifdef CALL_RT_API
+        const auto scratchpad_size = oneapi::mkl::lapack::syevr_scratchpad_size<fp>(
+            queue, jobz, range, uplo, n, lda, ldz);
+#else
+        int64_t scratchpad_size;
+        TEST_RUN_CT_SELECT(queue, scratchpad_size = oneapi::mkl::lapack::syevr_scratchpad_size<fp>,
+                           jobz, range, uplo, n, lda, ldz);
+#endif
+        auto scratchpad_dev = device_alloc<data_T>(queue, scratchpad_size);
+
+        host_to_device_copy(queue, A.data(), A_dev, A.size());
+        queue.wait_and_throw();
+
+        /* Check dependency handling */
+        auto in_event = create_dependent_event(queue);
+#ifdef CALL_RT_API
+        sycl::event func_event = oneapi::mkl::lapack::syevr(
+            queue, jobz, range, uplo, n, A_dev, lda, vl, vu, il, iu, abstol, m_dev, w_dev, Z_dev,
+            ldz, scratchpad_dev, scratchpad_size, sycl::vector_class<sycl::event>{ in_event });
+#else
+        sycl::event func_event;
+        TEST_RUN_CT_SELECT(queue, sycl::event func_event = oneapi::mkl::lapack::syevr, jobz, range,
+                           uplo, n, A_dev, lda, vl, vu, il, iu, abstol, m_dev, w_dev, Z_dev, ldz,
+                           scratchpad_dev, scratchpad_size,
+                           sycl::vector_class<sycl::event>{ in_event });
+#endif
+        result = check_dependency(queue, in_event, func_event);
+
+        queue.wait_and_throw();
+        device_free(queue, A_dev);
+        device_free(queue, m_dev);
+        device_free(queue, w_dev);
+        device_free(queue, Z_dev);
+        device_free(queue, scratchpad_dev);
+    }
+
+    return result;
+}
+
+InputTestController<decltype(::accuracy<void>)> accuracy_controller{ accuracy_input };
+InputTestController<decltype(::usm_dependency<void>)> dependency_controller{ dependency_input };
+
+} /* anonymous namespace */
+
+#include "lapack_gtest_suite.hpp"
+INSTANTIATE_GTEST_SUITE_ACCURACY_REAL(Syevr);
+INSTANTIATE_GTEST_SUITE_DEPENDENCY_REAL(Syevr);
@@ -32,22 +32,28 @@
 namespace {
 
 const char* accuracy_input = R"(
-50  50  30  70 27182
-50  30  30  70 27182
-50  30  10  70 27182
-200 200 180 220 27182
-200 180 180 220 27182
+50  50  30  70 27182 0
+50  30  30  70 27182 0
+50  30  10  70 27182 0
+200 200 180 220 27182 0
+200 180 180 220 27182 0
+2000 12  12  2003 27182 0
+2000 12  12  2003 27182 1e6
 )";
 
+/* A nonzero leading_imag sets A(0,0) to i * leading_imag, which makes the
+ * leading entry of Q nearly imaginary. */
 template <typename data_T>
 bool accuracy(const sycl::device& dev, int64_t m, int64_t n, int64_t k, int64_t lda,
-              uint64_t seed) {
+              uint64_t seed, double leading_imag) {
     using fp = typename data_T_info<data_T>::value_type;
     using fp_real = typename complex_info<fp>::real_type;
 
     /* Initialize */
     std::vector<fp> A(lda * n);
     rand_matrix(seed, oneapi::mkl::transpose::nontrans, m, n, A, lda);
+    if (leading_imag != 0.0)
+        A[0] = fp(0.0, static_cast<fp_real>(leading_imag));
     std::vector<fp> tau(k);
 
     auto info = reference::geqrf(m, k, A.data(), lda, tau.data());
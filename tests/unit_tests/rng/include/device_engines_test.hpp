@@ -0,0 +1,128 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _RNG_TEST_DEVICE_ENGINES_TEST_HPP__
+#define _RNG_TEST_DEVICE_ENGINES_TEST_HPP__
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl.hpp"
+#include "oneapi/mkl/rng/device.hpp"
+
+#include "rng_test_common.hpp"
+
+#define DEVICE_OFFSET 12345
+
+static inline cl::sycl::queue get_sycl_queue(cl::sycl::queue queue) {
+    return queue;
+}
+
+template <oneapi::mkl::backend Backend>
+static inline cl::sycl::queue get_sycl_queue(oneapi::mkl::backend_selector<Backend> selector) {
+    return selector.get_queue();
+}
+
+// Checks that device engines reproduce the host engine sequence for the same seed and offset
+//  both inside a kernel, one engine per work-item, and in a host loop
+template <typename Engine, typename DeviceEngine>
+class device_engines_test {
+public:
+    template <typename Queue>
+    void operator()(Queue queue) {
+        constexpr std::int32_t vec_size = DeviceEngine::vec_size;
+        const std::int64_t n_items = N_GEN / vec_size;
+        const std::int64_t n = n_items * vec_size;
+
+        // Prepare arrays for random numbers
+        std::vector<std::uint32_t> r_ref(n);
+        std::vector<std::uint32_t> r_kernel(n);
+        std::vector<std::uint32_t> r_host(n);
+
+        try {
+            Engine engine(queue, SEED);
+            oneapi::mkl::rng::skip_ahead(engine, DEVICE_OFFSET);
+
+            oneapi::mkl::rng::bits<std::uint32_t> distr;
+            cl::sycl::buffer<std::uint32_t, 1> r_ref_buffer(r_ref.data(), r_ref.size());
+            oneapi::mkl::rng::generate(distr, engine, n, r_ref_buffer);
+        }
+        catch (const oneapi::mkl::unimplemented& e) {
+            status = test_skipped;
+            return;
+        }
+        catch (cl::sycl::exception const& e) {
+            std::cout << "SYCL exception during generation" << std::endl
+                      << e.what() << std::endl
+                      << "OpenCL status: " << e.what() << std::endl;
+            status = test_failed;
+            return;
+        }
+
+        try {
+            cl::sycl::buffer<std::uint32_t, 1> r_buffer(r_kernel.data(), r_kernel.size());
+            get_sycl_queue(queue).submit([&](cl::sycl::handler& cgh) {
+                auto acc = r_buffer.template get_access<cl::sycl::access::mode::write>(cgh);
+                cgh.parallel_for(cl::sycl::range<1>(n_items), [=](cl::sycl::item<1> item) {
+                    std::uint64_t id = item.get_id(0);
+                    DeviceEngine device_engine(SEED, DEVICE_OFFSET + id * vec_size);
+                    oneapi::mkl::rng::device::bits<std::uint32_t> device_distr;
+                    auto res = oneapi::mkl::rng::device::generate(device_distr, device_engine);
+                    set_results(acc.get_pointer() + id * vec_size, res);
+                });
+            });
+        }
+        catch (cl::sycl::exception const& e) {
+            std::cout << "SYCL exception during generation" << std::endl
+                      << e.what() << std::endl
+                      << "OpenCL status: " << e.what() << std::endl;
+            status = test_failed;
+            return;
+        }
+
+        DeviceEngine host_engine(SEED, DEVICE_OFFSET);
+        oneapi::mkl::rng::device::bits<std::uint32_t> host_distr;
+        for (std::int64_t i = 0; i < n; i++) {
+            r_host[i] = oneapi::mkl::rng::device::generate_single(host_distr, host_engine);
+        }
+
+        // Validation
+        status = (check_equal_vector(r_ref, r_kernel) && check_equal_vector(r_ref, r_host));
+    }
+
+    int status = test_passed;
+
+private:
+    template <typename Ptr>
+    static void set_results(Ptr r, std::uint32_t res) {
+        r[0] = res;
+    }
+
+    template <typename Ptr, int N>
+    static void set_results(Ptr r, cl::sycl::vec<std::uint32_t, N> res) {
+        for (int i = 0; i < N; i++) {
+            r[i] = res[i];
+        }
+    }
+};
+
+#endif // _RNG_TEST_DEVICE_ENGINES_TEST_HPP__
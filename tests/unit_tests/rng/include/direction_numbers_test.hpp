@@ -0,0 +1,116 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _RNG_TEST_DIRECTION_NUMBERS_TEST_HPP__
+#define _RNG_TEST_DIRECTION_NUMBERS_TEST_HPP__
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl.hpp"
+
+#include "rng_test_common.hpp"
+
+// Defines for direction numbers tests
+#define N_DIMENSIONS  2
+#define N_BITS        32
+#define N_LEADING     10
+#define N_GEN_QUASI   (1 << N_LEADING)
+
+// Creates a quasi-random engine from a table in which every dimension has the
+// direction numbers of the van der Corput sequence, one per bit of the outputs.
+// All the coordinates of a point are then equal, which they are not with the
+// default direction numbers, and the leading bits of N_GEN_QUASI points in a
+// row from the start take each of their values once. A table whose size is not
+// a multiple of the dimensions must be rejected.
+template <typename Engine>
+class direction_numbers_test {
+public:
+    template <typename Queue>
+    void operator()(Queue queue) {
+        std::vector<std::uint32_t> direction_numbers;
+        for (int d = 0; d < N_DIMENSIONS; d++) {
+            for (int j = 0; j < N_BITS; j++)
+                direction_numbers.push_back(std::uint32_t(1) << (N_BITS - 1 - j));
+        }
+
+        // Prepare array for random numbers
+        std::vector<std::uint32_t> r(N_DIMENSIONS * N_GEN_QUASI);
+
+        try {
+            // Initialize rng objects
+            Engine engine(queue, N_DIMENSIONS, direction_numbers);
+
+            oneapi::mkl::rng::bits<std::uint32_t> distr;
+
+            cl::sycl::buffer<std::uint32_t, 1> r_buffer(r.data(), r.size());
+            oneapi::mkl::rng::generate(distr, engine, r.size(), r_buffer);
+        }
+        catch (const oneapi::mkl::unimplemented& e) {
+            status = test_skipped;
+            return;
+        }
+        catch (cl::sycl::exception const& e) {
+            std::cout << "SYCL exception during generation" << std::endl
+                      << e.what() << std::endl
+                      << "OpenCL status: " << e.what() << std::endl;
+            status = test_failed;
+            return;
+        }
+
+        try {
+            direction_numbers.pop_back();
+            Engine engine(queue, N_DIMENSIONS, direction_numbers);
+            std::cout << "Table of " << direction_numbers.size()
+                      << " direction numbers accepted for " << N_DIMENSIONS << " dimensions"
+                      << std::endl;
+            status = test_failed;
+            return;
+        }
+        catch (const oneapi::mkl::invalid_argument& e) {
+        }
+
+        // Validation
+        std::vector<bool> seen(N_GEN_QUASI, false);
+        for (int i = 0; i < N_GEN_QUASI; i++) {
+            const std::uint32_t* point = r.data() + i * N_DIMENSIONS;
+            for (int d = 1; d < N_DIMENSIONS; d++) {
+                if (point[d] != point[0]) {
+                    std::cout << "Coordinates of point " << i << " differ" << std::endl;
+                    status = test_failed;
+                    return;
+                }
+            }
+            const std::uint32_t leading = point[0] >> (N_BITS - N_LEADING);
+            if (seen[leading]) {
+                std::cout << "Leading bits of point " << i << " repeated" << std::endl;
+                status = test_failed;
+                return;
+            }
+            seen[leading] = true;
+        }
+    }
+
+    int status = test_passed;
+};
+
+#endif // _RNG_TEST_DIRECTION_NUMBERS_TEST_HPP__
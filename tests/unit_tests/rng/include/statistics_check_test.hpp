@@ -45,6 +45,25 @@
 #define POISSON_ARGS 0.5
 
 using namespace cl;
+
+// Argument the engines are created with: the seed of pseudo-random engines, and
+// one dimension for quasi-random engines, whose points are then the numbers of
+// a single sequence.
+template <typename Engine>
+constexpr std::uint32_t engine_arg() {
+    return SEED;
+}
+
+template <>
+constexpr std::uint32_t engine_arg<oneapi::mkl::rng::sobol>() {
+    return 1;
+}
+
+template <>
+constexpr std::uint32_t engine_arg<oneapi::mkl::rng::niederreiter>() {
+    return 1;
+}
+
 template <typename Distr, typename Engine>
 class statistics_test {
 public:
@@ -57,7 +76,7 @@ public:
         try {
             sycl::buffer<Type, 1> r_buffer(r.data(), r.size());
 
-            Engine engine(queue, SEED);
+            Engine engine(queue, engine_arg<Engine>());
             Distr distr(args...);
             oneapi::mkl::rng::generate(distr, engine, n_gen, r_buffer);
         }
@@ -95,7 +114,7 @@ public:
         std::vector<Type, decltype(ua)> r(n_gen, ua);
 
         try {
-            Engine engine(queue, SEED);
+            Engine engine(queue, engine_arg<Engine>());
             Distr distr(args...);
             auto event = oneapi::mkl::rng::generate(distr, engine, n_gen, r.data());
             event.wait_and_throw();
@@ -119,4 +138,88 @@ public:
     int status = test_passed;
 };
 
+// Vector-parameter distributions are checked with all parameters set to the same value
+// against the moments of the corresponding scalar distribution ScalarDistr
+template <typename Distr, typename ScalarDistr, typename Engine>
+class statistics_v_test {
+public:
+    template <typename Queue>
+    void operator()(Queue queue, std::int64_t n_gen, typename Distr::param_type param) {
+        using Type = typename Distr::result_type;
+        using ParamType = typename Distr::param_type;
+
+        std::vector<Type> r(n_gen);
+        std::vector<ParamType> params(n_gen, param);
+
+        try {
+            sycl::buffer<Type, 1> r_buffer(r.data(), r.size());
+            sycl::buffer<ParamType, 1> params_buffer(params.data(), params.size());
+
+            Engine engine(queue, engine_arg<Engine>());
+            Distr distr(params_buffer);
+            oneapi::mkl::rng::generate(distr, engine, n_gen, r_buffer);
+        }
+        catch (sycl::exception const& e) {
+            std::cout << "Caught synchronous SYCL exception during generation:\n"
+                      << e.what() << std::endl
+                      << "OpenCL status: " << e.what() << std::endl;
+        }
+        catch (const oneapi::mkl::unimplemented& e) {
+            status = test_skipped;
+            return;
+        }
+        catch (const std::runtime_error& error) {
+            std::cout << "Error raised during execution:\n" << error.what() << std::endl;
+        }
+
+        status = statistics<ScalarDistr>{}.check(r, ScalarDistr{ param });
+    }
+
+    int status = test_passed;
+};
+
+template <typename Distr, typename ScalarDistr, typename Engine>
+class statistics_v_usm_test {
+public:
+    template <typename Queue>
+    void operator()(Queue queue, std::int64_t n_gen, typename Distr::param_type param) {
+        using Type = typename Distr::result_type;
+        using ParamType = typename Distr::param_type;
+
+#ifdef CALL_RT_API
+        auto ua = sycl::usm_allocator<Type, sycl::usm::alloc::shared, 64>(queue);
+        auto ua_param = sycl::usm_allocator<ParamType, sycl::usm::alloc::shared, 64>(queue);
+#else
+        auto ua = sycl::usm_allocator<Type, sycl::usm::alloc::shared, 64>(queue.get_queue());
+        auto ua_param =
+            sycl::usm_allocator<ParamType, sycl::usm::alloc::shared, 64>(queue.get_queue());
+#endif
+        std::vector<Type, decltype(ua)> r(n_gen, ua);
+        std::vector<ParamType, decltype(ua_param)> params(n_gen, param, ua_param);
+
+        try {
+            Engine engine(queue, engine_arg<Engine>());
+            Distr distr(params.data(), n_gen);
+            auto event = oneapi::mkl::rng::generate(distr, engine, n_gen, r.data());
+            event.wait_and_throw();
+        }
+        catch (sycl::exception const& e) {
+            std::cout << "Caught synchronous SYCL exception during generation:\n"
+                      << e.what() << std::endl
+                      << "OpenCL status: " << e.what() << std::endl;
+        }
+        catch (const oneapi::mkl::unimplemented& e) {
+            status = test_skipped;
+            return;
+        }
+        catch (const std::runtime_error& error) {
+            std::cout << "Error raised during execution:\n" << error.what() << std::endl;
+        }
+
+        status = statistics<ScalarDistr>{}.check(r, ScalarDistr{ param });
+    }
+
+    int status = test_passed;
+};
+
 #endif // _RNG_TEST_STATISTICS_CHECK_TEST_HPP__
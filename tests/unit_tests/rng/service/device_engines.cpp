@@ -0,0 +1,91 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include "device_engines_test.hpp"
+
+#include <gtest/gtest.h>
+
+extern std::vector<cl::sycl::device*> devices;
+
+namespace {
+
+class Philox4x32x10Vec1DeviceEnginesTests : public ::testing::TestWithParam<cl::sycl::device*> {};
+
+TEST_P(Philox4x32x10Vec1DeviceEnginesTests, BinaryPrecision) {
+    rng_test<device_engines_test<oneapi::mkl::rng::philox4x32x10,
+                                 oneapi::mkl::rng::device::philox4x32x10<1>>>
+        test;
+    EXPECT_TRUEORSKIP((test(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(Philox4x32x10Vec1DeviceEnginesTestSuite,
+                         Philox4x32x10Vec1DeviceEnginesTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+class Philox4x32x10Vec4DeviceEnginesTests : public ::testing::TestWithParam<cl::sycl::device*> {};
+
+TEST_P(Philox4x32x10Vec4DeviceEnginesTests, BinaryPrecision) {
+    rng_test<device_engines_test<oneapi::mkl::rng::philox4x32x10,
+                                 oneapi::mkl::rng::device::philox4x32x10<4>>>
+        test;
+    EXPECT_TRUEORSKIP((test(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(Philox4x32x10Vec4DeviceEnginesTestSuite,
+                         Philox4x32x10Vec4DeviceEnginesTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+class Philox4x32x10Vec16DeviceEnginesTests : public ::testing::TestWithParam<cl::sycl::device*> {};
+
+TEST_P(Philox4x32x10Vec16DeviceEnginesTests, BinaryPrecision) {
+    rng_test<device_engines_test<oneapi::mkl::rng::philox4x32x10,
+                                 oneapi::mkl::rng::device::philox4x32x10<16>>>
+        test;
+    EXPECT_TRUEORSKIP((test(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(Philox4x32x10Vec16DeviceEnginesTestSuite,
+                         Philox4x32x10Vec16DeviceEnginesTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+class Mrg32k3aVec1DeviceEnginesTests : public ::testing::TestWithParam<cl::sycl::device*> {};
+
+TEST_P(Mrg32k3aVec1DeviceEnginesTests, BinaryPrecision) {
+    rng_test<device_engines_test<oneapi::mkl::rng::mrg32k3a,
+                                 oneapi::mkl::rng::device::mrg32k3a<1>>>
+        test;
+    EXPECT_TRUEORSKIP((test(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(Mrg32k3aVec1DeviceEnginesTestSuite, Mrg32k3aVec1DeviceEnginesTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+class Mrg32k3aVec8DeviceEnginesTests : public ::testing::TestWithParam<cl::sycl::device*> {};
+
+TEST_P(Mrg32k3aVec8DeviceEnginesTests, BinaryPrecision) {
+    rng_test<device_engines_test<oneapi::mkl::rng::mrg32k3a,
+                                 oneapi::mkl::rng::device::mrg32k3a<8>>>
+        test;
+    EXPECT_TRUEORSKIP((test(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(Mrg32k3aVec8DeviceEnginesTestSuite, Mrg32k3aVec8DeviceEnginesTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,48 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include "direction_numbers_test.hpp"
+
+#include <gtest/gtest.h>
+
+extern std::vector<cl::sycl::device*> devices;
+
+namespace {
+
+class SobolDirectionNumbersTests : public ::testing::TestWithParam<cl::sycl::device*> {};
+
+TEST_P(SobolDirectionNumbersTests, BinaryPrecision) {
+    rng_test<direction_numbers_test<oneapi::mkl::rng::sobol>> test;
+    EXPECT_TRUEORSKIP((test(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(SobolDirectionNumbersTestSuite, SobolDirectionNumbersTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+class NiederreiterDirectionNumbersTests : public ::testing::TestWithParam<cl::sycl::device*> {};
+
+TEST_P(NiederreiterDirectionNumbersTests, BinaryPrecision) {
+    rng_test<direction_numbers_test<oneapi::mkl::rng::niederreiter>> test;
+    EXPECT_TRUEORSKIP((test(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(NiederreiterDirectionNumbersTestSuite, NiederreiterDirectionNumbersTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,48 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include "generate_batch_test.hpp"
+
+#include <gtest/gtest.h>
+
+extern std::vector<cl::sycl::device*> devices;
+
+namespace {
+
+class Philox4x32x10GenerateBatchTests : public ::testing::TestWithParam<cl::sycl::device*> {};
+
+TEST_P(Philox4x32x10GenerateBatchTests, BinaryPrecision) {
+    rng_test<generate_batch_test<oneapi::mkl::rng::philox4x32x10>> test;
+    EXPECT_TRUEORSKIP((test(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(Philox4x32x10GenerateBatchTestSuite, Philox4x32x10GenerateBatchTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+class Mrg32k3aGenerateBatchTests : public ::testing::TestWithParam<cl::sycl::device*> {};
+
+TEST_P(Mrg32k3aGenerateBatchTests, BinaryPrecision) {
+    rng_test<generate_batch_test<oneapi::mkl::rng::mrg32k3a>> test;
+    EXPECT_TRUEORSKIP((test(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(Mrg32k3aGenerateBatchTestSuite, Mrg32k3aGenerateBatchTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
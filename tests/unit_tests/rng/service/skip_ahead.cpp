@@ -65,4 +65,24 @@ INSTANTIATE_TEST_SUITE_P(Mrg32k3aSkipAheadTestSuite, Mrg32k3aSkipAheadTests,
 INSTANTIATE_TEST_SUITE_P(Mrg32k3aSkipAheadExTestSuite, Mrg32k3aSkipAheadExTests,
                          ::testing::ValuesIn(devices), ::DeviceNamePrint());
 
+class SobolSkipAheadTests : public ::testing::TestWithParam<cl::sycl::device*> {};
+
+TEST_P(SobolSkipAheadTests, BinaryPrecision) {
+    rng_test<skip_ahead_test<oneapi::mkl::rng::sobol>> test;
+    EXPECT_TRUEORSKIP((test(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(SobolSkipAheadTestSuite, SobolSkipAheadTests, ::testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+class NiederreiterSkipAheadTests : public ::testing::TestWithParam<cl::sycl::device*> {};
+
+TEST_P(NiederreiterSkipAheadTests, BinaryPrecision) {
+    rng_test<skip_ahead_test<oneapi::mkl::rng::niederreiter>> test;
+    EXPECT_TRUEORSKIP((test(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(NiederreiterSkipAheadTestSuite, NiederreiterSkipAheadTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
 } // anonymous namespace
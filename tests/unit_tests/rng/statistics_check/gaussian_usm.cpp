@@ -40,6 +40,16 @@ TEST_P(GaussianIcdfUsmTest, RealSinglePrecision) {
         oneapi::mkl::rng::mrg32k3a>>
         test2;
     EXPECT_TRUEORSKIP((test2(GetParam(), N_GEN, GAUSSIAN_ARGS_FLOAT)));
+    rng_test<statistics_usm_test<
+        oneapi::mkl::rng::gaussian<float, oneapi::mkl::rng::gaussian_method::icdf>,
+        oneapi::mkl::rng::sobol>>
+        test3;
+    EXPECT_TRUEORSKIP((test3(GetParam(), N_GEN, GAUSSIAN_ARGS_FLOAT)));
+    rng_test<statistics_usm_test<
+        oneapi::mkl::rng::gaussian<float, oneapi::mkl::rng::gaussian_method::icdf>,
+        oneapi::mkl::rng::niederreiter>>
+        test4;
+    EXPECT_TRUEORSKIP((test4(GetParam(), N_GEN, GAUSSIAN_ARGS_FLOAT)));
 }
 
 TEST_P(GaussianIcdfUsmTest, RealDoublePrecision) {
@@ -53,6 +63,16 @@ TEST_P(GaussianIcdfUsmTest, RealDoublePrecision) {
         oneapi::mkl::rng::mrg32k3a>>
         test2;
     EXPECT_TRUEORSKIP((test2(GetParam(), N_GEN, GAUSSIAN_ARGS_DOUBLE)));
+    rng_test<statistics_usm_test<
+        oneapi::mkl::rng::gaussian<double, oneapi::mkl::rng::gaussian_method::icdf>,
+        oneapi::mkl::rng::sobol>>
+        test3;
+    EXPECT_TRUEORSKIP((test3(GetParam(), N_GEN, GAUSSIAN_ARGS_DOUBLE)));
+    rng_test<statistics_usm_test<
+        oneapi::mkl::rng::gaussian<double, oneapi::mkl::rng::gaussian_method::icdf>,
+        oneapi::mkl::rng::niederreiter>>
+        test4;
+    EXPECT_TRUEORSKIP((test4(GetParam(), N_GEN, GAUSSIAN_ARGS_DOUBLE)));
 }
 
 TEST_P(GaussianBoxmullerUsmTest, RealSinglePrecision) {